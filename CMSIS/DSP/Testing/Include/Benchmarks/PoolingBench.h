@@ -1,5 +1,6 @@
 #include "Test.h"
 #include "Pattern.h"
+#include "arm_nn_types.h"
 class PoolingBench:public Client::Suite
     {
         public:
@@ -9,33 +10,17 @@ class PoolingBench:public Client::Suite
         private:
             #include "PoolingBench_decl.h"
             
-            Client::Pattern<q7_t> input;
-
-            Client::LocalPattern<q7_t> tmpInput;
+            Client::LocalPattern<q7_t> input;
             Client::LocalPattern<q7_t> output;
-            Client::LocalPattern<q15_t> temp;
-
-            // Reference patterns are not loaded when we are in dump mode
-            Client::RefPattern<q7_t> ref;
-
-            int DIM_IN_X;
-            int DIM_IN_Y;
-            int DIM_OUT_X;
-            int DIM_OUT_Y;
-            int IN_CHANNEL;
-            int DIM_FILTER_X;
-            int DIM_FILTER_Y;
-            int PAD_WIDTH;
-            int PAD_HEIGHT;
-            int STRIDE_X;
-            int STRIDE_Y;
-            int ACT_MIN;
-            int ACT_MAX;
 
-            int repeatNb;
+            cmsis_nn_context ctx;
+            cmsis_nn_pool_params poolParams;
+            cmsis_nn_per_tensor_quant_params quantParams;
+            cmsis_nn_dims inputDims;
+            cmsis_nn_dims filterDims;
+            cmsis_nn_dims outputDims;
 
-            q7_t *tmpin;
+            q7_t *inp;
             q7_t *outp;
-            q15_t *tempp;
 
     };
@@ -5,34 +5,33 @@
 
 #include <cstdio>
 
+/* Input and output zero points and a scale change of 1/2 for the requantized variants */
+#define INPUT_OFFSET 5
+#define OUTPUT_OFFSET -3
+#define REQUANT_MULT 1073741824
+#define REQUANT_SHIFT 0
+
 
     void PoolingBench::test_avgpool_s8()
     {
+       arm_avgpool_s8(&ctx, &poolParams, &inputDims, inp, &filterDims, &outputDims, outp);
+    } 
 
-      //for(int i=0; i < this->repeatNb; i++)
-      {
-       arm_avgpool_s8(
-           DIM_IN_Y,
-           DIM_IN_X,
-           DIM_OUT_Y,
-           DIM_OUT_X,
-           STRIDE_Y,
-           STRIDE_X,
-           DIM_FILTER_Y,
-           DIM_FILTER_X,
-           PAD_HEIGHT,
-           PAD_WIDTH,
-           ACT_MIN,
-           ACT_MAX,
-           IN_CHANNEL,
-           tmpin,
-           tempp,
-           outp);
-       
-       }
+    void PoolingBench::test_max_pool_s8()
+    {
+       arm_max_pool_s8(&ctx, &poolParams, &inputDims, inp, &filterDims, &outputDims, outp);
+    } 
 
-       //ASSERT_EQ(this->ref,this->output);
+    void PoolingBench::test_avgpool_s8_requantize()
+    {
+       arm_avgpool_s8_requantize(&ctx, &poolParams, &quantParams, INPUT_OFFSET, OUTPUT_OFFSET,
+                                 &inputDims, inp, &filterDims, &outputDims, outp);
+    } 
 
+    void PoolingBench::test_max_pool_s8_requantize()
+    {
+       arm_max_pool_s8_requantize(&ctx, &poolParams, &quantParams, INPUT_OFFSET, OUTPUT_OFFSET,
+                                  &inputDims, inp, &filterDims, &outputDims, outp);
     } 
 
   
@@ -40,45 +39,53 @@
     {
 
        std::vector<Testing::param_t>::iterator it = paramsArgs.begin();
-       this->repeatNb = *it;
+       int nbh = *it++;
+       int nbc = *it++;
+       int k = *it;
+
+       /* Non overlapping windows: the stride is the window size */
+       int nbo = (nbh - k) / k + 1;
+
+       this->inputDims.n = 1;
+       this->inputDims.h = nbh;
+       this->inputDims.w = nbh;
+       this->inputDims.c = nbc;
+
+       this->filterDims.n = 1;
+       this->filterDims.h = k;
+       this->filterDims.w = k;
+       this->filterDims.c = 1;
+
+       this->outputDims.n = 1;
+       this->outputDims.h = nbo;
+       this->outputDims.w = nbo;
+       this->outputDims.c = nbc;
+
+       this->poolParams.stride.h = k;
+       this->poolParams.stride.w = k;
+       this->poolParams.padding.h = 0;
+       this->poolParams.padding.w = 0;
+       this->poolParams.activation.min = -128;
+       this->poolParams.activation.max = 127;
+
+       this->quantParams.multiplier = REQUANT_MULT;
+       this->quantParams.shift = REQUANT_SHIFT;
+
+       /* The pooling kernels need no scratch buffer */
+       this->ctx.buf = NULL;
+       this->ctx.size = 0;
+
+       input.create(nbh * nbh * nbc,PoolingBench::INPUT_S8_ID,mgr);
+       output.create(nbo * nbo * nbc,PoolingBench::OUTPUT_S8_ID,mgr);
+
+       this->inp = input.ptr();
+       this->outp = output.ptr();
 
-       switch(id)
+       /* Deterministic input covering the whole s8 range */
+       for(int i=0; i < nbh * nbh * nbc; i++)
        {
-          case PoolingBench::TEST_AVGPOOL_S8_1:
-            input.reload(PoolingBench::INPUT1_S8_ID,mgr);
-            ref.reload(PoolingBench::REF1_S8_ID,mgr);
-
-            this->DIM_IN_X= 4;
-            this->DIM_IN_Y= 2;
-            this->DIM_OUT_X= 2;
-            this->DIM_OUT_Y= 1;
-            this->IN_CHANNEL= 101;
-            this->DIM_FILTER_X= 2;
-            this->DIM_FILTER_Y= 2;
-            this->PAD_WIDTH=  0;
-            this->PAD_HEIGHT= 0;
-            this->STRIDE_X= 2;
-            this->STRIDE_Y= 2;
-            this->ACT_MIN= -128;
-            this->ACT_MAX= 127;
-
-          break; 
-
-
+          this->inp[i] = (q7_t)((i * 37) & 0xFF);
        }
-       temp.create(this->DIM_OUT_X * this->IN_CHANNEL,PoolingBench::TEMP_S8_ID,mgr);
-
-       output.create(ref.nbSamples(),PoolingBench::OUTPUT_S8_ID,mgr);
-       tmpInput.create(input.nbSamples(),PoolingBench::TEMPINPUT_S8_ID,mgr);
-
-       const q7_t *inp = input.ptr();
-
-
-       this->tmpin = tmpInput.ptr();
-       this->outp = output.ptr();
-       this->tempp = temp.ptr();
-
-       memcpy(tmpin,inp,input.nbSamples());
 
     }
 
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_profile.h
+ * Description:  Public header file of the optional profiling hooks of the
+ *               TensorFlowLite micro compliant functions
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_NN_PROFILE_H
+#define _ARM_NN_PROFILE_H
+
+#include <stdint.h>
+#include "arm_nn_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @defgroup Profile Profiling Hooks
+ *
+ * The s8, s4 and s16 layer functions call a begin and an end callback around their execution when the library is
+ * built with ARM_NN_PROFILE defined. Without ARM_NN_PROFILE the hooks are not compiled in and have no cost.
+ *
+ * The callbacks get the kernel id, the tensor dimensions and the number of multiply-accumulate operations of the
+ * call, which is enough to attribute the execution time to the layers of a network. The default callbacks,
+ * arm_nn_profile_default_begin() and arm_nn_profile_default_end(), accumulate the cycles per kernel using:
+ *    - The PMU cycle counter of pmu_armv8.h if ARM_NN_PROFILE_PMU is defined and the device has a PMU
+ *    - DWT->CYCCNT for Armv7-M and Armv8-M Mainline
+ *    - clock() otherwise, e.g. for host builds
+ *
+ * The device header is included through CMSIS_device_header for the cycle counters.
+ *
+ * The wrapper functions, e.g. arm_convolve_wrapper_s8(), are not instrumented themselves. The function that they
+ * select is reported. An optimized function that falls back to a reference function, e.g. arm_depthwise_conv_s8_opt()
+ * without DSP extension, is reported as the reference function.
+ */
+
+/** Kernel identifiers of arm_nn_profile_event */
+typedef enum
+{
+    ARM_NN_KERNEL_CONVOLVE_S8,
+    ARM_NN_KERNEL_CONVOLVE_1X1_S8_FAST,
+    ARM_NN_KERNEL_CONVOLVE_1X1_S4_FAST,
+    ARM_NN_KERNEL_CONVOLVE_1_X_N_S8,
+    ARM_NN_KERNEL_CONVOLVE_SMALL_CH_S8,
+    ARM_NN_KERNEL_DEPTHWISE_CONV_S8,
+    ARM_NN_KERNEL_DEPTHWISE_CONV_S8_OPT,
+    ARM_NN_KERNEL_DEPTHWISE_CONV_3X3_S8,
+    ARM_NN_KERNEL_DEPTHWISE_CONV_CH_MULT_S8,
+    ARM_NN_KERNEL_FULLY_CONNECTED_S8,
+    ARM_NN_KERNEL_FULLY_CONNECTED_S4,
+    ARM_NN_KERNEL_FULLY_CONNECTED_SPARSE_S8,
+    ARM_NN_KERNEL_BATCH_MATMUL_S8,
+    ARM_NN_KERNEL_AVGPOOL_S8,
+    ARM_NN_KERNEL_MAX_POOL_S8,
+    ARM_NN_KERNEL_ELEMENTWISE_ADD_S8,
+    ARM_NN_KERNEL_ELEMENTWISE_MUL_S8,
+    ARM_NN_KERNEL_RELU6_S8,
+    ARM_NN_KERNEL_ACTIVATION_LUT_S8,
+    ARM_NN_KERNEL_ACTIVATION_LUT_S16,
+    ARM_NN_KERNEL_SOFTMAX_S8,
+    ARM_NN_KERNEL_SOFTMAX_S8_FAST,
+    ARM_NN_KERNEL_LOG_SOFTMAX_S8,
+    ARM_NN_KERNEL_SOFTMAX_S16,
+    ARM_NN_KERNEL_LAYER_NORM_S16,
+    ARM_NN_KERNEL_MEAN_S8,
+    ARM_NN_KERNEL_REDUCE_SUM_S8,
+    ARM_NN_KERNEL_QUANTIZE_F32_S8,
+    ARM_NN_KERNEL_QUANTIZE_F32_S16,
+    ARM_NN_KERNEL_DEQUANTIZE_S8_F32,
+    ARM_NN_KERNEL_REQUANTIZE_S8,
+    ARM_NN_KERNEL_REQUANTIZE_PER_CHANNEL_S8,
+    ARM_NN_KERNEL_CONCATENATION_S8,
+    ARM_NN_KERNEL_RESHAPE_S8,
+    ARM_NN_KERNEL_PAD_S8,
+    ARM_NN_KERNEL_STRIDED_SLICE_S8,
+    ARM_NN_KERNEL_COUNT /**< Number of kernel identifiers */
+} arm_nn_kernel_id;
+
+/** CMSIS-NN object passed to the profiling callbacks */
+typedef struct
+{
+    arm_nn_kernel_id     kernel;       /**< Kernel that is executed */
+    const cmsis_nn_dims *input_dims;   /**< Input tensor dimensions. NULL if the kernel has no dims argument */
+    const cmsis_nn_dims *filter_dims;  /**< Filter or pooling window dimensions. NULL if not used by the kernel */
+    const cmsis_nn_dims *output_dims;  /**< Output tensor dimensions. NULL if the kernel has no dims argument */
+    int64_t              macs;         /**< Multiply-accumulate operations of the call. 0 if the kernel has none */
+    uint32_t             timestamp;    /**< Free for use by the callbacks, e.g. to store the begin time */
+} arm_nn_profile_event;
+
+/** Accumulated statistics of the default profiling callbacks */
+typedef struct
+{
+    uint32_t calls;   /**< Number of calls */
+    uint64_t cycles;  /**< Sum of the cycles of the calls */
+    int64_t  macs;    /**< Sum of the multiply-accumulate operations of the calls */
+} arm_nn_profile_stats;
+
+/** Profiling callback. The end callback gets the same event object as the begin callback. */
+typedef void (*arm_nn_profile_callback)(arm_nn_profile_event *event);
+
+/**
+ * @brief Set the profiling callbacks. The default callbacks are used until this function is called.
+ * @param[in]   begin   Called before the kernel is executed. NULL disables the callback.
+ * @param[in]   end     Called after the kernel is executed. NULL disables the callback.
+ *
+ * @details     A callback for per layer profiling can call the default callback and read the
+ *              begin time from event->timestamp and the current time with arm_nn_profile_cycles().
+ */
+void arm_nn_profile_set_callbacks(arm_nn_profile_callback begin, arm_nn_profile_callback end);
+
+/**
+ * @brief Default begin callback. Stores the cycle counter in event->timestamp.
+ * @param[in, out]  event   Profiling event
+ */
+void arm_nn_profile_default_begin(arm_nn_profile_event *event);
+
+/**
+ * @brief Default end callback. Adds the call to the statistics of the kernel.
+ * @param[in]   event   Profiling event
+ */
+void arm_nn_profile_default_end(arm_nn_profile_event *event);
+
+/**
+ * @brief Enable the cycle counter and clear the statistics of the default callbacks.
+ *        Call it before the first profiled inference.
+ */
+void arm_nn_profile_reset(void);
+
+/**
+ * @brief Current value of the cycle counter used by the default callbacks.
+ * @return      Cycle counter value, wraps around at 2^32
+ */
+uint32_t arm_nn_profile_cycles(void);
+
+/**
+ * @brief Statistics of a kernel accumulated by the default callbacks.
+ * @param[in]   kernel  Kernel identifier
+ * @return      Pointer to the statistics or NULL if the kernel identifier is invalid
+ */
+const arm_nn_profile_stats *arm_nn_profile_get_stats(arm_nn_kernel_id kernel);
+
+/**
+ * @brief Name of a kernel, e.g. "arm_convolve_s8".
+ * @param[in]   kernel  Kernel identifier
+ * @return      Name of the kernel or "unknown"
+ */
+const char *arm_nn_profile_kernel_name(arm_nn_kernel_id kernel);
+
+/**
+ * @brief Called by the kernels. Forwards the event to the begin callback.
+ */
+void arm_nn_profile_begin(arm_nn_profile_event *event);
+
+/**
+ * @brief Called by the kernels. Forwards the event to the end callback.
+ */
+void arm_nn_profile_end(arm_nn_profile_event *event);
+
+/**
+ * @brief Hooks used in the kernels. ARM_NN_PROFILE_BEGIN() declares the event object so ARM_NN_PROFILE_END()
+ *        must be in the same or an inner scope. The arguments are not evaluated if ARM_NN_PROFILE is not defined.
+ */
+#if defined(ARM_NN_PROFILE)
+#define ARM_NN_PROFILE_BEGIN(kernel_id, in_dims, flt_dims, out_dims, mac_count)                                       \
+    arm_nn_profile_event arm_nn_profile_evt = {(kernel_id), (in_dims), (flt_dims), (out_dims), (mac_count), 0U};       \
+    arm_nn_profile_begin(&arm_nn_profile_evt)
+#define ARM_NN_PROFILE_END() arm_nn_profile_end(&arm_nn_profile_evt)
+#else
+#define ARM_NN_PROFILE_BEGIN(kernel_id, in_dims, flt_dims, out_dims, mac_count)
+#define ARM_NN_PROFILE_END()
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ARM_NN_PROFILE_H
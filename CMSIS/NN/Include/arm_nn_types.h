@@ -115,6 +115,44 @@ typedef struct
     cmsis_nn_activation activation;
 } cmsis_nn_fc_params;
 
+/** CMSIS-NN object for Batch Matmul layer parameters */
+typedef struct
+{
+    int32_t             adj_x;      /**< Non-zero if the LHS matrix is stored transposed */
+    int32_t             adj_y;      /**< Non-zero if the RHS matrix is stored transposed */
+    cmsis_nn_fc_params  fc_params;  /**< input_offset and filter_offset are the LHS and RHS zero values */
+} cmsis_nn_bmm_params;
+
+/** CMSIS-NN object for the s16 softmax look-up tables. Each table has 513 entries. */
+typedef struct
+{
+    const int16_t *exp_lut;        /**< Look-up table for exp(x), x in [-10.0, 0.0] */
+    const int16_t *one_by_one_lut; /**< Look-up table for 1 / (1 + x), x in [0.0, 1.0] */
+} cmsis_nn_softmax_lut_s16;
+
+/** Number of entries of the s8 activation look-up tables, see arm_activation_lut_s8() */
+#define ARM_NN_ACTIVATION_LUT_S8_SIZE 256
+
+/** Number of entries of the interpolated s16 activation look-up tables, see arm_activation_lut_s16() */
+#define ARM_NN_ACTIVATION_LUT_S16_SIZE 513
+
+/** Largest number of input channels handled by arm_convolve_small_ch_s8() */
+#define ARM_NN_CONV_SMALL_CH_MAX 3
+
+/** Number of consecutive columns in one block of cmsis_nn_sparse_weights */
+#define ARM_NN_SPARSE_BLOCK_SIZE 4
+
+/**
+ * CMSIS-NN object for block sparse weights. Only the blocks of ARM_NN_SPARSE_BLOCK_SIZE consecutive
+ * columns that are not all zero are stored, row by row, in a compressed sparse row format.
+ */
+typedef struct
+{
+    const int8_t   *values;       /**< Values of the stored blocks. ARM_NN_SPARSE_BLOCK_SIZE values per block */
+    const uint16_t *block_cols;   /**< Column of each stored block, in units of blocks. Increasing within a row */
+    const int32_t  *row_offsets;  /**< Index of the first stored block of each row. Number of rows + 1 entries */
+} cmsis_nn_sparse_weights;
+
 #endif // _ARM_NN_TYPES_H
 
 
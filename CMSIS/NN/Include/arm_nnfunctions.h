@@ -282,6 +282,93 @@ extern    "C"
                                const cmsis_nn_dims* output_dims,
                                q7_t *output_data);
 
+  /**
+   * @brief Basic s8 convolution function writing to a slice of the channels of a larger output tensor
+   * @param[in, out] ctx            Function context. Same as for arm_convolve_s8()
+   * @param[in]      conv_params    Convolution parameters. Same as for arm_convolve_s8()
+   * @param[in]      quant_params   Per-channel quantization info. Same as for arm_convolve_s8()
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+   * @param[in]      filter_data    Filter data pointer. Data type: int8
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions of this layer. Format: [N, H, W, C_OUT]
+   * @param[out]     output_data    Pointer to the first channel of the slice in the larger output tensor.
+   *                                Data type: int8
+   * @param[in]      output_ch_stride  Number of channels of the larger output tensor, i.e. the distance in
+   *                                   elements between two output positions. Range: C_OUT or more
+   *
+   * @return     The function returns either
+   *             <code>ARM_MATH_ARGUMENT_ERROR</code> if output_ch_stride is less than C_OUT or
+   *             <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite micro
+   *    - The output channels of this layer are written to channel offset (output_data - start of the larger
+   *      tensor) to offset + C_OUT of every position of the larger tensor. The other channels are not
+   *      written. A concatenation along the channels can be done by letting each producing layer write its
+   *      slice, instead of calling arm_concatenation_s8_x() afterwards.
+   *    - arm_convolve_s8() is the same as this function with output_ch_stride equal to C_OUT.
+   *    - The buffer size is given by arm_convolve_s8_get_buffer_size().
+   *
+   */
+    arm_status arm_convolve_s8_strided_output(const cmsis_nn_context* ctx,
+                                              const cmsis_nn_conv_params* conv_params,
+                                              const cmsis_nn_per_channel_quant_params* quant_params,
+                                              const cmsis_nn_dims* input_dims,
+                                              const q7_t *input_data,
+                                              const cmsis_nn_dims* filter_dims,
+                                              const q7_t *filter_data,
+                                              const cmsis_nn_dims* bias_dims,
+                                              const int32_t *bias_data,
+                                              const cmsis_nn_dims* output_dims,
+                                              q7_t *output_data,
+                                              const int32_t output_ch_stride);
+
+  /**
+   * @brief Basic s8 convolution function with an activation look-up table fused into the output stage
+   * @param[in, out] ctx            Function context. Same as for arm_convolve_s8()
+   * @param[in]      conv_params    Convolution parameters. Same as for arm_convolve_s8(). The output offset and
+   *                                activation range are the ones of the convolution output before the activation.
+   * @param[in]      quant_params   Per-channel quantization info. Same as for arm_convolve_s8()
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+   * @param[in]      filter_data    Filter data pointer. Data type: int8
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+   * @param[out]     output_data    Output data pointer. Data type: int8
+   * @param[in]      lut            Activation look-up table with ARM_NN_ACTIVATION_LUT_S8_SIZE entries, e.g. from
+   *                                arm_activation_lut_init_s8()
+   *
+   * @return     The function returns either
+   *             <code>ARM_MATH_ARGUMENT_ERROR</code> if lut is NULL or
+   *             <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite micro
+   *    - The result is the same as arm_convolve_s8() followed by arm_activation_lut_s8(), without a second pass
+   *      over the output tensor. The MVE implementation looks up the requantized values with a gather load
+   *      before they are stored, the other implementations look up each block of outputs right after it is
+   *      written.
+   *    - The buffer size is given by arm_convolve_s8_get_buffer_size().
+   *
+   */
+    arm_status arm_convolve_s8_lut(const cmsis_nn_context* ctx,
+                                   const cmsis_nn_conv_params* conv_params,
+                                   const cmsis_nn_per_channel_quant_params* quant_params,
+                                   const cmsis_nn_dims* input_dims,
+                                   const q7_t *input_data,
+                                   const cmsis_nn_dims* filter_dims,
+                                   const q7_t *filter_data,
+                                   const cmsis_nn_dims* bias_dims,
+                                   const int32_t *bias_data,
+                                   const cmsis_nn_dims* output_dims,
+                                   q7_t *output_data,
+                                   const q7_t *lut);
+
   /**
    * @brief Get the required buffer size for s8 convolution function
    *
@@ -611,6 +698,61 @@ extern    "C"
    */
     int32_t arm_convolve_1x1_s8_fast_get_buffer_size(const cmsis_nn_dims* input_dims);
 
+  /**
+   * @brief Fast s8 version for 1x1 convolution with packed s4 weights
+   *
+   * @param[in, out] ctx                Function context that contains the additional buffer if required by the implementation.
+                                        arm_convolve_1x1_s4_fast_get_buffer_size will return the buffer_size if required
+   * @param[in]      conv_params        Convolution parameters (e.g. strides, dilations, pads,...).
+   *                                    Range of conv_params->input_offset  : [-127, 128]
+   *                                    Range of conv_params->output_offset : [-128, 127]
+   * @param[in]      quant_params       Per-channel quantization info.
+   *                                    It contains the multiplier and shift values to be applied to each output channel
+   * @param[in]      input_dims         Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]      input_data         Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims        Filter tensor dimensions. Format: [C_OUT, 1, 1, C_IN]
+   * @param[in]      packed_filter_data Filter data pointer. Data type: int4 packed two per byte, the first value of
+   *                                    each pair in the low nibble. Size: C_OUT * C_IN / 2 bytes
+   * @param[in]      bias_dims          Bias tensor dimensions. Format: [C_OUT]
+   * @param[in]      bias_data          Bias data pointer. Data type: int32
+   * @param[in]      output_dims        Output tensor dimensions. Format: [N, H, W, C_OUT]
+   * @param[out]     output_data        Output data pointer. Data type: int8
+   *
+   * @return     The function returns either
+   *                  <code>ARM_MATH_SIZE_MISMATCH</code> if argument constraints fail. or,
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *   - Supported framework : TensorFlow Lite Micro
+   *   - The weights are unpacked in-register, so the flash reads of the filter are halved compared to
+   *     arm_convolve_1x1_s8_fast()
+   *   - The following constrains on the arguments apply
+   *      -# input_dims->c is a multiple of 2
+   *      -# conv_params->padding.w = conv_params->padding.h = 0
+   *      -# conv_params->stride.w = conv_params->stride.h = 1
+   *
+   */
+    arm_status arm_convolve_1x1_s4_fast(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_conv_params *conv_params,
+                                        const cmsis_nn_per_channel_quant_params *quant_params,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const q7_t *packed_filter_data,
+                                        const cmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data);
+
+  /**
+   * @brief Get the required buffer size for arm_convolve_1x1_s4_fast
+   *
+   * @param[in]       input_dims            Input (activation) dimensions
+   * @return          The function returns the required buffer size in bytes
+   *
+   */
+    int32_t arm_convolve_1x1_s4_fast_get_buffer_size(const cmsis_nn_dims *input_dims);
+
   /**
    * @brief 1xn convolution
    *
@@ -669,6 +811,61 @@ extern    "C"
     int32_t arm_convolve_1_x_n_s8_get_buffer_size(const cmsis_nn_dims* input_dims,
                                                   const cmsis_nn_dims* filter_dims);
 
+  /**
+   * @brief Direct s8 convolution for layers with few input channels, e.g. the first layer of a vision
+   *        or audio model.
+   *
+   * @param[in, out] ctx            Function context. Not used, no additional buffer is required.
+   * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+   *                                Range of conv_params->input_offset  : [-127, 128]
+   *                                Range of conv_params->output_offset : [-128, 127]
+   * @param[in]      quant_params   Per-channel quantization info.
+   *                                It contains the multiplier and shift values to be applied to each output channel
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+   *                                spatial filter dimensions
+   * @param[in]      filter_data    Filter data pointer. Data type: int8
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+   * @param[out]     output_data    Output data pointer. Data type: int8
+   *
+   * @return     The function returns either
+   *                  <code>ARM_MATH_SIZE_MISMATCH</code> if argument constraints fail. or,
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *   - Supported framework : TensorFlow Lite Micro
+   *   - The following constrains on the arguments apply
+   *      -# input_dims->c is at most ARM_NN_CONV_SMALL_CH_MAX
+   *   - No im2col buffer is built. The valid part of each kernel row is read in place from the input and
+   *     every input load is shared by four output channels.
+   *
+   */
+   arm_status arm_convolve_small_ch_s8(const cmsis_nn_context* ctx,
+                                       const cmsis_nn_conv_params* conv_params,
+                                       const cmsis_nn_per_channel_quant_params* quant_params,
+                                       const cmsis_nn_dims* input_dims,
+                                       const q7_t *input_data,
+                                       const cmsis_nn_dims* filter_dims,
+                                       const q7_t *filter_data,
+                                       const cmsis_nn_dims* bias_dims,
+                                       const int32_t *bias_data,
+                                       const cmsis_nn_dims* output_dims,
+                                       q7_t *output_data);
+
+  /**
+   * @brief Get the required additional buffer size for arm_convolve_small_ch_s8
+   *
+   * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+   * @return          The function returns  required buffer size(bytes), which is 0
+   *
+   */
+    int32_t arm_convolve_small_ch_s8_get_buffer_size(const cmsis_nn_dims* input_dims,
+                                                     const cmsis_nn_dims* filter_dims);
+
   /**
    * @brief Q7 version of convolution for RGB image
    * @param[in]       Im_in       pointer to input tensor
@@ -916,7 +1113,6 @@ extern    "C"
    *                                Optional function {API}_get_buffer_size() provides the buffer
    *                                size if required.
    * @param[in]      dw_conv_params Depthwise convolution parameters (e.g. strides, dilations, pads,...)
-   *                                dw_conv_params->dilation is not used.
    *                                Range of dw_conv_params->input_offset : [-127, 128]
    *                                Range of dw_conv_params->output_offset : [-128, 127]
    * @param[in]      quant_params   Per-channel quantization info.
@@ -932,14 +1128,15 @@ extern    "C"
    * @param[in]      output_dims    Output tensor dimensions. Format: [1, H, W, C_OUT]
    * @param[in, out] output_data    Output data pointer. Data type: int8
    * @return     The function returns
+   *                <code>ARM_MATH_ARGUMENT_ERROR</code> - dilation less than 1 or
    *                <code>ARM_MATH_SUCCESS</code>   -  Successful completion.
    *
    * @details
    *    - Supported framework: TensorFlow Lite
    *    - Picks one of the the following functions
-   *        -# arm_depthwise_conv_s8()
    *        -# arm_depthwise_conv_3x3_s8() - Cortex-M CPUs with DSP extension only
    *        -# arm_depthwise_conv_s8_opt()
+   *        -# arm_depthwise_conv_ch_mult_s8() - ch_mult greater than 1
    *    - q7 is used as data type eventhough it is s8 data. It is done so to be consistent with existing APIs.
    *    - Check details of arm_depthwise_conv_s8_opt() for potential data that can be accessed outside of the boundary.
    */
@@ -959,7 +1156,6 @@ extern    "C"
    * @brief Get size of additional buffer required by arm_depthwise_conv_wrapper_s8()
    *
    * @param[in]      dw_conv_params Depthwise convolution parameters (e.g. strides, dilations, pads,...)
-   *                                dw_conv_params->dilation is not used.
    *                                Range of dw_conv_params->input_offset : [-127, 128]
    *                                Range of dw_conv_params->input_offset : [-128, 127]
    * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
@@ -983,7 +1179,6 @@ extern    "C"
    *                                size if an additional buffer is required.
    *                                exists if additional memory is.
    * @param[in]      dw_conv_params Depthwise convolution parameters (e.g. strides, dilations, pads,...)
-   *                                dw_conv_params->dilation is not used.
    *                                Range of dw_conv_params->input_offset : [-127, 128]
    *                                Range of dw_conv_params->input_offset : [-128, 127]
    * @param[in]      quant_params   Per-channel quantization info.
@@ -998,7 +1193,9 @@ extern    "C"
    * @param[in]      bias_data      Bias data pointer. Data type: int32
    * @param[in]      output_dims    Output tensor dimensions. Format: [1, H, W, C_OUT]
    * @param[in, out] output_data    Output data pointer. Data type: int8
-   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   * @return     The function returns either
+   *             <code>ARM_MATH_ARGUMENT_ERROR</code> if the dilation is less than 1 or
+   *             <code>ARM_MATH_SUCCESS</code> on successful completion.
    *
    * @details
    *    - Supported framework: TensorFlow Lite
@@ -1016,6 +1213,47 @@ extern    "C"
                                     const cmsis_nn_dims *output_dims,
                                     q7_t *output_data);
 
+   /**
+   * @brief Basic s8 depthwise convolution function writing to a slice of the channels of a larger output tensor.
+   *
+   * @param[in, out] ctx            Function context. Same as for arm_depthwise_conv_s8()
+   * @param[in]      dw_conv_params Depthwise convolution parameters. Same as for arm_depthwise_conv_s8()
+   * @param[in]      quant_params   Per-channel quantization info. Same as for arm_depthwise_conv_s8()
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [1, H, W, C_IN]
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
+   * @param[in]      filter_data    Filter data pointer. Data type: int8
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions of this layer. Format: [1, H, W, C_OUT]
+   * @param[in, out] output_data    Pointer to the first channel of the slice in the larger output tensor.
+   *                                Data type: int8
+   * @param[in]      output_ch_stride  Number of channels of the larger output tensor, i.e. the distance in
+   *                                   elements between two output positions. Range: C_OUT or more
+   * @return     The function returns either
+   *             <code>ARM_MATH_ARGUMENT_ERROR</code> if output_ch_stride is less than C_OUT or the dilation
+   *             is less than 1 or
+   *             <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite
+   *    - Only the C_OUT channels of the slice are written at every output position. Refer to
+   *      arm_convolve_s8_strided_output() for the use in a concatenation along the channels.
+   *    - arm_depthwise_conv_s8() is the same as this function with output_ch_stride equal to C_OUT.
+   */
+   arm_status arm_depthwise_conv_s8_strided_output(const cmsis_nn_context *ctx,
+                                                   const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                   const cmsis_nn_per_channel_quant_params *quant_params,
+                                                   const cmsis_nn_dims *input_dims,
+                                                   const q7_t *input_data,
+                                                   const cmsis_nn_dims *filter_dims,
+                                                   const q7_t *filter_data,
+                                                   const cmsis_nn_dims *bias_dims,
+                                                   const int32_t *bias_data,
+                                                   const cmsis_nn_dims *output_dims,
+                                                   q7_t *output_data,
+                                                   const int32_t output_ch_stride);
+
    /**
    * @brief Optimized s8 depthwise convolution function for 3x3 kernel size with some constraints on
    *        the input arguments(documented below). Refer arm_depthwise_conv_s8() for function
@@ -1023,7 +1261,7 @@ extern    "C"
    *
    * @return     The function returns one of the following
    *                <code>ARM_MATH_SIZE_MISMATCH</code> - Unsupported dimension of tensors
-   *                <code>ARM_MATH_ARGUMENT_ERROR</code> - Unsupported pad size along the x axis
+   *                <code>ARM_MATH_ARGUMENT_ERROR</code> - Unsupported pad size along the x axis or dilation
    *                <code>ARM_MATH_SUCCESS</code> - Successful operation
    *
    * @details
@@ -1032,6 +1270,7 @@ extern    "C"
    *      -# Number of input channel equals number of output channels
    *      -# Filter height and width equals 3
    *      -# Padding along x is either 0 or 1.
+   *      -# Dilation along x and y is 1.
    *
    */
    arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
@@ -1053,6 +1292,7 @@ extern    "C"
    * @return     The function returns one of the following
    *                <code>ARM_MATH_SIZE_MISMATCH</code> - input channel != output channel or
    *                                                      ch_mult != 1
+   *                <code>ARM_MATH_ARGUMENT_ERROR</code> - dilation less than 1
    *                <code>ARM_MATH_SUCCESS</code> - Successful operation
    *
    * @note       If number of channels is not a multiple of 4, upto 3 elements outside the boundary will be read out
@@ -1093,6 +1333,56 @@ extern    "C"
    int32_t arm_depthwise_conv_s8_opt_get_buffer_size(const cmsis_nn_dims* input_dims,
                                                      const cmsis_nn_dims* filter_dims);
 
+   /**
+   * @brief Optimized s8 depthwise convolution function for a channel multiplier greater than 1.
+   *        Refer arm_depthwise_conv_s8() for function argument details.
+   *
+   * @return     The function returns one of the following
+   *                <code>ARM_MATH_SIZE_MISMATCH</code> - output channel != input channel * ch_mult
+   *                <code>ARM_MATH_ARGUMENT_ERROR</code> - dilation less than 1
+   *                <code>ARM_MATH_SUCCESS</code> - Successful operation
+   *
+   * @note       If number of output channels is not a multiple of 4, upto 3 elements outside the boundary will be
+   *             read out for the following if MVE optimizations(Arm Helium Technology) are used.
+   *               - Output shift
+   *               - Output multiplier
+   *               - Output bias
+   *               - kernel
+   * @details
+   *    - Supported framework: TensorFlow Lite
+   *    - The following constrains on the arguments apply
+   *        -# Number of output channels equals number of input channels multiplied by ch_mult
+   *    - The input values are expanded once per output position and shared by the ch_mult output channels of
+   *      an input channel, instead of being reloaded per output channel as in arm_depthwise_conv_s8().
+   *    - q7 is used as data type eventhough it is s8 data. It is done so to be consistent with existing APIs.
+   *
+   */
+   arm_status arm_depthwise_conv_ch_mult_s8(const cmsis_nn_context *ctx,
+                                            const cmsis_nn_dw_conv_params *dw_conv_params,
+                                            const cmsis_nn_per_channel_quant_params *quant_params,
+                                            const cmsis_nn_dims *input_dims,
+                                            const q7_t *input_data,
+                                            const cmsis_nn_dims *filter_dims,
+                                            const q7_t *filter_data,
+                                            const cmsis_nn_dims *bias_dims,
+                                            const int32_t *bias_data,
+                                            const cmsis_nn_dims *output_dims,
+                                            q7_t *output_data);
+
+   /**
+   * @brief Get the required buffer size for optimized s8 depthwise convolution
+   * function for a channel multiplier greater than 1.
+   * @param[in]       input_dims     Input (activation) tensor dimensions. Format: [1, H, W, C_IN]
+   *                                 Batch argument N is not used.
+   * @param[in]       filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
+   * @param[in]       output_dims    Output tensor dimensions. Format: [1, H, W, C_OUT]
+   * @return          The function returns  required buffer size in bytes
+   *
+   */
+   int32_t arm_depthwise_conv_ch_mult_s8_get_buffer_size(const cmsis_nn_dims* input_dims,
+                                                         const cmsis_nn_dims* filter_dims,
+                                                         const cmsis_nn_dims* output_dims);
+
  /**
  * @defgroup FC Fully-connected Layer Functions
  *
@@ -1182,6 +1472,45 @@ extern    "C"
                            const cmsis_nn_dims *output_dims,
                            q7_t *output_data);
 
+  /**
+   * @brief Basic s8 Fully Connected function writing to a slice of the channels of a larger output tensor.
+   *
+   * @param[in, out] ctx            Function context. Same as for arm_fully_connected_s8()
+   * @param[in]      fc_params      Fully Connected layer parameters. Same as for arm_fully_connected_s8()
+   * @param[in]      quant_params   Per-tensor quantization info. Same as for arm_fully_connected_s8()
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+   * @param[in]      filter_data    Filter data pointer. Data type: int8
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions of this layer. Format: [N, C_OUT]
+   * @param[in, out] output_data    Pointer to the first channel of the slice in the larger output tensor.
+   *                                Data type: int8
+   * @param[in]      output_ch_stride  Number of channels of the larger output tensor, i.e. the distance in
+   *                                   elements between the outputs of two batches. Range: C_OUT or more
+   * @return     The function returns either
+   *             <code>ARM_MATH_ARGUMENT_ERROR</code> if output_ch_stride is less than C_OUT or
+   *             <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite
+   *    - arm_fully_connected_s8() is the same as this function with output_ch_stride equal to C_OUT.
+   */
+    arm_status
+    arm_fully_connected_s8_strided_output(const cmsis_nn_context *ctx,
+                                          const cmsis_nn_fc_params *fc_params,
+                                          const cmsis_nn_per_tensor_quant_params *quant_params,
+                                          const cmsis_nn_dims *input_dims,
+                                          const q7_t *input_data,
+                                          const cmsis_nn_dims *filter_dims,
+                                          const q7_t *filter_data,
+                                          const cmsis_nn_dims *bias_dims,
+                                          const int32_t *bias_data,
+                                          const cmsis_nn_dims *output_dims,
+                                          q7_t *output_data,
+                                          const int32_t output_ch_stride);
+
   /**
    * @brief Get the required buffer size for S8 basic fully-connected and
    * matrix multiplication layer function for TF Lite
@@ -1191,6 +1520,187 @@ extern    "C"
    */
     int32_t arm_fully_connected_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
 
+   /**
+   * @brief Basic s8 Fully Connected function with packed s4 weights.
+   *
+   * @param[in, out] ctx            Function context (e.g. temporary buffer). Check the function
+   *                                definition file to see if an additional buffer is required.
+   *                                Optional function {API}_get_buffer_size() provides the buffer
+   *                                size if an additional buffer is required.
+   * @param[in]      fc_params      Fully Connected layer parameters (e.g. strides, dilations, pads,...)
+   *                                Range of fc_params->input_offset  : [-127, 128]
+   *                                fc_params->filter_offset : 0
+   *                                Range of fc_params->output_offset : [-128, 127]
+   * @param[in]      quant_params   Per-tensor quantization info.
+   *                                It contains the multiplier and shift values to be applied to the output tensor.
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   *                                Input dimension is taken as Nx(H * W * C_IN)
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+   *                                N : accumulation depth and equals (H * W * C_IN) from input_dims
+   *                                C : output depth and equals C_OUT in output_dims
+   *                                H & W : Not used
+   * @param[in]      packed_filter_data Filter data pointer. Data type: int4 packed two per byte, the first value
+   *                                of each pair in the low nibble. The rows are not padded, i.e. the size is
+   *                                (N * C + 1) / 2 bytes
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   *                                N, H, W : Not used
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+   *                                N : Batches
+   *                                C_OUT : Output depth
+   *                                H & W : Not used.
+   * @param[in, out] output_data    Output data pointer. Data type: int8
+   * @return     The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the filter offset is not zero or,
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite
+   *    - The int4 weights are symmetrically quantized. They are unpacked in-register, so the flash reads
+   *      of the weights are halved compared to arm_fully_connected_s8()
+   *    - Scripts/NNFunctions/pack_int4_weights.py can be used to pack the weights offline
+   */
+    arm_status
+    arm_fully_connected_s4(const cmsis_nn_context *ctx,
+                           const cmsis_nn_fc_params *fc_params,
+                           const cmsis_nn_per_tensor_quant_params *quant_params,
+                           const cmsis_nn_dims *input_dims,
+                           const q7_t *input_data,
+                           const cmsis_nn_dims *filter_dims,
+                           const q7_t *packed_filter_data,
+                           const cmsis_nn_dims *bias_dims,
+                           const int32_t *bias_data,
+                           const cmsis_nn_dims *output_dims,
+                           q7_t *output_data);
+
+  /**
+   * @brief Get the required buffer size for arm_fully_connected_s4()
+   * @param[in]      filter_dims             dimension of filter
+   * @return         The function returns    required buffer size in bytes
+   *
+   */
+    int32_t arm_fully_connected_s4_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
+   /**
+   * @brief S8 Fully Connected function with block sparse weights.
+   *
+   * @param[in, out] ctx            Function context (e.g. temporary buffer). Check the function
+   *                                definition file to see if an additional buffer is required.
+   *                                Optional function {API}_get_buffer_size() provides the buffer
+   *                                size if an additional buffer is required.
+   * @param[in]      fc_params      Fully Connected layer parameters (e.g. strides, dilations, pads,...)
+   *                                Range of fc_params->input_offset  : [-127, 128]
+   *                                fc_params->filter_offset : 0
+   *                                Range of fc_params->output_offset : [-128, 127]
+   * @param[in]      quant_params   Per-tensor quantization info.
+   *                                It contains the multiplier and shift values to be applied to the output tensor.
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+   *                                Input dimension is taken as Nx(H * W * C_IN)
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Two dimensional filter dimensions. Format: [N, C]
+   *                                N : accumulation depth and equals (H * W * C_IN) from input_dims
+   *                                C : output depth and equals C_OUT in output_dims
+   *                                H & W : Not used
+   * @param[in]      filter_data    Filter data in block sparse format, see cmsis_nn_sparse_weights.
+   *                                Scripts/NNFunctions/convert_to_block_sparse.py converts dense weights.
+   * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+   *                                N, H, W : Not used
+   * @param[in]      bias_data      Bias data pointer. Data type: int32
+   * @param[in]      output_dims    Output tensor dimensions. Format: [N, C_OUT]
+   *                                N : Batches
+   *                                C_OUT : Output depth
+   *                                H & W : Not used.
+   * @param[in, out] output_data    Output data pointer. Data type: int8
+   * @return     The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the filter offset is not zero or,
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite
+   *    - The output is identical to the one of arm_fully_connected_s8() with the dense weights. The
+   *      execution time is proportional to the number of stored blocks, so it is faster for weights
+   *      with more than about half of the blocks being zero.
+   */
+    arm_status
+    arm_fully_connected_sparse_s8(const cmsis_nn_context *ctx,
+                                  const cmsis_nn_fc_params *fc_params,
+                                  const cmsis_nn_per_tensor_quant_params *quant_params,
+                                  const cmsis_nn_dims *input_dims,
+                                  const q7_t *input_data,
+                                  const cmsis_nn_dims *filter_dims,
+                                  const cmsis_nn_sparse_weights *filter_data,
+                                  const cmsis_nn_dims *bias_dims,
+                                  const int32_t *bias_data,
+                                  const cmsis_nn_dims *output_dims,
+                                  q7_t *output_data);
+
+  /**
+   * @brief Get the required buffer size for arm_fully_connected_sparse_s8()
+   * @param[in]      filter_dims             dimension of filter
+   * @return         The function returns    required buffer size in bytes
+   *
+   */
+    int32_t arm_fully_connected_sparse_s8_get_buffer_size(const cmsis_nn_dims *filter_dims);
+
+   /**
+   * @brief Basic s8 batch matrix multiplication function.
+   *
+   * @param[in, out] ctx            Function context that contains the additional buffer.
+   *                                The caller is expected to clear the buffer, if applicable, for security reasons.
+   *                                arm_batch_matmul_s8_get_buffer_size() provides the buffer size.
+   * @param[in]      bmm_params     Batch matmul parameters (transpose flags, offsets and activation)
+   *                                Range of bmm_params->fc_params.input_offset  : [-127, 128]
+   *                                Range of bmm_params->fc_params.filter_offset : [-127, 128]
+   *                                Range of bmm_params->fc_params.output_offset : [-128, 127]
+   * @param[in]      quant_params   Per-tensor quantization info.
+   *                                It contains the multiplier and shift values to be applied to the output tensor.
+   * @param[in]      input_lhs_dims LHS tensor dimensions. Format: [N, H, W, C]
+   *                                N, H : Batch dimensions. A batch dimension of 1 is broadcast
+   *                                W, C : Rows and columns of the stored matrix
+   * @param[in]      input_lhs      LHS data pointer. Data type: int8
+   * @param[in]      input_rhs_dims RHS tensor dimensions. Format: [N, H, W, C]
+   *                                N, H : Batch dimensions. A batch dimension of 1 is broadcast
+   *                                W, C : Rows and columns of the stored matrix
+   * @param[in]      input_rhs      RHS data pointer. Data type: int8
+   * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C]
+   *                                N, H : Batch dimensions
+   *                                W, C : Rows and columns of the result matrix
+   * @param[out]     output         Output data pointer. Data type: int8
+   * @return     The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the buffer is missing or,
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite (BATCH_MATMUL)
+   *    - The result is op(LHS) x op(RHS) for every batch, where op() transposes the matrix if
+   *      bmm_params->adj_x or bmm_params->adj_y respectively is set.
+   *    - The multiplication is done by arm_nn_mat_mult_nt_t_s8(). Operands that are not already in the
+   *      layout it expects are transposed into the buffer, i.e. the LHS if adj_x is set and the RHS if
+   *      adj_y is not set. adj_x = 0 and adj_y = 1 is therefore the fastest configuration.
+   */
+    arm_status arm_batch_matmul_s8(const cmsis_nn_context *ctx,
+                                   const cmsis_nn_bmm_params *bmm_params,
+                                   const cmsis_nn_per_tensor_quant_params *quant_params,
+                                   const cmsis_nn_dims *input_lhs_dims,
+                                   const q7_t *input_lhs,
+                                   const cmsis_nn_dims *input_rhs_dims,
+                                   const q7_t *input_rhs,
+                                   const cmsis_nn_dims *output_dims,
+                                   q7_t *output);
+
+  /**
+   * @brief Get the required buffer size for arm_batch_matmul_s8()
+   * @param[in]      bmm_params              Batch matmul parameters
+   * @param[in]      input_lhs_dims          LHS tensor dimensions
+   * @param[in]      input_rhs_dims          RHS tensor dimensions
+   * @return         The function returns    required buffer size in bytes
+   *
+   */
+    int32_t arm_batch_matmul_s8_get_buffer_size(const cmsis_nn_bmm_params *bmm_params,
+                                                const cmsis_nn_dims *input_lhs_dims,
+                                                const cmsis_nn_dims *input_rhs_dims);
+
   /**
    * @brief Q7 opt fully-connected layer function
    * @param[in]       pV          pointer to input vector
@@ -1362,8 +1872,11 @@ extern    "C"
    * @param[in]       num_col_a   number of columns of A
    * @param[in]       output_bias per output channel bias. Range : int32
    * @param[in,out]   out_0       pointer to output
+   * @param[in]       output_ch_stride  distance between the two outputs in elements. output_ch for a
+   *                                    contiguous output tensor.
    * @return     The function returns one of the two
-   *              1. The incremented output pointer for a successful operation or
+   *              1. The incremented output pointer, i.e. out_0 + 2 * output_ch_stride, for a successful
+   *                 operation or
    *              2. NULL if implementation is not available.
    *
    * @details   This function does the matrix multiplication of weight matrix for all output channels
@@ -1381,7 +1894,8 @@ extern    "C"
                                         const int16_t activation_max,
                                         const uint16_t num_col_a,
                                         const int32_t *const output_bias,
-                                        q7_t *out_0);
+                                        q7_t *out_0,
+                                        const int32_t output_ch_stride);
 
    /**
    * @brief Matrix-multiplication of re-ordered input B with A.
@@ -1449,7 +1963,7 @@ extern    "C"
 /**
  * @defgroup BasicMath Basic math functions
  *
- * Element wise add and multiplication functions.
+ * Element wise add and multiplication functions, layer normalization and reductions.
  *
  */
 
@@ -1518,12 +2032,97 @@ extern    "C"
                                     const int32_t out_activation_min,
                                     const int32_t out_activation_max,
                                     const uint32_t block_size);
+
+/**
+   * @brief s16 layer normalization
+   * @param[in]       input                   pointer to input tensor. Format: [num_rows, row_size]
+   * @param[in]       weights                 pointer to the layer norm weights. Length: row_size
+   * @param[in]       bias                    pointer to the layer norm bias. Length: row_size
+   * @param[in]       out_mult                output multiplier
+   * @param[in]       out_shift               output shift
+   * @param[in]       variance_limit          variance used for rows with a variance smaller than 1
+   * @param[in]       num_rows                number of rows that are normalized independently
+   * @param[in]       row_size                number of elements in each row
+   * @param[out]      output                  pointer to output tensor. Format: [num_rows, row_size]
+   * @return          The function returns    ARM_MATH_SUCCESS
+   *
+   * @details   Supported framework: TensorFlow Lite micro. The computation is the same as the layer
+   *            normalization of the integer LSTM, with the mean and variance computed in
+   *            Q10 and Q20 respectively. The row size is expected to be a power of two for the
+   *            variance to be exact.
+   */
+    arm_status arm_layer_norm_s16(const int16_t *input,
+                                  const int16_t *weights,
+                                  const int32_t *bias,
+                                  const int32_t out_mult,
+                                  const int32_t out_shift,
+                                  const int32_t variance_limit,
+                                  const int32_t num_rows,
+                                  const int32_t row_size,
+                                  int16_t *output);
+
+/**
+   * @brief s8 mean over the axes with an output dimension of one
+   * @param[in]       input_dims      input tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]       input_data      pointer to input tensor
+   * @param[in]       input_offset    offset for the input values, i.e. the negative input zero point.
+   *                                  Range: -127 to 128
+   * @param[in]       quant_params    requantization of the sum. Multiplier and shift of input_scale / output_scale
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Range: -128 to 127
+   * @param[in]       output_dims     output tensor dimensions. Each dimension is equal to the input dimension
+   *                                  or one, in which case the axis is reduced. Format: [N, H, W, C_OUT]
+   * @param[out]      output_data     pointer to output tensor
+   * @return          The function returns either
+   *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the output dimensions are not valid or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Supported framework: TensorFlow Lite micro. The mean over H and W, i.e. a global average pooling, is
+   *            bit exact to the int8 MEAN operator. The sum is requantized before it is divided by the number of
+   *            reduced values, rounding half away from zero. No scratch buffer is used.
+   */
+    arm_status arm_mean_s8(const cmsis_nn_dims *input_dims,
+                           const q7_t *input_data,
+                           const int32_t input_offset,
+                           const cmsis_nn_per_tensor_quant_params *quant_params,
+                           const int32_t output_offset,
+                           const cmsis_nn_dims *output_dims,
+                           q7_t *output_data);
+
+/**
+   * @brief s8 sum over the axes with an output dimension of one
+   * @param[in]       input_dims      input tensor dimensions. Format: [N, H, W, C_IN]
+   * @param[in]       input_data      pointer to input tensor
+   * @param[in]       input_offset    offset for the input values, i.e. the negative input zero point.
+   *                                  Range: -127 to 128
+   * @param[in]       quant_params    requantization of the sum. Multiplier and shift of input_scale / output_scale
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Range: -128 to 127
+   * @param[in]       output_dims     output tensor dimensions. Each dimension is equal to the input dimension
+   *                                  or one, in which case the axis is reduced. Format: [N, H, W, C_OUT]
+   * @param[out]      output_data     pointer to output tensor
+   * @return          The function returns either
+   *                  <code>ARM_MATH_SIZE_MISMATCH</code> if the output dimensions are not valid or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Supported framework: TensorFlow Lite micro. No scratch buffer is used.
+   */
+    arm_status arm_reduce_sum_s8(const cmsis_nn_dims *input_dims,
+                                 const q7_t *input_data,
+                                 const int32_t input_offset,
+                                 const cmsis_nn_per_tensor_quant_params *quant_params,
+                                 const int32_t output_offset,
+                                 const cmsis_nn_dims *output_dims,
+                                 q7_t *output_data);
 /**
  * @defgroup Acti Activation Functions
  *
  * Perform activation layers, including ReLU (Rectified Linear Unit),
  * sigmoid and tanh
  *
+ * The s8 and s16 activations of TensorFlow Lite, e.g. sigmoid, tanh, hard-swish and leaky ReLU,
+ * are done with look-up tables. A table is computed once, e.g. when the model is prepared, with
+ * arm_activation_lut_init_s8() or arm_activation_lut_init_s16() and applied with arm_activation_lut_s8(),
+ * arm_activation_lut_s16() or fused into a convolution with arm_convolve_s8_lut().
+ *
  */
 
   /**
@@ -1584,6 +2183,81 @@ extern    "C"
     void      arm_nn_activations_direct_q15(q15_t * data, uint16_t size, uint16_t int_width,
                                             arm_nn_activation_type type);
 
+  /**
+   * @brief Computes the look-up table of a s8 activation function
+   * @param[in]       type            activation function
+   * @param[in]       alpha           slope for negative inputs of ARM_LEAKY_RELU. Not used by the other functions
+   * @param[in]       input_scale     scale of the input
+   * @param[in]       input_offset    offset for the input values, i.e. the negative input zero point.
+   *                                  Range: -127 to 128
+   * @param[in]       output_scale    scale of the output
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Range: -128 to 127
+   * @param[out]      lut             table with ARM_NN_ACTIVATION_LUT_S8_SIZE entries
+   * @return          The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the type or a scale is not valid or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Each entry is the activation of the dequantized input, computed in float32 and rounded half away
+   *            from zero, as the LUTPopulate() tables of TensorFlow Lite. Sigmoid and tanh are the same as the
+   *            LUT based kernels of TensorFlow Lite. Hard-swish and leaky ReLU are correctly rounded and can
+   *            differ by one from the integer kernels of TensorFlow Lite micro. The table is indexed by the input
+   *            value as an unsigned byte.
+   */
+    arm_status arm_activation_lut_init_s8(const arm_nn_activation_type type,
+                                          const float32_t alpha,
+                                          const float32_t input_scale,
+                                          const int32_t input_offset,
+                                          const float32_t output_scale,
+                                          const int32_t output_offset,
+                                          q7_t *lut);
+
+  /**
+   * @brief Computes the interpolated look-up table of a s16 activation function
+   * @param[in]       type            activation function
+   * @param[in]       alpha           slope for negative inputs of ARM_LEAKY_RELU. Not used by the other functions
+   * @param[in]       input_scale     scale of the input. The input zero point is 0
+   * @param[in]       output_scale    scale of the output. The output zero point is 0
+   * @param[out]      lut             table with ARM_NN_ACTIVATION_LUT_S16_SIZE entries
+   * @return          The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the type or a scale is not valid or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Same table as LUTPopulate() of TensorFlow Lite for int16: 512 steps over the int16 input range,
+   *            each entry biased by half the interpolation error at the midpoint of its step.
+   */
+    arm_status arm_activation_lut_init_s16(const arm_nn_activation_type type,
+                                           const float32_t alpha,
+                                           const float32_t input_scale,
+                                           const float32_t output_scale,
+                                           q15_t *lut);
+
+  /**
+   * @brief s8 activation function using a look-up table
+   * @param[in]       input           pointer to the input vector
+   * @param[out]      output          pointer to the output vector. Can be the same as input
+   * @param[in]       lut             table with ARM_NN_ACTIVATION_LUT_S8_SIZE entries, e.g. from
+   *                                  arm_activation_lut_init_s8()
+   * @param[in]       block_size      number of values
+   * @return          The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details   The MVE implementation looks up 16 values with one gather load.
+   */
+    arm_status arm_activation_lut_s8(const q7_t *input, q7_t *output, const q7_t *lut, const int32_t block_size);
+
+  /**
+   * @brief s16 activation function using an interpolated look-up table
+   * @param[in]       input           pointer to the input vector
+   * @param[out]      output          pointer to the output vector. Can be the same as input
+   * @param[in]       lut             table with ARM_NN_ACTIVATION_LUT_S16_SIZE entries, e.g. from
+   *                                  arm_activation_lut_init_s16()
+   * @param[in]       block_size      number of values
+   * @return          The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details   The upper 9 bits of the input select the entry and the lower 7 bits interpolate linearly to the
+   *            next one, as LUTLookup() of TensorFlow Lite.
+   */
+    arm_status arm_activation_lut_s16(const q15_t *input, q15_t *output, const q15_t *lut, const int32_t block_size);
+
 /**
  * @defgroup Pooling Pooling Functions
  *
@@ -1673,11 +2347,53 @@ extern    "C"
                              const cmsis_nn_dims *output_dims,
                              q7_t *output_data);
 
+  /**
+   * @brief s8 average pooling function with fused requantization
+   *
+   * @param[in, out] ctx            Function context. Not used.
+   * @param[in]      pool_params    Pooling parameters. The activation range is applied after the requantization.
+   * @param[in]      quant_params   Per-tensor multiplier and shift from the input to the output scale
+   * @param[in]      input_offset   Offset for the input values, i.e. the negative input zero point.
+   *                                Range: -127 to 128
+   * @param[in]      output_offset  Offset for the output values, i.e. the output zero point.
+   *                                Range: -128 to 127
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
+   *                                Argument 'N' is not used.
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Filter tensor dimensions. Format: [H, W]
+   *                                Argument N and C are not used.
+   * @param[in]      output_dims    Output tensor dimensions. Format: [H, W, C_OUT]
+   *                                Argument N is not used.
+   *                                C_OUT equals C_IN.
+   * @param[in, out] output_data    Output data pointer. Data type: int8
+   * @return                        The function returns
+   *                                    <code>ARM_MATH_SUCCESS</code> - Successful operation
+   *                                    <code>ARM_MATH_ARGUMENT_ERROR</code> - quant_params is NULL
+   *
+   * @details
+   *    - Bit exact to arm_avgpool_s8() with the full int8 activation range followed by
+   *      arm_requantize_s8() and the activation.
+   *    - Used when the input and output of a TensorFlow Lite AVERAGE_POOL_2D differ in scale, or to fold
+   *      a following requantization into the pooling.
+   *
+   */
+   arm_status arm_avgpool_s8_requantize(const cmsis_nn_context *ctx,
+                                        const cmsis_nn_pool_params *pool_params,
+                                        const cmsis_nn_per_tensor_quant_params *quant_params,
+                                        const int32_t input_offset,
+                                        const int32_t output_offset,
+                                        const cmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const cmsis_nn_dims *filter_dims,
+                                        const cmsis_nn_dims *output_dims,
+                                        q7_t *output_data);
+
   /**
    * @brief Get the required buffer size for S8 average pooling function
    * @param[in]       dim_dst_width         output tensor dimension
    * @param[in]       ch_src                number of input tensor channels
-   * @return          The function returns  required buffer size in bytes
+   * @return          The function returns  required buffer size in bytes. The channel sums are
+   *                  kept in registers, so this is 0 for all targets. Kept for API compatibility.
    *
    */
     int32_t arm_avgpool_s8_get_buffer_size(const int dim_dst_width,
@@ -1714,6 +2430,46 @@ extern    "C"
                                const cmsis_nn_dims *filter_dims,
                                const cmsis_nn_dims *output_dims,
                                q7_t *output_data);
+
+  /**
+   * @brief s8 max pooling function with fused requantization
+   *
+   * @param[in, out] ctx            Function context. Not used.
+   * @param[in]      pool_params    Pooling parameters. The activation range is applied after the requantization.
+   * @param[in]      quant_params   Per-tensor multiplier and shift from the input to the output scale.
+   *                                The multiplier must be positive.
+   * @param[in]      input_offset   Offset for the input values, i.e. the negative input zero point.
+   *                                Range: -127 to 128
+   * @param[in]      output_offset  Offset for the output values, i.e. the output zero point.
+   *                                Range: -128 to 127
+   * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [H, W, C_IN]
+   *                                Argument 'N' is not used.
+   * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+   * @param[in]      filter_dims    Filter tensor dimensions. Format: [H, W]
+   *                                Argument N and C are not used.
+   * @param[in]      output_dims    Output tensor dimensions. Format: [H, W, C_OUT]
+   *                                Argument N is not used.
+   *                                C_OUT equals C_IN.
+   * @param[in, out] output_data    Output data pointer. Data type: int8
+   * @return                        The function returns
+   *                                    <code>ARM_MATH_SUCCESS</code> - Successful operation
+   *                                    <code>ARM_MATH_ARGUMENT_ERROR</code> - quant_params is NULL
+   *
+   * @details
+   *    - Bit exact to arm_max_pool_s8() with the full int8 activation range followed by
+   *      arm_requantize_s8() and the activation. Only the maximum of each window is requantized.
+   *
+   */
+    arm_status arm_max_pool_s8_requantize(const cmsis_nn_context *ctx,
+                                          const cmsis_nn_pool_params *pool_params,
+                                          const cmsis_nn_per_tensor_quant_params *quant_params,
+                                          const int32_t input_offset,
+                                          const int32_t output_offset,
+                                          const cmsis_nn_dims *input_dims,
+                                          const q7_t *input_data,
+                                          const cmsis_nn_dims *filter_dims,
+                                          const cmsis_nn_dims *output_dims,
+                                          q7_t *output_data);
 /**
  * @defgroup Softmax Softmax Functions
  *
@@ -1785,6 +2541,111 @@ void arm_softmax_s8(const int8_t *input,
                     const int32_t diff_min,
                     int8_t *output);
 
+  /**
+   * @brief S8 softmax function using a look-up table for the exponent
+   * @param[in]  ctx       Function context that contains the look-up table buffer.
+   *                       arm_softmax_s8_fast_get_buffer_size will return the buffer_size required.
+   * @param[in]  input     Pointer to the input tensor
+   * @param[in]  num_rows  Number of rows in the input tensor
+   * @param[in]  row_size  Number of elements in each input row
+   * @param[in]  mult      Input quantization multiplier
+   * @param[in]  shift     Input quantization shift within the range [0, 31]
+   * @param[in]  diff_min  Minimum difference with max in row. Used to check if
+   *                       the quantized exponential operation can be performed
+   * @param[out] output    Pointer to the output tensor
+   * @return               The function returns either
+   *                       <code>ARM_MATH_ARGUMENT_ERROR</code> if the buffer in ctx is missing or,
+   *                       <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details  The exponent of all 256 possible differences between an element and the row maximum
+   *           is computed once per call and reused for all the rows. This gives the best gain for
+   *           inputs with many rows, e.g. attention scores.
+   *
+   * @note Supported framework: TensorFlow Lite micro (bit-accurate)
+   *
+   */
+
+arm_status arm_softmax_s8_fast(const cmsis_nn_context *ctx,
+                               const int8_t *input,
+                               const int32_t num_rows,
+                               const int32_t row_size,
+                               const int32_t mult,
+                               const int32_t shift,
+                               const int32_t diff_min,
+                               int8_t *output);
+
+  /**
+   * @brief Get the required buffer size for arm_softmax_s8_fast
+   * @return   The function returns required buffer size in bytes
+   *
+   */
+int32_t arm_softmax_s8_fast_get_buffer_size(void);
+
+  /**
+   * @brief S8 log softmax function
+   * @param[in]  ctx           Function context that contains the look-up table buffer.
+   *                           arm_log_softmax_s8_get_buffer_size will return the buffer_size required.
+   * @param[in]  input         Pointer to the input tensor
+   * @param[in]  num_rows      Number of rows in the input tensor
+   * @param[in]  row_size      Number of elements in each input row
+   * @param[in]  mult          Input quantization multiplier
+   * @param[in]  shift         Input quantization shift
+   * @param[in]  reverse_mult  Reverse scaling multiplier, i.e. the inverse of the input scaling
+   * @param[in]  reverse_shift Reverse scaling shift. Negative value means right shift.
+   * @param[in]  diff_min      Minimum difference with max in row. Used to check if
+   *                           the quantized exponential operation can be performed
+   * @param[out] output        Pointer to the output tensor. Scale is 16/256 and zero point 127.
+   * @return                   The function returns either
+   *                           <code>ARM_MATH_ARGUMENT_ERROR</code> if the buffer in ctx is missing or,
+   *                           <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @note Supported framework: TensorFlow Lite micro (bit-accurate)
+   *
+   */
+
+arm_status arm_log_softmax_s8(const cmsis_nn_context *ctx,
+                              const int8_t *input,
+                              const int32_t num_rows,
+                              const int32_t row_size,
+                              const int32_t mult,
+                              const int32_t shift,
+                              const int32_t reverse_mult,
+                              const int32_t reverse_shift,
+                              const int32_t diff_min,
+                              int8_t *output);
+
+  /**
+   * @brief Get the required buffer size for arm_log_softmax_s8
+   * @return   The function returns required buffer size in bytes
+   *
+   */
+int32_t arm_log_softmax_s8_get_buffer_size(void);
+
+  /**
+   * @brief S16 softmax function
+   * @param[in]  input          Pointer to the input tensor
+   * @param[in]  num_rows       Number of rows in the input tensor
+   * @param[in]  row_size       Number of elements in each input row
+   * @param[in]  mult           Input quantization multiplier
+   * @param[in]  shift          Input quantization shift
+   * @param[in]  softmax_params Look-up tables for the exponent and the reciprocal
+   * @param[out] output         Pointer to the output tensor. Range [0, 32767] corresponds to [0.0, 1.0]
+   * @return                    The function returns either
+   *                            <code>ARM_MATH_ARGUMENT_ERROR</code> if a look-up table is missing or,
+   *                            <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @note Supported framework: TensorFlow Lite micro (bit-accurate)
+   *
+   */
+
+arm_status arm_softmax_s16(const int16_t *input,
+                           const int32_t num_rows,
+                           const int32_t row_size,
+                           const int32_t mult,
+                           const int32_t shift,
+                           const cmsis_nn_softmax_lut_s16 *softmax_params,
+                           int16_t *output);
+
   /**
    * @brief U8 softmax function
    * @param[in]  input     Pointer to the input tensor
@@ -1868,9 +2729,127 @@ void arm_softmax_u8(const uint8_t *input,
                                                 const int32_t out_shift,
                                                 const int32_t out_mult);
 
+/**
+ * @defgroup Quantization Quantization Functions
+ *
+ * Conversion between float32 and quantized tensors and between two quantizations of a s8 tensor.
+ * A quantized value q represents the real value scale * (q - zero_point). The offsets of these
+ * functions follow the convention of the layer functions, i.e. an input offset is the negative input
+ * zero point and an output offset is the output zero point.
+ *
+ */
+
+  /**
+   * @brief Quantization of a float32 vector to s8
+   * @param[in]       input           pointer to the float32 input vector
+   * @param[out]      output          pointer to the s8 output vector
+   * @param[in]       output_scale    scale of the output
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Range: -128 to 127
+   * @param[in]       block_size      number of values
+   * @return          The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if output_scale is not positive or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Supported framework: TensorFlow Lite micro. The result is round(input / output_scale) + output_offset,
+   *            rounding half away from zero and saturating to the s8 range. The input is multiplied by the
+   *            reciprocal of the scale, which can differ from the division of the reference kernel for
+   *            values close to a rounding midpoint.
+   */
+    arm_status arm_quantize_f32_s8(const float32_t *input,
+                                   q7_t *output,
+                                   const float32_t output_scale,
+                                   const int32_t output_offset,
+                                   const int32_t block_size);
+
+  /**
+   * @brief Quantization of a float32 vector to s16
+   * @param[in]       input           pointer to the float32 input vector
+   * @param[out]      output          pointer to the s16 output vector
+   * @param[in]       output_scale    scale of the output
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Usually 0
+   * @param[in]       block_size      number of values
+   * @return          The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if output_scale is not positive or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Same as arm_quantize_f32_s8(), saturating to the s16 range.
+   */
+    arm_status arm_quantize_f32_s16(const float32_t *input,
+                                    q15_t *output,
+                                    const float32_t output_scale,
+                                    const int32_t output_offset,
+                                    const int32_t block_size);
+
+  /**
+   * @brief Dequantization of a s8 vector to float32
+   * @param[in]       input           pointer to the s8 input vector
+   * @param[in]       input_offset    offset for the input values, i.e. the negative input zero point.
+   *                                  Range: -127 to 128
+   * @param[in]       input_scale     scale of the input
+   * @param[out]      output          pointer to the float32 output vector
+   * @param[in]       block_size      number of values
+   * @return          The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details   Supported framework: TensorFlow Lite micro. The result is (input + input_offset) * input_scale and is
+   *            bit exact to the reference kernel.
+   */
+    arm_status arm_dequantize_s8_f32(const q7_t *input,
+                                     const int32_t input_offset,
+                                     const float32_t input_scale,
+                                     float32_t *output,
+                                     const int32_t block_size);
+
+  /**
+   * @brief Requantization of a s8 vector with per-tensor parameters
+   * @param[in]       input           pointer to the s8 input vector
+   * @param[in]       input_offset    offset for the input values, i.e. the negative input zero point.
+   *                                  Range: -127 to 128
+   * @param[out]      output          pointer to the s8 output vector
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Range: -128 to 127
+   * @param[in]       quant_params    multiplier and shift of input_scale / output_scale
+   * @param[in]       block_size      number of values
+   * @return          The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details   Supported framework: TensorFlow Lite micro, the REQUANTIZE operator from int8 to int8.
+   */
+    arm_status arm_requantize_s8(const q7_t *input,
+                                 const int32_t input_offset,
+                                 q7_t *output,
+                                 const int32_t output_offset,
+                                 const cmsis_nn_per_tensor_quant_params *quant_params,
+                                 const int32_t block_size);
+
+  /**
+   * @brief Requantization of a s8 tensor with per-channel parameters
+   * @param[in]       input           pointer to the s8 input tensor. The channels are the innermost dimension
+   * @param[in]       input_offset    offset for the input values, i.e. the negative input zero point.
+   *                                  Range: -127 to 128
+   * @param[out]      output          pointer to the s8 output tensor
+   * @param[in]       output_offset   offset for the output values, i.e. the output zero point. Range: -128 to 127
+   * @param[in]       quant_params    multiplier and shift of input_scale / output_scale for each channel.
+   *                                  The arrays have num_channels elements
+   * @param[in]       num_channels    number of channels
+   * @param[in]       block_size      number of values. A multiple of num_channels
+   * @return          The function returns either
+   *                  <code>ARM_MATH_SIZE_MISMATCH</code> if block_size is not a multiple of num_channels or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details   Converts e.g. an output with per-channel scales to the per-tensor quantization of the next layer.
+   */
+    arm_status arm_requantize_per_channel_s8(const q7_t *input,
+                                             const int32_t input_offset,
+                                             q7_t *output,
+                                             const int32_t output_offset,
+                                             const cmsis_nn_per_channel_quant_params *quant_params,
+                                             const int32_t num_channels,
+                                             const int32_t block_size);
+
 /**
  * @defgroup Reshape Reshape Functions
  *
+ * Reshape, padding and slicing of s8 tensors. These only move data. The copies are done in blocks of
+ * consecutive channels, or of whole rows when the channels are not padded or sliced.
+ *
  */
 
    /**
@@ -1886,9 +2865,96 @@ void arm_softmax_u8(const uint8_t *input,
                         int8_t *output,
                         const uint32_t total_size);
 
+  /**
+   * @brief s8 constant padding function
+   * @param[in]      input_dims   Input tensor dimensions. Format: [N, H, W, C]
+   * @param[in]      input        Input data pointer
+   * @param[in]      pad_before   Number of elements added before the input in each dimension
+   * @param[in]      pad_after    Number of elements added after the input in each dimension
+   * @param[in]      pad_value    Value of the added elements, normally the zero point of the tensor
+   * @param[out]     output       Output data pointer. The output has input_dims + pad_before + pad_after elements
+   *                              in each dimension
+   *
+   * @return     The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if a padding is negative or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite micro, PAD and PADV2
+   *    - The padding can be done in-place: the output may be the same buffer as the input, if the buffer holds
+   *      the output size. The output is written from the end.
+   *    - A padding in H and W only, followed by a convolution, does not have to be materialized, see
+   *      arm_pad_s8_fold_conv().
+   *
+   */
+    arm_status arm_pad_s8(const cmsis_nn_dims *input_dims,
+                          const q7_t *input,
+                          const cmsis_nn_dims *pad_before,
+                          const cmsis_nn_dims *pad_after,
+                          const q7_t pad_value,
+                          q7_t *output);
+
+  /**
+   * @brief Expresses a padding as a view consumed by a convolution, instead of a padded tensor
+   * @param[in]      pad_before   Number of elements added before the input in each dimension
+   * @param[in]      pad_after    Number of elements added after the input in each dimension
+   * @param[in]      pad_value    Value of the added elements
+   * @param[in,out]  conv_params  Convolution parameters of the layer that consumes the padded tensor. The padding
+   *                              before the input is added to conv_params->padding.
+   *
+   * @return     The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if the padding cannot be folded, i.e. it is not only
+   *                  in H and W or pad_value is not the input zero point of the convolution, or
+   *                  <code>ARM_MATH_SUCCESS</code> if conv_params was updated.
+   *
+   * @details
+   *    - arm_convolve_s8() and arm_convolve_wrapper_s8() then read the unpadded input and treat the positions
+   *      outside of it as the zero point, the same as the padded tensor. The input dimensions are the ones of
+   *      the unpadded tensor and the output dimensions are unchanged, which takes care of pad_after.
+   *    - If the function returns an error the padded tensor has to be made with arm_pad_s8().
+   *
+   */
+    arm_status arm_pad_s8_fold_conv(const cmsis_nn_dims *pad_before,
+                                    const cmsis_nn_dims *pad_after,
+                                    const q7_t pad_value,
+                                    cmsis_nn_conv_params *conv_params);
+
+  /**
+   * @brief s8 strided slice function
+   * @param[in]      input_dims   Input tensor dimensions. Format: [N, H, W, C]
+   * @param[in]      input        Input data pointer
+   * @param[in]      begin        Index of the first element of the slice in each dimension
+   * @param[in]      stride       Stride of the slice in each dimension. May be negative.
+   * @param[in]      output_dims  Output tensor dimensions, i.e. the number of elements of the slice in each
+   *                              dimension. Format: [N, H, W, C]
+   * @param[out]     output       Output data pointer
+   *
+   * @return     The function returns either
+   *                  <code>ARM_MATH_ARGUMENT_ERROR</code> if a stride is zero or the slice is not within the
+   *                  input or
+   *                  <code>ARM_MATH_SUCCESS</code> on successful completion.
+   *
+   * @details
+   *    - Supported framework: TensorFlow Lite micro, STRIDED_SLICE and SLICE. The begin, end and stride
+   *      tensors and masks of TensorFlow Lite are resolved to begin, stride and output_dims when the model is
+   *      prepared.
+   *    - With positive strides the slice can be done in-place, the output may be the same buffer as the input.
+   *
+   */
+    arm_status arm_strided_slice_s8(const cmsis_nn_dims *input_dims,
+                                    const q7_t *input,
+                                    const cmsis_nn_dims *begin,
+                                    const cmsis_nn_dims *stride,
+                                    const cmsis_nn_dims *output_dims,
+                                    q7_t *output);
+
 /**
  * @defgroup Concatenation Concatenation Functions
  *
+ * A concatenation along the channels, the X axis of these functions for NHWC tensors, does not need a
+ * copy if the producing layers are arm_convolve_s8(), arm_depthwise_conv_s8() or arm_fully_connected_s8().
+ * Their _strided_output variants write the output directly to the slice of the concatenated tensor.
+ *
  */
 
   /**
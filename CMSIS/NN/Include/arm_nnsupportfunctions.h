@@ -32,12 +32,31 @@
 
 #include "arm_math.h"
 #include "arm_common_tables.h"
+#include "arm_nn_types.h"
+#include "arm_nn_profile.h"
 
 #ifdef __cplusplus
 extern    "C"
 {
 #endif
 
+#if defined(_MSC_VER) || defined(__GNUC_PYTHON__)
+/* Host builds use arm_math.h without CMSIS-Core, which defines these for the Arm compilers */
+#ifndef __RESTRICT
+#define __RESTRICT __restrict
+#endif
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+    op2 %= 32U;
+    if (op2 == 0U)
+    {
+        return op1;
+    }
+    return (op1 >> op2) | (op1 << (32U - op2));
+}
+#endif
+
 #define LEFT_SHIFT(_shift)  (_shift > 0 ? _shift : 0)
 #define RIGHT_SHIFT(_shift) (_shift > 0 ? 0 : -_shift)
 #define MASK_IF_ZERO(x)     (x) == 0 ? ~0 : 0
@@ -48,6 +67,9 @@ extern    "C"
 #define MIN(A,B) ((A) < (B) ? (A) : (B))
 #define CLAMP(x, h, l) MAX(MIN((x), (h)), (l))
 
+// Number of possible differences between a s8 value and the maximum of its row
+#define ARM_NN_SOFTMAX_S8_LUT_SIZE (256)
+
 /**
  * @brief Union for SIMD access of q31/q15/q7 types
  */
@@ -71,6 +93,10 @@ typedef enum
                 /**< Sigmoid activation function */
     ARM_TANH = 1,
              /**< Tanh activation function */
+    ARM_HARD_SWISH = 2,
+             /**< Hard-swish activation function, x * relu6(x + 3) / 6. Look-up table functions only */
+    ARM_LEAKY_RELU = 3,
+             /**< Leaky ReLU activation function, alpha * x for negative x. Look-up table functions only */
 } arm_nn_activation_type;
 
 /**
@@ -214,6 +240,8 @@ q7_t *arm_nn_depthwise_conv_s8_core(const q7_t *row,
  * @param[in]       row_len       number of elements in each row
  * @param[in]       bias          per output channel bias. Range : int32
  * @param[in,out]   out           pointer to output
+ * @param[in]       output_ch_stride  distance between the outputs of two column batches in elements.
+ *                                    output_ch for a contiguous output tensor.
  * @return     The function returns one of the two
  *              1. The incremented output pointer for a successful operation or
  *              2. NULL if implementation is not available.
@@ -233,7 +261,8 @@ q7_t *arm_nn_mat_mult_s8(const q7_t *input_row,
                          const int16_t out_activation_max,
                          const uint16_t row_len,
                          const int32_t *const bias,
-                         q7_t *out);
+                         q7_t *out,
+                         const int32_t output_ch_stride);
 
 /**
  * @brief General Matrix-multiplication without requantization for one row & one column
@@ -328,6 +357,81 @@ arm_status arm_nn_mat_mult_nt_t_s8(const q7_t *lhs,
                                    const int32_t activation_min,
                                    const int32_t activation_max);
 
+/**
+* @brief General Matrix-multiplication function with per-channel requantization and packed s4 weights.
+*        This function assumes:
+*        - LHS input matrix NOT transposed (nt)
+*        - RHS input matrix transposed (t)
+*        - RHS values are packed two per byte, first value in the low nibble
+*
+*  @note This operation also performs the broadcast bias addition before the requantization
+*
+* @param[in]  lhs                Pointer to the LHS input matrix
+* @param[in]  packed_rhs         Pointer to the packed RHS input matrix
+* @param[in]  bias               Pointer to the bias vector. The length of this vector is equal to the number of output columns (or RHS input rows)
+* @param[out] dst                Pointer to the output matrix with "m" rows and "n" columns
+* @param[in]  dst_multipliers    Pointer to the multipliers vector needed for the per-channel requantization. The length of this vector is equal to
+*                                the number of output columns (or RHS input rows)
+* @param[in]  dst_shifts         Pointer to the shifts vector needed for the per-channel requantization. The length of this vector is equal to
+*                                the number of output columns (or RHS input rows)
+* @param[in]  lhs_rows           Number of LHS input rows
+* @param[in]  rhs_rows           Number of RHS input rows
+* @param[in]  rhs_cols           Number of LHS/RHS input columns. Must be even so that every RHS row starts on a byte boundary
+* @param[in]  lhs_offset         Offset to be applied to the LHS input value
+* @param[in]  dst_offset         Offset to be applied the output result
+* @param[in]  activation_min     Minimum value to clamp down the output. Range : int8
+* @param[in]  activation_max     Maximum value to clamp up the output. Range : int8
+*
+* @return     The function returns <code>ARM_MATH_SUCCESS</code>
+*
+*/
+arm_status arm_nn_mat_mult_nt_t_s4(const q7_t *lhs,
+                                   const q7_t *packed_rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t *dst_multipliers,
+                                   const int32_t *dst_shifts,
+                                   const int32_t lhs_rows,
+                                   const int32_t rhs_rows,
+                                   const int32_t rhs_cols,
+                                   const int32_t lhs_offset,
+                                   const int32_t dst_offset,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max);
+
+/**
+ * @brief s8 Vector by packed s4 Matrix (transposed) multiplication
+ *
+ * @param[in]      lhs             Input left-hand side vector
+ * @param[in]      packed_rhs      Input right-hand side matrix (transposed). The values are packed two per byte,
+ *                                 first value in the low nibble, without padding between the rows
+ * @param[in]      bias            Input bias
+ * @param[out]     dst             Output vector
+ * @param[in]      lhs_offset      Offset to be added to the input values of the left-hand side vector. Range: -127 to 128
+ * @param[in]      dst_offset      Offset to be added to the output values. Range: -127 to 128
+ * @param[in]      dst_multiplier  Output multiplier
+ * @param[in]      dst_shift       Output shift
+ * @param[in]      rhs_cols        Number of columns in the right-hand side input matrix
+ * @param[in]      rhs_rows        Number of rows in the right-hand side input matrix
+ * @param[in]      activation_min  Minimum value to clamp the output to. Range: int8
+ * @param[in]      activation_max  Maximum value to clamp the output to. Range: int8
+ *
+ * @return         The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ */
+arm_status arm_nn_vec_mat_mult_t_s4(const q7_t *lhs,
+                                    const q7_t *packed_rhs,
+                                    const q31_t *bias,
+                                    q7_t *dst,
+                                    const int32_t lhs_offset,
+                                    const int32_t dst_offset,
+                                    const int32_t dst_multiplier,
+                                    const int32_t dst_shift,
+                                    const int32_t rhs_cols,
+                                    const int32_t rhs_rows,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max);
+
 /**
  * @brief s8 Vector by Matrix (transposed) multiplication
  *
@@ -362,6 +466,92 @@ arm_status arm_nn_vec_mat_mult_t_s8(const q7_t *lhs,
                                     const int32_t activation_min,
                                     const int32_t activation_max);
 
+/**
+ * @brief s8 Vector by block sparse Matrix (transposed) multiplication
+ *
+ * @param[in]      lhs             Input left-hand side vector
+ * @param[in]      rhs             Input right-hand side matrix (transposed) in block sparse format
+ * @param[in]      bias            Input bias
+ * @param[out]     dst             Output vector
+ * @param[in]      lhs_offset      Offset to be added to the input values of the left-hand side vector. Range: -127 to 128
+ * @param[in]      dst_offset      Offset to be added to the output values. Range: -127 to 128
+ * @param[in]      dst_multiplier  Output multiplier
+ * @param[in]      dst_shift       Output shift
+ * @param[in]      rhs_cols        Number of columns in the right-hand side input matrix
+ * @param[in]      rhs_rows        Number of rows in the right-hand side input matrix
+ * @param[in]      activation_min  Minimum value to clamp the output to. Range: int8
+ * @param[in]      activation_max  Maximum value to clamp the output to. Range: int8
+ *
+ * @return         The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details        Only the stored blocks are multiplied. If rhs_cols is not a multiple of ARM_NN_SPARSE_BLOCK_SIZE,
+ *                 the last block of a row is zero padded and no values of lhs beyond rhs_cols are read.
+ *
+ */
+arm_status arm_nn_vec_mat_mult_t_sparse_s8(const q7_t *lhs,
+                                           const cmsis_nn_sparse_weights *rhs,
+                                           const q31_t *bias,
+                                           q7_t *dst,
+                                           const int32_t lhs_offset,
+                                           const int32_t dst_offset,
+                                           const int32_t dst_multiplier,
+                                           const int32_t dst_shift,
+                                           const int32_t rhs_cols,
+                                           const int32_t rhs_rows,
+                                           const int32_t activation_min,
+                                           const int32_t activation_max);
+
+/**
+ * @brief s8 sum or mean over the axes of the input tensor that have a dimension of one in the output tensor
+ *
+ * @param[in]      input_dims      Input tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input           Input data pointer
+ * @param[in]      input_offset    Offset to be added to the input values. Range: -127 to 128
+ * @param[in]      out_mult        Output multiplier
+ * @param[in]      out_shift       Output shift
+ * @param[in]      output_offset   Offset to be added to the output values. Range: -128 to 127
+ * @param[in]      mean            Divide the requantized sum by the number of reduced values if non-zero
+ * @param[in]      output_dims     Output tensor dimensions. Every dimension is equal to the input dimension
+ *                                 or one.
+ * @param[out]     output          Output data pointer
+ *
+ * @details        The sum is accumulated in int32 without a scratch buffer. If the channels are kept, the reduced
+ *                 positions are accumulated for four channels at a time.
+ *
+ */
+void arm_nn_reduce_s8(const cmsis_nn_dims *input_dims,
+                      const q7_t *input,
+                      const int32_t input_offset,
+                      const int32_t out_mult,
+                      const int32_t out_shift,
+                      const int32_t output_offset,
+                      const int32_t mean,
+                      const cmsis_nn_dims *output_dims,
+                      q7_t *output);
+
+/**
+ * @brief Activation function in float32, as used to compute the activation look-up tables
+ *
+ * @param[in]      type            Activation function
+ * @param[in]      alpha           Slope for negative values of ARM_LEAKY_RELU. Not used by the other functions
+ * @param[in]      val             Input value
+ *
+ * @return         The activation of val
+ *
+ */
+float32_t arm_nn_activation_f32(const arm_nn_activation_type type, const float32_t alpha, const float32_t val);
+
+/**
+ * @brief Look-up of s8 values in a 256 entry table
+ *
+ * @param[in]      input           Input data pointer
+ * @param[out]     output          Output data pointer. Can be the same as input
+ * @param[in]      lut             Table indexed by the input value as an unsigned byte, i.e. lut[(uint8_t)input]
+ * @param[in]      size            Number of values
+ *
+ */
+void arm_nn_lut_s8(const q7_t *input, q7_t *output, const q7_t *lut, const int32_t size);
+
 /**
  * @brief Depthwise convolution of transposed rhs matrix with 4 lhs matrices. To be used in padded cases where
  *        the padding is -lhs_offset(Range: int8). Dimensions are the same for lhs and rhs.
@@ -526,6 +716,108 @@ __STATIC_FORCEINLINE void arm_memset_q7(q7_t *dst,
 #endif
 }
 
+/**
+ * @brief           Find the maximum value of a s8 vector
+ * @param[in]       src         Pointer to the input vector
+ * @param[in]       block_size  Number of elements in the vector. Must be greater than 0.
+ * @return          The maximum value
+ *
+ */
+__STATIC_FORCEINLINE int8_t arm_nn_max_s8(const int8_t *src, int32_t block_size)
+{
+#if defined(ARM_MATH_MVEI)
+    int8_t max = (int8_t)Q7_MIN;
+    while (block_size > 0)
+    {
+        const mve_pred16_t p = vctp8q((uint32_t)block_size);
+        const int8x16_t in = vldrbq_z_s8(src, p);
+        max = vmaxvq_p_s8(max, in, p);
+        src += 16;
+        block_size -= 16;
+    }
+    return max;
+#else
+    int8_t max = *src;
+#if defined(ARM_MATH_DSP)
+    if (block_size >= 4)
+    {
+        union arm_nnword max_x4;
+        int32_t cnt = (block_size >> 2) - 1;
+
+        max_x4.word = arm_nn_read_q7x4_ia(&src);
+        while (cnt > 0)
+        {
+            const q31_t in = arm_nn_read_q7x4_ia(&src);
+            // Sets the GE flags for the lanes where 'in' is greater or equal than 'max_x4'
+            (void)__SSUB8(in, max_x4.word);
+            max_x4.word = __SEL(in, max_x4.word);
+            cnt--;
+        }
+        max = MAX(MAX(max_x4.bytes[0], max_x4.bytes[1]), MAX(max_x4.bytes[2], max_x4.bytes[3]));
+        block_size &= 0x3;
+    }
+#endif
+    while (block_size > 0)
+    {
+        max = MAX(max, *src);
+        src++;
+        block_size--;
+    }
+    return max;
+#endif
+}
+
+/**
+ * @brief           Find the maximum value of a s16 vector
+ * @param[in]       src         Pointer to the input vector
+ * @param[in]       block_size  Number of elements in the vector. Must be greater than 0.
+ * @return          The maximum value
+ *
+ */
+__STATIC_FORCEINLINE int16_t arm_nn_max_s16(const int16_t *src, int32_t block_size)
+{
+#if defined(ARM_MATH_MVEI)
+    int16_t max = (int16_t)Q15_MIN;
+    while (block_size > 0)
+    {
+        const mve_pred16_t p = vctp16q((uint32_t)block_size);
+        const int16x8_t in = vldrhq_z_s16(src, p);
+        max = vmaxvq_p_s16(max, in, p);
+        src += 8;
+        block_size -= 8;
+    }
+    return max;
+#else
+    int16_t max = *src;
+#if defined(ARM_MATH_DSP)
+    if (block_size >= 2)
+    {
+        union arm_nnword max_x2;
+        int32_t cnt = (block_size >> 1) - 1;
+
+        max_x2.word = arm_nn_read_q15x2_ia(&src);
+        while (cnt > 0)
+        {
+            const q31_t in = arm_nn_read_q15x2_ia(&src);
+            // Sets the GE flags for the lanes where 'in' is greater or equal than 'max_x2'
+            (void)__SSUB16(in, max_x2.word);
+            max_x2.word = __SEL(in, max_x2.word);
+            cnt--;
+        }
+        max = MAX(max_x2.half_words[0], max_x2.half_words[1]);
+        block_size &= 0x1;
+    }
+#endif
+    while (block_size > 0)
+    {
+        max = MAX(max, *src);
+        src++;
+        block_size--;
+    }
+    return max;
+#endif
+}
+
 #if defined (ARM_MATH_DSP)
 
 /**
@@ -567,6 +859,38 @@ __STATIC_FORCEINLINE const q7_t *read_and_pad_reordered(const q7_t *source, q31_
         return source;
 }
 
+/**
+ * @brief read and expand eight packed s4 values into four q15x2 words
+ *
+ * The s4 values are packed two per byte with the first value in the low nibble. They are
+ * returned scaled by 16 and ordered such that out_02 holds values 0 and 2, out_13 values 1 and 3
+ * and so on, i.e. the same order as __SXTB16() of two consecutive s8 words and of their rotation
+ * by 8. The scaling avoids per halfword shifts and must be removed from the accumulated result.
+ */
+
+__STATIC_FORCEINLINE const q7_t *read_and_unpack_s4x8(const q7_t *source,
+                                                      q31_t *out_02,
+                                                      q31_t *out_13,
+                                                      q31_t *out_46,
+                                                      q31_t *out_57)
+{
+    const uint32_t packed = (uint32_t)arm_nn_read_q7x4_ia(&source);
+    const uint32_t even = (packed << 4) & 0xF0F0F0F0;
+    const uint32_t odd = packed & 0xF0F0F0F0;
+
+    const q31_t even_04 = __SXTB16(even);
+    const q31_t even_26 = __SXTB16_RORn(even, 8);
+    const q31_t odd_15 = __SXTB16(odd);
+    const q31_t odd_37 = __SXTB16_RORn(odd, 8);
+
+    *out_02 = (int32_t)(__PKHBT(even_04, even_26, 16));
+    *out_46 = (int32_t)(__PKHTB(even_26, even_04, 16));
+    *out_13 = (int32_t)(__PKHBT(odd_15, odd_37, 16));
+    *out_57 = (int32_t)(__PKHTB(odd_37, odd_15, 16));
+
+    return source;
+}
+
 /**
  * @brief read and expand one q7 word into two q15 words with reordering and add an offset
  */
@@ -742,6 +1066,25 @@ __STATIC_FORCEINLINE q31_t arm_nn_requantize(const q31_t val, const q31_t multip
                                        RIGHT_SHIFT(shift));
 }
 
+/**
+ * @brief           Interpolating look-up of a 513 entry table covering the full int16 range
+ * @param[in]       lut         Table. Entry i is the value at input (i - 256) * 128
+ * @param[in]       val         Input value. Range: int16
+ *
+ * @return          Table value at val, linearly interpolated between the two closest entries
+ *
+ */
+__STATIC_FORCEINLINE int16_t arm_nn_lut_lookup_s16(const int16_t *lut, const int32_t val)
+{
+    const int32_t index = 256 + (val >> 7);
+    const int32_t offset = val & 0x7f;
+    const int32_t base = lut[index];
+    const int32_t slope = lut[index + 1] - base;
+    const int32_t delta = (slope * offset + 64) >> 7;
+
+    return (int16_t)(base + delta);
+}
+
 /**
  * @brief           memcpy optimized for MVE
  * @param[in, out]  dst         Destination pointer
@@ -838,6 +1181,26 @@ __STATIC_FORCEINLINE int32x4_t arm_requantize_mve_32x4(const int32x4_t val, cons
 
   return arm_divide_by_power_of_two_mve_32x4(arm_sat_doubling_high_mult_mve_32x4(vshlq_s32(val, left_shift), multiplier), right_shift);
 }
+
+/**
+ * @brief           Vector version of arm_nn_lut_lookup_s16()
+ * @param[in]       lut         Table with 513 entries
+ * @param[in]       val         Input values. Range: int16
+ * @param[in]       p           Predicate of the active lanes
+ *
+ * @return          Table values at val, linearly interpolated between the two closest entries
+ *
+ */
+__STATIC_FORCEINLINE int32x4_t arm_nn_lut_lookup_mve_s16(const int16_t *lut, const int32x4_t val, const mve_pred16_t p)
+{
+    const uint32x4_t index = vreinterpretq_u32_s32(vaddq_n_s32(vshrq_n_s32(val, 7), 256));
+    const int32x4_t offset = vandq_s32(val, vdupq_n_s32(0x7f));
+    const int32x4_t base = vldrhq_gather_shifted_offset_z_s32(lut, index, p);
+    const int32x4_t next = vldrhq_gather_shifted_offset_z_s32(lut, vaddq_n_u32(index, 1), p);
+    const int32x4_t delta = vshrq_n_s32(vaddq_n_s32(vmulq_s32(vsubq_s32(next, base), offset), 64), 7);
+
+    return vaddq_s32(base, delta);
+}
 #endif
 
 // @note The following functions are used only for softmax layer, scaled bits = 5 assumed
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Converts dense int8 fully connected weights, [C_OUT, ACCUMULATION_DEPTH], to the block sparse format of
+# cmsis_nn_sparse_weights used by arm_fully_connected_sparse_s8(). Only blocks of BLOCK_SIZE consecutive
+# columns with at least one non-zero value are stored. Optionally the weights can first be pruned by zeroing
+# the blocks with the smallest L1 norm.
+#
+import argparse
+import numpy as np
+
+# Must match ARM_NN_SPARSE_BLOCK_SIZE of arm_nn_types.h
+BLOCK_SIZE = 4
+UINT16_MAX = 65535
+
+
+def prune_blocks(weights, sparsity):
+    """ Zeroes the fraction 'sparsity' of the blocks with the smallest L1 norm. """
+    rows, cols = weights.shape
+    num_blocks = (cols + BLOCK_SIZE - 1) // BLOCK_SIZE
+    padded = np.zeros((rows, num_blocks * BLOCK_SIZE), dtype=weights.dtype)
+    padded[:, :cols] = weights
+    blocks = padded.reshape(rows, num_blocks, BLOCK_SIZE)
+    norms = np.sum(np.abs(blocks.astype(np.int32)), axis=2).ravel()
+    num_pruned = int(round(sparsity * norms.size))
+    if num_pruned > 0:
+        pruned = np.argsort(norms, kind='stable')[:num_pruned]
+        blocks.reshape(-1, BLOCK_SIZE)[pruned] = 0
+    return padded[:, :cols]
+
+
+def convert_to_block_sparse(weights):
+    """ Returns the values, block_cols and row_offsets arrays of the block sparse format. """
+    weights = np.asarray(weights).astype(np.int8)
+    rows, cols = weights.shape
+    num_blocks = (cols + BLOCK_SIZE - 1) // BLOCK_SIZE
+    if num_blocks - 1 > UINT16_MAX:
+        raise ValueError("accumulation depth is too large for uint16_t block column indices")
+
+    values = []
+    block_cols = []
+    row_offsets = [0]
+    for row in weights:
+        padded = np.zeros(num_blocks * BLOCK_SIZE, dtype=np.int8)
+        padded[:cols] = row
+        for block in range(num_blocks):
+            block_values = padded[block * BLOCK_SIZE:(block + 1) * BLOCK_SIZE]
+            if np.any(block_values):
+                values.extend(block_values.tolist())
+                block_cols.append(block)
+        row_offsets.append(len(block_cols))
+    return (np.array(values, dtype=np.int8), np.array(block_cols, dtype=np.uint16),
+            np.array(row_offsets, dtype=np.int32))
+
+
+def convert_from_block_sparse(values, block_cols, row_offsets, cols):
+    """ Inverse of convert_to_block_sparse(). """
+    rows = len(row_offsets) - 1
+    num_blocks = (cols + BLOCK_SIZE - 1) // BLOCK_SIZE
+    dense = np.zeros((rows, num_blocks * BLOCK_SIZE), dtype=np.int8)
+    for row in range(rows):
+        for block in range(row_offsets[row], row_offsets[row + 1]):
+            col = int(block_cols[block]) * BLOCK_SIZE
+            dense[row, col:col + BLOCK_SIZE] = values[block * BLOCK_SIZE:(block + 1) * BLOCK_SIZE]
+    return dense[:, :cols]
+
+
+def write_c_array(f, datatype, name, array):
+    f.write("const {} {}[{}] = \n{{\n".format(datatype, name, max(array.size, 1)))
+    if array.size == 0:
+        f.write("    0\n")
+    for i in range(0, array.size, 16):
+        f.write("    " + ", ".join(str(v) for v in array[i:i + 16]) + ",\n")
+    f.write("};\n\n")
+
+
+def write_c_header(values, block_cols, row_offsets, name, outfile):
+    with open(outfile, "w") as f:
+        f.write("// Generated by convert_to_block_sparse.py\n")
+        f.write("#pragma once\n")
+        f.write('#include "arm_nnfunctions.h"\n\n')
+        write_c_array(f, "int8_t", name + "_values", values)
+        write_c_array(f, "uint16_t", name + "_block_cols", block_cols)
+        write_c_array(f, "int32_t", name + "_row_offsets", row_offsets)
+        f.write("const cmsis_nn_sparse_weights {0} = {{{0}_values, {0}_block_cols, {0}_row_offsets}};\n".format(name))
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Convert dense int8 weights to the CMSIS-NN block sparse format.")
+    parser.add_argument('input', help="Weights stored with numpy.save(), format [C_OUT, ACCUMULATION_DEPTH].")
+    parser.add_argument('--output', default='sparse_weights.h', help="Output C header.")
+    parser.add_argument('--name', default='sparse_weights', help="Name of the C variables.")
+    parser.add_argument('--prune', type=float, default=0.0,
+                        help="Fraction of the blocks to zero before the conversion, smallest L1 norm first.")
+    return parser.parse_args()
+
+
+if __name__ == '__main__':
+    args = parse_args()
+    weights = np.load(args.input)
+    weights = weights.reshape(weights.shape[0], -1).astype(np.int8)
+
+    if args.prune > 0:
+        weights = prune_blocks(weights, args.prune)
+
+    (values, block_cols, row_offsets) = convert_to_block_sparse(weights)
+    assert np.array_equal(convert_from_block_sparse(values, block_cols, row_offsets, weights.shape[1]), weights)
+    write_c_header(values, block_cols, row_offsets, args.name, args.output)
+
+    dense_size = weights.size
+    sparse_size = values.size + 2 * block_cols.size + 4 * row_offsets.size
+    total_blocks = weights.shape[0] * ((weights.shape[1] + BLOCK_SIZE - 1) // BLOCK_SIZE)
+    print("Stored {} of {} blocks ({:.1f}% block sparsity), {} bytes instead of {}".format(
+        block_cols.size, total_blocks, 100.0 * (1 - block_cols.size / max(total_blocks, 1)), sparse_size,
+        dense_size))
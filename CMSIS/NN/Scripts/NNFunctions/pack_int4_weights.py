@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Packs int4 weights into the layout expected by arm_fully_connected_s4() and
+# arm_convolve_1x1_s4_fast(). The weights are flattened row by row, i.e. [C_OUT, ...],
+# and two consecutive values are stored per byte with the first one in the low nibble.
+# The rows are not padded so with an odd number of columns a row may start in a high nibble.
+#
+import argparse
+import numpy as np
+
+INT4_MIN = -8
+INT4_MAX = 7
+
+
+def quantize_int4(weights, per_channel=False):
+    """ Symmetric int4 quantization of float weights. Returns the int4 values and the scale(s). """
+    weights = np.asarray(weights, dtype=np.float64)
+    rows = weights.reshape(weights.shape[0], -1)
+    if per_channel:
+        max_abs = np.max(np.abs(rows), axis=1)
+    else:
+        max_abs = np.max(np.abs(rows))
+    scale = np.where(max_abs > 0, max_abs / INT4_MAX, 1.0)
+    if per_channel:
+        quantized = np.round(rows / scale[:, np.newaxis])
+    else:
+        quantized = np.round(rows / scale)
+    quantized = np.clip(quantized, INT4_MIN, INT4_MAX).astype(np.int8)
+    return quantized.reshape(weights.shape), scale
+
+
+def pack_int4_weights(weights):
+    """ Packs int4 values, stored one per int8, two per byte. Returns an int8 array. """
+    flat = np.asarray(weights).astype(np.int8).flatten()
+    if flat.size and (flat.min() < INT4_MIN or flat.max() > INT4_MAX):
+        raise ValueError("weights are out of the int4 range [{}, {}]".format(INT4_MIN, INT4_MAX))
+    if flat.size % 2:
+        flat = np.append(flat, np.int8(0))
+    low = flat[0::2].astype(np.uint8) & 0x0F
+    high = (flat[1::2].astype(np.uint8) & 0x0F) << 4
+    return (low | high).astype(np.uint8).view(np.int8)
+
+
+def unpack_int4_weights(packed, count):
+    """ Inverse of pack_int4_weights(). """
+    packed = np.asarray(packed).astype(np.int8)
+    low = np.left_shift(packed, 4).astype(np.int8) >> 4
+    high = packed >> 4
+    return np.stack((low, high), axis=1).flatten()[:count]
+
+
+def write_c_header(packed, name, outfile):
+    with open(outfile, "w") as f:
+        f.write("// Generated by pack_int4_weights.py\n")
+        f.write("#pragma once\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("const int8_t {}[{}] = \n{{\n".format(name, packed.size))
+        for i in range(0, packed.size, 16):
+            f.write("    " + ", ".join(str(v) for v in packed[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Pack int4 weights for the CMSIS-NN s4 kernels.")
+    parser.add_argument('input', help="Weights stored with numpy.save(), first dimension is the output depth.")
+    parser.add_argument('--output', default='packed_weights.h', help="Output C header.")
+    parser.add_argument('--name', default='packed_weights', help="Name of the C array.")
+    parser.add_argument('--quantize', action='store_true',
+                        help="Quantize float weights symmetrically to int4 before packing.")
+    parser.add_argument('--per-channel', action='store_true', help="Use one scale per output channel.")
+    return parser.parse_args()
+
+
+if __name__ == '__main__':
+    args = parse_args()
+    weights = np.load(args.input)
+
+    if args.quantize:
+        weights, scale = quantize_int4(weights, args.per_channel)
+        print("Scale(s): {}".format(np.atleast_1d(scale).tolist()))
+
+    packed = pack_int4_weights(weights)
+    assert np.array_equal(unpack_int4_weights(packed, weights.size), weights.flatten())
+    write_c_header(packed, args.name, args.output)
+    print("Packed {} weights into {} bytes in {}".format(weights.size, packed.size, args.output))
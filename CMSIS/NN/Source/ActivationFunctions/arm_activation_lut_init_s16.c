@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_activation_lut_init_s16
+ * Description:  Computation of the s16 activation look-up table
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+/*
+ * s16 activation look-up table
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_activation_lut_init_s16(const arm_nn_activation_type type,
+                                       const float32_t alpha,
+                                       const float32_t input_scale,
+                                       const float32_t output_scale,
+                                       q15_t *lut)
+{
+    if (type > ARM_LEAKY_RELU || !(input_scale > 0.0f) || !(output_scale > 0.0f))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t num_steps = ARM_NN_ACTIVATION_LUT_S16_SIZE - 1;
+    const float32_t input_min = input_scale * (float32_t)Q15_MIN;
+    const float32_t input_max = input_scale * (float32_t)Q15_MAX;
+    const float32_t output_min = output_scale * (float32_t)Q15_MIN;
+    const float32_t output_max = output_scale * (float32_t)Q15_MAX;
+    const float32_t step = (input_max - input_min) / (float32_t)num_steps;
+    const float32_t half_step = step / 2.0f;
+    const float32_t output_scaling_inv = 65536.0f / (output_max - output_min);
+
+    for (int32_t i = 0; i < num_steps; i++)
+    {
+        const float32_t val = arm_nn_activation_f32(type, alpha, input_min + (float32_t)i * step);
+        const float32_t val_midpoint =
+            arm_nn_activation_f32(type, alpha, input_min + (float32_t)i * step + half_step);
+        const float32_t val_next = arm_nn_activation_f32(type, alpha, input_min + (float32_t)(i + 1) * step);
+
+        // The entries are biased by half the error of the linear interpolation at the midpoint of the step
+        const float32_t sample_val = roundf(val * output_scaling_inv);
+        const float32_t midpoint_interp_val = roundf((val_next * output_scaling_inv + sample_val) / 2.0f);
+        const float32_t midpoint_val = roundf(val_midpoint * output_scaling_inv);
+        const float32_t bias = roundf((midpoint_interp_val - midpoint_val) / 2.0f);
+        lut[i] = (q15_t)CLAMP(sample_val - bias, (float32_t)Q15_MAX, (float32_t)Q15_MIN);
+    }
+    const float32_t last_val = roundf(arm_nn_activation_f32(type, alpha, input_max) * output_scaling_inv);
+    lut[num_steps] = (q15_t)CLAMP(last_val, (float32_t)Q15_MAX, (float32_t)Q15_MIN);
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Acti group
+ */
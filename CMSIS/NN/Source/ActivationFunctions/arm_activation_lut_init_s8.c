@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_activation_lut_init_s8
+ * Description:  Computation of the s8 activation look-up table
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+/*
+ * s8 activation look-up table
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_activation_lut_init_s8(const arm_nn_activation_type type,
+                                      const float32_t alpha,
+                                      const float32_t input_scale,
+                                      const int32_t input_offset,
+                                      const float32_t output_scale,
+                                      const int32_t output_offset,
+                                      q7_t *lut)
+{
+    if (type > ARM_LEAKY_RELU || !(input_scale > 0.0f) || !(output_scale > 0.0f))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const float32_t inv_scale = 1.0f / output_scale;
+
+    for (int32_t val = Q7_MIN; val <= Q7_MAX; val++)
+    {
+        const float32_t dequantized = input_scale * (float32_t)(val + input_offset);
+        const float32_t transformed = arm_nn_activation_f32(type, alpha, dequantized);
+        const float32_t quantized = roundf(transformed * inv_scale) + (float32_t)output_offset;
+        lut[(uint8_t)val] = (q7_t)CLAMP(quantized, (float32_t)Q7_MAX, (float32_t)Q7_MIN);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Acti group
+ */
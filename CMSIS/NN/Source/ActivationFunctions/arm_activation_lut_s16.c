@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_activation_lut_s16
+ * Description:  s16 activation function using an interpolated look-up table
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+/*
+ * s16 activation function using an interpolated look-up table
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_activation_lut_s16(const q15_t *input, q15_t *output, const q15_t *lut, const int32_t block_size)
+{
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_ACTIVATION_LUT_S16, NULL, NULL, NULL, 0);
+
+#if defined(ARM_MATH_MVEI)
+    for (int32_t i = 0; i < block_size; i += 4)
+    {
+        const mve_pred16_t p = vctp32q((uint32_t)(block_size - i));
+        const int32x4_t res = arm_nn_lut_lookup_mve_s16(lut, vldrhq_z_s32(&input[i], p), p);
+        vstrhq_p_s32(&output[i], res, p);
+    }
+#else
+    for (int32_t i = 0; i < block_size; i++)
+    {
+        output[i] = arm_nn_lut_lookup_s16(lut, input[i]);
+    }
+#endif
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Acti group
+ */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_activation_lut_s8
+ * Description:  s8 activation function using a look-up table
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+/*
+ * s8 activation function using a look-up table
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_activation_lut_s8(const q7_t *input, q7_t *output, const q7_t *lut, const int32_t block_size)
+{
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_ACTIVATION_LUT_S8, NULL, NULL, NULL, 0);
+
+    arm_nn_lut_s8(input, output, lut, block_size);
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Acti group
+ */
@@ -51,6 +51,8 @@ void arm_relu6_s8(q7_t *data, uint16_t size)
 {
     int32_t i;
 
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_RELU6_S8, NULL, NULL, NULL, 0);
+
     for (i = 0; i < size; i++)
     {
         int32_t ip = data[i];
@@ -58,6 +60,8 @@ void arm_relu6_s8(q7_t *data, uint16_t size)
         ip = MAX(ip, 0);
         data[i] = MIN(ip, 6);
     }
+
+    ARM_NN_PROFILE_END();
 }
 
 /**
@@ -82,6 +82,8 @@ arm_elementwise_add_s8(const int8_t *input_1_vect,
                        const int32_t out_activation_max,
                        const uint32_t block_size)
 {
+  ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_ELEMENTWISE_ADD_S8, NULL, NULL, NULL, 0);
+
 #if defined(ARM_MATH_MVEI)
   int32_t count = (int32_t)block_size;
 
@@ -244,6 +246,7 @@ arm_elementwise_add_s8(const int8_t *input_1_vect,
 
 #endif /* ARM_MATH_MVEI */
 
+  ARM_NN_PROFILE_END();
   return (ARM_MATH_SUCCESS);
 }
 
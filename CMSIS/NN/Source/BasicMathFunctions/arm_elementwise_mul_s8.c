@@ -61,6 +61,7 @@ arm_elementwise_mul_s8(const int8_t *input_1_vect,
                        const int32_t out_activation_max,
                        const uint32_t block_size)
 {
+  ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_ELEMENTWISE_MUL_S8, NULL, NULL, NULL, (int64_t)block_size);
 
   int32_t loop_count;
 #if defined(ARM_MATH_MVEI)
@@ -194,6 +195,7 @@ arm_elementwise_mul_s8(const int8_t *input_1_vect,
     loop_count--;
   }
 #endif
+  ARM_NN_PROFILE_END();
   return ARM_MATH_SUCCESS;
 }
 
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_layer_norm_s16
+ * Description:  S16 layer normalization
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+// Extra resolution of the mean and the normalized values, i.e. 2^10 and its square
+#define LAYER_NORM_MEAN_SCALE (1 << 10)
+#define LAYER_NORM_VAR_SCALE (1 << 20)
+
+/*
+ * Inverse square root of val as a quantized multiplier and a left shift. The Newton-Raphson
+ * iteration is done in Q3.28 and is the same as the one used by TensorFlow Lite.
+ */
+static void inv_sqrt_quantized_multiplier(int32_t val, int32_t *mult, int32_t *shift)
+{
+    if (val <= 1)
+    {
+        *mult = Q31_MAX;
+        *shift = 0;
+        return;
+    }
+
+    int32_t right_shift = 11;
+    while (val >= (1 << 29))
+    {
+        val /= 4;
+        ++right_shift;
+    }
+    const int32_t left_shift_bit_pairs = ((__CLZ((uint32_t)val) - 1) / 2) - 1;
+    right_shift -= left_shift_bit_pairs;
+    val <<= 2 * left_shift_bit_pairs;
+
+    const int32_t half_input = DIV_POW2(val >> 1, 1);
+    const int32_t half_three = (1 << 28) + (1 << 27);
+    int32_t x = (1 << 28);
+
+    for (int32_t i = 0; i < 5; i++)
+    {
+        const int32_t x3 = MUL_POW2(MUL_SAT(MUL_SAT(x, x), x), 6);
+        x = MUL_POW2(MUL_SAT(half_three, x) - MUL_SAT(half_input, x3), 3);
+    }
+    // sqrt(2) / 2 in Q0.31
+    x = MUL_SAT(x, 1518500250);
+
+    if (right_shift < 0)
+    {
+        x <<= -right_shift;
+        right_shift = 0;
+    }
+    *mult = x;
+    *shift = -right_shift;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup BasicMath
+ * @{
+ */
+
+/*
+ * S16 layer normalization
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_layer_norm_s16(const int16_t *input,
+                              const int16_t *weights,
+                              const int32_t *bias,
+                              const int32_t out_mult,
+                              const int32_t out_shift,
+                              const int32_t variance_limit,
+                              const int32_t num_rows,
+                              const int32_t row_size,
+                              int16_t *output)
+{
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_LAYER_NORM_S16, NULL, NULL, NULL, (int64_t)num_rows * row_size);
+
+    for (int32_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        int32_t sum = 0;
+        int64_t sum_sq = 0;
+        int32_t col = 0;
+
+#if defined(ARM_MATH_MVEI)
+        int32_t cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp16q((uint32_t)cnt);
+            const int16x8_t in = vldrhq_z_s16(&input[col], p);
+            sum = vaddvaq_p_s16(sum, in, p);
+            sum_sq = vmlaldavaq_p_s16(sum_sq, in, in, p);
+            col += 8;
+            cnt -= 8;
+        }
+#else
+#if defined(ARM_MATH_DSP)
+        const int16_t *in_ptr = input;
+        for (; col < (row_size & ~0x1); col += 2)
+        {
+            const int32_t in = arm_nn_read_q15x2_ia(&in_ptr);
+            sum = __SMLAD(in, 0x00010001, sum);
+            sum_sq = __SMLALD(in, in, sum_sq);
+        }
+#endif
+        for (; col < row_size; ++col)
+        {
+            sum += input[col];
+            sum_sq += input[col] * input[col];
+        }
+#endif
+
+        const int32_t mean = (int32_t)(((int64_t)sum * LAYER_NORM_MEAN_SCALE) / row_size);
+        const int64_t variance =
+            sum_sq * (LAYER_NORM_VAR_SCALE / row_size) - (int64_t)mean * (int64_t)mean;
+        int32_t scaled_variance = (int32_t)(variance / LAYER_NORM_VAR_SCALE);
+        if (scaled_variance < 1)
+        {
+            scaled_variance = variance_limit;
+        }
+
+        int32_t stddev_inv_mult;
+        int32_t stddev_inv_shift;
+        inv_sqrt_quantized_multiplier(scaled_variance, &stddev_inv_mult, &stddev_inv_shift);
+
+        for (col = 0; col < row_size; ++col)
+        {
+            const int32_t shifted = LAYER_NORM_MEAN_SCALE * input[col] - mean;
+            const int32_t rescaled = arm_nn_requantize(shifted, stddev_inv_mult, stddev_inv_shift);
+            const int64_t weighted = (int64_t)rescaled * weights[col] + bias[col];
+            const int32_t res_1024 = (int32_t)((weighted > 0 ? weighted + 512 : weighted - 512) / 1024);
+            const int32_t res = arm_nn_requantize(res_1024, out_mult, out_shift + 12);
+            output[col] = (int16_t)CLAMP(res, (int32_t)Q15_MAX, (int32_t)Q15_MIN);
+        }
+
+        input += row_size;
+        output += row_size;
+    }
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of BasicMath group
+ */
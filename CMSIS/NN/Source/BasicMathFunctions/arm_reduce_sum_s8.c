@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_reduce_sum_s8
+ * Description:  S8 sum over the axes with an output dimension of one
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup BasicMath
+ * @{
+ */
+
+/*
+ * S8 sum
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_reduce_sum_s8(const cmsis_nn_dims *input_dims,
+                             const q7_t *input_data,
+                             const int32_t input_offset,
+                             const cmsis_nn_per_tensor_quant_params *quant_params,
+                             const int32_t output_offset,
+                             const cmsis_nn_dims *output_dims,
+                             q7_t *output_data)
+{
+    if ((output_dims->n != input_dims->n && output_dims->n != 1) ||
+        (output_dims->h != input_dims->h && output_dims->h != 1) ||
+        (output_dims->w != input_dims->w && output_dims->w != 1) ||
+        (output_dims->c != input_dims->c && output_dims->c != 1))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_REDUCE_SUM_S8, input_dims, NULL, output_dims, 0);
+
+    arm_nn_reduce_s8(input_dims,
+                     input_data,
+                     input_offset,
+                     quant_params->multiplier,
+                     quant_params->shift,
+                     output_offset,
+                     0,
+                     output_dims,
+                     output_data);
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of BasicMath group
+ */
@@ -53,11 +53,15 @@ void arm_concatenation_s8_w(const int8_t *input,
                             int8_t *output,
                             const uint32_t offset_w)
 {
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONCATENATION_S8, NULL, NULL, NULL, 0);
+
     const uint32_t input_copy_size = input_x * input_y * input_z * input_w;
 
     output += offset_w * (input_x * input_y * input_z);
 
     memcpy(output, input, input_copy_size);
+
+    ARM_NN_PROFILE_END();
 }
 
 /**
@@ -54,6 +54,8 @@ void arm_concatenation_s8_x(const int8_t *input,
                             const uint16_t output_x,
                             const uint32_t offset_x)
 {
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONCATENATION_S8, NULL, NULL, NULL, 0);
+
     const uint32_t num_iterations = input_y * input_z * input_w;
 
     output += offset_x;
@@ -67,6 +69,8 @@ void arm_concatenation_s8_x(const int8_t *input,
         input  += input_x;
         output += output_x;
     }
+
+    ARM_NN_PROFILE_END();
 }
 
 /**
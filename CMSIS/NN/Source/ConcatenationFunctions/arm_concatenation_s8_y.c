@@ -54,6 +54,8 @@ void arm_concatenation_s8_y(const int8_t *input,
                             const uint16_t output_y,
                             const uint32_t offset_y)
 {
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONCATENATION_S8, NULL, NULL, NULL, 0);
+
     const uint32_t num_iterations  = input_z * input_w;
     const uint32_t input_copy_size = input_x * input_y;
     const uint32_t output_stride   = input_x * output_y;
@@ -68,6 +70,8 @@ void arm_concatenation_s8_y(const int8_t *input,
         input  += input_copy_size;
         output += output_stride;
     }
+
+    ARM_NN_PROFILE_END();
 }
 
 /**
@@ -54,6 +54,8 @@ void arm_concatenation_s8_z(const int8_t *input,
                             const uint16_t output_z,
                             const uint32_t offset_z)
 {
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONCATENATION_S8, NULL, NULL, NULL, 0);
+
     const uint32_t input_copy_size = input_x * input_y * input_z;
     const uint32_t output_stride   = input_x * input_y * output_z;
 
@@ -67,6 +69,8 @@ void arm_concatenation_s8_z(const int8_t *input,
         input  += input_copy_size;
         output += output_stride;
     }
+
+    ARM_NN_PROFILE_END();
 }
 
 /**
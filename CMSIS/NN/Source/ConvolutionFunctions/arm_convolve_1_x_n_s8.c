@@ -86,6 +86,10 @@ arm_status arm_convolve_1_x_n_s8(const cmsis_nn_context* ctx,
     int32_t *output_mult             = quant_params->multiplier;
     int32_t *output_shift            = quant_params->shift;
 
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONVOLVE_1_X_N_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)input_dims->n * output_dims->h * output_dims->w * output_dims->c *
+                         filter_dims->h * filter_dims->w * input_dims->c);
+
     for (int i_out_x = 0; i_out_x <= (output_x - 4); i_out_x += 4)
     {
         int32_t input_begin_idx[4];
@@ -163,6 +167,8 @@ arm_status arm_convolve_1_x_n_s8(const cmsis_nn_context* ctx,
         output_data += (3 * output_ch);
     }
 
+    ARM_NN_PROFILE_END();
+
 #else
     status = arm_convolve_s8(ctx,
                              conv_params,
@@ -73,6 +73,9 @@ arm_status arm_convolve_1x1_s8_fast(const cmsis_nn_context *ctx,
     (void)filter_dims;
     (void)bias_dims;
 
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONVOLVE_1X1_S8_FAST, input_dims, filter_dims, output_dims,
+                         (int64_t)input_dims->n * output_dims->h * output_dims->w * output_dims->c * input_dims->c);
+
 #if defined(ARM_MATH_MVEI)
 
     const int32_t col_len       = input_dims->w * input_dims->h * input_dims->n;
@@ -167,6 +170,8 @@ arm_status arm_convolve_1x1_s8_fast(const cmsis_nn_context *ctx,
 
 #endif
 
+    ARM_NN_PROFILE_END();
+
     /* Return to application */
     return ARM_MATH_SUCCESS;
 }
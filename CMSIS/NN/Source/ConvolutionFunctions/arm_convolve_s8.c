@@ -21,8 +21,8 @@
  * Title:        arm_convolve_s8.c
  * Description:  s8 version of convolution using symmetric quantization.
  *
- * $Date:        May 29, 2020
- * $Revision:    V.2.0.1
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.2.0
  *
  * Target Processor:  Cortex-M cores
  *
@@ -32,34 +32,39 @@
 #include "arm_nnfunctions.h"
 #include "arm_nnsupportfunctions.h"
 
-/**
- *  @ingroup groupNN
- */
-
-/**
- * @addtogroup NNConv
- * @{
- */
-
-/*
-   * Basic s8 convolution function.
-   *
-   * Refer header file for details. Optimal use case for the DSP/MVE implementation is when input and output channels
-   * are multiples of 4 or atleast greater than 4.
-   *
-   */
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_DSP)
+// Applies the activation look-up table, if any, to num_pos output positions of output_ch channels
+static void apply_lut_s8(q7_t *out,
+                         const q7_t *lut,
+                         const int32_t num_pos,
+                         const int32_t output_ch,
+                         const int32_t output_ch_stride)
+{
+    if (lut == NULL)
+    {
+        return;
+    }
+    for (int32_t i = 0; i < num_pos; i++)
+    {
+        arm_nn_lut_s8(out, out, lut, output_ch);
+        out += output_ch_stride;
+    }
+}
+#endif
 
-arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
-                           const cmsis_nn_conv_params* conv_params,
-                           const cmsis_nn_per_channel_quant_params* quant_params,
-                           const cmsis_nn_dims* input_dims,
-                           const q7_t *input_data,
-                           const cmsis_nn_dims* filter_dims,
-                           const q7_t *filter_data,
-                           const cmsis_nn_dims* bias_dims,
-                           const int32_t *bias_data,
-                           const cmsis_nn_dims* output_dims,
-                           q7_t *output_data)
+static void convolve_s8(const cmsis_nn_context* ctx,
+                        const cmsis_nn_conv_params* conv_params,
+                        const cmsis_nn_per_channel_quant_params* quant_params,
+                        const cmsis_nn_dims* input_dims,
+                        const q7_t *input_data,
+                        const cmsis_nn_dims* filter_dims,
+                        const q7_t *filter_data,
+                        const cmsis_nn_dims* bias_dims,
+                        const int32_t *bias_data,
+                        const cmsis_nn_dims* output_dims,
+                        q7_t *output_data,
+                        const int32_t output_ch_stride,
+                        const q7_t *lut)
 {
     q15_t *buffer_a = (q15_t *)ctx->buf;
 
@@ -85,6 +90,10 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
     int32_t *output_mult             = quant_params->multiplier;
     int32_t *output_shift            = quant_params->shift;
 
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONVOLVE_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)input_dims->n * output_dims->h * output_dims->w * output_dims->c *
+                         filter_dims->h * filter_dims->w * input_dims->c);
+
     int i_batch;
     for (i_batch = 0; i_batch < input_batches; i_batch++)
     {
@@ -148,17 +157,23 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
 
                         res = vmaxq_s32(res, vdupq_n_s32(out_activation_min));
                         res = vminq_s32(res, vdupq_n_s32(out_activation_max));
+                        if (lut != NULL)
+                        {
+                            const uint32x4_t lut_offset = vreinterpretq_u32_s32(vandq_s32(res, vdupq_n_s32(0xFF)));
+                            res = vldrbq_gather_offset_s32(lut, lut_offset);
+                        }
 
-                        const uint32x4_t scatter_offset = {0, output_ch, output_ch * 2, output_ch * 3};
+                        const uint32x4_t scatter_offset = {0, output_ch_stride, output_ch_stride * 2, output_ch_stride * 3};
                         vstrbq_scatter_offset_s32(out, scatter_offset, res);
                         out++;
                     }
-                    out += (3 * output_ch);
+                    out += (4 * output_ch_stride - output_ch);
                     im2col_buf = (q7_t *)buffer_a;
                 }
                 else if (buffer_fill_cnt == 4 && (padded != 0))
                 {
                     buffer_fill_cnt = 0;
+                    q7_t *out_block = out;
                     out = arm_nn_mat_mult_s8(filter_data,
                                              (q7_t *)buffer_a,
                                              output_ch,
@@ -172,7 +187,9 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
                                              out_activation_max,
                                              num_elem,
                                              bias_data,
-                                             out);
+                                             out,
+                                             output_ch_stride);
+                    apply_lut_s8(out_block, lut, 4, output_ch, output_ch_stride);
 
                     im2col_buf = (q7_t *)buffer_a;
                     padded = 0;
@@ -182,6 +199,7 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
         /* Handle left over columns */
         if (buffer_fill_cnt != 0)
         {
+            q7_t *out_block = out;
             out = arm_nn_mat_mult_s8(filter_data,
                                      (q7_t *)buffer_a,
                                      output_ch,
@@ -195,7 +213,9 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
                                      out_activation_max,
                                      num_elem,
                                      bias_data,
-                                     out);
+                                     out,
+                                     output_ch_stride);
+            apply_lut_s8(out_block, lut, buffer_fill_cnt, output_ch, output_ch_stride);
         }
 
 #elif defined(ARM_MATH_DSP)
@@ -232,6 +252,7 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
                 /* Computation is filed for every 2 columns */
                 if (two_column_buf == buffer_a + 2 * input_ch * kernel_y * kernel_x)
                 {
+                    q7_t *out_block = out;
                     out =
                         arm_nn_mat_mult_kernel_s8_s16(filter_data,
                                                       buffer_a,
@@ -243,7 +264,9 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
                                                       out_activation_max,
                                                       input_ch * kernel_y * kernel_x,
                                                       bias_data,
-                                                      out);
+                                                      out,
+                                                      output_ch_stride);
+                    apply_lut_s8(out_block, lut, 2, output_ch, output_ch_stride);
 
                     /* counter reset */
                     two_column_buf = buffer_a;
@@ -296,7 +319,7 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
                 sum += out_offset;
                 sum = MAX(sum, out_activation_min);
                 sum = MIN(sum, out_activation_max);
-                *out++ = (q7_t)sum;
+                *out++ = lut != NULL ? lut[(uint8_t)sum] : (q7_t)sum;
             }
         }
 #else
@@ -341,16 +364,148 @@ arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
                     conv_out += out_offset;
                     conv_out = MAX(conv_out, out_activation_min);
                     conv_out = MIN(conv_out, out_activation_max);
-                    output_data[i_out_ch + (i_out_y * output_x + i_out_x) * output_ch] = (int8_t)conv_out;
+                    if (lut != NULL)
+                    {
+                        conv_out = lut[(uint8_t)conv_out];
+                    }
+                    output_data[i_out_ch + (i_out_y * output_x + i_out_x) * output_ch_stride] = (int8_t)conv_out;
                 }
             }
         }
 #endif
         /* Advance to the next batch */
         input_data += (input_x * input_y * input_ch);
-        output_data += (output_x * output_y * output_ch);
+        output_data += (output_x * output_y * output_ch_stride);
+    }
+
+    ARM_NN_PROFILE_END();
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+   * Basic s8 convolution function.
+   *
+   * Refer header file for details. Optimal use case for the DSP/MVE implementation is when input and output channels
+   * are multiples of 4 or atleast greater than 4.
+   *
+   */
+
+arm_status arm_convolve_s8(const cmsis_nn_context* ctx,
+                           const cmsis_nn_conv_params* conv_params,
+                           const cmsis_nn_per_channel_quant_params* quant_params,
+                           const cmsis_nn_dims* input_dims,
+                           const q7_t *input_data,
+                           const cmsis_nn_dims* filter_dims,
+                           const q7_t *filter_data,
+                           const cmsis_nn_dims* bias_dims,
+                           const int32_t *bias_data,
+                           const cmsis_nn_dims* output_dims,
+                           q7_t *output_data)
+{
+    return arm_convolve_s8_strided_output(ctx,
+                                          conv_params,
+                                          quant_params,
+                                          input_dims,
+                                          input_data,
+                                          filter_dims,
+                                          filter_data,
+                                          bias_dims,
+                                          bias_data,
+                                          output_dims,
+                                          output_data,
+                                          output_dims->c);
+}
+
+/*
+   * Basic s8 convolution function writing to a slice of the channels of a larger output tensor.
+   *
+   * Refer header file for details.
+   *
+   */
+
+arm_status arm_convolve_s8_strided_output(const cmsis_nn_context* ctx,
+                                          const cmsis_nn_conv_params* conv_params,
+                                          const cmsis_nn_per_channel_quant_params* quant_params,
+                                          const cmsis_nn_dims* input_dims,
+                                          const q7_t *input_data,
+                                          const cmsis_nn_dims* filter_dims,
+                                          const q7_t *filter_data,
+                                          const cmsis_nn_dims* bias_dims,
+                                          const int32_t *bias_data,
+                                          const cmsis_nn_dims* output_dims,
+                                          q7_t *output_data,
+                                          const int32_t output_ch_stride)
+{
+    if (output_ch_stride < output_dims->c)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    convolve_s8(ctx,
+                conv_params,
+                quant_params,
+                input_dims,
+                input_data,
+                filter_dims,
+                filter_data,
+                bias_dims,
+                bias_data,
+                output_dims,
+                output_data,
+                output_ch_stride,
+                NULL);
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/*
+   * Basic s8 convolution function with a fused activation look-up table.
+   *
+   * Refer header file for details.
+   *
+   */
+
+arm_status arm_convolve_s8_lut(const cmsis_nn_context* ctx,
+                               const cmsis_nn_conv_params* conv_params,
+                               const cmsis_nn_per_channel_quant_params* quant_params,
+                               const cmsis_nn_dims* input_dims,
+                               const q7_t *input_data,
+                               const cmsis_nn_dims* filter_dims,
+                               const q7_t *filter_data,
+                               const cmsis_nn_dims* bias_dims,
+                               const int32_t *bias_data,
+                               const cmsis_nn_dims* output_dims,
+                               q7_t *output_data,
+                               const q7_t *lut)
+{
+    if (lut == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
     }
 
+    convolve_s8(ctx,
+                conv_params,
+                quant_params,
+                input_dims,
+                input_data,
+                filter_dims,
+                filter_data,
+                bias_dims,
+                bias_data,
+                output_dims,
+                output_data,
+                output_dims->c,
+                lut);
+
     /* Return to application */
     return ARM_MATH_SUCCESS;
 }
@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_small_ch_s8.c
+ * Description:  s8 direct convolution for layers with few input channels
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+#include "arm_math.h"
+#include "arm_nn_types.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+__STATIC_FORCEINLINE q7_t requantize_output(const int32_t acc,
+                                            const int32_t mult,
+                                            const int32_t shift,
+                                            const int32_t out_offset,
+                                            const int32_t act_min,
+                                            const int32_t act_max)
+{
+    int32_t res = arm_nn_requantize(acc, mult, shift) + out_offset;
+    res = MAX(res, act_min);
+    res = MIN(res, act_max);
+    return (q7_t)res;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+   * s8 direct convolution for few input channels.
+   *
+   * Refer header file for details.
+   *
+   */
+
+arm_status arm_convolve_small_ch_s8(const cmsis_nn_context *ctx,
+                                    const cmsis_nn_conv_params *conv_params,
+                                    const cmsis_nn_per_channel_quant_params *quant_params,
+                                    const cmsis_nn_dims *input_dims,
+                                    const q7_t *input_data,
+                                    const cmsis_nn_dims *filter_dims,
+                                    const q7_t *filter_data,
+                                    const cmsis_nn_dims *bias_dims,
+                                    const int32_t *bias_data,
+                                    const cmsis_nn_dims *output_dims,
+                                    q7_t *output_data)
+{
+    (void)ctx;
+    (void)bias_dims;
+
+    if (input_dims->c > ARM_NN_CONV_SMALL_CH_MAX)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+
+    const int32_t pad_x = conv_params->padding.w;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t stride_y = conv_params->stride.h;
+
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t *output_shift = quant_params->shift;
+
+    /* Size of one filter, i.e. the distance between two output channels in filter_data */
+    const int32_t ker_size = kernel_x * kernel_y * input_ch;
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    const q31_t offset_q15x2 = __PKHBT(input_offset, input_offset, 16);
+#endif
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_CONVOLVE_SMALL_CH_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)input_batches * output_y * output_x * output_ch * ker_size);
+
+    for (int i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        for (int i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            const int32_t base_idx_y = stride_y * i_out_y - pad_y;
+            const int32_t ker_y_start = MAX(0, -base_idx_y);
+            const int32_t ker_y_end = MIN(kernel_y, input_y - base_idx_y);
+
+            for (int i_out_x = 0; i_out_x < output_x; i_out_x++)
+            {
+                const int32_t base_idx_x = stride_x * i_out_x - pad_x;
+                const int32_t ker_x_start = MAX(0, -base_idx_x);
+                const int32_t ker_x_end = MIN(kernel_x, input_x - base_idx_x);
+
+                /* The valid part of a kernel row is contiguous in both the input and the filter
+                   as the channels are innermost */
+                const int32_t row_len = (ker_x_end - ker_x_start) * input_ch;
+                const q7_t *in_start = input_data + (base_idx_x + ker_x_start) * input_ch;
+                const q7_t *ker_start = filter_data + ker_x_start * input_ch;
+                int32_t i_out_ch = 0;
+
+#if defined(ARM_MATH_MVEI)
+                for (; i_out_ch <= output_ch - 4; i_out_ch += 4)
+                {
+                    const q7_t *ker_0 = ker_start + i_out_ch * ker_size;
+                    int32_t acc_0 = bias_data[i_out_ch];
+                    int32_t acc_1 = bias_data[i_out_ch + 1];
+                    int32_t acc_2 = bias_data[i_out_ch + 2];
+                    int32_t acc_3 = bias_data[i_out_ch + 3];
+
+                    for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                    {
+                        const q7_t *in_row = in_start + (base_idx_y + i_ker_y) * input_x * input_ch;
+                        const q7_t *ker_row = ker_0 + i_ker_y * kernel_x * input_ch;
+
+                        for (int i = 0; i < row_len; i += 8)
+                        {
+                            const mve_pred16_t p = vctp16q((uint32_t)(row_len - i));
+                            /* Inactive lanes hold the offset only, their weights are zero */
+                            const int16x8_t in = vaddq_n_s16(vldrbq_z_s16(in_row + i, p), (int16_t)input_offset);
+
+                            acc_0 = vmladavaq_s16(acc_0, in, vldrbq_z_s16(ker_row + i, p));
+                            acc_1 = vmladavaq_s16(acc_1, in, vldrbq_z_s16(ker_row + ker_size + i, p));
+                            acc_2 = vmladavaq_s16(acc_2, in, vldrbq_z_s16(ker_row + 2 * ker_size + i, p));
+                            acc_3 = vmladavaq_s16(acc_3, in, vldrbq_z_s16(ker_row + 3 * ker_size + i, p));
+                        }
+                    }
+
+                    output_data[i_out_ch] = requantize_output(acc_0, output_mult[i_out_ch], output_shift[i_out_ch],
+                                                              out_offset, out_activation_min, out_activation_max);
+                    output_data[i_out_ch + 1] = requantize_output(acc_1, output_mult[i_out_ch + 1],
+                                                                  output_shift[i_out_ch + 1], out_offset,
+                                                                  out_activation_min, out_activation_max);
+                    output_data[i_out_ch + 2] = requantize_output(acc_2, output_mult[i_out_ch + 2],
+                                                                  output_shift[i_out_ch + 2], out_offset,
+                                                                  out_activation_min, out_activation_max);
+                    output_data[i_out_ch + 3] = requantize_output(acc_3, output_mult[i_out_ch + 3],
+                                                                  output_shift[i_out_ch + 3], out_offset,
+                                                                  out_activation_min, out_activation_max);
+                }
+#elif defined(ARM_MATH_DSP)
+                for (; i_out_ch <= output_ch - 4; i_out_ch += 4)
+                {
+                    const q7_t *ker_0 = ker_start + i_out_ch * ker_size;
+                    int32_t acc_0 = bias_data[i_out_ch];
+                    int32_t acc_1 = bias_data[i_out_ch + 1];
+                    int32_t acc_2 = bias_data[i_out_ch + 2];
+                    int32_t acc_3 = bias_data[i_out_ch + 3];
+
+                    for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                    {
+                        const q7_t *in_row = in_start + (base_idx_y + i_ker_y) * input_x * input_ch;
+                        const q7_t *ker_row = ker_0 + i_ker_y * kernel_x * input_ch;
+                        int i = 0;
+
+                        for (; i <= row_len - 4; i += 4)
+                        {
+                            /* The input is read once for four output channels */
+                            const q31_t in = arm_nn_read_q7x4(in_row + i);
+                            const q31_t in_02 = __SXTAB16(offset_q15x2, in);
+                            const q31_t in_13 = __SXTAB16(offset_q15x2, __ROR((uint32_t)in, 8));
+                            q31_t ker;
+
+                            ker = arm_nn_read_q7x4(ker_row + i);
+                            acc_0 = __SMLAD(in_02, __SXTB16(ker), acc_0);
+                            acc_0 = __SMLAD(in_13, __SXTB16(__ROR((uint32_t)ker, 8)), acc_0);
+
+                            ker = arm_nn_read_q7x4(ker_row + ker_size + i);
+                            acc_1 = __SMLAD(in_02, __SXTB16(ker), acc_1);
+                            acc_1 = __SMLAD(in_13, __SXTB16(__ROR((uint32_t)ker, 8)), acc_1);
+
+                            ker = arm_nn_read_q7x4(ker_row + 2 * ker_size + i);
+                            acc_2 = __SMLAD(in_02, __SXTB16(ker), acc_2);
+                            acc_2 = __SMLAD(in_13, __SXTB16(__ROR((uint32_t)ker, 8)), acc_2);
+
+                            ker = arm_nn_read_q7x4(ker_row + 3 * ker_size + i);
+                            acc_3 = __SMLAD(in_02, __SXTB16(ker), acc_3);
+                            acc_3 = __SMLAD(in_13, __SXTB16(__ROR((uint32_t)ker, 8)), acc_3);
+                        }
+
+                        for (; i < row_len; i++)
+                        {
+                            const int32_t in = in_row[i] + input_offset;
+                            acc_0 += in * ker_row[i];
+                            acc_1 += in * ker_row[ker_size + i];
+                            acc_2 += in * ker_row[2 * ker_size + i];
+                            acc_3 += in * ker_row[3 * ker_size + i];
+                        }
+                    }
+
+                    output_data[i_out_ch] = requantize_output(acc_0, output_mult[i_out_ch], output_shift[i_out_ch],
+                                                              out_offset, out_activation_min, out_activation_max);
+                    output_data[i_out_ch + 1] = requantize_output(acc_1, output_mult[i_out_ch + 1],
+                                                                  output_shift[i_out_ch + 1], out_offset,
+                                                                  out_activation_min, out_activation_max);
+                    output_data[i_out_ch + 2] = requantize_output(acc_2, output_mult[i_out_ch + 2],
+                                                                  output_shift[i_out_ch + 2], out_offset,
+                                                                  out_activation_min, out_activation_max);
+                    output_data[i_out_ch + 3] = requantize_output(acc_3, output_mult[i_out_ch + 3],
+                                                                  output_shift[i_out_ch + 3], out_offset,
+                                                                  out_activation_min, out_activation_max);
+                }
+#endif
+                for (; i_out_ch < output_ch; i_out_ch++)
+                {
+                    const q7_t *ker = ker_start + i_out_ch * ker_size;
+                    int32_t acc = bias_data[i_out_ch];
+
+                    for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                    {
+                        const q7_t *in_row = in_start + (base_idx_y + i_ker_y) * input_x * input_ch;
+                        const q7_t *ker_row = ker + i_ker_y * kernel_x * input_ch;
+
+                        for (int i = 0; i < row_len; i++)
+                        {
+                            acc += (in_row[i] + input_offset) * ker_row[i];
+                        }
+                    }
+
+                    output_data[i_out_ch] = requantize_output(acc, output_mult[i_out_ch], output_shift[i_out_ch],
+                                                              out_offset, out_activation_min, out_activation_max);
+                }
+                output_data += output_ch;
+            }
+        }
+        /* Advance to the next batch */
+        input_data += (input_x * input_y * input_ch);
+    }
+
+    ARM_NN_PROFILE_END();
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_convolve_small_ch_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                 const cmsis_nn_dims *filter_dims)
+{
+    (void)input_dims;
+    (void)filter_dims;
+    return 0;
+}
+
+/**
+ * @} end of NNConv group
+ */
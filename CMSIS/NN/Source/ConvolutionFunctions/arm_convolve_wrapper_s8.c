@@ -21,8 +21,8 @@
  * Title:        arm_convolve_wrapper_s8.c
  * Description:  s8 convolution layer wrapper function with the main purpose to call the optimal kernel available in cmsis-nn to perform the convolution.
  *
- * $Date:        May 18, 2020
- * $Revision:    V.1.0.0
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.1.0
  *
  * Target Processor:  Cortex-M cores
  *
@@ -79,6 +79,20 @@ arm_status arm_convolve_wrapper_s8(const cmsis_nn_context* ctx,
                                         output_dims,
                                         output_data);
     }
+    else if (input_dims->c <= ARM_NN_CONV_SMALL_CH_MAX)
+    {
+        return arm_convolve_small_ch_s8(ctx,
+                                        conv_params,
+                                        quant_params,
+                                        input_dims,
+                                        input_data,
+                                        filter_dims,
+                                        filter_data,
+                                        bias_dims,
+                                        bias_data,
+                                        output_dims,
+                                        output_data);
+    }
     else if ((output_dims->h == 1) &&
              (input_dims->h == 1) &&
              (filter_dims->h == 1) &&
@@ -128,6 +142,10 @@ int32_t arm_convolve_wrapper_s8_get_buffer_size(const cmsis_nn_conv_params* conv
     {
         return arm_convolve_1x1_s8_fast_get_buffer_size(input_dims);
     }
+    else if (input_dims->c <= ARM_NN_CONV_SMALL_CH_MAX)
+    {
+        return arm_convolve_small_ch_s8_get_buffer_size(input_dims, filter_dims);
+    }
     else if ((output_dims->h == 1) &&
              (input_dims->h == 1) &&
              (filter_dims->h == 1) &&
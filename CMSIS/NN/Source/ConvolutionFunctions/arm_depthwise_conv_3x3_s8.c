@@ -22,8 +22,8 @@
  * Description:  Optimized s8 depthwise convolution function for channel
  *               multiplier of 1 and 3x3 kernel size.
  *
- * $Date:        May 14, 2020
- * $Revision:    V.2.0.0
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.0.1
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -87,12 +87,16 @@ arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
     {
         return ARM_MATH_SIZE_MISMATCH;
     }
-    /* Check input constraints pad_x <= 1 */
-    if (pad_x > 1 || filter_dims->w != 3 || filter_dims->h != 3)
+    /* Check input constraints pad_x <= 1 and no dilation */
+    if (pad_x > 1 || filter_dims->w != 3 || filter_dims->h != 3 || dw_conv_params->dilation.w != 1 ||
+        dw_conv_params->dilation.h != 1)
     {
         return ARM_MATH_ARGUMENT_ERROR;
     }
 
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_DEPTHWISE_CONV_3X3_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)output_dims->h * output_dims->w * output_dims->c * filter_dims->h * filter_dims->w);
+
     for (int32_t in_h = -pad_y, out_h = 0, out_idx = 0; out_h < output_y; in_h += stride_y, ++out_h)
     {
         for (int32_t in_w = -pad_x, out_w = 0, ker_h_start = MAX(0, -in_h); out_w < output_x; in_w += stride_x, ++out_w)
@@ -204,6 +208,8 @@ arm_status arm_depthwise_conv_3x3_s8(const cmsis_nn_context *ctx,
         }
     }
 
+    ARM_NN_PROFILE_END();
+
     /* Return to application */
     return ARM_MATH_SUCCESS;
 }
@@ -0,0 +1,388 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_ch_mult_s8.c
+ * Description:  Optimized s8 depthwise convolution function for
+ *               channel multiplier greater than 1.
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M CPUs
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnsupportfunctions.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+   * Optimized s8 depthwise convolution function with constraint that out_channel equals in_channel * ch_mult
+   *
+   *  Refer prototype header file for details.
+   *
+   */
+
+arm_status arm_depthwise_conv_ch_mult_s8(const cmsis_nn_context *ctx,
+                                         const cmsis_nn_dw_conv_params *dw_conv_params,
+                                         const cmsis_nn_per_channel_quant_params *quant_params,
+                                         const cmsis_nn_dims *input_dims,
+                                         const q7_t *input,
+                                         const cmsis_nn_dims *filter_dims,
+                                         const q7_t *kernel,
+                                         const cmsis_nn_dims *bias_dims,
+                                         const int32_t *bias,
+                                         const cmsis_nn_dims *output_dims,
+                                         q7_t *output)
+{
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_ch = output_dims->c;
+    const int32_t ch_mult = dw_conv_params->ch_mult;
+
+    /* Check input constraints output_ch == input_ch * ch_mult */
+    if (output_ch != input_ch * ch_mult)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    if (dw_conv_params->dilation.w < 1 || dw_conv_params->dilation.h < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_DSP)
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t pad_x = dw_conv_params->padding.w;
+    const int32_t pad_y = dw_conv_params->padding.h;
+    const int32_t stride_x = dw_conv_params->stride.w;
+    const int32_t stride_y = dw_conv_params->stride.h;
+    const int32_t dilation_x = dw_conv_params->dilation.w;
+    const int32_t dilation_y = dw_conv_params->dilation.h;
+    const int32_t *output_shift = quant_params->shift;
+    const int32_t *output_mult = quant_params->multiplier;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_offset = dw_conv_params->output_offset;
+    const int32_t input_offset = dw_conv_params->input_offset;
+    const int32_t output_activation_min = dw_conv_params->activation.min;
+    const int32_t output_activation_max = dw_conv_params->activation.max;
+    const int32_t kernel_size = kernel_x * kernel_y;
+
+    /* Without the extensions arm_depthwise_conv_s8() is used and reported */
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_DEPTHWISE_CONV_CH_MULT_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)output_dims->h * output_dims->w * output_dims->c * filter_dims->h * filter_dims->w);
+#endif
+#if defined(ARM_MATH_MVEI)
+    (void)bias_dims;
+    /* Generate four columns from the input tensor. Every input channel is repeated ch_mult times so that the columns
+       can be processed as a depthwise convolution with a channel multiplier of 1. */
+    q7_t *lhs_buffer = (q7_t *)ctx->buf;
+    q7_t *out = output;
+    int padded = 0;
+    int buffer_count = 0;
+
+    for (int i_out_y = 0, base_idx_y = -pad_y; i_out_y < output_y; base_idx_y += stride_y, i_out_y++)
+    {
+        for (int i_out_x = 0, base_idx_x = -pad_x; i_out_x < output_x; base_idx_x += stride_x, i_out_x++)
+        {
+            for (int i_ker_y = base_idx_y; i_ker_y < base_idx_y + kernel_y * dilation_y; i_ker_y += dilation_y)
+            {
+                for (int i_ker_x = base_idx_x; i_ker_x < base_idx_x + kernel_x * dilation_x; i_ker_x += dilation_x)
+                {
+                    if (i_ker_y < 0 || i_ker_y >= input_y || i_ker_x < 0 || i_ker_x >= input_x)
+                    {
+                        arm_memset_q7(lhs_buffer, (int8_t)-input_offset, (uint32_t)output_ch);
+                        padded = 1;
+                    }
+                    else
+                    {
+                        const q7_t *src = input + (i_ker_y * input_x + i_ker_x) * input_ch;
+                        for (int i_ch = 0; i_ch < input_ch; i_ch++)
+                        {
+                            arm_memset_q7(lhs_buffer + i_ch * ch_mult, src[i_ch], (uint32_t)ch_mult);
+                        }
+                    }
+                    lhs_buffer += output_ch;
+                }
+            }
+            buffer_count++;
+
+            if (buffer_count == 4)
+            {
+                lhs_buffer = (q7_t *)ctx->buf;
+                if (padded == 0)
+                {
+                    out = arm_nn_depthwise_conv_nt_t_s8(lhs_buffer,
+                                                        kernel,
+                                                        input_offset,
+                                                        output_ch,
+                                                        output_shift,
+                                                        output_mult,
+                                                        output_offset,
+                                                        output_activation_min,
+                                                        output_activation_max,
+                                                        kernel_size,
+                                                        bias,
+                                                        out);
+                }
+                else
+                {
+                    out = arm_nn_depthwise_conv_nt_t_padded_s8(lhs_buffer,
+                                                               kernel,
+                                                               input_offset,
+                                                               output_ch,
+                                                               output_shift,
+                                                               output_mult,
+                                                               output_offset,
+                                                               output_activation_min,
+                                                               output_activation_max,
+                                                               kernel_size,
+                                                               bias,
+                                                               out);
+                    padded = 0;
+                }
+                buffer_count = 0;
+            }
+        }
+    }
+
+    /* Handle left over buffers */
+    lhs_buffer = (q7_t *)ctx->buf;
+
+    for (int i_buf = 0; i_buf < buffer_count; i_buf++)
+    {
+        int32_t loop_count = (output_ch + 3) / 4;
+
+        int32_t num_ch_to_process = output_ch;
+        for (int i_loop_cnt = 0, offset = 0; i_loop_cnt < loop_count;
+             num_ch_to_process -= 4, offset += 4, i_loop_cnt++)
+        {
+            const int8_t *col_0 = lhs_buffer + (kernel_size * output_ch * i_buf) + offset;
+            const int8_t *row_0 = kernel + offset;
+            int32x4_t out_0 = vldrwq_s32(&bias[offset]);
+
+            for (int i_ker = 0; i_ker < kernel_size; i_ker++)
+            {
+                const int32x4_t ker_0 = vldrbq_s32(row_0);
+
+                int32x4_t ip_0 = vldrbq_s32(col_0);
+                ip_0 = vaddq_n_s32(ip_0, input_offset);
+                out_0 += vmulq_s32(ip_0, ker_0);
+
+                col_0 += output_ch;
+                row_0 += output_ch;
+            }
+
+            const int32x4_t mult = vldrwq_s32(&output_mult[offset]);
+            const int32x4_t shift = vldrwq_s32(&output_shift[offset]);
+
+            out_0 = arm_requantize_mve_32x4(out_0, mult, shift);
+            out_0 = vaddq_n_s32(out_0, output_offset);
+            out_0 = vmaxq_s32(out_0, vdupq_n_s32(output_activation_min));
+            out_0 = vminq_s32(out_0, vdupq_n_s32(output_activation_max));
+            mve_pred16_t p = vctp32q((uint32_t)num_ch_to_process);
+            vstrbq_p_s32(out, out_0, p);
+
+            out += 4;
+        }
+
+        const int tail_ch = output_ch & 0x3;
+        if (tail_ch != 0)
+        {
+            out -= (4 - tail_ch);
+        }
+    }
+
+    ARM_NN_PROFILE_END();
+
+#elif defined(ARM_MATH_DSP)
+    (void)bias_dims;
+    /* The column buffer is stored channel by channel, i.e. the kernel_size values of an input channel are
+       contiguous. Two neighbouring taps can then be read with one load and shared by the ch_mult output
+       channels of the input channel. */
+    q15_t *const col_buffer = (q15_t *)ctx->buf;
+
+    for (int i_out_y = 0; i_out_y < output_y; i_out_y++)
+    {
+        const int32_t base_idx_y = (i_out_y * stride_y) - pad_y;
+        for (int i_out_x = 0; i_out_x < output_x; i_out_x++)
+        {
+            const int32_t base_idx_x = (i_out_x * stride_x) - pad_x;
+
+            for (int i_ker_y = 0; i_ker_y < kernel_y; i_ker_y++)
+            {
+                const int32_t idx_y = base_idx_y + i_ker_y * dilation_y;
+
+                for (int i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                {
+                    const int32_t idx_x = base_idx_x + i_ker_x * dilation_x;
+                    q15_t *col = col_buffer + i_ker_y * kernel_x + i_ker_x;
+
+                    if (idx_y < 0 || idx_y >= input_y || idx_x < 0 || idx_x >= input_x)
+                    {
+                        for (int i_ch = 0; i_ch < input_ch; i_ch++)
+                        {
+                            col[i_ch * kernel_size] = 0;
+                        }
+                    }
+                    else
+                    {
+                        const q7_t *src = input + (idx_y * input_x + idx_x) * input_ch;
+                        for (int i_ch = 0; i_ch < input_ch; i_ch++)
+                        {
+                            col[i_ch * kernel_size] = (q15_t)(src[i_ch] + input_offset);
+                        }
+                    }
+                }
+            }
+
+            int32_t i_out_ch = 0;
+            for (; i_out_ch <= (output_ch - 4); i_out_ch += 4)
+            {
+                const q15_t *col_0 = col_buffer + ((i_out_ch + 0) / ch_mult) * kernel_size;
+                const q15_t *col_1 = col_buffer + ((i_out_ch + 1) / ch_mult) * kernel_size;
+                const q15_t *col_2 = col_buffer + ((i_out_ch + 2) / ch_mult) * kernel_size;
+                const q15_t *col_3 = col_buffer + ((i_out_ch + 3) / ch_mult) * kernel_size;
+                const q7_t *row_pos = kernel + i_out_ch;
+
+                q31_t sum_0 = bias[i_out_ch + 0];
+                q31_t sum_1 = bias[i_out_ch + 1];
+                q31_t sum_2 = bias[i_out_ch + 2];
+                q31_t sum_3 = bias[i_out_ch + 3];
+
+                int32_t col_count = kernel_size / 2;
+                while (col_count)
+                {
+                    /* Read the weights of 4 output channels for two taps and pair them up per output channel */
+                    const q31_t ker_a = arm_nn_read_q7x4(row_pos);
+                    const q31_t ker_b = arm_nn_read_q7x4(row_pos + output_ch);
+                    row_pos += output_ch << 1;
+
+                    const q31_t ker_a_02 = __SXTB16(ker_a);
+                    const q31_t ker_a_13 = __SXTB16(__ROR(ker_a, 8));
+                    const q31_t ker_b_02 = __SXTB16(ker_b);
+                    const q31_t ker_b_13 = __SXTB16(__ROR(ker_b, 8));
+
+                    sum_0 = __SMLAD(arm_nn_read_q15x2_ia(&col_0), __PKHBT(ker_a_02, ker_b_02, 16), sum_0);
+                    sum_1 = __SMLAD(arm_nn_read_q15x2_ia(&col_1), __PKHBT(ker_a_13, ker_b_13, 16), sum_1);
+                    sum_2 = __SMLAD(arm_nn_read_q15x2_ia(&col_2), __PKHTB(ker_b_02, ker_a_02, 16), sum_2);
+                    sum_3 = __SMLAD(arm_nn_read_q15x2_ia(&col_3), __PKHTB(ker_b_13, ker_a_13, 16), sum_3);
+
+                    col_count--;
+                }
+
+                if (kernel_size & 0x1)
+                {
+                    sum_0 += row_pos[0] * *col_0;
+                    sum_1 += row_pos[1] * *col_1;
+                    sum_2 += row_pos[2] * *col_2;
+                    sum_3 += row_pos[3] * *col_3;
+                }
+
+                sum_0 = arm_nn_requantize(sum_0, output_mult[i_out_ch + 0], output_shift[i_out_ch + 0]);
+                sum_1 = arm_nn_requantize(sum_1, output_mult[i_out_ch + 1], output_shift[i_out_ch + 1]);
+                sum_2 = arm_nn_requantize(sum_2, output_mult[i_out_ch + 2], output_shift[i_out_ch + 2]);
+                sum_3 = arm_nn_requantize(sum_3, output_mult[i_out_ch + 3], output_shift[i_out_ch + 3]);
+
+                sum_0 += output_offset;
+                sum_1 += output_offset;
+                sum_2 += output_offset;
+                sum_3 += output_offset;
+
+                *output++ = (q7_t)MIN(MAX(sum_0, output_activation_min), output_activation_max);
+                *output++ = (q7_t)MIN(MAX(sum_1, output_activation_min), output_activation_max);
+                *output++ = (q7_t)MIN(MAX(sum_2, output_activation_min), output_activation_max);
+                *output++ = (q7_t)MIN(MAX(sum_3, output_activation_min), output_activation_max);
+            }
+
+            for (; i_out_ch < output_ch; i_out_ch++)
+            {
+                const q15_t *col_pos = col_buffer + (i_out_ch / ch_mult) * kernel_size;
+                const q7_t *row_pos = kernel + i_out_ch;
+                q31_t sum = bias[i_out_ch];
+
+                for (int i = 0; i < kernel_size; i++)
+                {
+                    sum += row_pos[i * output_ch] * col_pos[i];
+                }
+                sum = arm_nn_requantize(sum, output_mult[i_out_ch], output_shift[i_out_ch]);
+                sum += output_offset;
+                sum = MAX(sum, output_activation_min);
+                sum = MIN(sum, output_activation_max);
+                *output++ = (q7_t)sum;
+            }
+        }
+    }
+
+    ARM_NN_PROFILE_END();
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+    return arm_depthwise_conv_s8(ctx,
+                                 dw_conv_params,
+                                 quant_params,
+                                 input_dims,
+                                 input,
+                                 filter_dims,
+                                 kernel,
+                                 bias_dims,
+                                 bias,
+                                 output_dims,
+                                 output);
+#endif /* ARM_MATH_MVEI | ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_depthwise_conv_ch_mult_s8_get_buffer_size(const cmsis_nn_dims *input_dims,
+                                                      const cmsis_nn_dims *filter_dims,
+                                                      const cmsis_nn_dims *output_dims)
+{
+#if defined(ARM_MATH_MVEI)
+    (void)input_dims;
+    /* The + 4 accounts for out of bounds read of the lhs buffers in the *_nt_t_* functions.  */
+    return (4 * output_dims->c * filter_dims->w * filter_dims->h) * (int32_t)sizeof(int8_t) + 4;
+#elif defined(ARM_MATH_DSP)
+    (void)output_dims;
+    return (input_dims->c * filter_dims->w * filter_dims->h) * (int32_t)sizeof(int16_t);
+#else
+    (void)input_dims;
+    (void)filter_dims;
+    (void)output_dims;
+    return 0;
+#endif
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -21,8 +21,8 @@
  * Title:        arm_depthwise_conv_s8.c
  * Description:	 s8 version of depthwise convolution.
  *
- * $Date:        May 14, 2020
- * $Revision:    V.2.0.0
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.2.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -53,6 +53,8 @@ static void depthwise_conv_s8_mult_4(const int8_t *input,
                                      const int32_t pad_y,
                                      const int32_t stride_x,
                                      const int32_t stride_y,
+                                     const int32_t dilation_x,
+                                     const int32_t dilation_y,
                                      const int32_t *bias,
                                      int8_t *output,
                                      const int32_t *output_shift,
@@ -62,13 +64,22 @@ static void depthwise_conv_s8_mult_4(const int8_t *input,
                                      const int32_t output_offset,
                                      const int32_t input_offset,
                                      const int32_t output_activation_min,
-                                     const int32_t output_activation_max)
+                                     const int32_t output_activation_max,
+                                     const int32_t output_ch_stride)
 {
     for (int32_t in_h = -pad_y, out_h = 0, out_idx = 0; out_h < output_y; in_h += stride_y, ++out_h)
     {
-        for (int32_t in_w = -pad_x, out_w = 0, ker_h_start = MAX(0, -in_h); out_w < output_x; in_w += stride_x, ++out_w)
+        /* Condition for kernel start dimension: (in_h + ker_h_start * dilation_y) >= 0 */
+        const int32_t ker_h_start = in_h < 0 ? (-in_h + dilation_y - 1) / dilation_y : 0;
+        /* Condition for kernel end dimension: (in_h + (ker_h_end - 1) * dilation_y) < input_y */
+        const int32_t ker_h_end = MIN(kernel_y, (input_y - in_h + dilation_y - 1) / dilation_y);
+
+        for (int32_t in_w = -pad_x, out_w = 0; out_w < output_x; in_w += stride_x, ++out_w)
         {
-            for (int32_t in_ch = 0, out_ch = 0, ker_w_start = MAX(0, -in_w); out_ch < output_ch; ++in_ch, out_ch += ch_mult)
+            const int32_t ker_w_start = in_w < 0 ? (-in_w + dilation_x - 1) / dilation_x : 0;
+            const int32_t ker_w_end = MIN(kernel_x, (input_x - in_w + dilation_x - 1) / dilation_x);
+
+            for (int32_t in_ch = 0, out_ch = 0; out_ch < output_ch; ++in_ch, out_ch += ch_mult)
             {
                 for (int mult_tile = 0; mult_tile < ch_mult; mult_tile += 4)
                 {
@@ -79,14 +90,14 @@ static void depthwise_conv_s8_mult_4(const int8_t *input,
                     out_buff[2] = bias[out_ch + 2 + mult_tile];
                     out_buff[3] = bias[out_ch + 3 + mult_tile];
 
-                    for (int32_t ker_h = ker_h_start; ker_h < MIN(kernel_y, input_y - in_h); ++ker_h)
+                    for (int32_t ker_h = ker_h_start; ker_h < ker_h_end; ++ker_h)
                     {
                         int32_t ker_idx = ker_h * (output_ch * kernel_x) + ker_w_start * output_ch + out_ch;
-                        int32_t in_idx = (in_h + ker_h) * (input_ch * input_x) + in_w * input_ch + in_ch;
+                        int32_t in_idx = (in_h + ker_h * dilation_y) * (input_ch * input_x) + in_w * input_ch + in_ch;
 
-                        for (int32_t ker_w = ker_w_start; ker_w < MIN(kernel_x, input_x - in_w); ++ker_w, ker_idx += output_ch)
+                        for (int32_t ker_w = ker_w_start; ker_w < ker_w_end; ++ker_w, ker_idx += output_ch)
                         {
-                            int32_t in_val = input[in_idx + ker_w * input_ch] + input_offset;
+                            int32_t in_val = input[in_idx + ker_w * dilation_x * input_ch] + input_offset;
                             out_buff[0] += in_val * kernel[ker_idx + 0 + mult_tile];
                             out_buff[1] += in_val * kernel[ker_idx + 1 + mult_tile];
                             out_buff[2] += in_val * kernel[ker_idx + 2 + mult_tile];
@@ -94,15 +105,14 @@ static void depthwise_conv_s8_mult_4(const int8_t *input,
                         }
                     }
 #if defined(ARM_MATH_MVEI)
-                    (void)out_idx;
                     int32x4_t res = vldrwq_s32(out_buff);
                     res = arm_requantize_mve_32x4(res, vldrwq_s32(&output_mult[out_ch + mult_tile]), vldrwq_s32(&output_shift[out_ch + mult_tile]));
                     res = vaddq_n_s32(res, output_offset);
 
                     res = vmaxq_s32(res, vdupq_n_s32(output_activation_min));
                     res = vminq_s32(res, vdupq_n_s32(output_activation_max));
-                    vstrbq_s32(output, res);
-                    output += 4;
+                    vstrbq_s32(&output[out_idx], res);
+                    out_idx += 4;
 #else
                     out_buff[0] = arm_nn_requantize(out_buff[0], output_mult[out_ch + 0 + mult_tile], output_shift[out_ch + 0 + mult_tile]);
                     out_buff[1] = arm_nn_requantize(out_buff[1], output_mult[out_ch + 1 + mult_tile], output_shift[out_ch + 1 + mult_tile]);
@@ -127,6 +137,7 @@ static void depthwise_conv_s8_mult_4(const int8_t *input,
 #endif
                 }
             }
+            out_idx += output_ch_stride - output_ch;
         }
     }
 }
@@ -144,6 +155,8 @@ static void depthwise_conv_s8_generic(const q7_t *input,
                                       const uint16_t pad_y,
                                       const uint16_t stride_x,
                                       const uint16_t stride_y,
+                                      const uint16_t dilation_x,
+                                      const uint16_t dilation_y,
                                       const int32_t *bias,
                                       q7_t *output,
                                       const int32_t *output_shift,
@@ -153,36 +166,35 @@ static void depthwise_conv_s8_generic(const q7_t *input,
                                       const int32_t output_offset,
                                       const int32_t input_offset,
                                       const int32_t output_activation_min,
-                                      const int32_t output_activation_max)
+                                      const int32_t output_activation_max,
+                                      const int32_t output_ch_stride)
 {
-    (void)output_ch;
     int i_out = 0;
     for (int i_out_y = 0; i_out_y < output_y; i_out_y++)
     {
         const int16_t base_idx_y = (i_out_y * stride_y) - pad_y;
+        /* Condition for kernel start dimension: (base_idx_y + ker_y_start * dilation_y) >= 0 */
+        const int ker_y_start = base_idx_y < 0 ? (-base_idx_y + dilation_y - 1) / dilation_y : 0;
+        /* Condition for kernel end dimension: (base_idx_y + (ker_y_end - 1) * dilation_y) < input_y */
+        const int ker_y_end = MIN(kernel_y, (input_y - base_idx_y + dilation_y - 1) / dilation_y);
         for (int i_out_x = 0; i_out_x < output_x; i_out_x++)
         {
             const int16_t base_idx_x = (i_out_x * stride_x) - pad_x;
+            const int ker_x_start = base_idx_x < 0 ? (-base_idx_x + dilation_x - 1) / dilation_x : 0;
+            const int ker_x_end = MIN(kernel_x, (input_x - base_idx_x + dilation_x - 1) / dilation_x);
             for (int i_input_ch = 0; i_input_ch < input_ch; i_input_ch++)
             {
                 for (int i_ch_mult = 0; i_ch_mult < ch_mult; i_ch_mult++)
                 {
                     const int idx_out_ch = i_ch_mult + i_input_ch * ch_mult;
-                    int32_t acc_0;
-                    /* Condition for kernel start dimension: (base_idx_<x,y> + ker_<x,y>_start) >= 0 */
-                    const int ker_y_start = MAX(0, -base_idx_y);
-                    const int ker_x_start = MAX(0, -base_idx_x);
-                    /* Condition for kernel end dimension: (base_idx_<x,y> + ker_<x,y>_end) < input_<x,y> */
-                    const int ker_y_end = MIN(kernel_y, input_y - base_idx_y);
-                    const int ker_x_end = MIN(kernel_x, input_x - base_idx_x);
-                    acc_0 = bias[idx_out_ch];
+                    int32_t acc_0 = bias[idx_out_ch];
 
                     for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
                     {
-                        const int32_t idx_y = base_idx_y + i_ker_y;
+                        const int32_t idx_y = base_idx_y + i_ker_y * dilation_y;
                         for (int i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
                         {
-                            const int32_t idx_x = base_idx_x + i_ker_x;
+                            const int32_t idx_x = base_idx_x + i_ker_x * dilation_x;
                             int32_t idx_0 = (idx_y * input_x + idx_x) * input_ch + i_input_ch;
                             int32_t ker_idx_0 = (i_ker_y * kernel_x + i_ker_x) * (input_ch * ch_mult) + idx_out_ch;
 
@@ -199,6 +211,7 @@ static void depthwise_conv_s8_generic(const q7_t *input,
                     output[i_out++] = acc_0;
                 }
             }
+            i_out += output_ch_stride - output_ch;
         }
     }
 }
@@ -207,7 +220,7 @@ static void depthwise_conv_s8_generic(const q7_t *input,
    *  Basic s8 depthwise convolution function.
    *
    *  Refer header file for details.
-   *  Optimization using DSP extension is not available for the generic case where channel multiplier is > 1.
+   *  Use arm_depthwise_conv_ch_mult_s8() for an optimized version when channel multiplier is > 1.
    *
    */
 arm_status arm_depthwise_conv_s8(const cmsis_nn_context *ctx,
@@ -222,24 +235,67 @@ arm_status arm_depthwise_conv_s8(const cmsis_nn_context *ctx,
                                  const cmsis_nn_dims *output_dims,
                                  q7_t *output)
 {
-    (void)dw_conv_params->dilation;
+    return arm_depthwise_conv_s8_strided_output(ctx,
+                                                dw_conv_params,
+                                                quant_params,
+                                                input_dims,
+                                                input,
+                                                filter_dims,
+                                                kernel,
+                                                bias_dims,
+                                                bias,
+                                                output_dims,
+                                                output,
+                                                output_dims->c);
+}
+
+/*
+   *  Basic s8 depthwise convolution function writing to a slice of the channels of a larger output tensor.
+   *
+   *  Refer header file for details.
+   *
+   */
+arm_status arm_depthwise_conv_s8_strided_output(const cmsis_nn_context *ctx,
+                                                const cmsis_nn_dw_conv_params *dw_conv_params,
+                                                const cmsis_nn_per_channel_quant_params *quant_params,
+                                                const cmsis_nn_dims *input_dims,
+                                                const q7_t *input,
+                                                const cmsis_nn_dims *filter_dims,
+                                                const q7_t *kernel,
+                                                const cmsis_nn_dims *bias_dims,
+                                                const int32_t *bias,
+                                                const cmsis_nn_dims *output_dims,
+                                                q7_t *output,
+                                                const int32_t output_ch_stride)
+{
     (void)ctx;
+    (void)bias_dims;
+
+    if (output_ch_stride < output_dims->c || dw_conv_params->dilation.w < 1 || dw_conv_params->dilation.h < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_DEPTHWISE_CONV_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)output_dims->h * output_dims->w * output_dims->c * filter_dims->h * filter_dims->w);
 
     if (dw_conv_params->ch_mult % 4 == 0)
     {
         depthwise_conv_s8_mult_4(input, input_dims->w, input_dims->h, input_dims->c, kernel, output_dims->c, dw_conv_params->ch_mult, filter_dims->w, filter_dims->h,
-                                 dw_conv_params->padding.w, dw_conv_params->padding.h, dw_conv_params->stride.w, dw_conv_params->stride.h, bias, output,
+                                 dw_conv_params->padding.w, dw_conv_params->padding.h, dw_conv_params->stride.w, dw_conv_params->stride.h, dw_conv_params->dilation.w, dw_conv_params->dilation.h, bias, output,
                                  quant_params->shift, quant_params->multiplier, output_dims->w, output_dims->h, dw_conv_params->output_offset,
-                                 dw_conv_params->input_offset, dw_conv_params->activation.min, dw_conv_params->activation.max);
+                                 dw_conv_params->input_offset, dw_conv_params->activation.min, dw_conv_params->activation.max, output_ch_stride);
     }
     else
     {
         depthwise_conv_s8_generic(input, input_dims->w, input_dims->h, input_dims->c, kernel, output_dims->c, dw_conv_params->ch_mult, filter_dims->w, filter_dims->h,
-                                  dw_conv_params->padding.w, dw_conv_params->padding.h, dw_conv_params->stride.w, dw_conv_params->stride.h, bias, output,
+                                  dw_conv_params->padding.w, dw_conv_params->padding.h, dw_conv_params->stride.w, dw_conv_params->stride.h, dw_conv_params->dilation.w, dw_conv_params->dilation.h, bias, output,
                                   quant_params->shift, quant_params->multiplier, output_dims->w, output_dims->h, dw_conv_params->output_offset,
-                                  dw_conv_params->input_offset, dw_conv_params->activation.min, dw_conv_params->activation.max);
+                                  dw_conv_params->input_offset, dw_conv_params->activation.min, dw_conv_params->activation.max, output_ch_stride);
     }
 
+    ARM_NN_PROFILE_END();
+
     /* Return to application */
     return ARM_MATH_SUCCESS;
 }
@@ -22,8 +22,8 @@
  * Description:  Optimized s8 depthwise separable convolution function for
  *               channel multiplier of 1.
  *
- * $Date:        May 29, 2020
- * $Revision:    V.2.0.1
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -86,6 +86,20 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
     {
         return ARM_MATH_SIZE_MISMATCH;
     }
+
+    if (dw_conv_params->dilation.w < 1 || dw_conv_params->dilation.h < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_DSP)
+    const int32_t dilation_x = dw_conv_params->dilation.w;
+    const int32_t dilation_y = dw_conv_params->dilation.h;
+
+    /* Without the extensions arm_depthwise_conv_s8() is used and reported */
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_DEPTHWISE_CONV_S8_OPT, input_dims, filter_dims, output_dims,
+                         (int64_t)output_dims->h * output_dims->w * output_dims->c * filter_dims->h * filter_dims->w);
+#endif
 #ifdef ARM_MATH_MVEI
     (void)bias_dims;
     /* Generate two columns from the input tensor */
@@ -100,9 +114,9 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
     {
         for (int i_out_x = 0, base_idx_x = -pad_x; i_out_x < output_x; base_idx_x += stride_x, i_out_x++)
         {
-            for (int i_ker_y = base_idx_y; i_ker_y < base_idx_y + kernel_y; i_ker_y++)
+            for (int i_ker_y = base_idx_y; i_ker_y < base_idx_y + kernel_y * dilation_y; i_ker_y += dilation_y)
             {
-                for (int i_ker_x = base_idx_x; i_ker_x < base_idx_x + kernel_x; i_ker_x++)
+                for (int i_ker_x = base_idx_x; i_ker_x < base_idx_x + kernel_x * dilation_x; i_ker_x += dilation_x)
                 {
                     if (i_ker_y < 0 || i_ker_y >= input_y || i_ker_x < 0 || i_ker_x >= input_x)
                     {
@@ -204,6 +218,8 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
         }
     }
 
+    ARM_NN_PROFILE_END();
+
 #elif defined(ARM_MATH_DSP)
     (void)bias_dims;
     /* Run the following code in cores using DSP extension */
@@ -224,9 +240,9 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
 
             /* Out of bounds is only considered for the y axis as it provides a contiguous zero'ing opportunity than along
                the x axis */
-            const int ker_y_start = MAX(0, -base_idx_y);
-            /* Condition for kernel end dimension: (base_idx_y + ker_y_end) < input_y */
-            const int ker_y_end = MIN(kernel_y, input_y - base_idx_y);
+            const int ker_y_start = base_idx_y < 0 ? MIN(kernel_y, (-base_idx_y + dilation_y - 1) / dilation_y) : 0;
+            /* Condition for kernel end dimension: (base_idx_y + (ker_y_end - 1) * dilation_y) < input_y */
+            const int ker_y_end = MIN(kernel_y, (input_y - base_idx_y + dilation_y - 1) / dilation_y);
 
             int32_t index = 0;
             if (ker_y_start != 0)
@@ -237,11 +253,11 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
 
             for (int i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
             {
-                const int32_t idx_y = base_idx_y + i_ker_y;
+                const int32_t idx_y = base_idx_y + i_ker_y * dilation_y;
 
                 for (int i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
                 {
-                    const int32_t idx_x = base_idx_x + i_ker_x;
+                    const int32_t idx_x = base_idx_x + i_ker_x * dilation_x;
                     if (idx_x < 0 || idx_x >= input_x)
                     {
                         memset(&col_buffer[index], 0, input_ch * sizeof(q15_t));
@@ -386,6 +402,8 @@ arm_status arm_depthwise_conv_s8_opt(const cmsis_nn_context *ctx,
         }
     }
 
+    ARM_NN_PROFILE_END();
+
 #else
     /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
     return arm_depthwise_conv_s8(ctx,
@@ -22,8 +22,8 @@
  * Description:  Wrapper API to select appropriate depthwise conv API based
  *               on dimensions.
  *
- * $Date:        May 29, 2020
- * $Revision:    V.1.0.1
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -60,10 +60,16 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
                                          q7_t *output)
 {
     arm_status status = ARM_MATH_SUCCESS;
+    if (dw_conv_params->dilation.w < 1 || dw_conv_params->dilation.h < 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
     if (1 == dw_conv_params->ch_mult)
     {
 #if !defined(ARM_MATH_MVEI)
-        if ((filter_dims->w == 3) && (filter_dims->h == 3) && (dw_conv_params->padding.h <= 1))
+        if ((filter_dims->w == 3) && (filter_dims->h == 3) && (dw_conv_params->padding.h <= 1) &&
+            (dw_conv_params->dilation.w == 1) && (dw_conv_params->dilation.h == 1))
         {
             status = arm_depthwise_conv_3x3_s8(ctx,
                                                dw_conv_params,
@@ -95,17 +101,17 @@ arm_status arm_depthwise_conv_wrapper_s8(const cmsis_nn_context *ctx,
     }
     else
     {
-        status = arm_depthwise_conv_s8(ctx,
-                                       dw_conv_params,
-                                       quant_params,
-                                       input_dims,
-                                       input,
-                                       filter_dims,
-                                       filter,
-                                       bias_dims,
-                                       bias,
-                                       output_dims,
-                                       output);
+        status = arm_depthwise_conv_ch_mult_s8(ctx,
+                                               dw_conv_params,
+                                               quant_params,
+                                               input_dims,
+                                               input,
+                                               filter_dims,
+                                               filter,
+                                               bias_dims,
+                                               bias,
+                                               output_dims,
+                                               output);
     }
 
     /* Return to application */
@@ -124,6 +130,10 @@ int32_t arm_depthwise_conv_wrapper_s8_get_buffer_size(const cmsis_nn_dw_conv_par
     {
         size = arm_depthwise_conv_s8_opt_get_buffer_size(input_dims, filter_dims);
     }
+    else
+    {
+        size = arm_depthwise_conv_ch_mult_s8_get_buffer_size(input_dims, filter_dims, output_dims);
+    }
 
     return size;
 }
@@ -21,8 +21,8 @@
  * Title:        arm_nn_mat_mult_kernel_s8_s16.c
  * Description:  Matrix-multiplication function for convolution
  *
- * $Date:        May 29, 2020
- * $Revision:    V.1.0.2
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.1.0
  *
  * Target Processor:  Cortex-M cores
  * -------------------------------------------------------------------- */
@@ -47,14 +47,15 @@ q7_t *arm_nn_mat_mult_kernel_s8_s16(const q7_t *input_a,
                                     const int16_t activation_max,
                                     const uint16_t num_col_a,
                                     const int32_t *const output_bias,
-                                    q7_t *out_0)
+                                    q7_t *out_0,
+                                    const int32_t output_ch_stride)
 {
 #if defined(ARM_MATH_MVEI)
 #define ROW_PER_LOOP (4)
 #define COL_PER_LOOP (8)
 
     const q7_t *ip_a0_s8 = input_a;
-    q7_t *out_1 = out_0 + output_ch;
+    q7_t *out_1 = out_0 + output_ch_stride;
 
     const int32_t *bias = output_bias;
 
@@ -214,11 +215,11 @@ q7_t *arm_nn_mat_mult_kernel_s8_s16(const q7_t *input_a,
         out_1 += row_count;
     }
 
-    return out_1;
+    return out_1 + (output_ch_stride - output_ch);
 
 #elif defined(ARM_MATH_DSP)
     /* set up the second output pointers */
-    q7_t *out_1 = out_0 + output_ch;
+    q7_t *out_1 = out_0 + output_ch_stride;
     const int32_t *bias = output_bias;
 
     uint16_t row_count = output_ch / 2;
@@ -369,7 +370,7 @@ q7_t *arm_nn_mat_mult_kernel_s8_s16(const q7_t *input_a,
         out_shift++;
     }
 
-    out_0 += output_ch;
+    out_0 += 2 * output_ch_stride - output_ch;
 
     /* return the new output pointer with offset */
     return out_0;
@@ -385,6 +386,7 @@ q7_t *arm_nn_mat_mult_kernel_s8_s16(const q7_t *input_a,
     (void)num_col_a;
     (void)output_bias;
     (void)out_0;
+    (void)output_ch_stride;
     /* To be completed */
     return NULL;
 #endif
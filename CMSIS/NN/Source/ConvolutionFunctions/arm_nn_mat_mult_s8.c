@@ -21,8 +21,8 @@
  * Title:        arm_nn_mat_mult_s8.c
  * Description:  General Matrix-multiplication function
  *
- * $Date:        May 29, 2020
- * $Revision:    V.2.0.3
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M cores
  * -------------------------------------------------------------------- */
@@ -50,7 +50,8 @@ q7_t *arm_nn_mat_mult_s8(const q7_t *input_row,
                          const int16_t activation_max,
                          const uint16_t row_len,
                          const int32_t *const bias,
-                         q7_t *out)
+                         q7_t *out,
+                         const int32_t output_ch_stride)
 {
 #if defined(ARM_MATH_MVEI)
     (void)row_offset;
@@ -109,10 +110,10 @@ q7_t *arm_nn_mat_mult_s8(const q7_t *input_row,
             res = vmaxq_s32(res, vdupq_n_s32(activation_min));
             res = vminq_s32(res, vdupq_n_s32(activation_max));
 
-            const uint32x4_t scatter_offset = {0, output_ch, output_ch * 2, output_ch * 3};
+            const uint32x4_t scatter_offset = {0, output_ch_stride, output_ch_stride * 2, output_ch_stride * 3};
             vstrbq_scatter_offset_s32(&out[i_out_ch], scatter_offset, res);
         }
-        out += 4 * output_ch;
+        out += 4 * output_ch_stride;
     }
     else
     {
@@ -148,7 +149,7 @@ q7_t *arm_nn_mat_mult_s8(const q7_t *input_row,
                 acc_0 = MIN(acc_0, activation_max);
                 out[i_out_ch] = (q7_t)acc_0;
             }
-            out += output_ch;
+            out += output_ch_stride;
         }
     }
     return out;
@@ -168,6 +169,7 @@ q7_t *arm_nn_mat_mult_s8(const q7_t *input_row,
     (void)row_len;
     (void)bias;
     (void)out;
+    (void)output_ch_stride;
     return NULL;
 #endif
 }
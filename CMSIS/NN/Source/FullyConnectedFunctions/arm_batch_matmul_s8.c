@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_batch_matmul_s8
+ * Description:  Batch matrix multiplication of two s8 activation tensors
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+static void transpose_s8(const q7_t *src, const int32_t rows, const int32_t cols, q7_t *dst)
+{
+    for (int32_t i = 0; i < cols; i++)
+    {
+        const q7_t *src_ptr = &src[i];
+        for (int32_t j = 0; j < rows; j++)
+        {
+            *dst++ = *src_ptr;
+            src_ptr += cols;
+        }
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/*
+ * S8 batch matrix multiplication
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_batch_matmul_s8(const cmsis_nn_context *ctx,
+                               const cmsis_nn_bmm_params *bmm_params,
+                               const cmsis_nn_per_tensor_quant_params *quant_params,
+                               const cmsis_nn_dims *input_lhs_dims,
+                               const q7_t *input_lhs,
+                               const cmsis_nn_dims *input_rhs_dims,
+                               const q7_t *input_rhs,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output)
+{
+    const cmsis_nn_fc_params *fc_params = &bmm_params->fc_params;
+
+    // Dimensions of the stored matrices
+    const int32_t lhs_rows = input_lhs_dims->w;
+    const int32_t lhs_cols = input_lhs_dims->c;
+    const int32_t rhs_rows = input_rhs_dims->w;
+    const int32_t rhs_cols = input_rhs_dims->c;
+
+    // Output is [m x n] with an accumulation depth of k
+    const int32_t m = bmm_params->adj_x ? lhs_cols : lhs_rows;
+    const int32_t k = bmm_params->adj_x ? lhs_rows : lhs_cols;
+    const int32_t n = bmm_params->adj_y ? rhs_rows : rhs_cols;
+
+    if (ctx->buf == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    // arm_nn_mat_mult_nt_t_s8() takes per-channel parameters and a bias, so these are broadcast into the
+    // scratch buffer followed by the transposed operands if needed.
+    int32_t *bias = (int32_t *)ctx->buf;
+    int32_t *multipliers = bias + n;
+    int32_t *shifts = multipliers + n;
+    q7_t *lhs_buf = (q7_t *)(shifts + n);
+    q7_t *rhs_buf = bmm_params->adj_x ? lhs_buf + m * k : lhs_buf;
+
+    for (int32_t i = 0; i < n; i++)
+    {
+        bias[i] = 0;
+        multipliers[i] = quant_params->multiplier;
+        shifts[i] = quant_params->shift;
+    }
+
+    const int32_t lhs_offset = fc_params->input_offset;
+    const int32_t rhs_offset = fc_params->filter_offset;
+    const int32_t lhs_batch_size = lhs_rows * lhs_cols;
+    const int32_t rhs_batch_size = rhs_rows * rhs_cols;
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_BATCH_MATMUL_S8, input_lhs_dims, input_rhs_dims, output_dims,
+                         (int64_t)output_dims->n * output_dims->h * m * n * k);
+
+    for (int32_t b_n = 0; b_n < output_dims->n; b_n++)
+    {
+        for (int32_t b_h = 0; b_h < output_dims->h; b_h++)
+        {
+            // Batch dimensions of size one are broadcast
+            const int32_t lhs_batch = (b_n % input_lhs_dims->n) * input_lhs_dims->h + (b_h % input_lhs_dims->h);
+            const int32_t rhs_batch = (b_n % input_rhs_dims->n) * input_rhs_dims->h + (b_h % input_rhs_dims->h);
+            const q7_t *lhs = input_lhs + lhs_batch * lhs_batch_size;
+            const q7_t *rhs = input_rhs + rhs_batch * rhs_batch_size;
+
+            if (bmm_params->adj_x)
+            {
+                transpose_s8(lhs, lhs_rows, lhs_cols, lhs_buf);
+                lhs = lhs_buf;
+            }
+            if (!bmm_params->adj_y)
+            {
+                transpose_s8(rhs, rhs_rows, rhs_cols, rhs_buf);
+                rhs = rhs_buf;
+            }
+
+            if (rhs_offset == 0)
+            {
+                arm_nn_mat_mult_nt_t_s8(lhs,
+                                        rhs,
+                                        bias,
+                                        output,
+                                        multipliers,
+                                        shifts,
+                                        m,
+                                        n,
+                                        k,
+                                        lhs_offset,
+                                        fc_params->output_offset,
+                                        fc_params->activation.min,
+                                        fc_params->activation.max);
+            }
+            else
+            {
+                // The contribution of the RHS offset depends on the sum of the LHS row, which is constant
+                // along an output row. It is therefore passed as the bias of a row by row multiplication.
+                for (int32_t row = 0; row < m; row++)
+                {
+                    int32_t row_sum = lhs_offset * k;
+                    for (int32_t i = 0; i < k; i++)
+                    {
+                        row_sum += lhs[row * k + i];
+                    }
+                    for (int32_t i = 0; i < n; i++)
+                    {
+                        bias[i] = row_sum * rhs_offset;
+                    }
+
+                    arm_nn_mat_mult_nt_t_s8(&lhs[row * k],
+                                            rhs,
+                                            bias,
+                                            &output[row * n],
+                                            multipliers,
+                                            shifts,
+                                            1,
+                                            n,
+                                            k,
+                                            lhs_offset,
+                                            fc_params->output_offset,
+                                            fc_params->activation.min,
+                                            fc_params->activation.max);
+                }
+            }
+            output += m * n;
+        }
+    }
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_batch_matmul_s8_get_buffer_size(const cmsis_nn_bmm_params *bmm_params,
+                                            const cmsis_nn_dims *input_lhs_dims,
+                                            const cmsis_nn_dims *input_rhs_dims)
+{
+    const int32_t n = bmm_params->adj_y ? input_rhs_dims->w : input_rhs_dims->c;
+    int32_t size = 3 * n * (int32_t)sizeof(int32_t);
+
+    if (bmm_params->adj_x)
+    {
+        size += input_lhs_dims->w * input_lhs_dims->c;
+    }
+    if (!bmm_params->adj_y)
+    {
+        size += input_rhs_dims->w * input_rhs_dims->c;
+    }
+    return size;
+}
+
+/**
+ * @} end of FC group
+ */
@@ -21,8 +21,8 @@
  * Title:        arm_fully_connected_s8
  * Description:  Fully connected function compatible with TF Lite.
  *
- * $Date:        May 2, 2020
- * $Revision:    V.2.0.0
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M and Cortex-A cores
  *
@@ -59,10 +59,53 @@ arm_fully_connected_s8(const cmsis_nn_context *ctx,
                        const int32_t *bias,
                        const cmsis_nn_dims *output_dims,
                        q7_t *output)
+{
+    return arm_fully_connected_s8_strided_output(ctx,
+                                                 fc_params,
+                                                 quant_params,
+                                                 input_dims,
+                                                 input,
+                                                 filter_dims,
+                                                 kernel,
+                                                 bias_dims,
+                                                 bias,
+                                                 output_dims,
+                                                 output,
+                                                 output_dims->c);
+}
+
+/*
+   * S8 fully-connected layer function writing to a slice of the channels of a larger output tensor.
+   *
+   * Refer header file for details.
+   *
+   */
+
+arm_status
+arm_fully_connected_s8_strided_output(const cmsis_nn_context *ctx,
+                                      const cmsis_nn_fc_params *fc_params,
+                                      const cmsis_nn_per_tensor_quant_params *quant_params,
+                                      const cmsis_nn_dims *input_dims,
+                                      const q7_t *input,
+                                      const cmsis_nn_dims *filter_dims,
+                                      const q7_t *kernel,
+                                      const cmsis_nn_dims *bias_dims,
+                                      const int32_t *bias,
+                                      const cmsis_nn_dims *output_dims,
+                                      q7_t *output,
+                                      const int32_t output_ch_stride)
 {
     (void)bias_dims;
     (void)ctx;
+
+    if (output_ch_stride < output_dims->c)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
     int32_t batch_cnt = input_dims->n;
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_FULLY_CONNECTED_S8, input_dims, filter_dims, output_dims,
+                         (int64_t)input_dims->n * filter_dims->n * output_dims->c);
 
     while (batch_cnt)
     {
@@ -80,9 +123,10 @@ arm_fully_connected_s8(const cmsis_nn_context *ctx,
                                  fc_params->activation.min,
                                  fc_params->activation.max);
         input += filter_dims->n;
-        output += output_dims->c;
+        output += output_ch_stride;
         batch_cnt--;
     }
+    ARM_NN_PROFILE_END();
     return (ARM_MATH_SUCCESS);
 }
 
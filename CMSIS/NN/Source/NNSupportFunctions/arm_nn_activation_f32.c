@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_activation_f32
+ * Description:  Float32 activation functions for the computation of the look-up tables
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * Float32 activation function
+ *
+ * Refer header file for details.
+ *
+ */
+float32_t arm_nn_activation_f32(const arm_nn_activation_type type, const float32_t alpha, const float32_t val)
+{
+    switch (type)
+    {
+    case ARM_SIGMOID:
+        return 1.0f / (1.0f + expf(-val));
+    case ARM_TANH:
+        return tanhf(val);
+    case ARM_HARD_SWISH:
+        return val * MIN(MAX(val + 3.0f, 0.0f), 6.0f) / 6.0f;
+    case ARM_LEAKY_RELU:
+    default:
+        return val > 0.0f ? val : alpha * val;
+    }
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
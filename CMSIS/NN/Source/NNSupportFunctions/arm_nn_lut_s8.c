@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_lut_s8
+ * Description:  Look-up of s8 values in a 256 entry table
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 table look-up
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_nn_lut_s8(const q7_t *input, q7_t *output, const q7_t *lut, const int32_t size)
+{
+#if defined(ARM_MATH_MVEI)
+    for (int32_t i = 0; i < size; i += 16)
+    {
+        const mve_pred16_t p = vctp8q((uint32_t)(size - i));
+        const uint8x16_t index = vldrbq_z_u8((const uint8_t *)&input[i], p);
+        vstrbq_p_s8(&output[i], vldrbq_gather_offset_z_s8(lut, index, p), p);
+    }
+#else
+    int32_t i = 0;
+    for (; i <= size - 4; i += 4)
+    {
+        const q7_t in_0 = input[i];
+        const q7_t in_1 = input[i + 1];
+        const q7_t in_2 = input[i + 2];
+        const q7_t in_3 = input[i + 3];
+        output[i] = lut[(uint8_t)in_0];
+        output[i + 1] = lut[(uint8_t)in_1];
+        output[i + 2] = lut[(uint8_t)in_2];
+        output[i + 3] = lut[(uint8_t)in_3];
+    }
+    for (; i < size; i++)
+    {
+        output[i] = lut[(uint8_t)input[i]];
+    }
+#endif
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
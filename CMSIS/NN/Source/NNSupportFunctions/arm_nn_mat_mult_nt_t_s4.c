@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_nt_t_s4
+ * Description:  Matrix multiplication support function with the right-hand-side (rhs) matrix transposed
+ *               and packed as s4
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 matrix multiplication with the right-hand-side matrix transposed and packed as s4
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_mat_mult_nt_t_s4(const q7_t *lhs,
+                                   const q7_t *packed_rhs,
+                                   const q31_t *bias,
+                                   q7_t *dst,
+                                   const int32_t *dst_multipliers,
+                                   const int32_t *dst_shifts,
+                                   const int32_t lhs_rows,
+                                   const int32_t rhs_rows,
+                                   const int32_t rhs_cols,
+                                   const int32_t lhs_offset,
+                                   const int32_t dst_offset,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max)
+{
+    const int32_t rhs_cols_packed = rhs_cols >> 1;
+
+#if defined(ARM_MATH_DSP)
+    const int32_t lhs_offset_q15x2 = __PKHBT(lhs_offset, lhs_offset, 16);
+#endif
+
+    for (int32_t rhs_rows_idx = 0; rhs_rows_idx < rhs_rows; ++rhs_rows_idx)
+    {
+        const q7_t *rhs = &packed_rhs[rhs_rows_idx * rhs_cols_packed];
+        const q7_t *lhs_ptr = &lhs[0];
+        q7_t *dst_ptr = &dst[rhs_rows_idx];
+        const int32_t multiplier = dst_multipliers[rhs_rows_idx];
+        const int32_t shift = dst_shifts[rhs_rows_idx];
+
+        int32_t lhs_rows_idx = 0;
+
+#if defined(ARM_MATH_DSP)
+        // Two LHS rows are computed together so that every RHS value is only unpacked once for both
+        for (; lhs_rows_idx <= (lhs_rows - 2); lhs_rows_idx += 2)
+        {
+            const q7_t *rhs_ptr = rhs;
+            const q7_t *lhs_ptr1 = lhs_ptr + rhs_cols;
+
+            // Accumulators for the values unpacked in-register, that are scaled by 16
+            q31_t res00_x16 = 0;
+            q31_t res10_x16 = 0;
+            int32_t rhs_cols_idx = 0;
+
+            for (; rhs_cols_idx <= (rhs_cols - 8); rhs_cols_idx += 8)
+            {
+                q31_t rhs_02, rhs_13, rhs_46, rhs_57;
+                rhs_ptr = read_and_unpack_s4x8(rhs_ptr, &rhs_02, &rhs_13, &rhs_46, &rhs_57);
+
+                q31_t val0 = arm_nn_read_q7x4_ia(&lhs_ptr);
+                q31_t val1 = arm_nn_read_q7x4_ia(&lhs_ptr1);
+                res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, val0), rhs_02, res00_x16);
+                res10_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, val1), rhs_02, res10_x16);
+                res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)val0, 8)), rhs_13, res00_x16);
+                res10_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)val1, 8)), rhs_13, res10_x16);
+
+                val0 = arm_nn_read_q7x4_ia(&lhs_ptr);
+                val1 = arm_nn_read_q7x4_ia(&lhs_ptr1);
+                res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, val0), rhs_46, res00_x16);
+                res10_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, val1), rhs_46, res10_x16);
+                res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)val0, 8)), rhs_57, res00_x16);
+                res10_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)val1, 8)), rhs_57, res10_x16);
+            }
+
+            q31_t res00 = bias[rhs_rows_idx] + (res00_x16 >> 4);
+            q31_t res10 = bias[rhs_rows_idx] + (res10_x16 >> 4);
+
+            for (; rhs_cols_idx < rhs_cols; rhs_cols_idx += 2)
+            {
+                const q7_t rhs_value = *rhs_ptr++;
+                const q31_t rhs_low = (q7_t)(rhs_value << 4) >> 4;
+                const q31_t rhs_high = rhs_value >> 4;
+
+                res00 += (lhs_ptr[0] + lhs_offset) * rhs_low + (lhs_ptr[1] + lhs_offset) * rhs_high;
+                res10 += (lhs_ptr1[0] + lhs_offset) * rhs_low + (lhs_ptr1[1] + lhs_offset) * rhs_high;
+                lhs_ptr += 2;
+                lhs_ptr1 += 2;
+            }
+
+            // Quantize down
+            res00 = arm_nn_requantize(res00, multiplier, shift);
+            res10 = arm_nn_requantize(res10, multiplier, shift);
+
+            // Add offset
+            res00 += dst_offset;
+            res10 += dst_offset;
+
+            // Clamp the result
+            res00 = MAX(res00, activation_min);
+            res00 = MIN(res00, activation_max);
+            res10 = MAX(res10, activation_min);
+            res10 = MIN(res10, activation_max);
+
+            dst_ptr[0] = (q7_t)res00;
+            dst_ptr += rhs_rows;
+            dst_ptr[0] = (q7_t)res10;
+            dst_ptr += rhs_rows;
+
+            // Skip the second row that has already been computed
+            lhs_ptr += rhs_cols;
+        }
+#endif
+
+        // Left-over rows
+        for (; lhs_rows_idx < lhs_rows; ++lhs_rows_idx)
+        {
+            const q7_t *rhs_ptr = rhs;
+            q31_t res00 = bias[rhs_rows_idx];
+
+            for (int32_t rhs_cols_idx = 0; rhs_cols_idx < rhs_cols; rhs_cols_idx += 2)
+            {
+                const q7_t rhs_value = *rhs_ptr++;
+
+                res00 += (lhs_ptr[0] + lhs_offset) * ((q7_t)(rhs_value << 4) >> 4);
+                res00 += (lhs_ptr[1] + lhs_offset) * (rhs_value >> 4);
+                lhs_ptr += 2;
+            }
+
+            // Quantize down
+            res00 = arm_nn_requantize(res00, multiplier, shift);
+
+            // Add offset
+            res00 += dst_offset;
+
+            // Clamp the result
+            res00 = MAX(res00, activation_min);
+            res00 = MIN(res00, activation_max);
+
+            dst_ptr[0] = (q7_t)res00;
+            dst_ptr += rhs_rows;
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
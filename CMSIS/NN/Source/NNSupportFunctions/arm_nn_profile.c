@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_profile.c
+ * Description:  Profiling hooks and default profiling callbacks
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#if defined(ARM_NN_PROFILE)
+
+#if defined(_RTE_)
+#include "RTE_Components.h"
+#endif
+#if defined(CMSIS_device_header)
+#include CMSIS_device_header
+#endif
+
+#include <stddef.h>
+#include "arm_nn_profile.h"
+
+#if defined(ARM_NN_PROFILE_PMU) && defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+#define ARM_NN_PROFILE_USE_PMU
+#elif defined(CMSIS_device_header) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) ||                        \
+                                       defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__))
+#define ARM_NN_PROFILE_USE_DWT
+#else
+#include <time.h>
+#endif
+
+static arm_nn_profile_callback profile_begin = arm_nn_profile_default_begin;
+static arm_nn_profile_callback profile_end = arm_nn_profile_default_end;
+static arm_nn_profile_stats profile_stats[ARM_NN_KERNEL_COUNT];
+
+static const char *const kernel_names[ARM_NN_KERNEL_COUNT] = {"arm_convolve_s8",
+                                                              "arm_convolve_1x1_s8_fast",
+                                                              "arm_convolve_1x1_s4_fast",
+                                                              "arm_convolve_1_x_n_s8",
+                                                              "arm_convolve_small_ch_s8",
+                                                              "arm_depthwise_conv_s8",
+                                                              "arm_depthwise_conv_s8_opt",
+                                                              "arm_depthwise_conv_3x3_s8",
+                                                              "arm_depthwise_conv_ch_mult_s8",
+                                                              "arm_fully_connected_s8",
+                                                              "arm_fully_connected_s4",
+                                                              "arm_fully_connected_sparse_s8",
+                                                              "arm_batch_matmul_s8",
+                                                              "arm_avgpool_s8",
+                                                              "arm_max_pool_s8",
+                                                              "arm_elementwise_add_s8",
+                                                              "arm_elementwise_mul_s8",
+                                                              "arm_relu6_s8",
+                                                              "arm_activation_lut_s8",
+                                                              "arm_activation_lut_s16",
+                                                              "arm_softmax_s8",
+                                                              "arm_softmax_s8_fast",
+                                                              "arm_log_softmax_s8",
+                                                              "arm_softmax_s16",
+                                                              "arm_layer_norm_s16",
+                                                              "arm_mean_s8",
+                                                              "arm_reduce_sum_s8",
+                                                              "arm_quantize_f32_s8",
+                                                              "arm_quantize_f32_s16",
+                                                              "arm_dequantize_s8_f32",
+                                                              "arm_requantize_s8",
+                                                              "arm_requantize_per_channel_s8",
+                                                              "arm_concatenation_s8",
+                                                              "arm_reshape_s8",
+                                                              "arm_pad_s8",
+                                                              "arm_strided_slice_s8"};
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Profile
+ * @{
+ */
+
+void arm_nn_profile_set_callbacks(arm_nn_profile_callback begin, arm_nn_profile_callback end)
+{
+    profile_begin = begin;
+    profile_end = end;
+}
+
+void arm_nn_profile_begin(arm_nn_profile_event *event)
+{
+    if (profile_begin != NULL)
+    {
+        profile_begin(event);
+    }
+}
+
+void arm_nn_profile_end(arm_nn_profile_event *event)
+{
+    if (profile_end != NULL)
+    {
+        profile_end(event);
+    }
+}
+
+uint32_t arm_nn_profile_cycles(void)
+{
+#if defined(ARM_NN_PROFILE_USE_PMU)
+    return ARM_PMU_Get_CCNTR();
+#elif defined(ARM_NN_PROFILE_USE_DWT)
+    return DWT->CYCCNT;
+#else
+    return (uint32_t)clock();
+#endif
+}
+
+void arm_nn_profile_reset(void)
+{
+#if defined(ARM_NN_PROFILE_USE_PMU)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    ARM_PMU_Enable();
+    ARM_PMU_CYCCNT_Reset();
+    ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+#elif defined(ARM_NN_PROFILE_USE_DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    for (int32_t i = 0; i < ARM_NN_KERNEL_COUNT; i++)
+    {
+        profile_stats[i].calls = 0U;
+        profile_stats[i].cycles = 0U;
+        profile_stats[i].macs = 0;
+    }
+}
+
+void arm_nn_profile_default_begin(arm_nn_profile_event *event)
+{
+    event->timestamp = arm_nn_profile_cycles();
+}
+
+void arm_nn_profile_default_end(arm_nn_profile_event *event)
+{
+    const uint32_t cycles = arm_nn_profile_cycles() - event->timestamp;
+
+    if ((uint32_t)event->kernel < (uint32_t)ARM_NN_KERNEL_COUNT)
+    {
+        arm_nn_profile_stats *stats = &profile_stats[event->kernel];
+        stats->calls++;
+        stats->cycles += cycles;
+        stats->macs += event->macs;
+    }
+}
+
+const arm_nn_profile_stats *arm_nn_profile_get_stats(arm_nn_kernel_id kernel)
+{
+    if ((uint32_t)kernel >= (uint32_t)ARM_NN_KERNEL_COUNT)
+    {
+        return NULL;
+    }
+    return &profile_stats[kernel];
+}
+
+const char *arm_nn_profile_kernel_name(arm_nn_kernel_id kernel)
+{
+    if ((uint32_t)kernel >= (uint32_t)ARM_NN_KERNEL_COUNT)
+    {
+        return "unknown";
+    }
+    return kernel_names[kernel];
+}
+
+/**
+ * @} end of Profile group
+ */
+
+#endif /* ARM_NN_PROFILE */
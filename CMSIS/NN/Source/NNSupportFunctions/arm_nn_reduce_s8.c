@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_reduce_s8
+ * Description:  s8 sum or mean over the axes with an output dimension of one
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+// Number of int8 values that can be added to a 16 bit accumulator without overflow
+#define REDUCE_S16_ACC_MAX_LEN (256)
+
+static q7_t reduce_requantize(int32_t sum,
+                              const int32_t count,
+                              const int32_t input_offset,
+                              const int32_t out_mult,
+                              const int32_t out_shift,
+                              const int32_t output_offset,
+                              const int32_t divisor)
+{
+    sum += count * input_offset;
+    sum = arm_nn_requantize(sum, out_mult, out_shift);
+    if (divisor > 1)
+    {
+        sum = sum > 0 ? (sum + divisor / 2) / divisor : (sum - divisor / 2) / divisor;
+    }
+    sum += output_offset;
+    return (q7_t)CLAMP(sum, (int32_t)Q7_MAX, (int32_t)Q7_MIN);
+}
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 sum or mean over the reduced axes
+ *
+ * Refer header file for details.
+ *
+ */
+void arm_nn_reduce_s8(const cmsis_nn_dims *input_dims,
+                      const q7_t *input,
+                      const int32_t input_offset,
+                      const int32_t out_mult,
+                      const int32_t out_shift,
+                      const int32_t output_offset,
+                      const int32_t mean,
+                      const cmsis_nn_dims *output_dims,
+                      q7_t *output)
+{
+    const int32_t in_h = input_dims->h;
+    const int32_t in_w = input_dims->w;
+    const int32_t in_ch = input_dims->c;
+
+    const int32_t red_n = output_dims->n == 1 ? input_dims->n : 1;
+    const int32_t red_h = output_dims->h == 1 ? in_h : 1;
+    const int32_t red_w = output_dims->w == 1 ? in_w : 1;
+    const int32_t red_ch = output_dims->c == 1 ? in_ch : 1;
+    const int32_t count = red_n * red_h * red_w * red_ch;
+    const int32_t divisor = mean ? count : 1;
+
+    const int32_t w_stride = in_ch;
+    const int32_t h_stride = in_w * in_ch;
+    const int32_t n_stride = in_h * in_w * in_ch;
+
+    for (int32_t i_out_n = 0; i_out_n < output_dims->n; i_out_n++)
+    {
+        for (int32_t i_out_h = 0; i_out_h < output_dims->h; i_out_h++)
+        {
+            for (int32_t i_out_w = 0; i_out_w < output_dims->w; i_out_w++)
+            {
+                const q7_t *base = input + i_out_n * n_stride + i_out_h * h_stride + i_out_w * w_stride;
+
+                if (red_ch > 1)
+                {
+                    // The channels are reduced as well. Each position contributes a contiguous row of in_ch values.
+                    int32_t sum = 0;
+                    for (int32_t i_n = 0; i_n < red_n; i_n++)
+                    {
+                        for (int32_t i_h = 0; i_h < red_h; i_h++)
+                        {
+                            for (int32_t i_w = 0; i_w < red_w; i_w++)
+                            {
+                                const q7_t *row = base + i_n * n_stride + i_h * h_stride + i_w * w_stride;
+                                int32_t i_ch = 0;
+#if defined(ARM_MATH_MVEI)
+                                int32_t ch_cnt = in_ch;
+                                while (ch_cnt > 0)
+                                {
+                                    const mve_pred16_t p = vctp8q((uint32_t)ch_cnt);
+                                    const int8x16_t in = vldrbq_z_s8(&row[i_ch], p);
+                                    sum = vaddvaq_p_s8(sum, in, p);
+                                    i_ch += 16;
+                                    ch_cnt -= 16;
+                                }
+#else
+#if defined(ARM_MATH_DSP)
+                                for (; i_ch <= in_ch - 4; i_ch += 4)
+                                {
+                                    const q31_t in = arm_nn_read_q7x4(&row[i_ch]);
+                                    sum = __SMLAD(__SXTB16(in), 0x00010001, sum);
+                                    sum = __SMLAD(__SXTB16(__ROR((uint32_t)in, 8)), 0x00010001, sum);
+                                }
+#endif
+                                for (; i_ch < in_ch; i_ch++)
+                                {
+                                    sum += row[i_ch];
+                                }
+#endif
+                            }
+                        }
+                    }
+                    *output++ =
+                        reduce_requantize(sum, count, input_offset, out_mult, out_shift, output_offset, divisor);
+                    continue;
+                }
+
+                // The channels are kept. The positions are accumulated for a block of channels at a time.
+                int32_t i_ch = 0;
+#if defined(ARM_MATH_MVEI)
+                for (; i_ch < in_ch; i_ch += 4)
+                {
+                    const mve_pred16_t p = vctp32q((uint32_t)(in_ch - i_ch));
+                    int32x4_t sum = vdupq_n_s32(0);
+                    for (int32_t i_n = 0; i_n < red_n; i_n++)
+                    {
+                        for (int32_t i_h = 0; i_h < red_h; i_h++)
+                        {
+                            const q7_t *row = base + i_n * n_stride + i_h * h_stride + i_ch;
+                            for (int32_t i_w = 0; i_w < red_w; i_w++)
+                            {
+                                sum = vaddq_s32(sum, vldrbq_z_s32(row, p));
+                                row += w_stride;
+                            }
+                        }
+                    }
+                    int32_t sums[4];
+                    vstrwq_s32(sums, sum);
+                    const int32_t num_ch = MIN(4, in_ch - i_ch);
+                    for (int32_t i = 0; i < num_ch; i++)
+                    {
+                        output[i_ch + i] = reduce_requantize(
+                            sums[i], count, input_offset, out_mult, out_shift, output_offset, divisor);
+                    }
+                }
+#else
+#if defined(ARM_MATH_DSP)
+                for (; i_ch <= in_ch - 4; i_ch += 4)
+                {
+                    int32_t sum_0 = 0;
+                    int32_t sum_1 = 0;
+                    int32_t sum_2 = 0;
+                    int32_t sum_3 = 0;
+                    for (int32_t i_n = 0; i_n < red_n; i_n++)
+                    {
+                        for (int32_t i_h = 0; i_h < red_h; i_h++)
+                        {
+                            const q7_t *row = base + i_n * n_stride + i_h * h_stride + i_ch;
+                            int32_t i_w = 0;
+                            while (i_w < red_w)
+                            {
+                                // Channels 0 and 2 and channels 1 and 3 are added as pairs of 16 bit values
+                                const int32_t i_w_end = MIN(red_w, i_w + REDUCE_S16_ACC_MAX_LEN);
+                                q31_t acc_02 = 0;
+                                q31_t acc_13 = 0;
+                                for (; i_w < i_w_end; i_w++)
+                                {
+                                    const q31_t in = arm_nn_read_q7x4(row);
+                                    acc_02 = __SXTAB16(acc_02, in);
+                                    acc_13 = __SXTAB16(acc_13, __ROR((uint32_t)in, 8));
+                                    row += w_stride;
+                                }
+                                sum_0 += (int16_t)acc_02;
+                                sum_1 += (int16_t)acc_13;
+                                sum_2 += acc_02 >> 16;
+                                sum_3 += acc_13 >> 16;
+                            }
+                        }
+                    }
+                    output[i_ch] = reduce_requantize(sum_0, count, input_offset, out_mult, out_shift, output_offset,
+                                                     divisor);
+                    output[i_ch + 1] = reduce_requantize(sum_1, count, input_offset, out_mult, out_shift,
+                                                         output_offset, divisor);
+                    output[i_ch + 2] = reduce_requantize(sum_2, count, input_offset, out_mult, out_shift,
+                                                         output_offset, divisor);
+                    output[i_ch + 3] = reduce_requantize(sum_3, count, input_offset, out_mult, out_shift,
+                                                         output_offset, divisor);
+                }
+#endif
+                for (; i_ch < in_ch; i_ch++)
+                {
+                    int32_t sum = 0;
+                    for (int32_t i_n = 0; i_n < red_n; i_n++)
+                    {
+                        for (int32_t i_h = 0; i_h < red_h; i_h++)
+                        {
+                            const q7_t *row = base + i_n * n_stride + i_h * h_stride + i_ch;
+                            for (int32_t i_w = 0; i_w < red_w; i_w++)
+                            {
+                                sum += *row;
+                                row += w_stride;
+                            }
+                        }
+                    }
+                    output[i_ch] =
+                        reduce_requantize(sum, count, input_offset, out_mult, out_shift, output_offset, divisor);
+                }
+#endif
+                output += in_ch;
+            }
+        }
+    }
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_vec_mat_mult_t_s4
+ * Description:  s8 vector by packed s4 matrix (transposed) multiplication
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 vector(lhs) by packed s4 matrix (transposed) multiplication
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_vec_mat_mult_t_s4(const q7_t *lhs,
+                                    const q7_t *packed_rhs,
+                                    const q31_t *bias,
+                                    q7_t *dst,
+                                    const int32_t lhs_offset,
+                                    const int32_t dst_offset,
+                                    const int32_t dst_multiplier,
+                                    const int32_t dst_shift,
+                                    const int32_t rhs_cols,
+                                    const int32_t rhs_rows,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max)
+{
+#if defined(ARM_MATH_DSP)
+    const int32_t lhs_offset_q15x2 = __PKHBT(lhs_offset, lhs_offset, 16);
+#endif
+
+    for (int32_t rhs_rows_idx = 0; rhs_rows_idx < rhs_rows; ++rhs_rows_idx)
+    {
+        // The rows are packed without padding so every other row starts in the high nibble when rhs_cols is odd
+        const int32_t start = rhs_rows_idx * rhs_cols;
+        const q7_t *rhs_ptr = &packed_rhs[start >> 1];
+        const q7_t *lhs_ptr = &lhs[0];
+        int32_t rhs_cols_idx = 0;
+        q31_t res00 = *bias++;
+
+        if (start & 0x1)
+        {
+            res00 += (lhs_ptr[0] + lhs_offset) * (rhs_ptr[0] >> 4);
+            ++lhs_ptr;
+            ++rhs_ptr;
+            ++rhs_cols_idx;
+        }
+
+#if defined(ARM_MATH_DSP)
+        // Accumulator for the values unpacked in-register, that are scaled by 16
+        q31_t res00_x16 = 0;
+        for (; rhs_cols_idx <= (rhs_cols - 8); rhs_cols_idx += 8)
+        {
+            q31_t rhs_02, rhs_13, rhs_46, rhs_57;
+            rhs_ptr = read_and_unpack_s4x8(rhs_ptr, &rhs_02, &rhs_13, &rhs_46, &rhs_57);
+
+            q31_t val = arm_nn_read_q7x4_ia(&lhs_ptr);
+            res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, val), rhs_02, res00_x16);
+            res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)val, 8)), rhs_13, res00_x16);
+
+            val = arm_nn_read_q7x4_ia(&lhs_ptr);
+            res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, val), rhs_46, res00_x16);
+            res00_x16 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)val, 8)), rhs_57, res00_x16);
+        }
+        res00 += res00_x16 >> 4;
+#endif
+
+        for (; rhs_cols_idx <= (rhs_cols - 2); rhs_cols_idx += 2)
+        {
+            const q7_t rhs_value = *rhs_ptr++;
+            res00 += (lhs_ptr[0] + lhs_offset) * ((q7_t)(rhs_value << 4) >> 4);
+            res00 += (lhs_ptr[1] + lhs_offset) * (rhs_value >> 4);
+            lhs_ptr += 2;
+        }
+
+        if (rhs_cols_idx < rhs_cols)
+        {
+            res00 += (lhs_ptr[0] + lhs_offset) * ((q7_t)(rhs_ptr[0] << 4) >> 4);
+        }
+
+        // Quantize down
+        res00 = arm_nn_requantize(res00, dst_multiplier, dst_shift);
+
+        // Add offset
+        res00 += dst_offset;
+
+        // Clamp the result
+        res00 = MAX(res00, activation_min);
+        res00 = MIN(res00, activation_max);
+
+        *dst++ = (q7_t)res00;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_vec_mat_mult_t_sparse_s8
+ * Description:  s8 vector by block sparse matrix (transposed) multiplication
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/*
+ * s8 vector(lhs) by block sparse matrix (transposed) multiplication
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_nn_vec_mat_mult_t_sparse_s8(const q7_t *lhs,
+                                           const cmsis_nn_sparse_weights *rhs,
+                                           const q31_t *bias,
+                                           q7_t *dst,
+                                           const int32_t lhs_offset,
+                                           const int32_t dst_offset,
+                                           const int32_t dst_multiplier,
+                                           const int32_t dst_shift,
+                                           const int32_t rhs_cols,
+                                           const int32_t rhs_rows,
+                                           const int32_t activation_min,
+                                           const int32_t activation_max)
+{
+    const uint16_t *block_cols = rhs->block_cols;
+    const int32_t full_blocks = rhs_cols / ARM_NN_SPARSE_BLOCK_SIZE;
+
+#if defined(ARM_MATH_DSP)
+    const int32_t lhs_offset_q15x2 = __PKHBT(lhs_offset, lhs_offset, 16);
+#endif
+
+    for (int32_t rhs_rows_idx = 0; rhs_rows_idx < rhs_rows; ++rhs_rows_idx)
+    {
+        int32_t block_idx = rhs->row_offsets[rhs_rows_idx];
+        int32_t block_end = rhs->row_offsets[rhs_rows_idx + 1];
+        const q7_t *rhs_ptr = &rhs->values[block_idx * ARM_NN_SPARSE_BLOCK_SIZE];
+        q31_t res00 = *bias++;
+
+        // A zero padded last block is handled separately so that no values beyond rhs_cols are read from lhs
+        const int32_t has_tail = (block_end > block_idx) && (block_cols[block_end - 1] >= full_blocks);
+        block_end -= has_tail;
+
+#if defined(ARM_MATH_DSP)
+        for (; block_idx <= (block_end - 2); block_idx += 2)
+        {
+            const q7_t *lhs_ptr0 = &lhs[block_cols[block_idx] * ARM_NN_SPARSE_BLOCK_SIZE];
+            const q7_t *lhs_ptr1 = &lhs[block_cols[block_idx + 1] * ARM_NN_SPARSE_BLOCK_SIZE];
+
+            q31_t ker_0 = arm_nn_read_q7x4_ia(&rhs_ptr);
+            q31_t ker_1 = __SXTB16(__ROR((uint32_t)ker_0, 8));
+            ker_0 = __SXTB16(ker_0);
+
+            q31_t in = arm_nn_read_q7x4(lhs_ptr0);
+            res00 = __SMLAD(__SXTAB16(lhs_offset_q15x2, in), ker_0, res00);
+            res00 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)in, 8)), ker_1, res00);
+
+            ker_0 = arm_nn_read_q7x4_ia(&rhs_ptr);
+            ker_1 = __SXTB16(__ROR((uint32_t)ker_0, 8));
+            ker_0 = __SXTB16(ker_0);
+
+            in = arm_nn_read_q7x4(lhs_ptr1);
+            res00 = __SMLAD(__SXTAB16(lhs_offset_q15x2, in), ker_0, res00);
+            res00 = __SMLAD(__SXTAB16(lhs_offset_q15x2, __ROR((uint32_t)in, 8)), ker_1, res00);
+        }
+#endif
+
+        for (; block_idx < block_end; ++block_idx)
+        {
+            const q7_t *lhs_ptr = &lhs[block_cols[block_idx] * ARM_NN_SPARSE_BLOCK_SIZE];
+            for (int32_t i = 0; i < ARM_NN_SPARSE_BLOCK_SIZE; ++i)
+            {
+                res00 += (lhs_ptr[i] + lhs_offset) * rhs_ptr[i];
+            }
+            rhs_ptr += ARM_NN_SPARSE_BLOCK_SIZE;
+        }
+
+        if (has_tail)
+        {
+            for (int32_t col = block_cols[block_idx] * ARM_NN_SPARSE_BLOCK_SIZE; col < rhs_cols; ++col)
+            {
+                res00 += (lhs[col] + lhs_offset) * (*rhs_ptr++);
+            }
+        }
+
+        // Quantize down
+        res00 = arm_nn_requantize(res00, dst_multiplier, dst_shift);
+
+        // Add offset
+        res00 += dst_offset;
+
+        // Clamp the result
+        res00 = MAX(res00, activation_min);
+        res00 = MIN(res00, activation_max);
+
+        *dst++ = (q7_t)res00;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -21,8 +21,8 @@
  * Title:        arm_avgpool_s8.c
  * Description:  Pooling function implementations
  *
- * $Date:        May 29,2020
- * $Revision:    V.2.0.1
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -31,54 +31,72 @@
 #include "arm_math.h"
 #include "arm_nnfunctions.h"
 
+/* Number of int8 values that can be summed in a 16 bit lane without overflow */
+#define MAX_Q15_ACC_NUM (256)
 
-#if defined (ARM_MATH_DSP) && !defined (ARM_MATH_MVEI)
-
-static void buffer_scale_back_q15_to_q7_and_clamp(q15_t *buffer, q7_t *target, uint16_t length,
-                                                  uint16_t count,const int act_min, const int act_max)
+__STATIC_FORCEINLINE q7_t avg_output(int32_t sum,
+                                     const int32_t count,
+                                     const cmsis_nn_per_tensor_quant_params *quant_params,
+                                     const int32_t input_offset,
+                                     const int32_t output_offset,
+                                     const int32_t act_min,
+                                     const int32_t act_max)
 {
-  int i;
-  int sum;
+  sum = sum > 0 ? (sum + count / 2) / count : (sum - count / 2) / count;
 
-  for (i = 0; i < length; i++)
+  if (quant_params != NULL)
   {
-    sum = buffer[i] > 0 ? (buffer[i] + count / 2) / count : (buffer[i] - count / 2) / count;
+    sum = arm_nn_requantize(sum + input_offset, quant_params->multiplier, quant_params->shift);
+    sum += output_offset;
+  }
+  sum = MAX(sum, act_min);
+  sum = MIN(sum, act_max);
 
-    sum = MAX(sum, act_min);
-    sum = MIN(sum, act_max);
+  return (q7_t)sum;
+}
 
-    target[i] = (q7_t) (sum);
-  }
+#if defined(ARM_MATH_MVEI)
+/* Moves the 16 bit lane sums of 16 channels into the 32 bit sums and clears them */
+__STATIC_FORCEINLINE void flush_acc_s16x8(int16x8_t *acc_even,
+                                          int16x8_t *acc_odd,
+                                          int32x4_t *sum)
+{
+  /* sum[n] holds the channels n, n + 4, n + 8 and n + 12 */
+  sum[0] = vaddq_s32(sum[0], vmovlbq_s16(*acc_even));
+  sum[1] = vaddq_s32(sum[1], vmovlbq_s16(*acc_odd));
+  sum[2] = vaddq_s32(sum[2], vmovltq_s16(*acc_even));
+  sum[3] = vaddq_s32(sum[3], vmovltq_s16(*acc_odd));
+  *acc_even = vdupq_n_s16(0);
+  *acc_odd = vdupq_n_s16(0);
+}
+#elif defined(ARM_MATH_DSP)
+/* Moves the 16 bit lane sums of 4 channels into the 32 bit sums and clears them */
+__STATIC_FORCEINLINE void flush_acc_s16x2(q31_t *acc_02, q31_t *acc_13, int32_t *sum)
+{
+  sum[0] += (q15_t)*acc_02;
+  sum[1] += (q15_t)*acc_13;
+  sum[2] += *acc_02 >> 16;
+  sum[3] += *acc_13 >> 16;
+  *acc_02 = 0;
+  *acc_13 = 0;
 }
 #endif
 
-/**
- *  @ingroup groupNN
- */
-
-/**
- * @addtogroup Pooling
- * @{
- */
-
 /*
- * s8 average pooling function
- *
- * Refer to header file for details.
- *
+ * Average pooling core. The sums of a block of channels are kept in registers, 16 bit
+ * lanes that are flushed to 32 bit every MAX_Q15_ACC_NUM positions, so no scratch
+ * buffer is used.
  */
-
-#if defined(ARM_MATH_MVEI)
-
-arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
-                          const cmsis_nn_pool_params *pool_params,
-                          const cmsis_nn_dims *input_dims,
-                          const q7_t *src,
-                          const cmsis_nn_dims *filter_dims,
-                          const cmsis_nn_dims *output_dims,
-                          q7_t *dst)
+static void avgpool_s8(const cmsis_nn_pool_params *pool_params,
+                       const cmsis_nn_per_tensor_quant_params *quant_params,
+                       const int32_t input_offset,
+                       const int32_t output_offset,
+                       const cmsis_nn_dims *input_dims,
+                       const q7_t *src,
+                       const cmsis_nn_dims *filter_dims,
+                       const cmsis_nn_dims *output_dims,
+                       q7_t *dst)
 {
-  (void)ctx;
   const int32_t dim_src_height = input_dims->h;
   const int32_t dim_src_width = input_dims->w;
   const int32_t dim_dst_height = output_dims->h;
@@ -92,150 +110,136 @@ arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
   const int32_t act_min = pool_params->activation.min;
   const int32_t act_max = pool_params->activation.max;
   const int32_t ch_src = input_dims->c;
-
-  int32_t   i_x, i_y;
-  int32_t   k_x, k_y;
+  int32_t k_x, k_y, i_x, i_y;
 
   for (i_y = 0; i_y < dim_dst_height; i_y++)
   {
     for (i_x = 0; i_x < dim_dst_width; i_x++)
     {
+      /* Condition for kernel start dimension: (base_idx_<x,y> + kernel_<x,y>_start) >= 0 */
+      const int32_t base_idx_y = (i_y * stride_height) - padding_height;
+      const int32_t base_idx_x = (i_x * stride_width) - padding_width;
+      const int32_t kernel_y_start = MAX(0, -base_idx_y);
+      const int32_t kernel_x_start = MAX(0, -base_idx_x);
 
-      int32_t   k_y_start,k_y_end;
-      int32_t   k_x_start,k_x_end;
-      int32_t   chCnt;
-      const int8_t    *pTmp, *pTmpInner;
-      int8_t    *pDst;
-
-      k_y_start = MAX(0, i_y * stride_height - padding_height);
-      k_y_end = MIN(i_y * stride_height - padding_height + dim_kernel_height,dim_src_height);
-
-      k_x_start = MAX(0,i_x * stride_width - padding_width);
-      k_x_end = MIN(i_x * stride_width - padding_width + dim_kernel_width, dim_src_width);
-
+      /* Condition for kernel end dimension: (base_idx_<x,y> + kernel_<x,y>_end) < dim_src_<width,height> */
+      const int32_t kernel_y_end = MIN(dim_kernel_height, dim_src_height - base_idx_y);
+      const int32_t kernel_x_end = MIN(dim_kernel_width, dim_src_width - base_idx_x);
 
-      pTmp = src;
-      pDst = &dst[ch_src * (i_x + i_y * dim_dst_width)];
+      const int32_t count = (kernel_y_end - kernel_y_start) * (kernel_x_end - kernel_x_start);
+      const q7_t *base = src + ch_src * (base_idx_x + base_idx_y * dim_src_width);
+      int32_t i_ch = 0;
 
-      chCnt = ch_src >> 4;
-      while(chCnt > 0)
+#if defined(ARM_MATH_MVEI)
+      for (; i_ch < ch_src; i_ch += 16)
       {
-        int32x4_t sumV1,sumV2,sumV3,sumV4;
-
-        int8x16_t tempV;
-        int16x8_t tempVLO, tempVHI;
-        int32x4_t tempVLOLO, tempVLOHI, tempVHILO, tempVHIHI;
-        int32_t   count = 0;
-
-        sumV1 = vdupq_n_s32(0);
-        sumV2 = vdupq_n_s32(0);
-        sumV3 = vdupq_n_s32(0);
-        sumV4 = vdupq_n_s32(0);
-
-        for (k_y = k_y_start; k_y < k_y_end; k_y++)
+        const mve_pred16_t p = vctp8q((uint32_t)(ch_src - i_ch));
+        const int32_t num_ch = MIN(16, ch_src - i_ch);
+        int16x8_t acc_even = vdupq_n_s16(0);
+        int16x8_t acc_odd = vdupq_n_s16(0);
+        int32x4_t sum[4];
+        int32_t sum_buf[16];
+        int32_t acc_cnt = 0;
+
+        sum[0] = vdupq_n_s32(0);
+        sum[1] = vdupq_n_s32(0);
+        sum[2] = vdupq_n_s32(0);
+        sum[3] = vdupq_n_s32(0);
+
+        for (k_y = kernel_y_start; k_y < kernel_y_end; k_y++)
         {
-          for (k_x = k_x_start; k_x < k_x_end; k_x++)
+          for (k_x = kernel_x_start; k_x < kernel_x_end; k_x++)
           {
-            pTmpInner = pTmp + (ch_src * (k_x + k_y * dim_src_width));
-            tempV = vldrbq_s8 (pTmpInner);
-
-            tempVLO = vmovlbq_s8(tempV);
-            tempVHI = vmovltq_s8(tempV);
-
-            tempVLOLO = vmovlbq_s16(tempVLO);
-            tempVLOHI = vmovltq_s16(tempVLO);
+            const int8x16_t in = vldrbq_z_s8(base + i_ch + ch_src * (k_x + k_y * dim_src_width), p);
 
-            tempVHILO = vmovlbq_s16(tempVHI);
-            tempVHIHI = vmovltq_s16(tempVHI);
+            acc_even = vaddq_s16(acc_even, vmovlbq_s8(in));
+            acc_odd = vaddq_s16(acc_odd, vmovltq_s8(in));
 
-            sumV1 = vaddq_s32(sumV1,tempVLOLO);
-            sumV2 = vaddq_s32(sumV2,tempVLOHI);
-            sumV3 = vaddq_s32(sumV3,tempVHILO);
-            sumV4 = vaddq_s32(sumV4,tempVHIHI);
-
-            count++;
+            if (++acc_cnt == MAX_Q15_ACC_NUM)
+            {
+              flush_acc_s16x8(&acc_even, &acc_odd, sum);
+              acc_cnt = 0;
+            }
           }
         }
+        flush_acc_s16x8(&acc_even, &acc_odd, sum);
 
+        /* Back to channel order */
+        const uint32x4_t offset = vidupq_n_u32(0, 4);
+        vstrwq_scatter_shifted_offset_s32(sum_buf, offset, sum[0]);
+        vstrwq_scatter_shifted_offset_s32(sum_buf, vaddq_n_u32(offset, 1), sum[1]);
+        vstrwq_scatter_shifted_offset_s32(sum_buf, vaddq_n_u32(offset, 2), sum[2]);
+        vstrwq_scatter_shifted_offset_s32(sum_buf, vaddq_n_u32(offset, 3), sum[3]);
 
-        sumV1[0] = sumV1[0] > 0 ? (sumV1[0] + count / 2) / count : (sumV1[0] - count / 2) / count;
-        sumV1[1] = sumV1[1] > 0 ? (sumV1[1] + count / 2) / count : (sumV1[1] - count / 2) / count;
-        sumV1[2] = sumV1[2] > 0 ? (sumV1[2] + count / 2) / count : (sumV1[2] - count / 2) / count;
-        sumV1[3] = sumV1[3] > 0 ? (sumV1[3] + count / 2) / count : (sumV1[3] - count / 2) / count;
-
-        sumV2[0] = sumV2[0] > 0 ? (sumV2[0] + count / 2) / count : (sumV2[0] - count / 2) / count;
-        sumV2[1] = sumV2[1] > 0 ? (sumV2[1] + count / 2) / count : (sumV2[1] - count / 2) / count;
-        sumV2[2] = sumV2[2] > 0 ? (sumV2[2] + count / 2) / count : (sumV2[2] - count / 2) / count;
-        sumV2[3] = sumV2[3] > 0 ? (sumV2[3] + count / 2) / count : (sumV2[3] - count / 2) / count;
-
-        sumV3[0] = sumV3[0] > 0 ? (sumV3[0] + count / 2) / count : (sumV3[0] - count / 2) / count;
-        sumV3[1] = sumV3[1] > 0 ? (sumV3[1] + count / 2) / count : (sumV3[1] - count / 2) / count;
-        sumV3[2] = sumV3[2] > 0 ? (sumV3[2] + count / 2) / count : (sumV3[2] - count / 2) / count;
-        sumV3[3] = sumV3[3] > 0 ? (sumV3[3] + count / 2) / count : (sumV3[3] - count / 2) / count;
-
-        sumV4[0] = sumV4[0] > 0 ? (sumV4[0] + count / 2) / count : (sumV4[0] - count / 2) / count;
-        sumV4[1] = sumV4[1] > 0 ? (sumV4[1] + count / 2) / count : (sumV4[1] - count / 2) / count;
-        sumV4[2] = sumV4[2] > 0 ? (sumV4[2] + count / 2) / count : (sumV4[2] - count / 2) / count;
-        sumV4[3] = sumV4[3] > 0 ? (sumV4[3] + count / 2) / count : (sumV4[3] - count / 2) / count;
-
-        sumV1 = vmaxq_s32(sumV1, vdupq_n_s32(act_min));
-        sumV1 = vminq_s32(sumV1, vdupq_n_s32(act_max));
-
-        sumV2 = vmaxq_s32(sumV2, vdupq_n_s32(act_min));
-        sumV2 = vminq_s32(sumV2, vdupq_n_s32(act_max));
-
-        sumV3 = vmaxq_s32(sumV3, vdupq_n_s32(act_min));
-        sumV3 = vminq_s32(sumV3, vdupq_n_s32(act_max));
-
-        sumV4 = vmaxq_s32(sumV4, vdupq_n_s32(act_min));
-        sumV4 = vminq_s32(sumV4, vdupq_n_s32(act_max));
-
-        tempVLO = vmovnbq_s32(tempVLO,sumV1);
-        tempVLO = vmovntq_s32(tempVLO,sumV2);
-
-        tempVHI = vmovnbq_s32(tempVHI,sumV3);
-        tempVHI = vmovntq_s32(tempVHI,sumV4);
+        for (int32_t i = 0; i < num_ch; i++)
+        {
+          *dst++ = avg_output(sum_buf[i], count, quant_params, input_offset, output_offset, act_min, act_max);
+        }
+      }
+#elif defined(ARM_MATH_DSP)
+      for (; i_ch <= ch_src - 4; i_ch += 4)
+      {
+        int32_t sum[4] = {0, 0, 0, 0};
+        q31_t acc_02 = 0;
+        q31_t acc_13 = 0;
+        int32_t acc_cnt = 0;
 
+        for (k_y = kernel_y_start; k_y < kernel_y_end; k_y++)
+        {
+          for (k_x = kernel_x_start; k_x < kernel_x_end; k_x++)
+          {
+            const q31_t in = arm_nn_read_q7x4(base + i_ch + ch_src * (k_x + k_y * dim_src_width));
 
-        tempV = vmovnbq_s16(tempV,tempVLO);
-        tempV = vmovntq_s16(tempV,tempVHI);
+            acc_02 = __SXTAB16(acc_02, in);
+            acc_13 = __SXTAB16(acc_13, __ROR((uint32_t)in, 8));
 
-        vstrbq_s8(pDst,tempV);
-        pDst += 16;
+            if (++acc_cnt == MAX_Q15_ACC_NUM)
+            {
+              flush_acc_s16x2(&acc_02, &acc_13, sum);
+              acc_cnt = 0;
+            }
+          }
+        }
+        flush_acc_s16x2(&acc_02, &acc_13, sum);
 
-        chCnt --;
-        pTmp += 16;
+        *dst++ = avg_output(sum[0], count, quant_params, input_offset, output_offset, act_min, act_max);
+        *dst++ = avg_output(sum[1], count, quant_params, input_offset, output_offset, act_min, act_max);
+        *dst++ = avg_output(sum[2], count, quant_params, input_offset, output_offset, act_min, act_max);
+        *dst++ = avg_output(sum[3], count, quant_params, input_offset, output_offset, act_min, act_max);
       }
-
-      chCnt = ch_src & 0xF;
-      while(chCnt > 0)
+#endif
+      for (; i_ch < ch_src; i_ch++)
       {
-        int32_t       sum = 0;
-        int32_t       count = 0;
+        int32_t sum = 0;
 
-        for (k_y = k_y_start; k_y < k_y_end; k_y++)
+        for (k_y = kernel_y_start; k_y < kernel_y_end; k_y++)
         {
-          for (k_x = k_x_start; k_x < k_x_end; k_x++)
+          for (k_x = kernel_x_start; k_x < kernel_x_end; k_x++)
           {
-            sum += pTmp[ch_src * (k_x + k_y * dim_src_width)];
-            count++;
+            sum += base[i_ch + ch_src * (k_x + k_y * dim_src_width)];
           }
         }
-        sum = sum > 0 ? (sum + count / 2) / count : (sum - count / 2) / count;
-        sum = MAX(sum, act_min);
-        sum = MIN(sum, act_max);
-
-        *pDst++ = sum;
-
-        chCnt --;
-        pTmp++;
+        *dst++ = avg_output(sum, count, quant_params, input_offset, output_offset, act_min, act_max);
       }
     }
   }
-  return ARM_MATH_SUCCESS;
 }
 
-#else
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/*
+ * s8 average pooling function
+ *
+ * Refer to header file for details.
+ *
+ */
 arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
                           const cmsis_nn_pool_params *pool_params,
                           const cmsis_nn_dims *input_dims,
@@ -244,117 +248,51 @@ arm_status arm_avgpool_s8(const cmsis_nn_context *ctx,
                           const cmsis_nn_dims *output_dims,
                           q7_t *dst)
 {
-  const int32_t dim_src_height = input_dims->h;
-  const int32_t dim_src_width = input_dims->w;
-  const int32_t dim_dst_height = output_dims->h;
-  const int32_t dim_dst_width = output_dims->w;
-  const int32_t stride_height = pool_params->stride.h;
-  const int32_t stride_width = pool_params->stride.w;
-  const int32_t dim_kernel_height = filter_dims->h;
-  const int32_t dim_kernel_width = filter_dims->w;
-  const int32_t padding_height = pool_params->padding.h;
-  const int32_t padding_width = pool_params->padding.w;
-  const int32_t act_min = pool_params->activation.min;
-  const int32_t act_max = pool_params->activation.max;
-  const int32_t ch_src = input_dims->c;
-  q15_t *bufferA = (q15_t *)ctx->buf;
+  (void)ctx;
+  ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_AVGPOOL_S8, input_dims, filter_dims, output_dims, 0);
 
-#if defined (ARM_MATH_DSP)
+  avgpool_s8(pool_params, NULL, 0, 0, input_dims, src, filter_dims, output_dims, dst);
 
-  /* Run the following code for Cortex-M4 and Cortex-M7
-   */
-  int32_t k_x, k_y, i_x, i_y;
+  ARM_NN_PROFILE_END();
+  return ARM_MATH_SUCCESS;
+}
 
-  for (i_y = 0; i_y < dim_dst_height; i_y++)
+/*
+ * s8 average pooling function with fused requantization
+ *
+ * Refer to header file for details.
+ *
+ */
+arm_status arm_avgpool_s8_requantize(const cmsis_nn_context *ctx,
+                                     const cmsis_nn_pool_params *pool_params,
+                                     const cmsis_nn_per_tensor_quant_params *quant_params,
+                                     const int32_t input_offset,
+                                     const int32_t output_offset,
+                                     const cmsis_nn_dims *input_dims,
+                                     const q7_t *src,
+                                     const cmsis_nn_dims *filter_dims,
+                                     const cmsis_nn_dims *output_dims,
+                                     q7_t *dst)
+{
+  (void)ctx;
+  if (quant_params == NULL)
   {
-    for (i_x = 0; i_x < dim_dst_width; i_x++)
-    {
-      /* Condition for kernel start dimension: (base_idx_<x,y> + kernel_<x,y>_start) >= 0 */
-      const int32_t base_idx_y = (i_y * stride_height) - padding_height;
-      const int32_t base_idx_x = (i_x * stride_width) - padding_width;
-      const int32_t kernel_y_start = MAX(0, -base_idx_y);
-      const int32_t kernel_x_start = MAX(0, -base_idx_x);
-
-      /* Condition for kernel end dimension: (base_idx_<x,y> + kernel_<x,y>_end) < dim_src_<width,height> */
-      const int32_t kernel_y_end = MIN(dim_kernel_height, dim_src_height - base_idx_y);
-      const int32_t kernel_x_end = MIN(dim_kernel_width, dim_src_width - base_idx_x);
-
-      int count = 0;
-
-      for (k_y = kernel_y_start; k_y < kernel_y_end; k_y++)
-      {
-        for (k_x = kernel_x_start; k_x < kernel_x_end; k_x++)
-        {
-          const q7_t *start = src + ch_src * (k_x + base_idx_x + (k_y + base_idx_y) * dim_src_width);
-
-          if (count == 0)
-          {
-            arm_q7_to_q15_no_shift(start, bufferA, ch_src);
-          }
-          else
-          {
-            arm_nn_accumulate_q7_to_q15(bufferA, start, ch_src);
-          }
-          count++;
-        }
-      }
-      buffer_scale_back_q15_to_q7_and_clamp(bufferA, dst, ch_src, count, act_min, act_max);
-      dst += ch_src;
-    }
+    return ARM_MATH_ARGUMENT_ERROR;
   }
-#else
+  ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_AVGPOOL_S8, input_dims, filter_dims, output_dims, 0);
 
-  /* Reference C code adapted from CMSIS-NN arm_avepool_q7_HWC.
-   */
-  (void)bufferA;
-  int16_t i_ch_in, i_x, i_y;
-  int16_t k_x, k_y;
+  avgpool_s8(pool_params, quant_params, input_offset, output_offset, input_dims, src, filter_dims, output_dims, dst);
 
-  for (i_y = 0; i_y < dim_dst_height; i_y++)
-  {
-    for (i_x = 0; i_x < dim_dst_width; i_x++)
-    {
-      for (i_ch_in = 0; i_ch_in < ch_src; i_ch_in++)
-      {
-        int sum = 0;
-        int count = 0;
-        for (k_y = i_y * stride_height - padding_height; k_y < i_y * stride_height - padding_height + dim_kernel_height; k_y++)
-        {
-          for (k_x = i_x * stride_width - padding_width; k_x < i_x * stride_width - padding_width + dim_kernel_width; k_x++)
-          {
-            if (k_y >= 0 && k_x >= 0 && k_y < dim_src_height && k_x < dim_src_width)
-            {
-              sum += src[i_ch_in + ch_src * (k_x + k_y * dim_src_width)];
-              count++;
-            }
-          }
-        }
-        sum = sum > 0 ? (sum + count / 2) / count : (sum - count / 2) / count;
-        sum = MAX(sum, act_min);
-        sum = MIN(sum, act_max);
-
-        dst[i_ch_in + ch_src * (i_x + i_y * dim_dst_width)] = sum;
-      }
-    }
-  }
-
-#endif
+  ARM_NN_PROFILE_END();
   return ARM_MATH_SUCCESS;
 }
 
-#endif /* ARM_MATH_MVEI */
-
 int32_t arm_avgpool_s8_get_buffer_size(const int dim_dst_width,
                                        const int ch_src)
 {
   (void)dim_dst_width;
-
-#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
-  return (ch_src * sizeof(int16_t));
-#else
   (void)ch_src;
   return 0;
-#endif
 }
 /**
  * @} end of Pooling group
@@ -21,8 +21,8 @@
  * Title:        arm_max_pool_s8.c
  * Description:  Pooling function implementations
  *
- * $Date:        June 11, 2020
- * $Revision:    V.2.0.0
+ * $Date:        October 17, 2020
+ * $Revision:    V.2.1.0
  *
  * Target Processor:  Cortex-M CPUs
  *
@@ -31,147 +31,36 @@
 #include "arm_math.h"
 #include "arm_nnfunctions.h"
 
-static void compare_and_replace_if_larger_q7(q7_t *base,
-                                             const q7_t *target,
-                                             int32_t length)
+__STATIC_FORCEINLINE q7_t pool_output(int32_t val,
+                                      const cmsis_nn_per_tensor_quant_params *quant_params,
+                                      const int32_t input_offset,
+                                      const int32_t output_offset,
+                                      const int32_t act_min,
+                                      const int32_t act_max)
 {
-#if defined(ARM_MATH_MVEI)
-    int32_t loop_count = (length + 15) / 16;
-    for (int i = 0; i < loop_count; i++)
+    if (quant_params != NULL)
     {
-        mve_pred16_t p = vctp16q((uint32_t)length);
-        const int8x16_t op_1 = vldrbq_z_s8(base, p);
-        const int8x16_t op_2 = vldrbq_z_s8(target, p);
-        const int8x16_t max = vmaxq_m_s8(vuninitializedq_s8(), op_1, op_2, p);
-        vstrbq_p_s8(base, max, p);
-        base += 16;
-        target += 16;
-        length -= 16;
+        val = arm_nn_requantize(val + input_offset, quant_params->multiplier, quant_params->shift);
+        val += output_offset;
     }
-#else
-    q7_t *dst = base;
-    const q7_t *src = target;
-    union arm_nnword ref_max;
-    union arm_nnword comp_max;
-    int32_t cnt = length >> 2;
-
-    while (cnt > 0l)
-    {
-        ref_max.word = arm_nn_read_q7x4(dst);
-        comp_max.word = arm_nn_read_q7x4_ia(&src);
-
-        if (comp_max.bytes[0] > ref_max.bytes[0])
-        {
-            ref_max.bytes[0] = comp_max.bytes[0];
-        }
-        if (comp_max.bytes[1] > ref_max.bytes[1])
-        {
-            ref_max.bytes[1] = comp_max.bytes[1];
-        }
-        if (comp_max.bytes[2] > ref_max.bytes[2])
-        {
-            ref_max.bytes[2] = comp_max.bytes[2];
-        }
-        if (comp_max.bytes[3] > ref_max.bytes[3])
-        {
-            ref_max.bytes[3] = comp_max.bytes[3];
-        }
-
-        write_q7x4_ia(&dst, ref_max.word);
-
-        cnt--;
-    }
-
-    cnt = length & 0x3;
-    while (cnt > 0l)
-    {
-        if (*src > *dst)
-        {
-            *dst = *src;
-        }
-        dst++;
-        src++;
-        cnt--;
-    }
-#endif
-}
-
-static void
-clamp_output(q7_t *source, int32_t length, const int32_t act_min, const int32_t act_max)
-{
-#if defined(ARM_MATH_MVEI)
-    int32_t
-        loop_count = (length + 15) / 16;
-    for (int i = 0; i < loop_count; i++)
-    {
-        mve_pred16_t p = vctp16q((uint32_t)length);
-        length -= 16;
-        const int8x16_t src = vldrbq_z_s8(source, p);
-        const int8x16_t predicated_min = vdupq_m_n_s8(vuninitializedq_s8(), (int8_t)act_min, p);
-        const int8x16_t predicated_max = vdupq_m_n_s8(vuninitializedq_s8(), (int8_t)act_max, p);
-        int8x16_t
-            res = vmaxq_m_s8(vuninitializedq_s8(), src, predicated_min, p);
-        res = vminq_m_s8(vuninitializedq_s8(), src, predicated_max, p);
-        vstrbq_p_s8(source, res, p);
-        source += 16;
-    }
-#else
-    union arm_nnword in;
-    int32_t cnt = length >> 2;
-
-    while (cnt > 0l)
-    {
-        in.word = arm_nn_read_q7x4(source);
-
-        in.bytes[0] = MAX(in.bytes[0], act_min);
-        in.bytes[0] = MIN(in.bytes[0], act_max);
-        in.bytes[1] = MAX(in.bytes[1], act_min);
-        in.bytes[1] = MIN(in.bytes[1], act_max);
-        in.bytes[2] = MAX(in.bytes[2], act_min);
-        in.bytes[2] = MIN(in.bytes[2], act_max);
-        in.bytes[3] = MAX(in.bytes[3], act_min);
-        in.bytes[3] = MIN(in.bytes[3], act_max);
-
-        write_q7x4_ia(&source, in.word);
-        cnt--;
-    }
-
-    cnt = length & 0x3;
-    while (cnt > 0l)
-    {
-        int32_t comp = *source;
-        comp = MAX(comp, act_min);
-        comp = MIN(comp, act_max);
-        *source++ = (int8_t)comp;
-        cnt--;
-    }
-#endif
+    val = MAX(val, act_min);
+    val = MIN(val, act_max);
+    return (q7_t)val;
 }
 
-/**
- *  @ingroup groupNN
- */
-
-/**
- * @addtogroup Pooling
- * @{
- */
-
 /*
-   * Optimized s8 max pooling function
-   *
-   * Refer to header file for details.
-   *
-   */
-
-arm_status
-arm_max_pool_s8(const cmsis_nn_context *ctx,
-                const cmsis_nn_pool_params *pool_params,
-                const cmsis_nn_dims *input_dims,
-                const q7_t *src,
-                const cmsis_nn_dims *filter_dims,
-                const cmsis_nn_dims *output_dims,
-                q7_t *dst)
+ * Max pooling core. The maximum of a block of channels is kept in registers for the whole
+ * kernel window and written once, after the optional requantization and the activation.
+ */
+static void max_pool_s8(const cmsis_nn_pool_params *pool_params,
+                        const cmsis_nn_per_tensor_quant_params *quant_params,
+                        const int32_t input_offset,
+                        const int32_t output_offset,
+                        const cmsis_nn_dims *input_dims,
+                        const q7_t *src,
+                        const cmsis_nn_dims *filter_dims,
+                        const cmsis_nn_dims *output_dims,
+                        q7_t *dst)
 {
     const int32_t input_y = input_dims->h;
     const int32_t input_x = input_dims->w;
@@ -186,8 +75,10 @@ arm_max_pool_s8(const cmsis_nn_context *ctx,
     const int32_t act_min = pool_params->activation.min;
     const int32_t act_max = pool_params->activation.max;
     const int32_t channel_in = input_dims->c;
-    (void)ctx;
-    q7_t *dst_base = dst;
+#if defined(ARM_MATH_DSP) && !defined(ARM_MATH_MVEI)
+    const q31_t act_min_x4 = (q31_t)(0x01010101UL * (uint8_t)act_min);
+    const q31_t act_max_x4 = (q31_t)(0x01010101UL * (uint8_t)act_max);
+#endif
 
     for (int i_y = 0, base_idx_y = -pad_y; i_y < output_y; base_idx_y += stride_y, i_y++)
     {
@@ -201,32 +92,159 @@ arm_max_pool_s8(const cmsis_nn_context *ctx,
             const int32_t kernel_y_end = MIN(kernel_y, input_y - base_idx_y);
             const int32_t kernel_x_end = MIN(kernel_x, input_x - base_idx_x);
 
-            int count = 0;
+            const q7_t *base = src + channel_in * (base_idx_x + base_idx_y * input_x);
+            q7_t *out = dst;
+            int32_t i_ch = 0;
 
-            for (int k_y = ker_y_start; k_y < kernel_y_end; k_y++)
+#if defined(ARM_MATH_MVEI)
+            for (; i_ch < channel_in; i_ch += 16, out += 16)
             {
-                for (int k_x = ker_x_start; k_x < kernel_x_end; k_x++)
+                const mve_pred16_t p = vctp8q((uint32_t)(channel_in - i_ch));
+                int8x16_t max = vdupq_n_s8(Q7_MIN);
+
+                for (int k_y = ker_y_start; k_y < kernel_y_end; k_y++)
+                {
+                    for (int k_x = ker_x_start; k_x < kernel_x_end; k_x++)
+                    {
+                        const q7_t *start = base + i_ch + channel_in * (k_x + k_y * input_x);
+                        max = vmaxq_s8(max, vldrbq_z_s8(start, p));
+                    }
+                }
+
+                if (quant_params == NULL)
+                {
+                    max = vmaxq_s8(max, vdupq_n_s8((int8_t)act_min));
+                    max = vminq_s8(max, vdupq_n_s8((int8_t)act_max));
+                    vstrbq_p_s8(out, max, p);
+                }
+                else
                 {
-                    const q7_t *start = src + channel_in * (k_x + base_idx_x + (k_y + base_idx_y) * input_x);
+                    q7_t max_buf[16];
+                    const int32_t num_ch = MIN(16, channel_in - i_ch);
+                    vstrbq_s8(max_buf, max);
+                    for (int32_t i = 0; i < num_ch; i++)
+                    {
+                        out[i] = pool_output(max_buf[i], quant_params, input_offset, output_offset, act_min, act_max);
+                    }
+                }
+            }
+#elif defined(ARM_MATH_DSP)
+            for (; i_ch <= channel_in - 4; i_ch += 4)
+            {
+                q31_t max = (q31_t)0x80808080UL;
 
-                    if (count == 0)
+                for (int k_y = ker_y_start; k_y < kernel_y_end; k_y++)
+                {
+                    for (int k_x = ker_x_start; k_x < kernel_x_end; k_x++)
                     {
-                        memcpy(dst, start, channel_in);
-                        count++;
+                        const q31_t in = arm_nn_read_q7x4(base + i_ch + channel_in * (k_x + k_y * input_x));
+
+                        /* GE flags are set for the lanes where in >= max */
+                        (void)__SSUB8(in, max);
+                        max = __SEL(in, max);
                     }
-                    else
+                }
+
+                if (quant_params == NULL)
+                {
+                    (void)__SSUB8(max, act_min_x4);
+                    max = __SEL(max, act_min_x4);
+                    (void)__SSUB8(max, act_max_x4);
+                    max = __SEL(act_max_x4, max);
+                    write_q7x4_ia(&out, max);
+                }
+                else
+                {
+                    union arm_nnword max_word;
+                    max_word.word = max;
+                    *out++ = pool_output(max_word.bytes[0], quant_params, input_offset, output_offset, act_min, act_max);
+                    *out++ = pool_output(max_word.bytes[1], quant_params, input_offset, output_offset, act_min, act_max);
+                    *out++ = pool_output(max_word.bytes[2], quant_params, input_offset, output_offset, act_min, act_max);
+                    *out++ = pool_output(max_word.bytes[3], quant_params, input_offset, output_offset, act_min, act_max);
+                }
+            }
+#endif
+            for (; i_ch < channel_in; i_ch++)
+            {
+                int32_t max = Q7_MIN;
+
+                for (int k_y = ker_y_start; k_y < kernel_y_end; k_y++)
+                {
+                    for (int k_x = ker_x_start; k_x < kernel_x_end; k_x++)
                     {
-                        compare_and_replace_if_larger_q7(dst, start, channel_in);
+                        max = MAX(max, base[i_ch + channel_in * (k_x + k_y * input_x)]);
                     }
                 }
+                *out++ = pool_output(max, quant_params, input_offset, output_offset, act_min, act_max);
             }
-            /* 'count' is expected to be non-zero here. */
             dst += channel_in;
         }
     }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/*
+   * Optimized s8 max pooling function
+   *
+   * Refer to header file for details.
+   *
+   */
+
+arm_status
+arm_max_pool_s8(const cmsis_nn_context *ctx,
+                const cmsis_nn_pool_params *pool_params,
+                const cmsis_nn_dims *input_dims,
+                const q7_t *src,
+                const cmsis_nn_dims *filter_dims,
+                const cmsis_nn_dims *output_dims,
+                q7_t *dst)
+{
+    (void)ctx;
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_MAX_POOL_S8, input_dims, filter_dims, output_dims, 0);
+
+    max_pool_s8(pool_params, NULL, 0, 0, input_dims, src, filter_dims, output_dims, dst);
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/*
+   * s8 max pooling function with fused requantization
+   *
+   * Refer to header file for details.
+   *
+   */
+
+arm_status
+arm_max_pool_s8_requantize(const cmsis_nn_context *ctx,
+                           const cmsis_nn_pool_params *pool_params,
+                           const cmsis_nn_per_tensor_quant_params *quant_params,
+                           const int32_t input_offset,
+                           const int32_t output_offset,
+                           const cmsis_nn_dims *input_dims,
+                           const q7_t *src,
+                           const cmsis_nn_dims *filter_dims,
+                           const cmsis_nn_dims *output_dims,
+                           q7_t *dst)
+{
+    (void)ctx;
+    if (quant_params == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_MAX_POOL_S8, input_dims, filter_dims, output_dims, 0);
 
-    clamp_output(dst_base, output_x * output_y * channel_in, act_min, act_max);
+    max_pool_s8(pool_params, quant_params, input_offset, output_offset, input_dims, src, filter_dims, output_dims, dst);
 
+    ARM_NN_PROFILE_END();
     return ARM_MATH_SUCCESS;
 }
 
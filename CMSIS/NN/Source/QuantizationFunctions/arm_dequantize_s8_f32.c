@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_dequantize_s8_f32
+ * Description:  Dequantization of a s8 vector to float32
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Quantization
+ * @{
+ */
+
+/*
+ * Dequantization of a s8 vector to float32
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_dequantize_s8_f32(const q7_t *input,
+                                 const int32_t input_offset,
+                                 const float32_t input_scale,
+                                 float32_t *output,
+                                 const int32_t block_size)
+{
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_DEQUANTIZE_S8_F32, NULL, NULL, NULL, 0);
+
+#if defined(ARM_MATH_MVEF)
+    for (int32_t i = 0; i < block_size; i += 4)
+    {
+        const mve_pred16_t p = vctp32q((uint32_t)(block_size - i));
+        const int32x4_t val = vaddq_n_s32(vldrbq_z_s32(&input[i], p), input_offset);
+        vstrwq_p_f32(&output[i], vmulq_n_f32(vcvtq_f32_s32(val), input_scale), p);
+    }
+#else
+    for (int32_t i = 0; i < block_size; i++)
+    {
+        output[i] = (float32_t)(input[i] + input_offset) * input_scale;
+    }
+#endif
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Quantization group
+ */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_quantize_f32_s16
+ * Description:  Quantization of a float32 vector to s16
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Quantization
+ * @{
+ */
+
+/*
+ * Quantization of a float32 vector to s16
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_quantize_f32_s16(const float32_t *input,
+                                q15_t *output,
+                                const float32_t output_scale,
+                                const int32_t output_offset,
+                                const int32_t block_size)
+{
+    if (!(output_scale > 0.0f))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_QUANTIZE_F32_S16, NULL, NULL, NULL, 0);
+
+    const float32_t inv_scale = 1.0f / output_scale;
+    // The limits are integers, so clamping before the rounding is the same as clamping after it
+    const float32_t min_val = (float32_t)(Q15_MIN - output_offset);
+    const float32_t max_val = (float32_t)(Q15_MAX - output_offset);
+
+#if defined(ARM_MATH_MVEF)
+    for (int32_t i = 0; i < block_size; i += 4)
+    {
+        const mve_pred16_t p = vctp32q((uint32_t)(block_size - i));
+        float32x4_t val = vmulq_n_f32(vldrwq_z_f32(&input[i], p), inv_scale);
+        val = vmaxnmq_f32(vminnmq_f32(val, vdupq_n_f32(max_val)), vdupq_n_f32(min_val));
+        // Round to nearest with ties away from zero
+        const int32x4_t res = vaddq_n_s32(vcvtaq_s32_f32(val), output_offset);
+        vstrhq_p_s32(&output[i], res, p);
+    }
+#else
+    for (int32_t i = 0; i < block_size; i++)
+    {
+        const float32_t val = CLAMP(input[i] * inv_scale, max_val, min_val);
+        output[i] = (q15_t)((int32_t)roundf(val) + output_offset);
+    }
+#endif
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Quantization group
+ */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_requantize_per_channel_s8
+ * Description:  Requantization of a s8 tensor with per-channel parameters
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Quantization
+ * @{
+ */
+
+/*
+ * Requantization of a s8 tensor with per-channel parameters
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_requantize_per_channel_s8(const q7_t *input,
+                                         const int32_t input_offset,
+                                         q7_t *output,
+                                         const int32_t output_offset,
+                                         const cmsis_nn_per_channel_quant_params *quant_params,
+                                         const int32_t num_channels,
+                                         const int32_t block_size)
+{
+    if (num_channels <= 0 || block_size % num_channels != 0)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_REQUANTIZE_PER_CHANNEL_S8, NULL, NULL, NULL, 0);
+
+    const int32_t *out_mult = quant_params->multiplier;
+    const int32_t *out_shift = quant_params->shift;
+    const int32_t num_rows = block_size / num_channels;
+
+    for (int32_t i_row = 0; i_row < num_rows; i_row++)
+    {
+#if defined(ARM_MATH_MVEI)
+        for (int32_t i_ch = 0; i_ch < num_channels; i_ch += 4)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)(num_channels - i_ch));
+            const int32x4_t mult = vldrwq_z_s32(&out_mult[i_ch], p);
+            const int32x4_t shift = vldrwq_z_s32(&out_shift[i_ch], p);
+            int32x4_t val = vaddq_n_s32(vldrbq_z_s32(&input[i_ch], p), input_offset);
+            val = arm_requantize_mve_32x4(val, mult, shift);
+            val = vaddq_n_s32(val, output_offset);
+            val = vmaxq_s32(vminq_s32(val, vdupq_n_s32(Q7_MAX)), vdupq_n_s32(Q7_MIN));
+            vstrbq_p_s32(&output[i_ch], val, p);
+        }
+#else
+        for (int32_t i_ch = 0; i_ch < num_channels; i_ch++)
+        {
+            int32_t val =
+                arm_nn_requantize(input[i_ch] + input_offset, out_mult[i_ch], out_shift[i_ch]) + output_offset;
+            output[i_ch] = (q7_t)CLAMP(val, (int32_t)Q7_MAX, (int32_t)Q7_MIN);
+        }
+#endif
+        input += num_channels;
+        output += num_channels;
+    }
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Quantization group
+ */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pad_s8.c
+ * Description:  Constant padding of a s8 tensor
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Reshape
+ * @{
+ */
+
+/*
+ * s8 constant padding.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_pad_s8(const cmsis_nn_dims *input_dims,
+                      const q7_t *input,
+                      const cmsis_nn_dims *pad_before,
+                      const cmsis_nn_dims *pad_after,
+                      const q7_t pad_value,
+                      q7_t *output)
+{
+    if (pad_before->n < 0 || pad_before->h < 0 || pad_before->w < 0 || pad_before->c < 0 ||
+        pad_after->n < 0 || pad_after->h < 0 || pad_after->w < 0 || pad_after->c < 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_h = input_dims->h;
+    const int32_t input_w = input_dims->w;
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_batches = input_batches + pad_before->n + pad_after->n;
+    const int32_t output_h = input_h + pad_before->h + pad_after->h;
+    const int32_t output_w = input_w + pad_before->w + pad_after->w;
+    const int32_t output_ch = input_ch + pad_before->c + pad_after->c;
+    const int32_t output_row_size = output_w * output_ch;
+    const int32_t input_row_size = input_w * input_ch;
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_PAD_S8, input_dims, NULL, NULL, 0);
+
+    /* The output is written from the end, every element is at the same or a higher address in the output than in
+       the input. That allows the input to be at the start of the output buffer. */
+    for (int32_t i_batch = output_batches - 1; i_batch >= 0; i_batch--)
+    {
+        const int32_t i_in_batch = i_batch - pad_before->n;
+
+        for (int32_t i_y = output_h - 1; i_y >= 0; i_y--)
+        {
+            const int32_t i_in_y = i_y - pad_before->h;
+            q7_t *out_row = output + (i_batch * output_h + i_y) * output_row_size;
+
+            if (i_in_batch < 0 || i_in_batch >= input_batches || i_in_y < 0 || i_in_y >= input_h)
+            {
+                memset(out_row, pad_value, output_row_size);
+                continue;
+            }
+
+            const q7_t *in_row = input + (i_in_batch * input_h + i_in_y) * input_row_size;
+            q7_t *out = out_row + pad_before->w * output_ch;
+
+            if (output_ch == input_ch)
+            {
+                /* The channels are not padded, the row of the input is one block */
+                memmove(out, in_row, input_row_size);
+            }
+            else
+            {
+                for (int32_t i_x = input_w - 1; i_x >= 0; i_x--)
+                {
+                    q7_t *out_pos = out + i_x * output_ch;
+                    memmove(out_pos + pad_before->c, in_row + i_x * input_ch, input_ch);
+                    memset(out_pos, pad_value, pad_before->c);
+                    memset(out_pos + pad_before->c + input_ch, pad_value, pad_after->c);
+                }
+            }
+            memset(out_row, pad_value, pad_before->w * output_ch);
+            memset(out + input_w * output_ch, pad_value, pad_after->w * output_ch);
+        }
+    }
+
+    ARM_NN_PROFILE_END();
+
+    return ARM_MATH_SUCCESS;
+}
+
+/*
+ * Padding folded into the padding of a convolution.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_pad_s8_fold_conv(const cmsis_nn_dims *pad_before,
+                                const cmsis_nn_dims *pad_after,
+                                const q7_t pad_value,
+                                cmsis_nn_conv_params *conv_params)
+{
+    /* The convolution pads with the input zero point in H and W only */
+    if (pad_before->n != 0 || pad_after->n != 0 || pad_before->c != 0 || pad_after->c != 0 ||
+        pad_before->h < 0 || pad_before->w < 0 || pad_after->h < 0 || pad_after->w < 0 ||
+        pad_value != -conv_params->input_offset)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    conv_params->padding.w += pad_before->w;
+    conv_params->padding.h += pad_before->h;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Reshape group
+ */
@@ -50,7 +50,11 @@ void arm_reshape_s8(const int8_t *input,
                     int8_t *output,
                     const uint32_t total_size)
 {
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_RESHAPE_S8, NULL, NULL, NULL, 0);
+
     memcpy(output, input, total_size);
+
+    ARM_NN_PROFILE_END();
 }
 
 /**
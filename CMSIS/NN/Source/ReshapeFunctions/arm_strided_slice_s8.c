@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_strided_slice_s8.c
+ * Description:  Strided slice of a s8 tensor
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Reshape
+ * @{
+ */
+
+// Checks that begin + i * stride, i in [0, count), is within [0, size)
+static int32_t in_range(const int32_t begin, const int32_t stride, const int32_t count, const int32_t size)
+{
+    const int32_t last = begin + (count - 1) * stride;
+    return stride != 0 && count > 0 && begin >= 0 && begin < size && last >= 0 && last < size;
+}
+
+/*
+ * s8 strided slice.
+ *
+ * Refer header file for details.
+ *
+ */
+
+arm_status arm_strided_slice_s8(const cmsis_nn_dims *input_dims,
+                                const q7_t *input,
+                                const cmsis_nn_dims *begin,
+                                const cmsis_nn_dims *stride,
+                                const cmsis_nn_dims *output_dims,
+                                q7_t *output)
+{
+    if (!in_range(begin->n, stride->n, output_dims->n, input_dims->n) ||
+        !in_range(begin->h, stride->h, output_dims->h, input_dims->h) ||
+        !in_range(begin->w, stride->w, output_dims->w, input_dims->w) ||
+        !in_range(begin->c, stride->c, output_dims->c, input_dims->c))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const int32_t input_h = input_dims->h;
+    const int32_t input_w = input_dims->w;
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_w = output_dims->w;
+    const int32_t output_ch = output_dims->c;
+
+    /* Number of consecutive elements that are copied as one block, and the number of blocks in a row */
+    int32_t block_size = 1;
+    int32_t num_blocks = output_w * output_ch;
+    if (stride->c == 1)
+    {
+        block_size = output_ch;
+        num_blocks = output_w;
+        if (stride->w == 1 && output_ch == input_ch)
+        {
+            block_size = output_w * output_ch;
+            num_blocks = 1;
+        }
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_STRIDED_SLICE_S8, input_dims, NULL, output_dims, 0);
+
+    for (int32_t i_batch = 0; i_batch < output_dims->n; i_batch++)
+    {
+        const int32_t i_in_batch = begin->n + i_batch * stride->n;
+
+        for (int32_t i_y = 0; i_y < output_dims->h; i_y++)
+        {
+            const int32_t i_in_y = begin->h + i_y * stride->h;
+            const q7_t *in_row = input + ((i_in_batch * input_h + i_in_y) * input_w + begin->w) * input_ch + begin->c;
+
+            if (block_size == 1)
+            {
+                for (int32_t i_x = 0; i_x < output_w; i_x++)
+                {
+                    const q7_t *in = in_row + i_x * stride->w * input_ch;
+                    for (int32_t i_ch = 0; i_ch < output_ch; i_ch++)
+                    {
+                        *output++ = in[i_ch * stride->c];
+                    }
+                }
+            }
+            else
+            {
+                /* The output is never ahead of the input for positive strides, memmove allows an in-place slice */
+                for (int32_t i_block = 0; i_block < num_blocks; i_block++)
+                {
+                    memmove(output, in_row + i_block * stride->w * input_ch, block_size);
+                    output += block_size;
+                }
+            }
+        }
+    }
+
+    ARM_NN_PROFILE_END();
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Reshape group
+ */
@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_log_softmax_s8.c
+ * Description:  S8 log softmax function
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+// Integer bits of the fixed point formats used. Must agree with the ones used to calculate the
+// input multiplier and diff_min, i.e. input is Q5.26, sum of exponents is Q12.19 and output Q4.27.
+#define INPUT_INTEGER_BITS 5
+#define ACCUM_BITS 12
+#define OUTPUT_INTEGER_BITS 4
+#define OUTPUT_ZERO_POINT 127
+
+// Saturating rounding multiply by 2^exponent, where exponent can be negative
+static int32_t mult_by_power_of_two_param(const int32_t val, const int32_t exponent)
+{
+    if (exponent > 0)
+    {
+        return MUL_POW2(val, exponent);
+    }
+    else if (exponent < 0)
+    {
+        return DIV_POW2(val, -exponent);
+    }
+    return val;
+}
+
+static int32_t sat_add(const int32_t a, const int32_t b)
+{
+    const int64_t sum = (int64_t)a + b;
+    return (int32_t)CLAMP(sum, (int64_t)Q31_MAX, (int64_t)Q31_MIN);
+}
+
+static int32_t sat_sub(const int32_t a, const int32_t b)
+{
+    const int64_t diff = (int64_t)a - b;
+    return (int32_t)CLAMP(diff, (int64_t)Q31_MAX, (int64_t)Q31_MIN);
+}
+
+static int32_t rounding_half_sum(const int32_t a, const int32_t b)
+{
+    const int64_t sum = (int64_t)a + b;
+    return (int32_t)((sum + (sum >= 0 ? 1 : -1)) / 2);
+}
+
+/*
+ * Natural logarithm for x >= 1. Input is in Q12.19 and the result in Q5.26.
+ * The computation follows the one used by TensorFlow Lite, i.e. a rational approximation of
+ * log(r) with r in [sqrt(1/2), sqrt(2)] combined with the power of two of the input.
+ */
+static int32_t log_x_for_x_greater_than_or_equal_to_1(const int32_t val)
+{
+    // One extra integer bit of headroom for the accumulation
+#define LOG_ACCUM_BITS (INPUT_INTEGER_BITS + 1)
+    const int32_t log_2 = 1488522236;          // log(2) in Q0.31
+    const int32_t sqrt_sqrt_half = 1805811301; // sqrt(sqrt(1/2)) in Q0.31
+    const int32_t sqrt_half = 1518500250;      // sqrt(1/2) in Q0.31
+    const int32_t one_quarter = 536870912;     // 1/4 in Q0.31
+
+    const int32_t alpha_n = 117049297;  // 11/240 * sqrt(sqrt(2)) in Q0.31
+    const int32_t alpha_d = 127690142;  // 1/20 * sqrt(sqrt(2)) in Q0.31
+    const int32_t alpha_i = 1057819769; // 2/sqrt(sqrt(2)) - sqrt(sqrt(2)) in Q0.31
+    const int32_t alpha_f = 638450708;  // 1/4 * sqrt(sqrt(2)) in Q0.31
+
+    const int32_t shifted_quarter = DIV_POW2(one_quarter, LOG_ACCUM_BITS);
+
+    // The input is reinterpreted as Q0.31 and the power of two is tracked separately
+    const int32_t z_a = val;
+    const int32_t z_a_headroom_plus_1 = __CLZ((uint32_t)z_a);
+    const int32_t r_a_tmp = mult_by_power_of_two_param(z_a, z_a_headroom_plus_1 - 1);
+    const int32_t r_a_raw = mult_by_power_of_two_param(MUL_SAT(r_a_tmp, sqrt_half), 1);
+    const int32_t z_a_pow_2_adj =
+        sat_add(mult_by_power_of_two_param(ACCUM_BITS - z_a_headroom_plus_1, 31 - LOG_ACCUM_BITS),
+                shifted_quarter);
+
+    // z_b is treated like z_a but premultiplied by sqrt(1/2)
+    const int32_t z_b = MUL_SAT(z_a, sqrt_half);
+    const int32_t z_b_headroom = __CLZ((uint32_t)z_b) - 1;
+    const int32_t r_b_raw = mult_by_power_of_two_param(z_a, z_b_headroom);
+    const int32_t z_b_pow_2_adj =
+        sat_sub(mult_by_power_of_two_param(ACCUM_BITS - z_b_headroom, 31 - LOG_ACCUM_BITS), shifted_quarter);
+
+    const int32_t r = MIN(r_a_raw, r_b_raw);
+    const int32_t z_pow_2_adj = MAX(z_a_pow_2_adj, z_b_pow_2_adj);
+
+    const int32_t p = rounding_half_sum(r, sqrt_sqrt_half);
+    int32_t q = r - sqrt_sqrt_half;
+    q = q + q;
+
+    const int32_t common_sq = MUL_SAT(q, q);
+    const int32_t num = MUL_SAT(q, r) + MUL_SAT(MUL_SAT(q, common_sq), alpha_n);
+    const int32_t denom_minus_one_0 =
+        MUL_SAT(p, alpha_i + q + MUL_SAT(alpha_d, common_sq)) + MUL_SAT(alpha_f, q);
+    const int32_t recip_denom = ONE_OVER1(denom_minus_one_0);
+
+    const int32_t num_scaled = DIV_POW2(num, LOG_ACCUM_BITS);
+    const int32_t result = MUL_SAT(z_pow_2_adj, log_2) + MUL_SAT(num_scaled, recip_denom);
+
+    // Rescale from the accumulator format to the output format
+    return mult_by_power_of_two_param(result, LOG_ACCUM_BITS - INPUT_INTEGER_BITS);
+#undef LOG_ACCUM_BITS
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+/*
+ * S8 log softmax function.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_log_softmax_s8(const cmsis_nn_context *ctx,
+                              const int8_t *input,
+                              const int32_t num_rows,
+                              const int32_t row_size,
+                              const int32_t mult,
+                              const int32_t shift,
+                              const int32_t reverse_mult,
+                              const int32_t reverse_shift,
+                              const int32_t diff_min,
+                              int8_t *output)
+{
+    int32_t *diff_lut = (int32_t *)ctx->buf;
+
+    if (diff_lut == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_LOG_SOFTMAX_S8, NULL, NULL, NULL, 0);
+
+    // The scaled differences and their exponents only depend on (input - max) which is in the range
+    // [-255, 0], so both are tabulated once per call.
+    int32_t *exp_lut = diff_lut + ARM_NN_SOFTMAX_S8_LUT_SIZE;
+    for (int32_t i = 0; i < ARM_NN_SOFTMAX_S8_LUT_SIZE; ++i)
+    {
+        const int32_t diff = -i;
+        if (diff >= diff_min)
+        {
+            diff_lut[i] = arm_nn_requantize(diff, mult, shift);
+            exp_lut[i] = DIV_POW2(EXP_ON_NEG(diff_lut[i]), ACCUM_BITS);
+        }
+        else
+        {
+            diff_lut[i] = 0;
+            exp_lut[i] = 0;
+        }
+    }
+
+    for (int32_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        const int32_t max = arm_nn_max_s8(input, row_size);
+        int32_t sum = 0;
+        int32_t col = 0;
+
+#if defined(ARM_MATH_MVEI)
+        int32_t cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)cnt);
+            const int32x4_t in = vldrbq_z_s32(&input[col], p);
+            const uint32x4_t idx = vreinterpretq_u32_s32(vsubq_s32(vdupq_n_s32(max), in));
+            sum = vaddvaq_p_s32(sum, vldrwq_gather_shifted_offset_z_s32(exp_lut, idx, p), p);
+            col += 4;
+            cnt -= 4;
+        }
+#else
+        for (; col < row_size; ++col)
+        {
+            sum += exp_lut[max - input[col]];
+        }
+#endif
+
+        const int32_t log_sum = log_x_for_x_greater_than_or_equal_to_1(sum);
+
+        // Differences that are too small would saturate to -128 anyway so use the largest of the two limits
+        const int32_t shifted_log_sum = log_sum + Q31_MIN;
+        const int32_t adjusted_diff_min =
+            MAX(diff_min - 1, arm_nn_requantize(shifted_log_sum, reverse_mult, reverse_shift));
+
+#if defined(ARM_MATH_MVEI)
+        col = 0;
+        cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)cnt);
+            const int32x4_t in = vsubq_s32(vldrbq_z_s32(&input[col], p), vdupq_n_s32(max));
+            const uint32x4_t idx = vreinterpretq_u32_s32(vnegq_s32(in));
+            int32x4_t res = vldrwq_gather_shifted_offset_z_s32(diff_lut, idx, p);
+            res = DIV_POW2_MVE(vsubq_s32(res, vdupq_n_s32(log_sum)), 31 - INPUT_INTEGER_BITS - OUTPUT_INTEGER_BITS);
+            res = vaddq_n_s32(res, OUTPUT_ZERO_POINT);
+            res = vmaxq_s32(res, vdupq_n_s32((int32_t)Q7_MIN));
+            res = vminq_s32(res, vdupq_n_s32((int32_t)Q7_MAX));
+            const mve_pred16_t valid = vcmpgtq_n_s32(in, adjusted_diff_min);
+            res = vpselq_s32(res, vdupq_n_s32((int32_t)Q7_MIN), valid);
+            vstrbq_p_s32(&output[col], res, p);
+            col += 4;
+            cnt -= 4;
+        }
+#else
+        for (col = 0; col < row_size; ++col)
+        {
+            const int32_t diff = input[col] - max;
+            if (diff > adjusted_diff_min)
+            {
+                int32_t res = DIV_POW2(diff_lut[-diff] - log_sum, 31 - INPUT_INTEGER_BITS - OUTPUT_INTEGER_BITS);
+                res += OUTPUT_ZERO_POINT;
+                output[col] = (int8_t)CLAMP(res, (int32_t)Q7_MAX, (int32_t)Q7_MIN);
+            }
+            else
+            {
+                output[col] = (int8_t)Q7_MIN;
+            }
+        }
+#endif
+        input += row_size;
+        output += row_size;
+    }
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_log_softmax_s8_get_buffer_size(void)
+{
+    return 2 * ARM_NN_SOFTMAX_S8_LUT_SIZE * (int32_t)sizeof(int32_t);
+}
+
+/**
+ * @} end of Softmax group
+ */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_s16.c
+ * Description:  S16 softmax function
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.1
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+/*
+ * S16 softmax function.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_softmax_s16(const int16_t *input,
+                           const int32_t num_rows,
+                           const int32_t row_size,
+                           const int32_t mult,
+                           const int32_t shift,
+                           const cmsis_nn_softmax_lut_s16 *softmax_params,
+                           int16_t *output)
+{
+    if (softmax_params->exp_lut == NULL || softmax_params->one_by_one_lut == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_SOFTMAX_S16, NULL, NULL, NULL, 0);
+
+    for (int32_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        // Find the maximum value in order to ensure numerical stability
+        const int32_t max = arm_nn_max_s16(input, row_size);
+
+        // The output buffer is used to cache the exponents in Q0.15
+        int16_t *cached_exp_results = output;
+        int32_t sum = 0;
+        int32_t col = 0;
+
+#if defined(ARM_MATH_MVEI)
+        int32_t cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)cnt);
+            const int32x4_t diff = vsubq_s32(vldrhq_z_s32(&input[col], p), vdupq_n_s32(max));
+
+            // Scale the difference such that [-65535, 0] corresponds to [-10.0, 0.0] and recenter it to int16
+            int32x4_t scaled_diff = vaddq_n_s32(arm_requantize_mve(diff, mult, shift), Q15_MAX);
+            scaled_diff = vmaxq_s32(scaled_diff, vdupq_n_s32((int32_t)Q15_MIN));
+            scaled_diff = vminq_s32(scaled_diff, vdupq_n_s32((int32_t)Q15_MAX));
+
+            const int32x4_t exp_res = arm_nn_lut_lookup_mve_s16(softmax_params->exp_lut, scaled_diff, p);
+            vstrhq_p_s32(&cached_exp_results[col], exp_res, p);
+            sum = vaddvaq_p_s32(sum, exp_res, p);
+            col += 4;
+            cnt -= 4;
+        }
+#else
+        for (; col < row_size; ++col)
+        {
+            const int32_t diff = input[col] - max;
+
+            // Scale the difference such that [-65535, 0] corresponds to [-10.0, 0.0] and recenter it to int16
+            const int32_t scaled_diff = arm_nn_requantize(diff, mult, shift) + Q15_MAX;
+            const int32_t sat_scaled_diff = CLAMP(scaled_diff, (int32_t)Q15_MAX, (int32_t)Q15_MIN);
+
+            cached_exp_results[col] = arm_nn_lut_lookup_s16(softmax_params->exp_lut, sat_scaled_diff);
+            sum += cached_exp_results[col];
+        }
+#endif
+
+        // Compute the reciprocal 1/sum. The look-up table computes 1/(1 + x), so the input must be
+        // x = sum - 1 recentered from [0, 65535] to [-32768, 32767], i.e. shifted by -(65536 + 32768).
+        const int32_t headroom_plus_one = __CLZ((uint32_t)sum);
+        const int32_t shifted_sum = (int32_t)((((int64_t)sum << (headroom_plus_one - 1)) + (1 << 13)) >> 14);
+        const int32_t sym_shifted_sum = CLAMP(shifted_sum - 98304, (int32_t)Q15_MAX, (int32_t)Q15_MIN);
+        const int32_t reciprocal = arm_nn_lut_lookup_s16(softmax_params->one_by_one_lut, sym_shifted_sum);
+
+        // Rescale the exponents with the reciprocal. The output range [0, 32767] corresponds to [0.0, 1.0]
+        const int32_t right_shift = 31 - headroom_plus_one;
+        const int32_t round = 1 << (right_shift - 1);
+
+#if defined(ARM_MATH_MVEI)
+        col = 0;
+        cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)cnt);
+            int32x4_t res = vldrhq_z_s32(&cached_exp_results[col], p);
+            res = vaddq_n_s32(vmulq_n_s32(res, reciprocal), round);
+            res = vshlq_s32(res, vdupq_n_s32(-right_shift));
+            res = vmaxq_s32(res, vdupq_n_s32(0));
+            res = vminq_s32(res, vdupq_n_s32((int32_t)Q15_MAX));
+            vstrhq_p_s32(&output[col], res, p);
+            col += 4;
+            cnt -= 4;
+        }
+#else
+        for (col = 0; col < row_size; ++col)
+        {
+            const int32_t res = (cached_exp_results[col] * reciprocal + round) >> right_shift;
+            output[col] = (int16_t)CLAMP(res, (int32_t)Q15_MAX, 0);
+        }
+#endif
+        input += row_size;
+        output += row_size;
+    }
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Softmax group
+ */
@@ -89,6 +89,8 @@ void arm_softmax_s8(const int8_t *input,
                     const int32_t diff_min,
                     int8_t *output)
 {
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_SOFTMAX_S8, NULL, NULL, NULL, 0);
+
 #ifdef ARM_MATH_MVEI
 
 #define ACT_MIN ((int8_t)Q7_MIN)
@@ -251,6 +253,8 @@ void arm_softmax_s8(const int8_t *input,
     }
 
 #endif
+
+    ARM_NN_PROFILE_END();
 }
 /**
  * @} end of Softmax group
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_s8_fast.c
+ * Description:  S8 softmax function using a look-up table for the exponent
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+#define ACCUM_BITS 12
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+/*
+ * S8 softmax function using a look-up table for the exponent.
+ *
+ * Refer header file for details.
+ *
+ */
+arm_status arm_softmax_s8_fast(const cmsis_nn_context *ctx,
+                               const int8_t *input,
+                               const int32_t num_rows,
+                               const int32_t row_size,
+                               const int32_t mult,
+                               const int32_t shift,
+                               const int32_t diff_min,
+                               int8_t *output)
+{
+    int32_t *exp_lut = (int32_t *)ctx->buf;
+
+    if (exp_lut == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    ARM_NN_PROFILE_BEGIN(ARM_NN_KERNEL_SOFTMAX_S8_FAST, NULL, NULL, NULL, 0);
+
+    const int32_t mask = (1 << shift);
+
+    // The difference between an element and the row maximum is in the range [-255, 0] so the exponent
+    // can be evaluated once per call for all possible differences. Differences below diff_min are
+    // stored as zero which makes them vanish from the sum and saturate to -128 in the output.
+    for (int32_t i = 0; i < ARM_NN_SOFTMAX_S8_LUT_SIZE; ++i)
+    {
+        const int32_t diff = -i;
+        exp_lut[i] = diff >= diff_min ? EXP_ON_NEG(MUL_SAT(diff * mask, mult)) : 0;
+    }
+
+    for (int32_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        // Find the maximum value in order to ensure numerical stability
+        const int32_t max = arm_nn_max_s8(input, row_size);
+        int32_t sum = 0;
+        int32_t col = 0;
+
+#if defined(ARM_MATH_MVEI)
+        int32_t cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)cnt);
+            const int32x4_t in = vldrbq_z_s32(&input[col], p);
+            const uint32x4_t idx = vreinterpretq_u32_s32(vsubq_s32(vdupq_n_s32(max), in));
+            int32x4_t res = vldrwq_gather_shifted_offset_z_s32(exp_lut, idx, p);
+            res = DIV_POW2_MVE(res, ACCUM_BITS);
+            sum = vaddvaq_p_s32(sum, res, p);
+            col += 4;
+            cnt -= 4;
+        }
+#else
+#if defined(ARM_MATH_DSP)
+        for (; col < (row_size & ~0x3); col += 4)
+        {
+            union arm_nnword in;
+            in.word = arm_nn_read_q7x4(&input[col]);
+
+            sum += DIV_POW2(exp_lut[max - in.bytes[0]], ACCUM_BITS);
+            sum += DIV_POW2(exp_lut[max - in.bytes[1]], ACCUM_BITS);
+            sum += DIV_POW2(exp_lut[max - in.bytes[2]], ACCUM_BITS);
+            sum += DIV_POW2(exp_lut[max - in.bytes[3]], ACCUM_BITS);
+        }
+#endif
+        for (; col < row_size; ++col)
+        {
+            sum += DIV_POW2(exp_lut[max - input[col]], ACCUM_BITS);
+        }
+#endif
+
+        const int32_t headroom = __CLZ((uint32_t)sum);
+        const int32_t bits_over_unit = ACCUM_BITS - headroom + 23;
+        const int32_t shifted_scale = ONE_OVER1((sum << headroom) - (1 << 31));
+
+#if defined(ARM_MATH_MVEI)
+        col = 0;
+        cnt = row_size;
+        while (cnt > 0)
+        {
+            const mve_pred16_t p = vctp32q((uint32_t)cnt);
+            const int32x4_t in = vldrbq_z_s32(&input[col], p);
+            const uint32x4_t idx = vreinterpretq_u32_s32(vsubq_s32(vdupq_n_s32(max), in));
+            int32x4_t res = vldrwq_gather_shifted_offset_z_s32(exp_lut, idx, p);
+            res = MUL_SAT_MVE(vdupq_n_s32(shifted_scale), res);
+            res = DIV_POW2_MVE(res, bits_over_unit);
+            res = vaddq_n_s32(res, (int32_t)Q7_MIN);
+            res = vmaxq_s32(res, vdupq_n_s32((int32_t)Q7_MIN));
+            res = vminq_s32(res, vdupq_n_s32((int32_t)Q7_MAX));
+            vstrbq_p_s32(&output[col], res, p);
+            col += 4;
+            cnt -= 4;
+        }
+#else
+        for (col = 0; col < row_size; ++col)
+        {
+            const int32_t res =
+                DIV_POW2(MUL_SAT(shifted_scale, exp_lut[max - input[col]]), bits_over_unit) - 128;
+            output[col] = (int8_t)CLAMP(res, (int32_t)127, (int32_t)-128);
+        }
+#endif
+        input += row_size;
+        output += row_size;
+    }
+
+    ARM_NN_PROFILE_END();
+    return ARM_MATH_SUCCESS;
+}
+
+int32_t arm_softmax_s8_fast_get_buffer_size(void)
+{
+    return ARM_NN_SOFTMAX_S8_LUT_SIZE * (int32_t)sizeof(int32_t);
+}
+
+/**
+ * @} end of Softmax group
+ */
@@ -0,0 +1,76 @@
+#
+# Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Checks the profiling hooks of the code paths that the host cannot build. Every kernel source is
+# preprocessed for the C, DSP and MVE paths and the ARM_NN_PROFILE_BEGIN and ARM_NN_PROFILE_END
+# hooks that remain are counted. A path that misses an END, or has one too many, changes the
+# difference between the two counts, which must be the same for all paths of a file.
+#
+#   cmake -DCC=<C compiler> -DNN=<CMSIS/NN directory> -DWORK_DIR=<directory> -P check_profile_hooks.cmake
+
+file(GLOB SOURCES "${NN}/Source/*/*.c")
+set(PATHS "C" "DSP" "MVE")
+set(DEFINES_C "")
+set(DEFINES_DSP "-DARM_MATH_DSP")
+set(DEFINES_MVE "-DARM_MATH_DSP;-DARM_MATH_MVEI")
+set(ERRORS 0)
+
+foreach(SOURCE ${SOURCES})
+  file(READ ${SOURCE} CONTENT)
+  if(NOT CONTENT MATCHES "ARM_NN_PROFILE_BEGIN")
+    continue()
+  endif()
+
+  # The includes are not needed for the conditionals of the paths and the hooks stay unexpanded
+  string(REGEX REPLACE "#[ \t]*include[^\n]*" "" CONTENT "${CONTENT}")
+  get_filename_component(NAME ${SOURCE} NAME)
+  file(WRITE ${WORK_DIR}/${NAME} "${CONTENT}")
+
+  set(FIRST_DIFF "")
+  set(SUMMARY "")
+  foreach(PATH ${PATHS})
+    execute_process(COMMAND ${CC} -E -P ${DEFINES_${PATH}} ${WORK_DIR}/${NAME}
+                    OUTPUT_VARIABLE OUTPUT RESULT_VARIABLE RESULT ERROR_QUIET)
+    if(NOT RESULT EQUAL 0)
+      message(SEND_ERROR "${NAME}: preprocessing for the ${PATH} path failed")
+      math(EXPR ERRORS "${ERRORS} + 1")
+      break()
+    endif()
+    string(REGEX MATCHALL "ARM_NN_PROFILE_BEGIN" BEGINS "${OUTPUT}")
+    string(REGEX MATCHALL "ARM_NN_PROFILE_END" ENDS "${OUTPUT}")
+    list(LENGTH BEGINS NUM_BEGIN)
+    list(LENGTH ENDS NUM_END)
+    math(EXPR DIFF "${NUM_END} - ${NUM_BEGIN}")
+    string(APPEND SUMMARY " ${PATH}: ${NUM_BEGIN} BEGIN ${NUM_END} END")
+    if(FIRST_DIFF STREQUAL "")
+      set(FIRST_DIFF ${DIFF})
+    elseif(NOT DIFF EQUAL FIRST_DIFF)
+      set(FIRST_DIFF "mismatch")
+    endif()
+  endforeach()
+
+  if(FIRST_DIFF STREQUAL "mismatch")
+    message(SEND_ERROR "${NAME}: unbalanced profiling hooks,${SUMMARY}")
+    math(EXPR ERRORS "${ERRORS} + 1")
+  endif()
+endforeach()
+
+if(ERRORS GREATER 0)
+  message(FATAL_ERROR "${ERRORS} kernel sources with unbalanced profiling hooks")
+endif()
+message(STATUS "Profiling hooks balanced on the C, DSP and MVE paths")
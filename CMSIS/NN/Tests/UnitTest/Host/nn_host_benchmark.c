@@ -0,0 +1,822 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host_benchmark.c
+ * Description:  Host benchmark of the CMSIS-NN kernels. Reports ns per call
+ *               and ns per MAC and optionally compares against a baseline.
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host, e.g. x86 Linux
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_nnfunctions.h"
+
+#define NUM_BATCHES 5
+#define MAX_CASES 64
+#define SOFTMAX_LUT_S16_SIZE 513
+
+typedef struct
+{
+    const char *name;
+    void (*setup)(void);
+    arm_status (*run)(void);
+    int32_t args[2]; /* Shape of swept cases, read by setup() through case_args */
+} bench_case;
+
+typedef struct
+{
+    const char *name;
+    int64_t macs;
+    double ns_per_call;
+    double ns_per_mac;
+} bench_result;
+
+/* Shared state of the cases. setup() fills it and run() calls the kernel with it. */
+static int64_t macs;
+static cmsis_nn_context ctx;
+static cmsis_nn_conv_params conv_params;
+static cmsis_nn_dw_conv_params dw_conv_params;
+static cmsis_nn_fc_params fc_params;
+static cmsis_nn_pool_params pool_params;
+static cmsis_nn_per_channel_quant_params channel_quant;
+static cmsis_nn_per_tensor_quant_params tensor_quant;
+static cmsis_nn_dims input_dims;
+static cmsis_nn_dims filter_dims;
+static cmsis_nn_dims bias_dims;
+static cmsis_nn_dims output_dims;
+static cmsis_nn_sparse_weights sparse_weights;
+
+static q7_t *input_data;
+static q7_t *filter_data;
+static int32_t *bias_data;
+static q7_t *output_data;
+static int32_t *output_mult;
+static int32_t *output_shift;
+static uint16_t *block_cols;
+static int32_t *row_offsets;
+static q15_t *input_s16;
+static q15_t *output_s16;
+static const int32_t *case_args;
+static int32_t softmax_rows;
+static int32_t softmax_row_size;
+static q15_t exp_lut[SOFTMAX_LUT_S16_SIZE];
+static q15_t one_by_one_lut[SOFTMAX_LUT_S16_SIZE];
+static cmsis_nn_softmax_lut_s16 softmax_lut;
+
+static uint32_t rand_state = 1;
+
+static uint32_t next_rand(void)
+{
+    rand_state = rand_state * 1664525U + 1013904223U;
+    return rand_state >> 8;
+}
+
+static void *alloc_or_die(size_t size)
+{
+    void *ptr = calloc(size > 0 ? size : 1, 1);
+    if (ptr == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(2);
+    }
+    return ptr;
+}
+
+static void release(void)
+{
+    free(input_data);
+    free(filter_data);
+    free(bias_data);
+    free(output_data);
+    free(output_mult);
+    free(output_shift);
+    free(block_cols);
+    free(row_offsets);
+    free(input_s16);
+    free(output_s16);
+    free(ctx.buf);
+    input_data = filter_data = output_data = NULL;
+    bias_data = output_mult = output_shift = row_offsets = NULL;
+    block_cols = NULL;
+    input_s16 = output_s16 = NULL;
+    ctx.buf = NULL;
+    ctx.size = 0;
+}
+
+static q7_t *random_q7(int32_t size)
+{
+    q7_t *data = alloc_or_die(size);
+    for (int32_t i = 0; i < size; i++)
+    {
+        data[i] = (q7_t)(next_rand() & 0xFF);
+    }
+    return data;
+}
+
+static void allocate(int32_t input_size, int32_t filter_size, int32_t output_ch, int32_t output_size, int32_t buf_size)
+{
+    release();
+    input_data = random_q7(input_size);
+    filter_data = random_q7(filter_size);
+    output_data = alloc_or_die(output_size);
+    bias_data = alloc_or_die(output_ch * sizeof(int32_t));
+    output_mult = alloc_or_die(output_ch * sizeof(int32_t));
+    output_shift = alloc_or_die(output_ch * sizeof(int32_t));
+    for (int32_t i = 0; i < output_ch; i++)
+    {
+        bias_data[i] = (int32_t)(next_rand() & 0x3FF) - 512;
+        output_mult[i] = 1288490189 + (int32_t)(next_rand() & 0xFFFF);
+        output_shift[i] = -8;
+    }
+    ctx.buf = buf_size > 0 ? alloc_or_die(buf_size) : NULL;
+    ctx.size = buf_size;
+
+    channel_quant.multiplier = output_mult;
+    channel_quant.shift = output_shift;
+    tensor_quant.multiplier = output_mult[0];
+    tensor_quant.shift = output_shift[0];
+}
+
+static void set_dims(cmsis_nn_dims *dims, int32_t n, int32_t h, int32_t w, int32_t c)
+{
+    dims->n = n;
+    dims->h = h;
+    dims->w = w;
+    dims->c = c;
+}
+
+static void setup_conv(int32_t in_h, int32_t in_w, int32_t in_c, int32_t k_h, int32_t k_w, int32_t out_c,
+                       int32_t pad_h, int32_t pad_w)
+{
+    const int32_t out_h = in_h + 2 * pad_h - k_h + 1;
+    const int32_t out_w = in_w + 2 * pad_w - k_w + 1;
+
+    set_dims(&input_dims, 1, in_h, in_w, in_c);
+    set_dims(&filter_dims, out_c, k_h, k_w, in_c);
+    set_dims(&bias_dims, 1, 1, 1, out_c);
+    set_dims(&output_dims, 1, out_h, out_w, out_c);
+
+    conv_params.input_offset = 128;
+    conv_params.output_offset = -128;
+    conv_params.stride.h = conv_params.stride.w = 1;
+    conv_params.padding.h = pad_h;
+    conv_params.padding.w = pad_w;
+    conv_params.dilation.h = conv_params.dilation.w = 1;
+    conv_params.activation.min = -128;
+    conv_params.activation.max = 127;
+
+    macs = (int64_t)out_h * out_w * out_c * k_h * k_w * in_c;
+}
+
+static void setup_dw_conv(int32_t in_h, int32_t in_w, int32_t in_c, int32_t ch_mult, int32_t k_h, int32_t k_w,
+                          int32_t pad_h, int32_t pad_w)
+{
+    const int32_t out_h = in_h + 2 * pad_h - k_h + 1;
+    const int32_t out_w = in_w + 2 * pad_w - k_w + 1;
+    const int32_t out_c = in_c * ch_mult;
+
+    set_dims(&input_dims, 1, in_h, in_w, in_c);
+    set_dims(&filter_dims, 1, k_h, k_w, out_c);
+    set_dims(&bias_dims, 1, 1, 1, out_c);
+    set_dims(&output_dims, 1, out_h, out_w, out_c);
+
+    dw_conv_params.input_offset = 128;
+    dw_conv_params.output_offset = -128;
+    dw_conv_params.ch_mult = ch_mult;
+    dw_conv_params.stride.h = dw_conv_params.stride.w = 1;
+    dw_conv_params.padding.h = pad_h;
+    dw_conv_params.padding.w = pad_w;
+    dw_conv_params.dilation.h = dw_conv_params.dilation.w = 1;
+    dw_conv_params.activation.min = -128;
+    dw_conv_params.activation.max = 127;
+
+    macs = (int64_t)out_h * out_w * out_c * k_h * k_w;
+}
+
+static void setup_fc(int32_t batches, int32_t accum_depth, int32_t out_c)
+{
+    set_dims(&input_dims, batches, 1, 1, accum_depth);
+    set_dims(&filter_dims, accum_depth, 1, 1, out_c);
+    set_dims(&bias_dims, 1, 1, 1, out_c);
+    set_dims(&output_dims, batches, 1, 1, out_c);
+
+    fc_params.input_offset = 128;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = -128;
+    fc_params.activation.min = -128;
+    fc_params.activation.max = 127;
+
+    macs = (int64_t)batches * accum_depth * out_c;
+}
+
+/* Pooling. One MAC is counted per input value read. */
+static void setup_pool(int32_t in_h, int32_t in_w, int32_t in_c, int32_t k_h, int32_t k_w, int32_t stride)
+{
+    const int32_t out_h = (in_h - k_h) / stride + 1;
+    const int32_t out_w = (in_w - k_w) / stride + 1;
+
+    set_dims(&input_dims, 1, in_h, in_w, in_c);
+    set_dims(&filter_dims, 1, k_h, k_w, 1);
+    set_dims(&output_dims, 1, out_h, out_w, in_c);
+
+    pool_params.stride.h = pool_params.stride.w = stride;
+    pool_params.padding.h = pool_params.padding.w = 0;
+    pool_params.activation.min = -128;
+    pool_params.activation.max = 127;
+
+    macs = (int64_t)out_h * out_w * in_c * k_h * k_w;
+    allocate(in_h * in_w * in_c, 0, 1, out_h * out_w * in_c,
+             arm_avgpool_s8_get_buffer_size(out_w, in_c));
+}
+
+/* Convolutions */
+static void setup_convolve_s8(void)
+{
+    setup_conv(32, 32, 16, 3, 3, 32, 1, 1);
+    allocate(32 * 32 * 16, 32 * 3 * 3 * 16, 32, 32 * 32 * 32,
+             arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims));
+}
+
+static arm_status run_convolve_s8(void)
+{
+    return arm_convolve_s8(&ctx, &conv_params, &channel_quant, &input_dims, input_data, &filter_dims, filter_data,
+                           &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_convolve_1x1_s8_fast(void)
+{
+    setup_conv(16, 16, 64, 1, 1, 64, 0, 0);
+    allocate(16 * 16 * 64, 64 * 64, 64, 16 * 16 * 64, arm_convolve_1x1_s8_fast_get_buffer_size(&input_dims));
+}
+
+static arm_status run_convolve_1x1_s8_fast(void)
+{
+    return arm_convolve_1x1_s8_fast(&ctx, &conv_params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                    filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_convolve_1_x_n_s8(void)
+{
+    setup_conv(1, 128, 32, 1, 5, 32, 0, 2);
+    allocate(128 * 32, 32 * 5 * 32, 32, 128 * 32, arm_convolve_1_x_n_s8_get_buffer_size(&input_dims, &filter_dims));
+}
+
+static arm_status run_convolve_1_x_n_s8(void)
+{
+    return arm_convolve_1_x_n_s8(&ctx, &conv_params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                 filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+/* First layer of an image model, 3 input channels */
+static void setup_convolve_3ch(void)
+{
+    setup_conv(48, 48, 3, 3, 3, 16, 1, 1);
+    allocate(48 * 48 * 3, 16 * 3 * 3 * 3, 16, 48 * 48 * 16,
+             arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims));
+}
+
+static arm_status run_convolve_small_ch_s8(void)
+{
+    return arm_convolve_small_ch_s8(&ctx, &conv_params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                    filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+/* Depthwise convolutions */
+static void setup_depthwise_conv_3x3(void)
+{
+    setup_dw_conv(32, 32, 32, 1, 3, 3, 1, 1);
+    allocate(32 * 32 * 32, 3 * 3 * 32, 32, 32 * 32 * 32, 0);
+}
+
+static arm_status run_depthwise_conv_3x3_s8(void)
+{
+    return arm_depthwise_conv_3x3_s8(&ctx, &dw_conv_params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                     filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_depthwise_conv_opt(void)
+{
+    setup_dw_conv(32, 32, 32, 1, 5, 5, 2, 2);
+    allocate(32 * 32 * 32, 5 * 5 * 32, 32, 32 * 32 * 32,
+             arm_depthwise_conv_s8_opt_get_buffer_size(&input_dims, &filter_dims));
+}
+
+static arm_status run_depthwise_conv_s8_opt(void)
+{
+    return arm_depthwise_conv_s8_opt(&ctx, &dw_conv_params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                     filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_depthwise_conv_generic(void)
+{
+    setup_dw_conv(32, 32, 32, 1, 5, 5, 2, 2);
+    allocate(32 * 32 * 32, 5 * 5 * 32, 32, 32 * 32 * 32, 0);
+}
+
+static arm_status run_depthwise_conv_s8(void)
+{
+    return arm_depthwise_conv_s8(&ctx, &dw_conv_params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                 filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_depthwise_conv_ch_mult(void)
+{
+    setup_dw_conv(32, 32, 16, 4, 3, 3, 1, 1);
+    allocate(32 * 32 * 16, 3 * 3 * 64, 64, 32 * 32 * 64,
+             arm_depthwise_conv_ch_mult_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims));
+}
+
+static arm_status run_depthwise_conv_ch_mult_s8(void)
+{
+    return arm_depthwise_conv_ch_mult_s8(&ctx, &dw_conv_params, &channel_quant, &input_dims, input_data,
+                                         &filter_dims, filter_data, &bias_dims, bias_data, &output_dims,
+                                         output_data);
+}
+
+/* Fully connected */
+static void setup_fully_connected_s8(void)
+{
+    setup_fc(1, 1024, 256);
+    allocate(1024, 1024 * 256, 256, 256, arm_fully_connected_s8_get_buffer_size(&filter_dims));
+}
+
+static arm_status run_fully_connected_s8(void)
+{
+    return arm_fully_connected_s8(&ctx, &fc_params, &tensor_quant, &input_dims, input_data, &filter_dims,
+                                  filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_fully_connected_s4(void)
+{
+    setup_fc(1, 1024, 256);
+    allocate(1024, 1024 * 256 / 2, 256, 256, arm_fully_connected_s4_get_buffer_size(&filter_dims));
+}
+
+static arm_status run_fully_connected_s4(void)
+{
+    return arm_fully_connected_s4(&ctx, &fc_params, &tensor_quant, &input_dims, input_data, &filter_dims,
+                                  filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+/* Block sparse 1024x256 weights with an evenly spread fraction of zero blocks, in percent. MACs are counted as for
+ * the dense weights. */
+static void setup_sparse_fc(int32_t sparsity)
+{
+    const int32_t num_blocks = 1024 / ARM_NN_SPARSE_BLOCK_SIZE;
+    int32_t stored_blocks = 0;
+
+    setup_fc(1, 1024, 256);
+    allocate(1024, 256 * num_blocks * ARM_NN_SPARSE_BLOCK_SIZE, 256, 256,
+             arm_fully_connected_sparse_s8_get_buffer_size(&filter_dims));
+
+    block_cols = alloc_or_die(256 * num_blocks * sizeof(uint16_t));
+    row_offsets = alloc_or_die(257 * sizeof(int32_t));
+    for (int32_t row = 0; row < 256; row++)
+    {
+        row_offsets[row] = stored_blocks;
+        for (int32_t block = 0; block < num_blocks; block++)
+        {
+            if (((row * num_blocks + block) * 37) % 100 >= sparsity)
+            {
+                block_cols[stored_blocks++] = (uint16_t)block;
+            }
+        }
+    }
+    row_offsets[256] = stored_blocks;
+    sparse_weights.values = filter_data;
+    sparse_weights.block_cols = block_cols;
+    sparse_weights.row_offsets = row_offsets;
+}
+
+static void setup_fully_connected_sparse_s8(void)
+{
+    setup_sparse_fc(50);
+}
+
+static void setup_fully_connected_sparse_s8_75(void)
+{
+    setup_sparse_fc(75);
+}
+
+static void setup_fully_connected_sparse_s8_90(void)
+{
+    setup_sparse_fc(90);
+}
+
+static arm_status run_fully_connected_sparse_s8(void)
+{
+    return arm_fully_connected_sparse_s8(&ctx, &fc_params, &tensor_quant, &input_dims, input_data, &filter_dims,
+                                         &sparse_weights, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static void setup_max_pool_3x3(void)
+{
+    setup_pool(32, 32, 64, 3, 3, 2);
+}
+
+static arm_status run_max_pool_s8(void)
+{
+    return arm_max_pool_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output_data);
+}
+
+static void setup_avgpool_3x3(void)
+{
+    setup_pool(32, 32, 64, 3, 3, 2);
+}
+
+static void setup_avgpool_global(void)
+{
+    setup_pool(7, 7, 256, 7, 7, 1);
+}
+
+static arm_status run_avgpool_s8(void)
+{
+    return arm_avgpool_s8(&ctx, &pool_params, &input_dims, input_data, &filter_dims, &output_dims, output_data);
+}
+
+static arm_status run_avgpool_s8_requantize(void)
+{
+    return arm_avgpool_s8_requantize(&ctx, &pool_params, &tensor_quant, 128, -128, &input_dims, input_data,
+                                     &filter_dims, &output_dims, output_data);
+}
+
+/* Softmax. One MAC is counted per input value. */
+static float softmax_exp(float x)
+{
+    return expf(x);
+}
+
+static float softmax_one_by_one(float x)
+{
+    return 1.0f / (1.0f + x);
+}
+
+/* Same table generation as gen_lut() of TensorFlow Lite, used by its int16 softmax */
+static void softmax_gen_lut(float (*func)(float), float min, float max, q15_t *table)
+{
+    const float step = (max - min) / (SOFTMAX_LUT_S16_SIZE - 1);
+    const float half_step = step / 2.0f;
+
+    for (int32_t i = 0; i < SOFTMAX_LUT_S16_SIZE - 1; i++)
+    {
+        const float sample_val = roundf(func(min + i * step) * 32768.0f);
+        const float midpoint_interp_val = roundf((func(min + (i + 1) * step) * 32768.0f + sample_val) / 2.0f);
+        const float midpoint_val = roundf(func(min + i * step + half_step) * 32768.0f);
+        const float bias = roundf((midpoint_interp_val - midpoint_val) / 2.0f);
+        table[i] = (q15_t)fminf(fmaxf(sample_val - bias, -32768.0f), 32767.0f);
+    }
+    table[SOFTMAX_LUT_S16_SIZE - 1] = (q15_t)fminf(fmaxf(roundf(func(max) * 32768.0f), -32768.0f), 32767.0f);
+}
+
+/* Number of rows and row size are taken from the case */
+static void setup_softmax(int32_t buf_size)
+{
+    softmax_rows = case_args[0];
+    softmax_row_size = case_args[1];
+    macs = (int64_t)softmax_rows * softmax_row_size;
+    allocate(softmax_rows * softmax_row_size, 0, 1, softmax_rows * softmax_row_size, buf_size);
+}
+
+static void setup_softmax_s8(void)
+{
+    setup_softmax(0);
+}
+
+static void setup_softmax_s8_fast(void)
+{
+    setup_softmax(arm_softmax_s8_fast_get_buffer_size());
+}
+
+static void setup_log_softmax_s8(void)
+{
+    setup_softmax(arm_log_softmax_s8_get_buffer_size());
+}
+
+static void setup_softmax_s16(void)
+{
+    setup_softmax(0);
+    input_s16 = alloc_or_die(softmax_rows * softmax_row_size * sizeof(q15_t));
+    output_s16 = alloc_or_die(softmax_rows * softmax_row_size * sizeof(q15_t));
+    for (int32_t i = 0; i < softmax_rows * softmax_row_size; i++)
+    {
+        input_s16[i] = (q15_t)(next_rand() & 0xFFFF);
+    }
+    softmax_gen_lut(softmax_exp, -10.0f, 0.0f, exp_lut);
+    softmax_gen_lut(softmax_one_by_one, 0.0f, 1.0f, one_by_one_lut);
+    softmax_lut.exp_lut = exp_lut;
+    softmax_lut.one_by_one_lut = one_by_one_lut;
+}
+
+/* Input scale of 1/16 with beta 1.0 */
+static arm_status run_softmax_s8(void)
+{
+    arm_softmax_s8(input_data, softmax_rows, softmax_row_size, 1073741824, 23, -248, output_data);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_softmax_s8_fast(void)
+{
+    return arm_softmax_s8_fast(&ctx, input_data, softmax_rows, softmax_row_size, 1073741824, 23, -248, output_data);
+}
+
+static arm_status run_log_softmax_s8(void)
+{
+    return arm_log_softmax_s8(&ctx, input_data, softmax_rows, softmax_row_size, 1073741824, 23, 1073741824, -21,
+                              -248, output_data);
+}
+
+/* Input scale of 1/512 mapped onto the [-10.0, 0.0] range of the exp table */
+static arm_status run_softmax_s16(void)
+{
+    return arm_softmax_s16(input_s16, softmax_rows, softmax_row_size, 1717960704, 4, &softmax_lut, output_s16);
+}
+
+/* Same shapes as the former CMSIS-DSP softmax suite: 1 to 512 rows of 16 and 64 values */
+#define SOFTMAX_CASES(NAME, SETUP, RUN)      \
+    {NAME "_1x16", SETUP, RUN, {1, 16}},     \
+    {NAME "_8x16", SETUP, RUN, {8, 16}},     \
+    {NAME "_64x16", SETUP, RUN, {64, 16}},   \
+    {NAME "_256x16", SETUP, RUN, {256, 16}}, \
+    {NAME "_512x16", SETUP, RUN, {512, 16}}, \
+    {NAME "_1x64", SETUP, RUN, {1, 64}},     \
+    {NAME "_8x64", SETUP, RUN, {8, 64}},     \
+    {NAME "_64x64", SETUP, RUN, {64, 64}},   \
+    {NAME "_256x64", SETUP, RUN, {256, 64}}, \
+    {NAME "_512x64", SETUP, RUN, {512, 64}}
+
+static const bench_case cases[] = {
+    {"arm_convolve_s8", setup_convolve_s8, run_convolve_s8},
+    {"arm_convolve_1x1_s8_fast", setup_convolve_1x1_s8_fast, run_convolve_1x1_s8_fast},
+    {"arm_convolve_1_x_n_s8", setup_convolve_1_x_n_s8, run_convolve_1_x_n_s8},
+    {"arm_convolve_s8_3ch", setup_convolve_3ch, run_convolve_s8},
+    {"arm_convolve_small_ch_s8", setup_convolve_3ch, run_convolve_small_ch_s8},
+    {"arm_depthwise_conv_3x3_s8", setup_depthwise_conv_3x3, run_depthwise_conv_3x3_s8},
+    {"arm_depthwise_conv_s8_opt", setup_depthwise_conv_opt, run_depthwise_conv_s8_opt},
+    {"arm_depthwise_conv_s8", setup_depthwise_conv_generic, run_depthwise_conv_s8},
+    {"arm_depthwise_conv_ch_mult_s8", setup_depthwise_conv_ch_mult, run_depthwise_conv_ch_mult_s8},
+    {"arm_fully_connected_s8", setup_fully_connected_s8, run_fully_connected_s8},
+    {"arm_fully_connected_s4", setup_fully_connected_s4, run_fully_connected_s4},
+    {"arm_fully_connected_sparse_s8", setup_fully_connected_sparse_s8, run_fully_connected_sparse_s8},
+    {"arm_fully_connected_sparse_s8_75", setup_fully_connected_sparse_s8_75, run_fully_connected_sparse_s8},
+    {"arm_fully_connected_sparse_s8_90", setup_fully_connected_sparse_s8_90, run_fully_connected_sparse_s8},
+    {"arm_max_pool_s8", setup_max_pool_3x3, run_max_pool_s8},
+    {"arm_avgpool_s8", setup_avgpool_3x3, run_avgpool_s8},
+    {"arm_avgpool_s8_global", setup_avgpool_global, run_avgpool_s8},
+    {"arm_avgpool_s8_requantize", setup_avgpool_global, run_avgpool_s8_requantize},
+    SOFTMAX_CASES("arm_softmax_s8", setup_softmax_s8, run_softmax_s8),
+    SOFTMAX_CASES("arm_softmax_s8_fast", setup_softmax_s8_fast, run_softmax_s8_fast),
+    SOFTMAX_CASES("arm_log_softmax_s8", setup_log_softmax_s8, run_log_softmax_s8),
+    SOFTMAX_CASES("arm_softmax_s16", setup_softmax_s16, run_softmax_s16),
+};
+
+#define NUM_CASES (int32_t)(sizeof(cases) / sizeof(cases[0]))
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Median over NUM_BATCHES batches, each batch running for at least min_time / NUM_BATCHES seconds. */
+static double time_case(arm_status (*run)(void), double min_time)
+{
+    const double batch_ns = min_time * 1e9 / NUM_BATCHES;
+    double samples[NUM_BATCHES];
+    int64_t iterations = 1;
+
+    for (;;)
+    {
+        const double start = now_ns();
+        for (int64_t i = 0; i < iterations; i++)
+        {
+            (void)run();
+        }
+        const double elapsed = now_ns() - start;
+        if (elapsed >= batch_ns || iterations >= (INT64_C(1) << 40))
+        {
+            break;
+        }
+        iterations = elapsed > 0 ? (int64_t)(iterations * 1.2 * batch_ns / elapsed) + 1 : iterations * 2;
+    }
+
+    for (int32_t batch = 0; batch < NUM_BATCHES; batch++)
+    {
+        const double start = now_ns();
+        for (int64_t i = 0; i < iterations; i++)
+        {
+            (void)run();
+        }
+        samples[batch] = (now_ns() - start) / (double)iterations;
+    }
+    qsort(samples, NUM_BATCHES, sizeof(double), compare_double);
+    return samples[NUM_BATCHES / 2];
+}
+
+/* Reads the ns_per_mac column of a CSV file written with --csv. Returns -1 if the kernel is not found. */
+static double baseline_ns_per_mac(const char *file_name, const char *kernel)
+{
+    char line[256];
+    double result = -1.0;
+    FILE *file = fopen(file_name, "r");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Could not open baseline %s\n", file_name);
+        exit(2);
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[128];
+        long long line_macs;
+        double ns_per_call;
+        double ns_per_mac;
+        if (sscanf(line, "%127[^,],%lld,%lf,%lf", name, &line_macs, &ns_per_call, &ns_per_mac) == 4 &&
+            strcmp(name, kernel) == 0)
+        {
+            result = ns_per_mac;
+            break;
+        }
+    }
+    fclose(file);
+    return result;
+}
+
+static void write_csv(FILE *file, const bench_result *results, int32_t count)
+{
+    fprintf(file, "kernel,macs,ns_per_call,ns_per_mac\n");
+    for (int32_t i = 0; i < count; i++)
+    {
+        fprintf(file, "%s,%lld,%.1f,%.4f\n", results[i].name, (long long)results[i].macs, results[i].ns_per_call,
+                results[i].ns_per_mac);
+    }
+}
+
+static void usage(const char *program)
+{
+    printf("Usage: %s [options] [kernel ...]\n"
+           "  --min-time <s>       Minimum measurement time per kernel in seconds (default 0.5)\n"
+           "  --csv <file>         Also write the results to a CSV file, usable as baseline\n"
+           "  --baseline <file>    Compare ns/MAC against a CSV file written with --csv\n"
+           "  --tolerance <pct>    Allowed slowdown against the baseline in percent (default 10)\n"
+           "  --list               List the kernels\n"
+           "Exits with 1 if a kernel fails or is slower than the baseline allows.\n",
+           program);
+}
+
+int main(int argc, char *argv[])
+{
+    double min_time = 0.5;
+    double tolerance = 10.0;
+    const char *csv_file = NULL;
+    const char *baseline_file = NULL;
+    const char *selected[MAX_CASES];
+    int32_t num_selected = 0;
+    bench_result results[MAX_CASES];
+    int32_t num_results = 0;
+    int status = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+        {
+            min_time = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+        {
+            csv_file = argv[++i];
+        }
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+        {
+            baseline_file = argv[++i];
+        }
+        else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+        {
+            tolerance = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            for (int32_t j = 0; j < NUM_CASES; j++)
+            {
+                printf("%s\n", cases[j].name);
+            }
+            return 0;
+        }
+        else if (argv[i][0] != '-' && num_selected < MAX_CASES)
+        {
+            selected[num_selected++] = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 2;
+        }
+    }
+
+    printf("%-32s %12s %14s %10s\n", "kernel", "MACs", "ns/call", "ns/MAC");
+    for (int32_t i = 0; i < NUM_CASES; i++)
+    {
+        if (num_selected > 0)
+        {
+            int32_t found = 0;
+            for (int32_t j = 0; j < num_selected; j++)
+            {
+                found |= strcmp(selected[j], cases[i].name) == 0;
+            }
+            if (!found)
+            {
+                continue;
+            }
+        }
+
+        case_args = cases[i].args;
+        cases[i].setup();
+        if (cases[i].run() != ARM_MATH_SUCCESS)
+        {
+            printf("%-32s failed\n", cases[i].name);
+            status = 1;
+            continue;
+        }
+
+        bench_result *result = &results[num_results++];
+        result->name = cases[i].name;
+        result->macs = macs;
+        result->ns_per_call = time_case(cases[i].run, min_time);
+        result->ns_per_mac = result->ns_per_call / (double)macs;
+        printf("%-32s %12lld %14.1f %10.4f", result->name, (long long)result->macs, result->ns_per_call,
+               result->ns_per_mac);
+
+        if (baseline_file != NULL)
+        {
+            const double baseline = baseline_ns_per_mac(baseline_file, result->name);
+            if (baseline > 0.0)
+            {
+                const double change = 100.0 * (result->ns_per_mac / baseline - 1.0);
+                printf("  %+6.1f%%", change);
+                if (change > tolerance)
+                {
+                    printf("  REGRESSION");
+                    status = 1;
+                }
+            }
+            else
+            {
+                printf("  no baseline");
+            }
+        }
+        printf("\n");
+    }
+    release();
+
+    if (csv_file != NULL)
+    {
+        FILE *file = fopen(csv_file, "w");
+        if (file == NULL)
+        {
+            fprintf(stderr, "Could not open %s\n", csv_file);
+            return 2;
+        }
+        write_csv(file, results, num_results);
+        fclose(file);
+    }
+
+    return status;
+}
@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host_parallel.c
+ * Description:  Multi-threaded host execution of CMSIS-NN layers
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host, e.g. x86 Linux
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "nn_host_parallel.h"
+
+/* A task computes at least this many output channels, a smaller slice costs more in overhead than it gains */
+#define MIN_CHANNELS_PER_TASK 8
+
+struct nn_host_pool
+{
+    pthread_t *threads;
+    int32_t num_workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_available;
+    pthread_cond_t work_done;
+
+    /* Current parallel_for, protected by lock */
+    nn_host_task task;
+    void *arg;
+    int32_t count;
+    int32_t next;
+    int32_t pending;
+    int32_t stop;
+};
+
+typedef struct
+{
+    nn_host_pool *pool;
+    int32_t worker;
+} worker_arg;
+
+/* Takes and runs the tasks of the current parallel_for until there are none left. Called with lock held. */
+static void run_tasks(nn_host_pool *pool, int32_t worker)
+{
+    while (pool->next < pool->count)
+    {
+        const nn_host_task task = pool->task;
+        void *arg = pool->arg;
+        const int32_t index = pool->next++;
+
+        pthread_mutex_unlock(&pool->lock);
+        task(arg, index, worker);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0)
+        {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+}
+
+static void *worker_main(void *ptr)
+{
+    worker_arg *args = (worker_arg *)ptr;
+    nn_host_pool *pool = args->pool;
+    const int32_t worker = args->worker;
+    free(args);
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop)
+    {
+        run_tasks(pool, worker);
+        if (!pool->stop)
+        {
+            pthread_cond_wait(&pool->work_available, &pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+nn_host_pool *nn_host_pool_create(int32_t num_threads)
+{
+    if (num_threads <= 0)
+    {
+        const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (int32_t)cpus : 1;
+    }
+
+    nn_host_pool *pool = calloc(1, sizeof(nn_host_pool));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+    pool->threads = calloc((size_t)num_threads, sizeof(pthread_t));
+    if (pool->threads == NULL)
+    {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    /* Worker 0 is the thread that calls parallel_for */
+    pool->num_workers = 1;
+    for (int32_t i = 1; i < num_threads; i++)
+    {
+        worker_arg *args = malloc(sizeof(worker_arg));
+        if (args == NULL)
+        {
+            break;
+        }
+        args->pool = pool;
+        args->worker = i;
+        if (pthread_create(&pool->threads[i], NULL, worker_main, args) != 0)
+        {
+            free(args);
+            break;
+        }
+        pool->num_workers++;
+    }
+
+    if (pool->num_workers != num_threads)
+    {
+        nn_host_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void nn_host_pool_destroy(nn_host_pool *pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int32_t i = 1; i < pool->num_workers; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_available);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+int32_t nn_host_pool_size(const nn_host_pool *pool) { return pool->num_workers; }
+
+void nn_host_pool_parallel_for(nn_host_pool *pool, nn_host_task task, void *arg, int32_t count)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->arg = arg;
+    pool->count = count;
+    pool->next = 0;
+    pool->pending = count;
+    pthread_cond_broadcast(&pool->work_available);
+
+    run_tasks(pool, 0);
+    while (pool->pending > 0)
+    {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pool->count = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* Splits batches across the workers and, if there are fewer batches than workers, the output channels too */
+static void partition(const nn_host_pool *pool,
+                      const int32_t batches,
+                      const int32_t channels,
+                      int32_t *batch_parts,
+                      int32_t *ch_parts)
+{
+    const int32_t workers = pool->num_workers;
+
+    *batch_parts = MIN(batches, workers);
+    *ch_parts = 1;
+    if (*batch_parts < workers)
+    {
+        const int32_t max_ch_parts = MAX(1, channels / MIN_CHANNELS_PER_TASK);
+        *ch_parts = MIN((workers + *batch_parts - 1) / *batch_parts, max_ch_parts);
+    }
+}
+
+/* Start and size of part index of total split into num_parts nearly equal parts */
+static void part_range(const int32_t total, const int32_t num_parts, const int32_t index, int32_t *start,
+                       int32_t *size)
+{
+    *start = (int32_t)((int64_t)total * index / num_parts);
+    *size = (int32_t)((int64_t)total * (index + 1) / num_parts) - *start;
+}
+
+typedef struct
+{
+    const void *params;
+    const void *quant_params;
+    const cmsis_nn_dims *input_dims;
+    const q7_t *input_data;
+    const cmsis_nn_dims *filter_dims;
+    const q7_t *filter_data;
+    const cmsis_nn_dims *bias_dims;
+    const int32_t *bias_data;
+    const cmsis_nn_dims *output_dims;
+    q7_t *output_data;
+    int32_t batch_parts;
+    int32_t ch_parts;
+    arm_status *status;
+} layer_job;
+
+static void convolve_task(void *arg, int32_t index, int32_t worker)
+{
+    const layer_job *job = (const layer_job *)arg;
+    const cmsis_nn_per_channel_quant_params *quant_params = job->quant_params;
+    const cmsis_nn_dims *input_dims = job->input_dims;
+    const cmsis_nn_dims *filter_dims = job->filter_dims;
+    const cmsis_nn_dims *output_dims = job->output_dims;
+    int32_t batch_start, batch_count, ch_start, ch_count;
+    (void)worker;
+
+    part_range(input_dims->n, job->batch_parts, index / job->ch_parts, &batch_start, &batch_count);
+    part_range(output_dims->c, job->ch_parts, index % job->ch_parts, &ch_start, &ch_count);
+
+    const int32_t input_size = input_dims->h * input_dims->w * input_dims->c;
+    const int32_t output_size = output_dims->h * output_dims->w * output_dims->c;
+    const int32_t filter_size = filter_dims->h * filter_dims->w * input_dims->c;
+
+    const cmsis_nn_dims part_input_dims = {batch_count, input_dims->h, input_dims->w, input_dims->c};
+    const cmsis_nn_dims part_filter_dims = {ch_count, filter_dims->h, filter_dims->w, filter_dims->c};
+    const cmsis_nn_dims part_output_dims = {batch_count, output_dims->h, output_dims->w, ch_count};
+    const cmsis_nn_per_channel_quant_params part_quant = {quant_params->multiplier + ch_start,
+                                                          quant_params->shift + ch_start};
+
+    cmsis_nn_context ctx;
+    ctx.size = arm_convolve_s8_get_buffer_size(&part_input_dims, &part_filter_dims);
+    ctx.buf = ctx.size > 0 ? malloc((size_t)ctx.size) : NULL;
+    if (ctx.size > 0 && ctx.buf == NULL)
+    {
+        job->status[index] = ARM_MATH_ARGUMENT_ERROR;
+        return;
+    }
+
+    job->status[index] =
+        arm_convolve_s8_strided_output(&ctx,
+                                       (const cmsis_nn_conv_params *)job->params,
+                                       &part_quant,
+                                       &part_input_dims,
+                                       job->input_data + batch_start * input_size,
+                                       &part_filter_dims,
+                                       job->filter_data + ch_start * filter_size,
+                                       job->bias_dims,
+                                       job->bias_data != NULL ? job->bias_data + ch_start : NULL,
+                                       &part_output_dims,
+                                       job->output_data + batch_start * output_size + ch_start,
+                                       output_dims->c);
+    free(ctx.buf);
+}
+
+static void fully_connected_task(void *arg, int32_t index, int32_t worker)
+{
+    const layer_job *job = (const layer_job *)arg;
+    const cmsis_nn_dims *input_dims = job->input_dims;
+    const cmsis_nn_dims *filter_dims = job->filter_dims;
+    const cmsis_nn_dims *output_dims = job->output_dims;
+    int32_t batch_start, batch_count, ch_start, ch_count;
+    (void)worker;
+
+    part_range(input_dims->n, job->batch_parts, index / job->ch_parts, &batch_start, &batch_count);
+    part_range(output_dims->c, job->ch_parts, index % job->ch_parts, &ch_start, &ch_count);
+
+    /* The weights are stored as one row of accumulation depth per output channel */
+    const int32_t accum_depth = filter_dims->n;
+    const cmsis_nn_dims part_input_dims = {batch_count, input_dims->h, input_dims->w, input_dims->c};
+    const cmsis_nn_dims part_filter_dims = {accum_depth, filter_dims->h, filter_dims->w, ch_count};
+    const cmsis_nn_dims part_output_dims = {batch_count, output_dims->h, output_dims->w, ch_count};
+
+    cmsis_nn_context ctx;
+    ctx.size = arm_fully_connected_s8_get_buffer_size(&part_filter_dims);
+    ctx.buf = ctx.size > 0 ? malloc((size_t)ctx.size) : NULL;
+    if (ctx.size > 0 && ctx.buf == NULL)
+    {
+        job->status[index] = ARM_MATH_ARGUMENT_ERROR;
+        return;
+    }
+
+    job->status[index] =
+        arm_fully_connected_s8_strided_output(&ctx,
+                                              (const cmsis_nn_fc_params *)job->params,
+                                              (const cmsis_nn_per_tensor_quant_params *)job->quant_params,
+                                              &part_input_dims,
+                                              job->input_data + batch_start * accum_depth,
+                                              &part_filter_dims,
+                                              job->filter_data + ch_start * accum_depth,
+                                              job->bias_dims,
+                                              job->bias_data != NULL ? job->bias_data + ch_start : NULL,
+                                              &part_output_dims,
+                                              job->output_data + batch_start * output_dims->c + ch_start,
+                                              output_dims->c);
+    free(ctx.buf);
+}
+
+/* Runs the tasks of a job and returns the first error */
+static arm_status run_job(nn_host_pool *pool, nn_host_task task, layer_job *job, const int32_t channels)
+{
+    partition(pool, job->input_dims->n, channels, &job->batch_parts, &job->ch_parts);
+
+    const int32_t num_tasks = job->batch_parts * job->ch_parts;
+    if (num_tasks <= 0)
+    {
+        return ARM_MATH_SUCCESS;
+    }
+    job->status = malloc((size_t)num_tasks * sizeof(arm_status));
+    if (job->status == NULL)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    nn_host_pool_parallel_for(pool, task, job, num_tasks);
+
+    arm_status result = ARM_MATH_SUCCESS;
+    for (int32_t i = 0; i < num_tasks && result == ARM_MATH_SUCCESS; i++)
+    {
+        result = job->status[i];
+    }
+    free(job->status);
+    return result;
+}
+
+arm_status nn_host_convolve_s8(nn_host_pool *pool,
+                               const cmsis_nn_conv_params *conv_params,
+                               const cmsis_nn_per_channel_quant_params *quant_params,
+                               const cmsis_nn_dims *input_dims,
+                               const q7_t *input_data,
+                               const cmsis_nn_dims *filter_dims,
+                               const q7_t *filter_data,
+                               const cmsis_nn_dims *bias_dims,
+                               const int32_t *bias_data,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output_data)
+{
+    layer_job job = {conv_params, quant_params, input_dims,  input_data,  filter_dims, filter_data,
+                     bias_dims,   bias_data,    output_dims, output_data, 0,           0,
+                     NULL};
+
+    return run_job(pool, convolve_task, &job, output_dims->c);
+}
+
+arm_status nn_host_fully_connected_s8(nn_host_pool *pool,
+                                      const cmsis_nn_fc_params *fc_params,
+                                      const cmsis_nn_per_tensor_quant_params *quant_params,
+                                      const cmsis_nn_dims *input_dims,
+                                      const q7_t *input_data,
+                                      const cmsis_nn_dims *filter_dims,
+                                      const q7_t *filter_data,
+                                      const cmsis_nn_dims *bias_dims,
+                                      const int32_t *bias_data,
+                                      const cmsis_nn_dims *output_dims,
+                                      q7_t *output_data)
+{
+    layer_job job = {fc_params,  quant_params, input_dims,  input_data,  filter_dims, filter_data,
+                     bias_dims,  bias_data,    output_dims, output_data, 0,           0,
+                     NULL};
+
+    return run_job(pool, fully_connected_task, &job, output_dims->c);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host_parallel.h
+ * Description:  Multi-threaded host execution of CMSIS-NN layers, e.g. for
+ *               the accuracy evaluation of a model over a large data set.
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host, e.g. x86 Linux
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _NN_HOST_PARALLEL_H
+#define _NN_HOST_PARALLEL_H
+
+#include "arm_nnfunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pool of worker threads. The thread that calls a function of the pool works as well, as worker 0.
+ *
+ * The layer functions split the work into tasks that the kernels compute independently, so the result is
+ * bit-exact to the serial call of the kernel:
+ *    - Batches are split across the workers.
+ *    - If there are fewer batches than workers, the output channels are split as well. A task computes a
+ *      slice of the output channels with the _strided_output variant of the kernel.
+ *
+ * The profiling hooks of arm_nn_profile.h are called from all workers. A callback that is installed
+ * while a pool is used has to be thread safe.
+ */
+typedef struct nn_host_pool nn_host_pool;
+
+/**
+ * @brief Task of nn_host_pool_parallel_for()
+ * @param[in]  arg     Argument given to nn_host_pool_parallel_for()
+ * @param[in]  index   Index of the task, in [0, count)
+ * @param[in]  worker  Index of the worker that runs the task, in [0, nn_host_pool_size()). Can be used to select
+ *                     a per worker scratch buffer or arena.
+ */
+typedef void (*nn_host_task)(void *arg, int32_t index, int32_t worker);
+
+/**
+ * @brief Creates a pool
+ * @param[in]  num_threads  Number of workers, including the calling thread. 0 uses the number of online CPUs.
+ * @return     The pool, or NULL if the threads could not be created
+ */
+nn_host_pool *nn_host_pool_create(int32_t num_threads);
+
+/**
+ * @brief Stops the threads of a pool and frees it
+ */
+void nn_host_pool_destroy(nn_host_pool *pool);
+
+/**
+ * @brief Number of workers of a pool, including the calling thread
+ */
+int32_t nn_host_pool_size(const nn_host_pool *pool);
+
+/**
+ * @brief Runs task(arg, index, worker) for every index in [0, count) and returns when all are done
+ *
+ * This is also the driver for the evaluation of a whole model over a data set: one task per sample, each
+ * worker with its own arena, calling the kernels serially.
+ */
+void nn_host_pool_parallel_for(nn_host_pool *pool, nn_host_task task, void *arg, int32_t count);
+
+/**
+ * @brief arm_convolve_s8() split across the workers of a pool
+ *
+ * Same arguments as arm_convolve_s8(), without the context. Every task allocates its own buffer.
+ *
+ * @return     The first error of a task, ARM_MATH_ARGUMENT_ERROR if a buffer could not be allocated, or
+ *             <code>ARM_MATH_SUCCESS</code>
+ */
+arm_status nn_host_convolve_s8(nn_host_pool *pool,
+                               const cmsis_nn_conv_params *conv_params,
+                               const cmsis_nn_per_channel_quant_params *quant_params,
+                               const cmsis_nn_dims *input_dims,
+                               const q7_t *input_data,
+                               const cmsis_nn_dims *filter_dims,
+                               const q7_t *filter_data,
+                               const cmsis_nn_dims *bias_dims,
+                               const int32_t *bias_data,
+                               const cmsis_nn_dims *output_dims,
+                               q7_t *output_data);
+
+/**
+ * @brief arm_fully_connected_s8() split across the workers of a pool
+ *
+ * Same arguments as arm_fully_connected_s8(), without the context.
+ *
+ * @return     The first error of a task, ARM_MATH_ARGUMENT_ERROR if a buffer could not be allocated, or
+ *             <code>ARM_MATH_SUCCESS</code>
+ */
+arm_status nn_host_fully_connected_s8(nn_host_pool *pool,
+                                      const cmsis_nn_fc_params *fc_params,
+                                      const cmsis_nn_per_tensor_quant_params *quant_params,
+                                      const cmsis_nn_dims *input_dims,
+                                      const q7_t *input_data,
+                                      const cmsis_nn_dims *filter_dims,
+                                      const q7_t *filter_data,
+                                      const cmsis_nn_dims *bias_dims,
+                                      const int32_t *bias_data,
+                                      const cmsis_nn_dims *output_dims,
+                                      q7_t *output_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NN_HOST_PARALLEL_H */
@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host_parallel_test.c
+ * Description:  Checks that the multi-threaded host execution is bit-exact
+ *               to the serial calls of the kernels.
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host, e.g. x86 Linux
+ *
+ * -------------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nn_host_parallel.h"
+
+static uint32_t rand_state = 1;
+
+static uint32_t next_rand(void)
+{
+    rand_state = rand_state * 1664525U + 1013904223U;
+    return rand_state >> 8;
+}
+
+static void *alloc_or_die(size_t size)
+{
+    void *ptr = calloc(size > 0 ? size : 1, 1);
+    if (ptr == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(2);
+    }
+    return ptr;
+}
+
+static q7_t *random_q7(int32_t size)
+{
+    q7_t *data = alloc_or_die(size);
+    for (int32_t i = 0; i < size; i++)
+    {
+        data[i] = (q7_t)(next_rand() & 0xFF);
+    }
+    return data;
+}
+
+static int32_t *random_s32(int32_t size, int32_t base, uint32_t mask)
+{
+    int32_t *data = alloc_or_die(size * sizeof(int32_t));
+    for (int32_t i = 0; i < size; i++)
+    {
+        data[i] = base + (int32_t)(next_rand() & mask);
+    }
+    return data;
+}
+
+static void set_dims(cmsis_nn_dims *dims, int32_t n, int32_t h, int32_t w, int32_t c)
+{
+    dims->n = n;
+    dims->h = h;
+    dims->w = w;
+    dims->c = c;
+}
+
+static int check(const char *name, arm_status serial_status, arm_status status, const q7_t *ref, const q7_t *output,
+                 int32_t size)
+{
+    int32_t mismatches = 0;
+    for (int32_t i = 0; i < size; i++)
+    {
+        mismatches += ref[i] != output[i];
+    }
+    const int passed = serial_status == ARM_MATH_SUCCESS && status == ARM_MATH_SUCCESS && mismatches == 0;
+    printf("%-40s %s", name, passed ? "PASS" : "FAIL");
+    if (mismatches != 0)
+    {
+        printf(" (%d of %d outputs differ)", mismatches, size);
+    }
+    printf("\n");
+    return passed ? 0 : 1;
+}
+
+/* Conv layer used by the tests. in_c and out_c are the channels, batches the number of images. */
+typedef struct
+{
+    cmsis_nn_conv_params conv_params;
+    cmsis_nn_per_channel_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+    q7_t *filter_data;
+    int32_t *bias_data;
+} conv_layer;
+
+static void conv_layer_init(conv_layer *layer, int32_t batches, int32_t in_hw, int32_t in_c, int32_t out_c)
+{
+    const int32_t out_hw = (in_hw + 2 - 3) / 2 + 1;
+
+    set_dims(&layer->input_dims, batches, in_hw, in_hw, in_c);
+    set_dims(&layer->filter_dims, out_c, 3, 3, in_c);
+    set_dims(&layer->bias_dims, 1, 1, 1, out_c);
+    set_dims(&layer->output_dims, batches, out_hw, out_hw, out_c);
+
+    layer->conv_params.input_offset = 3;
+    layer->conv_params.output_offset = -5;
+    layer->conv_params.stride.h = layer->conv_params.stride.w = 2;
+    layer->conv_params.padding.h = layer->conv_params.padding.w = 1;
+    layer->conv_params.dilation.h = layer->conv_params.dilation.w = 1;
+    layer->conv_params.activation.min = -100;
+    layer->conv_params.activation.max = 120;
+
+    layer->filter_data = random_q7(out_c * 3 * 3 * in_c);
+    layer->bias_data = random_s32(out_c, -2048, 0xFFF);
+    layer->quant_params.multiplier = random_s32(out_c, 1073741824, 0x3FFFFFFF);
+    layer->quant_params.shift = random_s32(out_c, -10, 0x3);
+}
+
+static void conv_layer_free(conv_layer *layer)
+{
+    free(layer->filter_data);
+    free(layer->bias_data);
+    free(layer->quant_params.multiplier);
+    free(layer->quant_params.shift);
+}
+
+static arm_status conv_layer_serial(const conv_layer *layer, const q7_t *input, q7_t *output)
+{
+    cmsis_nn_context ctx;
+    ctx.size = arm_convolve_s8_get_buffer_size(&layer->input_dims, &layer->filter_dims);
+    ctx.buf = alloc_or_die(ctx.size);
+    const arm_status status = arm_convolve_s8(&ctx, &layer->conv_params, &layer->quant_params, &layer->input_dims,
+                                              input, &layer->filter_dims, layer->filter_data, &layer->bias_dims,
+                                              layer->bias_data, &layer->output_dims, output);
+    free(ctx.buf);
+    return status;
+}
+
+static int test_convolve_s8(nn_host_pool *pool, const char *name, int32_t batches, int32_t in_hw, int32_t in_c,
+                            int32_t out_c)
+{
+    conv_layer layer;
+    conv_layer_init(&layer, batches, in_hw, in_c, out_c);
+
+    const int32_t output_size =
+        batches * layer.output_dims.h * layer.output_dims.w * layer.output_dims.c;
+    q7_t *input = random_q7(batches * in_hw * in_hw * in_c);
+    q7_t *ref = alloc_or_die(output_size);
+    q7_t *output = alloc_or_die(output_size);
+
+    const arm_status serial_status = conv_layer_serial(&layer, input, ref);
+    const arm_status status = nn_host_convolve_s8(pool, &layer.conv_params, &layer.quant_params, &layer.input_dims,
+                                                  input, &layer.filter_dims, layer.filter_data, &layer.bias_dims,
+                                                  layer.bias_data, &layer.output_dims, output);
+    const int result = check(name, serial_status, status, ref, output, output_size);
+
+    conv_layer_free(&layer);
+    free(input);
+    free(ref);
+    free(output);
+    return result;
+}
+
+static int test_fully_connected_s8(nn_host_pool *pool, const char *name, int32_t batches, int32_t accum_depth,
+                                   int32_t out_c)
+{
+    cmsis_nn_context ctx;
+    cmsis_nn_fc_params fc_params;
+    cmsis_nn_per_tensor_quant_params quant_params;
+    cmsis_nn_dims input_dims;
+    cmsis_nn_dims filter_dims;
+    cmsis_nn_dims bias_dims;
+    cmsis_nn_dims output_dims;
+
+    set_dims(&input_dims, batches, 1, 1, accum_depth);
+    set_dims(&filter_dims, accum_depth, 1, 1, out_c);
+    set_dims(&bias_dims, 1, 1, 1, out_c);
+    set_dims(&output_dims, batches, 1, 1, out_c);
+
+    fc_params.input_offset = -7;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = 11;
+    fc_params.activation.min = -128;
+    fc_params.activation.max = 127;
+    quant_params.multiplier = 1518500250;
+    quant_params.shift = -9;
+
+    q7_t *input = random_q7(batches * accum_depth);
+    q7_t *filter = random_q7(accum_depth * out_c);
+    int32_t *bias = random_s32(out_c, -4096, 0x1FFF);
+    q7_t *ref = alloc_or_die(batches * out_c);
+    q7_t *output = alloc_or_die(batches * out_c);
+
+    ctx.size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = alloc_or_die(ctx.size);
+    const arm_status serial_status = arm_fully_connected_s8(&ctx, &fc_params, &quant_params, &input_dims, input,
+                                                            &filter_dims, filter, &bias_dims, bias, &output_dims, ref);
+    free(ctx.buf);
+    const arm_status status = nn_host_fully_connected_s8(pool, &fc_params, &quant_params, &input_dims, input,
+                                                         &filter_dims, filter, &bias_dims, bias, &output_dims, output);
+    const int result = check(name, serial_status, status, ref, output, batches * out_c);
+
+    free(input);
+    free(filter);
+    free(bias);
+    free(ref);
+    free(output);
+    return result;
+}
+
+/* Evaluation of a data set: one task per sample, each running the layer serially for a single image */
+typedef struct
+{
+    const conv_layer *layer;
+    const q7_t *inputs;
+    q7_t *outputs;
+    int32_t input_size;
+    int32_t output_size;
+    arm_status *status;
+} sample_job;
+
+static void run_sample(void *arg, int32_t index, int32_t worker)
+{
+    const sample_job *job = (const sample_job *)arg;
+    (void)worker;
+
+    job->status[index] = conv_layer_serial(job->layer, job->inputs + index * job->input_size,
+                                           job->outputs + index * job->output_size);
+}
+
+static int test_parallel_for(nn_host_pool *pool, int32_t num_samples)
+{
+    conv_layer layer;
+    conv_layer_init(&layer, 1, 10, 3, 12);
+
+    sample_job job;
+    job.layer = &layer;
+    job.input_size = 10 * 10 * 3;
+    job.output_size = layer.output_dims.h * layer.output_dims.w * layer.output_dims.c;
+    job.inputs = random_q7(num_samples * job.input_size);
+    job.outputs = alloc_or_die(num_samples * job.output_size);
+    job.status = alloc_or_die(num_samples * sizeof(arm_status));
+
+    /* The reference is the same samples as one batch of the serial kernel */
+    conv_layer batch_layer = layer;
+    batch_layer.input_dims.n = num_samples;
+    batch_layer.output_dims.n = num_samples;
+    q7_t *ref = alloc_or_die(num_samples * job.output_size);
+    const arm_status serial_status = conv_layer_serial(&batch_layer, job.inputs, ref);
+
+    nn_host_pool_parallel_for(pool, run_sample, &job, num_samples);
+    arm_status status = ARM_MATH_SUCCESS;
+    for (int32_t i = 0; i < num_samples; i++)
+    {
+        status = job.status[i] != ARM_MATH_SUCCESS ? job.status[i] : status;
+    }
+    const int result = check("parallel_for samples", serial_status, status, ref, job.outputs,
+                             num_samples * job.output_size);
+
+    conv_layer_free(&layer);
+    free((void *)job.inputs);
+    free(job.outputs);
+    free(job.status);
+    free(ref);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    int32_t num_threads = 4;
+    int failures = 0;
+
+    if (argc == 3 && strcmp(argv[1], "--threads") == 0)
+    {
+        num_threads = atoi(argv[2]);
+    }
+    else if (argc != 1)
+    {
+        printf("Usage: %s [--threads <n>]   n = 0 uses all CPUs\n", argv[0]);
+        return 2;
+    }
+
+    nn_host_pool *pool = nn_host_pool_create(num_threads);
+    if (pool == NULL)
+    {
+        fprintf(stderr, "Could not create the thread pool\n");
+        return 2;
+    }
+    printf("%d workers\n", nn_host_pool_size(pool));
+
+    failures += test_convolve_s8(pool, "arm_convolve_s8 batches", 7, 12, 5, 16);
+    failures += test_convolve_s8(pool, "arm_convolve_s8 output channels", 1, 16, 8, 37);
+    failures += test_convolve_s8(pool, "arm_convolve_s8 batches and channels", 2, 9, 3, 64);
+    failures += test_fully_connected_s8(pool, "arm_fully_connected_s8 batches", 13, 100, 10);
+    failures += test_fully_connected_s8(pool, "arm_fully_connected_s8 output channels", 1, 256, 99);
+    failures += test_parallel_for(pool, 50);
+
+    nn_host_pool_destroy(pool);
+    return failures != 0;
+}
@@ -0,0 +1,598 @@
+/*
+ * Copyright (C) 2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host_profile_test.c
+ * Description:  Checks that every instrumented kernel calls the profiling
+ *               begin and end callbacks in pairs, with a recording stub.
+ *
+ * $Date:        October 17, 2020
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host, e.g. x86 Linux
+ *
+ * -------------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_nn_profile.h"
+#include "arm_nnfunctions.h"
+
+#if !defined(ARM_NN_PROFILE)
+#error "nn_host_profile_test needs a library built with ARM_NN_PROFILE"
+#endif
+
+#define MAX_DEPTH 4
+#define MAX_EVENTS 16
+#define DATA_SIZE 4096
+
+typedef struct
+{
+    const char *name;
+    arm_nn_kernel_id kernel; /* Kernel reported by the outermost event */
+    arm_status (*run)(void);
+} profile_case;
+
+/* Recording stub. Events must end in reverse order of their begin, with the same event object. */
+static arm_nn_profile_event *open_events[MAX_DEPTH];
+static arm_nn_kernel_id recorded[MAX_EVENTS];
+static int32_t depth;
+static int32_t num_begin;
+static int32_t num_end;
+static int32_t num_errors;
+
+static void record_begin(arm_nn_profile_event *event)
+{
+    if (depth == MAX_DEPTH || num_begin == MAX_EVENTS)
+    {
+        num_errors++;
+        return;
+    }
+    open_events[depth++] = event;
+    recorded[num_begin++] = event->kernel;
+}
+
+static void record_end(arm_nn_profile_event *event)
+{
+    if (depth == 0 || open_events[depth - 1] != event)
+    {
+        num_errors++;
+        return;
+    }
+    depth--;
+    num_end++;
+}
+
+/* Zero data is enough, the test only checks the callbacks */
+static q7_t input_data[DATA_SIZE];
+static q7_t filter_data[DATA_SIZE];
+static q7_t output_data[DATA_SIZE];
+static int32_t bias_data[DATA_SIZE];
+static q15_t input_s16[DATA_SIZE];
+static q15_t output_s16[DATA_SIZE];
+static q15_t weights_s16[DATA_SIZE];
+static float32_t input_f32[DATA_SIZE];
+static float32_t output_f32[DATA_SIZE];
+static int32_t output_mult[DATA_SIZE];
+static int32_t output_shift[DATA_SIZE];
+static q7_t lut_s8[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+static q15_t lut_s16[ARM_NN_ACTIVATION_LUT_S16_SIZE];
+static uint16_t block_cols[DATA_SIZE];
+static int32_t row_offsets[DATA_SIZE];
+static int64_t ctx_buf[DATA_SIZE];
+
+static cmsis_nn_context ctx = {ctx_buf, sizeof(ctx_buf)};
+static cmsis_nn_per_channel_quant_params channel_quant = {output_mult, output_shift};
+static cmsis_nn_per_tensor_quant_params tensor_quant = {1073741824, 0};
+static cmsis_nn_softmax_lut_s16 softmax_lut = {lut_s16, lut_s16};
+static cmsis_nn_sparse_weights sparse_weights = {filter_data, block_cols, row_offsets};
+
+static cmsis_nn_dims input_dims;
+static cmsis_nn_dims filter_dims;
+static cmsis_nn_dims bias_dims;
+static cmsis_nn_dims output_dims;
+
+static void set_dims(cmsis_nn_dims *dims, int32_t n, int32_t h, int32_t w, int32_t c)
+{
+    dims->n = n;
+    dims->h = h;
+    dims->w = w;
+    dims->c = c;
+}
+
+static cmsis_nn_conv_params conv_params(int32_t pad)
+{
+    cmsis_nn_conv_params params = {0, 0, {1, 1}, {pad, pad}, {1, 1}, {-128, 127}};
+    return params;
+}
+
+static cmsis_nn_dw_conv_params dw_conv_params(int32_t ch_mult, int32_t pad)
+{
+    cmsis_nn_dw_conv_params params = {0, 0, ch_mult, {1, 1}, {pad, pad}, {1, 1}, {-128, 127}};
+    return params;
+}
+
+/* 8x8 input, 3x3 filter and same padding. */
+static void setup_conv(int32_t in_c, int32_t out_c, int32_t k)
+{
+    set_dims(&input_dims, 1, 8, 8, in_c);
+    set_dims(&filter_dims, out_c, k, k, in_c);
+    set_dims(&bias_dims, 1, 1, 1, out_c);
+    set_dims(&output_dims, 1, 8, 8, out_c);
+}
+
+static arm_status run_convolve_s8(void)
+{
+    const cmsis_nn_conv_params params = conv_params(1);
+    setup_conv(4, 4, 3);
+    return arm_convolve_s8(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims, filter_data,
+                           &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_convolve_s8_strided_output(void)
+{
+    const cmsis_nn_conv_params params = conv_params(1);
+    setup_conv(4, 4, 3);
+    return arm_convolve_s8_strided_output(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                          filter_data, &bias_dims, bias_data, &output_dims, output_data, 8);
+}
+
+static arm_status run_convolve_s8_lut(void)
+{
+    const cmsis_nn_conv_params params = conv_params(1);
+    setup_conv(4, 4, 3);
+    return arm_convolve_s8_lut(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims, filter_data,
+                               &bias_dims, bias_data, &output_dims, output_data, lut_s8);
+}
+
+static arm_status run_convolve_1x1_s8_fast(void)
+{
+    const cmsis_nn_conv_params params = conv_params(0);
+    setup_conv(4, 4, 1);
+    return arm_convolve_1x1_s8_fast(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                    filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_convolve_1x1_s4_fast(void)
+{
+    const cmsis_nn_conv_params params = conv_params(0);
+    setup_conv(4, 4, 1);
+    return arm_convolve_1x1_s4_fast(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                    filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_convolve_1_x_n_s8(void)
+{
+    const cmsis_nn_conv_params params = conv_params(0);
+    set_dims(&input_dims, 1, 1, 18, 4);
+    set_dims(&filter_dims, 4, 1, 3, 4);
+    set_dims(&bias_dims, 1, 1, 1, 4);
+    set_dims(&output_dims, 1, 1, 16, 4);
+    return arm_convolve_1_x_n_s8(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims, filter_data,
+                                 &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_convolve_small_ch_s8(void)
+{
+    const cmsis_nn_conv_params params = conv_params(1);
+    setup_conv(3, 8, 3);
+    return arm_convolve_small_ch_s8(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                    filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_depthwise_conv_s8(void)
+{
+    const cmsis_nn_dw_conv_params params = dw_conv_params(2, 1);
+    setup_conv(4, 8, 3);
+    filter_dims.n = 1;
+    return arm_depthwise_conv_s8(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims, filter_data,
+                                 &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_depthwise_conv_s8_strided_output(void)
+{
+    const cmsis_nn_dw_conv_params params = dw_conv_params(2, 1);
+    setup_conv(4, 8, 3);
+    filter_dims.n = 1;
+    return arm_depthwise_conv_s8_strided_output(&ctx, &params, &channel_quant, &input_dims, input_data,
+                                                &filter_dims, filter_data, &bias_dims, bias_data, &output_dims,
+                                                output_data, 16);
+}
+
+static arm_status run_depthwise_conv_s8_opt(void)
+{
+    const cmsis_nn_dw_conv_params params = dw_conv_params(1, 1);
+    setup_conv(8, 8, 3);
+    filter_dims.n = 1;
+    return arm_depthwise_conv_s8_opt(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                     filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_depthwise_conv_3x3_s8(void)
+{
+    const cmsis_nn_dw_conv_params params = dw_conv_params(1, 1);
+    setup_conv(8, 8, 3);
+    filter_dims.n = 1;
+    return arm_depthwise_conv_3x3_s8(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                     filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_depthwise_conv_ch_mult_s8(void)
+{
+    const cmsis_nn_dw_conv_params params = dw_conv_params(2, 1);
+    setup_conv(4, 8, 3);
+    filter_dims.n = 1;
+    return arm_depthwise_conv_ch_mult_s8(&ctx, &params, &channel_quant, &input_dims, input_data, &filter_dims,
+                                         filter_data, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+/* 64 inputs and 16 outputs */
+static cmsis_nn_fc_params fc_params(void)
+{
+    cmsis_nn_fc_params params = {0, 0, 0, {-128, 127}};
+    set_dims(&input_dims, 1, 1, 1, 64);
+    set_dims(&filter_dims, 64, 1, 1, 16);
+    set_dims(&bias_dims, 1, 1, 1, 16);
+    set_dims(&output_dims, 1, 1, 1, 16);
+    return params;
+}
+
+static arm_status run_fully_connected_s8(void)
+{
+    const cmsis_nn_fc_params params = fc_params();
+    return arm_fully_connected_s8(&ctx, &params, &tensor_quant, &input_dims, input_data, &filter_dims, filter_data,
+                                  &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_fully_connected_s8_strided_output(void)
+{
+    const cmsis_nn_fc_params params = fc_params();
+    return arm_fully_connected_s8_strided_output(&ctx, &params, &tensor_quant, &input_dims, input_data,
+                                                 &filter_dims, filter_data, &bias_dims, bias_data, &output_dims,
+                                                 output_data, 32);
+}
+
+static arm_status run_fully_connected_s4(void)
+{
+    const cmsis_nn_fc_params params = fc_params();
+    return arm_fully_connected_s4(&ctx, &params, &tensor_quant, &input_dims, input_data, &filter_dims, filter_data,
+                                  &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_fully_connected_sparse_s8(void)
+{
+    const cmsis_nn_fc_params params = fc_params();
+    return arm_fully_connected_sparse_s8(&ctx, &params, &tensor_quant, &input_dims, input_data, &filter_dims,
+                                         &sparse_weights, &bias_dims, bias_data, &output_dims, output_data);
+}
+
+static arm_status run_batch_matmul_s8(void)
+{
+    const cmsis_nn_bmm_params params = {0, 0, {0, 0, 0, {-128, 127}}};
+    set_dims(&input_dims, 1, 2, 8, 16);
+    set_dims(&filter_dims, 1, 2, 16, 8);
+    set_dims(&output_dims, 1, 2, 8, 8);
+    return arm_batch_matmul_s8(&ctx, &params, &tensor_quant, &input_dims, input_data, &filter_dims, filter_data,
+                               &output_dims, output_data);
+}
+
+/* 8x8 input and a 3x3 window with same padding */
+static cmsis_nn_pool_params pool_params(void)
+{
+    cmsis_nn_pool_params params = {{1, 1}, {1, 1}, {-128, 127}};
+    set_dims(&input_dims, 1, 8, 8, 8);
+    set_dims(&filter_dims, 1, 3, 3, 1);
+    set_dims(&output_dims, 1, 8, 8, 8);
+    return params;
+}
+
+static arm_status run_avgpool_s8(void)
+{
+    const cmsis_nn_pool_params params = pool_params();
+    return arm_avgpool_s8(&ctx, &params, &input_dims, input_data, &filter_dims, &output_dims, output_data);
+}
+
+static arm_status run_avgpool_s8_requantize(void)
+{
+    const cmsis_nn_pool_params params = pool_params();
+    return arm_avgpool_s8_requantize(&ctx, &params, &tensor_quant, 0, 0, &input_dims, input_data, &filter_dims,
+                                     &output_dims, output_data);
+}
+
+static arm_status run_max_pool_s8(void)
+{
+    const cmsis_nn_pool_params params = pool_params();
+    return arm_max_pool_s8(&ctx, &params, &input_dims, input_data, &filter_dims, &output_dims, output_data);
+}
+
+static arm_status run_max_pool_s8_requantize(void)
+{
+    const cmsis_nn_pool_params params = pool_params();
+    return arm_max_pool_s8_requantize(&ctx, &params, &tensor_quant, 0, 0, &input_dims, input_data, &filter_dims,
+                                      &output_dims, output_data);
+}
+
+static arm_status run_elementwise_add_s8(void)
+{
+    return arm_elementwise_add_s8(input_data, filter_data, 0, 1073741824, 0, 0, 1073741824, 0, 20, output_data, 0,
+                                  1073741824, 0, -128, 127, 64);
+}
+
+static arm_status run_elementwise_mul_s8(void)
+{
+    return arm_elementwise_mul_s8(input_data, filter_data, 0, 0, output_data, 0, 1073741824, 0, -128, 127, 64);
+}
+
+static arm_status run_relu6_s8(void)
+{
+    arm_relu6_s8(output_data, 64);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_activation_lut_s8(void)
+{
+    return arm_activation_lut_s8(input_data, output_data, lut_s8, 64);
+}
+
+static arm_status run_activation_lut_s16(void)
+{
+    return arm_activation_lut_s16(input_s16, output_s16, lut_s16, 64);
+}
+
+static arm_status run_softmax_s8(void)
+{
+    arm_softmax_s8(input_data, 4, 16, 1073741824, 23, -248, output_data);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_softmax_s8_fast(void)
+{
+    return arm_softmax_s8_fast(&ctx, input_data, 4, 16, 1073741824, 23, -248, output_data);
+}
+
+static arm_status run_log_softmax_s8(void)
+{
+    return arm_log_softmax_s8(&ctx, input_data, 4, 16, 1073741824, 23, 1073741824, -21, -248, output_data);
+}
+
+static arm_status run_softmax_s16(void)
+{
+    return arm_softmax_s16(input_s16, 4, 16, 1717960704, 4, &softmax_lut, output_s16);
+}
+
+static arm_status run_layer_norm_s16(void)
+{
+    return arm_layer_norm_s16(input_s16, weights_s16, bias_data, 1073741824, 0, 1, 4, 16, output_s16);
+}
+
+static arm_status run_mean_s8(void)
+{
+    set_dims(&input_dims, 1, 4, 4, 8);
+    set_dims(&output_dims, 1, 1, 1, 8);
+    return arm_mean_s8(&input_dims, input_data, 0, &tensor_quant, 0, &output_dims, output_data);
+}
+
+static arm_status run_reduce_sum_s8(void)
+{
+    set_dims(&input_dims, 1, 4, 4, 8);
+    set_dims(&output_dims, 1, 1, 1, 8);
+    return arm_reduce_sum_s8(&input_dims, input_data, 0, &tensor_quant, 0, &output_dims, output_data);
+}
+
+static arm_status run_quantize_f32_s8(void)
+{
+    return arm_quantize_f32_s8(input_f32, output_data, 0.5f, 0, 64);
+}
+
+static arm_status run_quantize_f32_s16(void)
+{
+    return arm_quantize_f32_s16(input_f32, output_s16, 0.5f, 0, 64);
+}
+
+static arm_status run_dequantize_s8_f32(void)
+{
+    return arm_dequantize_s8_f32(input_data, 0, 0.5f, output_f32, 64);
+}
+
+static arm_status run_requantize_s8(void)
+{
+    return arm_requantize_s8(input_data, 0, output_data, 0, &tensor_quant, 64);
+}
+
+static arm_status run_requantize_per_channel_s8(void)
+{
+    return arm_requantize_per_channel_s8(input_data, 0, output_data, 0, &channel_quant, 8, 64);
+}
+
+static arm_status run_concatenation_s8_x(void)
+{
+    arm_concatenation_s8_x(input_data, 4, 4, 4, 1, output_data, 8, 4);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_concatenation_s8_y(void)
+{
+    arm_concatenation_s8_y(input_data, 4, 4, 4, 1, output_data, 8, 4);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_concatenation_s8_z(void)
+{
+    arm_concatenation_s8_z(input_data, 4, 4, 4, 1, output_data, 8, 4);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_concatenation_s8_w(void)
+{
+    arm_concatenation_s8_w(input_data, 4, 4, 4, 1, output_data, 1);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_reshape_s8(void)
+{
+    arm_reshape_s8(input_data, output_data, 64);
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_pad_s8(void)
+{
+    cmsis_nn_dims pad_before;
+    cmsis_nn_dims pad_after;
+    set_dims(&input_dims, 1, 4, 4, 4);
+    set_dims(&pad_before, 0, 1, 1, 0);
+    set_dims(&pad_after, 0, 1, 1, 0);
+    return arm_pad_s8(&input_dims, input_data, &pad_before, &pad_after, 0, output_data);
+}
+
+static arm_status run_strided_slice_s8(void)
+{
+    cmsis_nn_dims begin;
+    cmsis_nn_dims stride;
+    set_dims(&input_dims, 1, 8, 8, 4);
+    set_dims(&begin, 0, 0, 0, 0);
+    set_dims(&stride, 1, 2, 2, 1);
+    set_dims(&output_dims, 1, 4, 4, 4);
+    return arm_strided_slice_s8(&input_dims, input_data, &begin, &stride, &output_dims, output_data);
+}
+
+/* Without the extensions the optimized functions fall back to, and report, the reference function */
+#if defined(ARM_MATH_MVEI)
+#define CONVOLVE_1_X_N_KERNEL ARM_NN_KERNEL_CONVOLVE_1_X_N_S8
+#else
+#define CONVOLVE_1_X_N_KERNEL ARM_NN_KERNEL_CONVOLVE_S8
+#endif
+#if defined(ARM_MATH_MVEI) || defined(ARM_MATH_DSP)
+#define DEPTHWISE_OPT_KERNEL(kernel) (kernel)
+#else
+#define DEPTHWISE_OPT_KERNEL(kernel) ARM_NN_KERNEL_DEPTHWISE_CONV_S8
+#endif
+
+static const profile_case cases[] = {
+    {"arm_convolve_s8", ARM_NN_KERNEL_CONVOLVE_S8, run_convolve_s8},
+    {"arm_convolve_s8_strided_output", ARM_NN_KERNEL_CONVOLVE_S8, run_convolve_s8_strided_output},
+    {"arm_convolve_s8_lut", ARM_NN_KERNEL_CONVOLVE_S8, run_convolve_s8_lut},
+    {"arm_convolve_1x1_s8_fast", ARM_NN_KERNEL_CONVOLVE_1X1_S8_FAST, run_convolve_1x1_s8_fast},
+    {"arm_convolve_1x1_s4_fast", ARM_NN_KERNEL_CONVOLVE_1X1_S4_FAST, run_convolve_1x1_s4_fast},
+    {"arm_convolve_1_x_n_s8", CONVOLVE_1_X_N_KERNEL, run_convolve_1_x_n_s8},
+    {"arm_convolve_small_ch_s8", ARM_NN_KERNEL_CONVOLVE_SMALL_CH_S8, run_convolve_small_ch_s8},
+    {"arm_depthwise_conv_s8", ARM_NN_KERNEL_DEPTHWISE_CONV_S8, run_depthwise_conv_s8},
+    {"arm_depthwise_conv_s8_strided_output", ARM_NN_KERNEL_DEPTHWISE_CONV_S8, run_depthwise_conv_s8_strided_output},
+    {"arm_depthwise_conv_s8_opt",
+     DEPTHWISE_OPT_KERNEL(ARM_NN_KERNEL_DEPTHWISE_CONV_S8_OPT),
+     run_depthwise_conv_s8_opt},
+    {"arm_depthwise_conv_3x3_s8", ARM_NN_KERNEL_DEPTHWISE_CONV_3X3_S8, run_depthwise_conv_3x3_s8},
+    {"arm_depthwise_conv_ch_mult_s8",
+     DEPTHWISE_OPT_KERNEL(ARM_NN_KERNEL_DEPTHWISE_CONV_CH_MULT_S8),
+     run_depthwise_conv_ch_mult_s8},
+    {"arm_fully_connected_s8", ARM_NN_KERNEL_FULLY_CONNECTED_S8, run_fully_connected_s8},
+    {"arm_fully_connected_s8_strided_output",
+     ARM_NN_KERNEL_FULLY_CONNECTED_S8,
+     run_fully_connected_s8_strided_output},
+    {"arm_fully_connected_s4", ARM_NN_KERNEL_FULLY_CONNECTED_S4, run_fully_connected_s4},
+    {"arm_fully_connected_sparse_s8", ARM_NN_KERNEL_FULLY_CONNECTED_SPARSE_S8, run_fully_connected_sparse_s8},
+    {"arm_batch_matmul_s8", ARM_NN_KERNEL_BATCH_MATMUL_S8, run_batch_matmul_s8},
+    {"arm_avgpool_s8", ARM_NN_KERNEL_AVGPOOL_S8, run_avgpool_s8},
+    {"arm_avgpool_s8_requantize", ARM_NN_KERNEL_AVGPOOL_S8, run_avgpool_s8_requantize},
+    {"arm_max_pool_s8", ARM_NN_KERNEL_MAX_POOL_S8, run_max_pool_s8},
+    {"arm_max_pool_s8_requantize", ARM_NN_KERNEL_MAX_POOL_S8, run_max_pool_s8_requantize},
+    {"arm_elementwise_add_s8", ARM_NN_KERNEL_ELEMENTWISE_ADD_S8, run_elementwise_add_s8},
+    {"arm_elementwise_mul_s8", ARM_NN_KERNEL_ELEMENTWISE_MUL_S8, run_elementwise_mul_s8},
+    {"arm_relu6_s8", ARM_NN_KERNEL_RELU6_S8, run_relu6_s8},
+    {"arm_activation_lut_s8", ARM_NN_KERNEL_ACTIVATION_LUT_S8, run_activation_lut_s8},
+    {"arm_activation_lut_s16", ARM_NN_KERNEL_ACTIVATION_LUT_S16, run_activation_lut_s16},
+    {"arm_softmax_s8", ARM_NN_KERNEL_SOFTMAX_S8, run_softmax_s8},
+    {"arm_softmax_s8_fast", ARM_NN_KERNEL_SOFTMAX_S8_FAST, run_softmax_s8_fast},
+    {"arm_log_softmax_s8", ARM_NN_KERNEL_LOG_SOFTMAX_S8, run_log_softmax_s8},
+    {"arm_softmax_s16", ARM_NN_KERNEL_SOFTMAX_S16, run_softmax_s16},
+    {"arm_layer_norm_s16", ARM_NN_KERNEL_LAYER_NORM_S16, run_layer_norm_s16},
+    {"arm_mean_s8", ARM_NN_KERNEL_MEAN_S8, run_mean_s8},
+    {"arm_reduce_sum_s8", ARM_NN_KERNEL_REDUCE_SUM_S8, run_reduce_sum_s8},
+    {"arm_quantize_f32_s8", ARM_NN_KERNEL_QUANTIZE_F32_S8, run_quantize_f32_s8},
+    {"arm_quantize_f32_s16", ARM_NN_KERNEL_QUANTIZE_F32_S16, run_quantize_f32_s16},
+    {"arm_dequantize_s8_f32", ARM_NN_KERNEL_DEQUANTIZE_S8_F32, run_dequantize_s8_f32},
+    {"arm_requantize_s8", ARM_NN_KERNEL_REQUANTIZE_S8, run_requantize_s8},
+    {"arm_requantize_per_channel_s8", ARM_NN_KERNEL_REQUANTIZE_PER_CHANNEL_S8, run_requantize_per_channel_s8},
+    {"arm_concatenation_s8_x", ARM_NN_KERNEL_CONCATENATION_S8, run_concatenation_s8_x},
+    {"arm_concatenation_s8_y", ARM_NN_KERNEL_CONCATENATION_S8, run_concatenation_s8_y},
+    {"arm_concatenation_s8_z", ARM_NN_KERNEL_CONCATENATION_S8, run_concatenation_s8_z},
+    {"arm_concatenation_s8_w", ARM_NN_KERNEL_CONCATENATION_S8, run_concatenation_s8_w},
+    {"arm_reshape_s8", ARM_NN_KERNEL_RESHAPE_S8, run_reshape_s8},
+    {"arm_pad_s8", ARM_NN_KERNEL_PAD_S8, run_pad_s8},
+    {"arm_strided_slice_s8", ARM_NN_KERNEL_STRIDED_SLICE_S8, run_strided_slice_s8},
+};
+
+#define NUM_CASES (int32_t)(sizeof(cases) / sizeof(cases[0]))
+
+static int test_case(const profile_case *test)
+{
+    depth = num_begin = num_end = num_errors = 0;
+    const arm_status status = test->run();
+    const int passed = status == ARM_MATH_SUCCESS && num_errors == 0 && depth == 0 && num_begin > 0 &&
+        num_begin == num_end && recorded[0] == test->kernel;
+
+    printf("%-40s %s", test->name, passed ? "PASS" : "FAIL");
+    if (!passed)
+    {
+        printf(" (status %d, %d begin, %d end, %d unmatched, reported %s)", (int)status, num_begin, num_end,
+               num_errors, num_begin > 0 ? arm_nn_profile_kernel_name(recorded[0]) : "nothing");
+    }
+    printf("\n");
+    return passed;
+}
+
+int main(void)
+{
+    int32_t covered[ARM_NN_KERNEL_COUNT];
+    int failures = 0;
+
+    for (int32_t i = 0; i < DATA_SIZE; i++)
+    {
+        output_mult[i] = 1073741824;
+    }
+    arm_nn_profile_set_callbacks(record_begin, record_end);
+
+    memset(covered, 0, sizeof(covered));
+    for (int32_t i = 0; i < NUM_CASES; i++)
+    {
+        failures += !test_case(&cases[i]);
+        covered[cases[i].kernel] = 1;
+    }
+
+    /* Every kernel identifier must be reported by at least one case, so that new kernels get a case here */
+#if !defined(ARM_MATH_MVEI)
+    covered[ARM_NN_KERNEL_CONVOLVE_1_X_N_S8] = 1;
+#endif
+#if !defined(ARM_MATH_MVEI) && !defined(ARM_MATH_DSP)
+    covered[ARM_NN_KERNEL_DEPTHWISE_CONV_S8_OPT] = 1;
+    covered[ARM_NN_KERNEL_DEPTHWISE_CONV_CH_MULT_S8] = 1;
+#endif
+    for (int32_t kernel = 0; kernel < ARM_NN_KERNEL_COUNT; kernel++)
+    {
+        if (!covered[kernel])
+        {
+            printf("%-40s not covered\n", arm_nn_profile_kernel_name((arm_nn_kernel_id)kernel));
+            failures++;
+        }
+    }
+
+    printf("%d of %d cases failed\n", failures, NUM_CASES);
+    return failures == 0 ? 0 : 1;
+}
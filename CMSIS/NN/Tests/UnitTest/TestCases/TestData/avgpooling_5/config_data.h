@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using TFL version 2.3.0 as reference.
+#define AVGPOOLING_5_OUT_CH 7
+#define AVGPOOLING_5_IN_CH 7
+#define AVGPOOLING_5_INPUT_W 20
+#define AVGPOOLING_5_INPUT_H 20
+#define AVGPOOLING_5_DST_SIZE 7
+#define AVGPOOLING_5_INPUT_SIZE 2800
+#define AVGPOOLING_5_INPUT_OFFSET 0
+#define AVGPOOLING_5_OUTPUT_OFFSET 0
+#define AVGPOOLING_5_OUT_ACTIVATION_MIN -128
+#define AVGPOOLING_5_OUT_ACTIVATION_MAX 127
+#define AVGPOOLING_5_INPUT_BATCHES 1
+#define AVGPOOLING_5_FILTER_X 20
+#define AVGPOOLING_5_FILTER_Y 20
+#define AVGPOOLING_5_STRIDE_X 1
+#define AVGPOOLING_5_STRIDE_Y 1
+#define AVGPOOLING_5_PAD_X 0
+#define AVGPOOLING_5_PAD_Y 0
+#define AVGPOOLING_5_OUTPUT_W 1
+#define AVGPOOLING_5_OUTPUT_H 1
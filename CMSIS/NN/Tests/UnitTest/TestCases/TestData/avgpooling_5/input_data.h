@@ -0,0 +1,2826 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using TFL version 2.3.0 as reference.
+#include <stdint.h>
+
+int8_t avgpooling_5_input[2800] =
+{
+  113,
+  -85,
+  71,
+  -85,
+  85,
+  -99,
+  113,
+  99,
+  -85,
+  85,
+  -99,
+  99,
+  -85,
+  99,
+  113,
+  -85,
+  85,
+  -85,
+  71,
+  -113,
+  113,
+  85,
+  -113,
+  99,
+  -85,
+  71,
+  -71,
+  113,
+  99,
+  -99,
+  85,
+  -99,
+  85,
+  -71,
+  71,
+  99,
+  -99,
+  113,
+  -85,
+  113,
+  -99,
+  71,
+  71,
+  -113,
+  71,
+  -71,
+  113,
+  -85,
+  113,
+  85,
+  -71,
+  71,
+  -85,
+  85,
+  -85,
+  71,
+  71,
+  -85,
+  99,
+  -85,
+  99,
+  -113,
+  99,
+  71,
+  -85,
+  85,
+  -71,
+  71,
+  -113,
+  99,
+  113,
+  -85,
+  85,
+  -85,
+  113,
+  -85,
+  85,
+  99,
+  -85,
+  99,
+  -113,
+  99,
+  -113,
+  99,
+  113,
+  -71,
+  99,
+  -113,
+  85,
+  -99,
+  71,
+  71,
+  -99,
+  113,
+  -113,
+  85,
+  -71,
+  85,
+  99,
+  -85,
+  113,
+  -99,
+  71,
+  -71,
+  71,
+  71,
+  -99,
+  113,
+  -113,
+  99,
+  -99,
+  99,
+  113,
+  -99,
+  99,
+  -113,
+  99,
+  -85,
+  113,
+  71,
+  -113,
+  85,
+  -113,
+  85,
+  -99,
+  99,
+  113,
+  -85,
+  99,
+  -113,
+  99,
+  -85,
+  85,
+  85,
+  -85,
+  85,
+  -71,
+  71,
+  -113,
+  85,
+  85,
+  -113,
+  71,
+  -113,
+  85,
+  -85,
+  85,
+  113,
+  -85,
+  99,
+  -71,
+  99,
+  -71,
+  113,
+  71,
+  -113,
+  85,
+  -71,
+  85,
+  -85,
+  71,
+  113,
+  -99,
+  71,
+  -99,
+  85,
+  -99,
+  71,
+  71,
+  -99,
+  113,
+  -71,
+  113,
+  -71,
+  113,
+  85,
+  -113,
+  113,
+  -99,
+  113,
+  -71,
+  113,
+  113,
+  -99,
+  99,
+  -85,
+  99,
+  -71,
+  71,
+  85,
+  -99,
+  85,
+  -71,
+  85,
+  -71,
+  99,
+  113,
+  -99,
+  71,
+  -99,
+  113,
+  -113,
+  99,
+  99,
+  -71,
+  99,
+  -113,
+  71,
+  -71,
+  85,
+  71,
+  -113,
+  85,
+  -85,
+  85,
+  -113,
+  99,
+  99,
+  -85,
+  99,
+  -99,
+  99,
+  -99,
+  85,
+  85,
+  -113,
+  85,
+  -85,
+  85,
+  -99,
+  99,
+  99,
+  -99,
+  113,
+  -71,
+  113,
+  -113,
+  85,
+  99,
+  -99,
+  71,
+  -99,
+  85,
+  -113,
+  85,
+  85,
+  -99,
+  85,
+  -113,
+  85,
+  -71,
+  99,
+  85,
+  -71,
+  71,
+  -99,
+  113,
+  -85,
+  71,
+  99,
+  -113,
+  85,
+  -113,
+  85,
+  -85,
+  85,
+  85,
+  -113,
+  85,
+  -85,
+  99,
+  -85,
+  99,
+  85,
+  -99,
+  85,
+  -99,
+  113,
+  -99,
+  85,
+  99,
+  -113,
+  71,
+  -71,
+  113,
+  -99,
+  71,
+  85,
+  -71,
+  85,
+  -99,
+  71,
+  -113,
+  99,
+  99,
+  -85,
+  85,
+  -99,
+  113,
+  -113,
+  71,
+  113,
+  -71,
+  113,
+  -99,
+  85,
+  -85,
+  99,
+  71,
+  -85,
+  99,
+  -85,
+  113,
+  -71,
+  71,
+  99,
+  -99,
+  99,
+  -71,
+  113,
+  -99,
+  99,
+  85,
+  -71,
+  71,
+  -113,
+  99,
+  -99,
+  85,
+  99,
+  -113,
+  113,
+  -99,
+  85,
+  -99,
+  71,
+  71,
+  -71,
+  113,
+  -99,
+  85,
+  -99,
+  71,
+  71,
+  -113,
+  71,
+  -85,
+  85,
+  -71,
+  113,
+  71,
+  -85,
+  99,
+  -99,
+  113,
+  -71,
+  71,
+  99,
+  -71,
+  99,
+  -71,
+  71,
+  -71,
+  99,
+  71,
+  -71,
+  71,
+  -99,
+  99,
+  -99,
+  99,
+  85,
+  -113,
+  71,
+  -71,
+  71,
+  -85,
+  99,
+  113,
+  -113,
+  113,
+  -99,
+  71,
+  -71,
+  113,
+  113,
+  -85,
+  99,
+  -85,
+  71,
+  -71,
+  99,
+  113,
+  -71,
+  71,
+  -99,
+  85,
+  -113,
+  99,
+  99,
+  -85,
+  85,
+  -85,
+  85,
+  -113,
+  99,
+  71,
+  -71,
+  85,
+  -71,
+  85,
+  -71,
+  99,
+  99,
+  -85,
+  99,
+  -113,
+  71,
+  -71,
+  99,
+  85,
+  -99,
+  85,
+  -71,
+  99,
+  -99,
+  71,
+  113,
+  -113,
+  85,
+  -85,
+  85,
+  -99,
+  71,
+  113,
+  -99,
+  85,
+  -85,
+  71,
+  -71,
+  99,
+  99,
+  -113,
+  71,
+  -71,
+  85,
+  -113,
+  99,
+  85,
+  -99,
+  99,
+  -99,
+  99,
+  -71,
+  71,
+  85,
+  -85,
+  85,
+  -113,
+  113,
+  -71,
+  113,
+  113,
+  -71,
+  99,
+  -71,
+  85,
+  -71,
+  71,
+  71,
+  -85,
+  99,
+  -85,
+  71,
+  -71,
+  99,
+  71,
+  -99,
+  85,
+  -71,
+  71,
+  -71,
+  71,
+  85,
+  -99,
+  71,
+  -113,
+  99,
+  -85,
+  85,
+  99,
+  -99,
+  71,
+  -71,
+  71,
+  -113,
+  85,
+  99,
+  -113,
+  113,
+  -71,
+  85,
+  -85,
+  71,
+  113,
+  -71,
+  113,
+  -85,
+  85,
+  -85,
+  113,
+  113,
+  -113,
+  71,
+  -85,
+  113,
+  -99,
+  85,
+  113,
+  -113,
+  85,
+  -71,
+  113,
+  -85,
+  99,
+  71,
+  -113,
+  113,
+  -85,
+  113,
+  -113,
+  71,
+  85,
+  -113,
+  85,
+  -113,
+  71,
+  -71,
+  99,
+  113,
+  -113,
+  99,
+  -113,
+  71,
+  -85,
+  99,
+  113,
+  -71,
+  113,
+  -71,
+  71,
+  -85,
+  113,
+  113,
+  -113,
+  113,
+  -71,
+  99,
+  -85,
+  113,
+  99,
+  -85,
+  99,
+  -85,
+  99,
+  -85,
+  85,
+  113,
+  -99,
+  85,
+  -113,
+  85,
+  -85,
+  99,
+  85,
+  -99,
+  71,
+  -99,
+  113,
+  -85,
+  85,
+  85,
+  -71,
+  99,
+  -85,
+  85,
+  -113,
+  99,
+  85,
+  -85,
+  99,
+  -85,
+  85,
+  -85,
+  113,
+  85,
+  -71,
+  71,
+  -113,
+  71,
+  -113,
+  71,
+  113,
+  -113,
+  85,
+  -71,
+  113,
+  -71,
+  71,
+  71,
+  -99,
+  99,
+  -71,
+  71,
+  -99,
+  99,
+  99,
+  -85,
+  85,
+  -85,
+  71,
+  -71,
+  85,
+  99,
+  -99,
+  113,
+  -71,
+  85,
+  -85,
+  85,
+  99,
+  -99,
+  85,
+  -99,
+  85,
+  -99,
+  99,
+  113,
+  -85,
+  85,
+  -113,
+  85,
+  -113,
+  113,
+  85,
+  -85,
+  99,
+  -99,
+  85,
+  -113,
+  71,
+  99,
+  -85,
+  99,
+  -113,
+  99,
+  -113,
+  99,
+  113,
+  -85,
+  85,
+  -113,
+  113,
+  -71,
+  113,
+  71,
+  -85,
+  99,
+  -71,
+  85,
+  -99,
+  85,
+  85,
+  -99,
+  71,
+  -85,
+  113,
+  -99,
+  71,
+  99,
+  -71,
+  71,
+  -113,
+  113,
+  -71,
+  85,
+  85,
+  -113,
+  99,
+  -85,
+  71,
+  -85,
+  99,
+  113,
+  -71,
+  71,
+  -99,
+  99,
+  -99,
+  85,
+  71,
+  -85,
+  113,
+  -99,
+  99,
+  -99,
+  85,
+  85,
+  -71,
+  71,
+  -113,
+  85,
+  -99,
+  85,
+  99,
+  -99,
+  99,
+  -85,
+  71,
+  -71,
+  113,
+  113,
+  -99,
+  85,
+  -113,
+  85,
+  -71,
+  99,
+  71,
+  -85,
+  99,
+  -71,
+  99,
+  -71,
+  99,
+  113,
+  -99,
+  99,
+  -113,
+  71,
+  -113,
+  99,
+  71,
+  -71,
+  113,
+  -113,
+  113,
+  -99,
+  113,
+  71,
+  -85,
+  99,
+  -113,
+  99,
+  -113,
+  113,
+  71,
+  -113,
+  113,
+  -71,
+  85,
+  -71,
+  99,
+  85,
+  -85,
+  71,
+  -99,
+  113,
+  -113,
+  113,
+  99,
+  -71,
+  99,
+  -99,
+  99,
+  -85,
+  99,
+  113,
+  -99,
+  71,
+  -85,
+  71,
+  -85,
+  71,
+  99,
+  -71,
+  71,
+  -71,
+  99,
+  -85,
+  85,
+  99,
+  -71,
+  113,
+  -71,
+  99,
+  -99,
+  99,
+  71,
+  -99,
+  71,
+  -113,
+  85,
+  -85,
+  71,
+  113,
+  -99,
+  99,
+  -85,
+  99,
+  -113,
+  99,
+  113,
+  -85,
+  85,
+  -113,
+  85,
+  -71,
+  99,
+  99,
+  -85,
+  85,
+  -99,
+  113,
+  -85,
+  113,
+  113,
+  -113,
+  99,
+  -85,
+  71,
+  -85,
+  99,
+  71,
+  -113,
+  71,
+  -113,
+  99,
+  -113,
+  71,
+  71,
+  -71,
+  71,
+  -113,
+  113,
+  -71,
+  85,
+  71,
+  -99,
+  99,
+  -113,
+  85,
+  -85,
+  71,
+  99,
+  -85,
+  113,
+  -99,
+  113,
+  -71,
+  113,
+  71,
+  -71,
+  85,
+  -99,
+  99,
+  -85,
+  85,
+  99,
+  -113,
+  71,
+  -99,
+  99,
+  -99,
+  99,
+  85,
+  -113,
+  113,
+  -113,
+  99,
+  -85,
+  99,
+  99,
+  -85,
+  85,
+  -113,
+  113,
+  -113,
+  99,
+  113,
+  -99,
+  71,
+  -85,
+  113,
+  -85,
+  71,
+  85,
+  -113,
+  99,
+  -99,
+  113,
+  -113,
+  85,
+  85,
+  -99,
+  99,
+  -85,
+  71,
+  -85,
+  85,
+  99,
+  -113,
+  85,
+  -99,
+  71,
+  -71,
+  71,
+  71,
+  -113,
+  113,
+  -85,
+  99,
+  -113,
+  71,
+  85,
+  -85,
+  71,
+  -99,
+  99,
+  -85,
+  71,
+  99,
+  -99,
+  71,
+  -99,
+  113,
+  -71,
+  113,
+  71,
+  -99,
+  85,
+  -85,
+  71,
+  -99,
+  99,
+  113,
+  -71,
+  71,
+  -113,
+  113,
+  -85,
+  85,
+  85,
+  -99,
+  85,
+  -113,
+  99,
+  -85,
+  99,
+  71,
+  -99,
+  85,
+  -113,
+  99,
+  -71,
+  71,
+  71,
+  -99,
+  71,
+  -85,
+  71,
+  -113,
+  85,
+  85,
+  -99,
+  99,
+  -71,
+  71,
+  -71,
+  99,
+  71,
+  -113,
+  113,
+  -71,
+  85,
+  -85,
+  71,
+  113,
+  -99,
+  85,
+  -71,
+  85,
+  -85,
+  85,
+  99,
+  -99,
+  99,
+  -85,
+  113,
+  -71,
+  71,
+  113,
+  -85,
+  71,
+  -99,
+  71,
+  -113,
+  113,
+  113,
+  -113,
+  113,
+  -85,
+  85,
+  -99,
+  85,
+  71,
+  -71,
+  85,
+  -99,
+  71,
+  -99,
+  71,
+  85,
+  -85,
+  113,
+  -71,
+  99,
+  -99,
+  99,
+  113,
+  -85,
+  99,
+  -85,
+  71,
+  -71,
+  71,
+  71,
+  -99,
+  71,
+  -113,
+  99,
+  -99,
+  99,
+  71,
+  -85,
+  113,
+  -99,
+  71,
+  -85,
+  113,
+  99,
+  -71,
+  71,
+  -113,
+  71,
+  -85,
+  113,
+  85,
+  -99,
+  71,
+  -85,
+  99,
+  -85,
+  113,
+  71,
+  -71,
+  85,
+  -85,
+  85,
+  -113,
+  71,
+  113,
+  -85,
+  71,
+  -113,
+  99,
+  -113,
+  113,
+  113,
+  -113,
+  85,
+  -99,
+  71,
+  -85,
+  71,
+  99,
+  -71,
+  71,
+  -99,
+  99,
+  -85,
+  71,
+  71,
+  -71,
+  99,
+  -113,
+  71,
+  -85,
+  85,
+  85,
+  -71,
+  85,
+  -99,
+  113,
+  -85,
+  113,
+  99,
+  -71,
+  113,
+  -113,
+  113,
+  -71,
+  71,
+  99,
+  -71,
+  113,
+  -113,
+  113,
+  -113,
+  99,
+  113,
+  -99,
+  113,
+  -113,
+  99,
+  -85,
+  99,
+  71,
+  -99,
+  71,
+  -99,
+  113,
+  -71,
+  85,
+  113,
+  -99,
+  71,
+  -113,
+  113,
+  -99,
+  113,
+  71,
+  -113,
+  99,
+  -113,
+  71,
+  -113,
+  71,
+  113,
+  -71,
+  85,
+  -85,
+  71,
+  -113,
+  85,
+  85,
+  -99,
+  99,
+  -99,
+  99,
+  -71,
+  71,
+  71,
+  -71,
+  71,
+  -113,
+  85,
+  -71,
+  71,
+  99,
+  -99,
+  99,
+  -85,
+  85,
+  -85,
+  85,
+  113,
+  -85,
+  99,
+  -85,
+  71,
+  -113,
+  99,
+  71,
+  -99,
+  71,
+  -85,
+  85,
+  -99,
+  71,
+  85,
+  -85,
+  113,
+  -113,
+  99,
+  -99,
+  85,
+  71,
+  -113,
+  71,
+  -85,
+  71,
+  -71,
+  85,
+  71,
+  -85,
+  85,
+  -99,
+  113,
+  -71,
+  113,
+  99,
+  -85,
+  71,
+  -71,
+  99,
+  -85,
+  99,
+  113,
+  -85,
+  113,
+  -113,
+  99,
+  -113,
+  85,
+  113,
+  -113,
+  85,
+  -85,
+  71,
+  -99,
+  85,
+  71,
+  -113,
+  99,
+  -113,
+  113,
+  -113,
+  113,
+  99,
+  -71,
+  71,
+  -71,
+  85,
+  -71,
+  99,
+  99,
+  -99,
+  113,
+  -71,
+  99,
+  -85,
+  71,
+  85,
+  -71,
+  85,
+  -85,
+  113,
+  -113,
+  99,
+  113,
+  -99,
+  71,
+  -99,
+  71,
+  -99,
+  99,
+  99,
+  -99,
+  113,
+  -99,
+  85,
+  -71,
+  85,
+  99,
+  -99,
+  85,
+  -71,
+  113,
+  -71,
+  99,
+  99,
+  -113,
+  113,
+  -113,
+  99,
+  -113,
+  85,
+  99,
+  -99,
+  99,
+  -113,
+  99,
+  -99,
+  99,
+  85,
+  -85,
+  113,
+  -85,
+  99,
+  -85,
+  99,
+  113,
+  -85,
+  71,
+  -113,
+  85,
+  -113,
+  85,
+  71,
+  -85,
+  71,
+  -71,
+  85,
+  -85,
+  113,
+  71,
+  -99,
+  113,
+  -71,
+  113,
+  -85,
+  99,
+  71,
+  -85,
+  85,
+  -71,
+  99,
+  -99,
+  113,
+  113,
+  -113,
+  99,
+  -85,
+  71,
+  -71,
+  113,
+  85,
+  -71,
+  99,
+  -113,
+  85,
+  -71,
+  85,
+  113,
+  -99,
+  85,
+  -85,
+  71,
+  -71,
+  85,
+  71,
+  -99,
+  99,
+  -71,
+  85,
+  -113,
+  113,
+  71,
+  -99,
+  99,
+  -71,
+  113,
+  -113,
+  85,
+  113,
+  -85,
+  99,
+  -99,
+  113,
+  -71,
+  113,
+  71,
+  -113,
+  85,
+  -85,
+  85,
+  -113,
+  71,
+  99,
+  -99,
+  113,
+  -71,
+  85,
+  -113,
+  113,
+  99,
+  -113,
+  99,
+  -85,
+  113,
+  -85,
+  71,
+  71,
+  -71,
+  85,
+  -113,
+  113,
+  -71,
+  113,
+  71,
+  -113,
+  99,
+  -85,
+  99,
+  -71,
+  113,
+  71,
+  -85,
+  99,
+  -99,
+  113,
+  -71,
+  113,
+  113,
+  -71,
+  113,
+  -99,
+  85,
+  -113,
+  113,
+  99,
+  -99,
+  71,
+  -71,
+  85,
+  -85,
+  71,
+  85,
+  -85,
+  85,
+  -85,
+  85,
+  -85,
+  113,
+  113,
+  -71,
+  99,
+  -85,
+  71,
+  -113,
+  85,
+  99,
+  -113,
+  113,
+  -71,
+  71,
+  -113,
+  85,
+  113,
+  -99,
+  71,
+  -85,
+  85,
+  -71,
+  99,
+  113,
+  -113,
+  99,
+  -99,
+  99,
+  -85,
+  71,
+  71,
+  -71,
+  99,
+  -85,
+  85,
+  -85,
+  85,
+  71,
+  -99,
+  113,
+  -85,
+  85,
+  -113,
+  99,
+  99,
+  -113,
+  85,
+  -113,
+  85,
+  -99,
+  71,
+  99,
+  -85,
+  113,
+  -99,
+  113,
+  -85,
+  99,
+  85,
+  -113,
+  71,
+  -85,
+  113,
+  -99,
+  113,
+  113,
+  -99,
+  71,
+  -113,
+  85,
+  -99,
+  71,
+  85,
+  -99,
+  99,
+  -99,
+  99,
+  -85,
+  113,
+  85,
+  -85,
+  85,
+  -113,
+  85,
+  -99,
+  71,
+  113,
+  -85,
+  85,
+  -71,
+  99,
+  -113,
+  99,
+  113,
+  -85,
+  71,
+  -99,
+  71,
+  -85,
+  71,
+  85,
+  -99,
+  113,
+  -99,
+  113,
+  -85,
+  71,
+  113,
+  -99,
+  85,
+  -113,
+  99,
+  -71,
+  71,
+  99,
+  -85,
+  71,
+  -113,
+  71,
+  -113,
+  113,
+  99,
+  -85,
+  71,
+  -71,
+  85,
+  -71,
+  71,
+  113,
+  -85,
+  71,
+  -71,
+  85,
+  -71,
+  99,
+  99,
+  -71,
+  71,
+  -85,
+  71,
+  -71,
+  71,
+  71,
+  -99,
+  85,
+  -113,
+  113,
+  -85,
+  85,
+  71,
+  -85,
+  99,
+  -99,
+  99,
+  -71,
+  71,
+  85,
+  -85,
+  71,
+  -71,
+  113,
+  -99,
+  99,
+  85,
+  -85,
+  71,
+  -85,
+  113,
+  -85,
+  71,
+  85,
+  -71,
+  99,
+  -85,
+  71,
+  -71,
+  99,
+  85,
+  -85,
+  71,
+  -71,
+  85,
+  -85,
+  85,
+  71,
+  -71,
+  113,
+  -99,
+  71,
+  -71,
+  113,
+  71,
+  -85,
+  113,
+  -113,
+  99,
+  -99,
+  71,
+  113,
+  -99,
+  113,
+  -85,
+  99,
+  -99,
+  99,
+  113,
+  -71,
+  99,
+  -113,
+  85,
+  -113,
+  113,
+  85,
+  -85,
+  85,
+  -99,
+  113,
+  -99,
+  71,
+  71,
+  -99,
+  113,
+  -113,
+  113,
+  -85,
+  85,
+  113,
+  -85,
+  71,
+  -99,
+  113,
+  -71,
+  71,
+  85,
+  -99,
+  99,
+  -113,
+  113,
+  -99,
+  71,
+  113,
+  -99,
+  113,
+  -113,
+  71,
+  -71,
+  85,
+  71,
+  -71,
+  85,
+  -85,
+  99,
+  -85,
+  113,
+  99,
+  -71,
+  71,
+  -71,
+  85,
+  -99,
+  99,
+  85,
+  -99,
+  99,
+  -113,
+  99,
+  -71,
+  113,
+  113,
+  -85,
+  99,
+  -113,
+  85,
+  -71,
+  99,
+  85,
+  -113,
+  99,
+  -71,
+  85,
+  -99,
+  113,
+  71,
+  -71,
+  113,
+  -113,
+  71,
+  -99,
+  113,
+  71,
+  -71,
+  113,
+  -99,
+  71,
+  -71,
+  85,
+  99,
+  -71,
+  85,
+  -99,
+  71,
+  -113,
+  113,
+  99,
+  -85,
+  113,
+  -99,
+  71,
+  -113,
+  99,
+  99,
+  -71,
+  113,
+  -113,
+  99,
+  -85,
+  71,
+  85,
+  -99,
+  99,
+  -85,
+  71,
+  -71,
+  99,
+  85,
+  -99,
+  99,
+  -99,
+  99,
+  -99,
+  113,
+  99,
+  -99,
+  113,
+  -113,
+  85,
+  -113,
+  113,
+  113,
+  -85,
+  85,
+  -99,
+  113,
+  -85,
+  85,
+  85,
+  -113,
+  113,
+  -85,
+  99,
+  -71,
+  113,
+  85,
+  -85,
+  99,
+  -85,
+  99,
+  -113,
+  99,
+  99,
+  -85,
+  99,
+  -99,
+  85,
+  -113,
+  85,
+  71,
+  -99,
+  99,
+  -99,
+  113,
+  -85,
+  85,
+  85,
+  -99,
+  113,
+  -99,
+  71,
+  -71,
+  71,
+  71,
+  -99,
+  71,
+  -71,
+  99,
+  -85,
+  71,
+  85,
+  -85,
+  113,
+  -99,
+  113,
+  -71,
+  99,
+  99,
+  -113,
+  71,
+  -99,
+  85,
+  -113,
+  99,
+  99,
+  -113,
+  85,
+  -99,
+  113,
+  -113,
+  71,
+  113,
+  -71,
+  113,
+  -113,
+  99,
+  -85,
+  113,
+  99,
+  -99,
+  71,
+  -113,
+  99,
+  -71,
+  99,
+  71,
+  -113,
+  113,
+  -85,
+  71,
+  -99,
+  71,
+  99,
+  -113,
+  99,
+  -99,
+  71,
+  -113,
+  99,
+  85,
+  -113,
+  71,
+  -85,
+  99,
+  -71,
+  113,
+  99,
+  -71,
+  113,
+  -113,
+  85,
+  -113,
+  85,
+  113,
+  -99,
+  71,
+  -71,
+  71,
+  -113,
+  113,
+  85,
+  -99,
+  71,
+  -113,
+  85,
+  -99,
+  71,
+  71,
+  -99,
+  113,
+  -113,
+  71,
+  -99,
+  85,
+  113,
+  -99,
+  113,
+  -99,
+  85,
+  -85,
+  113,
+  99,
+  -85,
+  113,
+  -85,
+  99,
+  -85,
+  113,
+  99,
+  -113,
+  85,
+  -113,
+  99,
+  -99,
+  71,
+  85,
+  -113,
+  85,
+  -99,
+  99,
+  -99,
+  71,
+  85,
+  -99,
+  85,
+  -71,
+  99,
+  -85,
+  99,
+  85,
+  -99,
+  99,
+  -113,
+  113,
+  -85,
+  99,
+  99,
+  -71,
+  113,
+  -85,
+  71,
+  -71,
+  99,
+  85,
+  -85,
+  99,
+  -99,
+  113,
+  -85,
+  99,
+  85,
+  -99,
+  71,
+  -85,
+  99,
+  -71,
+  113,
+  85,
+  -85,
+  85,
+  -113,
+  99,
+  -99,
+  85,
+  99,
+  -85,
+  71,
+  -113,
+  113,
+  -113,
+  99,
+  85,
+  -99,
+  113,
+  -113,
+  71,
+  -113,
+  113,
+  71,
+  -85,
+  71,
+  -99,
+  99,
+  -85,
+  99,
+  71,
+  -85,
+  71,
+  -71,
+  99,
+  -113,
+  113,
+  71,
+  -99,
+  113,
+  -71,
+  113,
+  -113,
+  113,
+  85,
+  -113,
+  85,
+  -99,
+  113,
+  -113,
+  113,
+  99,
+  -85,
+  99,
+  -85,
+  113,
+  -113,
+  85,
+  71,
+  -85,
+  113,
+  -71,
+  113,
+  -113,
+  113,
+  113,
+  -85,
+  71,
+  -99,
+  113,
+  -71,
+  71,
+  85,
+  -85,
+  71,
+  -99,
+  113,
+  -99,
+  71,
+  85,
+  -85,
+  113,
+  -99,
+  85,
+  -99,
+  71,
+  99,
+  -85,
+  99,
+  -71,
+  85,
+  -99,
+  99,
+  85,
+  -85,
+  113,
+  -85,
+  99,
+  -85,
+  113,
+  113,
+  -99,
+  113,
+  -113,
+  85,
+  -71,
+  99,
+  71,
+  -71,
+  71,
+  -71,
+  85,
+  -85,
+  113,
+  113,
+  -71,
+  99,
+  -113,
+  99,
+  -113,
+  85,
+  113,
+  -113,
+  99,
+  -71,
+  71,
+  -113,
+  71,
+  71,
+  -113,
+  113,
+  -71,
+  99,
+  -113,
+  99,
+  113,
+  -71,
+  71,
+  -99,
+  71,
+  -71,
+  113,
+  113,
+  -85,
+  85,
+  -85,
+  113,
+  -85,
+  99,
+  113,
+  -71,
+  113,
+  -85,
+  113,
+  -71,
+  99,
+  113,
+  -85,
+  85,
+  -113,
+  85,
+  -85,
+  85,
+  113,
+  -99,
+  85,
+  -71,
+  71,
+  -99,
+  85,
+  113,
+  -71,
+  99,
+  -71,
+  71,
+  -71,
+  71,
+  99,
+  -71,
+  85,
+  -113,
+  71,
+  -113,
+  71,
+  99,
+  -113,
+  85,
+  -85,
+  71,
+  -71,
+  71,
+  85,
+  -113,
+  113,
+  -71,
+  85,
+  -85,
+  113,
+  99,
+  -113,
+  113,
+  -99,
+  99,
+  -99,
+  71,
+  99,
+  -71,
+  71,
+  -113,
+  85,
+  -85,
+  113,
+  113,
+  -113,
+  113,
+  -85,
+  71,
+  -85,
+  113,
+  113,
+  -99,
+  99,
+  -71,
+  85,
+  -113,
+  113,
+  71,
+  -113,
+  113,
+  -99,
+  71,
+  -85,
+  113,
+  113,
+  -113,
+  85,
+  -113,
+  71,
+  -113,
+  85,
+  71,
+  -71,
+  113,
+  -85,
+  71,
+  -85,
+  113,
+  113,
+  -85,
+  99,
+  -113,
+  113,
+  -113,
+  71,
+  85,
+  -85,
+  85,
+  -71,
+  113,
+  -99,
+  99,
+  85,
+  -113,
+  99,
+  -99,
+  99,
+  -113,
+  71,
+  99,
+  -99,
+  71,
+  -71,
+  99,
+  -99,
+  99,
+  113,
+  -113,
+  71,
+  -99,
+  71,
+  -85,
+  113,
+  113,
+  -99,
+  71,
+  -113,
+  71,
+  -113,
+  71,
+  85,
+  -71,
+  113,
+  -85,
+  85,
+  -71,
+  71,
+  99,
+  -71,
+  71,
+  -85,
+  85,
+  -71,
+  113,
+  113,
+  -71,
+  85,
+  -71,
+  99,
+  -85,
+  71,
+  113,
+  -113,
+  85,
+  -113,
+  113,
+  -113,
+  85,
+  113,
+  -85,
+  85,
+  -99,
+  113,
+  -85,
+  71,
+  99,
+  -99,
+  113,
+  -99,
+  113,
+  -113,
+  113,
+  85,
+  -85,
+  85,
+  -71,
+  85,
+  -85,
+  99,
+  85,
+  -71,
+  71,
+  -113,
+  113,
+  -113,
+  71,
+  113,
+  -71,
+  113,
+  -71,
+  85,
+  -71,
+  85,
+  85,
+  -85,
+  113,
+  -85,
+  113,
+  -99,
+  85,
+  99,
+  -85,
+  99,
+  -85,
+  113,
+  -71,
+  99,
+  113,
+  -71,
+  113,
+  -99,
+  85,
+  -99,
+  99,
+  99,
+  -85,
+  85,
+  -99,
+  71,
+  -113,
+  71,
+  113,
+  -113,
+  71,
+  -99,
+  99,
+  -99,
+  71,
+  99,
+  -71,
+  113,
+  -99,
+  113,
+  -99,
+  85,
+  99,
+  -71,
+  113,
+  -71,
+  85,
+  -99,
+  71,
+  71,
+  -71,
+  85,
+  -85,
+  113,
+  -71,
+  71,
+  99,
+  -113,
+  99,
+  -85,
+  113,
+  -85,
+  99,
+  85,
+  -85,
+  71,
+  -99,
+  85,
+  -113,
+  71,
+  99,
+  -113,
+  99,
+  -71,
+  113,
+  -99,
+  99,
+  71,
+  -113,
+  71,
+  -71,
+  113,
+  -99,
+  71,
+  71,
+  -113,
+  71,
+  -113,
+  85,
+  -85,
+  85,
+  71,
+  -99,
+  113,
+  -113,
+  113,
+  -85,
+  71,
+  85,
+  -71,
+  85,
+  -113,
+  99,
+  -113,
+  71,
+  71,
+  -71,
+  113,
+  -99,
+  113,
+  -85,
+  113,
+  85,
+  -71,
+  113,
+  -85,
+  85,
+  -99,
+  71,
+  113,
+  -85,
+  85,
+  -99,
+  71,
+  -85,
+  99,
+  113,
+  -85,
+  113,
+  -85,
+  99,
+  -113,
+  85,
+  85,
+  -99,
+  85,
+  -113,
+  99,
+  -71,
+  113,
+  113,
+  -113,
+  85,
+  -71,
+  71,
+  -71,
+  85,
+  71,
+  -71,
+  71,
+  -113,
+  71,
+  -99,
+  113,
+  113,
+  -113,
+  99,
+  -113,
+  85,
+  -99,
+  99,
+  99,
+  -85,
+  85,
+  -85,
+  99,
+  -113,
+  71,
+  99,
+  -71,
+  99,
+  -85,
+  85,
+  -99,
+  85,
+  85,
+  -99,
+  99,
+  -71,
+  113,
+  -71,
+  99,
+  71,
+  -71,
+  99,
+  -71,
+  85,
+  -99,
+  113,
+  113,
+  -99,
+  85,
+  -85,
+  99,
+  -71,
+  99,
+  85,
+  -85,
+  71,
+  -85,
+  113,
+  -113,
+  99,
+  71,
+  -113,
+  99,
+  -99,
+  85,
+  -113,
+  113,
+  71,
+  -71,
+  99,
+  -99,
+  113,
+  -113,
+  99,
+  99,
+  -71,
+  113,
+  -99,
+  85,
+  -85,
+  113,
+  99,
+  -113,
+  71,
+  -99,
+  85,
+  -85,
+  71,
+  85,
+  -99,
+  85,
+  -113,
+  113,
+  -99,
+  71,
+  85,
+  -99,
+  71,
+  -99,
+  113,
+  -71,
+  71,
+  99,
+  -99,
+  113,
+  -85,
+  85,
+  -113,
+  71,
+  99,
+  -71,
+  71,
+  -99,
+  85,
+  -99,
+  71,
+  113,
+  -99,
+  99,
+  -99,
+  113,
+  -71,
+  85,
+  113,
+  -113,
+  99,
+  -99,
+  71,
+  -71,
+  113,
+  85,
+  -71,
+  99,
+  -113,
+  113,
+  -99,
+  113,
+  113,
+  -85,
+  85,
+  -99,
+  71,
+  -99,
+  71,
+  99,
+  -99,
+  71,
+  -113,
+  71,
+  -99,
+  113,
+  71,
+  -85,
+  85,
+  -71,
+  71,
+  -71,
+  71,
+  99,
+  -85,
+  71,
+  -113,
+  113,
+  -113,
+  85,
+  71,
+  -113,
+  113,
+  -99,
+  99,
+  -85,
+  113,
+  71,
+  -113,
+  71,
+  -99,
+  85,
+  -99,
+  71,
+  113,
+  -71,
+  71,
+  -99,
+  113,
+  -113,
+  71,
+  113,
+  -71,
+  99,
+  -85,
+  71,
+  -71,
+  85,
+  113,
+  -71,
+  113,
+  -85,
+  99,
+  -99,
+  85,
+  113,
+  -71,
+  113,
+  -71,
+  85,
+  -71,
+  113,
+  85,
+  -99,
+  113,
+  -71,
+  113,
+  -113,
+  99,
+  85,
+  -71,
+  99,
+  -99,
+  113,
+  -71,
+  113,
+  113,
+  -99,
+  99,
+  -85,
+  71,
+  -113,
+  113,
+  85,
+  -71,
+  71,
+  -71,
+  113,
+  -113,
+  99,
+  99,
+  -85,
+  71,
+  -85,
+  99,
+  -99,
+  99,
+  113,
+  -113,
+  113,
+  -71,
+  85,
+  -99,
+  113,
+  85,
+  -85,
+  99,
+  -71,
+  99,
+  -113,
+  113,
+  71,
+  -85,
+  99,
+  -71,
+  99,
+  -99,
+  85,
+  113,
+  -71,
+  113,
+  -99,
+  99,
+  -99,
+  113,
+  113,
+  -71,
+  85,
+  -99,
+  99,
+  -113,
+  71,
+  85,
+  -113,
+  85,
+  -99,
+  113,
+  -113,
+  71,
+  85,
+  -85,
+  85,
+  -71,
+  113,
+  -85,
+  113,
+  71,
+  -99,
+  85,
+  -99,
+  71,
+  -71,
+  71,
+  71,
+  -99,
+  99,
+  -99,
+  113,
+  -71,
+  113,
+  99,
+  -85,
+  85,
+  -85,
+  99,
+  -71,
+  85,
+  99,
+  -71,
+  71,
+  -113,
+  99,
+  -71,
+  71,
+  99,
+  -85,
+  71,
+  -71,
+  85,
+  -99,
+  99,
+  85,
+  -99,
+  99,
+  -113,
+  85,
+  -99,
+  85,
+  99,
+  -71,
+  71,
+  -85,
+  71,
+  -113,
+  113
+};
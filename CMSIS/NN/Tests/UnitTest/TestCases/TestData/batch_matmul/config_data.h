@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define BATCH_MATMUL_LHS_BATCHES 2
+#define BATCH_MATMUL_LHS_ROWS 3
+#define BATCH_MATMUL_LHS_COLS 5
+#define BATCH_MATMUL_RHS_BATCHES 2
+#define BATCH_MATMUL_RHS_ROWS 5
+#define BATCH_MATMUL_RHS_COLS 4
+#define BATCH_MATMUL_OUTPUT_BATCHES 2
+#define BATCH_MATMUL_OUTPUT_ROWS 3
+#define BATCH_MATMUL_OUTPUT_COLS 4
+#define BATCH_MATMUL_ADJ_X 0
+#define BATCH_MATMUL_ADJ_Y 0
+#define BATCH_MATMUL_DST_SIZE 24
+#define BATCH_MATMUL_LHS_OFFSET 2
+#define BATCH_MATMUL_RHS_OFFSET 0
+#define BATCH_MATMUL_OUTPUT_OFFSET 3
+#define BATCH_MATMUL_OUTPUT_MULTIPLIER 1073741824
+#define BATCH_MATMUL_OUTPUT_SHIFT -6
+#define BATCH_MATMUL_OUT_ACTIVATION_MIN -128
+#define BATCH_MATMUL_OUT_ACTIVATION_MAX 127
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t batch_matmul_lhs[30] =
+{
+  30,
+  -116,
+  -30,
+  -124,
+  90,
+  -128,
+  50,
+  -15,
+  105,
+  86,
+  77,
+  117,
+  113,
+  -62,
+  104,
+  0,
+  -121,
+  -96,
+  113,
+  -117,
+  0,
+  65,
+  -74,
+  87,
+  -37,
+  90,
+  -78,
+  -5,
+  8,
+  50
+};
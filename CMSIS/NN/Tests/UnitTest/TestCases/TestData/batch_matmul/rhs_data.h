@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t batch_matmul_rhs[40] =
+{
+  -34,
+  11,
+  86,
+  -35,
+  -50,
+  51,
+  -120,
+  -16,
+  -126,
+  -65,
+  -86,
+  79,
+  36,
+  117,
+  55,
+  51,
+  -86,
+  -65,
+  6,
+  -104,
+  -22,
+  -79,
+  38,
+  23,
+  -44,
+  -9,
+  83,
+  10,
+  -87,
+  -122,
+  115,
+  -68,
+  56,
+  95,
+  -37,
+  -13,
+  -82,
+  74,
+  -68,
+  -105
+};
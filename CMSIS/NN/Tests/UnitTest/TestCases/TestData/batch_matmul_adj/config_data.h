@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define BATCH_MATMUL_ADJ_LHS_BATCHES 3
+#define BATCH_MATMUL_ADJ_LHS_ROWS 19
+#define BATCH_MATMUL_ADJ_LHS_COLS 5
+#define BATCH_MATMUL_ADJ_RHS_BATCHES 1
+#define BATCH_MATMUL_ADJ_RHS_ROWS 3
+#define BATCH_MATMUL_ADJ_RHS_COLS 19
+#define BATCH_MATMUL_ADJ_OUTPUT_BATCHES 3
+#define BATCH_MATMUL_ADJ_OUTPUT_ROWS 5
+#define BATCH_MATMUL_ADJ_OUTPUT_COLS 3
+#define BATCH_MATMUL_ADJ_ADJ_X 1
+#define BATCH_MATMUL_ADJ_ADJ_Y 1
+#define BATCH_MATMUL_ADJ_DST_SIZE 45
+#define BATCH_MATMUL_ADJ_LHS_OFFSET -4
+#define BATCH_MATMUL_ADJ_RHS_OFFSET 7
+#define BATCH_MATMUL_ADJ_OUTPUT_OFFSET -1
+#define BATCH_MATMUL_ADJ_OUTPUT_MULTIPLIER 1073741824
+#define BATCH_MATMUL_ADJ_OUTPUT_SHIFT -7
+#define BATCH_MATMUL_ADJ_OUT_ACTIVATION_MIN -128
+#define BATCH_MATMUL_ADJ_OUT_ACTIVATION_MAX 127
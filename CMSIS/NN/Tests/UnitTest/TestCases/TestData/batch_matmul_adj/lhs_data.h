@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t batch_matmul_adj_lhs[285] =
+{
+  114,
+  -58,
+  -105,
+  40,
+  -38,
+  -1,
+  -5,
+  27,
+  -97,
+  -34,
+  -124,
+  48,
+  -85,
+  27,
+  -127,
+  -103,
+  98,
+  29,
+  -63,
+  -5,
+  76,
+  -10,
+  -46,
+  -103,
+  35,
+  37,
+  -36,
+  -116,
+  -104,
+  -75,
+  -36,
+  80,
+  101,
+  -88,
+  -122,
+  61,
+  29,
+  49,
+  -26,
+  -49,
+  -44,
+  -4,
+  -30,
+  -29,
+  -58,
+  -2,
+  -97,
+  -73,
+  65,
+  109,
+  -55,
+  47,
+  -28,
+  -81,
+  -115,
+  -103,
+  -26,
+  -2,
+  -4,
+  101,
+  -58,
+  2,
+  91,
+  -118,
+  106,
+  30,
+  47,
+  -98,
+  -84,
+  -30,
+  104,
+  -118,
+  80,
+  -66,
+  26,
+  86,
+  35,
+  -24,
+  -125,
+  -8,
+  -113,
+  -124,
+  -100,
+  127,
+  -79,
+  -117,
+  49,
+  65,
+  -6,
+  66,
+  -106,
+  12,
+  51,
+  73,
+  -12,
+  -72,
+  21,
+  -78,
+  111,
+  -116,
+  -116,
+  10,
+  45,
+  7,
+  -97,
+  92,
+  109,
+  -16,
+  -4,
+  -64,
+  -88,
+  -20,
+  -2,
+  -110,
+  32,
+  -108,
+  3,
+  -70,
+  107,
+  -116,
+  58,
+  115,
+  61,
+  -36,
+  -112,
+  125,
+  -5,
+  -94,
+  -128,
+  -85,
+  117,
+  110,
+  -21,
+  44,
+  93,
+  25,
+  16,
+  -67,
+  -84,
+  -31,
+  -23,
+  53,
+  -71,
+  62,
+  44,
+  53,
+  -49,
+  116,
+  -127,
+  -124,
+  12,
+  79,
+  -64,
+  116,
+  15,
+  61,
+  30,
+  -11,
+  -11,
+  -52,
+  -76,
+  54,
+  38,
+  110,
+  33,
+  -58,
+  -113,
+  86,
+  -70,
+  92,
+  -120,
+  -107,
+  -124,
+  13,
+  17,
+  103,
+  -27,
+  -66,
+  78,
+  -28,
+  -119,
+  -16,
+  -42,
+  -100,
+  -115,
+  4,
+  104,
+  -44,
+  84,
+  -46,
+  -80,
+  10,
+  -45,
+  -54,
+  99,
+  53,
+  -67,
+  -42,
+  96,
+  -89,
+  -91,
+  16,
+  80,
+  67,
+  -62,
+  36,
+  -49,
+  -54,
+  -8,
+  -124,
+  -15,
+  -4,
+  -112,
+  24,
+  -103,
+  16,
+  67,
+  -65,
+  113,
+  -47,
+  107,
+  11,
+  -112,
+  -29,
+  -7,
+  -16,
+  -102,
+  31,
+  89,
+  50,
+  -60,
+  76,
+  81,
+  -77,
+  -66,
+  -53,
+  0,
+  -17,
+  -14,
+  -15,
+  -112,
+  -104,
+  -34,
+  -86,
+  -89,
+  -74,
+  22,
+  -43,
+  95,
+  62,
+  16,
+  -108,
+  -14,
+  59,
+  -7,
+  27,
+  38,
+  47,
+  33,
+  -27,
+  -63,
+  -42,
+  -75,
+  -61,
+  82,
+  5,
+  -118,
+  5,
+  64,
+  -72,
+  -44,
+  -83,
+  -127,
+  12,
+  74,
+  -111,
+  10,
+  11,
+  -55,
+  -97,
+  -110,
+  -1,
+  -114,
+  -77,
+  -113
+};
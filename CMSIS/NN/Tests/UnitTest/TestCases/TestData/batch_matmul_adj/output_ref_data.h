@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t batch_matmul_adj_output_ref[45] =
+{
+  -30,
+  -128,
+  -21,
+  45,
+  -68,
+  -128,
+  -128,
+  127,
+  61,
+  81,
+  123,
+  127,
+  -67,
+  127,
+  1,
+  12,
+  -15,
+  80,
+  127,
+  28,
+  24,
+  -32,
+  -41,
+  -58,
+  108,
+  74,
+  38,
+  -17,
+  75,
+  45,
+  -66,
+  -128,
+  -67,
+  86,
+  -117,
+  -22,
+  73,
+  -101,
+  -96,
+  46,
+  -44,
+  3,
+  2,
+  59,
+  127
+};
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t batch_matmul_adj_rhs[57] =
+{
+  118,
+  -91,
+  9,
+  82,
+  -58,
+  118,
+  -120,
+  116,
+  40,
+  -105,
+  -111,
+  -42,
+  -13,
+  80,
+  -100,
+  -56,
+  25,
+  67,
+  56,
+  -20,
+  1,
+  -103,
+  50,
+  4,
+  -126,
+  -103,
+  105,
+  -19,
+  -48,
+  -63,
+  100,
+  111,
+  -107,
+  49,
+  -115,
+  64,
+  106,
+  110,
+  3,
+  79,
+  -10,
+  -87,
+  -78,
+  14,
+  0,
+  52,
+  41,
+  23,
+  -128,
+  -1,
+  -15,
+  -113,
+  118,
+  -38,
+  116,
+  14,
+  68
+};
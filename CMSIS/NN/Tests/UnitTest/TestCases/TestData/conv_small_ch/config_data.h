@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using TFL version 2.3.0 as reference.
+#define CONV_SMALL_CH_OUT_CH 9
+#define CONV_SMALL_CH_IN_CH 3
+#define CONV_SMALL_CH_INPUT_W 9
+#define CONV_SMALL_CH_INPUT_H 7
+#define CONV_SMALL_CH_DST_SIZE 360
+#define CONV_SMALL_CH_INPUT_SIZE 189
+#define CONV_SMALL_CH_INPUT_OFFSET 55
+#define CONV_SMALL_CH_OUTPUT_OFFSET -1
+#define CONV_SMALL_CH_OUT_ACTIVATION_MIN -128
+#define CONV_SMALL_CH_OUT_ACTIVATION_MAX 127
+#define CONV_SMALL_CH_INPUT_BATCHES 2
+#define CONV_SMALL_CH_FILTER_X 3
+#define CONV_SMALL_CH_FILTER_Y 3
+#define CONV_SMALL_CH_STRIDE_X 2
+#define CONV_SMALL_CH_STRIDE_Y 2
+#define CONV_SMALL_CH_PAD_X 1
+#define CONV_SMALL_CH_PAD_Y 1
+#define CONV_SMALL_CH_OUTPUT_W 5
+#define CONV_SMALL_CH_OUTPUT_H 4
@@ -0,0 +1,404 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using TFL version 2.3.0 as reference.
+#include <stdint.h>
+
+const q7_t conv_small_ch_input[378] =
+{
+  54,
+  18,
+  18,
+  -19,
+  -91,
+  -19,
+  18,
+  18,
+  18,
+  18,
+  -91,
+  -91,
+  -55,
+  18,
+  -91,
+  -19,
+  -91,
+  -19,
+  -91,
+  -19,
+  -91,
+  -91,
+  54,
+  54,
+  -19,
+  -91,
+  18,
+  -91,
+  54,
+  -19,
+  -19,
+  -91,
+  54,
+  -55,
+  54,
+  -55,
+  -55,
+  -55,
+  18,
+  -91,
+  54,
+  18,
+  18,
+  -55,
+  -19,
+  -19,
+  54,
+  18,
+  -55,
+  -55,
+  18,
+  -19,
+  54,
+  18,
+  54,
+  -55,
+  54,
+  -91,
+  -55,
+  -91,
+  54,
+  54,
+  18,
+  -55,
+  54,
+  -19,
+  18,
+  -91,
+  -19,
+  -55,
+  18,
+  -91,
+  -91,
+  18,
+  18,
+  -19,
+  54,
+  -19,
+  54,
+  -55,
+  -91,
+  54,
+  -55,
+  -55,
+  -55,
+  -55,
+  -55,
+  -19,
+  -19,
+  54,
+  -55,
+  -91,
+  -55,
+  -55,
+  -91,
+  -55,
+  -19,
+  -55,
+  -91,
+  -19,
+  54,
+  18,
+  54,
+  -55,
+  -91,
+  18,
+  -91,
+  54,
+  54,
+  18,
+  54,
+  54,
+  -19,
+  -19,
+  -19,
+  -19,
+  -19,
+  -55,
+  -91,
+  -19,
+  -91,
+  54,
+  -19,
+  54,
+  -91,
+  -91,
+  54,
+  54,
+  54,
+  54,
+  -55,
+  18,
+  54,
+  18,
+  54,
+  54,
+  -55,
+  -19,
+  18,
+  54,
+  -55,
+  54,
+  -55,
+  -55,
+  18,
+  54,
+  18,
+  18,
+  -55,
+  54,
+  18,
+  -91,
+  -91,
+  -19,
+  -55,
+  -19,
+  -91,
+  54,
+  -55,
+  -91,
+  18,
+  18,
+  -91,
+  -91,
+  54,
+  54,
+  -91,
+  -19,
+  18,
+  -19,
+  -19,
+  18,
+  -19,
+  18,
+  18,
+  -91,
+  18,
+  -19,
+  -19,
+  -55,
+  54,
+  -19,
+  -91,
+  54,
+  18,
+  54,
+  18,
+  -55,
+  -55,
+  54,
+  18,
+  -55,
+  -91,
+  54,
+  18,
+  -55,
+  -91,
+  18,
+  -19,
+  18,
+  -55,
+  -55,
+  -19,
+  18,
+  54,
+  -55,
+  54,
+  -19,
+  18,
+  -55,
+  54,
+  -91,
+  -19,
+  54,
+  -19,
+  -19,
+  18,
+  -91,
+  -91,
+  -55,
+  -19,
+  -55,
+  54,
+  -19,
+  -55,
+  -55,
+  -19,
+  -19,
+  -91,
+  -91,
+  -55,
+  -55,
+  18,
+  54,
+  18,
+  54,
+  54,
+  54,
+  18,
+  -91,
+  -19,
+  54,
+  -19,
+  -55,
+  54,
+  -91,
+  -91,
+  -19,
+  54,
+  -55,
+  18,
+  -55,
+  -19,
+  18,
+  54,
+  -55,
+  18,
+  -91,
+  54,
+  -55,
+  -55,
+  -55,
+  -55,
+  18,
+  -19,
+  -55,
+  -55,
+  18,
+  18,
+  -91,
+  54,
+  -91,
+  54,
+  18,
+  -19,
+  -19,
+  -19,
+  18,
+  -91,
+  54,
+  -55,
+  -19,
+  -19,
+  -19,
+  -19,
+  -91,
+  18,
+  -91,
+  18,
+  -91,
+  -19,
+  -55,
+  18,
+  -91,
+  -91,
+  54,
+  18,
+  18,
+  -19,
+  -91,
+  -19,
+  54,
+  -55,
+  -19,
+  54,
+  -19,
+  -19,
+  -91,
+  -55,
+  54,
+  54,
+  -91,
+  -19,
+  18,
+  54,
+  -55,
+  -91,
+  -91,
+  -19,
+  54,
+  -91,
+  -19,
+  -91,
+  -91,
+  18,
+  18,
+  -55,
+  18,
+  -19,
+  -55,
+  18,
+  -91,
+  -55,
+  -19,
+  54,
+  54,
+  -55,
+  54,
+  -19,
+  -91,
+  -91,
+  54,
+  -55,
+  -55,
+  18,
+  54,
+  -55,
+  18,
+  54,
+  -91,
+  -91,
+  -91,
+  -91,
+  -91,
+  -19,
+  -19,
+  -19,
+  18,
+  -55,
+  -19,
+  54,
+  -55,
+  -55,
+  18,
+  -55,
+  -91,
+  54,
+  -91,
+  18,
+  54,
+  -91,
+  -55,
+  -55,
+  -55,
+  -55,
+  54,
+  54,
+  54
+};
@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using TFL version 2.3.0 as reference.
+#include <stdint.h>
+
+const q7_t conv_small_ch_output_ref[360] =
+{
+  19,
+  10,
+  -5,
+  17,
+  12,
+  29,
+  15,
+  22,
+  11,
+  18,
+  6,
+  10,
+  18,
+  13,
+  19,
+  19,
+  17,
+  6,
+  17,
+  13,
+  10,
+  14,
+  20,
+  14,
+  11,
+  15,
+  3,
+  20,
+  25,
+  1,
+  4,
+  34,
+  26,
+  11,
+  31,
+  22,
+  22,
+  14,
+  14,
+  3,
+  19,
+  16,
+  10,
+  22,
+  22,
+  3,
+  12,
+  6,
+  6,
+  4,
+  -3,
+  6,
+  30,
+  0,
+  16,
+  25,
+  17,
+  31,
+  27,
+  12,
+  25,
+  37,
+  2,
+  5,
+  13,
+  18,
+  12,
+  20,
+  -7,
+  4,
+  28,
+  19,
+  24,
+  37,
+  18,
+  26,
+  48,
+  16,
+  24,
+  52,
+  12,
+  34,
+  29,
+  23,
+  19,
+  31,
+  14,
+  7,
+  32,
+  21,
+  30,
+  26,
+  18,
+  37,
+  31,
+  19,
+  19,
+  24,
+  6,
+  37,
+  29,
+  13,
+  12,
+  49,
+  32,
+  4,
+  32,
+  24,
+  20,
+  22,
+  21,
+  26,
+  31,
+  7,
+  21,
+  16,
+  5,
+  38,
+  14,
+  11,
+  48,
+  29,
+  32,
+  10,
+  28,
+  1,
+  44,
+  10,
+  -4,
+  30,
+  27,
+  39,
+  0,
+  11,
+  14,
+  17,
+  20,
+  12,
+  13,
+  21,
+  9,
+  16,
+  6,
+  5,
+  32,
+  26,
+  14,
+  35,
+  29,
+  13,
+  5,
+  29,
+  15,
+  24,
+  4,
+  10,
+  22,
+  19,
+  13,
+  3,
+  17,
+  26,
+  32,
+  22,
+  8,
+  31,
+  39,
+  18,
+  6,
+  18,
+  21,
+  17,
+  13,
+  18,
+  9,
+  16,
+  8,
+  0,
+  26,
+  27,
+  11,
+  4,
+  -5,
+  14,
+  11,
+  11,
+  -4,
+  25,
+  15,
+  17,
+  22,
+  13,
+  -2,
+  27,
+  10,
+  14,
+  24,
+  19,
+  18,
+  17,
+  14,
+  16,
+  48,
+  28,
+  5,
+  13,
+  13,
+  40,
+  36,
+  38,
+  33,
+  48,
+  17,
+  21,
+  27,
+  20,
+  21,
+  11,
+  -5,
+  14,
+  13,
+  23,
+  5,
+  23,
+  12,
+  37,
+  32,
+  11,
+  17,
+  28,
+  19,
+  9,
+  29,
+  7,
+  22,
+  39,
+  8,
+  24,
+  45,
+  27,
+  8,
+  50,
+  43,
+  29,
+  19,
+  30,
+  16,
+  44,
+  10,
+  10,
+  31,
+  15,
+  30,
+  28,
+  38,
+  22,
+  30,
+  4,
+  23,
+  21,
+  9,
+  23,
+  10,
+  5,
+  29,
+  15,
+  17,
+  -2,
+  23,
+  9,
+  28,
+  24,
+  1,
+  17,
+  25,
+  14,
+  11,
+  32,
+  26,
+  41,
+  26,
+  22,
+  28,
+  41,
+  24,
+  3,
+  45,
+  7,
+  39,
+  25,
+  13,
+  36,
+  53,
+  40,
+  18,
+  34,
+  34,
+  28,
+  40,
+  30,
+  13,
+  42,
+  7,
+  16,
+  23,
+  36,
+  10,
+  12,
+  19,
+  2,
+  27,
+  -1,
+  -4,
+  41,
+  26,
+  3,
+  18,
+  7,
+  6,
+  11,
+  -3,
+  0,
+  8,
+  8,
+  27,
+  21,
+  14,
+  23,
+  28,
+  5,
+  6,
+  18,
+  8,
+  6,
+  17,
+  29,
+  21,
+  28,
+  -5,
+  7,
+  20,
+  9,
+  13,
+  11,
+  4,
+  5,
+  9,
+  2,
+  2,
+  8,
+  14,
+  26,
+  -4,
+  -4,
+  30,
+  2,
+  20,
+  2,
+  11,
+  -6
+};
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using TFL version 2.3.0 as reference.
+#include <stdint.h>
+
+const q7_t conv_small_ch_weights[243] =
+{
+  127,
+  -42,
+  0,
+  85,
+  -42,
+  85,
+  42,
+  127,
+  -42,
+  127,
+  127,
+  85,
+  42,
+  127,
+  0,
+  0,
+  -42,
+  42,
+  0,
+  -42,
+  0,
+  127,
+  42,
+  127,
+  0,
+  42,
+  85,
+  -42,
+  -42,
+  0,
+  85,
+  127,
+  0,
+  0,
+  127,
+  85,
+  85,
+  42,
+  85,
+  -42,
+  0,
+  0,
+  85,
+  85,
+  42,
+  0,
+  42,
+  0,
+  127,
+  0,
+  127,
+  127,
+  -42,
+  127,
+  0,
+  85,
+  127,
+  -42,
+  127,
+  0,
+  -42,
+  127,
+  0,
+  42,
+  42,
+  42,
+  -42,
+  0,
+  0,
+  127,
+  0,
+  -42,
+  -42,
+  0,
+  127,
+  85,
+  -42,
+  127,
+  42,
+  85,
+  0,
+  127,
+  42,
+  0,
+  42,
+  85,
+  0,
+  42,
+  42,
+  -42,
+  0,
+  -42,
+  42,
+  127,
+  127,
+  42,
+  127,
+  42,
+  42,
+  42,
+  0,
+  42,
+  -42,
+  -42,
+  85,
+  85,
+  42,
+  -42,
+  85,
+  0,
+  42,
+  -42,
+  42,
+  127,
+  -42,
+  127,
+  85,
+  42,
+  85,
+  42,
+  -42,
+  0,
+  42,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  0,
+  -42,
+  127,
+  127,
+  127,
+  127,
+  0,
+  -42,
+  -42,
+  85,
+  -42,
+  85,
+  0,
+  0,
+  -42,
+  42,
+  85,
+  42,
+  42,
+  127,
+  85,
+  -42,
+  0,
+  127,
+  85,
+  42,
+  0,
+  -42,
+  85,
+  42,
+  -42,
+  42,
+  127,
+  -42,
+  0,
+  127,
+  -42,
+  42,
+  42,
+  -42,
+  127,
+  -42,
+  0,
+  -42,
+  0,
+  -42,
+  42,
+  85,
+  127,
+  42,
+  -42,
+  -42,
+  -42,
+  0,
+  127,
+  85,
+  85,
+  42,
+  -42,
+  85,
+  0,
+  127,
+  0,
+  -42,
+  85,
+  42,
+  85,
+  85,
+  85,
+  0,
+  127,
+  0,
+  42,
+  127,
+  42,
+  -42,
+  85,
+  85,
+  127,
+  0,
+  42,
+  127,
+  85,
+  0,
+  127,
+  -42,
+  42,
+  -42,
+  85,
+  0,
+  0,
+  0,
+  127,
+  42,
+  42,
+  -42,
+  -42,
+  85,
+  127,
+  85,
+  -42,
+  -42,
+  0,
+  85,
+  127,
+  85,
+  85,
+  85,
+  0,
+  42,
+  -42,
+  85,
+  -42,
+  42
+};
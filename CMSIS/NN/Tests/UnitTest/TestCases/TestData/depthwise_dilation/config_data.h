@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define DEPTHWISE_DILATION_OUT_CH 4
+#define DEPTHWISE_DILATION_IN_CH 4
+#define DEPTHWISE_DILATION_INPUT_W 9
+#define DEPTHWISE_DILATION_INPUT_H 7
+#define DEPTHWISE_DILATION_DST_SIZE 252
+#define DEPTHWISE_DILATION_INPUT_SIZE 252
+#define DEPTHWISE_DILATION_INPUT_OFFSET 4
+#define DEPTHWISE_DILATION_OUTPUT_OFFSET 2
+#define DEPTHWISE_DILATION_OUT_ACTIVATION_MIN -128
+#define DEPTHWISE_DILATION_OUT_ACTIVATION_MAX 127
+#define DEPTHWISE_DILATION_INPUT_BATCHES 1
+#define DEPTHWISE_DILATION_FILTER_X 3
+#define DEPTHWISE_DILATION_FILTER_Y 3
+#define DEPTHWISE_DILATION_STRIDE_X 1
+#define DEPTHWISE_DILATION_STRIDE_Y 1
+#define DEPTHWISE_DILATION_PAD_X 2
+#define DEPTHWISE_DILATION_PAD_Y 2
+#define DEPTHWISE_DILATION_OUTPUT_W 9
+#define DEPTHWISE_DILATION_OUTPUT_H 7
+#define DEPTHWISE_DILATION_CH_MULT 1
+#define DEPTHWISE_DILATION_DILATION_X 2
+#define DEPTHWISE_DILATION_DILATION_Y 2
@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_input[252] =
+{
+  47,
+  -87,
+  46,
+  -10,
+  15,
+  -83,
+  -48,
+  6,
+  45,
+  -111,
+  -1,
+  -100,
+  37,
+  -5,
+  87,
+  -59,
+  -55,
+  -123,
+  -29,
+  29,
+  -29,
+  -36,
+  88,
+  -82,
+  74,
+  75,
+  -13,
+  -94,
+  -6,
+  16,
+  55,
+  -22,
+  -88,
+  -58,
+  -106,
+  110,
+  -104,
+  -122,
+  82,
+  63,
+  96,
+  -73,
+  -73,
+  5,
+  26,
+  -80,
+  41,
+  -80,
+  121,
+  -2,
+  -32,
+  -118,
+  -6,
+  -97,
+  67,
+  -37,
+  88,
+  18,
+  -6,
+  -63,
+  76,
+  70,
+  -84,
+  71,
+  21,
+  41,
+  26,
+  77,
+  -2,
+  -15,
+  -42,
+  2,
+  -128,
+  -23,
+  -71,
+  27,
+  31,
+  54,
+  -41,
+  -98,
+  127,
+  -45,
+  -118,
+  -106,
+  33,
+  -43,
+  -113,
+  -69,
+  -55,
+  -50,
+  90,
+  -88,
+  -67,
+  -34,
+  -49,
+  -66,
+  -6,
+  66,
+  123,
+  120,
+  13,
+  62,
+  -90,
+  -4,
+  102,
+  -13,
+  -105,
+  83,
+  127,
+  54,
+  -50,
+  91,
+  65,
+  85,
+  87,
+  40,
+  14,
+  -79,
+  -52,
+  -122,
+  -70,
+  -92,
+  36,
+  -79,
+  -90,
+  -72,
+  -20,
+  119,
+  75,
+  -118,
+  -29,
+  -32,
+  125,
+  5,
+  -58,
+  125,
+  67,
+  -97,
+  -81,
+  -45,
+  -43,
+  -62,
+  106,
+  30,
+  25,
+  22,
+  -49,
+  -109,
+  -74,
+  -31,
+  57,
+  -40,
+  -84,
+  -104,
+  23,
+  -62,
+  -19,
+  -55,
+  37,
+  94,
+  92,
+  106,
+  -76,
+  -22,
+  -107,
+  9,
+  -11,
+  -22,
+  84,
+  74,
+  -74,
+  -127,
+  -13,
+  23,
+  -124,
+  -120,
+  -12,
+  14,
+  -82,
+  -8,
+  86,
+  43,
+  89,
+  26,
+  -90,
+  20,
+  -74,
+  35,
+  74,
+  -45,
+  36,
+  121,
+  104,
+  50,
+  86,
+  -38,
+  15,
+  82,
+  8,
+  -70,
+  100,
+  33,
+  -55,
+  122,
+  49,
+  -103,
+  -29,
+  -105,
+  81,
+  -29,
+  -100,
+  -76,
+  -4,
+  -29,
+  -108,
+  102,
+  -121,
+  9,
+  87,
+  95,
+  124,
+  -19,
+  9,
+  -112,
+  -89,
+  24,
+  -70,
+  83,
+  -32,
+  78,
+  -9,
+  -39,
+  -64,
+  80,
+  16,
+  -104,
+  -122,
+  1,
+  119,
+  83,
+  62,
+  -63,
+  88,
+  -47,
+  -85,
+  -105,
+  115,
+  -55,
+  -39,
+  -28,
+  114,
+  -9
+};
@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_output_ref[252] =
+{
+  -16,
+  -25,
+  -65,
+  12,
+  16,
+  -19,
+  -31,
+  -18,
+  24,
+  -29,
+  -21,
+  -30,
+  -7,
+  -17,
+  -76,
+  -52,
+  14,
+  -16,
+  31,
+  -76,
+  -4,
+  5,
+  -77,
+  -59,
+  -34,
+  23,
+  21,
+  -10,
+  7,
+  11,
+  -40,
+  -22,
+  48,
+  -28,
+  28,
+  77,
+  51,
+  -34,
+  -46,
+  57,
+  27,
+  -16,
+  46,
+  12,
+  -32,
+  -39,
+  -29,
+  -62,
+  2,
+  -12,
+  23,
+  -50,
+  11,
+  6,
+  -51,
+  -19,
+  35,
+  49,
+  -23,
+  -27,
+  20,
+  39,
+  35,
+  73,
+  18,
+  52,
+  -37,
+  5,
+  -6,
+  3,
+  8,
+  40,
+  50,
+  8,
+  -7,
+  -57,
+  -11,
+  16,
+  45,
+  -84,
+  -86,
+  -5,
+  -23,
+  -94,
+  -25,
+  10,
+  43,
+  -56,
+  70,
+  6,
+  -61,
+  -24,
+  5,
+  8,
+  -66,
+  -16,
+  9,
+  -3,
+  -91,
+  21,
+  -2,
+  16,
+  -54,
+  -43,
+  -15,
+  -27,
+  14,
+  44,
+  25,
+  16,
+  30,
+  -11,
+  -52,
+  11,
+  -4,
+  -17,
+  7,
+  -21,
+  23,
+  4,
+  47,
+  -37,
+  6,
+  -107,
+  51,
+  -12,
+  -32,
+  93,
+  -20,
+  -60,
+  -3,
+  32,
+  -51,
+  -11,
+  -26,
+  16,
+  -3,
+  -35,
+  -35,
+  17,
+  17,
+  12,
+  -45,
+  27,
+  -14,
+  2,
+  11,
+  -57,
+  28,
+  -7,
+  -18,
+  -70,
+  15,
+  -18,
+  41,
+  -25,
+  -67,
+  -13,
+  56,
+  -63,
+  -8,
+  17,
+  47,
+  -12,
+  3,
+  -18,
+  84,
+  -10,
+  29,
+  15,
+  10,
+  -1,
+  -17,
+  18,
+  113,
+  -33,
+  -17,
+  23,
+  54,
+  8,
+  -20,
+  21,
+  -19,
+  17,
+  24,
+  26,
+  5,
+  -5,
+  -12,
+  3,
+  17,
+  34,
+  8,
+  25,
+  -63,
+  -23,
+  48,
+  16,
+  5,
+  54,
+  16,
+  25,
+  2,
+  4,
+  -27,
+  -11,
+  24,
+  31,
+  -16,
+  1,
+  30,
+  -28,
+  8,
+  -11,
+  8,
+  36,
+  -11,
+  20,
+  -15,
+  -9,
+  -14,
+  10,
+  -12,
+  -17,
+  2,
+  -1,
+  20,
+  -6,
+  -1,
+  22,
+  -15,
+  21,
+  6,
+  21,
+  -12,
+  -80,
+  18,
+  -1,
+  -45,
+  -29,
+  -53,
+  -18,
+  4,
+  -59,
+  5,
+  -24,
+  9,
+  -47,
+  13,
+  -11,
+  11,
+  -4
+};
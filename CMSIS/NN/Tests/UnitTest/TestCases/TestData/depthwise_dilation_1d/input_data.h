@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_1d_input[40] =
+{
+  86,
+  26,
+  118,
+  -54,
+  -24,
+  94,
+  -59,
+  -110,
+  -114,
+  -48,
+  -117,
+  -110,
+  -85,
+  95,
+  64,
+  -52,
+  -63,
+  65,
+  -10,
+  22,
+  80,
+  77,
+  78,
+  -40,
+  106,
+  -74,
+  105,
+  -98,
+  82,
+  -97,
+  -93,
+  105,
+  126,
+  -93,
+  -86,
+  127,
+  -72,
+  -99,
+  -55,
+  45
+};
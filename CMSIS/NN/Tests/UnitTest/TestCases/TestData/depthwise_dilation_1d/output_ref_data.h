@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_1d_output_ref[96] =
+{
+  -20,
+  49,
+  127,
+  -31,
+  -72,
+  -20,
+  11,
+  -5,
+  -3,
+  8,
+  115,
+  -54,
+  -115,
+  -29,
+  -1,
+  38,
+  63,
+  -15,
+  0,
+  3,
+  59,
+  18,
+  15,
+  -58,
+  30,
+  -68,
+  -102,
+  21,
+  -36,
+  -1,
+  -18,
+  51,
+  90,
+  -12,
+  -56,
+  44,
+  101,
+  29,
+  -25,
+  8,
+  76,
+  -34,
+  -89,
+  46,
+  66,
+  24,
+  -33,
+  40,
+  34,
+  -69,
+  -122,
+  34,
+  127,
+  11,
+  -25,
+  -44,
+  -80,
+  -9,
+  24,
+  -14,
+  -108,
+  -5,
+  17,
+  19,
+  41,
+  -114,
+  -128,
+  17,
+  18,
+  -36,
+  -23,
+  -5,
+  -66,
+  -2,
+  -19,
+  21,
+  -128,
+  -36,
+  26,
+  2,
+  -75,
+  -29,
+  15,
+  -25,
+  5,
+  -45,
+  -24,
+  -5,
+  -20,
+  38,
+  113,
+  -28,
+  60,
+  42,
+  2,
+  -9
+};
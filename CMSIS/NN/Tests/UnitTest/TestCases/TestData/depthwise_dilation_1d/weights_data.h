@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_1d_weights[24] =
+{
+  -62,
+  -65,
+  52,
+  -72,
+  28,
+  -40,
+  8,
+  -62,
+  -69,
+  -89,
+  -106,
+  1,
+  111,
+  87,
+  -3,
+  -32,
+  114,
+  -124,
+  -97,
+  -21,
+  -84,
+  1,
+  47,
+  -10
+};
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_mult_input[180] =
+{
+  82,
+  -15,
+  9,
+  -46,
+  -117,
+  79,
+  -34,
+  28,
+  101,
+  54,
+  -54,
+  -93,
+  -97,
+  114,
+  80,
+  68,
+  -56,
+  31,
+  10,
+  -19,
+  110,
+  65,
+  101,
+  46,
+  -28,
+  -26,
+  61,
+  -61,
+  -26,
+  111,
+  61,
+  30,
+  16,
+  25,
+  -19,
+  24,
+  41,
+  -111,
+  9,
+  -48,
+  70,
+  -101,
+  45,
+  -31,
+  -53,
+  -58,
+  123,
+  67,
+  -5,
+  -8,
+  40,
+  -26,
+  91,
+  97,
+  -103,
+  18,
+  -62,
+  -30,
+  117,
+  -70,
+  57,
+  -29,
+  -8,
+  -6,
+  75,
+  -81,
+  33,
+  66,
+  -35,
+  -94,
+  -111,
+  -95,
+  95,
+  94,
+  -65,
+  -34,
+  62,
+  -77,
+  27,
+  -25,
+  -16,
+  23,
+  74,
+  -85,
+  -50,
+  2,
+  123,
+  -51,
+  66,
+  39,
+  95,
+  104,
+  -32,
+  31,
+  55,
+  47,
+  81,
+  -114,
+  27,
+  -35,
+  45,
+  -56,
+  44,
+  -116,
+  100,
+  63,
+  -53,
+  92,
+  -33,
+  -9,
+  -122,
+  110,
+  10,
+  93,
+  43,
+  1,
+  -83,
+  73,
+  110,
+  -104,
+  54,
+  52,
+  -81,
+  -40,
+  13,
+  -103,
+  -61,
+  -119,
+  71,
+  55,
+  -40,
+  11,
+  4,
+  106,
+  -23,
+  -44,
+  -45,
+  52,
+  -26,
+  2,
+  -60,
+  7,
+  95,
+  -67,
+  32,
+  -117,
+  -34,
+  -48,
+  84,
+  82,
+  -84,
+  73,
+  59,
+  77,
+  53,
+  -32,
+  -33,
+  -74,
+  22,
+  -46,
+  64,
+  75,
+  2,
+  -38,
+  -60,
+  7,
+  -22,
+  81,
+  13,
+  -83,
+  -2,
+  123,
+  -55,
+  58,
+  101,
+  -74,
+  -122,
+  -127,
+  -17,
+  29
+};
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_mult_output_ref[180] =
+{
+  9,
+  -14,
+  10,
+  -4,
+  29,
+  -17,
+  -17,
+  -14,
+  12,
+  -23,
+  60,
+  7,
+  -48,
+  -19,
+  -37,
+  -64,
+  8,
+  -28,
+  -15,
+  -17,
+  -8,
+  -41,
+  -114,
+  -8,
+  11,
+  12,
+  1,
+  -47,
+  86,
+  -9,
+  76,
+  76,
+  -11,
+  83,
+  102,
+  -38,
+  28,
+  -34,
+  14,
+  56,
+  6,
+  -15,
+  -2,
+  -11,
+  18,
+  43,
+  -24,
+  16,
+  -47,
+  -52,
+  -66,
+  6,
+  85,
+  36,
+  -11,
+  23,
+  10,
+  -26,
+  61,
+  -7,
+  -9,
+  -47,
+  76,
+  -73,
+  -84,
+  6,
+  -56,
+  -52,
+  -8,
+  -15,
+  86,
+  7,
+  -7,
+  -27,
+  -27,
+  -128,
+  76,
+  -25,
+  -64,
+  -105,
+  -53,
+  -92,
+  -7,
+  -82,
+  -19,
+  -21,
+  -34,
+  -112,
+  -1,
+  68,
+  -32,
+  -27,
+  -91,
+  16,
+  115,
+  44,
+  -89,
+  -80,
+  51,
+  82,
+  -39,
+  31,
+  74,
+  78,
+  -22,
+  -66,
+  -68,
+  -84,
+  5,
+  -61,
+  -42,
+  3,
+  -30,
+  12,
+  17,
+  39,
+  -8,
+  -80,
+  -108,
+  -11,
+  -41,
+  -84,
+  -7,
+  -61,
+  40,
+  -50,
+  73,
+  53,
+  4,
+  -18,
+  15,
+  5,
+  56,
+  -47,
+  94,
+  -81,
+  127,
+  -17,
+  -17,
+  -128,
+  32,
+  -50,
+  2,
+  5,
+  50,
+  49,
+  -64,
+  -70,
+  -128,
+  -19,
+  -14,
+  2,
+  -2,
+  -7,
+  -16,
+  14,
+  25,
+  -37,
+  -20,
+  58,
+  -18,
+  -2,
+  -31,
+  16,
+  57,
+  -30,
+  80,
+  8,
+  -1,
+  -13,
+  -92,
+  16,
+  -34,
+  -3,
+  -16,
+  18,
+  -36,
+  -38,
+  -16,
+  -31
+};
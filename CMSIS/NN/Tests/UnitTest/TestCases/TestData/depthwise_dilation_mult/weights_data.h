@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t depthwise_dilation_mult_weights[36] =
+{
+  16,
+  -86,
+  -86,
+  84,
+  84,
+  43,
+  59,
+  -67,
+  -57,
+  -79,
+  36,
+  -36,
+  -118,
+  -97,
+  16,
+  -10,
+  -67,
+  -93,
+  -123,
+  -108,
+  46,
+  34,
+  94,
+  -87,
+  -88,
+  -119,
+  17,
+  -65,
+  -101,
+  -46,
+  114,
+  44,
+  -110,
+  85,
+  -108,
+  17
+};
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t dequantize_input[23] =
+{
+  100,
+  110,
+  112,
+  -25,
+  -51,
+  -10,
+  -18,
+  -122,
+  -36,
+  103,
+  -13,
+  -73,
+  -107,
+  112,
+  16,
+  14,
+  13,
+  49,
+  -94,
+  -67,
+  28,
+  -47,
+  -21
+};
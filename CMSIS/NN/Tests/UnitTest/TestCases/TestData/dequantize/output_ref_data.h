@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const float dequantize_output_ref[23] =
+{
+  1.937500000e+00f,
+  2.145833492e+00f,
+  2.187500000e+00f,
+  -6.666666865e-01f,
+  -1.208333373e+00f,
+  -3.541666865e-01f,
+  -5.208333731e-01f,
+  -2.687500000e+00f,
+  -8.958333731e-01f,
+  2.000000000e+00f,
+  -4.166666865e-01f,
+  -1.666666746e+00f,
+  -2.375000000e+00f,
+  2.187500000e+00f,
+  1.875000000e-01f,
+  1.458333433e-01f,
+  1.250000000e-01f,
+  8.750000000e-01f,
+  -2.104166746e+00f,
+  -1.541666746e+00f,
+  4.375000000e-01f,
+  -1.125000000e+00f,
+  -5.833333731e-01f
+};
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define FULLY_CONNECTED_S4_OUT_CH 5
+#define FULLY_CONNECTED_S4_IN_CH 7
+#define FULLY_CONNECTED_S4_INPUT_W 3
+#define FULLY_CONNECTED_S4_INPUT_H 1
+#define FULLY_CONNECTED_S4_DST_SIZE 10
+#define FULLY_CONNECTED_S4_INPUT_SIZE 21
+#define FULLY_CONNECTED_S4_INPUT_OFFSET 3
+#define FULLY_CONNECTED_S4_OUTPUT_OFFSET 2
+#define FULLY_CONNECTED_S4_OUT_ACTIVATION_MIN -128
+#define FULLY_CONNECTED_S4_OUT_ACTIVATION_MAX 127
+#define FULLY_CONNECTED_S4_INPUT_BATCHES 2
+#define FULLY_CONNECTED_S4_ACCUMULATION_DEPTH 21
+#define FULLY_CONNECTED_S4_PACKED_WEIGHTS_SIZE 53
+#define FULLY_CONNECTED_S4_OUTPUT_MULTIPLIER 1073741824
+#define FULLY_CONNECTED_S4_OUTPUT_SHIFT -4
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_s4_input[42] =
+{
+  -9,
+  -116,
+  47,
+  -110,
+  54,
+  21,
+  -101,
+  -73,
+  52,
+  -105,
+  -38,
+  -23,
+  -57,
+  -115,
+  -108,
+  -100,
+  -113,
+  -88,
+  90,
+  -125,
+  104,
+  -36,
+  59,
+  -44,
+  39,
+  10,
+  -102,
+  -38,
+  -5,
+  125,
+  -26,
+  -29,
+  -44,
+  68,
+  -109,
+  -96,
+  -99,
+  -99,
+  62,
+  102,
+  40,
+  8
+};
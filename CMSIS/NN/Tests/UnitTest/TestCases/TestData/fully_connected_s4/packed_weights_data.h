@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_s4_packed_weights[53] =
+{
+  122,
+  28,
+  36,
+  -117,
+  -30,
+  67,
+  -52,
+  -58,
+  -9,
+  40,
+  72,
+  -88,
+  3,
+  -73,
+  70,
+  -35,
+  50,
+  -42,
+  88,
+  47,
+  -6,
+  -1,
+  60,
+  -18,
+  -20,
+  -62,
+  -59,
+  -36,
+  -115,
+  -92,
+  77,
+  -115,
+  109,
+  -5,
+  65,
+  -8,
+  75,
+  52,
+  -29,
+  2,
+  -44,
+  -72,
+  81,
+  7,
+  13,
+  -53,
+  15,
+  -126,
+  -59,
+  -80,
+  -12,
+  52,
+  1
+};
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_s4_2_input[120] =
+{
+  -126,
+  -26,
+  66,
+  -113,
+  20,
+  17,
+  -45,
+  21,
+  -110,
+  57,
+  -60,
+  51,
+  -13,
+  -28,
+  -74,
+  -90,
+  48,
+  -89,
+  34,
+  4,
+  -102,
+  33,
+  -45,
+  10,
+  40,
+  -35,
+  114,
+  73,
+  -64,
+  -74,
+  88,
+  -29,
+  -9,
+  -116,
+  -110,
+  38,
+  36,
+  -64,
+  38,
+  -28,
+  122,
+  -93,
+  50,
+  27,
+  116,
+  -81,
+  -118,
+  -45,
+  124,
+  -126,
+  81,
+  64,
+  -102,
+  -112,
+  19,
+  -21,
+  -5,
+  -115,
+  -9,
+  87,
+  95,
+  125,
+  74,
+  -11,
+  -35,
+  -12,
+  11,
+  -21,
+  5,
+  102,
+  43,
+  75,
+  -69,
+  55,
+  51,
+  -112,
+  -29,
+  -79,
+  -75,
+  -38,
+  -86,
+  -57,
+  -89,
+  32,
+  -95,
+  9,
+  120,
+  -30,
+  -24,
+  -5,
+  -76,
+  -16,
+  -6,
+  -66,
+  -73,
+  -96,
+  33,
+  97,
+  -127,
+  -63,
+  -118,
+  -112,
+  -65,
+  64,
+  121,
+  -114,
+  87,
+  62,
+  -78,
+  -123,
+  -19,
+  38,
+  99,
+  52,
+  125,
+  50,
+  25,
+  -12,
+  -77,
+  64
+};
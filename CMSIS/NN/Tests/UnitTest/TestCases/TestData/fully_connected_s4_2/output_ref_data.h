@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_s4_2_output_ref[27] =
+{
+  -32,
+  -57,
+  8,
+  -38,
+  28,
+  -27,
+  -6,
+  -68,
+  -20,
+  -21,
+  50,
+  30,
+  -21,
+  -38,
+  -13,
+  68,
+  27,
+  98,
+  15,
+  -36,
+  -9,
+  -5,
+  28,
+  -11,
+  -61,
+  5,
+  -57
+};
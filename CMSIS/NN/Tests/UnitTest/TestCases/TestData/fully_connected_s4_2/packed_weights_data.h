@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_s4_2_packed_weights[180] =
+{
+  126,
+  59,
+  72,
+  17,
+  -45,
+  -121,
+  -77,
+  60,
+  51,
+  -54,
+  -44,
+  88,
+  113,
+  19,
+  52,
+  -73,
+  72,
+  -128,
+  65,
+  22,
+  115,
+  85,
+  -115,
+  -126,
+  -105,
+  78,
+  -105,
+  -6,
+  77,
+  3,
+  51,
+  -106,
+  84,
+  56,
+  88,
+  97,
+  95,
+  88,
+  -40,
+  26,
+  77,
+  124,
+  36,
+  -31,
+  -22,
+  56,
+  -98,
+  12,
+  -69,
+  39,
+  4,
+  25,
+  28,
+  -61,
+  -37,
+  121,
+  -38,
+  -80,
+  -56,
+  -104,
+  54,
+  40,
+  8,
+  40,
+  -95,
+  -27,
+  -109,
+  -77,
+  126,
+  -77,
+  -42,
+  72,
+  73,
+  -10,
+  77,
+  -7,
+  -121,
+  -6,
+  17,
+  111,
+  84,
+  -111,
+  -3,
+  81,
+  111,
+  91,
+  -97,
+  -21,
+  122,
+  -77,
+  -107,
+  -99,
+  -20,
+  85,
+  58,
+  -68,
+  -128,
+  -51,
+  107,
+  120,
+  -84,
+  98,
+  45,
+  88,
+  -51,
+  11,
+  60,
+  108,
+  13,
+  -106,
+  -19,
+  -23,
+  -74,
+  -37,
+  119,
+  96,
+  71,
+  -99,
+  79,
+  -34,
+  63,
+  -1,
+  6,
+  -85,
+  23,
+  39,
+  -19,
+  -29,
+  -118,
+  14,
+  91,
+  -36,
+  -11,
+  -33,
+  38,
+  125,
+  -30,
+  -55,
+  -59,
+  -103,
+  81,
+  123,
+  -78,
+  -42,
+  -105,
+  86,
+  -71,
+  -91,
+  104,
+  -100,
+  86,
+  103,
+  -107,
+  105,
+  -14,
+  34,
+  5,
+  73,
+  68,
+  -113,
+  -10,
+  -57,
+  22,
+  96,
+  -93,
+  111,
+  -101,
+  51,
+  -22,
+  -81,
+  -47,
+  -92,
+  -54,
+  -102,
+  91,
+  -94,
+  113,
+  -34,
+  -118,
+  -13
+};
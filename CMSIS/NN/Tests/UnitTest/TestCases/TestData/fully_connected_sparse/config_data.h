@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define FULLY_CONNECTED_SPARSE_OUT_CH 7
+#define FULLY_CONNECTED_SPARSE_IN_CH 22
+#define FULLY_CONNECTED_SPARSE_DST_SIZE 14
+#define FULLY_CONNECTED_SPARSE_INPUT_SIZE 22
+#define FULLY_CONNECTED_SPARSE_INPUT_OFFSET 5
+#define FULLY_CONNECTED_SPARSE_OUTPUT_OFFSET 1
+#define FULLY_CONNECTED_SPARSE_OUT_ACTIVATION_MIN -128
+#define FULLY_CONNECTED_SPARSE_OUT_ACTIVATION_MAX 127
+#define FULLY_CONNECTED_SPARSE_INPUT_BATCHES 2
+#define FULLY_CONNECTED_SPARSE_OUTPUT_MULTIPLIER 1073741824
+#define FULLY_CONNECTED_SPARSE_OUTPUT_SHIFT -6
+#define FULLY_CONNECTED_SPARSE_ACCUMULATION_DEPTH 22
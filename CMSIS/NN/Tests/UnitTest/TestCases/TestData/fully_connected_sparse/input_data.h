@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_sparse_input[44] =
+{
+  29,
+  -37,
+  19,
+  18,
+  46,
+  46,
+  -111,
+  -97,
+  -56,
+  29,
+  52,
+  112,
+  -127,
+  92,
+  81,
+  123,
+  -14,
+  -123,
+  -21,
+  -71,
+  -120,
+  -59,
+  -87,
+  29,
+  -33,
+  27,
+  117,
+  -81,
+  59,
+  -124,
+  5,
+  -26,
+  100,
+  -8,
+  -117,
+  103,
+  8,
+  -117,
+  -55,
+  -43,
+  47,
+  64,
+  4,
+  65
+};
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_sparse_weights_values[64] =
+{
+  113,
+  -50,
+  -40,
+  -110,
+  50,
+  49,
+  121,
+  59,
+  80,
+  38,
+  0,
+  0,
+  94,
+  -4,
+  16,
+  -121,
+  29,
+  -31,
+  106,
+  -79,
+  -123,
+  83,
+  93,
+  -27,
+  89,
+  -12,
+  -105,
+  64,
+  25,
+  104,
+  103,
+  12,
+  55,
+  126,
+  -43,
+  -125,
+  -58,
+  -89,
+  122,
+  -55,
+  -17,
+  -13,
+  -46,
+  -104,
+  -14,
+  -76,
+  62,
+  -94,
+  61,
+  -30,
+  111,
+  89,
+  -126,
+  18,
+  -85,
+  38,
+  -89,
+  20,
+  -53,
+  -12,
+  89,
+  96,
+  42,
+  57
+};
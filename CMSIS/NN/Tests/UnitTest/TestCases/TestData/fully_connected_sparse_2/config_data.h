@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define FULLY_CONNECTED_SPARSE_2_OUT_CH 12
+#define FULLY_CONNECTED_SPARSE_2_IN_CH 48
+#define FULLY_CONNECTED_SPARSE_2_DST_SIZE 12
+#define FULLY_CONNECTED_SPARSE_2_INPUT_SIZE 48
+#define FULLY_CONNECTED_SPARSE_2_INPUT_OFFSET -3
+#define FULLY_CONNECTED_SPARSE_2_OUTPUT_OFFSET -2
+#define FULLY_CONNECTED_SPARSE_2_OUT_ACTIVATION_MIN -128
+#define FULLY_CONNECTED_SPARSE_2_OUT_ACTIVATION_MAX 127
+#define FULLY_CONNECTED_SPARSE_2_INPUT_BATCHES 1
+#define FULLY_CONNECTED_SPARSE_2_OUTPUT_MULTIPLIER 1073741824
+#define FULLY_CONNECTED_SPARSE_2_OUTPUT_SHIFT -8
+#define FULLY_CONNECTED_SPARSE_2_ACCUMULATION_DEPTH 48
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_sparse_2_input[48] =
+{
+  13,
+  -10,
+  -19,
+  69,
+  -24,
+  -80,
+  115,
+  -87,
+  -102,
+  -99,
+  -107,
+  44,
+  -124,
+  57,
+  -79,
+  120,
+  25,
+  120,
+  64,
+  30,
+  93,
+  68,
+  -53,
+  -102,
+  45,
+  66,
+  121,
+  53,
+  -69,
+  94,
+  -97,
+  41,
+  -80,
+  122,
+  36,
+  -124,
+  -36,
+  111,
+  -47,
+  39,
+  -3,
+  -90,
+  -19,
+  -102,
+  -48,
+  48,
+  93,
+  -83
+};
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const uint16_t fully_connected_sparse_2_weights_block_cols[29] =
+{
+  4,
+  8,
+  0,
+  4,
+  11,
+  0,
+  7,
+  11,
+  3,
+  7,
+  3,
+  10,
+  6,
+  10,
+  2,
+  6,
+  10,
+  2,
+  6,
+  9,
+  2,
+  5,
+  9,
+  5,
+  9,
+  1,
+  5,
+  1,
+  8
+};
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t fully_connected_sparse_2_weights_values[116] =
+{
+  58,
+  81,
+  107,
+  -79,
+  87,
+  46,
+  71,
+  27,
+  81,
+  -50,
+  -23,
+  34,
+  -102,
+  47,
+  44,
+  14,
+  4,
+  85,
+  2,
+  0,
+  -107,
+  -5,
+  -115,
+  -34,
+  -87,
+  68,
+  -119,
+  -38,
+  -66,
+  -85,
+  -39,
+  -128,
+  -33,
+  -74,
+  125,
+  -77,
+  53,
+  9,
+  85,
+  42,
+  10,
+  -88,
+  27,
+  90,
+  -14,
+  -82,
+  45,
+  22,
+  112,
+  -72,
+  18,
+  53,
+  0,
+  57,
+  -72,
+  110,
+  115,
+  -19,
+  -52,
+  -58,
+  -45,
+  -62,
+  21,
+  -42,
+  -45,
+  -54,
+  -39,
+  -112,
+  105,
+  16,
+  -55,
+  91,
+  -77,
+  -96,
+  -39,
+  47,
+  -46,
+  92,
+  40,
+  -55,
+  26,
+  71,
+  -77,
+  2,
+  -107,
+  -25,
+  48,
+  -73,
+  -23,
+  -35,
+  -117,
+  -113,
+  111,
+  -19,
+  60,
+  114,
+  -113,
+  10,
+  94,
+  -110,
+  -80,
+  -119,
+  69,
+  -75,
+  -61,
+  -92,
+  33,
+  -99,
+  -26,
+  114,
+  -113,
+  63,
+  -91,
+  -9,
+  -38,
+  -18
+};
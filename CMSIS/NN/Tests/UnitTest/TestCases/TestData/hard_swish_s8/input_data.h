@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t hard_swish_s8_input[45] =
+{
+  99,
+  -1,
+  -8,
+  37,
+  5,
+  -17,
+  85,
+  -52,
+  -25,
+  80,
+  -46,
+  72,
+  33,
+  -75,
+  -80,
+  18,
+  -123,
+  103,
+  100,
+  119,
+  64,
+  -101,
+  34,
+  -77,
+  33,
+  100,
+  56,
+  -74,
+  80,
+  55,
+  69,
+  -19,
+  41,
+  14,
+  108,
+  -16,
+  -95,
+  95,
+  -128,
+  -108,
+  53,
+  -37,
+  1,
+  -3,
+  4
+};
@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t hard_swish_s8_lut_ref[256] =
+{
+  -25,
+  -25,
+  -24,
+  -24,
+  -23,
+  -23,
+  -22,
+  -22,
+  -21,
+  -21,
+  -20,
+  -19,
+  -19,
+  -18,
+  -17,
+  -17,
+  -16,
+  -15,
+  -14,
+  -14,
+  -13,
+  -12,
+  -11,
+  -10,
+  -9,
+  -8,
+  -7,
+  -6,
+  -5,
+  -4,
+  -3,
+  -2,
+  -1,
+  0,
+  1,
+  2,
+  3,
+  4,
+  6,
+  7,
+  8,
+  9,
+  11,
+  12,
+  13,
+  15,
+  16,
+  17,
+  19,
+  20,
+  22,
+  23,
+  25,
+  26,
+  28,
+  29,
+  31,
+  32,
+  34,
+  36,
+  37,
+  39,
+  41,
+  42,
+  44,
+  46,
+  48,
+  49,
+  51,
+  53,
+  55,
+  56,
+  58,
+  59,
+  60,
+  61,
+  63,
+  64,
+  65,
+  66,
+  68,
+  69,
+  70,
+  71,
+  73,
+  74,
+  75,
+  76,
+  78,
+  79,
+  80,
+  81,
+  83,
+  84,
+  85,
+  86,
+  88,
+  89,
+  90,
+  91,
+  93,
+  94,
+  95,
+  96,
+  98,
+  99,
+  100,
+  101,
+  103,
+  104,
+  105,
+  106,
+  108,
+  109,
+  110,
+  111,
+  113,
+  114,
+  115,
+  116,
+  118,
+  119,
+  120,
+  121,
+  123,
+  124,
+  125,
+  126,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -20,
+  -21,
+  -21,
+  -22,
+  -22,
+  -23,
+  -23,
+  -24,
+  -24,
+  -25,
+  -25,
+  -26,
+  -26,
+  -26,
+  -27,
+  -27,
+  -27,
+  -28,
+  -28,
+  -28,
+  -28,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -29,
+  -28,
+  -28,
+  -28,
+  -28,
+  -27,
+  -27,
+  -27,
+  -26,
+  -26,
+  -26
+};
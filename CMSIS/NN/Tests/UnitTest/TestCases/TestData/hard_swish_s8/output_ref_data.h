@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t hard_swish_s8_output_ref[45] =
+{
+  91,
+  -26,
+  -28,
+  4,
+  -23,
+  -29,
+  74,
+  -20,
+  -29,
+  68,
+  -22,
+  58,
+  0,
+  -20,
+  -20,
+  -14,
+  -20,
+  96,
+  93,
+  116,
+  44,
+  -20,
+  1,
+  -20,
+  0,
+  93,
+  31,
+  -20,
+  68,
+  29,
+  53,
+  -29,
+  9,
+  -17,
+  103,
+  -29,
+  -20,
+  86,
+  -20,
+  -20,
+  26,
+  -26,
+  -25,
+  -26,
+  -23
+};
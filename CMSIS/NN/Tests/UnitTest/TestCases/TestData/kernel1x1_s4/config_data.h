@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define KERNEL1X1_S4_OUT_CH 11
+#define KERNEL1X1_S4_IN_CH 18
+#define KERNEL1X1_S4_INPUT_W 5
+#define KERNEL1X1_S4_INPUT_H 3
+#define KERNEL1X1_S4_DST_SIZE 165
+#define KERNEL1X1_S4_INPUT_SIZE 270
+#define KERNEL1X1_S4_INPUT_OFFSET 1
+#define KERNEL1X1_S4_OUTPUT_OFFSET 3
+#define KERNEL1X1_S4_OUT_ACTIVATION_MIN -128
+#define KERNEL1X1_S4_OUT_ACTIVATION_MAX 127
+#define KERNEL1X1_S4_INPUT_BATCHES 1
+#define KERNEL1X1_S4_ACCUMULATION_DEPTH 18
+#define KERNEL1X1_S4_PACKED_WEIGHTS_SIZE 99
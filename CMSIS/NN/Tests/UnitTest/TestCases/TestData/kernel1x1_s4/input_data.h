@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t kernel1x1_s4_input[270] =
+{
+  51,
+  -46,
+  -30,
+  48,
+  105,
+  81,
+  -101,
+  42,
+  50,
+  122,
+  -100,
+  46,
+  -77,
+  83,
+  -22,
+  75,
+  123,
+  76,
+  13,
+  -30,
+  93,
+  -15,
+  84,
+  69,
+  80,
+  104,
+  -102,
+  120,
+  -21,
+  9,
+  89,
+  -44,
+  115,
+  -114,
+  -64,
+  48,
+  110,
+  69,
+  55,
+  -69,
+  -3,
+  3,
+  -35,
+  -12,
+  57,
+  29,
+  -19,
+  27,
+  -104,
+  -70,
+  124,
+  71,
+  -108,
+  -40,
+  -66,
+  -112,
+  -4,
+  58,
+  101,
+  121,
+  -66,
+  3,
+  77,
+  -70,
+  -60,
+  -78,
+  -121,
+  63,
+  -64,
+  -105,
+  83,
+  -62,
+  64,
+  10,
+  94,
+  -34,
+  104,
+  -35,
+  -96,
+  -14,
+  -125,
+  -69,
+  -40,
+  -73,
+  123,
+  124,
+  -99,
+  -118,
+  -125,
+  88,
+  126,
+  -21,
+  114,
+  -96,
+  39,
+  89,
+  10,
+  125,
+  -64,
+  63,
+  59,
+  19,
+  -44,
+  58,
+  -7,
+  13,
+  -33,
+  9,
+  94,
+  108,
+  -42,
+  68,
+  -52,
+  -90,
+  -3,
+  22,
+  61,
+  23,
+  -16,
+  -17,
+  41,
+  -77,
+  -23,
+  -37,
+  -53,
+  18,
+  -30,
+  -125,
+  7,
+  49,
+  57,
+  -56,
+  -59,
+  -65,
+  32,
+  -6,
+  94,
+  13,
+  -75,
+  -18,
+  -62,
+  23,
+  73,
+  -117,
+  77,
+  -21,
+  79,
+  -74,
+  -2,
+  113,
+  -3,
+  114,
+  -128,
+  -113,
+  122,
+  76,
+  -32,
+  48,
+  106,
+  77,
+  -10,
+  -13,
+  -124,
+  -50,
+  -32,
+  50,
+  39,
+  58,
+  -67,
+  93,
+  -99,
+  36,
+  16,
+  85,
+  15,
+  75,
+  -85,
+  120,
+  -67,
+  -25,
+  -56,
+  119,
+  -13,
+  17,
+  -21,
+  -111,
+  101,
+  38,
+  -52,
+  108,
+  82,
+  -119,
+  -85,
+  78,
+  60,
+  -116,
+  -93,
+  87,
+  -48,
+  115,
+  59,
+  -61,
+  -3,
+  86,
+  118,
+  37,
+  -51,
+  -17,
+  -29,
+  17,
+  -112,
+  12,
+  67,
+  46,
+  91,
+  -8,
+  29,
+  -47,
+  98,
+  71,
+  127,
+  87,
+  -99,
+  108,
+  72,
+  103,
+  -118,
+  -109,
+  3,
+  124,
+  68,
+  116,
+  -123,
+  94,
+  -128,
+  -50,
+  -51,
+  -7,
+  -12,
+  7,
+  -11,
+  107,
+  -120,
+  87,
+  -62,
+  -58,
+  113,
+  61,
+  23,
+  62,
+  63,
+  -109,
+  62,
+  -65,
+  115,
+  32,
+  37,
+  -65,
+  77,
+  -126,
+  60,
+  52,
+  -126,
+  125,
+  92,
+  -21,
+  99,
+  44,
+  26,
+  109
+};
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t kernel1x1_s4_output_ref[165] =
+{
+  -5,
+  -16,
+  16,
+  -23,
+  65,
+  -8,
+  -20,
+  49,
+  -65,
+  -34,
+  -53,
+  26,
+  -50,
+  16,
+  86,
+  105,
+  -5,
+  11,
+  -2,
+  -64,
+  81,
+  -6,
+  2,
+  1,
+  20,
+  11,
+  49,
+  -30,
+  4,
+  60,
+  18,
+  21,
+  6,
+  23,
+  -2,
+  42,
+  20,
+  -34,
+  10,
+  -4,
+  22,
+  -70,
+  -17,
+  -24,
+  19,
+  37,
+  73,
+  -17,
+  46,
+  36,
+  12,
+  -45,
+  -13,
+  42,
+  42,
+  14,
+  -58,
+  18,
+  54,
+  43,
+  -10,
+  6,
+  18,
+  -24,
+  67,
+  -20,
+  -26,
+  48,
+  18,
+  -8,
+  36,
+  -18,
+  22,
+  5,
+  -13,
+  57,
+  18,
+  6,
+  9,
+  -43,
+  -13,
+  -49,
+  -19,
+  -27,
+  9,
+  -36,
+  -47,
+  -23,
+  28,
+  -43,
+  17,
+  87,
+  40,
+  6,
+  -25,
+  38,
+  50,
+  13,
+  -29,
+  -10,
+  20,
+  -26,
+  11,
+  71,
+  7,
+  -77,
+  -38,
+  -42,
+  -63,
+  -19,
+  -17,
+  2,
+  -6,
+  62,
+  86,
+  -30,
+  0,
+  -44,
+  -18,
+  107,
+  13,
+  16,
+  -55,
+  10,
+  75,
+  58,
+  0,
+  4,
+  40,
+  -15,
+  34,
+  -5,
+  19,
+  2,
+  14,
+  -49,
+  127,
+  -33,
+  -10,
+  2,
+  -85,
+  -56,
+  3,
+  30,
+  -9,
+  -41,
+  70,
+  61,
+  -7,
+  9,
+  -63,
+  -91,
+  -47,
+  18,
+  1,
+  4,
+  15,
+  -69,
+  104,
+  -16,
+  0,
+  25,
+  -3,
+  -55,
+  9
+};
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t kernel1x1_s4_packed_weights[99] =
+{
+  0,
+  -26,
+  70,
+  -1,
+  -18,
+  -80,
+  53,
+  -9,
+  -124,
+  15,
+  122,
+  -117,
+  -39,
+  -95,
+  27,
+  1,
+  13,
+  24,
+  37,
+  -67,
+  50,
+  31,
+  -126,
+  56,
+  63,
+  -128,
+  77,
+  31,
+  -87,
+  96,
+  101,
+  9,
+  -28,
+  -17,
+  -90,
+  -62,
+  107,
+  -17,
+  6,
+  67,
+  69,
+  95,
+  103,
+  55,
+  108,
+  110,
+  1,
+  97,
+  -37,
+  -69,
+  126,
+  68,
+  -99,
+  -14,
+  70,
+  -74,
+  -36,
+  48,
+  20,
+  -117,
+  5,
+  -94,
+  -73,
+  85,
+  20,
+  37,
+  43,
+  -44,
+  127,
+  -71,
+  -10,
+  6,
+  6,
+  13,
+  8,
+  -112,
+  -117,
+  83,
+  44,
+  20,
+  76,
+  55,
+  -85,
+  33,
+  55,
+  43,
+  -93,
+  -116,
+  -116,
+  110,
+  111,
+  -26,
+  -99,
+  -45,
+  -48,
+  -88,
+  71,
+  15,
+  -118
+};
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define LAYER_NORM_NUM_ROWS 3
+#define LAYER_NORM_ROW_SIZE 16
+#define LAYER_NORM_DST_SIZE 48
+#define LAYER_NORM_OUTPUT_MULTIPLIER 1073741824
+#define LAYER_NORM_OUTPUT_SHIFT -12
+#define LAYER_NORM_VARIANCE_LIMIT 1
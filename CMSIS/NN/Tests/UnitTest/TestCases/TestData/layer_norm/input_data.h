@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const int16_t layer_norm_input[48] =
+{
+  -100,
+  955,
+  -557,
+  360,
+  305,
+  520,
+  -646,
+  -599,
+  75,
+  -685,
+  735,
+  -586,
+  254,
+  41,
+  494,
+  -461,
+  -946,
+  -637,
+  -943,
+  -688,
+  -224,
+  614,
+  119,
+  -307,
+  642,
+  -562,
+  -561,
+  -111,
+  -56,
+  851,
+  -242,
+  692,
+  560,
+  683,
+  -854,
+  -930,
+  -630,
+  827,
+  850,
+  -937,
+  724,
+  -87,
+  637,
+  -508,
+  933,
+  539,
+  772,
+  768
+};
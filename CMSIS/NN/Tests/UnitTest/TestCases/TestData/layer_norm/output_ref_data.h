@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const int16_t layer_norm_output_ref[48] =
+{
+  576,
+  -7823,
+  5053,
+  -4976,
+  -2017,
+  -6067,
+  -2732,
+  -1384,
+  533,
+  2362,
+  -7248,
+  -8557,
+  -3762,
+  -120,
+  -2669,
+  -2146,
+  3820,
+  3764,
+  6558,
+  6972,
+  500,
+  -8288,
+  1027,
+  -345,
+  5876,
+  1312,
+  3766,
+  504,
+  -1292,
+  -3397,
+  465,
+  3504,
+  -1325,
+  -2892,
+  7091,
+  11892,
+  4281,
+  -5432,
+  1998,
+  -1946,
+  3088,
+  767,
+  -3182,
+  -7714,
+  -8183,
+  -903,
+  -2296,
+  1879
+};
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t leaky_relu_s8_input[31] =
+{
+  40,
+  -63,
+  -110,
+  -86,
+  40,
+  -24,
+  -83,
+  20,
+  16,
+  85,
+  22,
+  79,
+  99,
+  13,
+  35,
+  110,
+  -102,
+  -49,
+  1,
+  -33,
+  -81,
+  -45,
+  -88,
+  -55,
+  -85,
+  58,
+  119,
+  124,
+  -122,
+  19,
+  18
+};
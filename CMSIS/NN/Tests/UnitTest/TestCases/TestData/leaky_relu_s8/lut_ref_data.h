@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t leaky_relu_s8_lut_ref[256] =
+{
+  -13,
+  -13,
+  -13,
+  -13,
+  -12,
+  -12,
+  -11,
+  -9,
+  -8,
+  -7,
+  -6,
+  -4,
+  -3,
+  -2,
+  -1,
+  1,
+  2,
+  3,
+  4,
+  6,
+  7,
+  8,
+  9,
+  11,
+  12,
+  13,
+  14,
+  16,
+  17,
+  18,
+  19,
+  21,
+  22,
+  23,
+  24,
+  26,
+  27,
+  28,
+  29,
+  31,
+  32,
+  33,
+  34,
+  36,
+  37,
+  38,
+  39,
+  41,
+  42,
+  43,
+  44,
+  46,
+  47,
+  48,
+  49,
+  51,
+  52,
+  53,
+  54,
+  56,
+  57,
+  58,
+  59,
+  61,
+  62,
+  63,
+  64,
+  66,
+  67,
+  68,
+  69,
+  71,
+  72,
+  73,
+  74,
+  76,
+  77,
+  78,
+  79,
+  81,
+  82,
+  83,
+  84,
+  86,
+  87,
+  88,
+  89,
+  91,
+  92,
+  93,
+  94,
+  96,
+  97,
+  98,
+  99,
+  101,
+  102,
+  103,
+  104,
+  106,
+  107,
+  108,
+  109,
+  111,
+  112,
+  113,
+  114,
+  116,
+  117,
+  118,
+  119,
+  121,
+  122,
+  123,
+  124,
+  126,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  -45,
+  -45,
+  -45,
+  -45,
+  -44,
+  -44,
+  -44,
+  -44,
+  -43,
+  -43,
+  -43,
+  -43,
+  -42,
+  -42,
+  -42,
+  -42,
+  -41,
+  -41,
+  -41,
+  -41,
+  -40,
+  -40,
+  -40,
+  -40,
+  -39,
+  -39,
+  -39,
+  -39,
+  -38,
+  -38,
+  -38,
+  -38,
+  -37,
+  -37,
+  -37,
+  -37,
+  -36,
+  -36,
+  -36,
+  -36,
+  -35,
+  -35,
+  -35,
+  -35,
+  -34,
+  -34,
+  -34,
+  -34,
+  -33,
+  -33,
+  -33,
+  -33,
+  -32,
+  -32,
+  -32,
+  -32,
+  -31,
+  -31,
+  -31,
+  -31,
+  -30,
+  -30,
+  -30,
+  -30,
+  -29,
+  -29,
+  -29,
+  -29,
+  -28,
+  -28,
+  -28,
+  -28,
+  -27,
+  -27,
+  -27,
+  -27,
+  -26,
+  -26,
+  -26,
+  -26,
+  -25,
+  -25,
+  -25,
+  -25,
+  -24,
+  -24,
+  -24,
+  -24,
+  -23,
+  -23,
+  -23,
+  -23,
+  -22,
+  -22,
+  -22,
+  -22,
+  -21,
+  -21,
+  -21,
+  -21,
+  -20,
+  -20,
+  -20,
+  -20,
+  -19,
+  -19,
+  -19,
+  -19,
+  -18,
+  -18,
+  -18,
+  -18,
+  -17,
+  -17,
+  -17,
+  -17,
+  -16,
+  -16,
+  -16,
+  -16,
+  -15,
+  -15,
+  -15,
+  -15,
+  -14,
+  -14,
+  -14,
+  -14
+};
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t leaky_relu_s8_output_ref[31] =
+{
+  32,
+  -29,
+  -41,
+  -35,
+  32,
+  -19,
+  -34,
+  7,
+  2,
+  88,
+  9,
+  81,
+  106,
+  -2,
+  26,
+  119,
+  -39,
+  -26,
+  -13,
+  -22,
+  -34,
+  -25,
+  -35,
+  -27,
+  -35,
+  54,
+  127,
+  127,
+  -44,
+  6,
+  4
+};
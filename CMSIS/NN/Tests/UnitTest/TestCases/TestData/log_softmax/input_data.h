@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <stdint.h>
+
+const int8_t log_softmax_input[69] =
+{
+  -70,
+  81,
+  88,
+  -88,
+  -47,
+  -4,
+  72,
+  48,
+  -127,
+  112,
+  74,
+  4,
+  -127,
+  -117,
+  -70,
+  -119,
+  -24,
+  47,
+  -111,
+  -89,
+  -93,
+  -74,
+  94,
+  -38,
+  17,
+  39,
+  45,
+  -23,
+  52,
+  30,
+  -2,
+  110,
+  -16,
+  -42,
+  -106,
+  65,
+  83,
+  94,
+  -14,
+  84,
+  78,
+  -68,
+  -40,
+  79,
+  -56,
+  19,
+  89,
+  48,
+  -62,
+  106,
+  87,
+  -27,
+  -96,
+  53,
+  64,
+  49,
+  -36,
+  -19,
+  -102,
+  -112,
+  -117,
+  25,
+  127,
+  -5,
+  111,
+  -107,
+  -67,
+  66,
+  116
+};
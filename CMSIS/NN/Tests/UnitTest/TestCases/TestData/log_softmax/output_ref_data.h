@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <stdint.h>
+
+const int8_t log_softmax_output_ref[69] =
+{
+  -65,
+  86,
+  93,
+  -83,
+  -42,
+  1,
+  77,
+  53,
+  -122,
+  117,
+  79,
+  9,
+  -122,
+  -112,
+  -65,
+  -114,
+  -19,
+  52,
+  -106,
+  -84,
+  -88,
+  -69,
+  99,
+  -33,
+  22,
+  44,
+  50,
+  -18,
+  57,
+  35,
+  3,
+  115,
+  -11,
+  -37,
+  -101,
+  70,
+  88,
+  99,
+  -9,
+  89,
+  83,
+  -63,
+  -35,
+  84,
+  -51,
+  24,
+  75,
+  34,
+  -76,
+  92,
+  73,
+  -41,
+  -110,
+  39,
+  50,
+  35,
+  -50,
+  -33,
+  -116,
+  -126,
+  -128,
+  11,
+  113,
+  -19,
+  97,
+  -121,
+  -81,
+  52,
+  102
+};
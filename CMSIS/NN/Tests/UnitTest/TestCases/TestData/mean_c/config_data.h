@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define MEAN_C_INPUT_BATCHES 2
+#define MEAN_C_INPUT_H 3
+#define MEAN_C_INPUT_W 5
+#define MEAN_C_IN_CH 13
+#define MEAN_C_OUTPUT_BATCHES 2
+#define MEAN_C_OUTPUT_H 3
+#define MEAN_C_OUTPUT_W 5
+#define MEAN_C_OUT_CH 1
+#define MEAN_C_DST_SIZE 30
+#define MEAN_C_INPUT_OFFSET -4
+#define MEAN_C_OUTPUT_OFFSET -2
+#define MEAN_C_OUTPUT_MULTIPLIER 1073741824
+#define MEAN_C_OUTPUT_SHIFT 2
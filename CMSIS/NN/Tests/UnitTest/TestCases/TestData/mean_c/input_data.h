@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t mean_c_input[390] =
+{
+  3,
+  126,
+  -24,
+  -28,
+  30,
+  48,
+  -23,
+  89,
+  -22,
+  29,
+  -62,
+  -86,
+  -43,
+  -104,
+  -35,
+  20,
+  -124,
+  6,
+  -97,
+  49,
+  -82,
+  -99,
+  -10,
+  76,
+  116,
+  85,
+  115,
+  99,
+  -25,
+  84,
+  -5,
+  -19,
+  -68,
+  -67,
+  81,
+  39,
+  -24,
+  51,
+  54,
+  -67,
+  -8,
+  -124,
+  -67,
+  105,
+  44,
+  -29,
+  97,
+  86,
+  71,
+  -99,
+  5,
+  15,
+  92,
+  -32,
+  -55,
+  -104,
+  -89,
+  41,
+  -73,
+  -36,
+  -31,
+  105,
+  41,
+  -48,
+  -12,
+  -31,
+  7,
+  11,
+  64,
+  -13,
+  -19,
+  -85,
+  -54,
+  52,
+  -71,
+  -92,
+  17,
+  -52,
+  -13,
+  1,
+  76,
+  -21,
+  40,
+  -68,
+  -43,
+  -127,
+  -90,
+  12,
+  -7,
+  4,
+  -33,
+  -96,
+  122,
+  109,
+  73,
+  119,
+  86,
+  -31,
+  -102,
+  -19,
+  -37,
+  -56,
+  127,
+  -85,
+  83,
+  28,
+  -18,
+  68,
+  44,
+  -122,
+  60,
+  105,
+  74,
+  94,
+  -90,
+  -34,
+  5,
+  8,
+  -78,
+  41,
+  -19,
+  -5,
+  78,
+  -57,
+  -48,
+  -106,
+  -119,
+  -39,
+  43,
+  -97,
+  55,
+  -121,
+  -93,
+  110,
+  56,
+  -43,
+  39,
+  40,
+  -69,
+  -31,
+  -122,
+  -109,
+  87,
+  -117,
+  -37,
+  -1,
+  98,
+  66,
+  106,
+  -2,
+  -13,
+  -18,
+  19,
+  -58,
+  -95,
+  -111,
+  74,
+  118,
+  68,
+  -58,
+  -113,
+  -6,
+  0,
+  124,
+  4,
+  54,
+  1,
+  111,
+  98,
+  117,
+  -69,
+  35,
+  -21,
+  -17,
+  71,
+  70,
+  94,
+  -96,
+  66,
+  -12,
+  -32,
+  25,
+  -51,
+  89,
+  -110,
+  45,
+  1,
+  30,
+  64,
+  -21,
+  -116,
+  -20,
+  -58,
+  -20,
+  -67,
+  -13,
+  0,
+  6,
+  45,
+  73,
+  113,
+  -62,
+  68,
+  37,
+  -75,
+  -90,
+  85,
+  45,
+  124,
+  -34,
+  9,
+  51,
+  74,
+  2,
+  102,
+  -87,
+  -18,
+  -8,
+  115,
+  72,
+  15,
+  10,
+  120,
+  -15,
+  16,
+  96,
+  -96,
+  24,
+  34,
+  -88,
+  32,
+  -40,
+  9,
+  1,
+  123,
+  52,
+  -34,
+  30,
+  -33,
+  81,
+  55,
+  -75,
+  -13,
+  -118,
+  -90,
+  -115,
+  -95,
+  62,
+  37,
+  10,
+  94,
+  1,
+  14,
+  86,
+  112,
+  -98,
+  -44,
+  62,
+  14,
+  91,
+  79,
+  125,
+  -117,
+  52,
+  -21,
+  21,
+  -27,
+  120,
+  -102,
+  -90,
+  5,
+  75,
+  19,
+  -4,
+  -39,
+  63,
+  93,
+  -24,
+  66,
+  64,
+  65,
+  -44,
+  15,
+  91,
+  -56,
+  17,
+  -117,
+  -20,
+  30,
+  -121,
+  -70,
+  56,
+  15,
+  -121,
+  42,
+  4,
+  112,
+  124,
+  75,
+  -83,
+  93,
+  108,
+  113,
+  -93,
+  -11,
+  10,
+  -19,
+  -68,
+  71,
+  -18,
+  -106,
+  -97,
+  64,
+  39,
+  77,
+  106,
+  123,
+  31,
+  122,
+  -83,
+  -77,
+  62,
+  52,
+  64,
+  88,
+  -120,
+  -41,
+  -65,
+  69,
+  114,
+  -30,
+  3,
+  -47,
+  59,
+  99,
+  -118,
+  -87,
+  -32,
+  -50,
+  68,
+  41,
+  21,
+  79,
+  38,
+  -64,
+  0,
+  37,
+  106,
+  63,
+  -124,
+  90,
+  -49,
+  127,
+  15,
+  -30,
+  64,
+  -7,
+  -29,
+  -67,
+  94,
+  117,
+  60,
+  85,
+  76,
+  72,
+  -9,
+  -68,
+  82,
+  76,
+  78,
+  -123,
+  72,
+  -49,
+  -89,
+  24,
+  51,
+  -12,
+  -82,
+  -93,
+  5,
+  -55,
+  119,
+  -90,
+  34,
+  65,
+  93,
+  -128,
+  -95,
+  -85,
+  125
+};
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t mean_c_output_ref[30] =
+{
+  -4,
+  -41,
+  38,
+  -6,
+  -41,
+  -51,
+  -51,
+  22,
+  36,
+  -71,
+  -41,
+  -35,
+  63,
+  26,
+  -46,
+  26,
+  54,
+  6,
+  -46,
+  58,
+  11,
+  37,
+  -9,
+  -25,
+  93,
+  -40,
+  37,
+  60,
+  6,
+  -39
+};
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define MEAN_HW_INPUT_BATCHES 1
+#define MEAN_HW_INPUT_H 7
+#define MEAN_HW_INPUT_W 6
+#define MEAN_HW_IN_CH 11
+#define MEAN_HW_OUTPUT_BATCHES 1
+#define MEAN_HW_OUTPUT_H 1
+#define MEAN_HW_OUTPUT_W 1
+#define MEAN_HW_OUT_CH 11
+#define MEAN_HW_DST_SIZE 11
+#define MEAN_HW_INPUT_OFFSET 3
+#define MEAN_HW_OUTPUT_OFFSET 5
+#define MEAN_HW_OUTPUT_MULTIPLIER 1073741824
+#define MEAN_HW_OUTPUT_SHIFT 1
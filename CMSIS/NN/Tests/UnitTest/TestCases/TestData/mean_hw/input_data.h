@@ -0,0 +1,488 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t mean_hw_input[462] =
+{
+  -28,
+  15,
+  -97,
+  71,
+  36,
+  -41,
+  -75,
+  60,
+  50,
+  -52,
+  -116,
+  -106,
+  -4,
+  37,
+  -17,
+  113,
+  -75,
+  -43,
+  64,
+  67,
+  56,
+  -62,
+  127,
+  94,
+  -122,
+  38,
+  57,
+  -76,
+  -61,
+  31,
+  77,
+  -17,
+  124,
+  125,
+  -76,
+  -77,
+  61,
+  70,
+  -64,
+  114,
+  48,
+  105,
+  94,
+  -66,
+  100,
+  95,
+  -39,
+  103,
+  0,
+  -19,
+  89,
+  -58,
+  84,
+  107,
+  -19,
+  -16,
+  -15,
+  22,
+  -25,
+  -96,
+  78,
+  -51,
+  50,
+  -113,
+  -53,
+  -115,
+  -117,
+  26,
+  -116,
+  -75,
+  -34,
+  35,
+  -112,
+  -118,
+  45,
+  124,
+  -13,
+  -113,
+  18,
+  -124,
+  -103,
+  34,
+  -117,
+  56,
+  47,
+  50,
+  85,
+  -63,
+  6,
+  5,
+  -97,
+  -75,
+  112,
+  1,
+  -64,
+  25,
+  -51,
+  97,
+  -78,
+  -100,
+  -93,
+  -109,
+  -29,
+  -116,
+  -66,
+  58,
+  91,
+  -6,
+  26,
+  4,
+  -22,
+  -15,
+  -40,
+  62,
+  106,
+  87,
+  90,
+  79,
+  100,
+  43,
+  -28,
+  -115,
+  -5,
+  46,
+  74,
+  -12,
+  63,
+  122,
+  -14,
+  34,
+  -68,
+  -3,
+  -21,
+  -16,
+  32,
+  75,
+  -103,
+  89,
+  -60,
+  93,
+  -26,
+  -92,
+  48,
+  -11,
+  -124,
+  31,
+  69,
+  11,
+  -18,
+  125,
+  95,
+  -119,
+  81,
+  -126,
+  95,
+  -4,
+  -4,
+  24,
+  -127,
+  15,
+  -77,
+  -6,
+  112,
+  -79,
+  121,
+  -75,
+  41,
+  118,
+  -14,
+  -95,
+  31,
+  78,
+  -53,
+  -78,
+  23,
+  86,
+  99,
+  -40,
+  -114,
+  -114,
+  -66,
+  -105,
+  -75,
+  -62,
+  -18,
+  -93,
+  76,
+  -81,
+  -3,
+  99,
+  115,
+  -95,
+  46,
+  42,
+  -81,
+  -101,
+  64,
+  -95,
+  93,
+  -67,
+  -82,
+  -2,
+  -111,
+  -44,
+  80,
+  88,
+  2,
+  -11,
+  50,
+  72,
+  -102,
+  -27,
+  -122,
+  -71,
+  93,
+  -88,
+  -107,
+  -83,
+  -42,
+  -85,
+  -121,
+  -24,
+  -96,
+  -118,
+  108,
+  -71,
+  -104,
+  -121,
+  117,
+  44,
+  30,
+  46,
+  -40,
+  -1,
+  22,
+  -42,
+  26,
+  -109,
+  122,
+  -51,
+  73,
+  -71,
+  94,
+  72,
+  86,
+  -47,
+  -27,
+  72,
+  -66,
+  44,
+  -15,
+  63,
+  -82,
+  35,
+  83,
+  17,
+  -73,
+  8,
+  76,
+  94,
+  -89,
+  -124,
+  -8,
+  -92,
+  -92,
+  81,
+  -58,
+  1,
+  92,
+  -7,
+  -124,
+  127,
+  -104,
+  -5,
+  91,
+  69,
+  -73,
+  73,
+  56,
+  -37,
+  13,
+  -8,
+  -12,
+  120,
+  24,
+  94,
+  95,
+  18,
+  79,
+  -14,
+  -58,
+  109,
+  -125,
+  -79,
+  6,
+  -24,
+  -106,
+  55,
+  34,
+  -127,
+  -25,
+  31,
+  53,
+  -95,
+  2,
+  -112,
+  30,
+  1,
+  -41,
+  45,
+  2,
+  -58,
+  54,
+  14,
+  -119,
+  -30,
+  -67,
+  96,
+  -63,
+  -95,
+  -24,
+  92,
+  -8,
+  118,
+  -27,
+  -78,
+  -112,
+  43,
+  73,
+  -11,
+  37,
+  119,
+  -31,
+  -109,
+  64,
+  -125,
+  -99,
+  -114,
+  -90,
+  -27,
+  91,
+  -77,
+  124,
+  -26,
+  -95,
+  -41,
+  85,
+  -45,
+  43,
+  72,
+  50,
+  -10,
+  -54,
+  87,
+  117,
+  41,
+  97,
+  78,
+  113,
+  -43,
+  -32,
+  66,
+  4,
+  -54,
+  -97,
+  89,
+  -1,
+  -113,
+  55,
+  70,
+  70,
+  -128,
+  82,
+  37,
+  113,
+  -11,
+  48,
+  24,
+  29,
+  87,
+  -71,
+  75,
+  32,
+  46,
+  -73,
+  68,
+  24,
+  -54,
+  13,
+  38,
+  99,
+  86,
+  38,
+  -35,
+  31,
+  -49,
+  -99,
+  -106,
+  85,
+  -9,
+  92,
+  57,
+  50,
+  -119,
+  -96,
+  1,
+  -115,
+  76,
+  23,
+  -100,
+  -119,
+  -30,
+  -4,
+  -41,
+  -79,
+  34,
+  -10,
+  -94,
+  -15,
+  -22,
+  121,
+  95,
+  50,
+  -6,
+  -68,
+  119,
+  72,
+  29,
+  -26,
+  -66,
+  -39,
+  105,
+  100,
+  -125,
+  117,
+  -72,
+  92,
+  79,
+  -101,
+  -23,
+  58,
+  -121,
+  70,
+  126,
+  -115,
+  -40,
+  13,
+  102,
+  45,
+  -7,
+  -23,
+  -30,
+  57,
+  46,
+  -65,
+  15,
+  100,
+  73,
+  -62,
+  41,
+  -35,
+  -124
+};
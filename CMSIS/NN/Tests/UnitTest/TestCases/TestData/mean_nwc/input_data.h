@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t mean_nwc_input[360] =
+{
+  79,
+  -36,
+  -72,
+  -107,
+  122,
+  -86,
+  -125,
+  120,
+  -110,
+  -10,
+  -86,
+  75,
+  111,
+  -109,
+  -93,
+  35,
+  -115,
+  25,
+  -53,
+  56,
+  -5,
+  48,
+  -92,
+  -62,
+  125,
+  -113,
+  -86,
+  -124,
+  125,
+  -56,
+  -109,
+  98,
+  61,
+  -90,
+  -14,
+  -69,
+  108,
+  39,
+  126,
+  -36,
+  -61,
+  18,
+  33,
+  46,
+  -11,
+  -92,
+  43,
+  36,
+  -106,
+  103,
+  75,
+  -102,
+  -12,
+  -125,
+  -115,
+  41,
+  -32,
+  -45,
+  111,
+  35,
+  43,
+  6,
+  127,
+  -113,
+  69,
+  113,
+  -20,
+  24,
+  77,
+  -20,
+  81,
+  -89,
+  -80,
+  -13,
+  29,
+  -18,
+  -29,
+  95,
+  101,
+  87,
+  123,
+  80,
+  -23,
+  30,
+  4,
+  38,
+  25,
+  28,
+  -96,
+  45,
+  126,
+  -64,
+  -40,
+  31,
+  90,
+  7,
+  -65,
+  -106,
+  44,
+  108,
+  30,
+  -100,
+  32,
+  -45,
+  50,
+  -56,
+  21,
+  13,
+  -28,
+  116,
+  53,
+  83,
+  83,
+  114,
+  -40,
+  40,
+  -128,
+  -127,
+  90,
+  -50,
+  -88,
+  47,
+  -17,
+  -25,
+  -113,
+  -16,
+  97,
+  32,
+  -108,
+  17,
+  -35,
+  52,
+  -49,
+  -75,
+  -116,
+  67,
+  -47,
+  -22,
+  -121,
+  64,
+  100,
+  100,
+  -73,
+  -103,
+  73,
+  87,
+  -79,
+  -23,
+  28,
+  -8,
+  120,
+  -23,
+  -73,
+  -61,
+  77,
+  4,
+  68,
+  -22,
+  12,
+  101,
+  -59,
+  67,
+  -53,
+  122,
+  50,
+  -65,
+  58,
+  -59,
+  -12,
+  19,
+  -41,
+  -109,
+  -16,
+  42,
+  28,
+  7,
+  -1,
+  -63,
+  -98,
+  -91,
+  -98,
+  8,
+  -7,
+  122,
+  -50,
+  54,
+  -128,
+  -100,
+  -15,
+  -10,
+  -23,
+  21,
+  -33,
+  -6,
+  -8,
+  -79,
+  74,
+  -126,
+  -98,
+  30,
+  -12,
+  -127,
+  -13,
+  -128,
+  -51,
+  -127,
+  39,
+  -1,
+  91,
+  -27,
+  51,
+  91,
+  85,
+  33,
+  -82,
+  57,
+  49,
+  69,
+  -20,
+  -55,
+  -88,
+  -111,
+  120,
+  -125,
+  -78,
+  13,
+  -56,
+  43,
+  122,
+  -116,
+  -117,
+  -126,
+  -50,
+  -105,
+  82,
+  39,
+  -25,
+  -19,
+  76,
+  -73,
+  4,
+  -15,
+  -58,
+  47,
+  -7,
+  -73,
+  39,
+  -30,
+  -51,
+  -65,
+  -72,
+  78,
+  -124,
+  -10,
+  63,
+  121,
+  108,
+  102,
+  -4,
+  -114,
+  -118,
+  -58,
+  -91,
+  66,
+  -109,
+  17,
+  -63,
+  -72,
+  8,
+  -122,
+  -55,
+  -50,
+  115,
+  -24,
+  80,
+  1,
+  -41,
+  39,
+  -51,
+  38,
+  -26,
+  -46,
+  -82,
+  38,
+  -51,
+  -115,
+  28,
+  35,
+  96,
+  111,
+  44,
+  96,
+  9,
+  12,
+  -48,
+  -18,
+  8,
+  13,
+  120,
+  -113,
+  89,
+  71,
+  45,
+  -87,
+  81,
+  -103,
+  -105,
+  -30,
+  7,
+  16,
+  -86,
+  31,
+  -96,
+  -94,
+  -88,
+  -81,
+  54,
+  -15,
+  9,
+  -27,
+  -20,
+  6,
+  72,
+  28,
+  -82,
+  32,
+  -121,
+  -43,
+  27,
+  -92,
+  3,
+  -62,
+  32,
+  110,
+  -51,
+  -64,
+  51,
+  49,
+  -11,
+  51,
+  100,
+  -2,
+  46,
+  -42,
+  -2,
+  80,
+  27,
+  -84,
+  33,
+  3,
+  -76,
+  -1,
+  -84,
+  76,
+  105,
+  -57,
+  114,
+  35,
+  -128,
+  123
+};
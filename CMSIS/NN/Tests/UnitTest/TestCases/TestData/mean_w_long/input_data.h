@@ -0,0 +1,4186 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t mean_w_long_input[4160] =
+{
+  122,
+  117,
+  124,
+  115,
+  117,
+  111,
+  115,
+  110,
+  103,
+  109,
+  122,
+  103,
+  116,
+  118,
+  124,
+  116,
+  117,
+  102,
+  126,
+  116,
+  115,
+  126,
+  103,
+  105,
+  103,
+  112,
+  127,
+  109,
+  125,
+  116,
+  107,
+  118,
+  105,
+  106,
+  122,
+  121,
+  100,
+  122,
+  127,
+  105,
+  118,
+  127,
+  122,
+  100,
+  114,
+  116,
+  119,
+  112,
+  109,
+  106,
+  101,
+  121,
+  111,
+  123,
+  117,
+  102,
+  115,
+  120,
+  113,
+  110,
+  105,
+  119,
+  100,
+  103,
+  124,
+  111,
+  111,
+  115,
+  121,
+  111,
+  123,
+  122,
+  118,
+  126,
+  105,
+  113,
+  108,
+  103,
+  104,
+  102,
+  117,
+  112,
+  101,
+  111,
+  105,
+  125,
+  117,
+  114,
+  102,
+  114,
+  101,
+  109,
+  121,
+  104,
+  113,
+  115,
+  108,
+  109,
+  103,
+  125,
+  124,
+  105,
+  108,
+  109,
+  118,
+  118,
+  112,
+  115,
+  107,
+  113,
+  119,
+  112,
+  125,
+  127,
+  115,
+  117,
+  103,
+  102,
+  106,
+  115,
+  126,
+  115,
+  116,
+  101,
+  127,
+  102,
+  111,
+  115,
+  116,
+  103,
+  111,
+  111,
+  124,
+  112,
+  105,
+  116,
+  127,
+  124,
+  122,
+  119,
+  115,
+  125,
+  100,
+  125,
+  107,
+  101,
+  118,
+  107,
+  117,
+  115,
+  121,
+  120,
+  119,
+  115,
+  124,
+  110,
+  106,
+  125,
+  122,
+  104,
+  100,
+  108,
+  107,
+  123,
+  124,
+  110,
+  117,
+  127,
+  124,
+  102,
+  116,
+  110,
+  122,
+  106,
+  124,
+  117,
+  111,
+  102,
+  107,
+  109,
+  118,
+  111,
+  125,
+  110,
+  110,
+  112,
+  126,
+  117,
+  121,
+  122,
+  104,
+  111,
+  109,
+  103,
+  117,
+  113,
+  100,
+  120,
+  117,
+  101,
+  102,
+  103,
+  111,
+  107,
+  127,
+  104,
+  127,
+  107,
+  124,
+  100,
+  116,
+  112,
+  104,
+  115,
+  124,
+  127,
+  100,
+  108,
+  113,
+  126,
+  114,
+  127,
+  115,
+  120,
+  111,
+  112,
+  114,
+  118,
+  105,
+  111,
+  108,
+  123,
+  108,
+  119,
+  105,
+  115,
+  115,
+  109,
+  100,
+  110,
+  124,
+  112,
+  125,
+  110,
+  117,
+  121,
+  101,
+  122,
+  117,
+  125,
+  121,
+  101,
+  112,
+  103,
+  126,
+  108,
+  109,
+  120,
+  127,
+  108,
+  108,
+  124,
+  118,
+  125,
+  104,
+  124,
+  124,
+  113,
+  127,
+  110,
+  111,
+  123,
+  105,
+  112,
+  108,
+  102,
+  126,
+  108,
+  114,
+  124,
+  120,
+  111,
+  125,
+  117,
+  104,
+  110,
+  112,
+  125,
+  109,
+  115,
+  102,
+  112,
+  106,
+  111,
+  102,
+  113,
+  124,
+  112,
+  120,
+  100,
+  127,
+  120,
+  125,
+  117,
+  124,
+  122,
+  121,
+  126,
+  101,
+  116,
+  117,
+  105,
+  110,
+  123,
+  114,
+  116,
+  119,
+  115,
+  106,
+  114,
+  103,
+  123,
+  127,
+  104,
+  115,
+  103,
+  107,
+  113,
+  119,
+  123,
+  127,
+  102,
+  121,
+  112,
+  110,
+  111,
+  115,
+  113,
+  122,
+  125,
+  111,
+  124,
+  124,
+  117,
+  115,
+  103,
+  103,
+  115,
+  121,
+  124,
+  126,
+  108,
+  115,
+  114,
+  107,
+  116,
+  115,
+  119,
+  113,
+  125,
+  118,
+  111,
+  101,
+  112,
+  120,
+  102,
+  116,
+  117,
+  117,
+  113,
+  126,
+  118,
+  112,
+  111,
+  112,
+  126,
+  124,
+  105,
+  116,
+  107,
+  108,
+  113,
+  121,
+  118,
+  105,
+  116,
+  111,
+  124,
+  111,
+  122,
+  113,
+  105,
+  118,
+  126,
+  109,
+  110,
+  117,
+  116,
+  104,
+  101,
+  104,
+  116,
+  100,
+  115,
+  112,
+  125,
+  101,
+  112,
+  105,
+  115,
+  106,
+  118,
+  123,
+  112,
+  123,
+  114,
+  118,
+  104,
+  101,
+  127,
+  117,
+  119,
+  109,
+  121,
+  124,
+  112,
+  125,
+  105,
+  110,
+  127,
+  109,
+  108,
+  104,
+  111,
+  106,
+  119,
+  109,
+  114,
+  103,
+  123,
+  114,
+  125,
+  117,
+  101,
+  103,
+  103,
+  110,
+  112,
+  109,
+  105,
+  123,
+  126,
+  107,
+  119,
+  118,
+  112,
+  112,
+  116,
+  101,
+  112,
+  113,
+  117,
+  108,
+  114,
+  102,
+  125,
+  119,
+  102,
+  127,
+  103,
+  107,
+  106,
+  127,
+  115,
+  124,
+  108,
+  109,
+  126,
+  112,
+  109,
+  113,
+  117,
+  116,
+  102,
+  108,
+  103,
+  110,
+  109,
+  107,
+  114,
+  104,
+  124,
+  121,
+  120,
+  108,
+  117,
+  120,
+  105,
+  123,
+  118,
+  111,
+  126,
+  127,
+  108,
+  106,
+  106,
+  126,
+  118,
+  127,
+  118,
+  118,
+  119,
+  111,
+  106,
+  115,
+  102,
+  110,
+  122,
+  107,
+  106,
+  102,
+  101,
+  117,
+  111,
+  100,
+  114,
+  117,
+  121,
+  108,
+  120,
+  117,
+  124,
+  112,
+  114,
+  111,
+  100,
+  118,
+  114,
+  127,
+  116,
+  127,
+  103,
+  120,
+  122,
+  100,
+  112,
+  104,
+  122,
+  125,
+  121,
+  116,
+  119,
+  124,
+  115,
+  127,
+  111,
+  104,
+  127,
+  102,
+  120,
+  104,
+  108,
+  124,
+  118,
+  121,
+  112,
+  105,
+  112,
+  124,
+  117,
+  106,
+  100,
+  126,
+  106,
+  115,
+  119,
+  118,
+  117,
+  115,
+  115,
+  125,
+  118,
+  122,
+  107,
+  112,
+  122,
+  102,
+  122,
+  115,
+  126,
+  120,
+  120,
+  116,
+  106,
+  102,
+  103,
+  115,
+  112,
+  107,
+  115,
+  102,
+  109,
+  112,
+  121,
+  117,
+  123,
+  110,
+  119,
+  108,
+  109,
+  114,
+  106,
+  101,
+  103,
+  114,
+  109,
+  103,
+  118,
+  106,
+  109,
+  122,
+  118,
+  100,
+  117,
+  124,
+  120,
+  106,
+  109,
+  111,
+  123,
+  103,
+  108,
+  108,
+  119,
+  107,
+  112,
+  111,
+  106,
+  119,
+  115,
+  113,
+  118,
+  100,
+  111,
+  109,
+  127,
+  104,
+  111,
+  119,
+  125,
+  107,
+  106,
+  121,
+  112,
+  106,
+  122,
+  112,
+  120,
+  116,
+  106,
+  126,
+  127,
+  117,
+  121,
+  116,
+  114,
+  106,
+  111,
+  114,
+  119,
+  105,
+  118,
+  100,
+  119,
+  120,
+  126,
+  126,
+  116,
+  120,
+  123,
+  110,
+  124,
+  107,
+  126,
+  106,
+  107,
+  107,
+  108,
+  124,
+  104,
+  124,
+  103,
+  122,
+  110,
+  106,
+  102,
+  124,
+  108,
+  123,
+  123,
+  118,
+  110,
+  119,
+  110,
+  122,
+  103,
+  116,
+  119,
+  114,
+  122,
+  106,
+  124,
+  124,
+  101,
+  123,
+  108,
+  119,
+  116,
+  101,
+  112,
+  100,
+  110,
+  104,
+  124,
+  103,
+  107,
+  112,
+  125,
+  113,
+  124,
+  116,
+  116,
+  102,
+  125,
+  114,
+  125,
+  104,
+  106,
+  107,
+  110,
+  108,
+  107,
+  105,
+  106,
+  121,
+  113,
+  117,
+  103,
+  100,
+  110,
+  110,
+  116,
+  100,
+  107,
+  110,
+  113,
+  109,
+  103,
+  105,
+  104,
+  106,
+  124,
+  102,
+  100,
+  113,
+  109,
+  120,
+  109,
+  118,
+  108,
+  119,
+  106,
+  104,
+  125,
+  101,
+  109,
+  115,
+  120,
+  105,
+  108,
+  105,
+  104,
+  107,
+  118,
+  108,
+  116,
+  114,
+  122,
+  101,
+  108,
+  110,
+  116,
+  104,
+  116,
+  113,
+  122,
+  122,
+  124,
+  126,
+  101,
+  109,
+  104,
+  124,
+  121,
+  107,
+  102,
+  106,
+  117,
+  113,
+  109,
+  118,
+  126,
+  119,
+  111,
+  122,
+  126,
+  101,
+  103,
+  114,
+  110,
+  102,
+  122,
+  123,
+  100,
+  125,
+  116,
+  106,
+  121,
+  103,
+  122,
+  103,
+  108,
+  104,
+  117,
+  104,
+  111,
+  125,
+  113,
+  106,
+  110,
+  118,
+  109,
+  122,
+  125,
+  124,
+  108,
+  125,
+  100,
+  101,
+  126,
+  120,
+  110,
+  111,
+  117,
+  123,
+  116,
+  111,
+  106,
+  106,
+  121,
+  127,
+  112,
+  120,
+  105,
+  121,
+  118,
+  108,
+  126,
+  114,
+  113,
+  112,
+  104,
+  105,
+  126,
+  114,
+  114,
+  104,
+  117,
+  125,
+  111,
+  101,
+  110,
+  126,
+  122,
+  105,
+  116,
+  125,
+  116,
+  104,
+  108,
+  116,
+  111,
+  126,
+  125,
+  125,
+  113,
+  117,
+  100,
+  115,
+  120,
+  125,
+  111,
+  107,
+  122,
+  111,
+  117,
+  114,
+  102,
+  122,
+  121,
+  127,
+  107,
+  106,
+  107,
+  114,
+  109,
+  101,
+  123,
+  106,
+  115,
+  106,
+  101,
+  124,
+  116,
+  126,
+  105,
+  108,
+  100,
+  107,
+  118,
+  103,
+  107,
+  117,
+  114,
+  106,
+  112,
+  114,
+  113,
+  104,
+  115,
+  119,
+  108,
+  103,
+  127,
+  117,
+  100,
+  103,
+  113,
+  120,
+  118,
+  110,
+  101,
+  125,
+  122,
+  118,
+  109,
+  113,
+  109,
+  118,
+  118,
+  120,
+  124,
+  100,
+  123,
+  116,
+  115,
+  105,
+  125,
+  115,
+  116,
+  115,
+  115,
+  109,
+  107,
+  102,
+  108,
+  109,
+  103,
+  101,
+  125,
+  123,
+  103,
+  107,
+  119,
+  118,
+  124,
+  121,
+  106,
+  115,
+  102,
+  114,
+  104,
+  106,
+  126,
+  114,
+  125,
+  120,
+  120,
+  106,
+  105,
+  104,
+  102,
+  117,
+  106,
+  116,
+  112,
+  113,
+  126,
+  109,
+  105,
+  112,
+  121,
+  124,
+  107,
+  110,
+  120,
+  117,
+  100,
+  107,
+  112,
+  126,
+  127,
+  120,
+  110,
+  120,
+  109,
+  110,
+  104,
+  123,
+  106,
+  126,
+  103,
+  111,
+  101,
+  110,
+  103,
+  109,
+  106,
+  127,
+  110,
+  100,
+  104,
+  115,
+  104,
+  110,
+  114,
+  118,
+  104,
+  117,
+  113,
+  105,
+  108,
+  109,
+  120,
+  122,
+  122,
+  111,
+  118,
+  125,
+  127,
+  110,
+  103,
+  100,
+  114,
+  117,
+  126,
+  119,
+  113,
+  125,
+  127,
+  106,
+  109,
+  124,
+  108,
+  110,
+  102,
+  117,
+  115,
+  116,
+  117,
+  112,
+  108,
+  108,
+  114,
+  104,
+  120,
+  127,
+  107,
+  111,
+  118,
+  126,
+  101,
+  106,
+  125,
+  116,
+  123,
+  122,
+  105,
+  105,
+  100,
+  107,
+  101,
+  110,
+  127,
+  126,
+  111,
+  115,
+  121,
+  127,
+  121,
+  102,
+  123,
+  106,
+  103,
+  110,
+  122,
+  126,
+  105,
+  125,
+  103,
+  114,
+  117,
+  126,
+  102,
+  105,
+  108,
+  114,
+  122,
+  102,
+  100,
+  105,
+  124,
+  106,
+  116,
+  115,
+  125,
+  121,
+  114,
+  114,
+  121,
+  110,
+  120,
+  125,
+  105,
+  110,
+  114,
+  103,
+  122,
+  123,
+  107,
+  117,
+  114,
+  103,
+  100,
+  112,
+  106,
+  121,
+  123,
+  100,
+  103,
+  109,
+  109,
+  110,
+  105,
+  117,
+  107,
+  106,
+  111,
+  103,
+  110,
+  110,
+  114,
+  103,
+  104,
+  101,
+  112,
+  124,
+  109,
+  102,
+  111,
+  106,
+  121,
+  100,
+  125,
+  119,
+  111,
+  125,
+  127,
+  100,
+  113,
+  114,
+  116,
+  106,
+  127,
+  104,
+  123,
+  124,
+  123,
+  107,
+  115,
+  102,
+  108,
+  110,
+  103,
+  124,
+  127,
+  104,
+  124,
+  121,
+  110,
+  102,
+  112,
+  127,
+  125,
+  121,
+  112,
+  123,
+  109,
+  104,
+  104,
+  102,
+  115,
+  119,
+  123,
+  121,
+  109,
+  112,
+  114,
+  116,
+  105,
+  119,
+  127,
+  123,
+  121,
+  113,
+  111,
+  125,
+  109,
+  121,
+  110,
+  111,
+  116,
+  102,
+  110,
+  126,
+  122,
+  106,
+  114,
+  108,
+  118,
+  121,
+  109,
+  115,
+  121,
+  105,
+  112,
+  116,
+  102,
+  125,
+  105,
+  114,
+  105,
+  121,
+  102,
+  124,
+  100,
+  113,
+  100,
+  127,
+  118,
+  116,
+  127,
+  113,
+  123,
+  114,
+  127,
+  122,
+  124,
+  109,
+  102,
+  123,
+  115,
+  125,
+  113,
+  101,
+  124,
+  108,
+  126,
+  107,
+  126,
+  121,
+  123,
+  102,
+  120,
+  119,
+  119,
+  125,
+  125,
+  107,
+  115,
+  105,
+  127,
+  105,
+  110,
+  107,
+  110,
+  119,
+  100,
+  126,
+  102,
+  112,
+  113,
+  119,
+  120,
+  111,
+  104,
+  127,
+  109,
+  116,
+  113,
+  108,
+  118,
+  100,
+  117,
+  106,
+  123,
+  114,
+  122,
+  102,
+  108,
+  117,
+  123,
+  120,
+  106,
+  127,
+  126,
+  113,
+  123,
+  121,
+  105,
+  114,
+  113,
+  106,
+  120,
+  110,
+  112,
+  114,
+  109,
+  122,
+  103,
+  110,
+  121,
+  100,
+  117,
+  115,
+  110,
+  110,
+  121,
+  119,
+  125,
+  110,
+  113,
+  125,
+  104,
+  102,
+  104,
+  126,
+  102,
+  127,
+  127,
+  108,
+  114,
+  106,
+  125,
+  106,
+  119,
+  110,
+  107,
+  104,
+  116,
+  119,
+  107,
+  119,
+  117,
+  103,
+  122,
+  107,
+  124,
+  127,
+  106,
+  111,
+  114,
+  124,
+  104,
+  116,
+  125,
+  127,
+  101,
+  105,
+  123,
+  124,
+  107,
+  115,
+  122,
+  125,
+  104,
+  103,
+  121,
+  112,
+  124,
+  116,
+  113,
+  118,
+  111,
+  125,
+  115,
+  120,
+  109,
+  119,
+  115,
+  108,
+  108,
+  115,
+  125,
+  110,
+  123,
+  112,
+  114,
+  125,
+  115,
+  122,
+  108,
+  100,
+  108,
+  110,
+  121,
+  117,
+  116,
+  118,
+  103,
+  109,
+  110,
+  119,
+  114,
+  125,
+  107,
+  108,
+  121,
+  124,
+  113,
+  124,
+  108,
+  116,
+  109,
+  109,
+  123,
+  115,
+  120,
+  121,
+  122,
+  109,
+  104,
+  122,
+  126,
+  110,
+  117,
+  101,
+  110,
+  106,
+  101,
+  101,
+  114,
+  114,
+  114,
+  112,
+  117,
+  116,
+  116,
+  118,
+  103,
+  114,
+  121,
+  115,
+  107,
+  126,
+  112,
+  123,
+  126,
+  106,
+  108,
+  114,
+  126,
+  110,
+  101,
+  101,
+  101,
+  107,
+  121,
+  108,
+  118,
+  102,
+  106,
+  100,
+  114,
+  105,
+  122,
+  124,
+  119,
+  125,
+  103,
+  123,
+  110,
+  103,
+  109,
+  114,
+  111,
+  116,
+  101,
+  121,
+  103,
+  121,
+  113,
+  123,
+  115,
+  126,
+  113,
+  104,
+  109,
+  113,
+  122,
+  112,
+  126,
+  116,
+  126,
+  125,
+  109,
+  103,
+  127,
+  123,
+  117,
+  125,
+  111,
+  120,
+  106,
+  121,
+  121,
+  124,
+  124,
+  117,
+  104,
+  106,
+  103,
+  102,
+  127,
+  112,
+  105,
+  127,
+  104,
+  103,
+  114,
+  107,
+  124,
+  104,
+  113,
+  121,
+  111,
+  123,
+  102,
+  125,
+  111,
+  109,
+  122,
+  109,
+  101,
+  106,
+  119,
+  110,
+  110,
+  106,
+  100,
+  120,
+  122,
+  114,
+  112,
+  122,
+  109,
+  121,
+  100,
+  112,
+  119,
+  126,
+  105,
+  124,
+  108,
+  122,
+  108,
+  101,
+  121,
+  119,
+  117,
+  101,
+  100,
+  113,
+  108,
+  125,
+  117,
+  115,
+  101,
+  106,
+  117,
+  108,
+  124,
+  110,
+  124,
+  105,
+  126,
+  119,
+  115,
+  102,
+  114,
+  121,
+  123,
+  116,
+  116,
+  110,
+  109,
+  105,
+  108,
+  103,
+  120,
+  116,
+  102,
+  122,
+  103,
+  104,
+  119,
+  105,
+  127,
+  127,
+  127,
+  122,
+  113,
+  121,
+  119,
+  122,
+  122,
+  118,
+  122,
+  124,
+  107,
+  110,
+  119,
+  111,
+  125,
+  103,
+  121,
+  103,
+  113,
+  127,
+  122,
+  119,
+  121,
+  108,
+  125,
+  118,
+  125,
+  122,
+  120,
+  103,
+  121,
+  108,
+  117,
+  113,
+  105,
+  126,
+  112,
+  112,
+  116,
+  110,
+  119,
+  113,
+  116,
+  101,
+  102,
+  101,
+  124,
+  110,
+  108,
+  105,
+  120,
+  123,
+  113,
+  102,
+  112,
+  115,
+  114,
+  126,
+  110,
+  120,
+  127,
+  103,
+  127,
+  111,
+  124,
+  106,
+  113,
+  109,
+  127,
+  107,
+  119,
+  126,
+  116,
+  113,
+  113,
+  103,
+  107,
+  112,
+  101,
+  113,
+  106,
+  104,
+  124,
+  118,
+  119,
+  124,
+  113,
+  112,
+  124,
+  103,
+  107,
+  121,
+  110,
+  124,
+  105,
+  123,
+  112,
+  114,
+  119,
+  117,
+  126,
+  100,
+  125,
+  105,
+  103,
+  114,
+  113,
+  125,
+  124,
+  103,
+  117,
+  108,
+  117,
+  108,
+  102,
+  103,
+  117,
+  124,
+  108,
+  114,
+  127,
+  110,
+  115,
+  114,
+  124,
+  118,
+  116,
+  107,
+  126,
+  126,
+  110,
+  112,
+  124,
+  106,
+  115,
+  115,
+  113,
+  127,
+  127,
+  107,
+  105,
+  113,
+  102,
+  117,
+  109,
+  104,
+  100,
+  101,
+  116,
+  108,
+  107,
+  110,
+  108,
+  123,
+  124,
+  117,
+  118,
+  109,
+  118,
+  116,
+  102,
+  121,
+  116,
+  105,
+  114,
+  104,
+  124,
+  120,
+  120,
+  109,
+  107,
+  123,
+  122,
+  120,
+  109,
+  100,
+  115,
+  112,
+  126,
+  102,
+  111,
+  108,
+  124,
+  115,
+  100,
+  100,
+  124,
+  123,
+  110,
+  100,
+  117,
+  109,
+  123,
+  113,
+  102,
+  124,
+  123,
+  125,
+  110,
+  112,
+  119,
+  118,
+  116,
+  107,
+  120,
+  113,
+  104,
+  100,
+  109,
+  115,
+  115,
+  117,
+  116,
+  111,
+  119,
+  121,
+  109,
+  111,
+  115,
+  106,
+  126,
+  114,
+  118,
+  118,
+  122,
+  118,
+  108,
+  124,
+  126,
+  102,
+  111,
+  112,
+  123,
+  125,
+  102,
+  100,
+  105,
+  104,
+  113,
+  113,
+  111,
+  112,
+  105,
+  118,
+  101,
+  112,
+  108,
+  127,
+  126,
+  122,
+  104,
+  116,
+  102,
+  100,
+  110,
+  105,
+  114,
+  123,
+  119,
+  122,
+  113,
+  100,
+  104,
+  108,
+  126,
+  106,
+  120,
+  123,
+  115,
+  105,
+  108,
+  121,
+  106,
+  113,
+  106,
+  118,
+  125,
+  113,
+  103,
+  120,
+  113,
+  115,
+  127,
+  103,
+  126,
+  117,
+  103,
+  110,
+  119,
+  111,
+  103,
+  114,
+  111,
+  108,
+  122,
+  104,
+  117,
+  119,
+  101,
+  100,
+  115,
+  103,
+  103,
+  108,
+  123,
+  120,
+  121,
+  119,
+  110,
+  123,
+  102,
+  119,
+  111,
+  102,
+  102,
+  110,
+  111,
+  106,
+  114,
+  122,
+  103,
+  116,
+  101,
+  125,
+  112,
+  125,
+  110,
+  125,
+  112,
+  107,
+  112,
+  123,
+  125,
+  109,
+  117,
+  113,
+  119,
+  100,
+  108,
+  126,
+  114,
+  101,
+  111,
+  106,
+  123,
+  108,
+  101,
+  110,
+  119,
+  115,
+  103,
+  118,
+  115,
+  123,
+  101,
+  114,
+  112,
+  100,
+  116,
+  107,
+  107,
+  111,
+  100,
+  102,
+  102,
+  124,
+  109,
+  114,
+  111,
+  113,
+  119,
+  118,
+  105,
+  118,
+  115,
+  116,
+  112,
+  125,
+  124,
+  125,
+  119,
+  119,
+  111,
+  106,
+  105,
+  121,
+  102,
+  116,
+  114,
+  109,
+  108,
+  104,
+  121,
+  104,
+  100,
+  108,
+  107,
+  125,
+  121,
+  105,
+  105,
+  113,
+  111,
+  122,
+  111,
+  120,
+  109,
+  103,
+  103,
+  119,
+  120,
+  118,
+  109,
+  113,
+  102,
+  107,
+  102,
+  127,
+  109,
+  108,
+  115,
+  123,
+  107,
+  125,
+  122,
+  124,
+  115,
+  124,
+  124,
+  127,
+  104,
+  115,
+  106,
+  123,
+  105,
+  102,
+  105,
+  105,
+  108,
+  105,
+  122,
+  120,
+  124,
+  127,
+  116,
+  125,
+  102,
+  119,
+  126,
+  127,
+  125,
+  120,
+  100,
+  104,
+  127,
+  126,
+  121,
+  122,
+  106,
+  118,
+  123,
+  126,
+  100,
+  107,
+  112,
+  124,
+  117,
+  107,
+  123,
+  125,
+  120,
+  100,
+  126,
+  120,
+  119,
+  102,
+  112,
+  110,
+  107,
+  105,
+  106,
+  118,
+  118,
+  115,
+  100,
+  125,
+  123,
+  123,
+  107,
+  107,
+  108,
+  104,
+  107,
+  124,
+  101,
+  109,
+  101,
+  113,
+  124,
+  110,
+  115,
+  124,
+  109,
+  126,
+  108,
+  116,
+  111,
+  105,
+  106,
+  124,
+  118,
+  110,
+  100,
+  123,
+  113,
+  122,
+  102,
+  113,
+  125,
+  123,
+  118,
+  112,
+  107,
+  106,
+  106,
+  116,
+  122,
+  117,
+  107,
+  115,
+  123,
+  113,
+  126,
+  102,
+  100,
+  127,
+  104,
+  111,
+  112,
+  102,
+  123,
+  105,
+  108,
+  125,
+  100,
+  123,
+  117,
+  116,
+  101,
+  102,
+  124,
+  114,
+  125,
+  106,
+  100,
+  122,
+  125,
+  120,
+  107,
+  107,
+  116,
+  119,
+  115,
+  121,
+  114,
+  101,
+  108,
+  122,
+  119,
+  110,
+  104,
+  109,
+  118,
+  112,
+  115,
+  109,
+  119,
+  123,
+  119,
+  127,
+  110,
+  124,
+  120,
+  103,
+  125,
+  118,
+  124,
+  101,
+  112,
+  105,
+  112,
+  124,
+  107,
+  107,
+  117,
+  111,
+  102,
+  122,
+  109,
+  118,
+  112,
+  115,
+  103,
+  114,
+  116,
+  121,
+  113,
+  113,
+  104,
+  113,
+  127,
+  117,
+  125,
+  103,
+  101,
+  108,
+  105,
+  116,
+  119,
+  125,
+  119,
+  116,
+  120,
+  106,
+  119,
+  121,
+  115,
+  114,
+  109,
+  107,
+  101,
+  113,
+  114,
+  100,
+  104,
+  125,
+  113,
+  121,
+  114,
+  127,
+  126,
+  115,
+  100,
+  106,
+  121,
+  106,
+  118,
+  107,
+  108,
+  104,
+  101,
+  119,
+  105,
+  119,
+  124,
+  108,
+  108,
+  123,
+  109,
+  122,
+  119,
+  127,
+  127,
+  120,
+  126,
+  104,
+  110,
+  115,
+  101,
+  119,
+  121,
+  101,
+  110,
+  115,
+  124,
+  124,
+  115,
+  110,
+  113,
+  125,
+  120,
+  107,
+  103,
+  126,
+  100,
+  104,
+  108,
+  118,
+  118,
+  111,
+  101,
+  104,
+  125,
+  124,
+  127,
+  113,
+  106,
+  116,
+  111,
+  100,
+  110,
+  123,
+  113,
+  100,
+  109,
+  117,
+  103,
+  103,
+  112,
+  116,
+  103,
+  118,
+  106,
+  103,
+  106,
+  115,
+  102,
+  110,
+  109,
+  123,
+  114,
+  120,
+  114,
+  107,
+  100,
+  109,
+  125,
+  105,
+  105,
+  125,
+  115,
+  120,
+  121,
+  115,
+  102,
+  111,
+  126,
+  108,
+  107,
+  124,
+  100,
+  102,
+  102,
+  112,
+  114,
+  101,
+  104,
+  104,
+  100,
+  114,
+  103,
+  104,
+  123,
+  102,
+  103,
+  106,
+  115,
+  106,
+  115,
+  119,
+  100,
+  101,
+  106,
+  126,
+  101,
+  127,
+  122,
+  107,
+  124,
+  125,
+  107,
+  108,
+  106,
+  104,
+  102,
+  113,
+  121,
+  121,
+  106,
+  126,
+  122,
+  106,
+  102,
+  108,
+  120,
+  121,
+  121,
+  113,
+  103,
+  122,
+  100,
+  121,
+  111,
+  110,
+  103,
+  126,
+  101,
+  104,
+  112,
+  102,
+  118,
+  108,
+  107,
+  113,
+  122,
+  117,
+  113,
+  117,
+  104,
+  120,
+  113,
+  107,
+  126,
+  107,
+  111,
+  103,
+  104,
+  112,
+  124,
+  105,
+  117,
+  109,
+  122,
+  124,
+  123,
+  106,
+  126,
+  126,
+  125,
+  120,
+  103,
+  103,
+  121,
+  103,
+  100,
+  121,
+  116,
+  117,
+  112,
+  113,
+  108,
+  120,
+  111,
+  121,
+  119,
+  110,
+  117,
+  112,
+  106,
+  124,
+  114,
+  106,
+  100,
+  117,
+  101,
+  107,
+  104,
+  113,
+  110,
+  125,
+  116,
+  103,
+  117,
+  106,
+  115,
+  114,
+  126,
+  121,
+  121,
+  120,
+  121,
+  116,
+  119,
+  119,
+  111,
+  105,
+  126,
+  103,
+  113,
+  108,
+  110,
+  110,
+  118,
+  107,
+  106,
+  111,
+  119,
+  111,
+  126,
+  116,
+  115,
+  104,
+  126,
+  121,
+  104,
+  104,
+  115,
+  112,
+  104,
+  124,
+  114,
+  119,
+  110,
+  125,
+  109,
+  110,
+  114,
+  102,
+  105,
+  124,
+  120,
+  120,
+  103,
+  126,
+  118,
+  101,
+  115,
+  120,
+  107,
+  101,
+  116,
+  119,
+  120,
+  115,
+  108,
+  116,
+  103,
+  122,
+  102,
+  103,
+  104,
+  115,
+  100,
+  115,
+  104,
+  122,
+  114,
+  124,
+  108,
+  117,
+  120,
+  114,
+  101,
+  124,
+  101,
+  124,
+  123,
+  122,
+  104,
+  118,
+  122,
+  121,
+  115,
+  117,
+  119,
+  125,
+  114,
+  119,
+  105,
+  105,
+  115,
+  101,
+  109,
+  112,
+  108,
+  102,
+  105,
+  106,
+  103,
+  127,
+  108,
+  125,
+  121,
+  124,
+  124,
+  123,
+  113,
+  111,
+  116,
+  122,
+  118,
+  119,
+  105,
+  122,
+  123,
+  109,
+  108,
+  124,
+  114,
+  116,
+  116,
+  113,
+  112,
+  121,
+  100,
+  115,
+  103,
+  121,
+  115,
+  105,
+  122,
+  107,
+  115,
+  118,
+  116,
+  104,
+  108,
+  103,
+  115,
+  121,
+  100,
+  112,
+  107,
+  123,
+  103,
+  126,
+  127,
+  103,
+  112,
+  103,
+  111,
+  109,
+  102,
+  102,
+  117,
+  124,
+  103,
+  102,
+  111,
+  107,
+  119,
+  103,
+  127,
+  114,
+  115,
+  116,
+  113,
+  115,
+  110,
+  107,
+  123,
+  111,
+  124,
+  111,
+  125,
+  117,
+  126,
+  102,
+  115,
+  127,
+  115,
+  119,
+  111,
+  100,
+  109,
+  121,
+  101,
+  120,
+  120,
+  104,
+  111,
+  104,
+  127,
+  115,
+  126,
+  102,
+  121,
+  119,
+  126,
+  124,
+  101,
+  116,
+  110,
+  118,
+  101,
+  126,
+  121,
+  126,
+  102,
+  116,
+  126,
+  108,
+  127,
+  127,
+  102,
+  104,
+  117,
+  100,
+  106,
+  116,
+  120,
+  104,
+  122,
+  127,
+  113,
+  121,
+  105,
+  103,
+  122,
+  120,
+  109,
+  102,
+  102,
+  101,
+  110,
+  110,
+  103,
+  115,
+  127,
+  116,
+  106,
+  120,
+  114,
+  107,
+  102,
+  105,
+  114,
+  123,
+  108,
+  118,
+  122,
+  118,
+  106,
+  112,
+  105,
+  117,
+  127,
+  109,
+  106,
+  105,
+  105,
+  121,
+  115,
+  111,
+  108,
+  123,
+  119,
+  122,
+  108,
+  100,
+  112,
+  104,
+  127,
+  119,
+  114,
+  105,
+  127,
+  105,
+  115,
+  112,
+  104,
+  123,
+  114,
+  101,
+  111,
+  124,
+  120,
+  100,
+  124,
+  102,
+  106,
+  114,
+  117,
+  112,
+  103,
+  124,
+  121,
+  119,
+  107,
+  102,
+  107,
+  100,
+  115,
+  104,
+  123,
+  101,
+  122,
+  105,
+  102,
+  111,
+  102,
+  124,
+  106,
+  117,
+  120,
+  101,
+  127,
+  112,
+  108,
+  125,
+  120,
+  103,
+  115,
+  113,
+  100,
+  112,
+  124,
+  102,
+  117,
+  115,
+  124,
+  118,
+  115,
+  102,
+  107,
+  114,
+  126,
+  124,
+  114,
+  105,
+  106,
+  125,
+  109,
+  109,
+  105,
+  117,
+  105,
+  118,
+  117,
+  107,
+  111,
+  113,
+  116,
+  102,
+  101,
+  115,
+  101,
+  127,
+  111,
+  111,
+  111,
+  101,
+  114,
+  117,
+  104,
+  111,
+  125,
+  109,
+  115,
+  100,
+  103,
+  125,
+  121,
+  125,
+  124,
+  123,
+  103,
+  119,
+  108,
+  124,
+  106,
+  113,
+  114,
+  102,
+  116,
+  106,
+  127,
+  126,
+  121,
+  107,
+  124,
+  105,
+  102,
+  118,
+  118,
+  104,
+  114,
+  127,
+  120,
+  102,
+  112,
+  123,
+  119,
+  125,
+  123,
+  101,
+  120,
+  104,
+  107,
+  106,
+  111,
+  119,
+  104,
+  108,
+  104,
+  116,
+  103,
+  113,
+  111,
+  114,
+  102,
+  112,
+  114,
+  103,
+  125,
+  103,
+  108,
+  115,
+  110,
+  102,
+  124,
+  125,
+  112,
+  117,
+  117,
+  101,
+  108,
+  122,
+  124,
+  109,
+  124,
+  120,
+  101,
+  111,
+  126,
+  106,
+  113,
+  102,
+  120,
+  117,
+  119,
+  120,
+  123,
+  105,
+  115,
+  116,
+  125,
+  103,
+  108,
+  113,
+  102,
+  112,
+  125,
+  125,
+  113,
+  119,
+  110,
+  125,
+  109,
+  103,
+  105,
+  122,
+  123,
+  114,
+  107,
+  103,
+  119,
+  119,
+  116,
+  112,
+  112,
+  120,
+  126,
+  109,
+  121,
+  118,
+  120,
+  122,
+  122,
+  112,
+  122,
+  119,
+  120,
+  127,
+  123,
+  100,
+  113,
+  124,
+  127,
+  114,
+  108,
+  120,
+  100,
+  118,
+  126,
+  125,
+  106,
+  124,
+  104,
+  105,
+  127,
+  117,
+  105,
+  103,
+  104,
+  119,
+  103,
+  127,
+  123,
+  111,
+  120,
+  111,
+  120,
+  120,
+  102,
+  113,
+  123,
+  109,
+  103,
+  103,
+  111,
+  105,
+  126,
+  113,
+  103,
+  127,
+  111,
+  120,
+  121,
+  113,
+  108,
+  121,
+  124,
+  109,
+  125,
+  123,
+  118,
+  102,
+  117,
+  104,
+  126,
+  112,
+  108,
+  101,
+  126,
+  119,
+  111,
+  107,
+  115,
+  114,
+  111,
+  102,
+  114,
+  123,
+  109,
+  119,
+  101,
+  108,
+  110,
+  127,
+  106,
+  107,
+  102,
+  126,
+  114,
+  126,
+  127,
+  116,
+  120,
+  113,
+  103,
+  125,
+  113,
+  106,
+  106,
+  122,
+  121,
+  124,
+  108,
+  118,
+  117,
+  126,
+  127,
+  113,
+  112,
+  123,
+  114,
+  122,
+  100,
+  113,
+  114,
+  115,
+  116,
+  125,
+  101,
+  118,
+  100,
+  122,
+  100,
+  122,
+  115,
+  117,
+  108,
+  115,
+  127,
+  104,
+  116,
+  126,
+  124,
+  123,
+  107,
+  117,
+  117,
+  124,
+  115,
+  124,
+  103,
+  104,
+  116,
+  111,
+  120,
+  125,
+  110,
+  121,
+  117,
+  112,
+  121,
+  110,
+  109,
+  108,
+  123,
+  114,
+  117,
+  107,
+  106,
+  110,
+  119,
+  126,
+  124,
+  100,
+  121,
+  118,
+  115,
+  125,
+  107,
+  118,
+  120,
+  103,
+  114,
+  106,
+  127,
+  109,
+  113,
+  122,
+  123,
+  109,
+  113,
+  112,
+  114,
+  116,
+  110,
+  114,
+  125,
+  115,
+  110,
+  106,
+  104,
+  123,
+  103,
+  112,
+  116,
+  110,
+  106,
+  103,
+  113,
+  122,
+  103,
+  109,
+  108,
+  100,
+  104,
+  118,
+  114,
+  108,
+  120,
+  119,
+  112,
+  101,
+  120,
+  118,
+  127,
+  108,
+  120,
+  109,
+  105,
+  107,
+  127,
+  102,
+  119,
+  115,
+  112,
+  101,
+  113,
+  123,
+  124,
+  119,
+  101,
+  103,
+  120,
+  108,
+  102,
+  106,
+  125,
+  124,
+  123,
+  105,
+  107,
+  120,
+  108,
+  126,
+  122,
+  123,
+  115,
+  102,
+  113,
+  125,
+  111,
+  104,
+  108,
+  109,
+  102,
+  126,
+  119,
+  111,
+  114,
+  126,
+  126,
+  111,
+  124,
+  122,
+  118,
+  125,
+  118,
+  114,
+  116,
+  127,
+  107,
+  127,
+  107,
+  105,
+  115,
+  118,
+  103,
+  113,
+  118,
+  106,
+  109,
+  119,
+  110,
+  119,
+  108,
+  117,
+  105,
+  101,
+  108,
+  106,
+  102,
+  111,
+  127,
+  117,
+  114,
+  121,
+  112,
+  100,
+  110,
+  110,
+  114,
+  122,
+  109,
+  107,
+  121,
+  104,
+  126,
+  103,
+  107,
+  105,
+  110,
+  119,
+  112,
+  117,
+  107,
+  113,
+  119,
+  125,
+  111,
+  112,
+  123,
+  104,
+  117,
+  124,
+  102,
+  116,
+  102,
+  105,
+  127,
+  113,
+  115,
+  100,
+  115,
+  109,
+  119,
+  113,
+  118,
+  112,
+  107,
+  106,
+  100,
+  102,
+  125,
+  107,
+  106,
+  115,
+  123,
+  101,
+  104,
+  102,
+  123,
+  105,
+  104,
+  114,
+  104,
+  103,
+  122,
+  124,
+  124,
+  120,
+  109,
+  101,
+  116,
+  118,
+  108,
+  122,
+  106,
+  101,
+  112,
+  101,
+  108,
+  123,
+  119,
+  118,
+  112,
+  120,
+  116,
+  112,
+  118,
+  108,
+  112,
+  101,
+  118,
+  100,
+  112,
+  124,
+  113,
+  110,
+  104,
+  104,
+  100,
+  120,
+  100,
+  126,
+  110,
+  111,
+  116,
+  124,
+  110,
+  111,
+  103,
+  121,
+  126,
+  107,
+  120,
+  100,
+  117,
+  122,
+  109,
+  127,
+  110,
+  108,
+  111,
+  125,
+  114,
+  114,
+  107,
+  122,
+  103,
+  122,
+  122,
+  103,
+  102,
+  126,
+  126,
+  121,
+  102,
+  124,
+  112,
+  121,
+  121,
+  108,
+  112,
+  120,
+  103,
+  115,
+  102,
+  113,
+  121,
+  106,
+  104,
+  107,
+  101,
+  125,
+  126,
+  111,
+  113,
+  113,
+  120,
+  122,
+  125,
+  106,
+  124,
+  110,
+  127,
+  113,
+  112,
+  105,
+  122,
+  102,
+  126,
+  123,
+  102,
+  114,
+  105,
+  125,
+  105,
+  120,
+  115,
+  113,
+  117,
+  103,
+  107,
+  113,
+  126,
+  121,
+  120,
+  120,
+  121,
+  109,
+  107,
+  106,
+  122,
+  106,
+  114,
+  124,
+  107,
+  120,
+  123,
+  109,
+  111,
+  109,
+  119,
+  102,
+  103,
+  104,
+  119,
+  118,
+  106,
+  103,
+  103,
+  126,
+  109,
+  104,
+  100,
+  101,
+  106,
+  127,
+  114,
+  114,
+  118,
+  120,
+  125,
+  100,
+  112,
+  107,
+  124,
+  124,
+  110,
+  112,
+  104,
+  108,
+  115,
+  103,
+  123,
+  102,
+  127,
+  110,
+  118,
+  127,
+  117,
+  113,
+  114,
+  114,
+  108,
+  110,
+  123,
+  102,
+  126,
+  123,
+  111,
+  116,
+  100,
+  124,
+  107,
+  117,
+  120,
+  116,
+  115,
+  100,
+  123,
+  102,
+  115,
+  116,
+  117,
+  112,
+  103,
+  126,
+  116,
+  108,
+  113,
+  122,
+  111,
+  117,
+  119,
+  114,
+  127,
+  116,
+  102,
+  108,
+  108,
+  123,
+  112,
+  114,
+  115,
+  107,
+  125,
+  107,
+  100,
+  116,
+  103,
+  106,
+  101,
+  100,
+  113,
+  121,
+  112,
+  107,
+  124,
+  124,
+  103,
+  121,
+  127,
+  104,
+  122,
+  103,
+  101,
+  104,
+  102,
+  109,
+  113,
+  114,
+  104,
+  107,
+  118,
+  127,
+  111,
+  110,
+  125,
+  111,
+  113,
+  105,
+  106,
+  111,
+  103,
+  104,
+  126,
+  111,
+  120,
+  112,
+  110,
+  118,
+  104,
+  118,
+  121,
+  117,
+  118,
+  126,
+  111,
+  113,
+  114,
+  123,
+  122,
+  117,
+  122,
+  102,
+  116,
+  103,
+  121,
+  101,
+  122,
+  119,
+  102,
+  122,
+  103,
+  102,
+  103,
+  117,
+  104,
+  123,
+  106,
+  117,
+  104,
+  117,
+  123,
+  113,
+  116,
+  126,
+  126,
+  121,
+  122,
+  110,
+  109,
+  122,
+  107,
+  100,
+  104,
+  102,
+  115,
+  107,
+  112,
+  124,
+  121,
+  122,
+  113,
+  123,
+  119,
+  125,
+  126,
+  119,
+  119,
+  110,
+  112,
+  117,
+  120,
+  115,
+  116,
+  109,
+  120,
+  104,
+  115,
+  127,
+  124,
+  121,
+  112,
+  111,
+  107,
+  102,
+  115,
+  110,
+  127,
+  120,
+  111,
+  106,
+  114,
+  100,
+  126,
+  113,
+  116,
+  111,
+  112,
+  106,
+  104,
+  108,
+  112,
+  126,
+  119,
+  125,
+  104,
+  113,
+  106,
+  119,
+  123,
+  115,
+  117,
+  103,
+  103,
+  118,
+  111,
+  108,
+  106,
+  101,
+  117,
+  123,
+  101,
+  108,
+  104,
+  127,
+  122,
+  118,
+  116,
+  114,
+  125,
+  117,
+  127,
+  108,
+  114,
+  122,
+  102,
+  125,
+  127,
+  104,
+  125,
+  120,
+  126,
+  111,
+  118,
+  104,
+  112,
+  125,
+  100,
+  125,
+  127,
+  114,
+  111,
+  123,
+  118,
+  111,
+  125,
+  109,
+  117,
+  119,
+  119,
+  114,
+  102,
+  126,
+  116,
+  113,
+  111,
+  125,
+  104,
+  112,
+  125,
+  115,
+  111,
+  108,
+  124,
+  123,
+  111,
+  122,
+  121,
+  122,
+  100,
+  103,
+  125,
+  108,
+  103,
+  126,
+  115,
+  100,
+  126,
+  113,
+  108,
+  127,
+  114,
+  100,
+  114,
+  107,
+  121,
+  117,
+  126,
+  111,
+  104,
+  105,
+  117,
+  107,
+  107,
+  122,
+  117,
+  126,
+  100,
+  123,
+  125,
+  108,
+  105,
+  107,
+  116,
+  111,
+  116,
+  102,
+  103,
+  116,
+  100,
+  100,
+  121,
+  107,
+  120,
+  117,
+  120,
+  102,
+  122,
+  104,
+  118,
+  125,
+  123,
+  115,
+  103,
+  123,
+  126,
+  106,
+  100,
+  123,
+  115,
+  110,
+  118,
+  124,
+  104,
+  108,
+  116,
+  116,
+  111,
+  110,
+  122,
+  124,
+  108,
+  110,
+  121,
+  111,
+  101,
+  115,
+  102,
+  104,
+  117,
+  122,
+  110,
+  126,
+  127,
+  101,
+  104,
+  100,
+  111,
+  103,
+  124,
+  127,
+  116,
+  102,
+  127,
+  115,
+  108,
+  101,
+  112,
+  120,
+  109,
+  123,
+  103,
+  100,
+  117,
+  113,
+  125,
+  123,
+  113,
+  110,
+  111,
+  103,
+  109,
+  109,
+  115,
+  126,
+  116,
+  120,
+  101,
+  117,
+  108,
+  121,
+  100,
+  100,
+  125,
+  114,
+  123,
+  121,
+  124,
+  126,
+  117,
+  125,
+  104,
+  102,
+  125,
+  100,
+  122,
+  102,
+  120,
+  109,
+  113,
+  102,
+  117,
+  114,
+  110,
+  121,
+  123,
+  114,
+  102,
+  118,
+  127,
+  100,
+  102,
+  107,
+  105,
+  111,
+  119,
+  111,
+  123,
+  107,
+  126,
+  116,
+  116,
+  113,
+  105,
+  101,
+  113,
+  116,
+  108,
+  108,
+  117,
+  101,
+  101,
+  126,
+  127,
+  117,
+  125,
+  101,
+  106,
+  122,
+  104,
+  108,
+  118,
+  103,
+  106,
+  100,
+  109,
+  112,
+  104,
+  125,
+  101,
+  127,
+  100,
+  104,
+  113,
+  106,
+  102,
+  108,
+  113,
+  102,
+  115,
+  127,
+  115,
+  124,
+  122,
+  113,
+  109,
+  125,
+  111,
+  104,
+  109,
+  124,
+  100,
+  127,
+  106,
+  112,
+  113,
+  111,
+  117,
+  106,
+  114,
+  117,
+  110,
+  112,
+  111,
+  102,
+  103,
+  109,
+  108,
+  110,
+  104,
+  123,
+  101,
+  117,
+  104,
+  126,
+  105,
+  121,
+  107,
+  102,
+  105,
+  107,
+  100,
+  120,
+  124,
+  113,
+  121,
+  113,
+  100,
+  112,
+  122,
+  124,
+  116,
+  114,
+  104,
+  126,
+  100,
+  105,
+  104,
+  108,
+  110,
+  123,
+  123,
+  113,
+  103,
+  111,
+  100,
+  101,
+  106,
+  126,
+  123,
+  112,
+  120,
+  112,
+  124,
+  119,
+  122,
+  126,
+  105,
+  114,
+  119,
+  105,
+  106,
+  102,
+  125,
+  101,
+  105,
+  107,
+  120,
+  104,
+  124,
+  106,
+  118,
+  123,
+  112,
+  122,
+  103,
+  119,
+  102,
+  108,
+  122,
+  101,
+  109,
+  123,
+  118,
+  120,
+  111,
+  110,
+  127,
+  126,
+  123,
+  113,
+  106,
+  112,
+  122,
+  119,
+  125,
+  111,
+  110,
+  123,
+  119,
+  117,
+  115,
+  118,
+  124,
+  104,
+  107,
+  110,
+  108,
+  126,
+  116,
+  104,
+  123,
+  100,
+  110,
+  122,
+  107,
+  106,
+  118,
+  116,
+  109,
+  118,
+  119,
+  104,
+  109,
+  105,
+  114,
+  121,
+  119,
+  126,
+  109,
+  123,
+  113,
+  125,
+  127,
+  101,
+  109,
+  105,
+  124,
+  101,
+  113,
+  101,
+  114,
+  125,
+  104,
+  122,
+  121,
+  102,
+  118,
+  124,
+  110,
+  112,
+  125
+};
@@ -0,0 +1,446 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#include <stdint.h>
+
+const q7_t pad_hw_output_ref[420] =
+{
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  34,
+  -34,
+  -23,
+  -47,
+  102,
+  -93,
+  -37,
+  -60,
+  -117,
+  52,
+  -49,
+  -51,
+  101,
+  -85,
+  -97,
+  51,
+  -43,
+  91,
+  53,
+  -43,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  7,
+  -39,
+  73,
+  79,
+  -65,
+  22,
+  4,
+  20,
+  -32,
+  -43,
+  -25,
+  123,
+  -99,
+  115,
+  17,
+  72,
+  34,
+  43,
+  -63,
+  42,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  27,
+  -78,
+  -75,
+  89,
+  -56,
+  -119,
+  86,
+  123,
+  -39,
+  -37,
+  -107,
+  -8,
+  33,
+  53,
+  120,
+  10,
+  -59,
+  19,
+  -72,
+  58,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  62,
+  -65,
+  107,
+  -57,
+  24,
+  111,
+  -64,
+  -21,
+  -12,
+  37,
+  69,
+  -128,
+  65,
+  -119,
+  121,
+  -7,
+  -73,
+  82,
+  27,
+  -13,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -37,
+  18,
+  -36,
+  -69,
+  -55,
+  -79,
+  -116,
+  77,
+  -36,
+  72,
+  -32,
+  58,
+  64,
+  -90,
+  15,
+  34,
+  91,
+  -115,
+  68,
+  104,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -124,
+  27,
+  29,
+  -5,
+  -99,
+  106,
+  119,
+  -61,
+  59,
+  54,
+  -54,
+  -71,
+  -113,
+  -42,
+  -61,
+  -93,
+  -19,
+  -9,
+  -85,
+  -39,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7,
+  -7
+};
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#define PAD_NHWC_INPUT_BATCHES 1
+#define PAD_NHWC_INPUT_H 2
+#define PAD_NHWC_INPUT_W 3
+#define PAD_NHWC_IN_CH 6
+#define PAD_NHWC_OUTPUT_BATCHES 3
+#define PAD_NHWC_OUTPUT_H 3
+#define PAD_NHWC_OUTPUT_W 4
+#define PAD_NHWC_OUT_CH 11
+#define PAD_NHWC_DST_SIZE 396
+#define PAD_NHWC_PAD_BEFORE_N 1
+#define PAD_NHWC_PAD_BEFORE_H 0
+#define PAD_NHWC_PAD_BEFORE_W 1
+#define PAD_NHWC_PAD_BEFORE_C 2
+#define PAD_NHWC_PAD_AFTER_N 1
+#define PAD_NHWC_PAD_AFTER_H 1
+#define PAD_NHWC_PAD_AFTER_W 0
+#define PAD_NHWC_PAD_AFTER_C 3
+#define PAD_NHWC_PAD_VALUE 5
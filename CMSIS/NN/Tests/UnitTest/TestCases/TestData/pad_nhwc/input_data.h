@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#include <stdint.h>
+
+const q7_t pad_nhwc_input[36] =
+{
+  125,
+  -125,
+  -44,
+  -64,
+  -126,
+  -50,
+  -34,
+  70,
+  33,
+  113,
+  -113,
+  89,
+  75,
+  -80,
+  3,
+  121,
+  13,
+  -33,
+  -73,
+  -123,
+  1,
+  -61,
+  2,
+  58,
+  -83,
+  3,
+  -13,
+  -115,
+  50,
+  127,
+  33,
+  57,
+  63,
+  18,
+  91,
+  76
+};
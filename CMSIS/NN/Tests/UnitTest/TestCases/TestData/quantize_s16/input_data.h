@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const float quantize_s16_input[29] =
+{
+  -1.872999954e+01f,
+  1.543000031e+01f,
+  1.603899994e+02f,
+  -9.398000336e+01f,
+  8.143000031e+01f,
+  2.262999916e+01f,
+  -7.387000275e+01f,
+  -1.461999989e+01f,
+  -1.683699951e+02f,
+  3.677999878e+01f,
+  1.366100006e+02f,
+  1.254499969e+02f,
+  -1.288000031e+02f,
+  1.709900055e+02f,
+  -1.685700073e+02f,
+  1.246800003e+02f,
+  -9.319000244e+01f,
+  -1.508399963e+02f,
+  -1.445500031e+02f,
+  -1.685299988e+02f,
+  -1.874400024e+02f,
+  1.200699997e+02f,
+  -1.250299988e+02f,
+  -7.151000214e+01f,
+  1.813099976e+02f,
+  5.925999832e+01f,
+  6.908999634e+01f,
+  -4.565000153e+01f,
+  1.340000000e+02f
+};
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q15_t quantize_s16_output_ref[29] =
+{
+  -4795,
+  3950,
+  32767,
+  -24059,
+  20846,
+  5793,
+  -18911,
+  -3743,
+  -32768,
+  9416,
+  32767,
+  32115,
+  -32768,
+  32767,
+  -32768,
+  31918,
+  -23857,
+  -32768,
+  -32768,
+  -32768,
+  -32768,
+  30738,
+  -32008,
+  -18307,
+  32767,
+  15171,
+  17687,
+  -11686,
+  32767
+};
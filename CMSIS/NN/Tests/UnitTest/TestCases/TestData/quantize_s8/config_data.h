@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define QUANTIZE_S8_DST_SIZE 37
+#define QUANTIZE_S8_CHANNELS 1
+#define QUANTIZE_S8_INPUT_OFFSET 0
+#define QUANTIZE_S8_OUTPUT_OFFSET -5
+#define QUANTIZE_S8_OUTPUT_SCALE 5.000000000e-01f
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const float quantize_s8_input[37] =
+{
+  3.729000092e+01f,
+  -1.122999954e+01f,
+  4.415000153e+01f,
+  4.575000000e+01f,
+  -2.040999985e+01f,
+  7.577999878e+01f,
+  -7.972000122e+01f,
+  -5.004000092e+01f,
+  -7.330000305e+01f,
+  -6.619999695e+01f,
+  -3.999999911e-02f,
+  -1.887000084e+01f,
+  -3.125000000e+01f,
+  -9.050000191e+00f,
+  -7.055999756e+01f,
+  4.725999832e+01f,
+  3.450000048e+00f,
+  3.836000061e+01f,
+  7.070000172e+00f,
+  -3.875999832e+01f,
+  4.952000046e+01f,
+  -5.486999893e+01f,
+  4.933000183e+01f,
+  -6.254999924e+01f,
+  2.542000008e+01f,
+  7.640000153e+01f,
+  -4.709000015e+01f,
+  -1.644000053e+01f,
+  -3.181999969e+01f,
+  -5.209999847e+01f,
+  2.344000053e+01f,
+  8.850000381e+00f,
+  7.458000183e+01f,
+  -7.533000183e+01f,
+  1.972999954e+01f,
+  7.044999695e+01f,
+  -1.639999962e+01f
+};
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t quantize_s8_output_ref[37] =
+{
+  70,
+  -27,
+  83,
+  87,
+  -46,
+  127,
+  -128,
+  -105,
+  -128,
+  -128,
+  -5,
+  -43,
+  -68,
+  -23,
+  -128,
+  90,
+  2,
+  72,
+  9,
+  -83,
+  94,
+  -115,
+  94,
+  -128,
+  46,
+  127,
+  -99,
+  -38,
+  -69,
+  -109,
+  42,
+  13,
+  127,
+  -128,
+  34,
+  127,
+  -38
+};
@@ -0,0 +1,782 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t reduce_sum_hw_input[756] =
+{
+  -49,
+  -24,
+  -104,
+  121,
+  63,
+  70,
+  93,
+  -14,
+  1,
+  -48,
+  -40,
+  -47,
+  88,
+  56,
+  -112,
+  -116,
+  -99,
+  -103,
+  -128,
+  -98,
+  40,
+  -48,
+  -52,
+  -125,
+  127,
+  25,
+  84,
+  17,
+  28,
+  -112,
+  -117,
+  13,
+  110,
+  10,
+  -26,
+  -33,
+  -96,
+  -125,
+  -112,
+  -106,
+  95,
+  -32,
+  -14,
+  48,
+  83,
+  -26,
+  -93,
+  44,
+  29,
+  98,
+  76,
+  88,
+  -15,
+  106,
+  19,
+  102,
+  -103,
+  44,
+  64,
+  -65,
+  26,
+  26,
+  -65,
+  -75,
+  -23,
+  6,
+  65,
+  -48,
+  -10,
+  87,
+  8,
+  39,
+  -90,
+  -63,
+  33,
+  -98,
+  -73,
+  37,
+  56,
+  -46,
+  79,
+  122,
+  -107,
+  -98,
+  -92,
+  -112,
+  101,
+  -34,
+  -71,
+  -81,
+  -98,
+  68,
+  -95,
+  108,
+  -3,
+  8,
+  115,
+  -38,
+  53,
+  -16,
+  -73,
+  73,
+  -37,
+  -39,
+  -64,
+  -127,
+  -51,
+  -16,
+  -71,
+  8,
+  3,
+  95,
+  -116,
+  -123,
+  -73,
+  -118,
+  90,
+  -111,
+  -117,
+  91,
+  -90,
+  -127,
+  -108,
+  -1,
+  -105,
+  5,
+  -126,
+  113,
+  -72,
+  92,
+  28,
+  42,
+  -6,
+  -66,
+  -9,
+  -6,
+  -98,
+  79,
+  -73,
+  35,
+  -110,
+  13,
+  -15,
+  -37,
+  26,
+  -59,
+  41,
+  -80,
+  36,
+  -97,
+  4,
+  46,
+  -13,
+  -117,
+  111,
+  -79,
+  36,
+  15,
+  97,
+  10,
+  0,
+  12,
+  -104,
+  44,
+  -85,
+  -32,
+  -95,
+  122,
+  -22,
+  95,
+  -79,
+  96,
+  33,
+  -70,
+  -119,
+  49,
+  67,
+  -36,
+  12,
+  -43,
+  69,
+  92,
+  -97,
+  66,
+  -54,
+  -24,
+  104,
+  -19,
+  100,
+  75,
+  110,
+  -77,
+  -106,
+  -58,
+  19,
+  -92,
+  8,
+  89,
+  -108,
+  -93,
+  27,
+  91,
+  -114,
+  -2,
+  45,
+  -101,
+  118,
+  10,
+  103,
+  48,
+  -79,
+  -70,
+  -56,
+  14,
+  -24,
+  59,
+  -25,
+  6,
+  -6,
+  -13,
+  -78,
+  20,
+  -7,
+  45,
+  -117,
+  -75,
+  35,
+  -43,
+  -83,
+  43,
+  -27,
+  108,
+  -104,
+  19,
+  30,
+  -5,
+  42,
+  16,
+  -33,
+  33,
+  73,
+  11,
+  8,
+  -76,
+  -68,
+  99,
+  -83,
+  -78,
+  -28,
+  -66,
+  62,
+  -64,
+  -88,
+  112,
+  -72,
+  -117,
+  -35,
+  -39,
+  -37,
+  112,
+  -85,
+  -71,
+  9,
+  -54,
+  110,
+  83,
+  0,
+  58,
+  -94,
+  34,
+  116,
+  -121,
+  -128,
+  69,
+  69,
+  72,
+  23,
+  -125,
+  75,
+  122,
+  -87,
+  42,
+  25,
+  85,
+  98,
+  36,
+  44,
+  123,
+  12,
+  -55,
+  126,
+  0,
+  -86,
+  -55,
+  73,
+  117,
+  -101,
+  -29,
+  73,
+  102,
+  -85,
+  -95,
+  92,
+  113,
+  -127,
+  -100,
+  -89,
+  32,
+  -85,
+  -8,
+  54,
+  14,
+  -106,
+  99,
+  72,
+  53,
+  24,
+  15,
+  50,
+  -47,
+  -14,
+  -2,
+  53,
+  34,
+  -125,
+  -26,
+  -70,
+  -60,
+  -23,
+  32,
+  30,
+  76,
+  9,
+  43,
+  -9,
+  63,
+  -104,
+  5,
+  54,
+  -76,
+  -12,
+  35,
+  104,
+  57,
+  -8,
+  122,
+  56,
+  97,
+  -36,
+  -126,
+  -115,
+  -128,
+  -1,
+  -30,
+  -90,
+  -48,
+  18,
+  31,
+  -59,
+  94,
+  19,
+  -42,
+  -38,
+  -16,
+  -50,
+  70,
+  105,
+  19,
+  108,
+  -5,
+  69,
+  -85,
+  111,
+  119,
+  -54,
+  38,
+  6,
+  -77,
+  -96,
+  25,
+  -71,
+  123,
+  -61,
+  -78,
+  -66,
+  62,
+  -59,
+  -14,
+  -104,
+  116,
+  -36,
+  -81,
+  21,
+  -24,
+  -87,
+  109,
+  121,
+  0,
+  108,
+  54,
+  96,
+  71,
+  -69,
+  -1,
+  -20,
+  -107,
+  -98,
+  -65,
+  64,
+  -117,
+  -87,
+  -56,
+  -69,
+  -43,
+  -11,
+  -118,
+  -49,
+  57,
+  -113,
+  -15,
+  -11,
+  121,
+  59,
+  -128,
+  78,
+  111,
+  50,
+  -95,
+  89,
+  -113,
+  -88,
+  96,
+  63,
+  -86,
+  -47,
+  66,
+  83,
+  29,
+  -49,
+  -6,
+  -41,
+  20,
+  -96,
+  79,
+  76,
+  4,
+  -85,
+  -126,
+  -57,
+  6,
+  -15,
+  -102,
+  -67,
+  -23,
+  -96,
+  -116,
+  30,
+  25,
+  110,
+  -65,
+  32,
+  97,
+  51,
+  -109,
+  -59,
+  -54,
+  7,
+  -42,
+  126,
+  -23,
+  107,
+  -15,
+  -89,
+  -119,
+  -82,
+  88,
+  103,
+  121,
+  -4,
+  -120,
+  -41,
+  -69,
+  117,
+  22,
+  -48,
+  -64,
+  15,
+  11,
+  52,
+  104,
+  -66,
+  -100,
+  -71,
+  -128,
+  -64,
+  82,
+  126,
+  -116,
+  55,
+  121,
+  125,
+  -47,
+  -60,
+  -100,
+  27,
+  -107,
+  -56,
+  -23,
+  -17,
+  -12,
+  12,
+  34,
+  74,
+  -59,
+  -69,
+  86,
+  -14,
+  101,
+  77,
+  -73,
+  -49,
+  82,
+  -72,
+  122,
+  80,
+  14,
+  -70,
+  -55,
+  -16,
+  -23,
+  -21,
+  1,
+  74,
+  -25,
+  111,
+  122,
+  -11,
+  105,
+  17,
+  -54,
+  -124,
+  22,
+  57,
+  -46,
+  5,
+  47,
+  11,
+  116,
+  26,
+  -26,
+  -70,
+  -6,
+  -71,
+  12,
+  11,
+  -44,
+  -90,
+  -46,
+  -117,
+  96,
+  -127,
+  57,
+  102,
+  38,
+  -42,
+  54,
+  112,
+  -122,
+  21,
+  120,
+  -123,
+  10,
+  -54,
+  79,
+  125,
+  59,
+  95,
+  -121,
+  26,
+  -30,
+  -40,
+  76,
+  -22,
+  127,
+  -104,
+  -127,
+  -93,
+  -111,
+  -55,
+  -66,
+  108,
+  -126,
+  -14,
+  -126,
+  66,
+  59,
+  14,
+  -120,
+  119,
+  -37,
+  -17,
+  28,
+  -6,
+  12,
+  -25,
+  25,
+  107,
+  -2,
+  90,
+  44,
+  -28,
+  -54,
+  64,
+  -113,
+  -58,
+  16,
+  -24,
+  -115,
+  -38,
+  -68,
+  75,
+  50,
+  -114,
+  -101,
+  52,
+  -85,
+  -72,
+  -14,
+  8,
+  -30,
+  -124,
+  -94,
+  -93,
+  -18,
+  -124,
+  -80,
+  -114,
+  110,
+  114,
+  36,
+  -112,
+  -87,
+  -90,
+  7,
+  -96,
+  26,
+  73,
+  -21,
+  -97,
+  17,
+  77,
+  31,
+  110,
+  -109,
+  51,
+  43,
+  85,
+  0,
+  81,
+  -45,
+  -87,
+  42,
+  52,
+  3,
+  -106,
+  -126,
+  -26,
+  -109,
+  -31,
+  95,
+  79,
+  -100,
+  57,
+  -26,
+  124,
+  80,
+  -41,
+  -48,
+  117,
+  -81,
+  121,
+  89,
+  72,
+  33,
+  8,
+  33,
+  -91,
+  -83,
+  19,
+  -59,
+  97,
+  87,
+  113,
+  77,
+  -71,
+  35,
+  -57,
+  15,
+  -9,
+  -73,
+  -29,
+  -86,
+  -42,
+  -118,
+  -88,
+  34,
+  6,
+  -43,
+  54,
+  61,
+  -6,
+  74,
+  -22,
+  123,
+  28,
+  113,
+  70,
+  19,
+  121,
+  115,
+  -92,
+  -22,
+  -120,
+  39,
+  -113,
+  23,
+  -70,
+  -88,
+  100,
+  108,
+  0,
+  -33,
+  72,
+  80,
+  -38,
+  -16,
+  -28,
+  45,
+  -57,
+  50,
+  -31,
+  -94,
+  -81,
+  -29,
+  17,
+  120,
+  33,
+  -91,
+  -19,
+  -73,
+  -128,
+  17,
+  -61,
+  -76,
+  25,
+  53
+};
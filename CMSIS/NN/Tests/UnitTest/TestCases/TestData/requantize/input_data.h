@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t requantize_input[41] =
+{
+  73,
+  -16,
+  -63,
+  -80,
+  -18,
+  44,
+  -42,
+  104,
+  35,
+  -20,
+  -27,
+  16,
+  -15,
+  61,
+  -56,
+  -42,
+  -120,
+  -101,
+  -66,
+  -32,
+  -26,
+  -115,
+  117,
+  -89,
+  -116,
+  -72,
+  -72,
+  -62,
+  71,
+  -31,
+  -20,
+  -87,
+  30,
+  63,
+  -2,
+  -120,
+  -59,
+  42,
+  -69,
+  -23,
+  -3
+};
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t requantize_output_ref[41] =
+{
+  127,
+  -26,
+  -128,
+  -128,
+  -31,
+  124,
+  -91,
+  127,
+  101,
+  -36,
+  -54,
+  54,
+  -24,
+  127,
+  -126,
+  -91,
+  -128,
+  -128,
+  -128,
+  -66,
+  -51,
+  -128,
+  127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  127,
+  -64,
+  -36,
+  -128,
+  89,
+  127,
+  9,
+  -128,
+  -128,
+  119,
+  -128,
+  -44,
+  6
+};
@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#define REQUANTIZE_PER_CHANNEL_DST_SIZE 39
+#define REQUANTIZE_PER_CHANNEL_CHANNELS 13
+#define REQUANTIZE_PER_CHANNEL_INPUT_OFFSET -2
+#define REQUANTIZE_PER_CHANNEL_OUTPUT_OFFSET -4
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t requantize_per_channel_input[39] =
+{
+  -38,
+  -65,
+  -80,
+  59,
+  60,
+  16,
+  94,
+  117,
+  69,
+  -116,
+  59,
+  103,
+  -101,
+  6,
+  4,
+  55,
+  65,
+  115,
+  -32,
+  13,
+  -3,
+  33,
+  -60,
+  77,
+  -80,
+  -124,
+  -116,
+  -70,
+  127,
+  -78,
+  -113,
+  118,
+  67,
+  -32,
+  -88,
+  41,
+  -49,
+  77,
+  -77
+};
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q7_t requantize_per_channel_output_ref[39] =
+{
+  -21,
+  -128,
+  -111,
+  4,
+  120,
+  13,
+  127,
+  105,
+  48,
+  -128,
+  109,
+  103,
+  -108,
+  -2,
+  1,
+  65,
+  5,
+  127,
+  -45,
+  19,
+  -9,
+  20,
+  -99,
+  127,
+  -91,
+  -128,
+  -53,
+  -128,
+  127,
+  -15,
+  -128,
+  127,
+  127,
+  -36,
+  -74,
+  56,
+  -105,
+  76,
+  -84
+};
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#define SIGMOID_S16_DST_SIZE 33
+#define SIGMOID_S16_TYPE ARM_SIGMOID
+#define SIGMOID_S16_ALPHA 0.000000000e+00f
+#define SIGMOID_S16_INPUT_SCALE 2.441406250e-04f
+#define SIGMOID_S16_OUTPUT_SCALE 3.051757812e-05f
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q15_t sigmoid_s16_input[33] =
+{
+  -9745,
+  -24834,
+  -872,
+  16712,
+  -23196,
+  -31958,
+  -26065,
+  -15444,
+  31919,
+  4488,
+  26398,
+  -23882,
+  15665,
+  19708,
+  -5248,
+  -13158,
+  13054,
+  25049,
+  26552,
+  1314,
+  -20735,
+  31614,
+  7755,
+  1026,
+  -15294,
+  -26517,
+  25059,
+  -4921,
+  9280,
+  9729,
+  -12258,
+  -27492,
+  -10311
+};
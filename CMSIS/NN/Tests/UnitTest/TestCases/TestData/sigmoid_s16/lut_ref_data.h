@@ -0,0 +1,539 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q15_t sigmoid_s16_lut_ref[513] =
+{
+  11,
+  12,
+  12,
+  12,
+  13,
+  13,
+  13,
+  14,
+  14,
+  15,
+  15,
+  16,
+  16,
+  16,
+  17,
+  18,
+  18,
+  19,
+  20,
+  20,
+  21,
+  22,
+  22,
+  23,
+  24,
+  24,
+  25,
+  26,
+  26,
+  27,
+  28,
+  29,
+  30,
+  31,
+  32,
+  33,
+  34,
+  34,
+  36,
+  37,
+  38,
+  40,
+  40,
+  42,
+  43,
+  44,
+  46,
+  47,
+  49,
+  51,
+  52,
+  54,
+  56,
+  57,
+  59,
+  61,
+  63,
+  65,
+  67,
+  69,
+  72,
+  74,
+  76,
+  79,
+  81,
+  84,
+  87,
+  89,
+  92,
+  95,
+  98,
+  101,
+  104,
+  107,
+  110,
+  114,
+  118,
+  121,
+  125,
+  129,
+  133,
+  138,
+  142,
+  146,
+  151,
+  156,
+  161,
+  165,
+  171,
+  176,
+  182,
+  188,
+  194,
+  200,
+  206,
+  213,
+  219,
+  226,
+  233,
+  240,
+  248,
+  256,
+  264,
+  272,
+  281,
+  289,
+  299,
+  308,
+  318,
+  328,
+  338,
+  348,
+  360,
+  371,
+  383,
+  395,
+  407,
+  420,
+  433,
+  447,
+  461,
+  475,
+  490,
+  505,
+  521,
+  537,
+  554,
+  571,
+  589,
+  608,
+  626,
+  646,
+  666,
+  687,
+  708,
+  730,
+  752,
+  776,
+  800,
+  825,
+  851,
+  877,
+  904,
+  932,
+  960,
+  990,
+  1020,
+  1052,
+  1084,
+  1117,
+  1152,
+  1187,
+  1223,
+  1260,
+  1298,
+  1338,
+  1379,
+  1420,
+  1464,
+  1508,
+  1554,
+  1601,
+  1649,
+  1699,
+  1750,
+  1802,
+  1856,
+  1912,
+  1969,
+  2027,
+  2087,
+  2149,
+  2213,
+  2279,
+  2346,
+  2415,
+  2486,
+  2558,
+  2633,
+  2710,
+  2787,
+  2869,
+  2952,
+  3036,
+  3124,
+  3213,
+  3305,
+  3399,
+  3496,
+  3595,
+  3695,
+  3799,
+  3906,
+  4015,
+  4126,
+  4240,
+  4356,
+  4476,
+  4597,
+  4723,
+  4851,
+  4981,
+  5115,
+  5251,
+  5390,
+  5533,
+  5678,
+  5825,
+  5977,
+  6132,
+  6289,
+  6448,
+  6612,
+  6778,
+  6949,
+  7121,
+  7297,
+  7475,
+  7658,
+  7842,
+  8030,
+  8221,
+  8414,
+  8612,
+  8812,
+  9014,
+  9220,
+  9428,
+  9640,
+  9854,
+  10070,
+  10290,
+  10512,
+  10735,
+  10962,
+  11192,
+  11423,
+  11657,
+  11893,
+  12130,
+  12370,
+  12612,
+  12855,
+  13100,
+  13347,
+  13595,
+  13844,
+  14094,
+  14346,
+  14598,
+  14852,
+  15106,
+  15361,
+  15616,
+  15871,
+  16127,
+  16383,
+  16639,
+  16895,
+  17151,
+  17406,
+  17661,
+  17915,
+  18169,
+  18421,
+  18673,
+  18923,
+  19172,
+  19420,
+  19666,
+  19911,
+  20155,
+  20396,
+  20636,
+  20874,
+  21109,
+  21343,
+  21574,
+  21804,
+  22031,
+  22255,
+  22478,
+  22697,
+  22913,
+  23128,
+  23338,
+  23547,
+  23753,
+  23955,
+  24156,
+  24352,
+  24546,
+  24737,
+  24925,
+  25110,
+  25291,
+  25470,
+  25647,
+  25819,
+  25989,
+  26155,
+  26319,
+  26478,
+  26636,
+  26790,
+  26942,
+  27089,
+  27235,
+  27377,
+  27517,
+  27653,
+  27787,
+  27917,
+  28044,
+  28170,
+  28292,
+  28412,
+  28528,
+  28642,
+  28754,
+  28862,
+  28968,
+  29072,
+  29174,
+  29272,
+  29369,
+  29463,
+  29554,
+  29644,
+  29732,
+  29817,
+  29899,
+  29980,
+  30059,
+  30136,
+  30210,
+  30282,
+  30353,
+  30422,
+  30489,
+  30555,
+  30619,
+  30681,
+  30741,
+  30799,
+  30856,
+  30912,
+  30966,
+  31018,
+  31069,
+  31119,
+  31167,
+  31214,
+  31260,
+  31304,
+  31347,
+  31390,
+  31430,
+  31470,
+  31508,
+  31545,
+  31581,
+  31617,
+  31651,
+  31684,
+  31716,
+  31748,
+  31778,
+  31808,
+  31837,
+  31864,
+  31892,
+  31918,
+  31943,
+  31968,
+  31992,
+  32015,
+  32038,
+  32060,
+  32081,
+  32102,
+  32122,
+  32142,
+  32161,
+  32179,
+  32197,
+  32215,
+  32231,
+  32247,
+  32263,
+  32278,
+  32293,
+  32308,
+  32321,
+  32335,
+  32348,
+  32361,
+  32373,
+  32385,
+  32397,
+  32408,
+  32420,
+  32430,
+  32440,
+  32450,
+  32460,
+  32469,
+  32479,
+  32488,
+  32496,
+  32504,
+  32512,
+  32520,
+  32527,
+  32535,
+  32542,
+  32550,
+  32556,
+  32563,
+  32569,
+  32575,
+  32581,
+  32586,
+  32592,
+  32597,
+  32603,
+  32608,
+  32613,
+  32617,
+  32622,
+  32627,
+  32631,
+  32635,
+  32639,
+  32643,
+  32647,
+  32651,
+  32654,
+  32658,
+  32661,
+  32665,
+  32668,
+  32671,
+  32674,
+  32677,
+  32680,
+  32683,
+  32685,
+  32688,
+  32690,
+  32693,
+  32695,
+  32697,
+  32699,
+  32701,
+  32703,
+  32705,
+  32707,
+  32709,
+  32711,
+  32713,
+  32714,
+  32716,
+  32718,
+  32719,
+  32721,
+  32722,
+  32723,
+  32725,
+  32726,
+  32728,
+  32729,
+  32730,
+  32731,
+  32732,
+  32734,
+  32735,
+  32736,
+  32737,
+  32738,
+  32739,
+  32740,
+  32740,
+  32741,
+  32743,
+  32743,
+  32744,
+  32745,
+  32746,
+  32746,
+  32747,
+  32748,
+  32748,
+  32749,
+  32750,
+  32750,
+  32751,
+  32751,
+  32751,
+  32752,
+  32753,
+  32753,
+  32754,
+  32754,
+  32755,
+  32755,
+  32755,
+  32756,
+  32756,
+  32757,
+  32757,
+  32757,
+  32758
+};
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q15_t sigmoid_s16_output_ref[33] =
+{
+  2777,
+  76,
+  14646,
+  32224,
+  113,
+  13,
+  56,
+  738,
+  32755,
+  24558,
+  32716,
+  96,
+  32068,
+  32504,
+  7121,
+  1268,
+  31469,
+  32696,
+  32718,
+  18989,
+  206,
+  32754,
+  28480,
+  18425,
+  764,
+  51,
+  32697,
+  7577,
+  29688,
+  29981,
+  1565,
+  40,
+  2447
+};
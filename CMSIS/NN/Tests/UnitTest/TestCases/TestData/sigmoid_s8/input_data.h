@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t sigmoid_s8_input[37] =
+{
+  97,
+  -126,
+  19,
+  -70,
+  81,
+  2,
+  -17,
+  50,
+  -111,
+  -51,
+  120,
+  35,
+  -78,
+  0,
+  -79,
+  -101,
+  84,
+  -94,
+  79,
+  -80,
+  26,
+  78,
+  29,
+  -70,
+  -30,
+  61,
+  -89,
+  99,
+  -80,
+  100,
+  106,
+  -126,
+  -86,
+  -103,
+  14,
+  116,
+  -18
+};
@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t sigmoid_s8_lut_ref[256] =
+{
+  0,
+  5,
+  10,
+  15,
+  20,
+  25,
+  30,
+  35,
+  40,
+  44,
+  49,
+  53,
+  57,
+  61,
+  65,
+  69,
+  72,
+  76,
+  79,
+  82,
+  85,
+  88,
+  90,
+  93,
+  95,
+  97,
+  100,
+  102,
+  103,
+  105,
+  107,
+  108,
+  110,
+  111,
+  112,
+  113,
+  114,
+  115,
+  116,
+  117,
+  118,
+  119,
+  119,
+  120,
+  121,
+  121,
+  122,
+  122,
+  123,
+  123,
+  123,
+  124,
+  124,
+  124,
+  125,
+  125,
+  125,
+  125,
+  126,
+  126,
+  126,
+  126,
+  126,
+  126,
+  126,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -126,
+  -126,
+  -126,
+  -126,
+  -126,
+  -126,
+  -126,
+  -125,
+  -125,
+  -125,
+  -125,
+  -124,
+  -124,
+  -124,
+  -123,
+  -123,
+  -123,
+  -122,
+  -122,
+  -121,
+  -121,
+  -120,
+  -119,
+  -119,
+  -118,
+  -117,
+  -116,
+  -115,
+  -114,
+  -113,
+  -112,
+  -111,
+  -110,
+  -108,
+  -107,
+  -105,
+  -103,
+  -102,
+  -100,
+  -97,
+  -95,
+  -93,
+  -90,
+  -88,
+  -85,
+  -82,
+  -79,
+  -76,
+  -72,
+  -69,
+  -65,
+  -61,
+  -57,
+  -53,
+  -49,
+  -44,
+  -40,
+  -35,
+  -30,
+  -25,
+  -20,
+  -15,
+  -10,
+  -5
+};
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t sigmoid_s8_output_ref[37] =
+{
+  127,
+  -128,
+  82,
+  -127,
+  127,
+  10,
+  -76,
+  123,
+  -128,
+  -124,
+  127,
+  113,
+  -128,
+  0,
+  -128,
+  -128,
+  127,
+  -128,
+  127,
+  -128,
+  100,
+  127,
+  105,
+  -127,
+  -107,
+  126,
+  -128,
+  127,
+  -128,
+  127,
+  127,
+  -128,
+  -128,
+  -128,
+  65,
+  127,
+  -79
+};
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#define SLICE_ROWS_INPUT_BATCHES 2
+#define SLICE_ROWS_INPUT_H 6
+#define SLICE_ROWS_INPUT_W 5
+#define SLICE_ROWS_IN_CH 4
+#define SLICE_ROWS_OUTPUT_BATCHES 2
+#define SLICE_ROWS_OUTPUT_H 3
+#define SLICE_ROWS_OUTPUT_W 5
+#define SLICE_ROWS_OUT_CH 4
+#define SLICE_ROWS_DST_SIZE 120
+#define SLICE_ROWS_BEGIN_N 0
+#define SLICE_ROWS_BEGIN_H 2
+#define SLICE_ROWS_BEGIN_W 0
+#define SLICE_ROWS_BEGIN_C 0
+#define SLICE_ROWS_STRIDE_N 1
+#define SLICE_ROWS_STRIDE_H 1
+#define SLICE_ROWS_STRIDE_W 1
+#define SLICE_ROWS_STRIDE_C 1
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#include <stdint.h>
+
+const q7_t slice_rows_input[240] =
+{
+  -108,
+  121,
+  22,
+  48,
+  -91,
+  -86,
+  124,
+  60,
+  16,
+  -47,
+  26,
+  -19,
+  -55,
+  80,
+  28,
+  -105,
+  14,
+  -9,
+  -116,
+  15,
+  -46,
+  -22,
+  20,
+  99,
+  -126,
+  55,
+  71,
+  107,
+  -20,
+  99,
+  -105,
+  68,
+  -5,
+  -80,
+  39,
+  60,
+  -15,
+  22,
+  -46,
+  -1,
+  62,
+  35,
+  -26,
+  -87,
+  -102,
+  64,
+  91,
+  -116,
+  10,
+  31,
+  79,
+  59,
+  -6,
+  -122,
+  -53,
+  -99,
+  105,
+  -44,
+  -113,
+  51,
+  -15,
+  28,
+  79,
+  117,
+  -82,
+  11,
+  64,
+  -122,
+  -75,
+  10,
+  28,
+  87,
+  67,
+  62,
+  -73,
+  98,
+  -79,
+  -111,
+  -115,
+  -43,
+  44,
+  -15,
+  30,
+  -67,
+  91,
+  -14,
+  -114,
+  109,
+  -25,
+  79,
+  -45,
+  91,
+  126,
+  -113,
+  113,
+  -124,
+  -128,
+  -87,
+  22,
+  40,
+  -72,
+  94,
+  17,
+  22,
+  -61,
+  -71,
+  -21,
+  -50,
+  -106,
+  -48,
+  74,
+  -106,
+  -117,
+  58,
+  -108,
+  2,
+  113,
+  66,
+  37,
+  -66,
+  57,
+  105,
+  88,
+  8,
+  74,
+  -68,
+  5,
+  53,
+  -79,
+  -21,
+  26,
+  30,
+  100,
+  -106,
+  -127,
+  -92,
+  23,
+  -64,
+  72,
+  -115,
+  -89,
+  112,
+  -35,
+  99,
+  79,
+  -31,
+  -113,
+  -20,
+  -60,
+  43,
+  -36,
+  -88,
+  107,
+  -93,
+  -4,
+  43,
+  -75,
+  4,
+  11,
+  -71,
+  8,
+  -101,
+  -106,
+  -66,
+  -35,
+  -12,
+  22,
+  -69,
+  -47,
+  64,
+  82,
+  2,
+  94,
+  97,
+  -25,
+  -99,
+  108,
+  -31,
+  86,
+  -76,
+  -30,
+  -22,
+  119,
+  -97,
+  -10,
+  -30,
+  -93,
+  9,
+  13,
+  43,
+  -103,
+  30,
+  117,
+  47,
+  -20,
+  12,
+  -40,
+  -38,
+  95,
+  70,
+  14,
+  -99,
+  39,
+  -90,
+  -100,
+  10,
+  46,
+  -112,
+  -66,
+  11,
+  -92,
+  104,
+  74,
+  8,
+  -84,
+  -105,
+  78,
+  -51,
+  -88,
+  -38,
+  96,
+  -118,
+  -128,
+  -102,
+  57,
+  -87,
+  52,
+  -88,
+  -48,
+  123,
+  -79,
+  -59,
+  80,
+  -92,
+  6,
+  -126,
+  57,
+  30,
+  -115,
+  104
+};
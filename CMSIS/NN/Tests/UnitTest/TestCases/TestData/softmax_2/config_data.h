@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#define SOFTMAX_2_NUM_ROWS 5
+#define SOFTMAX_2_ROW_SIZE 67
+#define SOFTMAX_2_INPUT_MULT 1073741824
+#define SOFTMAX_2_INPUT_LEFT_SHIFT 23
+#define SOFTMAX_2_DIFF_MIN -248
+#define SOFTMAX_2_DST_SIZE 335
@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <stdint.h>
+
+const int8_t softmax_2_input[335] =
+{
+  122,
+  -1,
+  -60,
+  -49,
+  85,
+  82,
+  -128,
+  -83,
+  -87,
+  -53,
+  22,
+  67,
+  -51,
+  69,
+  -3,
+  -87,
+  -2,
+  85,
+  -33,
+  90,
+  -78,
+  -108,
+  89,
+  27,
+  87,
+  31,
+  -6,
+  -114,
+  120,
+  23,
+  -83,
+  114,
+  -106,
+  -14,
+  -63,
+  108,
+  -60,
+  -63,
+  -103,
+  -19,
+  13,
+  47,
+  -80,
+  90,
+  -12,
+  45,
+  -124,
+  114,
+  2,
+  -29,
+  76,
+  53,
+  -9,
+  38,
+  -48,
+  -50,
+  -59,
+  75,
+  -36,
+  -67,
+  -30,
+  10,
+  -81,
+  -7,
+  124,
+  -16,
+  -27,
+  -64,
+  50,
+  -2,
+  45,
+  -65,
+  -82,
+  93,
+  -103,
+  34,
+  10,
+  -99,
+  21,
+  -116,
+  1,
+  -31,
+  65,
+  120,
+  -121,
+  -110,
+  -57,
+  -52,
+  93,
+  35,
+  9,
+  -65,
+  -83,
+  56,
+  56,
+  -87,
+  -87,
+  -99,
+  -23,
+  91,
+  28,
+  -106,
+  -102,
+  74,
+  115,
+  -77,
+  -20,
+  -3,
+  -47,
+  -127,
+  10,
+  82,
+  -29,
+  -53,
+  74,
+  -22,
+  -35,
+  -111,
+  55,
+  -70,
+  53,
+  -64,
+  -6,
+  98,
+  121,
+  -78,
+  -116,
+  -94,
+  -48,
+  -11,
+  125,
+  108,
+  12,
+  -105,
+  54,
+  -1,
+  -54,
+  -94,
+  125,
+  27,
+  -92,
+  7,
+  -19,
+  7,
+  82,
+  -72,
+  113,
+  -80,
+  -55,
+  40,
+  -22,
+  126,
+  105,
+  100,
+  97,
+  98,
+  -105,
+  109,
+  -124,
+  -25,
+  -30,
+  -127,
+  -45,
+  110,
+  -104,
+  -119,
+  -18,
+  -30,
+  -85,
+  -21,
+  126,
+  -49,
+  114,
+  -21,
+  86,
+  68,
+  35,
+  72,
+  116,
+  109,
+  -16,
+  -33,
+  107,
+  -39,
+  -61,
+  76,
+  -69,
+  -38,
+  57,
+  -65,
+  65,
+  -100,
+  -64,
+  -108,
+  -118,
+  -40,
+  -99,
+  -8,
+  59,
+  -55,
+  99,
+  57,
+  24,
+  85,
+  -92,
+  -17,
+  26,
+  72,
+  -73,
+  14,
+  53,
+  39,
+  109,
+  32,
+  -127,
+  -79,
+  -19,
+  -68,
+  11,
+  -90,
+  -4,
+  -51,
+  -62,
+  60,
+  -31,
+  -51,
+  -107,
+  -1,
+  69,
+  80,
+  72,
+  41,
+  9,
+  -32,
+  -2,
+  45,
+  79,
+  -104,
+  -11,
+  -122,
+  39,
+  -86,
+  46,
+  20,
+  75,
+  47,
+  69,
+  -72,
+  107,
+  -47,
+  -34,
+  -25,
+  30,
+  33,
+  -92,
+  127,
+  110,
+  -71,
+  -2,
+  51,
+  -119,
+  -58,
+  -36,
+  18,
+  39,
+  91,
+  -65,
+  -10,
+  115,
+  53,
+  -3,
+  26,
+  95,
+  -85,
+  -81,
+  42,
+  90,
+  116,
+  98,
+  69,
+  -59,
+  -63,
+  -83,
+  99,
+  98,
+  -47,
+  99,
+  80,
+  10,
+  -31,
+  3,
+  19,
+  40,
+  96,
+  -91,
+  -49,
+  59,
+  -28,
+  69,
+  46,
+  -103,
+  -62,
+  -55,
+  121,
+  -19,
+  -8,
+  35,
+  -57,
+  -20,
+  6,
+  -115,
+  50,
+  71,
+  -70,
+  21,
+  41,
+  11,
+  -8,
+  -7,
+  -107,
+  90,
+  124,
+  40,
+  2,
+  92,
+  77,
+  81,
+  23,
+  -79,
+  22,
+  -58,
+  -53,
+  89,
+  15,
+  -60
+};
@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <stdint.h>
+
+const int8_t softmax_2_output_ref[335] =
+{
+  -83,
+  -128,
+  -128,
+  -128,
+  -124,
+  -124,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -128,
+  -126,
+  -128,
+  -128,
+  -128,
+  -124,
+  -128,
+  -122,
+  -128,
+  -128,
+  -122,
+  -128,
+  -123,
+  -128,
+  -128,
+  -128,
+  -88,
+  -128,
+  -128,
+  -101,
+  -128,
+  -128,
+  -128,
+  -109,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -122,
+  -128,
+  -128,
+  -128,
+  -101,
+  -128,
+  -128,
+  -125,
+  -127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -126,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -77,
+  -128,
+  -128,
+  -128,
+  -127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -120,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -84,
+  -128,
+  -128,
+  -128,
+  -128,
+  -120,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -121,
+  -128,
+  -128,
+  -128,
+  -125,
+  -96,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -124,
+  -128,
+  -128,
+  -125,
+  -128,
+  -128,
+  -128,
+  -127,
+  -128,
+  -127,
+  -128,
+  -128,
+  -117,
+  -81,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -67,
+  -107,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -94,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -126,
+  -128,
+  -112,
+  -128,
+  -128,
+  -128,
+  -128,
+  -92,
+  -118,
+  -121,
+  -122,
+  -122,
+  -128,
+  -115,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -115,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -92,
+  -128,
+  -111,
+  -128,
+  -125,
+  -127,
+  -128,
+  -127,
+  -109,
+  -115,
+  -128,
+  -128,
+  -117,
+  -128,
+  -128,
+  -126,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -128,
+  -121,
+  -127,
+  -128,
+  -121,
+  -128,
+  -128,
+  -128,
+  -125,
+  -128,
+  -128,
+  -127,
+  -128,
+  -95,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -126,
+  -128,
+  -128,
+  -128,
+  -128,
+  -125,
+  -123,
+  -125,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -123,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -128,
+  -124,
+  -127,
+  -125,
+  -128,
+  -99,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -25,
+  -93,
+  -128,
+  -128,
+  -127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -117,
+  -128,
+  -128,
+  -99,
+  -127,
+  -128,
+  -128,
+  -120,
+  -128,
+  -128,
+  -128,
+  -122,
+  -97,
+  -118,
+  -126,
+  -128,
+  -128,
+  -128,
+  -117,
+  -118,
+  -128,
+  -117,
+  -125,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -119,
+  -128,
+  -128,
+  -127,
+  -128,
+  -126,
+  -128,
+  -128,
+  -128,
+  -128,
+  -86,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -126,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -122,
+  -77,
+  -128,
+  -128,
+  -121,
+  -125,
+  -125,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -122,
+  -128,
+  -128
+};
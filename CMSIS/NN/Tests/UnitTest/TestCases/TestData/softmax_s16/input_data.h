@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q15_t softmax_s16_input[27] =
+{
+  -5287,
+  32420,
+  18331,
+  -29024,
+  -22093,
+  -27478,
+  29661,
+  -28750,
+  21793,
+  -9208,
+  17080,
+  -4117,
+  -11390,
+  20032,
+  -27852,
+  -6329,
+  -13593,
+  -25651,
+  8731,
+  -12182,
+  -8651,
+  -4528,
+  2775,
+  27964,
+  -26969,
+  9030,
+  -31493
+};
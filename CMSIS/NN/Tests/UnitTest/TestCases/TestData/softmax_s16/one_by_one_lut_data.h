@@ -0,0 +1,539 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q15_t softmax_s16_one_by_one_lut[513] =
+{
+  32767,
+  32704,
+  32640,
+  32578,
+  32514,
+  32451,
+  32388,
+  32326,
+  32264,
+  32202,
+  32141,
+  32079,
+  32018,
+  31957,
+  31896,
+  31835,
+  31775,
+  31715,
+  31655,
+  31596,
+  31537,
+  31476,
+  31418,
+  31359,
+  31301,
+  31242,
+  31184,
+  31127,
+  31069,
+  31011,
+  30954,
+  30897,
+  30840,
+  30784,
+  30727,
+  30671,
+  30615,
+  30560,
+  30504,
+  30449,
+  30394,
+  30339,
+  30283,
+  30229,
+  30175,
+  30121,
+  30067,
+  30013,
+  29960,
+  29906,
+  29853,
+  29800,
+  29746,
+  29694,
+  29642,
+  29589,
+  29537,
+  29486,
+  29434,
+  29382,
+  29331,
+  29280,
+  29229,
+  29177,
+  29127,
+  29076,
+  29026,
+  28976,
+  28926,
+  28877,
+  28827,
+  28777,
+  28728,
+  28679,
+  28630,
+  28581,
+  28532,
+  28484,
+  28436,
+  28388,
+  28340,
+  28292,
+  28244,
+  28197,
+  28150,
+  28103,
+  28056,
+  28008,
+  27962,
+  27915,
+  27869,
+  27823,
+  27777,
+  27731,
+  27685,
+  27640,
+  27594,
+  27549,
+  27504,
+  27459,
+  27413,
+  27369,
+  27324,
+  27280,
+  27236,
+  27192,
+  27148,
+  27104,
+  27060,
+  27016,
+  26973,
+  26930,
+  26887,
+  26844,
+  26801,
+  26758,
+  26715,
+  26673,
+  26630,
+  26588,
+  26546,
+  26504,
+  26463,
+  26421,
+  26380,
+  26338,
+  26297,
+  26255,
+  26214,
+  26174,
+  26132,
+  26092,
+  26051,
+  26011,
+  25971,
+  25931,
+  25891,
+  25851,
+  25811,
+  25772,
+  25732,
+  25693,
+  25653,
+  25614,
+  25575,
+  25536,
+  25497,
+  25458,
+  25420,
+  25381,
+  25343,
+  25305,
+  25267,
+  25229,
+  25191,
+  25153,
+  25116,
+  25078,
+  25041,
+  25003,
+  24967,
+  24928,
+  24892,
+  24855,
+  24818,
+  24781,
+  24745,
+  24709,
+  24672,
+  24636,
+  24600,
+  24564,
+  24528,
+  24492,
+  24457,
+  24421,
+  24385,
+  24350,
+  24315,
+  24280,
+  24245,
+  24210,
+  24175,
+  24140,
+  24105,
+  24070,
+  24036,
+  24002,
+  23967,
+  23933,
+  23899,
+  23865,
+  23831,
+  23798,
+  23764,
+  23730,
+  23697,
+  23664,
+  23630,
+  23597,
+  23564,
+  23530,
+  23498,
+  23465,
+  23432,
+  23399,
+  23366,
+  23334,
+  23302,
+  23269,
+  23237,
+  23205,
+  23173,
+  23141,
+  23109,
+  23077,
+  23046,
+  23014,
+  22982,
+  22951,
+  22920,
+  22888,
+  22857,
+  22826,
+  22795,
+  22764,
+  22733,
+  22703,
+  22672,
+  22641,
+  22611,
+  22580,
+  22550,
+  22520,
+  22490,
+  22459,
+  22429,
+  22400,
+  22370,
+  22340,
+  22310,
+  22281,
+  22251,
+  22221,
+  22192,
+  22163,
+  22134,
+  22104,
+  22075,
+  22046,
+  22017,
+  21988,
+  21959,
+  21931,
+  21902,
+  21874,
+  21845,
+  21817,
+  21788,
+  21760,
+  21732,
+  21704,
+  21676,
+  21648,
+  21620,
+  21592,
+  21565,
+  21537,
+  21509,
+  21482,
+  21455,
+  21427,
+  21400,
+  21372,
+  21345,
+  21318,
+  21291,
+  21264,
+  21237,
+  21210,
+  21183,
+  21157,
+  21130,
+  21103,
+  21077,
+  21050,
+  21024,
+  20998,
+  20971,
+  20945,
+  20919,
+  20893,
+  20867,
+  20841,
+  20815,
+  20790,
+  20764,
+  20738,
+  20713,
+  20687,
+  20662,
+  20636,
+  20611,
+  20586,
+  20560,
+  20535,
+  20510,
+  20485,
+  20460,
+  20435,
+  20410,
+  20385,
+  20360,
+  20336,
+  20311,
+  20287,
+  20262,
+  20238,
+  20213,
+  20189,
+  20165,
+  20141,
+  20117,
+  20092,
+  20068,
+  20044,
+  20021,
+  19997,
+  19973,
+  19949,
+  19926,
+  19902,
+  19878,
+  19855,
+  19832,
+  19808,
+  19784,
+  19762,
+  19738,
+  19715,
+  19692,
+  19668,
+  19645,
+  19622,
+  19600,
+  19577,
+  19553,
+  19531,
+  19508,
+  19485,
+  19463,
+  19440,
+  19418,
+  19395,
+  19373,
+  19351,
+  19328,
+  19306,
+  19284,
+  19262,
+  19240,
+  19218,
+  19196,
+  19174,
+  19152,
+  19130,
+  19109,
+  19087,
+  19065,
+  19044,
+  19022,
+  19000,
+  18979,
+  18958,
+  18936,
+  18915,
+  18893,
+  18872,
+  18851,
+  18830,
+  18809,
+  18787,
+  18766,
+  18745,
+  18725,
+  18704,
+  18682,
+  18662,
+  18641,
+  18620,
+  18600,
+  18579,
+  18559,
+  18538,
+  18518,
+  18497,
+  18477,
+  18457,
+  18436,
+  18416,
+  18396,
+  18376,
+  18356,
+  18336,
+  18316,
+  18296,
+  18276,
+  18256,
+  18236,
+  18216,
+  18197,
+  18177,
+  18157,
+  18138,
+  18118,
+  18099,
+  18079,
+  18059,
+  18040,
+  18021,
+  18001,
+  17982,
+  17963,
+  17944,
+  17924,
+  17905,
+  17886,
+  17867,
+  17848,
+  17829,
+  17810,
+  17791,
+  17772,
+  17754,
+  17735,
+  17716,
+  17697,
+  17679,
+  17660,
+  17641,
+  17623,
+  17604,
+  17586,
+  17568,
+  17549,
+  17531,
+  17513,
+  17494,
+  17476,
+  17458,
+  17440,
+  17422,
+  17404,
+  17386,
+  17368,
+  17350,
+  17332,
+  17314,
+  17296,
+  17278,
+  17261,
+  17243,
+  17225,
+  17208,
+  17190,
+  17172,
+  17155,
+  17137,
+  17120,
+  17102,
+  17085,
+  17067,
+  17050,
+  17033,
+  17015,
+  16999,
+  16981,
+  16964,
+  16947,
+  16930,
+  16913,
+  16895,
+  16878,
+  16862,
+  16845,
+  16828,
+  16810,
+  16794,
+  16777,
+  16760,
+  16743,
+  16727,
+  16710,
+  16693,
+  16677,
+  16660,
+  16644,
+  16627,
+  16611,
+  16594,
+  16578,
+  16562,
+  16545,
+  16529,
+  16513,
+  16497,
+  16480,
+  16464,
+  16448,
+  16432,
+  16416,
+  16400,
+  16384
+};
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q15_t softmax_s16_2_input[80] =
+{
+  -2707,
+  380,
+  307,
+  229,
+  -645,
+  114,
+  -2023,
+  1456,
+  1026,
+  1806,
+  -2034,
+  1314,
+  -1550,
+  2492,
+  -449,
+  544,
+  -2377,
+  288,
+  -431,
+  2359,
+  -576,
+  -164,
+  563,
+  -1334,
+  -2207,
+  -150,
+  1902,
+  559,
+  -2733,
+  2923,
+  279,
+  -1987,
+  1241,
+  144,
+  1315,
+  1031,
+  -1106,
+  2804,
+  -2029,
+  -1503,
+  2300,
+  -1261,
+  -1223,
+  2675,
+  -2730,
+  -419,
+  703,
+  -1937,
+  -701,
+  778,
+  754,
+  -2069,
+  -2231,
+  504,
+  697,
+  408,
+  2894,
+  -1848,
+  -1103,
+  -2938,
+  1112,
+  2456,
+  367,
+  2095,
+  -2490,
+  -1812,
+  1842,
+  -2062,
+  240,
+  -919,
+  -2926,
+  -343,
+  -2443,
+  -201,
+  1431,
+  -869,
+  923,
+  -1486,
+  -815,
+  26
+};
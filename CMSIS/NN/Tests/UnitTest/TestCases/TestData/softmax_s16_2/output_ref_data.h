@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using an integer reference implementation.
+#include <stdint.h>
+
+const q15_t softmax_s16_2_output_ref[80] =
+{
+  396,
+  842,
+  827,
+  812,
+  656,
+  789,
+  468,
+  1095,
+  986,
+  1193,
+  467,
+  1058,
+  526,
+  1410,
+  688,
+  877,
+  430,
+  823,
+  691,
+  1365,
+  667,
+  737,
+  881,
+  554,
+  448,
+  740,
+  1221,
+  880,
+  394,
+  1567,
+  822,
+  473,
+  1039,
+  795,
+  1058,
+  987,
+  586,
+  1522,
+  468,
+  532,
+  1430,
+  599,
+  605,
+  1567,
+  419,
+  736,
+  968,
+  508,
+  687,
+  986,
+  980,
+  492,
+  473,
+  922,
+  967,
+  901,
+  1653,
+  519,
+  623,
+  398,
+  1070,
+  1485,
+  892,
+  1360,
+  444,
+  524,
+  1279,
+  493,
+  865,
+  652,
+  399,
+  750,
+  449,
+  776,
+  1157,
+  660,
+  1022,
+  567,
+  668,
+  821
+};
@@ -0,0 +1,782 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#include <stdint.h>
+
+const q7_t strided_slice_input[756] =
+{
+  -80,
+  66,
+  17,
+  12,
+  107,
+  96,
+  -2,
+  94,
+  -52,
+  -15,
+  -125,
+  84,
+  -64,
+  81,
+  52,
+  -120,
+  -115,
+  51,
+  50,
+  -107,
+  100,
+  -53,
+  27,
+  -96,
+  12,
+  14,
+  -7,
+  -122,
+  -25,
+  66,
+  -124,
+  -18,
+  -9,
+  88,
+  -26,
+  -65,
+  -106,
+  -119,
+  46,
+  102,
+  78,
+  -58,
+  -65,
+  -73,
+  -31,
+  59,
+  -103,
+  55,
+  -8,
+  10,
+  -1,
+  57,
+  45,
+  14,
+  34,
+  -36,
+  102,
+  -29,
+  120,
+  -15,
+  -28,
+  75,
+  59,
+  22,
+  10,
+  38,
+  -70,
+  120,
+  -59,
+  26,
+  -62,
+  -16,
+  33,
+  78,
+  66,
+  -125,
+  43,
+  -52,
+  -90,
+  -123,
+  -80,
+  110,
+  -11,
+  43,
+  -72,
+  -30,
+  125,
+  -79,
+  -73,
+  -57,
+  52,
+  50,
+  -54,
+  33,
+  120,
+  22,
+  -64,
+  -123,
+  -98,
+  35,
+  -77,
+  118,
+  -77,
+  21,
+  -125,
+  105,
+  -114,
+  71,
+  -127,
+  67,
+  55,
+  -34,
+  48,
+  83,
+  68,
+  -83,
+  80,
+  -104,
+  10,
+  23,
+  116,
+  -21,
+  -119,
+  -89,
+  83,
+  102,
+  -69,
+  68,
+  4,
+  -22,
+  -14,
+  112,
+  101,
+  -100,
+  -7,
+  -90,
+  28,
+  -120,
+  85,
+  48,
+  -99,
+  -57,
+  38,
+  121,
+  -93,
+  0,
+  -64,
+  -75,
+  11,
+  63,
+  64,
+  106,
+  -47,
+  79,
+  46,
+  -98,
+  -46,
+  -35,
+  -23,
+  67,
+  -112,
+  56,
+  -96,
+  -11,
+  53,
+  -44,
+  2,
+  15,
+  2,
+  69,
+  102,
+  64,
+  79,
+  -87,
+  30,
+  6,
+  -5,
+  -24,
+  52,
+  -57,
+  -118,
+  -28,
+  -69,
+  22,
+  46,
+  -3,
+  1,
+  -38,
+  1,
+  51,
+  20,
+  -80,
+  105,
+  -38,
+  33,
+  -127,
+  121,
+  61,
+  24,
+  47,
+  -9,
+  -19,
+  -19,
+  -93,
+  -86,
+  -68,
+  46,
+  -83,
+  -47,
+  -124,
+  -74,
+  -51,
+  -106,
+  33,
+  19,
+  60,
+  -110,
+  99,
+  -112,
+  78,
+  -71,
+  14,
+  -51,
+  -94,
+  -2,
+  66,
+  -96,
+  -87,
+  95,
+  -61,
+  52,
+  22,
+  -63,
+  84,
+  -101,
+  120,
+  35,
+  111,
+  -6,
+  -97,
+  54,
+  -8,
+  -17,
+  72,
+  79,
+  -92,
+  24,
+  -95,
+  113,
+  -58,
+  -71,
+  92,
+  88,
+  -27,
+  -112,
+  113,
+  17,
+  -44,
+  36,
+  -123,
+  67,
+  -9,
+  73,
+  46,
+  8,
+  119,
+  87,
+  -52,
+  -29,
+  -100,
+  124,
+  -71,
+  -87,
+  -120,
+  -30,
+  -67,
+  -40,
+  100,
+  -20,
+  36,
+  -92,
+  -80,
+  68,
+  -115,
+  -87,
+  -22,
+  -55,
+  -25,
+  -73,
+  42,
+  92,
+  -24,
+  -62,
+  7,
+  53,
+  12,
+  -18,
+  50,
+  47,
+  69,
+  -34,
+  -11,
+  -80,
+  -101,
+  17,
+  -55,
+  65,
+  -74,
+  18,
+  -118,
+  -62,
+  46,
+  29,
+  79,
+  110,
+  -5,
+  64,
+  38,
+  -82,
+  65,
+  -84,
+  -71,
+  60,
+  -39,
+  -127,
+  23,
+  -116,
+  -74,
+  -87,
+  -76,
+  -112,
+  32,
+  63,
+  -6,
+  -53,
+  -112,
+  32,
+  101,
+  -10,
+  85,
+  -30,
+  -63,
+  43,
+  112,
+  39,
+  105,
+  -78,
+  35,
+  -5,
+  53,
+  -67,
+  87,
+  -92,
+  82,
+  -75,
+  -87,
+  123,
+  -93,
+  -118,
+  106,
+  123,
+  -49,
+  37,
+  39,
+  32,
+  -113,
+  -82,
+  -60,
+  -106,
+  112,
+  16,
+  29,
+  -32,
+  -82,
+  -64,
+  -25,
+  2,
+  -98,
+  -22,
+  125,
+  117,
+  85,
+  93,
+  -34,
+  -59,
+  -55,
+  -123,
+  -128,
+  23,
+  121,
+  -124,
+  77,
+  -67,
+  -80,
+  -1,
+  -2,
+  63,
+  -41,
+  -74,
+  -24,
+  100,
+  54,
+  33,
+  -23,
+  -63,
+  -41,
+  -113,
+  -115,
+  50,
+  32,
+  119,
+  -32,
+  -104,
+  55,
+  33,
+  -11,
+  60,
+  -98,
+  -98,
+  -108,
+  124,
+  64,
+  -126,
+  24,
+  -6,
+  55,
+  -90,
+  -81,
+  -48,
+  -81,
+  -105,
+  10,
+  120,
+  91,
+  75,
+  65,
+  80,
+  -61,
+  4,
+  -76,
+  -10,
+  33,
+  -72,
+  -122,
+  101,
+  -121,
+  75,
+  -63,
+  68,
+  -42,
+  23,
+  -10,
+  126,
+  47,
+  75,
+  -88,
+  27,
+  33,
+  -21,
+  57,
+  -120,
+  37,
+  -11,
+  36,
+  -53,
+  -15,
+  29,
+  -22,
+  47,
+  50,
+  -98,
+  -32,
+  -114,
+  93,
+  126,
+  -49,
+  28,
+  -66,
+  -12,
+  -116,
+  89,
+  -16,
+  36,
+  69,
+  68,
+  -53,
+  8,
+  -28,
+  -9,
+  -92,
+  -54,
+  36,
+  -10,
+  62,
+  48,
+  -122,
+  119,
+  -125,
+  18,
+  -50,
+  -7,
+  -61,
+  59,
+  16,
+  84,
+  -80,
+  -19,
+  -42,
+  19,
+  -26,
+  31,
+  27,
+  -93,
+  105,
+  -7,
+  49,
+  45,
+  78,
+  -27,
+  -81,
+  -14,
+  84,
+  63,
+  95,
+  104,
+  12,
+  -77,
+  20,
+  107,
+  -114,
+  73,
+  -21,
+  -22,
+  -71,
+  80,
+  116,
+  -103,
+  29,
+  88,
+  15,
+  -98,
+  10,
+  56,
+  -43,
+  0,
+  -33,
+  50,
+  -121,
+  -113,
+  33,
+  103,
+  34,
+  -68,
+  -21,
+  109,
+  115,
+  78,
+  126,
+  46,
+  127,
+  -20,
+  125,
+  48,
+  104,
+  -61,
+  -32,
+  -23,
+  70,
+  124,
+  -52,
+  -9,
+  69,
+  102,
+  -103,
+  65,
+  -111,
+  -127,
+  -122,
+  -123,
+  -74,
+  -81,
+  25,
+  97,
+  -118,
+  -31,
+  56,
+  8,
+  -87,
+  29,
+  -25,
+  104,
+  36,
+  -35,
+  86,
+  90,
+  90,
+  70,
+  -126,
+  8,
+  -40,
+  21,
+  -32,
+  19,
+  -28,
+  108,
+  -58,
+  21,
+  -17,
+  15,
+  11,
+  -3,
+  85,
+  42,
+  -69,
+  28,
+  -91,
+  14,
+  -16,
+  -2,
+  119,
+  44,
+  0,
+  63,
+  9,
+  -12,
+  17,
+  -27,
+  -23,
+  -125,
+  50,
+  -90,
+  5,
+  -38,
+  -106,
+  93,
+  -128,
+  113,
+  -94,
+  -119,
+  -22,
+  103,
+  -101,
+  97,
+  71,
+  -22,
+  0,
+  89,
+  -12,
+  -89,
+  -105,
+  -56,
+  -80,
+  -47,
+  -35,
+  78,
+  34,
+  49,
+  79,
+  -114,
+  -89,
+  104,
+  -112,
+  -23,
+  53,
+  32,
+  66,
+  -32,
+  117,
+  -27,
+  116,
+  69,
+  -27,
+  37,
+  -11,
+  7,
+  78,
+  33,
+  68,
+  -31,
+  -4,
+  33,
+  -96,
+  121,
+  90,
+  80,
+  -4,
+  -2,
+  11,
+  -126,
+  -123,
+  63,
+  -53,
+  59,
+  -31,
+  115,
+  51,
+  90,
+  -100,
+  127,
+  -120,
+  49,
+  114,
+  26,
+  -58,
+  -13,
+  9,
+  25,
+  -15,
+  -26,
+  80,
+  -14,
+  32,
+  -61,
+  -119,
+  -13,
+  25,
+  70,
+  104,
+  -60,
+  70,
+  -76,
+  22,
+  -82,
+  115,
+  -6,
+  -3,
+  15,
+  44,
+  -89,
+  60,
+  -27,
+  96,
+  109,
+  62,
+  113,
+  126,
+  -36,
+  -100,
+  -123,
+  96,
+  8,
+  -50,
+  -106,
+  19,
+  81,
+  73,
+  112,
+  -120,
+  112,
+  110,
+  -23,
+  -20,
+  -83,
+  46,
+  33,
+  77
+};
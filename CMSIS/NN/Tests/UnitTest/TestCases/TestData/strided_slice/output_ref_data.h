@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#include <stdint.h>
+
+const q7_t strided_slice_output_ref[30] =
+{
+  75,
+  65,
+  80,
+  -61,
+  4,
+  37,
+  -11,
+  36,
+  -53,
+  -15,
+  56,
+  -43,
+  0,
+  -33,
+  50,
+  -52,
+  -9,
+  69,
+  102,
+  -103,
+  -56,
+  -80,
+  -47,
+  -35,
+  78,
+  68,
+  -31,
+  -4,
+  33,
+  -96
+};
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a numpy reference implementation.
+#include <stdint.h>
+
+const q7_t strided_slice_c_input[240] =
+{
+  12,
+  76,
+  40,
+  59,
+  -96,
+  42,
+  -108,
+  2,
+  -42,
+  -103,
+  -27,
+  -39,
+  21,
+  18,
+  -8,
+  -50,
+  -50,
+  122,
+  -66,
+  -103,
+  98,
+  1,
+  -106,
+  -107,
+  75,
+  -92,
+  113,
+  66,
+  8,
+  -57,
+  2,
+  -50,
+  102,
+  -38,
+  -116,
+  18,
+  94,
+  51,
+  6,
+  -54,
+  -78,
+  5,
+  -112,
+  -22,
+  36,
+  -70,
+  4,
+  -67,
+  -40,
+  47,
+  54,
+  24,
+  -10,
+  48,
+  6,
+  -49,
+  10,
+  -121,
+  -111,
+  -67,
+  -90,
+  36,
+  -54,
+  12,
+  63,
+  29,
+  68,
+  81,
+  121,
+  -74,
+  -23,
+  -43,
+  -40,
+  -45,
+  -29,
+  69,
+  -82,
+  -69,
+  13,
+  23,
+  -2,
+  20,
+  -123,
+  33,
+  -24,
+  -40,
+  -101,
+  -92,
+  -3,
+  52,
+  -4,
+  44,
+  87,
+  -84,
+  -22,
+  42,
+  4,
+  -31,
+  -89,
+  97,
+  -73,
+  -18,
+  -22,
+  -26,
+  101,
+  126,
+  14,
+  5,
+  -126,
+  36,
+  -61,
+  37,
+  -119,
+  -16,
+  52,
+  15,
+  -39,
+  -47,
+  -3,
+  0,
+  109,
+  -94,
+  121,
+  28,
+  11,
+  72,
+  27,
+  126,
+  -56,
+  105,
+  61,
+  72,
+  102,
+  127,
+  92,
+  123,
+  -111,
+  -33,
+  88,
+  25,
+  -80,
+  83,
+  0,
+  -4,
+  44,
+  -101,
+  -107,
+  -87,
+  -102,
+  -127,
+  99,
+  92,
+  2,
+  8,
+  -58,
+  76,
+  -38,
+  38,
+  100,
+  39,
+  -69,
+  73,
+  0,
+  37,
+  -98,
+  83,
+  -95,
+  51,
+  76,
+  -86,
+  -123,
+  -111,
+  -66,
+  -61,
+  74,
+  -81,
+  13,
+  7,
+  -126,
+  42,
+  39,
+  -18,
+  118,
+  37,
+  -47,
+  45,
+  -82,
+  0,
+  -33,
+  56,
+  80,
+  98,
+  32,
+  -37,
+  -73,
+  -90,
+  95,
+  -85,
+  50,
+  -109,
+  -110,
+  77,
+  62,
+  55,
+  -46,
+  96,
+  124,
+  37,
+  36,
+  114,
+  -70,
+  -42,
+  62,
+  98,
+  21,
+  -78,
+  80,
+  58,
+  -66,
+  -104,
+  -86,
+  -56,
+  -86,
+  45,
+  -99,
+  79,
+  36,
+  -63,
+  108,
+  86,
+  49,
+  -62,
+  -72,
+  123,
+  119,
+  102,
+  91,
+  -53,
+  124,
+  -26
+};
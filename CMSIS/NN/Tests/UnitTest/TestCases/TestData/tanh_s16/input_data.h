@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q15_t tanh_s16_input[35] =
+{
+  17985,
+  -27980,
+  17433,
+  27263,
+  17310,
+  -7227,
+  -21777,
+  23661,
+  -11130,
+  -1315,
+  -26220,
+  9756,
+  -15520,
+  -13302,
+  -28566,
+  -30674,
+  -4096,
+  -29736,
+  10053,
+  -17375,
+  -24094,
+  -20296,
+  27911,
+  24537,
+  12062,
+  -12992,
+  -16879,
+  1979,
+  20392,
+  4115,
+  -10529,
+  6897,
+  -16208,
+  -4449,
+  -22138
+};
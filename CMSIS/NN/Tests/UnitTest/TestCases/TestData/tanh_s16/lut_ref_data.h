@@ -0,0 +1,539 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q15_t tanh_s16_lut_ref[513] =
+{
+  -32747,
+  -32745,
+  -32745,
+  -32744,
+  -32744,
+  -32743,
+  -32742,
+  -32741,
+  -32740,
+  -32739,
+  -32738,
+  -32738,
+  -32737,
+  -32736,
+  -32734,
+  -32733,
+  -32732,
+  -32732,
+  -32730,
+  -32729,
+  -32727,
+  -32726,
+  -32725,
+  -32724,
+  -32722,
+  -32721,
+  -32719,
+  -32718,
+  -32716,
+  -32714,
+  -32713,
+  -32711,
+  -32709,
+  -32707,
+  -32705,
+  -32703,
+  -32701,
+  -32699,
+  -32696,
+  -32694,
+  -32692,
+  -32689,
+  -32687,
+  -32684,
+  -32682,
+  -32679,
+  -32676,
+  -32673,
+  -32670,
+  -32667,
+  -32664,
+  -32660,
+  -32657,
+  -32654,
+  -32650,
+  -32646,
+  -32642,
+  -32638,
+  -32634,
+  -32630,
+  -32625,
+  -32621,
+  -32616,
+  -32611,
+  -32606,
+  -32601,
+  -32596,
+  -32591,
+  -32585,
+  -32579,
+  -32573,
+  -32567,
+  -32560,
+  -32554,
+  -32547,
+  -32541,
+  -32533,
+  -32526,
+  -32518,
+  -32510,
+  -32502,
+  -32493,
+  -32485,
+  -32476,
+  -32467,
+  -32457,
+  -32447,
+  -32437,
+  -32426,
+  -32416,
+  -32405,
+  -32393,
+  -32381,
+  -32369,
+  -32356,
+  -32344,
+  -32330,
+  -32316,
+  -32302,
+  -32288,
+  -32272,
+  -32256,
+  -32240,
+  -32224,
+  -32207,
+  -32189,
+  -32170,
+  -32152,
+  -32132,
+  -32112,
+  -32092,
+  -32071,
+  -32048,
+  -32026,
+  -32003,
+  -31979,
+  -31954,
+  -31928,
+  -31903,
+  -31875,
+  -31847,
+  -31818,
+  -31788,
+  -31758,
+  -31726,
+  -31694,
+  -31660,
+  -31626,
+  -31590,
+  -31553,
+  -31515,
+  -31476,
+  -31437,
+  -31395,
+  -31352,
+  -31309,
+  -31263,
+  -31216,
+  -31168,
+  -31118,
+  -31067,
+  -31015,
+  -30961,
+  -30906,
+  -30848,
+  -30788,
+  -30728,
+  -30665,
+  -30600,
+  -30534,
+  -30465,
+  -30395,
+  -30322,
+  -30249,
+  -30172,
+  -30092,
+  -30011,
+  -29927,
+  -29840,
+  -29753,
+  -29661,
+  -29567,
+  -29471,
+  -29371,
+  -29270,
+  -29164,
+  -29057,
+  -28945,
+  -28832,
+  -28714,
+  -28594,
+  -28469,
+  -28342,
+  -28212,
+  -28077,
+  -27940,
+  -27798,
+  -27653,
+  -27503,
+  -27350,
+  -27193,
+  -27031,
+  -26865,
+  -26695,
+  -26520,
+  -26342,
+  -26158,
+  -25971,
+  -25778,
+  -25580,
+  -25378,
+  -25170,
+  -24958,
+  -24740,
+  -24517,
+  -24289,
+  -24055,
+  -23817,
+  -23573,
+  -23323,
+  -23068,
+  -22807,
+  -22539,
+  -22266,
+  -21988,
+  -21704,
+  -21413,
+  -21117,
+  -20814,
+  -20506,
+  -20191,
+  -19871,
+  -19544,
+  -19211,
+  -18872,
+  -18527,
+  -18176,
+  -17818,
+  -17454,
+  -17084,
+  -16708,
+  -16327,
+  -15939,
+  -15545,
+  -15145,
+  -14740,
+  -14328,
+  -13911,
+  -13489,
+  -13061,
+  -12627,
+  -12189,
+  -11745,
+  -11297,
+  -10843,
+  -10384,
+  -9922,
+  -9455,
+  -8983,
+  -8508,
+  -8027,
+  -7544,
+  -7058,
+  -6569,
+  -6075,
+  -5579,
+  -5082,
+  -4581,
+  -4077,
+  -3572,
+  -3065,
+  -2557,
+  -2047,
+  -1537,
+  -1026,
+  -514,
+  -2,
+  510,
+  1022,
+  1533,
+  2043,
+  2553,
+  3062,
+  3569,
+  4074,
+  4577,
+  5077,
+  5575,
+  6071,
+  6564,
+  7055,
+  7542,
+  8024,
+  8503,
+  8979,
+  9450,
+  9917,
+  10381,
+  10839,
+  11293,
+  11741,
+  12186,
+  12624,
+  13057,
+  13486,
+  13907,
+  14325,
+  14736,
+  15142,
+  15542,
+  15935,
+  16323,
+  16705,
+  17081,
+  17451,
+  17815,
+  18172,
+  18524,
+  18870,
+  19209,
+  19542,
+  19869,
+  20189,
+  20504,
+  20812,
+  21115,
+  21411,
+  21702,
+  21986,
+  22265,
+  22538,
+  22805,
+  23065,
+  23321,
+  23571,
+  23815,
+  24054,
+  24287,
+  24516,
+  24738,
+  24956,
+  25168,
+  25376,
+  25578,
+  25775,
+  25969,
+  26157,
+  26341,
+  26519,
+  26694,
+  26864,
+  27029,
+  27192,
+  27348,
+  27502,
+  27651,
+  27797,
+  27938,
+  28077,
+  28210,
+  28341,
+  28469,
+  28593,
+  28714,
+  28830,
+  28944,
+  29055,
+  29163,
+  29268,
+  29370,
+  29470,
+  29566,
+  29660,
+  29752,
+  29840,
+  29926,
+  30010,
+  30091,
+  30170,
+  30248,
+  30322,
+  30395,
+  30465,
+  30534,
+  30600,
+  30664,
+  30728,
+  30788,
+  30847,
+  30905,
+  30961,
+  31014,
+  31067,
+  31118,
+  31168,
+  31216,
+  31262,
+  31308,
+  31352,
+  31394,
+  31436,
+  31477,
+  31515,
+  31553,
+  31589,
+  31626,
+  31660,
+  31694,
+  31726,
+  31757,
+  31788,
+  31818,
+  31847,
+  31875,
+  31902,
+  31928,
+  31954,
+  31978,
+  32002,
+  32026,
+  32048,
+  32070,
+  32091,
+  32112,
+  32132,
+  32152,
+  32171,
+  32188,
+  32206,
+  32223,
+  32240,
+  32256,
+  32272,
+  32287,
+  32302,
+  32316,
+  32330,
+  32343,
+  32357,
+  32369,
+  32381,
+  32393,
+  32404,
+  32416,
+  32427,
+  32437,
+  32447,
+  32457,
+  32466,
+  32476,
+  32485,
+  32494,
+  32502,
+  32510,
+  32518,
+  32525,
+  32533,
+  32540,
+  32548,
+  32554,
+  32561,
+  32567,
+  32573,
+  32579,
+  32585,
+  32591,
+  32596,
+  32601,
+  32606,
+  32611,
+  32617,
+  32621,
+  32626,
+  32630,
+  32634,
+  32638,
+  32642,
+  32646,
+  32650,
+  32653,
+  32657,
+  32660,
+  32664,
+  32667,
+  32670,
+  32673,
+  32676,
+  32679,
+  32682,
+  32685,
+  32687,
+  32690,
+  32692,
+  32694,
+  32697,
+  32699,
+  32701,
+  32703,
+  32705,
+  32707,
+  32709,
+  32711,
+  32712,
+  32714,
+  32716,
+  32717,
+  32719,
+  32721,
+  32722,
+  32723,
+  32724,
+  32726,
+  32727,
+  32729,
+  32730,
+  32731,
+  32732,
+  32733,
+  32734,
+  32736,
+  32737,
+  32738,
+  32738,
+  32739,
+  32740,
+  32742,
+  32742,
+  32743,
+  32744,
+  32744,
+  32745,
+  32746,
+  32747
+};
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q15_t tanh_s16_output_ref[35] =
+{
+  31966,
+  -32698,
+  31852,
+  32685,
+  31825,
+  -23186,
+  -32448,
+  32566,
+  -28708,
+  -5218,
+  -32660,
+  27226,
+  -31320,
+  -30316,
+  -32707,
+  -32732,
+  -15145,
+  -32723,
+  27582,
+  -31840,
+  -32586,
+  -32310,
+  32697,
+  32604,
+  29493,
+  -30132,
+  -31722,
+  7764,
+  32320,
+  15201,
+  -28112,
+  22506,
+  -31539,
+  -16233,
+  -32476
+};
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#define TANH_S8_DST_SIZE 43
+#define TANH_S8_TYPE ARM_TANH
+#define TANH_S8_ALPHA 0.000000000e+00f
+#define TANH_S8_INPUT_SCALE 5.000000075e-02f
+#define TANH_S8_OUTPUT_SCALE 7.812500000e-03f
+#define TANH_S8_INPUT_OFFSET 3
+#define TANH_S8_OUTPUT_OFFSET 0
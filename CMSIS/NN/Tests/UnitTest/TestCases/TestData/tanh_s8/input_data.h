@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t tanh_s8_input[43] =
+{
+  -70,
+  -42,
+  27,
+  -48,
+  -45,
+  -65,
+  -15,
+  -39,
+  -118,
+  28,
+  -42,
+  125,
+  -18,
+  -53,
+  86,
+  -101,
+  68,
+  -23,
+  -29,
+  -108,
+  -27,
+  -92,
+  -9,
+  -14,
+  101,
+  -24,
+  -37,
+  -2,
+  96,
+  74,
+  -80,
+  103,
+  -114,
+  -83,
+  32,
+  55,
+  -1,
+  96,
+  -24,
+  -127,
+  -69,
+  43,
+  80
+};
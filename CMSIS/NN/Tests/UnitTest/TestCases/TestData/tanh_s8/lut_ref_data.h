@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t tanh_s8_lut_ref[256] =
+{
+  19,
+  25,
+  31,
+  37,
+  43,
+  49,
+  54,
+  59,
+  64,
+  69,
+  73,
+  77,
+  81,
+  85,
+  88,
+  92,
+  95,
+  97,
+  100,
+  102,
+  105,
+  107,
+  109,
+  110,
+  112,
+  113,
+  115,
+  116,
+  117,
+  118,
+  119,
+  120,
+  120,
+  121,
+  122,
+  122,
+  123,
+  123,
+  124,
+  124,
+  125,
+  125,
+  125,
+  125,
+  126,
+  126,
+  126,
+  126,
+  126,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  127,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -128,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -127,
+  -126,
+  -126,
+  -126,
+  -126,
+  -126,
+  -125,
+  -125,
+  -125,
+  -125,
+  -124,
+  -124,
+  -123,
+  -123,
+  -122,
+  -122,
+  -121,
+  -120,
+  -120,
+  -119,
+  -118,
+  -117,
+  -116,
+  -115,
+  -113,
+  -112,
+  -110,
+  -109,
+  -107,
+  -105,
+  -102,
+  -100,
+  -97,
+  -95,
+  -92,
+  -88,
+  -85,
+  -81,
+  -77,
+  -73,
+  -69,
+  -64,
+  -59,
+  -54,
+  -49,
+  -43,
+  -37,
+  -31,
+  -25,
+  -19,
+  -13,
+  -6,
+  0,
+  6,
+  13
+};
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+// Generated by generate_test_data.py using a float32 reference implementation.
+#include <stdint.h>
+
+const q7_t tanh_s8_output_ref[43] =
+{
+  -128,
+  -123,
+  116,
+  -125,
+  -124,
+  -127,
+  -69,
+  -121,
+  -128,
+  117,
+  -123,
+  127,
+  -81,
+  -126,
+  127,
+  -128,
+  127,
+  -97,
+  -110,
+  -128,
+  -107,
+  -128,
+  -37,
+  -64,
+  127,
+  -100,
+  -120,
+  6,
+  127,
+  127,
+  -128,
+  127,
+  -128,
+  -128,
+  120,
+  127,
+  13,
+  127,
+  -100,
+  -128,
+  -128,
+  125,
+  127
+};
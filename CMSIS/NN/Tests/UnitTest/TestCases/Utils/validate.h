@@ -49,3 +49,74 @@ inline int validate(int8_t *act, const int8_t *ref, int size)
 
     return test_passed;
 }
+
+inline int validate_s16(int16_t *act, const int16_t *ref, int size)
+{
+    int test_passed = true;
+    int count = 0;
+    int total = 0;
+
+    for(int i = 0; i < size; ++i)
+    {
+      total++;
+      if(act[i] != ref[i])
+      {
+        count++;
+        printf("ERROR at pos %d: Act: %d Ref: %d\r\n", i, act[i], ref[i]);
+        test_passed = false;
+      }
+    }
+
+    if (!test_passed)
+    {
+      printf("%d of %d failed\r\n", count, total);
+    }
+
+    return test_passed;
+}
+
+inline int validate_f32(float *act, const float *ref, int size)
+{
+    int test_passed = true;
+    int count = 0;
+
+    for(int i = 0; i < size; ++i)
+    {
+      if(act[i] != ref[i])
+      {
+        count++;
+        printf("ERROR at pos %d: Act: %.9g Ref: %.9g\r\n", i, act[i], ref[i]);
+        test_passed = false;
+      }
+    }
+
+    if (!test_passed)
+    {
+      printf("%d of %d failed\r\n", count, size);
+    }
+
+    return test_passed;
+}
+
+/* Validates the output of a layer that is a slice of the channels of a larger tensor, starting at channel
+ * ch_offset of each of the num_pos positions. The other channels must still have the value fill.
+ */
+inline int validate_strided(int8_t *act, const int8_t *ref, int num_pos, int ch, int ch_stride, int ch_offset,
+                            int8_t fill)
+{
+    int test_passed = true;
+
+    for(int i = 0; i < num_pos * ch_stride; ++i)
+    {
+      const int pos = i / ch_stride;
+      const int i_ch = i % ch_stride - ch_offset;
+      const int8_t expected = (i_ch >= 0 && i_ch < ch) ? ref[pos * ch + i_ch] : fill;
+      if(act[i] != expected)
+      {
+        printf("ERROR at pos %d: Act: %d Ref: %d\r\n", i, act[i], expected);
+        test_passed = false;
+      }
+    }
+
+    return test_passed;
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/tanh_s16/test_data.h"
+#include "../TestData/sigmoid_s16/test_data.h"
+
+void tanh_s16_arm_activation_lut_s16(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q15_t lut[ARM_NN_ACTIVATION_LUT_S16_SIZE];
+  q15_t output[TANH_S16_DST_SIZE] = {0};
+
+  arm_status result = arm_activation_lut_init_s16(TANH_S16_TYPE,
+                                                  TANH_S16_ALPHA,
+                                                  TANH_S16_INPUT_SCALE,
+                                                  TANH_S16_OUTPUT_SCALE,
+                                                  lut);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(lut, tanh_s16_lut_ref, ARM_NN_ACTIVATION_LUT_S16_SIZE));
+
+  result = arm_activation_lut_s16(tanh_s16_input, output, lut, TANH_S16_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(output, tanh_s16_output_ref, TANH_S16_DST_SIZE));
+}
+
+void sigmoid_s16_arm_activation_lut_s16(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q15_t lut[ARM_NN_ACTIVATION_LUT_S16_SIZE];
+  q15_t output[SIGMOID_S16_DST_SIZE] = {0};
+
+  arm_status result = arm_activation_lut_init_s16(SIGMOID_S16_TYPE,
+                                                  SIGMOID_S16_ALPHA,
+                                                  SIGMOID_S16_INPUT_SCALE,
+                                                  SIGMOID_S16_OUTPUT_SCALE,
+                                                  lut);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(lut, sigmoid_s16_lut_ref, ARM_NN_ACTIVATION_LUT_S16_SIZE));
+
+  result = arm_activation_lut_s16(sigmoid_s16_input, output, lut, SIGMOID_S16_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(output, sigmoid_s16_output_ref, SIGMOID_S16_DST_SIZE));
+}
+
+void invalid_args_arm_activation_lut_s16(void)
+{
+  const arm_status expected = ARM_MATH_ARGUMENT_ERROR;
+  q15_t lut[ARM_NN_ACTIVATION_LUT_S16_SIZE];
+
+  TEST_ASSERT_EQUAL(expected, arm_activation_lut_init_s16(ARM_SIGMOID, 0.0f, 0.0f, 1.0f / 32768, lut));
+  TEST_ASSERT_EQUAL(expected, arm_activation_lut_init_s16(ARM_SIGMOID, 0.0f, 1.0f / 4096, 0.0f, lut));
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/tanh_s8/test_data.h"
+#include "../TestData/sigmoid_s8/test_data.h"
+#include "../TestData/hard_swish_s8/test_data.h"
+#include "../TestData/leaky_relu_s8/test_data.h"
+
+void tanh_s8_arm_activation_lut_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t lut[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+  q7_t output[TANH_S8_DST_SIZE] = {0};
+
+  arm_status result = arm_activation_lut_init_s8(TANH_S8_TYPE,
+                                                 TANH_S8_ALPHA,
+                                                 TANH_S8_INPUT_SCALE,
+                                                 TANH_S8_INPUT_OFFSET,
+                                                 TANH_S8_OUTPUT_SCALE,
+                                                 TANH_S8_OUTPUT_OFFSET,
+                                                 lut);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(lut, tanh_s8_lut_ref, ARM_NN_ACTIVATION_LUT_S8_SIZE));
+
+  result = arm_activation_lut_s8(tanh_s8_input, output, lut, TANH_S8_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, tanh_s8_output_ref, TANH_S8_DST_SIZE));
+}
+
+void sigmoid_s8_arm_activation_lut_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t lut[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+  q7_t output[SIGMOID_S8_DST_SIZE] = {0};
+
+  arm_status result = arm_activation_lut_init_s8(SIGMOID_S8_TYPE,
+                                                 SIGMOID_S8_ALPHA,
+                                                 SIGMOID_S8_INPUT_SCALE,
+                                                 SIGMOID_S8_INPUT_OFFSET,
+                                                 SIGMOID_S8_OUTPUT_SCALE,
+                                                 SIGMOID_S8_OUTPUT_OFFSET,
+                                                 lut);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(lut, sigmoid_s8_lut_ref, ARM_NN_ACTIVATION_LUT_S8_SIZE));
+
+  result = arm_activation_lut_s8(sigmoid_s8_input, output, lut, SIGMOID_S8_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, sigmoid_s8_output_ref, SIGMOID_S8_DST_SIZE));
+}
+
+void hard_swish_s8_arm_activation_lut_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t lut[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+  q7_t output[HARD_SWISH_S8_DST_SIZE] = {0};
+
+  arm_status result = arm_activation_lut_init_s8(HARD_SWISH_S8_TYPE,
+                                                 HARD_SWISH_S8_ALPHA,
+                                                 HARD_SWISH_S8_INPUT_SCALE,
+                                                 HARD_SWISH_S8_INPUT_OFFSET,
+                                                 HARD_SWISH_S8_OUTPUT_SCALE,
+                                                 HARD_SWISH_S8_OUTPUT_OFFSET,
+                                                 lut);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(lut, hard_swish_s8_lut_ref, ARM_NN_ACTIVATION_LUT_S8_SIZE));
+
+  result = arm_activation_lut_s8(hard_swish_s8_input, output, lut, HARD_SWISH_S8_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, hard_swish_s8_output_ref, HARD_SWISH_S8_DST_SIZE));
+}
+
+void leaky_relu_s8_arm_activation_lut_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t lut[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+  q7_t output[LEAKY_RELU_S8_DST_SIZE] = {0};
+
+  arm_status result = arm_activation_lut_init_s8(LEAKY_RELU_S8_TYPE,
+                                                 LEAKY_RELU_S8_ALPHA,
+                                                 LEAKY_RELU_S8_INPUT_SCALE,
+                                                 LEAKY_RELU_S8_INPUT_OFFSET,
+                                                 LEAKY_RELU_S8_OUTPUT_SCALE,
+                                                 LEAKY_RELU_S8_OUTPUT_OFFSET,
+                                                 lut);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(lut, leaky_relu_s8_lut_ref, ARM_NN_ACTIVATION_LUT_S8_SIZE));
+
+  result = arm_activation_lut_s8(leaky_relu_s8_input, output, lut, LEAKY_RELU_S8_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, leaky_relu_s8_output_ref, LEAKY_RELU_S8_DST_SIZE));
+}
+
+void invalid_args_arm_activation_lut_s8(void)
+{
+  const arm_status expected = ARM_MATH_ARGUMENT_ERROR;
+  q7_t lut[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+
+  TEST_ASSERT_EQUAL(expected, arm_activation_lut_init_s8(ARM_TANH, 0.0f, 0.0f, 0, 1.0f / 128, 0, lut));
+  TEST_ASSERT_EQUAL(expected, arm_activation_lut_init_s8(ARM_TANH, 0.0f, 0.05f, 0, -1.0f / 128, 0, lut));
+  TEST_ASSERT_EQUAL(expected,
+                    arm_activation_lut_init_s8((arm_nn_activation_type)(ARM_LEAKY_RELU + 1), 0.0f, 0.05f, 0, 1.0f, 0, lut));
+}
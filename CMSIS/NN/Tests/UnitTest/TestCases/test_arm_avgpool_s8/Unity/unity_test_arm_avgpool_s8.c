@@ -65,3 +65,13 @@ void test_avgpooling_4_arm_avgpool_s8(void)
 {
   avgpooling_4_arm_avgpool_s8();
 }
+
+void test_avgpooling_5_arm_avgpool_s8(void)
+{
+  avgpooling_5_arm_avgpool_s8();
+}
+
+void test_avgpooling_arm_avgpool_s8_requantize(void)
+{
+  avgpooling_arm_avgpool_s8_requantize();
+}
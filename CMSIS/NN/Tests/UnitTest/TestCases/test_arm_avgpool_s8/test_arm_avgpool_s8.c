@@ -24,6 +24,7 @@
 #include "../TestData/avgpooling_2/test_data.h"
 #include "../TestData/avgpooling_3/test_data.h"
 #include "../TestData/avgpooling_4/test_data.h"
+#include "../TestData/avgpooling_5/test_data.h"
 
 void avgpooling_arm_avgpool_s8(void)
 {
@@ -259,3 +260,129 @@ void avgpooling_4_arm_avgpool_s8(void)
   TEST_ASSERT_EQUAL(expected, result);
   TEST_ASSERT_TRUE(validate(output, avgpooling_4_output_ref, AVGPOOLING_4_DST_SIZE));
 }
+
+void avgpooling_5_arm_avgpool_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[AVGPOOLING_5_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_pool_params pool_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = avgpooling_5_input;
+
+  input_dims.n = AVGPOOLING_5_INPUT_BATCHES;
+  input_dims.w = AVGPOOLING_5_INPUT_W;
+  input_dims.h = AVGPOOLING_5_INPUT_H;
+  input_dims.c = AVGPOOLING_5_IN_CH;
+  filter_dims.w = AVGPOOLING_5_FILTER_X;
+  filter_dims.h = AVGPOOLING_5_FILTER_Y;
+  output_dims.w = AVGPOOLING_5_OUTPUT_W;
+  output_dims.h = AVGPOOLING_5_OUTPUT_H;
+  output_dims.c = AVGPOOLING_5_OUT_CH;
+
+  pool_params.padding.w = AVGPOOLING_5_PAD_X;
+  pool_params.padding.h = AVGPOOLING_5_PAD_Y;
+  pool_params.stride.w = AVGPOOLING_5_STRIDE_X;
+  pool_params.stride.h = AVGPOOLING_5_STRIDE_Y;
+
+  pool_params.activation.min = AVGPOOLING_5_OUT_ACTIVATION_MIN;
+  pool_params.activation.max = AVGPOOLING_5_OUT_ACTIVATION_MAX;
+
+  ctx.size = arm_avgpool_s8_get_buffer_size(AVGPOOLING_5_INPUT_W, AVGPOOLING_5_IN_CH);
+  ctx.buf = NULL;
+
+  /* The 20x20 window sums exceed the int16 range */
+  arm_status result = arm_avgpool_s8(&ctx,
+                                     &pool_params,
+                                     &input_dims,
+                                     input_data,
+                                     &filter_dims,
+                                     &output_dims,
+                                     output);
+
+  TEST_ASSERT_EQUAL(0, ctx.size);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, avgpooling_5_output_ref, AVGPOOLING_5_DST_SIZE));
+}
+
+void avgpooling_arm_avgpool_s8_requantize(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const int32_t input_offset = 3;
+  const int32_t output_offset = -5;
+  const int32_t act_min = -50;
+  const int32_t act_max = 60;
+  q7_t output[AVGPOOLING_DST_SIZE] = {0};
+  q7_t output_ref[AVGPOOLING_DST_SIZE];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_pool_params pool_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = avgpooling_input;
+
+  input_dims.n = AVGPOOLING_INPUT_BATCHES;
+  input_dims.w = AVGPOOLING_INPUT_W;
+  input_dims.h = AVGPOOLING_INPUT_H;
+  input_dims.c = AVGPOOLING_IN_CH;
+  filter_dims.w = AVGPOOLING_FILTER_X;
+  filter_dims.h = AVGPOOLING_FILTER_Y;
+  output_dims.w = AVGPOOLING_OUTPUT_W;
+  output_dims.h = AVGPOOLING_OUTPUT_H;
+  output_dims.c = AVGPOOLING_OUT_CH;
+
+  pool_params.padding.w = AVGPOOLING_PAD_X;
+  pool_params.padding.h = AVGPOOLING_PAD_Y;
+  pool_params.stride.w = AVGPOOLING_STRIDE_X;
+  pool_params.stride.h = AVGPOOLING_STRIDE_Y;
+
+  pool_params.activation.min = act_min;
+  pool_params.activation.max = act_max;
+
+  /* Scale 0.707 */
+  quant_params.multiplier = 1518500250;
+  quant_params.shift = 0;
+
+  ctx.size = 0;
+  ctx.buf = NULL;
+
+  /* Reference: the average pooling followed by a separate requantization */
+  arm_requantize_s8(avgpooling_output_ref, input_offset, output_ref, output_offset, &quant_params, AVGPOOLING_DST_SIZE);
+  for (int i = 0; i < AVGPOOLING_DST_SIZE; i++)
+  {
+    output_ref[i] = MIN(MAX(output_ref[i], act_min), act_max);
+  }
+
+  arm_status result = arm_avgpool_s8_requantize(&ctx,
+                                                &pool_params,
+                                                &quant_params,
+                                                input_offset,
+                                                output_offset,
+                                                &input_dims,
+                                                input_data,
+                                                &filter_dims,
+                                                &output_dims,
+                                                output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, AVGPOOLING_DST_SIZE));
+
+  result = arm_avgpool_s8_requantize(&ctx,
+                                     &pool_params,
+                                     NULL,
+                                     input_offset,
+                                     output_offset,
+                                     &input_dims,
+                                     input_data,
+                                     &filter_dims,
+                                     &output_dims,
+                                     output);
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, result);
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/batch_matmul/test_data.h"
+#include "../TestData/batch_matmul_adj/test_data.h"
+
+void batch_matmul_arm_batch_matmul_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[BATCH_MATMUL_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_bmm_params bmm_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims lhs_dims;
+  cmsis_nn_dims rhs_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *lhs_data = batch_matmul_lhs;
+  const q7_t *rhs_data = batch_matmul_rhs;
+  const q7_t *output_ref = batch_matmul_output_ref;
+  const int32_t output_ref_size = BATCH_MATMUL_DST_SIZE;
+
+  lhs_dims.n = BATCH_MATMUL_LHS_BATCHES;
+  lhs_dims.h = 1;
+  lhs_dims.w = BATCH_MATMUL_LHS_ROWS;
+  lhs_dims.c = BATCH_MATMUL_LHS_COLS;
+  rhs_dims.n = BATCH_MATMUL_RHS_BATCHES;
+  rhs_dims.h = 1;
+  rhs_dims.w = BATCH_MATMUL_RHS_ROWS;
+  rhs_dims.c = BATCH_MATMUL_RHS_COLS;
+  output_dims.n = BATCH_MATMUL_OUTPUT_BATCHES;
+  output_dims.h = 1;
+  output_dims.w = BATCH_MATMUL_OUTPUT_ROWS;
+  output_dims.c = BATCH_MATMUL_OUTPUT_COLS;
+
+  bmm_params.adj_x = BATCH_MATMUL_ADJ_X;
+  bmm_params.adj_y = BATCH_MATMUL_ADJ_Y;
+  bmm_params.fc_params.input_offset = BATCH_MATMUL_LHS_OFFSET;
+  bmm_params.fc_params.filter_offset = BATCH_MATMUL_RHS_OFFSET;
+  bmm_params.fc_params.output_offset = BATCH_MATMUL_OUTPUT_OFFSET;
+  bmm_params.fc_params.activation.min = BATCH_MATMUL_OUT_ACTIVATION_MIN;
+  bmm_params.fc_params.activation.max = BATCH_MATMUL_OUT_ACTIVATION_MAX;
+
+  quant_params.multiplier = BATCH_MATMUL_OUTPUT_MULTIPLIER;
+  quant_params.shift = BATCH_MATMUL_OUTPUT_SHIFT;
+
+  const int32_t buf_size = arm_batch_matmul_s8_get_buffer_size(&bmm_params, &lhs_dims, &rhs_dims);
+  ctx.buf = malloc(buf_size);
+  ctx.size = buf_size;
+
+  arm_status result = arm_batch_matmul_s8(&ctx,
+                                          &bmm_params,
+                                          &quant_params,
+                                          &lhs_dims,
+                                          lhs_data,
+                                          &rhs_dims,
+                                          rhs_data,
+                                          &output_dims,
+                                          output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void batch_matmul_adj_arm_batch_matmul_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[BATCH_MATMUL_ADJ_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_bmm_params bmm_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims lhs_dims;
+  cmsis_nn_dims rhs_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *lhs_data = batch_matmul_adj_lhs;
+  const q7_t *rhs_data = batch_matmul_adj_rhs;
+  const q7_t *output_ref = batch_matmul_adj_output_ref;
+  const int32_t output_ref_size = BATCH_MATMUL_ADJ_DST_SIZE;
+
+  lhs_dims.n = BATCH_MATMUL_ADJ_LHS_BATCHES;
+  lhs_dims.h = 1;
+  lhs_dims.w = BATCH_MATMUL_ADJ_LHS_ROWS;
+  lhs_dims.c = BATCH_MATMUL_ADJ_LHS_COLS;
+  rhs_dims.n = BATCH_MATMUL_ADJ_RHS_BATCHES;
+  rhs_dims.h = 1;
+  rhs_dims.w = BATCH_MATMUL_ADJ_RHS_ROWS;
+  rhs_dims.c = BATCH_MATMUL_ADJ_RHS_COLS;
+  output_dims.n = BATCH_MATMUL_ADJ_OUTPUT_BATCHES;
+  output_dims.h = 1;
+  output_dims.w = BATCH_MATMUL_ADJ_OUTPUT_ROWS;
+  output_dims.c = BATCH_MATMUL_ADJ_OUTPUT_COLS;
+
+  bmm_params.adj_x = BATCH_MATMUL_ADJ_ADJ_X;
+  bmm_params.adj_y = BATCH_MATMUL_ADJ_ADJ_Y;
+  bmm_params.fc_params.input_offset = BATCH_MATMUL_ADJ_LHS_OFFSET;
+  bmm_params.fc_params.filter_offset = BATCH_MATMUL_ADJ_RHS_OFFSET;
+  bmm_params.fc_params.output_offset = BATCH_MATMUL_ADJ_OUTPUT_OFFSET;
+  bmm_params.fc_params.activation.min = BATCH_MATMUL_ADJ_OUT_ACTIVATION_MIN;
+  bmm_params.fc_params.activation.max = BATCH_MATMUL_ADJ_OUT_ACTIVATION_MAX;
+
+  quant_params.multiplier = BATCH_MATMUL_ADJ_OUTPUT_MULTIPLIER;
+  quant_params.shift = BATCH_MATMUL_ADJ_OUTPUT_SHIFT;
+
+  const int32_t buf_size = arm_batch_matmul_s8_get_buffer_size(&bmm_params, &lhs_dims, &rhs_dims);
+  ctx.buf = malloc(buf_size);
+  ctx.size = buf_size;
+
+  arm_status result = arm_batch_matmul_s8(&ctx,
+                                          &bmm_params,
+                                          &quant_params,
+                                          &lhs_dims,
+                                          lhs_data,
+                                          &rhs_dims,
+                                          rhs_data,
+                                          &output_dims,
+                                          output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
@@ -80,3 +80,13 @@ void test_conv_1_x_n_3_arm_convolve_s8(void)
 {
   conv_1_x_n_3_arm_convolve_s8();
 }
+
+void test_conv_4_arm_convolve_s8_strided_output(void)
+{
+  conv_4_arm_convolve_s8_strided_output();
+}
+
+void test_conv_4_arm_convolve_s8_lut(void)
+{
+  conv_4_arm_convolve_s8_lut();
+}
@@ -17,6 +17,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "arm_nnfunctions.h"
 
@@ -677,3 +678,167 @@ void conv_1_x_n_3_arm_convolve_s8(void)
   TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS, result);
   TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
+
+void conv_4_arm_convolve_s8_strided_output(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const int32_t ch_stride = CONV_4_OUT_CH + 5;
+  const int32_t ch_offset = 2;
+  const int32_t num_pos = CONV_4_INPUT_BATCHES * CONV_4_OUTPUT_H * CONV_4_OUTPUT_W;
+  q7_t output[CONV_4_INPUT_BATCHES * CONV_4_OUTPUT_H * CONV_4_OUTPUT_W * (CONV_4_OUT_CH + 5)];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_conv_params conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = conv_4_biases;
+  const q7_t *kernel_data = conv_4_weights;
+  const q7_t *input_data = conv_4_input;
+  const q7_t *output_ref = conv_4_output_ref;
+
+  input_dims.n  = CONV_4_INPUT_BATCHES;
+  input_dims.w  = CONV_4_INPUT_W;
+  input_dims.h  = CONV_4_INPUT_H;
+  input_dims.c  = CONV_4_IN_CH;
+  filter_dims.w = CONV_4_FILTER_X;
+  filter_dims.h = CONV_4_FILTER_Y;
+  output_dims.w = CONV_4_OUTPUT_W;
+  output_dims.h = CONV_4_OUTPUT_H;
+  output_dims.c = CONV_4_OUT_CH;
+
+  conv_params.padding.w = CONV_4_PAD_X;
+  conv_params.padding.h = CONV_4_PAD_Y;
+  conv_params.stride.w  = CONV_4_STRIDE_X;
+  conv_params.stride.h  = CONV_4_STRIDE_Y;
+
+  conv_params.input_offset   = CONV_4_INPUT_OFFSET;
+  conv_params.output_offset  = CONV_4_OUTPUT_OFFSET;
+  conv_params.activation.min = CONV_4_OUT_ACTIVATION_MIN;
+  conv_params.activation.max = CONV_4_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)conv_4_output_mult;
+  quant_params.shift      = (int32_t *)conv_4_output_shift;
+
+  memset(output, 0x55, sizeof(output));
+
+  int32_t buf_size = arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+  ctx.buf = malloc(buf_size);
+  ctx.size = 0;
+
+  arm_status result = arm_convolve_s8_strided_output(&ctx,
+                                                     &conv_params,
+                                                     &quant_params,
+                                                     &input_dims,
+                                                     input_data,
+                                                     &filter_dims,
+                                                     kernel_data,
+                                                     &bias_dims,
+                                                     bias_data,
+                                                     &output_dims,
+                                                     output + ch_offset,
+                                                     ch_stride);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_strided(output, output_ref, num_pos, CONV_4_OUT_CH, ch_stride, ch_offset, 0x55));
+
+  result = arm_convolve_s8_strided_output(&ctx,
+                                          &conv_params,
+                                          &quant_params,
+                                          &input_dims,
+                                          input_data,
+                                          &filter_dims,
+                                          kernel_data,
+                                          &bias_dims,
+                                          bias_data,
+                                          &output_dims,
+                                          output,
+                                          CONV_4_OUT_CH - 1);
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, result);
+}
+
+void conv_4_arm_convolve_s8_lut(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[CONV_4_DST_SIZE] = {0};
+  q7_t output_ref[CONV_4_DST_SIZE];
+  q7_t lut[ARM_NN_ACTIVATION_LUT_S8_SIZE];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_conv_params conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = conv_4_biases;
+  const q7_t *kernel_data = conv_4_weights;
+  const q7_t *input_data = conv_4_input;
+  const int32_t output_ref_size = CONV_4_DST_SIZE;
+
+  input_dims.n  = CONV_4_INPUT_BATCHES;
+  input_dims.w  = CONV_4_INPUT_W;
+  input_dims.h  = CONV_4_INPUT_H;
+  input_dims.c  = CONV_4_IN_CH;
+  filter_dims.w = CONV_4_FILTER_X;
+  filter_dims.h = CONV_4_FILTER_Y;
+  output_dims.w = CONV_4_OUTPUT_W;
+  output_dims.h = CONV_4_OUTPUT_H;
+  output_dims.c = CONV_4_OUT_CH;
+
+  conv_params.padding.w = CONV_4_PAD_X;
+  conv_params.padding.h = CONV_4_PAD_Y;
+  conv_params.stride.w  = CONV_4_STRIDE_X;
+  conv_params.stride.h  = CONV_4_STRIDE_Y;
+
+  conv_params.input_offset   = CONV_4_INPUT_OFFSET;
+  conv_params.output_offset  = CONV_4_OUTPUT_OFFSET;
+  conv_params.activation.min = CONV_4_OUT_ACTIVATION_MIN;
+  conv_params.activation.max = CONV_4_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)conv_4_output_mult;
+  quant_params.shift      = (int32_t *)conv_4_output_shift;
+
+  /* The reference is the output of the convolution mapped through the table */
+  arm_status result = arm_activation_lut_init_s8(ARM_HARD_SWISH, 0.0f, 0.05f, -CONV_4_OUTPUT_OFFSET, 0.04f, -3, lut);
+  TEST_ASSERT_EQUAL(expected, result);
+  arm_activation_lut_s8(conv_4_output_ref, output_ref, lut, output_ref_size);
+
+  int32_t buf_size = arm_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+  ctx.buf = malloc(buf_size);
+  ctx.size = 0;
+
+  result = arm_convolve_s8_lut(&ctx,
+                               &conv_params,
+                               &quant_params,
+                               &input_dims,
+                               input_data,
+                               &filter_dims,
+                               kernel_data,
+                               &bias_dims,
+                               bias_data,
+                               &output_dims,
+                               output,
+                               lut);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+  result = arm_convolve_s8_lut(&ctx,
+                               &conv_params,
+                               &quant_params,
+                               &input_dims,
+                               input_data,
+                               &filter_dims,
+                               kernel_data,
+                               &bias_dims,
+                               bias_data,
+                               &output_dims,
+                               output,
+                               NULL);
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, result);
+}
@@ -56,6 +56,8 @@ void depthwise_kernel_3x3_arm_depthwise_conv_3x3_s8(void)
   dw_conv_params.stride.w = DEPTHWISE_KERNEL_3X3_STRIDE_X;
   dw_conv_params.stride.h = DEPTHWISE_KERNEL_3X3_STRIDE_Y;
   dw_conv_params.ch_mult = DEPTHWISE_KERNEL_3X3_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = DEPTHWISE_KERNEL_3X3_INPUT_OFFSET;
   dw_conv_params.output_offset = DEPTHWISE_KERNEL_3X3_OUTPUT_OFFSET;
@@ -116,6 +118,8 @@ void depthwise_kernel_3x3_arm_depthwise_conv_3x3_1_s8(void)
   dw_conv_params.stride.w = DEPTHWISE_KERNEL_3X3_STRIDE_X;
   dw_conv_params.stride.h = DEPTHWISE_KERNEL_3X3_STRIDE_Y;
   dw_conv_params.ch_mult = DEPTHWISE_KERNEL_3X3_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = DEPTHWISE_KERNEL_3X3_INPUT_OFFSET;
   dw_conv_params.output_offset = DEPTHWISE_KERNEL_3X3_OUTPUT_OFFSET;
@@ -175,6 +179,8 @@ void depthwise_kernel_3x3_arm_depthwise_conv_3x3_2_s8(void)
   dw_conv_params.stride.w = DEPTHWISE_KERNEL_3X3_STRIDE_X;
   dw_conv_params.stride.h = DEPTHWISE_KERNEL_3X3_STRIDE_Y;
   dw_conv_params.ch_mult = DEPTHWISE_KERNEL_3X3_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = DEPTHWISE_KERNEL_3X3_INPUT_OFFSET;
   dw_conv_params.output_offset = DEPTHWISE_KERNEL_3X3_OUTPUT_OFFSET;
@@ -16,12 +16,19 @@
  * limitations under the License.
  */
 
+#include <string.h>
+
 #include "arm_nnfunctions.h"
 
 #include "../Utils/validate.h"
 #include "../TestData/basic/test_data.h"
 #include "../TestData/stride2pad1/test_data.h"
 #include "../TestData/depthwise_2/test_data.h"
+#include "../TestData/depthwise_dilation/test_data.h"
+#include "../TestData/depthwise_dilation_mult/test_data.h"
+#include "../TestData/depthwise_dilation_1d/test_data.h"
+
+static const uint16_t dilation = 1;
 
 void basic_arm_depthwise_conv_s8(void)
 {
@@ -55,6 +62,8 @@ void basic_arm_depthwise_conv_s8(void)
   dw_conv_params.stride.w = BASIC_STRIDE_X;
   dw_conv_params.stride.h = BASIC_STRIDE_Y;
   dw_conv_params.ch_mult = 1;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = BASIC_INPUT_OFFSET;
   dw_conv_params.output_offset = BASIC_OUTPUT_OFFSET;
@@ -115,6 +124,8 @@ void stride2pad1_arm_depthwise_conv_s8(void)
   dw_conv_params.stride.w = STRIDE2PAD1_STRIDE_X;
   dw_conv_params.stride.h = STRIDE2PAD1_STRIDE_Y;
   dw_conv_params.ch_mult = 1;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = STRIDE2PAD1_INPUT_OFFSET;
   dw_conv_params.output_offset = STRIDE2PAD1_OUTPUT_OFFSET;
@@ -175,6 +186,8 @@ void depthwise_2_arm_depthwise_conv_s8(void)
   dw_conv_params.stride.w = DEPTHWISE_2_STRIDE_X;
   dw_conv_params.stride.h = DEPTHWISE_2_STRIDE_Y;
   dw_conv_params.ch_mult = DEPTHWISE_2_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = DEPTHWISE_2_INPUT_OFFSET;
   dw_conv_params.output_offset = DEPTHWISE_2_OUTPUT_OFFSET;
@@ -202,3 +215,850 @@ void depthwise_2_arm_depthwise_conv_s8(void)
   TEST_ASSERT_EQUAL(expected, result);
   TEST_ASSERT_TRUE(validate(output, depthwise_2_output_ref, DEPTHWISE_2_DST_SIZE));
 }
+
+void depthwise_2_arm_depthwise_conv_ch_mult_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_2_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_2_biases;
+  const q7_t *kernel_data = depthwise_2_weights;
+  const q7_t *input_data = depthwise_2_input;
+
+  input_dims.n = DEPTHWISE_2_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_2_INPUT_W;
+  input_dims.h = DEPTHWISE_2_INPUT_H;
+  input_dims.c = DEPTHWISE_2_IN_CH;
+  filter_dims.w = DEPTHWISE_2_FILTER_X;
+  filter_dims.h = DEPTHWISE_2_FILTER_Y;
+  output_dims.w = DEPTHWISE_2_OUTPUT_W;
+  output_dims.h = DEPTHWISE_2_OUTPUT_H;
+  output_dims.c = DEPTHWISE_2_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_2_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_2_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_2_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_2_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_2_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
+
+  dw_conv_params.input_offset = DEPTHWISE_2_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_2_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_2_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_2_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_2_output_mult;
+  quant_params.shift = (int32_t *)depthwise_2_output_shift;
+
+  ctx.size = arm_depthwise_conv_ch_mult_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_ch_mult_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_2_output_ref, DEPTHWISE_2_DST_SIZE));
+}
+
+void depthwise_2_arm_depthwise_conv_wrapper_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_2_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_2_biases;
+  const q7_t *kernel_data = depthwise_2_weights;
+  const q7_t *input_data = depthwise_2_input;
+
+  input_dims.n = DEPTHWISE_2_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_2_INPUT_W;
+  input_dims.h = DEPTHWISE_2_INPUT_H;
+  input_dims.c = DEPTHWISE_2_IN_CH;
+  filter_dims.w = DEPTHWISE_2_FILTER_X;
+  filter_dims.h = DEPTHWISE_2_FILTER_Y;
+  output_dims.w = DEPTHWISE_2_OUTPUT_W;
+  output_dims.h = DEPTHWISE_2_OUTPUT_H;
+  output_dims.c = DEPTHWISE_2_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_2_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_2_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_2_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_2_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_2_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
+
+  dw_conv_params.input_offset = DEPTHWISE_2_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_2_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_2_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_2_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_2_output_mult;
+  quant_params.shift = (int32_t *)depthwise_2_output_shift;
+
+  ctx.size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_wrapper_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_2_output_ref, DEPTHWISE_2_DST_SIZE));
+}
+
+void depthwise_dilation_arm_depthwise_conv_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_biases;
+  const q7_t *kernel_data = depthwise_dilation_weights;
+  const q7_t *input_data = depthwise_dilation_input;
+
+  input_dims.n = DEPTHWISE_DILATION_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_output_shift;
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  arm_status result = arm_depthwise_conv_s8(&ctx,
+                                            &dw_conv_params,
+                                            &quant_params,
+                                            &input_dims,
+                                            input_data,
+                                            &filter_dims,
+                                            kernel_data,
+                                            &bias_dims,
+                                            bias_data,
+                                            &output_dims,
+                                            output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_output_ref, DEPTHWISE_DILATION_DST_SIZE));
+}
+
+void depthwise_dilation_arm_depthwise_conv_wrapper_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_biases;
+  const q7_t *kernel_data = depthwise_dilation_weights;
+  const q7_t *input_data = depthwise_dilation_input;
+
+  input_dims.n = DEPTHWISE_DILATION_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_output_shift;
+
+  ctx.size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_wrapper_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_output_ref, DEPTHWISE_DILATION_DST_SIZE));
+}
+
+void depthwise_dilation_mult_arm_depthwise_conv_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_MULT_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_mult_biases;
+  const q7_t *kernel_data = depthwise_dilation_mult_weights;
+  const q7_t *input_data = depthwise_dilation_mult_input;
+
+  input_dims.n = DEPTHWISE_DILATION_MULT_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_MULT_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_MULT_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_MULT_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_MULT_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_MULT_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_MULT_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_MULT_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_MULT_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_MULT_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_MULT_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_MULT_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_MULT_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_MULT_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_MULT_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_MULT_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_MULT_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_MULT_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_mult_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_mult_output_shift;
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  arm_status result = arm_depthwise_conv_s8(&ctx,
+                                            &dw_conv_params,
+                                            &quant_params,
+                                            &input_dims,
+                                            input_data,
+                                            &filter_dims,
+                                            kernel_data,
+                                            &bias_dims,
+                                            bias_data,
+                                            &output_dims,
+                                            output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_mult_output_ref, DEPTHWISE_DILATION_MULT_DST_SIZE));
+}
+
+void depthwise_dilation_mult_arm_depthwise_conv_ch_mult_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_MULT_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_mult_biases;
+  const q7_t *kernel_data = depthwise_dilation_mult_weights;
+  const q7_t *input_data = depthwise_dilation_mult_input;
+
+  input_dims.n = DEPTHWISE_DILATION_MULT_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_MULT_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_MULT_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_MULT_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_MULT_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_MULT_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_MULT_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_MULT_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_MULT_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_MULT_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_MULT_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_MULT_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_MULT_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_MULT_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_MULT_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_MULT_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_MULT_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_MULT_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_mult_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_mult_output_shift;
+
+  ctx.size = arm_depthwise_conv_ch_mult_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_ch_mult_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_mult_output_ref, DEPTHWISE_DILATION_MULT_DST_SIZE));
+}
+
+void depthwise_dilation_mult_arm_depthwise_conv_wrapper_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_MULT_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_mult_biases;
+  const q7_t *kernel_data = depthwise_dilation_mult_weights;
+  const q7_t *input_data = depthwise_dilation_mult_input;
+
+  input_dims.n = DEPTHWISE_DILATION_MULT_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_MULT_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_MULT_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_MULT_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_MULT_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_MULT_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_MULT_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_MULT_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_MULT_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_MULT_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_MULT_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_MULT_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_MULT_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_MULT_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_MULT_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_MULT_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_MULT_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_MULT_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_mult_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_mult_output_shift;
+
+  ctx.size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_wrapper_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_mult_output_ref, DEPTHWISE_DILATION_MULT_DST_SIZE));
+}
+
+void depthwise_dilation_1d_arm_depthwise_conv_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_1D_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_1d_biases;
+  const q7_t *kernel_data = depthwise_dilation_1d_weights;
+  const q7_t *input_data = depthwise_dilation_1d_input;
+
+  input_dims.n = DEPTHWISE_DILATION_1D_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_1D_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_1D_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_1D_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_1D_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_1D_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_1D_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_1D_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_1D_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_1D_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_1D_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_1D_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_1D_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_1D_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_1D_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_1D_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_1D_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_1D_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_1d_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_1d_output_shift;
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  arm_status result = arm_depthwise_conv_s8(&ctx,
+                                            &dw_conv_params,
+                                            &quant_params,
+                                            &input_dims,
+                                            input_data,
+                                            &filter_dims,
+                                            kernel_data,
+                                            &bias_dims,
+                                            bias_data,
+                                            &output_dims,
+                                            output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_1d_output_ref, DEPTHWISE_DILATION_1D_DST_SIZE));
+}
+
+void depthwise_dilation_1d_arm_depthwise_conv_ch_mult_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_1D_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_1d_biases;
+  const q7_t *kernel_data = depthwise_dilation_1d_weights;
+  const q7_t *input_data = depthwise_dilation_1d_input;
+
+  input_dims.n = DEPTHWISE_DILATION_1D_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_1D_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_1D_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_1D_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_1D_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_1D_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_1D_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_1D_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_1D_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_1D_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_1D_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_1D_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_1D_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_1D_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_1D_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_1D_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_1D_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_1D_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_1d_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_1d_output_shift;
+
+  ctx.size = arm_depthwise_conv_ch_mult_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_ch_mult_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_1d_output_ref, DEPTHWISE_DILATION_1D_DST_SIZE));
+}
+
+void depthwise_dilation_1d_arm_depthwise_conv_wrapper_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[DEPTHWISE_DILATION_1D_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_1d_biases;
+  const q7_t *kernel_data = depthwise_dilation_1d_weights;
+  const q7_t *input_data = depthwise_dilation_1d_input;
+
+  input_dims.n = DEPTHWISE_DILATION_1D_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_1D_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_1D_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_1D_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_1D_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_1D_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_1D_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_1D_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_1D_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_1D_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_1D_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_1D_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_1D_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_1D_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_1D_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_1D_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_1D_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_1D_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_1d_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_1d_output_shift;
+
+  ctx.size = arm_depthwise_conv_wrapper_s8_get_buffer_size(&dw_conv_params, &input_dims, &filter_dims, &output_dims);
+  ctx.buf = malloc(ctx.size);
+
+  arm_status result = arm_depthwise_conv_wrapper_s8(&ctx,
+                                                    &dw_conv_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    kernel_data,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, depthwise_dilation_1d_output_ref, DEPTHWISE_DILATION_1D_DST_SIZE));
+}
+
+void depthwise_2_arm_depthwise_conv_s8_strided_output(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const int32_t ch_stride = DEPTHWISE_2_OUT_CH + 3;
+  const int32_t ch_offset = 3;
+  const int32_t num_pos = DEPTHWISE_2_OUTPUT_H * DEPTHWISE_2_OUTPUT_W;
+  q7_t output[DEPTHWISE_2_OUTPUT_H * DEPTHWISE_2_OUTPUT_W * (DEPTHWISE_2_OUT_CH + 3)];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_2_biases;
+  const q7_t *kernel_data = depthwise_2_weights;
+  const q7_t *input_data = depthwise_2_input;
+
+  input_dims.n = DEPTHWISE_2_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_2_INPUT_W;
+  input_dims.h = DEPTHWISE_2_INPUT_H;
+  input_dims.c = DEPTHWISE_2_IN_CH;
+  filter_dims.w = DEPTHWISE_2_FILTER_X;
+  filter_dims.h = DEPTHWISE_2_FILTER_Y;
+  output_dims.w = DEPTHWISE_2_OUTPUT_W;
+  output_dims.h = DEPTHWISE_2_OUTPUT_H;
+  output_dims.c = DEPTHWISE_2_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_2_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_2_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_2_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_2_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_2_CH_MULT;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
+
+  dw_conv_params.input_offset = DEPTHWISE_2_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_2_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_2_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_2_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_2_output_mult;
+  quant_params.shift = (int32_t *)depthwise_2_output_shift;
+
+  memset(output, 0x55, sizeof(output));
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  arm_status result = arm_depthwise_conv_s8_strided_output(&ctx,
+                                                           &dw_conv_params,
+                                                           &quant_params,
+                                                           &input_dims,
+                                                           input_data,
+                                                           &filter_dims,
+                                                           kernel_data,
+                                                           &bias_dims,
+                                                           bias_data,
+                                                           &output_dims,
+                                                           output + ch_offset,
+                                                           ch_stride);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_strided(output,
+                                    depthwise_2_output_ref,
+                                    num_pos,
+                                    DEPTHWISE_2_OUT_CH,
+                                    ch_stride,
+                                    ch_offset,
+                                    0x55));
+}
+
+void depthwise_dilation_1d_arm_depthwise_conv_s8_strided_output(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const int32_t ch_stride = DEPTHWISE_DILATION_1D_OUT_CH + 3;
+  const int32_t ch_offset = 3;
+  const int32_t num_pos = DEPTHWISE_DILATION_1D_OUTPUT_H * DEPTHWISE_DILATION_1D_OUTPUT_W;
+  q7_t output[DEPTHWISE_DILATION_1D_OUTPUT_H * DEPTHWISE_DILATION_1D_OUTPUT_W * (DEPTHWISE_DILATION_1D_OUT_CH + 3)];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_1d_biases;
+  const q7_t *kernel_data = depthwise_dilation_1d_weights;
+  const q7_t *input_data = depthwise_dilation_1d_input;
+
+  input_dims.n = DEPTHWISE_DILATION_1D_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_1D_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_1D_INPUT_H;
+  input_dims.c = DEPTHWISE_DILATION_1D_IN_CH;
+  filter_dims.w = DEPTHWISE_DILATION_1D_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_1D_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_1D_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_1D_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_1D_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_1D_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_1D_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_1D_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_1D_STRIDE_Y;
+  dw_conv_params.ch_mult = DEPTHWISE_DILATION_1D_CH_MULT;
+  dw_conv_params.dilation.w = DEPTHWISE_DILATION_1D_DILATION_X;
+  dw_conv_params.dilation.h = DEPTHWISE_DILATION_1D_DILATION_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_1D_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_1D_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_1D_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_1d_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_1d_output_shift;
+
+  memset(output, 0x55, sizeof(output));
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  arm_status result = arm_depthwise_conv_s8_strided_output(&ctx,
+                                                           &dw_conv_params,
+                                                           &quant_params,
+                                                           &input_dims,
+                                                           input_data,
+                                                           &filter_dims,
+                                                           kernel_data,
+                                                           &bias_dims,
+                                                           bias_data,
+                                                           &output_dims,
+                                                           output + ch_offset,
+                                                           ch_stride);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_strided(output,
+                                    depthwise_dilation_1d_output_ref,
+                                    num_pos,
+                                    DEPTHWISE_DILATION_1D_OUT_CH,
+                                    ch_stride,
+                                    ch_offset,
+                                    0x55));
+}
+
+void depthwise_dilation_invalid_arm_depthwise_conv_s8(void)
+{
+  const arm_status expected = ARM_MATH_ARGUMENT_ERROR;
+  const int32_t invalid_dilations[][2] = {{0, 1}, {1, 0}, {0, 0}, {-1, 2}};
+  const q7_t zero_output[DEPTHWISE_DILATION_MULT_DST_SIZE] = {0};
+  q7_t output[DEPTHWISE_DILATION_MULT_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = depthwise_dilation_mult_biases;
+  const q7_t *kernel_data = depthwise_dilation_mult_weights;
+  const q7_t *input_data = depthwise_dilation_mult_input;
+
+  input_dims.n = DEPTHWISE_DILATION_MULT_INPUT_BATCHES;
+  input_dims.w = DEPTHWISE_DILATION_MULT_INPUT_W;
+  input_dims.h = DEPTHWISE_DILATION_MULT_INPUT_H;
+  filter_dims.w = DEPTHWISE_DILATION_MULT_FILTER_X;
+  filter_dims.h = DEPTHWISE_DILATION_MULT_FILTER_Y;
+  output_dims.w = DEPTHWISE_DILATION_MULT_OUTPUT_W;
+  output_dims.h = DEPTHWISE_DILATION_MULT_OUTPUT_H;
+  output_dims.c = DEPTHWISE_DILATION_MULT_OUT_CH;
+
+  dw_conv_params.padding.w = DEPTHWISE_DILATION_MULT_PAD_X;
+  dw_conv_params.padding.h = DEPTHWISE_DILATION_MULT_PAD_Y;
+  dw_conv_params.stride.w = DEPTHWISE_DILATION_MULT_STRIDE_X;
+  dw_conv_params.stride.h = DEPTHWISE_DILATION_MULT_STRIDE_Y;
+
+  dw_conv_params.input_offset = DEPTHWISE_DILATION_MULT_INPUT_OFFSET;
+  dw_conv_params.output_offset = DEPTHWISE_DILATION_MULT_OUTPUT_OFFSET;
+  dw_conv_params.activation.min = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MIN;
+  dw_conv_params.activation.max = DEPTHWISE_DILATION_MULT_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)depthwise_dilation_mult_output_mult;
+  quant_params.shift = (int32_t *)depthwise_dilation_mult_output_shift;
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  /* A dilation less than 1 is rejected before any output is written, e.g. 0 would divide by zero */
+  for (int i = 0; i < (int)(sizeof(invalid_dilations) / sizeof(invalid_dilations[0])); i++)
+  {
+    dw_conv_params.dilation.w = invalid_dilations[i][0];
+    dw_conv_params.dilation.h = invalid_dilations[i][1];
+
+    /* Channel multiplier of 2 for the generic, the ch_mult and the wrapper function */
+    input_dims.c = DEPTHWISE_DILATION_MULT_IN_CH;
+    dw_conv_params.ch_mult = DEPTHWISE_DILATION_MULT_CH_MULT;
+    TEST_ASSERT_EQUAL(expected, arm_depthwise_conv_s8(&ctx, &dw_conv_params, &quant_params, &input_dims, input_data,
+                                                      &filter_dims, kernel_data, &bias_dims, bias_data,
+                                                      &output_dims, output));
+    TEST_ASSERT_EQUAL(expected, arm_depthwise_conv_s8_strided_output(&ctx, &dw_conv_params, &quant_params,
+                                                                     &input_dims, input_data, &filter_dims,
+                                                                     kernel_data, &bias_dims, bias_data,
+                                                                     &output_dims, output, output_dims.c));
+    TEST_ASSERT_EQUAL(expected, arm_depthwise_conv_ch_mult_s8(&ctx, &dw_conv_params, &quant_params, &input_dims,
+                                                              input_data, &filter_dims, kernel_data, &bias_dims,
+                                                              bias_data, &output_dims, output));
+    TEST_ASSERT_EQUAL(expected, arm_depthwise_conv_wrapper_s8(&ctx, &dw_conv_params, &quant_params, &input_dims,
+                                                              input_data, &filter_dims, kernel_data, &bias_dims,
+                                                              bias_data, &output_dims, output));
+
+    /* Channel multiplier of 1 for the optimized function */
+    input_dims.c = DEPTHWISE_DILATION_MULT_OUT_CH;
+    dw_conv_params.ch_mult = 1;
+    TEST_ASSERT_EQUAL(expected, arm_depthwise_conv_s8_opt(&ctx, &dw_conv_params, &quant_params, &input_dims,
+                                                          input_data, &filter_dims, kernel_data, &bias_dims,
+                                                          bias_data, &output_dims, output));
+    TEST_ASSERT_EQUAL(expected, arm_depthwise_conv_wrapper_s8(&ctx, &dw_conv_params, &quant_params, &input_dims,
+                                                              input_data, &filter_dims, kernel_data, &bias_dims,
+                                                              bias_data, &output_dims, output));
+  }
+  TEST_ASSERT_TRUE(validate(output, zero_output, DEPTHWISE_DILATION_MULT_DST_SIZE));
+}
@@ -59,6 +59,8 @@ void basic_arm_depthwise_conv_s8_opt(void)
   dw_conv_params.stride.w = BASIC_STRIDE_X;
   dw_conv_params.stride.h = BASIC_STRIDE_Y;
   dw_conv_params.ch_mult = 1;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = BASIC_INPUT_OFFSET;
   dw_conv_params.output_offset = BASIC_OUTPUT_OFFSET;
@@ -119,6 +121,8 @@ void stride2pad1_arm_depthwise_conv_s8_opt(void)
   dw_conv_params.stride.w = STRIDE2PAD1_STRIDE_X;
   dw_conv_params.stride.h = STRIDE2PAD1_STRIDE_Y;
   dw_conv_params.ch_mult = 1;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = STRIDE2PAD1_INPUT_OFFSET;
   dw_conv_params.output_offset = STRIDE2PAD1_OUTPUT_OFFSET;
@@ -179,6 +183,8 @@ void depthwise_eq_in_out_ch_arm_depthwise_conv_s8_opt(void)
   dw_conv_params.stride.w = DEPTHWISE_EQ_IN_OUT_CH_STRIDE_X;
   dw_conv_params.stride.h = DEPTHWISE_EQ_IN_OUT_CH_STRIDE_Y;
   dw_conv_params.ch_mult = 1;
+  dw_conv_params.dilation.w = dilation;
+  dw_conv_params.dilation.h = dilation;
 
   dw_conv_params.input_offset = DEPTHWISE_EQ_IN_OUT_CH_INPUT_OFFSET;
   dw_conv_params.output_offset = DEPTHWISE_EQ_IN_OUT_CH_OUTPUT_OFFSET;
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/dequantize/test_data.h"
+
+void dequantize_arm_dequantize_s8_f32(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  float32_t output[DEQUANTIZE_DST_SIZE] = {0};
+
+  arm_status result = arm_dequantize_s8_f32(dequantize_input,
+                                            DEQUANTIZE_INPUT_OFFSET,
+                                            DEQUANTIZE_INPUT_SCALE,
+                                            output,
+                                            DEQUANTIZE_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_f32(output, dequantize_output_ref, DEQUANTIZE_DST_SIZE));
+}
@@ -45,3 +45,8 @@ void test_fully_connected_arm_fully_connected_s8(void)
 {
   fully_connected_arm_fully_connected_s8();
 }
+
+void test_fully_connected_arm_fully_connected_s8_strided_output(void)
+{
+  fully_connected_arm_fully_connected_s8_strided_output();
+}
@@ -17,6 +17,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "arm_nnfunctions.h"
 
@@ -81,3 +82,72 @@ void fully_connected_arm_fully_connected_s8(void)
   TEST_ASSERT_EQUAL(expected, result);
   TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
 }
+
+void fully_connected_arm_fully_connected_s8_strided_output(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const int32_t ch_stride = FULLY_CONNECTED_OUT_CH + 4;
+  const int32_t ch_offset = 4;
+  q7_t output[FULLY_CONNECTED_INPUT_BATCHES * (FULLY_CONNECTED_OUT_CH + 4)];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_fc_params fc_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = fully_connected_biases;
+  const q7_t *kernel_data = fully_connected_weights;
+  const q7_t *input_data = fully_connected_input;
+  const q7_t *output_ref = fully_connected_output_ref;
+
+  input_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+  input_dims.w = FULLY_CONNECTED_INPUT_W;
+  input_dims.h = FULLY_CONNECTED_INPUT_H;
+  input_dims.c = FULLY_CONNECTED_IN_CH;
+  filter_dims.n = FULLY_CONNECTED_ACCUMULATION_DEPTH;
+  filter_dims.c = FULLY_CONNECTED_OUT_CH;
+  output_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+  output_dims.c = FULLY_CONNECTED_OUT_CH;
+
+  fc_params.input_offset = FULLY_CONNECTED_INPUT_OFFSET;
+  fc_params.output_offset = FULLY_CONNECTED_OUTPUT_OFFSET;
+  fc_params.activation.min = FULLY_CONNECTED_OUT_ACTIVATION_MIN;
+  fc_params.activation.max = FULLY_CONNECTED_OUT_ACTIVATION_MAX;
+
+  quant_params.multiplier = FULLY_CONNECTED_OUTPUT_MULTIPLIER;
+  quant_params.shift = FULLY_CONNECTED_OUTPUT_SHIFT;
+
+  memset(output, 0x55, sizeof(output));
+
+  int32_t buf_size = arm_fully_connected_s8_get_buffer_size(&filter_dims);
+  if (buf_size > 0) {
+    ctx.buf = malloc(buf_size);
+  }
+  ctx.size = buf_size;
+
+  arm_status result = arm_fully_connected_s8_strided_output(&ctx,
+                                                            &fc_params,
+                                                            &quant_params,
+                                                            &input_dims,
+                                                            input_data,
+                                                            &filter_dims,
+                                                            kernel_data,
+                                                            &bias_dims,
+                                                            bias_data,
+                                                            &output_dims,
+                                                            output + ch_offset,
+                                                            ch_stride);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_strided(output,
+                                    output_ref,
+                                    FULLY_CONNECTED_INPUT_BATCHES,
+                                    FULLY_CONNECTED_OUT_CH,
+                                    ch_stride,
+                                    ch_offset,
+                                    0x55));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/fully_connected_sparse/test_data.h"
+#include "../TestData/fully_connected_sparse_2/test_data.h"
+
+void fully_connected_sparse_arm_fully_connected_sparse_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[FULLY_CONNECTED_SPARSE_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_fc_params fc_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_sparse_weights kernel;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = fully_connected_sparse_biases;
+  const q7_t *input_data = fully_connected_sparse_input;
+  const q7_t *output_ref = fully_connected_sparse_output_ref;
+  const int32_t output_ref_size = FULLY_CONNECTED_SPARSE_DST_SIZE;
+
+  kernel.values = fully_connected_sparse_weights_values;
+  kernel.block_cols = fully_connected_sparse_weights_block_cols;
+  kernel.row_offsets = fully_connected_sparse_weights_row_offsets;
+
+  input_dims.n = FULLY_CONNECTED_SPARSE_INPUT_BATCHES;
+  input_dims.w = 1;
+  input_dims.h = 1;
+  input_dims.c = FULLY_CONNECTED_SPARSE_IN_CH;
+  filter_dims.n = FULLY_CONNECTED_SPARSE_ACCUMULATION_DEPTH;
+  filter_dims.c = FULLY_CONNECTED_SPARSE_OUT_CH;
+  output_dims.n = FULLY_CONNECTED_SPARSE_INPUT_BATCHES;
+  output_dims.c = FULLY_CONNECTED_SPARSE_OUT_CH;
+
+  fc_params.input_offset = FULLY_CONNECTED_SPARSE_INPUT_OFFSET;
+  fc_params.filter_offset = 0;
+  fc_params.output_offset = FULLY_CONNECTED_SPARSE_OUTPUT_OFFSET;
+  fc_params.activation.min = FULLY_CONNECTED_SPARSE_OUT_ACTIVATION_MIN;
+  fc_params.activation.max = FULLY_CONNECTED_SPARSE_OUT_ACTIVATION_MAX;
+
+  quant_params.multiplier = FULLY_CONNECTED_SPARSE_OUTPUT_MULTIPLIER;
+  quant_params.shift = FULLY_CONNECTED_SPARSE_OUTPUT_SHIFT;
+
+  int32_t buf_size = arm_fully_connected_sparse_s8_get_buffer_size(&filter_dims);
+  ctx.buf = NULL;
+  if (buf_size > 0) {
+    ctx.buf = malloc(buf_size);
+  }
+  ctx.size = buf_size;
+
+  arm_status result = arm_fully_connected_sparse_s8(&ctx,
+                                                    &fc_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    &kernel,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void fully_connected_sparse_2_arm_fully_connected_sparse_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[FULLY_CONNECTED_SPARSE_2_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  cmsis_nn_fc_params fc_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_sparse_weights kernel;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  const q31_t *bias_data = fully_connected_sparse_2_biases;
+  const q7_t *input_data = fully_connected_sparse_2_input;
+  const q7_t *output_ref = fully_connected_sparse_2_output_ref;
+  const int32_t output_ref_size = FULLY_CONNECTED_SPARSE_2_DST_SIZE;
+
+  kernel.values = fully_connected_sparse_2_weights_values;
+  kernel.block_cols = fully_connected_sparse_2_weights_block_cols;
+  kernel.row_offsets = fully_connected_sparse_2_weights_row_offsets;
+
+  input_dims.n = FULLY_CONNECTED_SPARSE_2_INPUT_BATCHES;
+  input_dims.w = 1;
+  input_dims.h = 1;
+  input_dims.c = FULLY_CONNECTED_SPARSE_2_IN_CH;
+  filter_dims.n = FULLY_CONNECTED_SPARSE_2_ACCUMULATION_DEPTH;
+  filter_dims.c = FULLY_CONNECTED_SPARSE_2_OUT_CH;
+  output_dims.n = FULLY_CONNECTED_SPARSE_2_INPUT_BATCHES;
+  output_dims.c = FULLY_CONNECTED_SPARSE_2_OUT_CH;
+
+  fc_params.input_offset = FULLY_CONNECTED_SPARSE_2_INPUT_OFFSET;
+  fc_params.filter_offset = 0;
+  fc_params.output_offset = FULLY_CONNECTED_SPARSE_2_OUTPUT_OFFSET;
+  fc_params.activation.min = FULLY_CONNECTED_SPARSE_2_OUT_ACTIVATION_MIN;
+  fc_params.activation.max = FULLY_CONNECTED_SPARSE_2_OUT_ACTIVATION_MAX;
+
+  quant_params.multiplier = FULLY_CONNECTED_SPARSE_2_OUTPUT_MULTIPLIER;
+  quant_params.shift = FULLY_CONNECTED_SPARSE_2_OUTPUT_SHIFT;
+
+  int32_t buf_size = arm_fully_connected_sparse_s8_get_buffer_size(&filter_dims);
+  ctx.buf = NULL;
+  if (buf_size > 0) {
+    ctx.buf = malloc(buf_size);
+  }
+  ctx.size = buf_size;
+
+  arm_status result = arm_fully_connected_sparse_s8(&ctx,
+                                                    &fc_params,
+                                                    &quant_params,
+                                                    &input_dims,
+                                                    input_data,
+                                                    &filter_dims,
+                                                    &kernel,
+                                                    &bias_dims,
+                                                    bias_data,
+                                                    &output_dims,
+                                                    output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
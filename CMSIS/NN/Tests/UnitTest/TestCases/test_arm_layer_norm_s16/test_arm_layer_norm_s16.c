@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/layer_norm/test_data.h"
+
+void layer_norm_arm_layer_norm_s16(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q15_t output[LAYER_NORM_DST_SIZE] = {0};
+
+  arm_status result = arm_layer_norm_s16(layer_norm_input,
+                                         layer_norm_weights,
+                                         layer_norm_biases,
+                                         LAYER_NORM_OUTPUT_MULTIPLIER,
+                                         LAYER_NORM_OUTPUT_SHIFT,
+                                         LAYER_NORM_VARIANCE_LIMIT,
+                                         LAYER_NORM_NUM_ROWS,
+                                         LAYER_NORM_ROW_SIZE,
+                                         output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(output, layer_norm_output_ref, LAYER_NORM_DST_SIZE));
+}
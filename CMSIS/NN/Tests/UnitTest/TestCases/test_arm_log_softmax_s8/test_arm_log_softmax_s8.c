@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/log_softmax/test_data.h"
+
+void log_softmax_arm_log_softmax_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[LOG_SOFTMAX_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  const q7_t *input_data = log_softmax_input;
+
+  const int32_t buf_size = arm_log_softmax_s8_get_buffer_size();
+  ctx.buf = malloc(buf_size);
+  ctx.size = buf_size;
+
+  arm_status result = arm_log_softmax_s8(&ctx,
+                                         input_data,
+                                         LOG_SOFTMAX_NUM_ROWS,
+                                         LOG_SOFTMAX_ROW_SIZE,
+                                         LOG_SOFTMAX_INPUT_MULT,
+                                         LOG_SOFTMAX_INPUT_LEFT_SHIFT,
+                                         LOG_SOFTMAX_REVERSE_MULT,
+                                         LOG_SOFTMAX_REVERSE_SHIFT,
+                                         LOG_SOFTMAX_DIFF_MIN,
+                                         output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, log_softmax_output_ref, LOG_SOFTMAX_DST_SIZE));
+}
@@ -75,3 +75,8 @@ void test_maxpooling_6_arm_max_pool_s8(void)
 {
   maxpooling_6_arm_max_pool_s8();
 }
+
+void test_maxpooling_6_arm_max_pool_s8_requantize(void)
+{
+  maxpooling_6_arm_max_pool_s8_requantize();
+}
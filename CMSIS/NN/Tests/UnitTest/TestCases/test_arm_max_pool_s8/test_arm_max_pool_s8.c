@@ -349,4 +349,96 @@ void maxpooling_6_arm_max_pool_s8(void)
     TEST_ASSERT_EQUAL(expected, result);
     TEST_ASSERT_TRUE(validate(output, maxpooling_6_output_ref, MAXPOOLING_6_DST_SIZE));
   }
-}
\ No newline at end of file
+}
+
+void maxpooling_6_arm_max_pool_s8_requantize(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const int32_t input_offset = -4;
+  const int32_t output_offset = 7;
+  const int32_t act_min = -20;
+  const int32_t act_max = 40;
+  q7_t output[MAXPOOLING_6_DST_SIZE] = {0};
+  q7_t output_ref[MAXPOOLING_6_DST_SIZE];
+
+  cmsis_nn_context ctx;
+  cmsis_nn_pool_params pool_params;
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = maxpooling_6_input;
+
+  input_dims.n = MAXPOOLING_6_INPUT_BATCHES;
+  input_dims.w = MAXPOOLING_6_INPUT_W;
+  input_dims.h = MAXPOOLING_6_INPUT_H;
+  input_dims.c = MAXPOOLING_6_IN_CH;
+  filter_dims.w = MAXPOOLING_6_FILTER_X;
+  filter_dims.h = MAXPOOLING_6_FILTER_Y;
+  output_dims.w = MAXPOOLING_6_OUTPUT_W;
+  output_dims.h = MAXPOOLING_6_OUTPUT_H;
+  output_dims.c = MAXPOOLING_6_OUT_CH;
+
+  pool_params.padding.w = MAXPOOLING_6_PAD_X;
+  pool_params.padding.h = MAXPOOLING_6_PAD_Y;
+  pool_params.stride.w = MAXPOOLING_6_STRIDE_X;
+  pool_params.stride.h = MAXPOOLING_6_STRIDE_Y;
+
+  pool_params.activation.min = act_min;
+  pool_params.activation.max = act_max;
+
+  /* Scale 1.414 */
+  quant_params.multiplier = 1518500250;
+  quant_params.shift = 1;
+
+  /* The activation alone */
+  for (int i = 0; i < MAXPOOLING_6_DST_SIZE; i++)
+  {
+    output_ref[i] = MIN(MAX(maxpooling_6_output_ref[i], act_min), act_max);
+  }
+
+  arm_status result = arm_max_pool_s8(&ctx,
+                                      &pool_params,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      &output_dims,
+                                      output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, MAXPOOLING_6_DST_SIZE));
+
+  /* Reference: the max pooling followed by a separate requantization */
+  arm_requantize_s8(maxpooling_6_output_ref, input_offset, output_ref, output_offset, &quant_params, MAXPOOLING_6_DST_SIZE);
+  for (int i = 0; i < MAXPOOLING_6_DST_SIZE; i++)
+  {
+    output_ref[i] = MIN(MAX(output_ref[i], act_min), act_max);
+  }
+
+  result = arm_max_pool_s8_requantize(&ctx,
+                                      &pool_params,
+                                      &quant_params,
+                                      input_offset,
+                                      output_offset,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      &output_dims,
+                                      output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, MAXPOOLING_6_DST_SIZE));
+
+  result = arm_max_pool_s8_requantize(&ctx,
+                                      &pool_params,
+                                      NULL,
+                                      input_offset,
+                                      output_offset,
+                                      &input_dims,
+                                      input_data,
+                                      &filter_dims,
+                                      &output_dims,
+                                      output);
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, result);
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/mean_hw/test_data.h"
+#include "../TestData/mean_c/test_data.h"
+#include "../TestData/mean_nwc/test_data.h"
+#include "../TestData/mean_w_long/test_data.h"
+
+void mean_hw_arm_mean_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[MEAN_HW_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = mean_hw_input;
+  const q7_t *output_ref = mean_hw_output_ref;
+  const int32_t output_ref_size = MEAN_HW_DST_SIZE;
+
+  input_dims.n = MEAN_HW_INPUT_BATCHES;
+  input_dims.h = MEAN_HW_INPUT_H;
+  input_dims.w = MEAN_HW_INPUT_W;
+  input_dims.c = MEAN_HW_IN_CH;
+  output_dims.n = MEAN_HW_OUTPUT_BATCHES;
+  output_dims.h = MEAN_HW_OUTPUT_H;
+  output_dims.w = MEAN_HW_OUTPUT_W;
+  output_dims.c = MEAN_HW_OUT_CH;
+
+  quant_params.multiplier = MEAN_HW_OUTPUT_MULTIPLIER;
+  quant_params.shift = MEAN_HW_OUTPUT_SHIFT;
+
+  arm_status result = arm_mean_s8(&input_dims,
+                                  input_data,
+                                  MEAN_HW_INPUT_OFFSET,
+                                  &quant_params,
+                                  MEAN_HW_OUTPUT_OFFSET,
+                                  &output_dims,
+                                  output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void mean_c_arm_mean_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[MEAN_C_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = mean_c_input;
+  const q7_t *output_ref = mean_c_output_ref;
+  const int32_t output_ref_size = MEAN_C_DST_SIZE;
+
+  input_dims.n = MEAN_C_INPUT_BATCHES;
+  input_dims.h = MEAN_C_INPUT_H;
+  input_dims.w = MEAN_C_INPUT_W;
+  input_dims.c = MEAN_C_IN_CH;
+  output_dims.n = MEAN_C_OUTPUT_BATCHES;
+  output_dims.h = MEAN_C_OUTPUT_H;
+  output_dims.w = MEAN_C_OUTPUT_W;
+  output_dims.c = MEAN_C_OUT_CH;
+
+  quant_params.multiplier = MEAN_C_OUTPUT_MULTIPLIER;
+  quant_params.shift = MEAN_C_OUTPUT_SHIFT;
+
+  arm_status result = arm_mean_s8(&input_dims,
+                                  input_data,
+                                  MEAN_C_INPUT_OFFSET,
+                                  &quant_params,
+                                  MEAN_C_OUTPUT_OFFSET,
+                                  &output_dims,
+                                  output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void mean_nwc_arm_mean_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[MEAN_NWC_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = mean_nwc_input;
+  const q7_t *output_ref = mean_nwc_output_ref;
+  const int32_t output_ref_size = MEAN_NWC_DST_SIZE;
+
+  input_dims.n = MEAN_NWC_INPUT_BATCHES;
+  input_dims.h = MEAN_NWC_INPUT_H;
+  input_dims.w = MEAN_NWC_INPUT_W;
+  input_dims.c = MEAN_NWC_IN_CH;
+  output_dims.n = MEAN_NWC_OUTPUT_BATCHES;
+  output_dims.h = MEAN_NWC_OUTPUT_H;
+  output_dims.w = MEAN_NWC_OUTPUT_W;
+  output_dims.c = MEAN_NWC_OUT_CH;
+
+  quant_params.multiplier = MEAN_NWC_OUTPUT_MULTIPLIER;
+  quant_params.shift = MEAN_NWC_OUTPUT_SHIFT;
+
+  arm_status result = arm_mean_s8(&input_dims,
+                                  input_data,
+                                  MEAN_NWC_INPUT_OFFSET,
+                                  &quant_params,
+                                  MEAN_NWC_OUTPUT_OFFSET,
+                                  &output_dims,
+                                  output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void mean_w_long_arm_mean_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[MEAN_W_LONG_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = mean_w_long_input;
+  const q7_t *output_ref = mean_w_long_output_ref;
+  const int32_t output_ref_size = MEAN_W_LONG_DST_SIZE;
+
+  input_dims.n = MEAN_W_LONG_INPUT_BATCHES;
+  input_dims.h = MEAN_W_LONG_INPUT_H;
+  input_dims.w = MEAN_W_LONG_INPUT_W;
+  input_dims.c = MEAN_W_LONG_IN_CH;
+  output_dims.n = MEAN_W_LONG_OUTPUT_BATCHES;
+  output_dims.h = MEAN_W_LONG_OUTPUT_H;
+  output_dims.w = MEAN_W_LONG_OUTPUT_W;
+  output_dims.c = MEAN_W_LONG_OUT_CH;
+
+  quant_params.multiplier = MEAN_W_LONG_OUTPUT_MULTIPLIER;
+  quant_params.shift = MEAN_W_LONG_OUTPUT_SHIFT;
+
+  arm_status result = arm_mean_s8(&input_dims,
+                                  input_data,
+                                  MEAN_W_LONG_INPUT_OFFSET,
+                                  &quant_params,
+                                  MEAN_W_LONG_OUTPUT_OFFSET,
+                                  &output_dims,
+                                  output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void arm_mean_s8_invalid_dims(void)
+{
+  const arm_status expected = ARM_MATH_SIZE_MISMATCH;
+  q7_t output[MEAN_HW_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params = {MEAN_HW_OUTPUT_MULTIPLIER, MEAN_HW_OUTPUT_SHIFT};
+  cmsis_nn_dims input_dims = {MEAN_HW_INPUT_BATCHES, MEAN_HW_INPUT_H, MEAN_HW_INPUT_W, MEAN_HW_IN_CH};
+  cmsis_nn_dims output_dims = {MEAN_HW_OUTPUT_BATCHES, 2, MEAN_HW_OUTPUT_W, MEAN_HW_OUT_CH};
+
+  arm_status result = arm_mean_s8(&input_dims,
+                                  mean_hw_input,
+                                  MEAN_HW_INPUT_OFFSET,
+                                  &quant_params,
+                                  MEAN_HW_OUTPUT_OFFSET,
+                                  &output_dims,
+                                  output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/pad_hw/test_data.h"
+#include "../TestData/pad_nhwc/test_data.h"
+#include "../TestData/conv_4/test_data.h"
+
+void pad_hw_arm_pad_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[PAD_HW_DST_SIZE] = {0};
+
+  const cmsis_nn_dims input_dims = {PAD_HW_INPUT_BATCHES, PAD_HW_INPUT_H, PAD_HW_INPUT_W, PAD_HW_IN_CH};
+  const cmsis_nn_dims pad_before = {PAD_HW_PAD_BEFORE_N, PAD_HW_PAD_BEFORE_H, PAD_HW_PAD_BEFORE_W, PAD_HW_PAD_BEFORE_C};
+  const cmsis_nn_dims pad_after = {PAD_HW_PAD_AFTER_N, PAD_HW_PAD_AFTER_H, PAD_HW_PAD_AFTER_W, PAD_HW_PAD_AFTER_C};
+
+  arm_status result = arm_pad_s8(&input_dims, pad_hw_input, &pad_before, &pad_after, PAD_HW_PAD_VALUE, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, pad_hw_output_ref, PAD_HW_DST_SIZE));
+
+  /* In-place, the input is at the start of the output buffer */
+  memset(output, 0, sizeof(output));
+  memcpy(output, pad_hw_input, sizeof(pad_hw_input));
+  result = arm_pad_s8(&input_dims, output, &pad_before, &pad_after, PAD_HW_PAD_VALUE, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, pad_hw_output_ref, PAD_HW_DST_SIZE));
+}
+
+void pad_nhwc_arm_pad_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[PAD_NHWC_DST_SIZE] = {0};
+
+  const cmsis_nn_dims input_dims = {PAD_NHWC_INPUT_BATCHES, PAD_NHWC_INPUT_H, PAD_NHWC_INPUT_W, PAD_NHWC_IN_CH};
+  const cmsis_nn_dims pad_before = {PAD_NHWC_PAD_BEFORE_N, PAD_NHWC_PAD_BEFORE_H, PAD_NHWC_PAD_BEFORE_W, PAD_NHWC_PAD_BEFORE_C};
+  const cmsis_nn_dims pad_after = {PAD_NHWC_PAD_AFTER_N, PAD_NHWC_PAD_AFTER_H, PAD_NHWC_PAD_AFTER_W, PAD_NHWC_PAD_AFTER_C};
+
+  arm_status result = arm_pad_s8(&input_dims, pad_nhwc_input, &pad_before, &pad_after, PAD_NHWC_PAD_VALUE, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, pad_nhwc_output_ref, PAD_NHWC_DST_SIZE));
+
+  /* In-place, the input is at the start of the output buffer */
+  memset(output, 0, sizeof(output));
+  memcpy(output, pad_nhwc_input, sizeof(pad_nhwc_input));
+  result = arm_pad_s8(&input_dims, output, &pad_before, &pad_after, PAD_NHWC_PAD_VALUE, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, pad_nhwc_output_ref, PAD_NHWC_DST_SIZE));
+}
+
+void conv_4_arm_pad_s8_fold_conv(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  const cmsis_nn_dims pad_before = {0, 1, 2, 0};
+  const cmsis_nn_dims pad_after = {0, 2, 1, 0};
+  const q7_t pad_value = -CONV_4_INPUT_OFFSET;
+
+  cmsis_nn_context ctx;
+  cmsis_nn_conv_params conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims padded_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+
+  input_dims.n  = CONV_4_INPUT_BATCHES;
+  input_dims.w  = CONV_4_INPUT_W;
+  input_dims.h  = CONV_4_INPUT_H;
+  input_dims.c  = CONV_4_IN_CH;
+  padded_dims.n = CONV_4_INPUT_BATCHES;
+  padded_dims.w = CONV_4_INPUT_W + 3;
+  padded_dims.h = CONV_4_INPUT_H + 3;
+  padded_dims.c = CONV_4_IN_CH;
+  filter_dims.w = CONV_4_FILTER_X;
+  filter_dims.h = CONV_4_FILTER_Y;
+  output_dims.w = (padded_dims.w - CONV_4_FILTER_X) / CONV_4_STRIDE_X + 1;
+  output_dims.h = (padded_dims.h - CONV_4_FILTER_Y) / CONV_4_STRIDE_Y + 1;
+  output_dims.c = CONV_4_OUT_CH;
+
+  conv_params.padding.w = 0;
+  conv_params.padding.h = 0;
+  conv_params.stride.w  = CONV_4_STRIDE_X;
+  conv_params.stride.h  = CONV_4_STRIDE_Y;
+
+  conv_params.input_offset   = CONV_4_INPUT_OFFSET;
+  conv_params.output_offset  = CONV_4_OUTPUT_OFFSET;
+  conv_params.activation.min = CONV_4_OUT_ACTIVATION_MIN;
+  conv_params.activation.max = CONV_4_OUT_ACTIVATION_MAX;
+  quant_params.multiplier = (int32_t *)conv_4_output_mult;
+  quant_params.shift      = (int32_t *)conv_4_output_shift;
+
+  const int32_t output_size = CONV_4_INPUT_BATCHES * output_dims.h * output_dims.w * CONV_4_OUT_CH;
+  q7_t *padded = malloc(CONV_4_INPUT_BATCHES * padded_dims.h * padded_dims.w * CONV_4_IN_CH);
+  q7_t *output_ref = malloc(output_size);
+  q7_t *output = malloc(output_size);
+
+  /* Reference: the padded tensor is materialized */
+  arm_status result = arm_pad_s8(&input_dims, conv_4_input, &pad_before, &pad_after, pad_value, padded);
+  TEST_ASSERT_EQUAL(expected, result);
+
+  ctx.buf = malloc(arm_convolve_s8_get_buffer_size(&padded_dims, &filter_dims));
+  ctx.size = 0;
+  result = arm_convolve_s8(&ctx, &conv_params, &quant_params, &padded_dims, padded, &filter_dims, conv_4_weights,
+                           &bias_dims, conv_4_biases, &output_dims, output_ref);
+  TEST_ASSERT_EQUAL(expected, result);
+
+  /* The padding as a view of the unpadded input */
+  result = arm_pad_s8_fold_conv(&pad_before, &pad_after, pad_value, &conv_params);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_EQUAL(2, conv_params.padding.w);
+  TEST_ASSERT_EQUAL(1, conv_params.padding.h);
+
+  result = arm_convolve_s8(&ctx, &conv_params, &quant_params, &input_dims, conv_4_input, &filter_dims, conv_4_weights,
+                           &bias_dims, conv_4_biases, &output_dims, output);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_size));
+
+  /* Only the zero point in H and W can be folded */
+  const cmsis_nn_dims pad_c = {0, 0, 0, 1};
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, arm_pad_s8_fold_conv(&pad_before, &pad_c, pad_value, &conv_params));
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                    arm_pad_s8_fold_conv(&pad_before, &pad_after, pad_value + 1, &conv_params));
+
+  free(ctx.buf);
+  free(padded);
+  free(output_ref);
+  free(output);
+}
+
+void invalid_args_arm_pad_s8(void)
+{
+  const cmsis_nn_dims input_dims = {1, 2, 2, 2};
+  const cmsis_nn_dims pad_before = {0, 1, -1, 0};
+  const cmsis_nn_dims pad_after = {0, 1, 1, 0};
+  const q7_t input[8] = {0};
+  q7_t output[32];
+
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, arm_pad_s8(&input_dims, input, &pad_before, &pad_after, 0, output));
+}
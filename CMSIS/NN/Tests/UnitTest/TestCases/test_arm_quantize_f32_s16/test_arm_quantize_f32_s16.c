@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/quantize_s16/test_data.h"
+
+void quantize_s16_arm_quantize_f32_s16(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q15_t output[QUANTIZE_S16_DST_SIZE] = {0};
+
+  arm_status result = arm_quantize_f32_s16(quantize_s16_input,
+                                           output,
+                                           QUANTIZE_S16_OUTPUT_SCALE,
+                                           QUANTIZE_S16_OUTPUT_OFFSET,
+                                           QUANTIZE_S16_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(output, quantize_s16_output_ref, QUANTIZE_S16_DST_SIZE));
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/reduce_sum_hw/test_data.h"
+
+void reduce_sum_hw_arm_reduce_sum_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[REDUCE_SUM_HW_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims output_dims;
+
+  const q7_t *input_data = reduce_sum_hw_input;
+  const q7_t *output_ref = reduce_sum_hw_output_ref;
+  const int32_t output_ref_size = REDUCE_SUM_HW_DST_SIZE;
+
+  input_dims.n = REDUCE_SUM_HW_INPUT_BATCHES;
+  input_dims.h = REDUCE_SUM_HW_INPUT_H;
+  input_dims.w = REDUCE_SUM_HW_INPUT_W;
+  input_dims.c = REDUCE_SUM_HW_IN_CH;
+  output_dims.n = REDUCE_SUM_HW_OUTPUT_BATCHES;
+  output_dims.h = REDUCE_SUM_HW_OUTPUT_H;
+  output_dims.w = REDUCE_SUM_HW_OUTPUT_W;
+  output_dims.c = REDUCE_SUM_HW_OUT_CH;
+
+  quant_params.multiplier = REDUCE_SUM_HW_OUTPUT_MULTIPLIER;
+  quant_params.shift = REDUCE_SUM_HW_OUTPUT_SHIFT;
+
+  arm_status result = arm_reduce_sum_s8(&input_dims,
+                                        input_data,
+                                        REDUCE_SUM_HW_INPUT_OFFSET,
+                                        &quant_params,
+                                        REDUCE_SUM_HW_OUTPUT_OFFSET,
+                                        &output_dims,
+                                        output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
+
+void arm_reduce_sum_s8_invalid_dims(void)
+{
+  const arm_status expected = ARM_MATH_SIZE_MISMATCH;
+  q7_t output[REDUCE_SUM_HW_DST_SIZE] = {0};
+
+  cmsis_nn_per_tensor_quant_params quant_params = {REDUCE_SUM_HW_OUTPUT_MULTIPLIER, REDUCE_SUM_HW_OUTPUT_SHIFT};
+  cmsis_nn_dims input_dims = {REDUCE_SUM_HW_INPUT_BATCHES, REDUCE_SUM_HW_INPUT_H, REDUCE_SUM_HW_INPUT_W, REDUCE_SUM_HW_IN_CH};
+  cmsis_nn_dims output_dims = {REDUCE_SUM_HW_OUTPUT_BATCHES, 2, REDUCE_SUM_HW_OUTPUT_W, REDUCE_SUM_HW_OUT_CH};
+
+  arm_status result = arm_reduce_sum_s8(&input_dims,
+                                        reduce_sum_hw_input,
+                                        REDUCE_SUM_HW_INPUT_OFFSET,
+                                        &quant_params,
+                                        REDUCE_SUM_HW_OUTPUT_OFFSET,
+                                        &output_dims,
+                                        output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/requantize_per_channel/test_data.h"
+
+void requantize_per_channel_arm_requantize_per_channel_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[REQUANTIZE_PER_CHANNEL_DST_SIZE] = {0};
+
+  cmsis_nn_per_channel_quant_params quant_params;
+  quant_params.multiplier = (int32_t *)requantize_per_channel_output_mult;
+  quant_params.shift = (int32_t *)requantize_per_channel_output_shift;
+
+  arm_status result = arm_requantize_per_channel_s8(requantize_per_channel_input,
+                                                    REQUANTIZE_PER_CHANNEL_INPUT_OFFSET,
+                                                    output,
+                                                    REQUANTIZE_PER_CHANNEL_OUTPUT_OFFSET,
+                                                    &quant_params,
+                                                    REQUANTIZE_PER_CHANNEL_CHANNELS,
+                                                    REQUANTIZE_PER_CHANNEL_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, requantize_per_channel_output_ref, REQUANTIZE_PER_CHANNEL_DST_SIZE));
+}
+
+void arm_requantize_per_channel_s8_invalid_size(void)
+{
+  const arm_status expected = ARM_MATH_SIZE_MISMATCH;
+  q7_t output[REQUANTIZE_PER_CHANNEL_DST_SIZE] = {0};
+
+  cmsis_nn_per_channel_quant_params quant_params;
+  quant_params.multiplier = (int32_t *)requantize_per_channel_output_mult;
+  quant_params.shift = (int32_t *)requantize_per_channel_output_shift;
+
+  arm_status result = arm_requantize_per_channel_s8(requantize_per_channel_input,
+                                                    REQUANTIZE_PER_CHANNEL_INPUT_OFFSET,
+                                                    output,
+                                                    REQUANTIZE_PER_CHANNEL_OUTPUT_OFFSET,
+                                                    &quant_params,
+                                                    REQUANTIZE_PER_CHANNEL_CHANNELS,
+                                                    REQUANTIZE_PER_CHANNEL_DST_SIZE - 1);
+
+  TEST_ASSERT_EQUAL(expected, result);
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/requantize/test_data.h"
+
+void requantize_arm_requantize_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[REQUANTIZE_DST_SIZE] = {0};
+
+  const cmsis_nn_per_tensor_quant_params quant_params = {REQUANTIZE_OUTPUT_MULTIPLIER, REQUANTIZE_OUTPUT_SHIFT};
+
+  arm_status result = arm_requantize_s8(requantize_input,
+                                        REQUANTIZE_INPUT_OFFSET,
+                                        output,
+                                        REQUANTIZE_OUTPUT_OFFSET,
+                                        &quant_params,
+                                        REQUANTIZE_DST_SIZE);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, requantize_output_ref, REQUANTIZE_DST_SIZE));
+}
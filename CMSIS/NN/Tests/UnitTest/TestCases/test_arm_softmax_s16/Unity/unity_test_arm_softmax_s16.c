@@ -16,6 +16,7 @@
  * limitations under the License.
  */
 
+
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -23,7 +24,7 @@
 #include <stdbool.h>
 
 #include "unity.h"
-#include "../test_arm_depthwise_conv_s8.c"
+#include "../test_arm_softmax_s16.c"
 
 /* This function is called from the autogenerated file.
  * The name must be exactly like this
@@ -41,17 +42,17 @@ void tearDown(void)
 
 }
 
-void test_basic_arm_depthwise_conv_s8(void)
+void test_softmax_s16_arm_softmax_s16(void)
 {
-  basic_arm_depthwise_conv_s8();
+  softmax_s16_arm_softmax_s16();
 }
 
-void test_stride2pad1_arm_depthwise_conv_s8(void)
+void test_softmax_s16_2_arm_softmax_s16(void)
 {
-  stride2pad1_arm_depthwise_conv_s8();
+  softmax_s16_2_arm_softmax_s16();
 }
 
-void test_depthwise_2_arm_depthwise_conv_s8(void)
+void test_invalid_args_arm_softmax_s16(void)
 {
-  depthwise_2_arm_depthwise_conv_s8();
+  invalid_args_arm_softmax_s16();
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/softmax_s16/test_data.h"
+#include "../TestData/softmax_s16_2/test_data.h"
+
+void softmax_s16_arm_softmax_s16(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q15_t output[SOFTMAX_S16_DST_SIZE] = {0};
+
+  cmsis_nn_softmax_lut_s16 softmax_params;
+  softmax_params.exp_lut = softmax_s16_exp_lut;
+  softmax_params.one_by_one_lut = softmax_s16_one_by_one_lut;
+
+  arm_status result = arm_softmax_s16(softmax_s16_input,
+                                      SOFTMAX_S16_NUM_ROWS,
+                                      SOFTMAX_S16_ROW_SIZE,
+                                      SOFTMAX_S16_INPUT_MULT,
+                                      SOFTMAX_S16_INPUT_LEFT_SHIFT,
+                                      &softmax_params,
+                                      output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(output, softmax_s16_output_ref, SOFTMAX_S16_DST_SIZE));
+}
+
+void softmax_s16_2_arm_softmax_s16(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q15_t output[SOFTMAX_S16_2_DST_SIZE] = {0};
+
+  cmsis_nn_softmax_lut_s16 softmax_params;
+  softmax_params.exp_lut = softmax_s16_2_exp_lut;
+  softmax_params.one_by_one_lut = softmax_s16_2_one_by_one_lut;
+
+  arm_status result = arm_softmax_s16(softmax_s16_2_input,
+                                      SOFTMAX_S16_2_NUM_ROWS,
+                                      SOFTMAX_S16_2_ROW_SIZE,
+                                      SOFTMAX_S16_2_INPUT_MULT,
+                                      SOFTMAX_S16_2_INPUT_LEFT_SHIFT,
+                                      &softmax_params,
+                                      output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate_s16(output, softmax_s16_2_output_ref, SOFTMAX_S16_2_DST_SIZE));
+}
+
+void invalid_args_arm_softmax_s16(void)
+{
+  const arm_status expected = ARM_MATH_ARGUMENT_ERROR;
+  q15_t output[SOFTMAX_S16_ROW_SIZE];
+
+  cmsis_nn_softmax_lut_s16 softmax_params;
+  softmax_params.exp_lut = NULL;
+  softmax_params.one_by_one_lut = softmax_s16_one_by_one_lut;
+
+  arm_status result = arm_softmax_s16(softmax_s16_input,
+                                      1,
+                                      SOFTMAX_S16_ROW_SIZE,
+                                      SOFTMAX_S16_INPUT_MULT,
+                                      SOFTMAX_S16_INPUT_LEFT_SHIFT,
+                                      &softmax_params,
+                                      output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/softmax/test_data.h"
+#include "../TestData/softmax_2/test_data.h"
+
+void softmax_arm_softmax_s8_fast(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[SOFTMAX_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  const q7_t *input_data = softmax_input;
+
+  const int32_t buf_size = arm_softmax_s8_fast_get_buffer_size();
+  ctx.buf = malloc(buf_size);
+  ctx.size = buf_size;
+
+  arm_status result = arm_softmax_s8_fast(&ctx,
+                                          input_data,
+                                          SOFTMAX_NUM_ROWS,
+                                          SOFTMAX_ROW_SIZE,
+                                          SOFTMAX_INPUT_MULT,
+                                          SOFTMAX_INPUT_LEFT_SHIFT,
+                                          SOFTMAX_DIFF_MIN,
+                                          output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, softmax_output_ref, SOFTMAX_DST_SIZE));
+}
+
+void softmax_2_arm_softmax_s8_fast(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[SOFTMAX_2_DST_SIZE] = {0};
+
+  cmsis_nn_context ctx;
+  const q7_t *input_data = softmax_2_input;
+
+  const int32_t buf_size = arm_softmax_s8_fast_get_buffer_size();
+  ctx.buf = malloc(buf_size);
+  ctx.size = buf_size;
+
+  arm_status result = arm_softmax_s8_fast(&ctx,
+                                          input_data,
+                                          SOFTMAX_2_NUM_ROWS,
+                                          SOFTMAX_2_ROW_SIZE,
+                                          SOFTMAX_2_INPUT_MULT,
+                                          SOFTMAX_2_INPUT_LEFT_SHIFT,
+                                          SOFTMAX_2_DIFF_MIN,
+                                          output);
+
+  free(ctx.buf);
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, softmax_2_output_ref, SOFTMAX_2_DST_SIZE));
+}
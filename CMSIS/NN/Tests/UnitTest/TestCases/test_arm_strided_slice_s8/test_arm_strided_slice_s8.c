@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2010-2020 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+
+#include "arm_nnfunctions.h"
+
+#include "../Utils/validate.h"
+#include "../TestData/strided_slice/test_data.h"
+#include "../TestData/strided_slice_c/test_data.h"
+#include "../TestData/slice_rows/test_data.h"
+
+void strided_slice_arm_strided_slice_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[STRIDED_SLICE_DST_SIZE] = {0};
+
+  const cmsis_nn_dims input_dims = {STRIDED_SLICE_INPUT_BATCHES, STRIDED_SLICE_INPUT_H, STRIDED_SLICE_INPUT_W, STRIDED_SLICE_IN_CH};
+  const cmsis_nn_dims output_dims = {STRIDED_SLICE_OUTPUT_BATCHES, STRIDED_SLICE_OUTPUT_H, STRIDED_SLICE_OUTPUT_W, STRIDED_SLICE_OUT_CH};
+  const cmsis_nn_dims begin = {STRIDED_SLICE_BEGIN_N, STRIDED_SLICE_BEGIN_H, STRIDED_SLICE_BEGIN_W, STRIDED_SLICE_BEGIN_C};
+  const cmsis_nn_dims stride = {STRIDED_SLICE_STRIDE_N, STRIDED_SLICE_STRIDE_H, STRIDED_SLICE_STRIDE_W, STRIDED_SLICE_STRIDE_C};
+
+  arm_status result = arm_strided_slice_s8(&input_dims, strided_slice_input, &begin, &stride, &output_dims, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, strided_slice_output_ref, STRIDED_SLICE_DST_SIZE));
+
+  /* In-place */
+  q7_t buf[sizeof(strided_slice_input)];
+  memcpy(buf, strided_slice_input, sizeof(buf));
+  result = arm_strided_slice_s8(&input_dims, buf, &begin, &stride, &output_dims, buf);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(buf, strided_slice_output_ref, STRIDED_SLICE_DST_SIZE));
+}
+
+void strided_slice_c_arm_strided_slice_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[STRIDED_SLICE_C_DST_SIZE] = {0};
+
+  const cmsis_nn_dims input_dims = {STRIDED_SLICE_C_INPUT_BATCHES, STRIDED_SLICE_C_INPUT_H, STRIDED_SLICE_C_INPUT_W, STRIDED_SLICE_C_IN_CH};
+  const cmsis_nn_dims output_dims = {STRIDED_SLICE_C_OUTPUT_BATCHES, STRIDED_SLICE_C_OUTPUT_H, STRIDED_SLICE_C_OUTPUT_W, STRIDED_SLICE_C_OUT_CH};
+  const cmsis_nn_dims begin = {STRIDED_SLICE_C_BEGIN_N, STRIDED_SLICE_C_BEGIN_H, STRIDED_SLICE_C_BEGIN_W, STRIDED_SLICE_C_BEGIN_C};
+  const cmsis_nn_dims stride = {STRIDED_SLICE_C_STRIDE_N, STRIDED_SLICE_C_STRIDE_H, STRIDED_SLICE_C_STRIDE_W, STRIDED_SLICE_C_STRIDE_C};
+
+  arm_status result = arm_strided_slice_s8(&input_dims, strided_slice_c_input, &begin, &stride, &output_dims, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, strided_slice_c_output_ref, STRIDED_SLICE_C_DST_SIZE));
+}
+
+void slice_rows_arm_strided_slice_s8(void)
+{
+  const arm_status expected = ARM_MATH_SUCCESS;
+  q7_t output[SLICE_ROWS_DST_SIZE] = {0};
+
+  const cmsis_nn_dims input_dims = {SLICE_ROWS_INPUT_BATCHES, SLICE_ROWS_INPUT_H, SLICE_ROWS_INPUT_W, SLICE_ROWS_IN_CH};
+  const cmsis_nn_dims output_dims = {SLICE_ROWS_OUTPUT_BATCHES, SLICE_ROWS_OUTPUT_H, SLICE_ROWS_OUTPUT_W, SLICE_ROWS_OUT_CH};
+  const cmsis_nn_dims begin = {SLICE_ROWS_BEGIN_N, SLICE_ROWS_BEGIN_H, SLICE_ROWS_BEGIN_W, SLICE_ROWS_BEGIN_C};
+  const cmsis_nn_dims stride = {SLICE_ROWS_STRIDE_N, SLICE_ROWS_STRIDE_H, SLICE_ROWS_STRIDE_W, SLICE_ROWS_STRIDE_C};
+
+  arm_status result = arm_strided_slice_s8(&input_dims, slice_rows_input, &begin, &stride, &output_dims, output);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(output, slice_rows_output_ref, SLICE_ROWS_DST_SIZE));
+
+  /* In-place */
+  q7_t buf[sizeof(slice_rows_input)];
+  memcpy(buf, slice_rows_input, sizeof(buf));
+  result = arm_strided_slice_s8(&input_dims, buf, &begin, &stride, &output_dims, buf);
+
+  TEST_ASSERT_EQUAL(expected, result);
+  TEST_ASSERT_TRUE(validate(buf, slice_rows_output_ref, SLICE_ROWS_DST_SIZE));
+}
+
+void invalid_args_arm_strided_slice_s8(void)
+{
+  const cmsis_nn_dims input_dims = {1, 4, 4, 2};
+  const cmsis_nn_dims output_dims = {1, 2, 2, 2};
+  const cmsis_nn_dims begin = {0, 1, 0, 0};
+  const cmsis_nn_dims stride_out_of_range = {1, 3, 1, 1};
+  const cmsis_nn_dims stride_zero = {1, 1, 0, 1};
+  const q7_t input[32] = {0};
+  q7_t output[8];
+
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                    arm_strided_slice_s8(&input_dims, input, &begin, &stride_out_of_range, &output_dims, output));
+  TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                    arm_strided_slice_s8(&input_dims, input, &begin, &stride_zero, &output_dims, output));
+}
@@ -62,7 +62,14 @@ def parse_args():
     parser.add_argument('--regenerate-biases', action='store_true', help="Regenerate and store new biases.")
     parser.add_argument('-a', '--regenerate-all', action='store_true', help="Regenerate and store all data.")
     parser.add_argument('-t', '--type', type=str, default='conv', choices=['conv', 'depthwise_conv', 'avgpool',
-                                                                           'maxpool', 'fully_connected'],
+                                                                           'maxpool', 'fully_connected',
+                                                                           'batch_matmul', 'layer_norm',
+                                                                           'fully_connected_s4', 'conv_1x1_s4',
+                                                                           'fully_connected_sparse',
+                                                                           'depthwise_conv_dilated', 'mean',
+                                                                           'reduce_sum', 'quantize', 'dequantize',
+                                                                           'requantize', 'activation_lut', 'pad',
+                                                                           'strided_slice', 'softmax_s16'],
                         help='Type of test.')
 
     args = parser.parse_args()
@@ -226,16 +233,20 @@ class TestSettings(ABC):
 
         return tf.convert_to_tensor(np_float_array)
 
-    def get_randomized_data(self, dims, npfile, regenerate, decimals=0):
+    def get_randomized_data(self, dims, npfile, regenerate, decimals=0, minrange=None, maxrange=None):
+        if minrange is None:
+            minrange = self.mins
+        if maxrange is None:
+            maxrange = self.maxs
         if not os.path.exists(npfile) or regenerate:
             regendir = os.path.dirname(npfile)
             if not os.path.exists(regendir):
                 os.makedirs(regendir)
             if decimals == 0:
-                data = tf.Variable(tf.random.uniform(dims, minval=self.mins, maxval=self.maxs, dtype=tf.dtypes.int32))
+                data = tf.Variable(tf.random.uniform(dims, minval=minrange, maxval=maxrange, dtype=tf.dtypes.int32))
                 data = tf.cast(data, dtype=tf.float32)
             else:
-                data = tf.Variable(tf.random.uniform(dims, minval=self.mins, maxval=self.maxs, dtype=tf.dtypes.float32))
+                data = tf.Variable(tf.random.uniform(dims, minval=minrange, maxval=maxrange, dtype=tf.dtypes.float32))
                 data = np.around(data.numpy(), decimals)
                 data = tf.convert_to_tensor(data)
 
@@ -316,7 +327,7 @@ class TestSettings(ABC):
             f.write("#define {}_OUT_ACTIVATION_MAX {}\n".format(prefix, self.INT8_MAX))
             f.write("#define {}_INPUT_BATCHES {}\n".format(prefix, self.batches))
 
-    def generate_c_array(self, name, array, datatype="q7_t", const="const "):
+    def generate_c_array(self, name, array, datatype="q7_t", const="const ", fmt="%d"):
         if not os.path.exists(self.headers_dir):
             os.makedirs(self.headers_dir)
 
@@ -341,8 +352,8 @@ class TestSettings(ABC):
             f.write("#include <stdint.h>\n\n")
             f.write(const + datatype + " " + self.testdataset + '_' + name + "[%d] =\n{\n" % size)
             for i in range(size - 1):
-                f.write("  %d,\n" % w[i])
-            f.write("  %d\n" % w[size - 1])
+                f.write("  " + fmt % w[i] + ",\n")
+            f.write("  " + fmt % w[size - 1] + "\n")
             f.write("};\n")
 
     def quantize_output(self, value):
@@ -416,6 +427,30 @@ class TestSettings(ABC):
         significand_q31 = round(significand * (1 << 31))
         return significand_q31, shift
 
+    def saturating_rounding_doubling_high_mul(self, a, b):
+        if a == self.INT32_MIN and b == self.INT32_MIN:
+            return self.INT32_MAX
+        ab = a * b
+        nudge = (1 << 30) if ab >= 0 else (1 - (1 << 30))
+        # Division truncating towards zero, as in C
+        result = abs(ab + nudge) >> 31
+        return result if ab + nudge >= 0 else -result
+
+    def rounding_divide_by_pot(self, x, exponent):
+        mask = (1 << exponent) - 1
+        remainder = x & mask
+        threshold = (mask >> 1) + (1 if x < 0 else 0)
+        return (x >> exponent) + (1 if remainder > threshold else 0)
+
+    def requantize(self, val, multiplier, shift):
+        """
+        Same as MultiplyByQuantizedMultiplier() of TFL, i.e. arm_nn_requantize() of CMSIS-NN
+        """
+        left_shift = max(shift, 0)
+        right_shift = max(-shift, 0)
+        return self.rounding_divide_by_pot(self.saturating_rounding_doubling_high_mul(val * (1 << left_shift),
+                                                                                       multiplier), right_shift)
+
 
 class ConvSettings(TestSettings):
 
@@ -736,6 +771,1145 @@ class FullyConnectedSettings(TestSettings):
         self.write_c_header_wrapper()
 
 
+class BatchMatMulSettings(TestSettings):
+    """
+    The reference output is calculated with integer arithmetic mirroring the TFL int8 BATCH_MATMUL kernel.
+    """
+
+    def __init__(self, args, lhs_batches=1, rhs_batches=1, rows=2, depth=3, cols=4, adj_x=False, adj_y=False,
+                 lhs_zero_point=0, rhs_zero_point=0, output_zero_point=0, lhs_scale=0.5, rhs_scale=0.5,
+                 output_scale=8.0, randmin=TestSettings.INT8_MIN, randmax=TestSettings.INT8_MAX + 1):
+        self.lhs_batches = lhs_batches
+        self.rhs_batches = rhs_batches
+        self.rows = rows
+        self.depth = depth
+        self.cols = cols
+        self.adj_x = int(adj_x)
+        self.adj_y = int(adj_y)
+        super().__init__(args, 1, 1, 1, 1, 1, 1, 1, 1, False, randmin, randmax)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if not self.test_type == 'batch_matmul':
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+        if self.lhs_batches != self.rhs_batches and 1 not in (self.lhs_batches, self.rhs_batches):
+            raise RuntimeError("Batch dimensions can not be broadcast")
+
+        self.lhs_offset = -lhs_zero_point
+        self.rhs_offset = -rhs_zero_point
+        self.output_zero_point = output_zero_point
+        (self.quantized_multiplier, self.quantized_shift) = self.quantize_scale(lhs_scale * rhs_scale / output_scale)
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.lhs_batches, self.rhs_batches, self.rows, self.depth, self.cols, self.adj_x,
+                           self.adj_y])
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.lhs_batches, self.rhs_batches, self.rows, self.depth, self.cols, self.adj_x, self.adj_y) = \
+            (map(lambda x: x, params))
+
+    def lhs_shape(self):
+        return [self.lhs_batches, self.depth, self.rows] if self.adj_x else [self.lhs_batches, self.rows, self.depth]
+
+    def rhs_shape(self):
+        return [self.rhs_batches, self.cols, self.depth] if self.adj_y else [self.rhs_batches, self.depth, self.cols]
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+        lhs_shape = self.lhs_shape()
+        rhs_shape = self.rhs_shape()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_LHS_BATCHES {}\n".format(prefix, self.lhs_batches))
+            f.write("#define {}_LHS_ROWS {}\n".format(prefix, lhs_shape[1]))
+            f.write("#define {}_LHS_COLS {}\n".format(prefix, lhs_shape[2]))
+            f.write("#define {}_RHS_BATCHES {}\n".format(prefix, self.rhs_batches))
+            f.write("#define {}_RHS_ROWS {}\n".format(prefix, rhs_shape[1]))
+            f.write("#define {}_RHS_COLS {}\n".format(prefix, rhs_shape[2]))
+            f.write("#define {}_OUTPUT_BATCHES {}\n".format(prefix, max(self.lhs_batches, self.rhs_batches)))
+            f.write("#define {}_OUTPUT_ROWS {}\n".format(prefix, self.rows))
+            f.write("#define {}_OUTPUT_COLS {}\n".format(prefix, self.cols))
+            f.write("#define {}_ADJ_X {}\n".format(prefix, self.adj_x))
+            f.write("#define {}_ADJ_Y {}\n".format(prefix, self.adj_y))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, max(self.lhs_batches, self.rhs_batches) * self.rows
+                                                      * self.cols))
+            f.write("#define {}_LHS_OFFSET {}\n".format(prefix, self.lhs_offset))
+            f.write("#define {}_RHS_OFFSET {}\n".format(prefix, self.rhs_offset))
+            f.write("#define {}_OUTPUT_OFFSET {}\n".format(prefix, self.output_zero_point))
+            f.write("#define {}_OUTPUT_MULTIPLIER {}\n".format(prefix, self.quantized_multiplier))
+            f.write("#define {}_OUTPUT_SHIFT {}\n".format(prefix, self.quantized_shift))
+            f.write("#define {}_OUT_ACTIVATION_MIN {}\n".format(prefix, self.INT8_MIN))
+            f.write("#define {}_OUT_ACTIVATION_MAX {}\n".format(prefix, self.INT8_MAX))
+
+    def batch_matmul(self, lhs, rhs):
+        batches = max(self.lhs_batches, self.rhs_batches)
+        output = []
+        for b in range(batches):
+            lhs_mat = lhs[b % self.lhs_batches].astype(np.int64) + self.lhs_offset
+            rhs_mat = rhs[b % self.rhs_batches].astype(np.int64) + self.rhs_offset
+            if self.adj_x:
+                lhs_mat = lhs_mat.transpose()
+            if self.adj_y:
+                rhs_mat = rhs_mat.transpose()
+            acc = np.matmul(lhs_mat, rhs_mat)
+            for val in acc.ravel():
+                res = self.requantize(int(val), self.quantized_multiplier, self.quantized_shift)
+                output.append(self.clamp_int8(res + self.output_zero_point))
+        return output
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        lhs = self.get_randomized_data(self.lhs_shape(), self.inputs_table_file, regenerate=self.regenerate_new_input)
+        rhs = self.get_randomized_data(self.rhs_shape(), self.kernel_table_file,
+                                       regenerate=self.regenerate_new_weights)
+        lhs = lhs.numpy().astype(int)
+        rhs = rhs.numpy().astype(int)
+
+        self.generate_c_array("lhs", list(lhs.ravel()))
+        self.generate_c_array("rhs", list(rhs.ravel()))
+        self.generate_c_array("output_ref", self.batch_matmul(lhs, rhs))
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class LayerNormSettings(TestSettings):
+    """
+    The reference output is calculated with integer arithmetic mirroring the layer normalization of the TFL
+    integer LSTM kernel.
+    """
+
+    def __init__(self, args, rows=2, row_size=8, output_scale=1.0, variance_limit=1, randmin=-1000, randmax=1000,
+                 weights_min=-16384, weights_max=16384, bias_min=-65536, bias_max=65536):
+        self.rows = rows
+        self.row_size = row_size
+        self.variance_limit = variance_limit
+        super().__init__(args, 1, 1, 1, 1, 1, 1, 1, 1, False, randmin, randmax)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if not self.test_type == 'layer_norm':
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+
+        self.weights_min = weights_min
+        self.weights_max = weights_max
+        self.bias_min = bias_min
+        self.bias_max = bias_max
+        (self.quantized_multiplier, self.quantized_shift) = self.quantize_scale(output_scale)
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.rows, self.row_size, self.variance_limit])
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.rows, self.row_size, self.variance_limit) = (map(lambda x: x, params))
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_NUM_ROWS {}\n".format(prefix, self.rows))
+            f.write("#define {}_ROW_SIZE {}\n".format(prefix, self.row_size))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, self.rows * self.row_size))
+            f.write("#define {}_OUTPUT_MULTIPLIER {}\n".format(prefix, self.quantized_multiplier))
+            f.write("#define {}_OUTPUT_SHIFT {}\n".format(prefix, self.quantized_shift))
+            f.write("#define {}_VARIANCE_LIMIT {}\n".format(prefix, self.variance_limit))
+
+    def inv_sqrt_quantized_multiplier(self, val):
+        if val <= 1:
+            return self.INT32_MAX, 0
+        shift = 11
+        while val >= (1 << 29):
+            val //= 4
+            shift += 1
+        max_left_shift_bits = 32 - val.bit_length() - 1
+        left_shift_bit_pairs = max_left_shift_bits // 2 - 1
+        shift -= left_shift_bit_pairs
+        val <<= 2 * left_shift_bit_pairs
+
+        def mul(a, b):
+            return self.saturating_rounding_doubling_high_mul(a, b)
+
+        def mul_pot(a, exponent):
+            return max(min(a * (1 << exponent), self.INT32_MAX), self.INT32_MIN)
+
+        # Newton-Raphson iteration in Q3.28
+        half_input = self.rounding_divide_by_pot(val >> 1, 1)
+        half_three = (1 << 28) + (1 << 27)
+        x = 1 << 28
+        for i in range(5):
+            x3 = mul_pot(mul(mul(x, x), x), 6)
+            x = mul_pot(mul(half_three, x) - mul(half_input, x3), 3)
+        x = mul(x, 1518500250)
+        if shift < 0:
+            x <<= -shift
+            shift = 0
+        return x, -shift
+
+    def layer_norm(self, indata, weights, biases):
+        output = []
+        for row in indata:
+            row = [int(v) for v in row]
+            mean = int(sum(row) * 1024 / self.row_size)
+            variance = sum([v * v for v in row]) * ((1 << 20) // self.row_size) - mean * mean
+            variance = int(variance / (1 << 20))
+            if variance < 1:
+                variance = self.variance_limit
+            (inv_mult, inv_shift) = self.inv_sqrt_quantized_multiplier(variance)
+            for j in range(self.row_size):
+                rescaled = self.requantize(1024 * row[j] - mean, inv_mult, inv_shift)
+                val = rescaled * int(weights[j]) + int(biases[j])
+                val = int((val + 512 if val > 0 else val - 512) / 1024)
+                val = self.requantize(val, self.quantized_multiplier, self.quantized_shift + 12)
+                output.append(max(min(val, self.INT16_MAX), -self.INT16_MAX - 1))
+        return output
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data([self.rows, self.row_size], self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+        weights = self.get_randomized_data([self.row_size], self.kernel_table_file,
+                                           regenerate=self.regenerate_new_weights, minrange=self.weights_min,
+                                           maxrange=self.weights_max).numpy().astype(int)
+        biases = self.get_randomized_data([self.row_size], self.bias_table_file, regenerate=self.regenerate_new_bias,
+                                          minrange=self.bias_min, maxrange=self.bias_max).numpy().astype(int)
+
+        self.generate_c_array("input", list(indata.ravel()), datatype="int16_t")
+        self.generate_c_array("weights", list(weights.ravel()), datatype="int16_t")
+        self.generate_c_array("biases", list(biases.ravel()), datatype="int32_t")
+        self.generate_c_array("output_ref", self.layer_norm(indata, weights, biases), datatype="int16_t")
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class Int4WeightsSettings(TestSettings):
+    """
+    Fully connected or 1x1 convolution with symmetric int4 weights packed two per byte, first value in the low
+    nibble. The reference output is calculated with integer arithmetic. Fully connected is quantized per tensor and
+    the 1x1 convolution per output channel.
+    """
+
+    INT4_MAX = 7
+    INT4_MIN = -8
+
+    def __init__(self, args, in_ch=1, out_ch=1, x_in=1, y_in=1, batches=1, input_zero_point=0, output_zero_point=0,
+                 input_scale=0.5, output_scale=4.0, randmin=TestSettings.INT8_MIN, randmax=TestSettings.INT8_MAX + 1):
+        super().__init__(args, in_ch, out_ch, x_in, y_in, 1, 1, 1, 1, False, randmin, randmax, batches=batches)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if self.test_type not in ('fully_connected_s4', 'conv_1x1_s4'):
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+        if self.test_type == 'conv_1x1_s4' and self.input_ch % 2:
+            raise RuntimeError("Number of input channels must be even")
+
+        self.per_channel = self.test_type == 'conv_1x1_s4'
+        self.input_zero_point = input_zero_point
+        self.output_zero_point = output_zero_point
+        self.input_scale = input_scale
+        self.output_scale = output_scale
+
+    def accumulation_depth(self):
+        if self.per_channel:
+            return self.input_ch
+        return self.input_ch * self.x_input * self.y_input
+
+    def lhs_rows(self):
+        if self.per_channel:
+            return self.batches * self.x_input * self.y_input
+        return self.batches
+
+    def weight_scales(self):
+        # Different but fixed scales per output channel, so that they do not need to be stored
+        scales = [0.25 * (1 + (i % 5) / 4) for i in range(self.output_ch)]
+        return scales if self.per_channel else scales[:1] * self.output_ch
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_OUT_CH {}\n".format(prefix, self.output_ch))
+            f.write("#define {}_IN_CH {}\n".format(prefix, self.input_ch))
+            f.write("#define {}_INPUT_W {}\n".format(prefix, self.x_input))
+            f.write("#define {}_INPUT_H {}\n".format(prefix, self.y_input))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, self.lhs_rows() * self.output_ch))
+            f.write("#define {}_INPUT_SIZE {}\n".format(prefix, self.x_input * self.y_input * self.input_ch))
+            f.write("#define {}_INPUT_OFFSET {}\n".format(prefix, -self.input_zero_point))
+            f.write("#define {}_OUTPUT_OFFSET {}\n".format(prefix, self.output_zero_point))
+            f.write("#define {}_OUT_ACTIVATION_MIN {}\n".format(prefix, self.INT8_MIN))
+            f.write("#define {}_OUT_ACTIVATION_MAX {}\n".format(prefix, self.INT8_MAX))
+            f.write("#define {}_INPUT_BATCHES {}\n".format(prefix, self.batches))
+            f.write("#define {}_ACCUMULATION_DEPTH {}\n".format(prefix, self.accumulation_depth()))
+            f.write("#define {}_PACKED_WEIGHTS_SIZE {}\n".format(prefix, (self.accumulation_depth() *
+                                                                          self.output_ch + 1) // 2))
+            if not self.per_channel:
+                (multiplier, shift) = self.quantize_scale(self.input_scale * self.weight_scales()[0] /
+                                                          self.output_scale)
+                f.write("#define {}_OUTPUT_MULTIPLIER {}\n".format(prefix, multiplier))
+                f.write("#define {}_OUTPUT_SHIFT {}\n".format(prefix, shift))
+
+    def pack_int4(self, weights):
+        flat = [int(w) & 0xF for w in weights.ravel()]
+        if len(flat) % 2:
+            flat.append(0)
+        packed = [flat[i] | (flat[i + 1] << 4) for i in range(0, len(flat), 2)]
+        return [p - 256 if p > self.INT8_MAX else p for p in packed]
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        depth = self.accumulation_depth()
+        indata = self.get_randomized_data([self.lhs_rows(), depth], self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+        weights = self.get_randomized_data([self.output_ch, depth], self.kernel_table_file,
+                                           regenerate=self.regenerate_new_weights, minrange=self.INT4_MIN,
+                                           maxrange=self.INT4_MAX + 1).numpy().astype(int)
+        biases = self.get_randomized_data([self.output_ch], self.bias_table_file, regenerate=self.regenerate_new_bias,
+                                          minrange=-1000, maxrange=1000).numpy().astype(int)
+
+        quant = [self.quantize_scale(self.input_scale * scale / self.output_scale) for scale in self.weight_scales()]
+        output = []
+        for row in indata:
+            for ch in range(self.output_ch):
+                acc = int(np.dot(row + (-self.input_zero_point), weights[ch])) + int(biases[ch])
+                res = self.requantize(acc, quant[ch][0], quant[ch][1]) + self.output_zero_point
+                output.append(self.clamp_int8(res))
+
+        self.generate_c_array("input", list(indata.ravel()))
+        self.generate_c_array("packed_weights", self.pack_int4(weights))
+        self.generate_c_array("biases", list(biases.ravel()), datatype="int32_t")
+        if self.per_channel:
+            self.generate_c_array("output_mult", [q[0] for q in quant], datatype="int32_t")
+            self.generate_c_array("output_shift", [q[1] for q in quant], datatype="int32_t")
+        self.generate_c_array("output_ref", output)
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class SparseFullyConnectedSettings(TestSettings):
+    """
+    Fully connected with the weights in the block sparse format of cmsis_nn_sparse_weights. The reference output is
+    calculated with integer arithmetic on the dense weights.
+    """
+
+    BLOCK_SIZE = 4
+
+    def __init__(self, args, in_ch=1, out_ch=1, batches=1, sparsity=0.5, input_zero_point=0, output_zero_point=0,
+                 input_scale=0.5, weights_scale=0.25, output_scale=16.0, randmin=TestSettings.INT8_MIN,
+                 randmax=TestSettings.INT8_MAX + 1):
+        self.sparsity = sparsity
+        super().__init__(args, in_ch, out_ch, 1, 1, 1, 1, 1, 1, False, randmin, randmax, batches=batches)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if not self.test_type == 'fully_connected_sparse':
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+
+        self.input_zero_point = input_zero_point
+        self.output_zero_point = output_zero_point
+        (self.quantized_multiplier, self.quantized_shift) = self.quantize_scale(input_scale * weights_scale /
+                                                                                output_scale)
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_OUT_CH {}\n".format(prefix, self.output_ch))
+            f.write("#define {}_IN_CH {}\n".format(prefix, self.input_ch))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, self.batches * self.output_ch))
+            f.write("#define {}_INPUT_SIZE {}\n".format(prefix, self.input_ch))
+            f.write("#define {}_INPUT_OFFSET {}\n".format(prefix, -self.input_zero_point))
+            f.write("#define {}_OUTPUT_OFFSET {}\n".format(prefix, self.output_zero_point))
+            f.write("#define {}_OUT_ACTIVATION_MIN {}\n".format(prefix, self.INT8_MIN))
+            f.write("#define {}_OUT_ACTIVATION_MAX {}\n".format(prefix, self.INT8_MAX))
+            f.write("#define {}_INPUT_BATCHES {}\n".format(prefix, self.batches))
+            f.write("#define {}_OUTPUT_MULTIPLIER {}\n".format(prefix, self.quantized_multiplier))
+            f.write("#define {}_OUTPUT_SHIFT {}\n".format(prefix, self.quantized_shift))
+            f.write("#define {}_ACCUMULATION_DEPTH {}\n".format(prefix, self.input_ch))
+
+    def convert_to_block_sparse(self, weights):
+        num_blocks = (self.input_ch + self.BLOCK_SIZE - 1) // self.BLOCK_SIZE
+        padded = np.zeros((self.output_ch, num_blocks * self.BLOCK_SIZE), dtype=int)
+        padded[:, :self.input_ch] = weights
+        values = []
+        block_cols = []
+        row_offsets = [0]
+        for row in padded:
+            for block in range(num_blocks):
+                block_values = row[block * self.BLOCK_SIZE:(block + 1) * self.BLOCK_SIZE]
+                if np.any(block_values):
+                    values.extend(block_values.tolist())
+                    block_cols.append(block)
+            row_offsets.append(len(block_cols))
+        return values, block_cols, row_offsets
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data([self.batches, self.input_ch], self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+        weights = self.get_randomized_data([self.output_ch, self.input_ch], self.kernel_table_file,
+                                           regenerate=self.regenerate_new_weights).numpy().astype(int)
+        biases = self.get_randomized_data([self.output_ch], self.bias_table_file, regenerate=self.regenerate_new_bias,
+                                          minrange=-2000, maxrange=2000).numpy().astype(int)
+
+        # Zero whole blocks, deterministically from the weights so that it is the same when they are loaded
+        num_blocks = (self.input_ch + self.BLOCK_SIZE - 1) // self.BLOCK_SIZE
+        for row in range(self.output_ch):
+            for block in range(num_blocks):
+                if ((row * 7919 + block * 104729) % 1000) < self.sparsity * 1000:
+                    weights[row, block * self.BLOCK_SIZE:(block + 1) * self.BLOCK_SIZE] = 0
+
+        output = []
+        for row in indata:
+            for ch in range(self.output_ch):
+                acc = int(np.dot(row + (-self.input_zero_point), weights[ch])) + int(biases[ch])
+                res = self.requantize(acc, self.quantized_multiplier, self.quantized_shift)
+                output.append(self.clamp_int8(res + self.output_zero_point))
+
+        (values, block_cols, row_offsets) = self.convert_to_block_sparse(weights)
+        self.generate_c_array("input", list(indata.ravel()))
+        self.generate_c_array("weights_values", values)
+        self.generate_c_array("weights_block_cols", block_cols, datatype="uint16_t")
+        self.generate_c_array("weights_row_offsets", row_offsets, datatype="int32_t")
+        self.generate_c_array("biases", list(biases.ravel()), datatype="int32_t")
+        self.generate_c_array("output_ref", output)
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class DilatedDepthwiseConvSettings(TestSettings):
+    """
+    Depthwise convolution with dilation and/or a channel multiplier, per channel quantized. The reference output is
+    calculated with integer arithmetic.
+    """
+
+    def __init__(self, args, in_ch=1, out_ch=1, x_in=7, y_in=7, w_x=3, w_y=3, stride_x=1, stride_y=1, dilation_x=1,
+                 dilation_y=1, pad=True, input_zero_point=0, output_zero_point=0, input_scale=0.5, output_scale=32.0,
+                 randmin=TestSettings.INT8_MIN, randmax=TestSettings.INT8_MAX + 1):
+        self.dilation_x = dilation_x
+        self.dilation_y = dilation_y
+        super().__init__(args, in_ch, out_ch, x_in, y_in, w_x, w_y, stride_x, stride_y, pad, randmin, randmax)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if not self.test_type == 'depthwise_conv_dilated':
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+        if self.output_ch % self.input_ch != 0:
+            raise RuntimeError("out channel ({}) is not multiple of in channel ({})".format(out_ch, in_ch))
+
+        self.channel_multiplier = self.output_ch // self.input_ch
+        self.input_zero_point = input_zero_point
+        self.output_zero_point = output_zero_point
+        self.input_scale = input_scale
+        self.output_scale = output_scale
+
+    def set_output_dims_and_padding(self):
+        filter_x = (self.filter_x - 1) * self.dilation_x + 1
+        filter_y = (self.filter_y - 1) * self.dilation_y + 1
+        if self.has_padding:
+            self.x_output = math.ceil(float(self.x_input) / float(self.stride_x))
+            self.y_output = math.ceil(float(self.y_input) / float(self.stride_y))
+            self.padding = 'SAME'
+            pad_along_width = max((self.x_output - 1) * self.stride_x + filter_x - self.x_input, 0)
+            pad_along_height = max((self.y_output - 1) * self.stride_y + filter_y - self.y_input, 0)
+            self.pad_x = pad_along_width // 2
+            self.pad_y = pad_along_height // 2
+        else:
+            self.x_output = math.ceil(float(self.x_input - filter_x + 1) / float(self.stride_x))
+            self.y_output = math.ceil(float(self.y_input - filter_y + 1) / float(self.stride_y))
+            self.padding = 'VALID'
+            self.pad_x = 0
+            self.pad_y = 0
+
+    def save_parameters(self):
+        super().save_parameters()
+        with open(self.parameters_file, 'a') as f:
+            np.savetxt(f, np.array([self.dilation_x, self.dilation_y]), fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.input_ch, self.output_ch, self.x_input, self.y_input, self.filter_x, self.filter_y,
+         self.stride_x, self.stride_y, self.pad_x, self.pad_y, self.batches, self.has_padding,
+         self.dilation_x, self.dilation_y) = (map(lambda x: x, params))
+        self.set_output_dims_and_padding()
+
+    def weight_scales(self):
+        # Different but fixed scales per output channel, so that they do not need to be stored
+        return [0.25 * (1 + (i % 5) / 4) for i in range(self.output_ch)]
+
+    def write_c_config_header(self):
+        super().write_c_config_header()
+
+        filename = self.config_data
+        filepath = self.headers_dir + filename
+        prefix = self.testdataset.upper()
+
+        with open(filepath, "a") as f:
+            self.write_common_config(f, prefix)
+            f.write("#define {}_CH_MULT {}\n".format(prefix, self.channel_multiplier))
+            f.write("#define {}_DILATION_X {}\n".format(prefix, self.dilation_x))
+            f.write("#define {}_DILATION_Y {}\n".format(prefix, self.dilation_y))
+
+    def depthwise_conv(self, indata, weights, biases, quant):
+        output = []
+        for out_y in range(self.y_output):
+            for out_x in range(self.x_output):
+                base_y = out_y * self.stride_y - self.pad_y
+                base_x = out_x * self.stride_x - self.pad_x
+                for out_ch in range(self.output_ch):
+                    in_ch = out_ch // self.channel_multiplier
+                    acc = int(biases[out_ch])
+                    for ker_y in range(self.filter_y):
+                        in_y = base_y + ker_y * self.dilation_y
+                        if in_y < 0 or in_y >= self.y_input:
+                            continue
+                        for ker_x in range(self.filter_x):
+                            in_x = base_x + ker_x * self.dilation_x
+                            if in_x < 0 or in_x >= self.x_input:
+                                continue
+                            acc += (int(indata[in_y, in_x, in_ch]) - self.input_zero_point) * \
+                                int(weights[ker_y, ker_x, out_ch])
+                    res = self.requantize(acc, quant[out_ch][0], quant[out_ch][1]) + self.output_zero_point
+                    output.append(self.clamp_int8(res))
+        return output
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data([self.y_input, self.x_input, self.input_ch], self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+        weights = self.get_randomized_data([self.filter_y, self.filter_x, self.output_ch], self.kernel_table_file,
+                                           regenerate=self.regenerate_new_weights, minrange=-self.INT8_MAX,
+                                           maxrange=self.INT8_MAX + 1).numpy().astype(int)
+        biases = self.get_randomized_data([self.output_ch], self.bias_table_file, regenerate=self.regenerate_new_bias,
+                                          minrange=-2000, maxrange=2000).numpy().astype(int)
+
+        quant = [self.quantize_scale(self.input_scale * scale / self.output_scale) for scale in self.weight_scales()]
+        output = self.depthwise_conv(indata, weights, biases, quant)
+
+        self.generate_c_array("input", list(indata.ravel()))
+        self.generate_c_array("weights", list(weights.ravel()))
+        self.generate_c_array("biases", list(biases.ravel()), datatype="int32_t")
+        self.generate_c_array("output_mult", [q[0] for q in quant], datatype="int32_t")
+        self.generate_c_array("output_shift", [q[1] for q in quant], datatype="int32_t")
+        self.generate_c_array("output_ref", output)
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class ReduceSettings(TestSettings):
+    """
+    Mean or sum over the axes that are set in reduce_axes, with the integer arithmetic of the TFL int8 MEAN kernel.
+    The reduced axes have a dimension of one in the output.
+    """
+
+    def __init__(self, args, batches=1, y_in=4, x_in=4, in_ch=8, reduce_axes=(1, 2), input_zero_point=0,
+                 output_zero_point=0, input_scale=0.5, output_scale=0.5, randmin=TestSettings.INT8_MIN,
+                 randmax=TestSettings.INT8_MAX + 1):
+        self.reduce_axes = [int(axis in reduce_axes) for axis in range(4)]
+        super().__init__(args, in_ch, in_ch, x_in, y_in, 1, 1, 1, 1, False, randmin, randmax, batches=batches)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if self.test_type not in ('mean', 'reduce_sum'):
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+
+        self.input_zero_point = input_zero_point
+        self.output_zero_point = output_zero_point
+        (self.quantized_multiplier, self.quantized_shift) = self.quantize_scale(input_scale / output_scale)
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.batches, self.y_input, self.x_input, self.input_ch] + self.reduce_axes)
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.batches, self.y_input, self.x_input, self.input_ch) = (map(lambda x: x, params[:4]))
+        self.reduce_axes = list(params[4:])
+
+    def input_shape(self):
+        return [self.batches, self.y_input, self.x_input, self.input_ch]
+
+    def output_shape(self):
+        return [1 if reduced else dim for (dim, reduced) in zip(self.input_shape(), self.reduce_axes)]
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+        output_shape = self.output_shape()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_INPUT_BATCHES {}\n".format(prefix, self.batches))
+            f.write("#define {}_INPUT_H {}\n".format(prefix, self.y_input))
+            f.write("#define {}_INPUT_W {}\n".format(prefix, self.x_input))
+            f.write("#define {}_IN_CH {}\n".format(prefix, self.input_ch))
+            f.write("#define {}_OUTPUT_BATCHES {}\n".format(prefix, output_shape[0]))
+            f.write("#define {}_OUTPUT_H {}\n".format(prefix, output_shape[1]))
+            f.write("#define {}_OUTPUT_W {}\n".format(prefix, output_shape[2]))
+            f.write("#define {}_OUT_CH {}\n".format(prefix, output_shape[3]))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, int(np.prod(output_shape))))
+            f.write("#define {}_INPUT_OFFSET {}\n".format(prefix, -self.input_zero_point))
+            f.write("#define {}_OUTPUT_OFFSET {}\n".format(prefix, self.output_zero_point))
+            f.write("#define {}_OUTPUT_MULTIPLIER {}\n".format(prefix, self.quantized_multiplier))
+            f.write("#define {}_OUTPUT_SHIFT {}\n".format(prefix, self.quantized_shift))
+
+    def reduce(self, indata):
+        axes = tuple(axis for axis in range(4) if self.reduce_axes[axis])
+        count = int(np.prod([indata.shape[axis] for axis in axes]))
+        sums = np.sum(indata.astype(np.int64) - self.input_zero_point, axis=axes, keepdims=True)
+        output = []
+        for val in sums.ravel():
+            acc = self.requantize(int(val), self.quantized_multiplier, self.quantized_shift)
+            if self.test_type == 'mean':
+                # Rounding half away from zero, with the division truncating towards zero as in C
+                acc = acc + count // 2 if acc > 0 else acc - count // 2
+                acc = abs(acc) // count if acc >= 0 else -(abs(acc) // count)
+            output.append(self.clamp_int8(acc + self.output_zero_point))
+        return output
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data(self.input_shape(), self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+
+        self.generate_c_array("input", list(indata.ravel()))
+        self.generate_c_array("output_ref", self.reduce(indata))
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class QuantizeSettings(TestSettings):
+    """
+    Quantization of float32 data to s8 or s16, dequantization of s8 data and requantization of s8 data with a
+    per-tensor or per-channel scale. Same float32 and integer arithmetic as the CMSIS-NN kernels, i.e. the quantization
+    multiplies by the reciprocal of the scale.
+    """
+
+    def __init__(self, args, block_size=16, channels=1, out_bits=8, input_zero_point=0, output_zero_point=0,
+                 input_scale=1.0, output_scale=1.0, per_channel=False, randmin=TestSettings.INT8_MIN,
+                 randmax=TestSettings.INT8_MAX + 1):
+        self.block_size = block_size
+        self.channels = channels
+        super().__init__(args, channels, channels, block_size, 1, 1, 1, 1, 1, False, randmin, randmax)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if self.test_type not in ('quantize', 'dequantize', 'requantize'):
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+
+        self.out_bits = out_bits
+        self.per_channel = per_channel
+        self.input_zero_point = input_zero_point
+        self.output_zero_point = output_zero_point
+        self.input_scale = input_scale
+        self.output_scale = output_scale
+        self.scales_table_file = self.pregenerated_data_dir + self.testdataset + '/' + 'scales.txt'
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.block_size, self.channels])
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.block_size, self.channels) = (map(lambda x: x, params))
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, self.block_size))
+            f.write("#define {}_CHANNELS {}\n".format(prefix, self.channels))
+            f.write("#define {}_INPUT_OFFSET {}\n".format(prefix, -self.input_zero_point))
+            f.write("#define {}_OUTPUT_OFFSET {}\n".format(prefix, self.output_zero_point))
+            if self.test_type == 'dequantize':
+                f.write("#define {}_INPUT_SCALE {:.9e}f\n".format(prefix, np.float32(self.input_scale)))
+            elif self.test_type == 'quantize':
+                f.write("#define {}_OUTPUT_SCALE {:.9e}f\n".format(prefix, np.float32(self.output_scale)))
+            elif not self.per_channel:
+                (multiplier, shift) = self.quantize_scale(self.input_scale / self.output_scale)
+                f.write("#define {}_OUTPUT_MULTIPLIER {}\n".format(prefix, multiplier))
+                f.write("#define {}_OUTPUT_SHIFT {}\n".format(prefix, shift))
+
+    def quantize(self, indata):
+        if self.out_bits == 8:
+            (qmin, qmax) = (self.INT8_MIN, self.INT8_MAX)
+        else:
+            (qmin, qmax) = (-32768, 32767)
+        inv_scale = np.float32(1.0) / np.float32(self.output_scale)
+        val = np.clip(indata.astype(np.float32) * inv_scale, qmin - self.output_zero_point,
+                      qmax - self.output_zero_point).astype(np.float64)
+        # Rounding half away from zero
+        rounded = np.sign(val) * np.floor(np.abs(val) + 0.5)
+        return list(rounded.astype(int) + self.output_zero_point)
+
+    def dequantize(self, indata):
+        return (indata - self.input_zero_point).astype(np.float32) * np.float32(self.input_scale)
+
+    def requantize_data(self, indata, multipliers, shifts):
+        output = []
+        for (i, val) in enumerate(indata):
+            acc = self.requantize(int(val) - self.input_zero_point, multipliers[i % len(multipliers)],
+                                  shifts[i % len(shifts)])
+            output.append(self.clamp_int8(acc + self.output_zero_point))
+        return output
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        if self.test_type == 'quantize':
+            indata = self.get_randomized_data([self.block_size], self.inputs_table_file,
+                                              regenerate=self.regenerate_new_input, decimals=2).numpy()
+            self.generate_c_array("input", list(indata), datatype="float", fmt="%.9ef")
+            self.generate_c_array("output_ref", self.quantize(indata), datatype="q7_t" if self.out_bits == 8
+                                  else "q15_t")
+        else:
+            indata = self.get_randomized_data([self.block_size], self.inputs_table_file,
+                                              regenerate=self.regenerate_new_input).numpy().astype(int)
+            self.generate_c_array("input", list(indata))
+            if self.test_type == 'dequantize':
+                self.generate_c_array("output_ref", list(self.dequantize(indata)), datatype="float", fmt="%.9ef")
+            elif self.per_channel:
+                scales = self.get_randomized_data([self.channels], self.scales_table_file,
+                                                  regenerate=self.regenerate_new_weights, decimals=3, minrange=0.05,
+                                                  maxrange=4.0).numpy()
+                quant = [self.quantize_scale(float(scale) / self.output_scale) for scale in scales]
+                multipliers = [multiplier for (multiplier, shift) in quant]
+                shifts = [shift for (multiplier, shift) in quant]
+                self.generate_c_array("output_mult", multipliers, datatype="int32_t")
+                self.generate_c_array("output_shift", shifts, datatype="int32_t")
+                self.generate_c_array("output_ref", self.requantize_data(indata, multipliers, shifts))
+            else:
+                (multiplier, shift) = self.quantize_scale(self.input_scale / self.output_scale)
+                self.generate_c_array("output_ref", self.requantize_data(indata, [multiplier], [shift]))
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class ActivationLutSettings(TestSettings):
+    """
+    s8 and s16 activations computed with look-up tables. The tables are built in float32 with the same order of
+    operations as arm_activation_lut_init_s8() and arm_activation_lut_init_s16(), i.e. as the LUTPopulate() tables of
+    TensorFlow Lite, and the s16 lookup interpolates the same way as the kernel.
+    """
+
+    ACTIVATIONS = {'sigmoid': 'ARM_SIGMOID', 'tanh': 'ARM_TANH', 'hard_swish': 'ARM_HARD_SWISH',
+                   'leaky_relu': 'ARM_LEAKY_RELU'}
+
+    def __init__(self, args, block_size=16, activation='tanh', alpha=0.0, out_bits=8, input_zero_point=0,
+                 output_zero_point=0, input_scale=1.0, output_scale=1.0, randmin=TestSettings.INT8_MIN,
+                 randmax=TestSettings.INT8_MAX + 1):
+        self.block_size = block_size
+        super().__init__(args, 1, 1, block_size, 1, 1, 1, 1, 1, False, randmin, randmax)
+        self.tensor_flow_reference_version = ("// Generated by {} using a float32 reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if activation not in self.ACTIVATIONS:
+            raise RuntimeError("Invalid activation {}".format(activation))
+        if out_bits == 16 and (input_zero_point != 0 or output_zero_point != 0):
+            raise RuntimeError("s16 activations have no zero points")
+
+        self.activation = activation
+        self.alpha = np.float32(alpha)
+        self.out_bits = out_bits
+        self.input_zero_point = input_zero_point
+        self.output_zero_point = output_zero_point
+        self.input_scale = np.float32(input_scale)
+        self.output_scale = np.float32(output_scale)
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.block_size])
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        self.block_size = int(params)
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, self.block_size))
+            f.write("#define {}_TYPE {}\n".format(prefix, self.ACTIVATIONS[self.activation]))
+            f.write("#define {}_ALPHA {:.9e}f\n".format(prefix, self.alpha))
+            f.write("#define {}_INPUT_SCALE {:.9e}f\n".format(prefix, self.input_scale))
+            f.write("#define {}_OUTPUT_SCALE {:.9e}f\n".format(prefix, self.output_scale))
+            if self.out_bits == 8:
+                f.write("#define {}_INPUT_OFFSET {}\n".format(prefix, -self.input_zero_point))
+                f.write("#define {}_OUTPUT_OFFSET {}\n".format(prefix, self.output_zero_point))
+
+    def activation_f32(self, val):
+        # expf() and tanhf() of the C library are correctly rounded, the float32 versions of numpy are not always
+        val = np.float32(val)
+        if self.activation == 'sigmoid':
+            return np.float32(1.0) / (np.float32(1.0) + np.float32(math.exp(-float(val))))
+        elif self.activation == 'tanh':
+            return np.float32(math.tanh(float(val)))
+        elif self.activation == 'hard_swish':
+            return val * min(max(val + np.float32(3.0), np.float32(0.0)), np.float32(6.0)) / np.float32(6.0)
+        return val if val > 0 else self.alpha * val
+
+    @staticmethod
+    def round_f32(val):
+        # Rounding half away from zero, as roundf()
+        val = float(val)
+        return np.float32(np.sign(val) * np.floor(np.abs(val) + 0.5))
+
+    def lut_s8(self):
+        inv_scale = np.float32(1.0) / self.output_scale
+        lut = [0] * 256
+        for val in range(self.INT8_MIN, self.INT8_MAX + 1):
+            dequantized = self.input_scale * np.float32(val - self.input_zero_point)
+            quantized = self.round_f32(self.activation_f32(dequantized) * inv_scale) + \
+                np.float32(self.output_zero_point)
+            lut[val & 0xff] = int(min(max(quantized, self.INT8_MIN), self.INT8_MAX))
+        return lut
+
+    def lut_s16(self):
+        (qmin, qmax) = (-32768, 32767)
+        num_steps = 512
+        input_min = self.input_scale * np.float32(qmin)
+        input_max = self.input_scale * np.float32(qmax)
+        output_min = self.output_scale * np.float32(qmin)
+        output_max = self.output_scale * np.float32(qmax)
+        step = (input_max - input_min) / np.float32(num_steps)
+        half_step = step / np.float32(2.0)
+        output_scaling_inv = np.float32(65536.0) / (output_max - output_min)
+
+        lut = []
+        for i in range(num_steps):
+            val = self.activation_f32(input_min + np.float32(i) * step)
+            val_midpoint = self.activation_f32(input_min + np.float32(i) * step + half_step)
+            val_next = self.activation_f32(input_min + np.float32(i + 1) * step)
+
+            sample_val = self.round_f32(val * output_scaling_inv)
+            midpoint_interp_val = self.round_f32((val_next * output_scaling_inv + sample_val) / np.float32(2.0))
+            midpoint_val = self.round_f32(val_midpoint * output_scaling_inv)
+            bias = self.round_f32((midpoint_interp_val - midpoint_val) / np.float32(2.0))
+            lut.append(int(min(max(sample_val - bias, qmin), qmax)))
+        last_val = self.round_f32(self.activation_f32(input_max) * output_scaling_inv)
+        lut.append(int(min(max(last_val, qmin), qmax)))
+        return lut
+
+    @staticmethod
+    def lookup_s16(lut, val):
+        index = 256 + (val >> 7)
+        offset = val & 0x7f
+        base = lut[index]
+        slope = lut[index + 1] - base
+        return base + ((slope * offset + 64) >> 7)
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data([self.block_size], self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+        if self.out_bits == 8:
+            lut = self.lut_s8()
+            self.generate_c_array("input", list(indata))
+            self.generate_c_array("lut_ref", lut)
+            self.generate_c_array("output_ref", [lut[val & 0xff] for val in indata])
+        else:
+            lut = self.lut_s16()
+            self.generate_c_array("input", list(indata), datatype="q15_t")
+            self.generate_c_array("lut_ref", lut, datatype="q15_t")
+            self.generate_c_array("output_ref", [self.lookup_s16(lut, val) for val in indata], datatype="q15_t")
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class SoftmaxS16Settings(TestSettings):
+    """
+    s16 softmax with the exp and 1/(1+x) look-up tables of TFL. The tables are generated as gen_lut() of TFL and the
+    reference output mirrors the integer arithmetic of the TFL SoftmaxInt16 kernel.
+    """
+
+    LUT_SIZE = 513
+
+    def __init__(self, args, rows=2, row_size=8, input_scale=1.0 / 2048, beta=1.0, randmin=-32768, randmax=32768):
+        self.rows = rows
+        self.row_size = row_size
+        super().__init__(args, 1, 1, 1, 1, 1, 1, 1, 1, False, randmin, randmax)
+        self.tensor_flow_reference_version = ("// Generated by {} using an integer reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if not self.test_type == 'softmax_s16':
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+
+        # The scaled differences [-65535, 0] correspond to [-10.0, 0.0]
+        (self.input_multiplier, self.input_left_shift) = self.quantize_scale(input_scale * beta / (10.0 / 65535.0))
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.rows, self.row_size])
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.rows, self.row_size) = (map(lambda x: x, params))
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_NUM_ROWS {}\n".format(prefix, self.rows))
+            f.write("#define {}_ROW_SIZE {}\n".format(prefix, self.row_size))
+            f.write("#define {}_INPUT_MULT {}\n".format(prefix, self.input_multiplier))
+            f.write("#define {}_INPUT_LEFT_SHIFT {}\n".format(prefix, self.input_left_shift))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, self.rows * self.row_size))
+
+    @staticmethod
+    def round_away(val):
+        # Rounding half away from zero, as TfLiteRound()
+        return math.copysign(math.floor(abs(val) + 0.5), val)
+
+    def gen_lut(self, func, min_val, max_val):
+        step = (max_val - min_val) / (self.LUT_SIZE - 1)
+        half_step = step / 2.0
+        lut = []
+        for i in range(self.LUT_SIZE - 1):
+            sample_val = self.round_away(func(min_val + i * step) * 32768.0)
+            midpoint_interp_val = self.round_away((func(min_val + (i + 1) * step) * 32768.0 + sample_val) / 2.0)
+            midpoint_val = self.round_away(func(min_val + i * step + half_step) * 32768.0)
+            bias = self.round_away((midpoint_interp_val - midpoint_val) / 2.0)
+            lut.append(int(min(max(sample_val - bias, -32768.0), 32767.0)))
+        lut.append(int(min(max(self.round_away(func(max_val) * 32768.0), -32768.0), 32767.0)))
+        return lut
+
+    @staticmethod
+    def lookup(lut, val):
+        index = 256 + (val >> 7)
+        offset = val & 0x7f
+        base = lut[index]
+        slope = lut[index + 1] - base
+        return base + ((slope * offset + 64) >> 7)
+
+    def softmax_row(self, row, exp_lut, one_by_one_lut):
+        row_max = max(row)
+        exps = []
+        for val in row:
+            scaled_diff = self.requantize(val - row_max, self.input_multiplier, self.input_left_shift) + self.INT16_MAX
+            exps.append(self.lookup(exp_lut, min(max(scaled_diff, -32768), self.INT16_MAX)))
+        exp_sum = sum(exps)
+
+        headroom_plus_one = 32 - exp_sum.bit_length()
+        shifted_sum = ((exp_sum << (headroom_plus_one - 1)) + (1 << 13)) >> 14
+        sym_shifted_sum = min(max(shifted_sum - ((1 << 15) + (1 << 16)), -32768), self.INT16_MAX)
+        reciprocal = self.lookup(one_by_one_lut, sym_shifted_sum)
+
+        right_shift = 31 - headroom_plus_one
+        rounding = 1 << (right_shift - 1)
+        return [min(max((exp * reciprocal + rounding) >> right_shift, 0), self.INT16_MAX) for exp in exps]
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data([self.rows, self.row_size], self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+
+        exp_lut = self.gen_lut(lambda x: math.exp(x), -10.0, 0.0)
+        one_by_one_lut = self.gen_lut(lambda x: 1.0 / (1.0 + x), 0.0, 1.0)
+
+        output = []
+        for row in indata:
+            output.extend(self.softmax_row([int(val) for val in row], exp_lut, one_by_one_lut))
+
+        self.generate_c_array("input", list(indata.ravel()), datatype="q15_t")
+        self.generate_c_array("exp_lut", exp_lut, datatype="q15_t")
+        self.generate_c_array("one_by_one_lut", one_by_one_lut, datatype="q15_t")
+        self.generate_c_array("output_ref", output, datatype="q15_t")
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
+class PadSliceSettings(TestSettings):
+    """
+    Constant padding, with the padding before and after the input in each of the N, H, W and C dimensions, or strided
+    slice, with the begin index, the stride and the number of output elements in each dimension.
+    """
+
+    def __init__(self, args, batches=1, y_in=4, x_in=4, in_ch=8, pad_before=(0, 0, 0, 0), pad_after=(0, 0, 0, 0),
+                 pad_value=0, begin=(0, 0, 0, 0), stride=(1, 1, 1, 1), size=(1, 1, 1, 1),
+                 randmin=TestSettings.INT8_MIN, randmax=TestSettings.INT8_MAX + 1):
+        super().__init__(args, in_ch, in_ch, x_in, y_in, 1, 1, 1, 1, False, randmin, randmax, batches=batches)
+        self.tensor_flow_reference_version = ("// Generated by {} using a numpy reference implementation.\n".
+                                              format(os.path.basename(__file__)))
+
+        if self.test_type not in ('pad', 'strided_slice'):
+            raise RuntimeError("Invalid test type {}".format(self.test_type))
+
+        self.pad_before = list(pad_before)
+        self.pad_after = list(pad_after)
+        self.pad_value = pad_value
+        self.begin = list(begin)
+        self.stride = list(stride)
+        self.size = list(size)
+
+    def save_parameters(self):
+        regendir = os.path.dirname(self.parameters_file)
+        if not os.path.exists(regendir):
+            os.makedirs(regendir)
+        params = np.array([self.batches, self.y_input, self.x_input, self.input_ch])
+        np.savetxt(self.parameters_file, params, fmt='%i')
+
+    def load_parameters(self):
+        params = np.loadtxt(self.parameters_file).astype(int)
+        (self.batches, self.y_input, self.x_input, self.input_ch) = (map(lambda x: x, params))
+
+    def input_shape(self):
+        return [self.batches, self.y_input, self.x_input, self.input_ch]
+
+    def output_shape(self):
+        if self.test_type == 'pad':
+            return [dim + before + after for (dim, before, after) in zip(self.input_shape(), self.pad_before,
+                                                                         self.pad_after)]
+        return self.size
+
+    def write_dims(self, f, prefix, name, dims):
+        for (axis, dim) in zip(('N', 'H', 'W', 'C'), dims):
+            f.write("#define {}_{}_{} {}\n".format(prefix, name, axis, dim))
+
+    def write_c_config_header(self):
+        filename = self.config_data
+
+        self.generated_header_files.append(filename)
+        filepath = self.headers_dir + filename
+
+        prefix = self.testdataset.upper()
+        output_shape = self.output_shape()
+
+        print("Writing C header with config data {}...".format(filepath))
+        with open(filepath, "w+") as f:
+            f.write("{}\n\n".format(LICENSE))
+            f.write("#pragma once\n")
+            f.write(self.tensor_flow_reference_version)
+            f.write("#define {}_INPUT_BATCHES {}\n".format(prefix, self.batches))
+            f.write("#define {}_INPUT_H {}\n".format(prefix, self.y_input))
+            f.write("#define {}_INPUT_W {}\n".format(prefix, self.x_input))
+            f.write("#define {}_IN_CH {}\n".format(prefix, self.input_ch))
+            f.write("#define {}_OUTPUT_BATCHES {}\n".format(prefix, output_shape[0]))
+            f.write("#define {}_OUTPUT_H {}\n".format(prefix, output_shape[1]))
+            f.write("#define {}_OUTPUT_W {}\n".format(prefix, output_shape[2]))
+            f.write("#define {}_OUT_CH {}\n".format(prefix, output_shape[3]))
+            f.write("#define {}_DST_SIZE {}\n".format(prefix, int(np.prod(output_shape))))
+            if self.test_type == 'pad':
+                self.write_dims(f, prefix, 'PAD_BEFORE', self.pad_before)
+                self.write_dims(f, prefix, 'PAD_AFTER', self.pad_after)
+                f.write("#define {}_PAD_VALUE {}\n".format(prefix, self.pad_value))
+            else:
+                self.write_dims(f, prefix, 'BEGIN', self.begin)
+                self.write_dims(f, prefix, 'STRIDE', self.stride)
+
+    def pad(self, indata):
+        return np.pad(indata, list(zip(self.pad_before, self.pad_after)), mode='constant',
+                      constant_values=self.pad_value)
+
+    def strided_slice(self, indata):
+        slices = []
+        for (begin, stride, size) in zip(self.begin, self.stride, self.size):
+            end = begin + size * stride
+            slices.append(slice(begin, end if end >= 0 else None, stride))
+        return indata[tuple(slices)]
+
+    def generate_data(self, input_data=None, weights=None, biases=None):
+        indata = self.get_randomized_data(self.input_shape(), self.inputs_table_file,
+                                          regenerate=self.regenerate_new_input).numpy().astype(int)
+
+        self.generate_c_array("input", list(indata.ravel()))
+        if self.test_type == 'pad':
+            outdata = self.pad(indata)
+        else:
+            outdata = self.strided_slice(indata)
+        self.generate_c_array("output_ref", list(outdata.ravel()))
+
+        self.write_c_config_header()
+        self.write_c_header_wrapper()
+
+
 if __name__ == '__main__':
     if version.parse(tf.__version__) < REQUIRED_MINIMUM_TENSORFLOW_VERSION:
         print("Unsupported tensorflow version, ", version.parse(tf.__version__))
@@ -771,6 +1945,10 @@ if __name__ == '__main__':
         # generator = ConvSettings(args, in_ch=3, out_ch=3, x_in=5, y_in=5, w_x=2, w_y=3, stride_x=2, stride_y=2,
         #                         pad=False, randmin=-2, randmax=2, outminrange=-127, outmaxrange=127, batches=3)
 
+        # conv_small_ch
+        # generator = ConvSettings(args, in_ch=3, out_ch=9, x_in=9, y_in=7, w_x=3, w_y=3, stride_x=2, stride_y=2,
+        #                         pad=True, randmin=-1, randmax=4, outminrange=-126, outmaxrange=127, batches=2)
+
         # depthwise_2
         # generator = ConvSettings(args, in_ch=3, out_ch=9, x_in=6, y_in=5, w_x=3, w_y=4, stride_x=2, stride_y=2,
         #                         pad=True, randmin=-2, randmax=2, outminrange=-126, outmaxrange=127)
@@ -799,10 +1977,135 @@ if __name__ == '__main__':
         # generator = PoolingSettings(args, channels=2, x_in=9, y_in=1, stride_x=2, stride_y=1, w_x=1, w_y=1, pad=False)
         # avgpooling_4
         # generator = PoolingSettings(args, channels=2, x_in=1, y_in=20, stride_x=1, stride_y=3, w_x=1, w_y=3, pad=True)
+        # avgpooling_5 (input.txt holds per channel biased data so that the sums exceed the int16 range)
+        # generator = PoolingSettings(args, channels=7, x_in=20, y_in=20, stride_x=1, stride_y=1, w_x=20, w_y=20,
+        #                            randmin=-8, randmax=8, pad=False)
         # maxpooling_5
         # generator = PoolingSettings(args, channels=20, x_in=1, y_in=1, stride_x=1, stride_y=1, w_x=1, w_y=1,
         #                            pad=True)
         # maxpooling_6
         generator = PoolingSettings(args, channels=17, x_in=1, y_in=5, stride_x=1, stride_y=3, w_x=3, w_y=4, pad=True)
+    elif args.type == 'batch_matmul':
+        # batch_matmul
+        # generator = BatchMatMulSettings(args, lhs_batches=2, rhs_batches=2, rows=3, depth=5, cols=4,
+        #                                 lhs_zero_point=-2, output_zero_point=3, output_scale=32.0)
+        # batch_matmul_adj
+        generator = BatchMatMulSettings(args, lhs_batches=3, rhs_batches=1, rows=5, depth=19, cols=3, adj_x=True,
+                                        adj_y=True, lhs_zero_point=4, rhs_zero_point=-7, output_zero_point=-1,
+                                        output_scale=64.0)
+    elif args.type == 'layer_norm':
+        # layer_norm
+        generator = LayerNormSettings(args, rows=3, row_size=16, output_scale=1.0 / 8192, variance_limit=1)
+    elif args.type == 'fully_connected_s4':
+        # fully_connected_s4
+        # generator = Int4WeightsSettings(args, in_ch=7, out_ch=5, x_in=3, y_in=1, batches=2, input_zero_point=-3,
+        #                                 output_zero_point=2)
+        # fully_connected_s4_2
+        generator = Int4WeightsSettings(args, in_ch=40, out_ch=9, x_in=1, y_in=1, batches=3, input_zero_point=5,
+                                        output_zero_point=-4, output_scale=8.0)
+    elif args.type == 'conv_1x1_s4':
+        # kernel1x1_s4
+        generator = Int4WeightsSettings(args, in_ch=18, out_ch=11, x_in=5, y_in=3, batches=1, input_zero_point=-1,
+                                        output_zero_point=3, output_scale=8.0)
+    elif args.type == 'fully_connected_sparse':
+        # fully_connected_sparse
+        # generator = SparseFullyConnectedSettings(args, in_ch=22, out_ch=7, batches=2, sparsity=0.6,
+        #                                          input_zero_point=-5, output_zero_point=1)
+        # fully_connected_sparse_2
+        generator = SparseFullyConnectedSettings(args, in_ch=48, out_ch=12, batches=1, sparsity=0.8,
+                                                 input_zero_point=3, output_zero_point=-2, output_scale=64.0)
+    elif args.type == 'depthwise_conv_dilated':
+        # depthwise_dilation
+        # generator = DilatedDepthwiseConvSettings(args, in_ch=4, out_ch=4, x_in=9, y_in=7, w_x=3, w_y=3, stride_x=1,
+        #                                          stride_y=1, dilation_x=2, dilation_y=2, pad=True,
+        #                                          input_zero_point=-4, output_zero_point=2, output_scale=64.0)
+        # depthwise_dilation_mult
+        # generator = DilatedDepthwiseConvSettings(args, in_ch=3, out_ch=6, x_in=10, y_in=6, w_x=3, w_y=2, stride_x=2,
+        #                                          stride_y=1, dilation_x=3, dilation_y=2, pad=True,
+        #                                          input_zero_point=1, output_zero_point=-3)
+        # depthwise_dilation_1d
+        generator = DilatedDepthwiseConvSettings(args, in_ch=2, out_ch=8, x_in=20, y_in=1, w_x=3, w_y=1, stride_x=1,
+                                                 stride_y=1, dilation_x=4, dilation_y=1, pad=False,
+                                                 input_zero_point=-6, output_zero_point=0)
+
+    elif args.type == 'mean':
+        # mean_hw
+        # generator = ReduceSettings(args, batches=1, y_in=7, x_in=6, in_ch=11, reduce_axes=(1, 2),
+        #                            input_zero_point=-3, output_zero_point=5)
+        # mean_c
+        # generator = ReduceSettings(args, batches=2, y_in=3, x_in=5, in_ch=13, reduce_axes=(3,),
+        #                            input_zero_point=4, output_zero_point=-2, output_scale=0.25)
+        # mean_w_long
+        # generator = ReduceSettings(args, batches=1, y_in=2, x_in=520, in_ch=4, reduce_axes=(2,),
+        #                            input_zero_point=-128, output_zero_point=-128, output_scale=2.0, randmin=100)
+        # mean_nwc
+        generator = ReduceSettings(args, batches=3, y_in=4, x_in=5, in_ch=6, reduce_axes=(0, 2, 3),
+                                   input_zero_point=1, output_zero_point=-1, output_scale=1.0)
+    elif args.type == 'reduce_sum':
+        # reduce_sum_hw
+        generator = ReduceSettings(args, batches=2, y_in=6, x_in=9, in_ch=7, reduce_axes=(1, 2),
+                                   input_zero_point=-2, output_zero_point=3, output_scale=64.0)
+    elif args.type == 'quantize':
+        # quantize_s8
+        # generator = QuantizeSettings(args, block_size=37, output_zero_point=-5, output_scale=0.5, randmin=-80,
+        #                              randmax=80)
+        # quantize_s16
+        generator = QuantizeSettings(args, block_size=29, out_bits=16, output_scale=1.0 / 256, randmin=-200,
+                                     randmax=200)
+    elif args.type == 'dequantize':
+        # dequantize
+        generator = QuantizeSettings(args, block_size=23, input_zero_point=7, input_scale=0.0625 / 3)
+    elif args.type == 'requantize':
+        # requantize
+        # generator = QuantizeSettings(args, block_size=41, input_zero_point=-3, output_zero_point=6,
+        #                              input_scale=0.75, output_scale=0.3)
+        # requantize_per_channel
+        generator = QuantizeSettings(args, block_size=39, channels=13, input_zero_point=2, output_zero_point=-4,
+                                     output_scale=1.5, per_channel=True)
+    elif args.type == 'activation_lut':
+        # tanh_s8
+        # generator = ActivationLutSettings(args, block_size=43, activation='tanh', input_zero_point=-3,
+        #                                   input_scale=0.05, output_scale=1.0 / 128)
+        # sigmoid_s8
+        # generator = ActivationLutSettings(args, block_size=37, activation='sigmoid', input_scale=0.08,
+        #                                   output_zero_point=-128, output_scale=1.0 / 256)
+        # hard_swish_s8
+        # generator = ActivationLutSettings(args, block_size=45, activation='hard_swish', input_zero_point=10,
+        #                                   output_zero_point=-20, input_scale=0.05, output_scale=0.04)
+        # leaky_relu_s8
+        # generator = ActivationLutSettings(args, block_size=31, activation='leaky_relu', alpha=0.2,
+        #                                   input_zero_point=5, output_zero_point=-12, input_scale=0.1,
+        #                                   output_scale=0.08)
+        # tanh_s16
+        # generator = ActivationLutSettings(args, block_size=35, activation='tanh', out_bits=16,
+        #                                   input_scale=4.0 / 32768, output_scale=1.0 / 32768, randmin=-32768,
+        #                                   randmax=32768)
+        # sigmoid_s16
+        generator = ActivationLutSettings(args, block_size=33, activation='sigmoid', out_bits=16,
+                                          input_scale=8.0 / 32768, output_scale=1.0 / 32768, randmin=-32768,
+                                          randmax=32768)
+    elif args.type == 'pad':
+        # pad_hw
+        # generator = PadSliceSettings(args, batches=2, y_in=3, x_in=4, in_ch=5, pad_before=(0, 1, 2, 0),
+        #                              pad_after=(0, 2, 1, 0), pad_value=-7)
+        # pad_nhwc
+        generator = PadSliceSettings(args, batches=1, y_in=2, x_in=3, in_ch=6, pad_before=(1, 0, 1, 2),
+                                     pad_after=(1, 1, 0, 3), pad_value=5)
+    elif args.type == 'strided_slice':
+        # strided_slice
+        # generator = PadSliceSettings(args, batches=2, y_in=7, x_in=6, in_ch=9, begin=(1, 1, 0, 2),
+        #                              stride=(1, 2, 3, 1), size=(1, 3, 2, 5))
+        # strided_slice_c
+        # generator = PadSliceSettings(args, batches=1, y_in=5, x_in=6, in_ch=8, begin=(0, 4, 1, 7),
+        #                              stride=(1, -2, 2, -3), size=(1, 3, 3, 3))
+        # slice_rows
+        generator = PadSliceSettings(args, batches=2, y_in=6, x_in=5, in_ch=4, begin=(0, 2, 0, 0),
+                                     stride=(1, 1, 1, 1), size=(2, 3, 5, 4))
+    elif args.type == 'softmax_s16':
+        # softmax_s16
+        # generator = SoftmaxS16Settings(args, rows=3, row_size=9, input_scale=1.0 / 2048)
+        # softmax_s16_2
+        generator = SoftmaxS16Settings(args, rows=2, row_size=40, input_scale=1.0 / 4096, randmin=-3000,
+                                       randmax=3000)
 
     generator.generate_data()
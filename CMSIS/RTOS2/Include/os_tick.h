@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_tick.h
  * @brief    CMSIS OS Tick header file
- * @version  V1.0.1
- * @date     24. November 2017
+ * @version  V1.0.2
+ * @date     17. October 2026
  ******************************************************************************/
 /*
- * Copyright (c) 2017-2017 ARM Limited. All rights reserved.
+ * Copyright (c) 2017-2026 ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -68,4 +68,20 @@ uint32_t OS_Tick_GetCount (void);
 /// \return OS Tick overflow status (1 - overflow, 0 - no overflow).
 uint32_t OS_Tick_GetOverflow (void);
 
+/// Suspend periodic OS Tick and program OS Tick timer for a tick-less sleep period (optional)
+/// \param[in]     ticks        number of ticks until the next kernel timeout
+/// \return number of ticks programmed (0 - tick-less sleep not possible).
+uint32_t OS_Tick_Suspend (uint32_t ticks);
+
+/// Resume periodic OS Tick after a tick-less sleep period (optional)
+/// \return number of ticks elapsed during sleep.
+uint32_t OS_Tick_Resume (void);
+
+/// Enter low-power state during tick-less idle (called with interrupts disabled)
+/// \param[in]     ticks        number of ticks programmed for the sleep period
+void     OS_Tickless_Sleep (uint32_t ticks);
+
+/// Tick-less idle: sleep until the next kernel timeout or an interrupt
+void     OS_Tickless_Idle (void);
+
 #endif  /* OS_TICK_H */
@@ -17,7 +17,7 @@
  *
  * -----------------------------------------------------------------------------
  *
- * $Revision:   V5.5.1
+ * $Revision:   V5.5.2
  *
  * Project:     CMSIS-RTOS RTX
  * Title:       RTX Configuration definitions
@@ -69,6 +69,29 @@
  
 //   </e>
  
+//   <q>Ready Queue Priority Bitmap
+//   <i> Keeps ready threads in per-priority FIFO lists indexed by a priority bitmap.
+//   <i> Makes thread ready and preempt operations independent of the number of ready threads.
+#ifndef OS_READY_BITMAP
+#define OS_READY_BITMAP             0
+#endif
+ 
+//   <q>Timer Wheel
+//   <i> Keeps thread delays and active timers in a hierarchical timer wheel instead of delta sorted lists.
+//   <i> Makes starting and stopping delays and timers independent of the number of active ones.
+//   <i> The timer wheel requires 2064 bytes of RAM.
+#ifndef OS_TIMER_WHEEL
+#define OS_TIMER_WHEEL              0
+#endif
+ 
+//   <q>TLSF Dynamic Memory allocator
+//   <i> Allocates dynamic memory with a two-level segregated fit allocator instead of first fit.
+//   <i> Makes allocation and release independent of the number of allocated blocks.
+//   <i> Each memory pool reserves a control block of 56 to 920 bytes depending on the pool size.
+#ifndef OS_MEM_TLSF
+#define OS_MEM_TLSF                 0
+#endif
+ 
 //   <o>ISR FIFO Queue 
 //      <4=>  4 entries    <8=>   8 entries   <12=>  12 entries   <16=>  16 entries
 //     <24=> 24 entries   <32=>  32 entries   <48=>  48 entries   <64=>  64 entries
@@ -488,10 +511,37 @@
 #define OS_EVR_MSGQUEUE_LEVEL       0x01U
 #endif
  
+//       <h>Ring Buffer
+//       <i> Recording level for Ring Buffer events.
+//         <o.0>Error events
+//         <o.1>API function call events
+//         <o.2>Operation events
+//         <o.3>Detailed operation events
+//       </h>
+#ifndef OS_EVR_RINGBUF_LEVEL 
+#define OS_EVR_RINGBUF_LEVEL        0x01U
+#endif
+ 
 //     </h>
  
 //   </e>
  
+//   <e>Binary Trace Recorder
+//   <i> Records RTX events into a binary Trace Buffer in RAM instead of Event Recorder (requires RTX source variant).
+//   <i> The buffer is read with osRtxTraceRead, e.g. for transfer over UART or USB.
+#ifndef OS_EVR_TRACE
+#define OS_EVR_TRACE                0
+#endif
+ 
+//     <o>Trace Buffer size [records] <16-65536>
+//     <i> Defines the number of 12-byte trace records.
+//     <i> Default: 1024
+#ifndef OS_EVR_TRACE_SIZE
+#define OS_EVR_TRACE_SIZE           1024
+#endif
+ 
+//   </e>
+ 
 //   <h>RTOS Event Generation
 //   <i> Enables event generation for RTX components (requires RTX source variant).
  
@@ -561,6 +611,12 @@
 #define OS_EVR_MSGQUEUE             1
 #endif
  
+//     <q>Ring Buffer
+//     <i> Enables Ring Buffer event generation.
+#ifndef OS_EVR_RINGBUF
+#define OS_EVR_RINGBUF              1
+#endif
+ 
 //   </h>
  
 // </h>
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019 Arm Limited. All rights reserved.
+ * Copyright (c) 2013-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -38,11 +38,43 @@
 #define   OS_EVR_WAIT           OS_EVR_THREAD
 #endif
 
+// Ring Buffer events follow Message Queue events in older configurations
+#ifndef   OS_EVR_RINGBUF
+#define   OS_EVR_RINGBUF        OS_EVR_MSGQUEUE
+#endif
+
 #ifdef   _RTE_
 #include "RTE_Components.h"
 #endif
 
-#ifdef    RTE_Compiler_EventRecorder
+#if      (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0))
+
+// Events are recorded by the Binary Trace Recorder (rtx_trace.c) instead of Event Recorder
+#define   EVR_RTX_RECORD
+
+//lint -emacro((835,845),EventID) [MISRA Note 13]
+
+/// Event level (as Event Recorder)
+#define   EventLevelError       0x00000U
+#define   EventLevelAPI         0x10000U
+#define   EventLevelOp          0x20000U
+#define   EventLevelDetail      0x30000U
+
+/// Event ID: level, component number and message number (as Event Recorder)
+#define   EventID(level, comp_no, msg_no) \
+          ((level) | (((comp_no) & 0xFFU) << 8) | ((msg_no) & 0xFFU))
+
+/// Event recording functions (as Event Recorder)
+#define   EventRecord2(id, val1, val2)              osRtxTraceRecord2(id, val1, val2)
+#define   EventRecord4(id, val1, val2, val3, val4)  osRtxTraceRecord4(id, val1, val2, val3, val4)
+#define   EventRecordData(id, data, len)            osRtxTraceRecordData(id, data, len)
+
+/// Record event with an object name (stored in the trace)
+extern uint32_t osRtxTraceRecordName (uint32_t id, uint32_t val1, const char *name);
+
+#elif     defined(RTE_Compiler_EventRecorder)
+
+#define   EVR_RTX_RECORD
 
 //lint -emacro((835,845),EventID) [MISRA Note 13]
 
@@ -64,6 +96,10 @@
 #endif
 #endif
 
+#endif
+
+#ifdef    EVR_RTX_RECORD
+
 /// RTOS component number
 #define EvtRtxMemoryNo                  (0xF0U)
 #define EvtRtxKernelNo                  (0xF1U)
@@ -76,8 +112,9 @@
 #define EvtRtxSemaphoreNo               (0xF8U)
 #define EvtRtxMemoryPoolNo              (0xF9U)
 #define EvtRtxMessageQueueNo            (0xFAU)
+#define EvtRtxRingBufferNo              (0xFBU)
 
-#endif  // RTE_Compiler_EventRecorder
+#endif  // EVR_RTX_RECORD
 
 
 /// Extended Status codes
@@ -1971,4 +2008,61 @@ extern void EvrRtxMessageQueueDestroyed (osMessageQueueId_t mq_id);
 #endif
 
 
+//  ==== Ring Buffer Events ====
+
+/**
+  \brief  Event on ring buffer error (Error)
+  \param[in]  rb_id         ring buffer ID obtained by \ref osRtxRingBufferNew or NULL when ID is unknown.
+  \param[in]  status        extended execution status.
+*/
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_ERROR_DISABLE))
+extern void EvrRtxRingBufferError (osRtxRingBufferId_t rb_id, int32_t status);
+#else
+#define EvrRtxRingBufferError(rb_id, status)
+#endif
+
+/**
+  \brief  Event on ring buffer create and initialization (API)
+  \param[in]  elem_count    maximum number of elements in buffer.
+  \param[in]  elem_size     element size in bytes.
+  \param[in]  attr          ring buffer attributes; NULL: default values.
+*/
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_NEW_DISABLE))
+extern void EvrRtxRingBufferNew (uint32_t elem_count, uint32_t elem_size, const osRtxRingBufferAttr_t *attr);
+#else
+#define EvrRtxRingBufferNew(elem_count, elem_size, attr)
+#endif
+
+/**
+  \brief  Event on successful ring buffer create (Op)
+  \param[in]  rb_id         ring buffer ID obtained by \ref osRtxRingBufferNew.
+  \param[in]  name          pointer to ring buffer object name.
+*/
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_CREATED_DISABLE))
+extern void EvrRtxRingBufferCreated (osRtxRingBufferId_t rb_id, const char *name);
+#else
+#define EvrRtxRingBufferCreated(rb_id, name)
+#endif
+
+/**
+  \brief  Event on ring buffer delete (API)
+  \param[in]  rb_id         ring buffer ID obtained by \ref osRtxRingBufferNew.
+*/
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_DELETE_DISABLE))
+extern void EvrRtxRingBufferDelete (osRtxRingBufferId_t rb_id);
+#else
+#define EvrRtxRingBufferDelete(rb_id)
+#endif
+
+/**
+  \brief  Event on successful ring buffer delete (Op)
+  \param[in]  rb_id         ring buffer ID obtained by \ref osRtxRingBufferNew.
+*/
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_DESTROYED_DISABLE))
+extern void EvrRtxRingBufferDestroyed (osRtxRingBufferId_t rb_id);
+#else
+#define EvrRtxRingBufferDestroyed(rb_id)
+#endif
+
+
 #endif  // RTX_EVR_H_
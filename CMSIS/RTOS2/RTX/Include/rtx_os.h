@@ -54,6 +54,7 @@ extern "C"
 #define osRtxIdMemoryPool       0xF7U
 #define osRtxIdMessage          0xF9U
 #define osRtxIdMessageQueue     0xFAU
+#define osRtxIdRingBuffer       0xFBU
  
 /// Object Flags definitions
 #define osRtxFlagSystemObject   0x01U
@@ -93,11 +94,19 @@ extern "C"
  
 /// Thread Flags definitions
 #define osRtxThreadFlagDefStack 0x10U   ///< Default Stack flag
+#define osRtxThreadFlagDelayWheel 0x20U ///< Delay in Timer Wheel flag
  
 /// Stack Marker definitions
 #define osRtxStackMagicWord     0xE25A2EA5U ///< Stack Magic Word (Stack Base)
 #define osRtxStackFillPattern   0xCCCCCCCCU ///< Stack Fill Pattern 
  
+/// Thread Runtime Statistics (times in system timer counts)
+typedef struct {
+  uint64_t                   run_time;  ///< Accumulated execution time
+  uint32_t               switch_count;  ///< Number of switches to the Thread
+  uint32_t                latency_max;  ///< Worst-case time from Ready to Running
+} osRtxThreadStats_t;
+ 
 /// Thread Control Block
 typedef struct osRtxThread_s {
   uint8_t                          id;  ///< Object Identifier
@@ -126,6 +135,10 @@ typedef struct osRtxThread_s {
 #ifdef RTX_TF_M_EXTENSION
   uint32_t                  tz_module;  ///< TrustZone Module Identifier
 #endif
+#ifdef RTX_THREAD_STATS
+  osRtxThreadStats_t            stats;  ///< Runtime Statistics
+  uint64_t                 stats_time;  ///< Time switched to or made Ready (0: none)
+#endif
 } osRtxThread_t;
  
  
@@ -259,6 +272,63 @@ typedef struct {
 } osRtxMessageQueue_t;
  
  
+//  ==== Ring Buffer definitions ====
+ 
+/// Ring Buffer Control Block
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t              reserved_state;  ///< Object State (not used)
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  uint32_t                 elem_count;  ///< Maximum number of Elements
+  uint32_t                  elem_size;  ///< Element Size
+  uint8_t                       *data;  ///< Element Storage
+  volatile uint32_t              head;  ///< Write Index [0..2*elem_count-1] (Producer)
+  volatile uint32_t              tail;  ///< Read Index [0..2*elem_count-1] (Consumer)
+  osEventFlagsId_t              ef_id;  ///< Wakeup Event Flags (NULL: none)
+  uint32_t                   ef_flags;  ///< Wakeup Flags
+  uint32_t                  threshold;  ///< Wakeup Threshold (Elements)
+} osRtxRingBuffer_t;
+ 
+/// Ring Buffer ID identifies the ring buffer.
+typedef void *osRtxRingBufferId_t;
+ 
+/// Attributes structure for ring buffer.
+typedef struct {
+  const char                   *name;   ///< name of the ring buffer
+  uint32_t                 attr_bits;   ///< attribute bits (reserved, set to 0)
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                       *rb_mem;   ///< memory for element storage
+  uint32_t                   rb_size;   ///< size of provided memory for element storage
+  osEventFlagsId_t             ef_id;   ///< event flags set when the fill level reaches threshold
+  uint32_t                  ef_flags;   ///< flags to set in ef_id
+  uint32_t                 threshold;   ///< fill level in elements that triggers the wakeup
+} osRtxRingBufferAttr_t;
+ 
+ 
+//  ==== Trace definitions ====
+ 
+/// Trace Record (Binary Trace Recorder)
+typedef struct {
+  uint16_t                         id;  ///< Event ID: Component (bits 15..8) and Message (bits 7..0)
+  uint16_t                       time;  ///< Time since previous Record (system timer counts)
+  uint32_t                       val1;  ///< Value 1
+  uint32_t                       val2;  ///< Value 2
+} osRtxTraceRecord_t;
+ 
+/// Trace Mode
+#define osRtxTraceStream        0x00U   ///< Drop new Records when the Trace Buffer is full
+#define osRtxTraceOverwrite     0x01U   ///< Overwrite oldest Records when the Trace Buffer is full
+ 
+/// Trace Record IDs (Trace Recorder component)
+#define osRtxTraceIdStart       0xEF00U ///< Recording started: val1 = system timer frequency, val2 = format and buffer size
+#define osRtxTraceIdTime        0xEF01U ///< Time extension: val1/val2 = time since previous Record (low/high word)
+#define osRtxTraceIdData        0xEF02U ///< Data of the previous Record: val1/val2 = data
+#define osRtxTraceIdLost        0xEF03U ///< Records lost: val1 = number of events not recorded (Trace Buffer full)
+ 
+ 
 //  ==== Generic Object definitions ====
  
 /// Generic Object Control Block
@@ -274,6 +344,33 @@ typedef struct {
  
 //  ==== OS Runtime Information definitions ====
  
+/// Ready Queue Priority Bitmap structure
+typedef struct {
+  uint32_t                     map[2];  ///< Priority Bitmap (bit n set: Priority n not empty)
+  osRtxThread_t             *tail[64];  ///< Last Ready Thread of each Priority
+} osRtxReadyQueue_t;
+ 
+/// Timer Wheel size (number of slots per level)
+#define osRtxTimerWheelSize     64U
+#define osRtxTimerWheelBits     6U      ///< Number of bits of the slot index
+ 
+/// Timer Wheel levels (each level spans osRtxTimerWheelSize times the ticks of the level below)
+#define osRtxTimerWheelLevels   4U
+ 
+/// Timer Wheel structure (Thread Delays and Timers)
+typedef struct {
+  struct {                              ///< Thread Delay Wheel
+    uint32_t                     tick;  ///< Wheel Tick
+    uint32_t                    count;  ///< Number of delayed Threads
+    osRtxThread_t *slot[osRtxTimerWheelLevels*osRtxTimerWheelSize]; ///< Delayed Threads of each Level and Slot
+  } thread;
+  struct {                              ///< Timer Wheel
+    uint32_t                     tick;  ///< Wheel Tick
+    uint32_t                    count;  ///< Number of active Timers
+    osRtxTimer_t  *slot[osRtxTimerWheelLevels*osRtxTimerWheelSize]; ///< Active Timers of each Level and Slot
+  } timer;
+} osRtxTimerWheel_t;
+ 
 /// OS Runtime Information structure
 typedef struct {
   const char                   *os_id;  ///< OS Identification
@@ -375,18 +472,35 @@ extern osRtxObjectMemUsage_t osRtxMessageQueueMemUsage;
 #define osRtxSemaphoreCbSize     sizeof(osRtxSemaphore_t)
 #define osRtxMemoryPoolCbSize    sizeof(osRtxMemoryPool_t)
 #define osRtxMessageQueueCbSize  sizeof(osRtxMessageQueue_t)
+#define osRtxRingBufferCbSize    sizeof(osRtxRingBuffer_t)
  
 /// Memory size in bytes for Memory Pool storage.
 /// \param         block_count   maximum number of memory blocks in memory pool.
 /// \param         block_size    memory block size in bytes.
+#if (defined(RTX_HOST) && (RTX_HOST != 0))
+#define osRtxMemoryPoolMemSize(block_count, block_size) \
+  (8*(block_count)*(((block_size)+7)/8))
+#else
 #define osRtxMemoryPoolMemSize(block_count, block_size) \
   (4*(block_count)*(((block_size)+3)/4))
+#endif
  
 /// Memory size in bytes for Message Queue storage.
 /// \param         msg_count     maximum number of messages in queue.
 /// \param         msg_size      maximum message size in bytes.
+#if (defined(RTX_HOST) && (RTX_HOST != 0))
+#define osRtxMessageQueueMemSize(msg_count, msg_size) \
+  ((msg_count)*(sizeof(osRtxMessage_t)+(8*(((msg_size)+7)/8))))
+#else
 #define osRtxMessageQueueMemSize(msg_count, msg_size) \
   (4*(msg_count)*(3+(((msg_size)+3)/4)))
+#endif
+ 
+/// Memory size in bytes for Ring Buffer storage.
+/// \param         elem_count    maximum number of elements in ring buffer.
+/// \param         elem_size     element size in bytes.
+#define osRtxRingBufferMemSize(elem_count, elem_size) \
+  (4*((((elem_count)*(elem_size))+3)/4))
  
  
 //  ==== OS External Functions ====
@@ -404,6 +518,37 @@ extern uint32_t osRtxErrorNotify (uint32_t code, void *object_id);
 /// OS Idle Thread
 extern void osRtxIdleThread (void *argument);
  
+/// Zero-copy Message Queue: allocate a Message slot, commit it, receive it and release it
+extern void      *osRtxMessageQueueAlloc   (osMessageQueueId_t mq_id, uint32_t timeout);
+extern osStatus_t osRtxMessageQueueCommit  (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio);
+extern void      *osRtxMessageQueueReceive (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout);
+extern osStatus_t osRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr);
+ 
+/// Batched Message Queue: put or get up to msg_count Messages with a single call (without waiting)
+extern uint32_t   osRtxMessageQueuePutN    (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio);
+extern uint32_t   osRtxMessageQueueGetN    (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t msg_count);
+ 
+/// Ring Buffer: single producer / single consumer element stream
+extern osRtxRingBufferId_t osRtxRingBufferNew      (uint32_t elem_count, uint32_t elem_size, const osRtxRingBufferAttr_t *attr);
+extern osStatus_t          osRtxRingBufferDelete   (osRtxRingBufferId_t rb_id);
+extern uint32_t            osRtxRingBufferWrite    (osRtxRingBufferId_t rb_id, const void *data, uint32_t count);
+extern uint32_t            osRtxRingBufferRead     (osRtxRingBufferId_t rb_id, void *data, uint32_t count);
+extern uint32_t            osRtxRingBufferGetCount (osRtxRingBufferId_t rb_id);
+extern uint32_t            osRtxRingBufferGetSpace (osRtxRingBufferId_t rb_id);
+ 
+/// Binary Trace Recorder (OS_EVR_TRACE): record RTX events into a Trace Buffer
+extern void       osRtxTraceStart        (uint32_t mode);
+extern void       osRtxTraceStop         (void);
+extern void       osRtxTraceEnable       (uint32_t level, uint32_t comp_start, uint32_t comp_stop);
+extern void       osRtxTraceDisable      (uint32_t level, uint32_t comp_start, uint32_t comp_stop);
+extern void       osRtxTraceEventEnable  (uint32_t id);
+extern void       osRtxTraceEventDisable (uint32_t id);
+extern uint32_t   osRtxTraceRead         (osRtxTraceRecord_t *rec, uint32_t count);
+extern uint32_t   osRtxTraceGetCount     (void);
+extern uint32_t   osRtxTraceRecord2      (uint32_t id, uint32_t val1, uint32_t val2);
+extern uint32_t   osRtxTraceRecord4      (uint32_t id, uint32_t val1, uint32_t val2, uint32_t val3, uint32_t val4);
+extern uint32_t   osRtxTraceRecordData   (uint32_t id, const void *data, uint32_t len);
+ 
 /// OS Exception handlers
 extern void SVC_Handler     (void);
 extern void PendSV_Handler  (void);
@@ -414,6 +559,11 @@ extern void SysTick_Handler (void);
 extern uint32_t osRtxTzGetModuleId (void);
 #endif
  
+/// OS Thread Runtime Statistics
+#ifdef RTX_THREAD_STATS
+extern osStatus_t osRtxThreadGetStats (osThreadId_t thread_id, osRtxThreadStats_t *stats);
+#endif
+ 
  
 //  ==== OS External Configuration ====
  
@@ -421,6 +571,7 @@ extern uint32_t osRtxTzGetModuleId (void);
 #define osRtxConfigPrivilegedMode   (1UL<<0)    ///< Threads in Privileged mode
 #define osRtxConfigStackCheck       (1UL<<1)    ///< Stack overrun checking
 #define osRtxConfigStackWatermark   (1UL<<2)    ///< Stack usage Watermark
+#define osRtxConfigMemoryTlsf       (1UL<<3)    ///< TLSF dynamic memory allocator
  
 /// OS Configuration structure
 typedef struct {
@@ -460,6 +611,8 @@ typedef struct {
   const
   osMessageQueueAttr_t        *timer_mq_attr;   ///< Timer Message Queue Attributes
   uint32_t                     timer_mq_mcnt;   ///< Timer Message Queue maximum Messages
+  osRtxReadyQueue_t             *ready_queue;   ///< Ready Queue Priority Bitmap (NULL: sorted list)
+  osRtxTimerWheel_t             *timer_wheel;   ///< Timer Wheel (NULL: delta sorted lists)
 } osRtxConfig_t;
  
 extern const osRtxConfig_t osRtxConfig;         ///< OS Configuration
@@ -0,0 +1,21 @@
+
+/*
+ * Run-Time-Environment Component Configuration File
+ *
+ * Project: RTX5 host (POSIX) port
+ */
+
+#ifndef RTE_COMPONENTS_H
+#define RTE_COMPONENTS_H
+
+
+/*
+ * Define the Device Header File:
+ */
+#define CMSIS_device_header "rtx_host.h"
+
+#define RTE_CMSIS_RTOS2                 /* CMSIS-RTOS2 */
+#define RTE_CMSIS_RTOS2_RTX5            /* CMSIS-RTOS2 Keil RTX5 */
+
+
+#endif /* RTE_COMPONENTS_H */
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host thread delay and timer expiry test
+ *
+ * Checks that thread delays and timers expire exactly after the requested
+ * number of ticks, from one tick to more than 2^24 ticks (all levels of the
+ * timer wheel), that delays and timers expiring in the same tick do so in the
+ * order they were started, and that removed ones do not disturb the others.
+ * The idle thread uses tick-less idle and the kernel library is built with
+ * OS_TICK_HOST_SKIP_IDLE, so that long delays take no host time.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+
+#include "cmsis_os2.h"
+#include "os_tick.h"
+#include "rtx_host_test.h"
+
+#define ORDER_NUM               5U
+#define REMOVE_NUM              5U
+#define REMOVE_TICKS            200U
+#define PERIOD                  70U
+#define PERIOD_NUM              10U
+
+static const uint32_t Delays[] = {
+  1U, 2U, 63U, 64U, 65U, 127U, 128U, 4095U, 4096U, 4097U, 4160U, 5000U,
+  262143U, 262144U, 262145U, 300000U, 16777216U, 16777300U, 100000000U
+};
+#define DELAY_NUM               (sizeof(Delays) / sizeof(Delays[0]))
+
+// Ticks from the start of the order threads and timers to the common expiry tick
+// (highest to lowest timer wheel level, 0: start at once). The last ones start in
+// the lowest level before the others are moved to it at the aligned expiry tick:
+// by tick-less idle (skipping ticks) or by the tick (busy, cascading slots).
+static const uint32_t OrderIdle[ORDER_NUM] = { 0U, 200000U, 4000U, 63U, 63U };
+static const uint32_t OrderBusy[ORDER_NUM] = { 0U, 200U,    100U,  63U, 63U };
+static const uint32_t *OrderBefore;
+
+static osSemaphoreId_t Done;
+static osTimerId_t     Timer[DELAY_NUM];
+static uint32_t        TimerStart[DELAY_NUM];
+static uint32_t        TimerElapsed[DELAY_NUM];
+static uint32_t        DelayElapsed[DELAY_NUM];
+static osTimerId_t     Periodic;
+static uint32_t        PeriodicTick[PERIOD_NUM + 1U];
+static uint32_t        PeriodicNum;
+static uint32_t        OrderEnd;
+static osTimerId_t     OrderTimer[ORDER_NUM];
+static uint32_t        OrderThreadSeq[ORDER_NUM];
+static uint32_t        OrderThreadNum;
+static uint32_t        OrderTimerSeq[ORDER_NUM];
+static uint32_t        OrderTimerNum;
+static osThreadId_t    RemoveThread[REMOVE_NUM];
+static osTimerId_t     RemoveTimer[REMOVE_NUM];
+static uint32_t        RemoveElapsed[REMOVE_NUM];
+static uint32_t        RemoveFired[REMOVE_NUM];
+static uint32_t        RemoveStart;
+
+// Tick-less idle: idle time is skipped by the host tick (OS_TICK_HOST_SKIP_IDLE).
+__NO_RETURN void osRtxIdleThread (void *argument) {
+  (void)argument;
+  for (;;) {
+    OS_Tickless_Idle();
+  }
+}
+
+// Kernel errors (stack overflow, queue overflow) fail the test instead of halting.
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  printf("kernel error %u (object %p)\n", code, object_id);
+  HostTestErrors++;
+  HostTestExit();
+  return 0U;
+}
+
+// Start a timer within one tick and return the start tick.
+static uint32_t TimerStartTick (osTimerId_t timer, uint32_t ticks) {
+  uint32_t tick;
+
+  do {
+    tick = osKernelGetTickCount();
+    HOST_CHECK(osTimerStart(timer, ticks) == osOK);
+  } while (osKernelGetTickCount() != tick);
+  return tick;
+}
+
+
+//  ==== Expiry ====
+
+static void DelayThread (void *argument) {
+  uint32_t n    = (uint32_t)(uintptr_t)argument;
+  uint32_t tick = osKernelGetTickCount();
+
+  (void)osDelay(Delays[n]);
+  DelayElapsed[n] = osKernelGetTickCount() - tick;
+  (void)osSemaphoreRelease(Done);
+}
+
+static void TimerCallback (void *argument) {
+  uint32_t n = (uint32_t)(uintptr_t)argument;
+
+  TimerElapsed[n] = osKernelGetTickCount() - TimerStart[n];
+  (void)osSemaphoreRelease(Done);
+}
+
+static void PeriodicCallback (void *argument) {
+  (void)argument;
+  PeriodicTick[PeriodicNum++] = osKernelGetTickCount();
+  if (PeriodicNum > PERIOD_NUM) {
+    HOST_CHECK(osTimerStop(Periodic) == osOK);
+  }
+}
+
+// All delays and timers run at the same time: long ones are cascaded while short ones expire.
+static void TestExpiry (void) {
+  const osThreadAttr_t attr = { .priority = osPriorityAboveNormal };
+  uint32_t n;
+
+  Periodic = osTimerNew(PeriodicCallback, osTimerPeriodic, NULL, NULL);
+  HOST_CHECK(Periodic != NULL);
+  PeriodicTick[0] = TimerStartTick(Periodic, PERIOD);
+  PeriodicNum = 1U;
+
+  for (n = 0U; n < DELAY_NUM; n++) {
+    HOST_CHECK(osThreadNew(DelayThread, (void *)(uintptr_t)n, &attr) != NULL);
+    Timer[n] = osTimerNew(TimerCallback, osTimerOnce, (void *)(uintptr_t)n, NULL);
+    HOST_CHECK(Timer[n] != NULL);
+    TimerStart[n] = TimerStartTick(Timer[n], Delays[n]);
+  }
+  for (n = 0U; n < (2U * DELAY_NUM); n++) {
+    HOST_CHECK(osSemaphoreAcquire(Done, osWaitForever) == osOK);
+  }
+
+  for (n = 0U; n < DELAY_NUM; n++) {
+    HOST_CHECK(DelayElapsed[n] == Delays[n]);
+    HOST_CHECK(TimerElapsed[n] == Delays[n]);
+    HOST_CHECK(osTimerIsRunning(Timer[n]) == 0U);
+    (void)osTimerDelete(Timer[n]);
+  }
+
+  // Periodic timer restarts in the tick it expires
+  HOST_CHECK(PeriodicNum == (PERIOD_NUM + 1U));
+  HOST_CHECK(osTimerDelete(Periodic) == osOK);
+  for (n = 1U; n <= PERIOD_NUM; n++) {
+    HOST_CHECK((PeriodicTick[n] - PeriodicTick[n - 1U]) == PERIOD);
+  }
+}
+
+
+//  ==== Order ====
+
+static void OrderCallback (void *argument) {
+  OrderTimerSeq[OrderTimerNum++] = (uint32_t)(uintptr_t)argument;
+}
+
+// Start a delay and a timer expiring at the common tick from a different wheel level.
+static void OrderThread (void *argument) {
+  uint32_t n = (uint32_t)(uintptr_t)argument;
+  uint32_t tick;
+
+  if (OrderBefore[n] != 0U) {
+    HOST_CHECK(osDelayUntil(OrderEnd - OrderBefore[n]) == osOK);
+  }
+  do {
+    tick = osKernelGetTickCount();
+    HOST_CHECK(osTimerStart(OrderTimer[n], OrderEnd - tick) == osOK);
+  } while (osKernelGetTickCount() != tick);
+  HOST_CHECK(osDelayUntil(OrderEnd) == osOK);
+  HOST_CHECK(osKernelGetTickCount() == OrderEnd);
+  OrderThreadSeq[OrderThreadNum++] = n;
+  (void)osSemaphoreRelease(Done);
+}
+
+// Busy thread keeps the kernel from tick-less idle.
+static void BusyThread (void *argument) {
+  (void)argument;
+  for (;;) {}
+}
+
+static void TestOrder (const uint32_t *before, uint32_t ticks, uint32_t busy) {
+  const osThreadAttr_t attr      = { .priority = osPriorityAboveNormal };
+  const osThreadAttr_t busy_attr = { .priority = osPriorityLow };
+  osThreadId_t busy_id = NULL;
+  uint32_t     n;
+
+  if (busy != 0U) {
+    busy_id = osThreadNew(BusyThread, NULL, &busy_attr);
+    HOST_CHECK(busy_id != NULL);
+  }
+  OrderBefore    = before;
+  OrderThreadNum = 0U;
+  OrderTimerNum  = 0U;
+  OrderEnd = (osKernelGetTickCount() + ticks) & ~(64U - 1U);
+  for (n = 0U; n < ORDER_NUM; n++) {
+    OrderTimer[n] = osTimerNew(OrderCallback, osTimerOnce, (void *)(uintptr_t)n, NULL);
+    HOST_CHECK(OrderTimer[n] != NULL);
+    HOST_CHECK(osThreadNew(OrderThread, (void *)(uintptr_t)n, &attr) != NULL);
+  }
+  for (n = 0U; n < ORDER_NUM; n++) {
+    HOST_CHECK(osSemaphoreAcquire(Done, osWaitForever) == osOK);
+  }
+
+  HOST_CHECK(OrderThreadNum == ORDER_NUM);
+  HOST_CHECK(OrderTimerNum == ORDER_NUM);
+  for (n = 0U; n < ORDER_NUM; n++) {
+    HOST_CHECK(OrderThreadSeq[n] == n);
+    HOST_CHECK(OrderTimerSeq[n] == n);
+    (void)osTimerDelete(OrderTimer[n]);
+  }
+  if (busy_id != NULL) {
+    HOST_CHECK(osThreadTerminate(busy_id) == osOK);
+  }
+}
+
+
+//  ==== Remove ====
+
+static void RemoveThreadFunc (void *argument) {
+  uint32_t n    = (uint32_t)(uintptr_t)argument;
+  uint32_t tick = osKernelGetTickCount();
+
+  (void)osDelay(REMOVE_TICKS);
+  RemoveElapsed[n] = osKernelGetTickCount() - tick;
+  (void)osSemaphoreRelease(Done);
+}
+
+static void RemoveCallback (void *argument) {
+  uint32_t n = (uint32_t)(uintptr_t)argument;
+
+  RemoveFired[n] = osKernelGetTickCount() - RemoveStart;
+}
+
+// Delays and timers of the same slot are removed from the middle, the tail and the head.
+static void TestRemove (void) {
+  const osThreadAttr_t attr = { .priority = osPriorityAboveNormal };
+  static const uint32_t removed[3] = { 2U, REMOVE_NUM - 1U, 0U };
+  uint32_t n;
+
+  for (n = 0U; n < REMOVE_NUM; n++) {
+    RemoveTimer[n] = osTimerNew(RemoveCallback, osTimerOnce, (void *)(uintptr_t)n, NULL);
+    HOST_CHECK(RemoveTimer[n] != NULL);
+  }
+  do {
+    RemoveStart = osKernelGetTickCount();
+    for (n = 0U; n < REMOVE_NUM; n++) {
+      HOST_CHECK(osTimerStart(RemoveTimer[n], REMOVE_TICKS) == osOK);
+    }
+  } while (osKernelGetTickCount() != RemoveStart);
+  for (n = 0U; n < REMOVE_NUM; n++) {
+    RemoveThread[n] = osThreadNew(RemoveThreadFunc, (void *)(uintptr_t)n, &attr);
+    HOST_CHECK(RemoveThread[n] != NULL);
+  }
+
+  // A suspended thread moves to the wait list, resuming ends its delay
+  HOST_CHECK(osThreadSuspend(RemoveThread[1]) == osOK);
+  HOST_CHECK(osThreadGetCount() == (3U + REMOVE_NUM));
+  HOST_CHECK(osThreadResume(RemoveThread[1]) == osOK);
+  HOST_CHECK(osSemaphoreAcquire(Done, 0U) == osOK);
+  HOST_CHECK(RemoveElapsed[1] < REMOVE_TICKS);
+
+  for (n = 0U; n < 3U; n++) {
+    HOST_CHECK(osThreadTerminate(RemoveThread[removed[n]]) == osOK);
+    HOST_CHECK(osTimerStop(RemoveTimer[removed[n]]) == osOK);
+  }
+  HOST_CHECK(osThreadGetCount() == 4U);         // App, Idle, Timer, thread 3
+
+  HOST_CHECK(osSemaphoreAcquire(Done, osWaitForever) == osOK);
+  HOST_CHECK(RemoveElapsed[3] == REMOVE_TICKS);
+  (void)osDelay(1U);
+  for (n = 0U; n < REMOVE_NUM; n++) {
+    if ((n == 1U) || (n == 3U)) {
+      HOST_CHECK(RemoveFired[n] == REMOVE_TICKS);
+    } else {
+      HOST_CHECK(RemoveFired[n] == 0U);
+    }
+    (void)osTimerDelete(RemoveTimer[n]);
+  }
+}
+
+
+static void App (void *argument) {
+  uint32_t start;
+
+  (void)argument;
+
+  Done = osSemaphoreNew(2U * DELAY_NUM, 0U, NULL);
+  HOST_CHECK(Done != NULL);
+
+  start = osKernelGetTickCount();
+  TestExpiry();
+  TestOrder(OrderIdle, 300000U, 0U);
+  TestOrder(OrderBusy, 300U, 1U);
+  TestRemove();
+  HOST_CHECK(osThreadGetCount() == 3U);         // App, Idle, Timer
+
+  printf("%u ticks\n", osKernelGetTickCount() - start);
+  HostTestExit();
+}
+
+int main (void) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityNormal };
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(App, NULL, &attr);
+  (void)osKernelStart();
+  return 1;
+}
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host TLSF dynamic memory test
+ *
+ * Calls the dynamic memory functions directly (kernel not started) with the
+ * TLSF allocator (OS_MEM_TLSF) and checks after each operation the heap
+ * invariants:
+ *  - physical blocks tile the pool and headers, footers and free flags agree,
+ *  - no two free blocks are adjacent (immediate coalescing),
+ *  - each free block is in the free list of its size class and the bitmaps
+ *    match the non-empty lists,
+ *  - used memory is the sum of the allocated blocks and the overhead,
+ *  - an allocation fails only when no free block of the rounded up size
+ *    class exists (good fit),
+ *  - allocated data is not overwritten (blocks do not overlap).
+ * Random allocations and releases are reproducible with the option --seed.
+ * Also reports fragmentation and the worst-case allocation and release time.
+ *
+ * Options: --seed <n> (default 1), --ops <n> (default 200000).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+// Memory functions of the kernel library (rtx_lib.h)
+extern uint32_t osRtxMemoryInit (void *mem, uint32_t size);
+extern void    *osRtxMemoryAlloc(void *mem, uint32_t size, uint32_t type);
+extern uint32_t osRtxMemoryFree (void *mem, void *block);
+
+#define POOL_SIZE               (1024U * 1024U)
+#define LIVE_MAX                4096U
+#define FUZZ_LIVE_MAX           1024U
+#define LATENCY_OPS             100000U
+
+//  Heap layout of rtx_memory.c (TLSF)
+typedef struct {
+  uint32_t size;
+  uint32_t used;
+} mem_head_t;
+
+typedef struct mem_block_s {
+  struct mem_block_s *next;
+  uint32_t            info;
+} mem_block_t;
+
+typedef struct tlsf_free_s {
+  mem_block_t         head;
+  struct tlsf_free_s *next;
+  struct tlsf_free_s *prev;
+} tlsf_free_t;
+
+#define TLSF_SL_LOG2            3U
+#define TLSF_SL_COUNT           (1UL << TLSF_SL_LOG2)
+#define TLSF_FL_SHIFT           (TLSF_SL_LOG2 + 3U)
+#define TLSF_BLOCK_MIN          ((sizeof(tlsf_free_t) + sizeof(mem_block_t *) + 7U) & ~((uint32_t)7U))
+
+typedef struct {
+  uint32_t     sl_bitmap;
+  tlsf_free_t *free[TLSF_SL_COUNT];
+} tlsf_class_t;
+
+typedef struct {
+  uint32_t     fl_count;
+  uint32_t     fl_bitmap;
+} tlsf_control_t;
+
+#define MB_INFO_TLSF_LEN_MASK   0xFFFFFFF8U
+#define MB_INFO_TLSF_FREE       0x00000004U
+#define MB_INFO_TLSF_PREV_FREE  0x00000002U
+
+//  Heap state found by the invariant check
+typedef struct {
+  uint32_t free_num;                    // Number of free blocks
+  uint32_t free_size;                   // Total size of free blocks
+  uint32_t free_max;                    // Largest free block
+  uint32_t overhead;                    // Pool header, control block and sentinel
+} HeapState_t;
+
+//  Allocated block
+typedef struct {
+  uint8_t *ptr;
+  uint32_t size;
+  uint8_t  fill;
+} Live_t;
+
+static uint64_t    Pool[POOL_SIZE / 8U];
+static Live_t      Live[LIVE_MAX];
+static uint32_t    LiveNum;
+static HeapState_t Heap;
+
+// Check a condition and end the heap check on failure.
+#define HEAP_CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      HostTestFail(__FILE__, __LINE__, #cond); \
+      return 0U; \
+    } \
+  } while (0)
+
+
+//  ==== Heap invariants ====
+
+// Map a block size to first and second level index.
+static void Mapping (uint32_t size, uint32_t *fl, uint32_t *sl) {
+  uint32_t n;
+
+  if (size < (1UL << TLSF_FL_SHIFT)) {
+    *fl = 0U;
+    *sl = size >> 3;
+  } else {
+    n   = 31U - (uint32_t)__builtin_clz(size);
+    *fl = n - (TLSF_FL_SHIFT - 1U);
+    *sl = (size >> (n - TLSF_SL_LOG2)) - TLSF_SL_COUNT;
+  }
+}
+
+// Block size of an allocation rounded up to its size class (smallest block
+// which an allocation is guaranteed to find).
+static uint32_t SearchSize (uint32_t size) {
+  uint32_t block_size = ((size + sizeof(mem_block_t)) + 7U) & ~((uint32_t)7U);
+
+  if (block_size < TLSF_BLOCK_MIN) {
+    block_size = TLSF_BLOCK_MIN;
+  }
+  if (block_size >= (1UL << TLSF_FL_SHIFT)) {
+    block_size += (1UL << ((31U - (uint32_t)__builtin_clz(block_size)) - TLSF_SL_LOG2)) - 1U;
+  }
+  return block_size;
+}
+
+static uint32_t BlockLen (const mem_block_t *block) {
+  return (uint32_t)((uintptr_t)block->next - (uintptr_t)block);
+}
+
+// Check the heap invariants and update Heap.
+static uint32_t HeapCheck (void) {
+  const mem_head_t *head = (const mem_head_t *)Pool;
+  mem_block_t    *p, *ctrl_block, *end;
+  tlsf_control_t *ctrl;
+  tlsf_class_t   *cls;
+  tlsf_free_t    *f, *prev;
+  uint32_t        len, used, list_num, prev_free;
+  uint32_t        fl, sl, m_fl, m_sl;
+
+  HEAP_CHECK(head->size == POOL_SIZE);
+
+  // Physical blocks up to the control block (the block before the sentinel)
+  end  = (mem_block_t *)((uint8_t *)Pool + POOL_SIZE - sizeof(mem_block_t));
+  used = 0U;
+  prev_free = 0U;
+  Heap.free_num  = 0U;
+  Heap.free_size = 0U;
+  Heap.free_max  = 0U;
+  p = (mem_block_t *)((uint8_t *)Pool + sizeof(mem_head_t));
+  while (p->next != end) {
+    HEAP_CHECK((p->next > p) && (p->next < end));
+    len = BlockLen(p);
+    HEAP_CHECK(((len & 7U) == 0U) && (len >= TLSF_BLOCK_MIN));
+    HEAP_CHECK((p->info & MB_INFO_TLSF_LEN_MASK) == len);
+    HEAP_CHECK(((p->info & MB_INFO_TLSF_PREV_FREE) != 0U) == (prev_free != 0U));
+    if ((p->info & MB_INFO_TLSF_FREE) != 0U) {
+      HEAP_CHECK(prev_free == 0U);                      // Coalesced
+      HEAP_CHECK(((mem_block_t **)p->next)[-1] == p);   // Footer
+      Heap.free_num++;
+      Heap.free_size += len;
+      if (len > Heap.free_max) {
+        Heap.free_max = len;
+      }
+      prev_free = 1U;
+    } else {
+      used += len;
+      prev_free = 0U;
+    }
+    p = p->next;
+  }
+  ctrl_block = p;
+  HEAP_CHECK((ctrl_block->info & ~MB_INFO_TLSF_LEN_MASK) == (prev_free * MB_INFO_TLSF_PREV_FREE));
+  HEAP_CHECK((ctrl_block->info & MB_INFO_TLSF_LEN_MASK) == BlockLen(ctrl_block));
+  HEAP_CHECK(end->next == NULL);
+
+  Heap.overhead = (uint32_t)(sizeof(mem_head_t) + BlockLen(ctrl_block) + sizeof(mem_block_t));
+  HEAP_CHECK(head->used == (used + Heap.overhead));
+  HEAP_CHECK(end->info >= head->used);                  // Max used memory
+  HEAP_CHECK((used + Heap.overhead + Heap.free_size) == POOL_SIZE);
+
+  // Segregated free lists and bitmaps
+  ctrl = (tlsf_control_t *)&ctrl_block[1];
+  HEAP_CHECK((ctrl->fl_count != 0U) && (ctrl->fl_count < 32U));
+  HEAP_CHECK((ctrl->fl_bitmap >> ctrl->fl_count) == 0U);
+  list_num = 0U;
+  for (fl = 0U; fl < ctrl->fl_count; fl++) {
+    cls = &((tlsf_class_t *)&ctrl[1])[fl];
+    HEAP_CHECK((cls->sl_bitmap != 0U) == ((ctrl->fl_bitmap & (1UL << fl)) != 0U));
+    HEAP_CHECK((cls->sl_bitmap >> TLSF_SL_COUNT) == 0U);
+    for (sl = 0U; sl < TLSF_SL_COUNT; sl++) {
+      HEAP_CHECK((cls->free[sl] != NULL) == ((cls->sl_bitmap & (1UL << sl)) != 0U));
+      prev = NULL;
+      for (f = cls->free[sl]; f != NULL; f = f->next) {
+        HEAP_CHECK(((mem_block_t *)f > (mem_block_t *)Pool) && ((mem_block_t *)f < ctrl_block));
+        HEAP_CHECK((f->head.info & MB_INFO_TLSF_FREE) != 0U);
+        HEAP_CHECK(f->prev == prev);
+        Mapping(BlockLen(&f->head), &m_fl, &m_sl);
+        HEAP_CHECK((m_fl == fl) && (m_sl == sl));
+        HEAP_CHECK(list_num < Heap.free_num);           // No cycle
+        list_num++;
+        prev = f;
+      }
+    }
+  }
+  HEAP_CHECK(list_num == Heap.free_num);
+
+  return 1U;
+}
+
+
+//  ==== Allocation helpers ====
+
+// Initialize the pool, blocks of a previous test are dropped.
+static uint32_t HeapInit (void) {
+  LiveNum = 0U;
+  HEAP_CHECK(osRtxMemoryInit(Pool, POOL_SIZE) == 1U);
+  return HeapCheck();
+}
+
+// Allocate and fill a block, check a failure against the good fit guarantee.
+static uint32_t HeapAlloc (uint32_t size, uint8_t fill) {
+  uint8_t *ptr;
+
+  ptr = osRtxMemoryAlloc(Pool, size, 0U);
+  if (HeapCheck() == 0U) {
+    return 0U;
+  }
+  if (ptr == NULL) {
+    HEAP_CHECK(Heap.free_max < SearchSize(size));
+    return 1U;
+  }
+  HEAP_CHECK(((uintptr_t)ptr & 7U) == 0U);
+  HEAP_CHECK((ptr > (uint8_t *)Pool) && ((ptr + size) <= ((uint8_t *)Pool + POOL_SIZE)));
+  HEAP_CHECK((((mem_block_t *)ptr)[-1].info & MB_INFO_TLSF_LEN_MASK) >= (size + sizeof(mem_block_t)));
+  HEAP_CHECK(LiveNum < LIVE_MAX);
+  (void)memset(ptr, fill, size);
+  Live[LiveNum].ptr  = ptr;
+  Live[LiveNum].size = size;
+  Live[LiveNum].fill = fill;
+  LiveNum++;
+  return 1U;
+}
+
+// Check the data of a block, release it and check that a repeated release fails.
+static uint32_t HeapFree (uint32_t n) {
+  Live_t   live = Live[n];
+  uint32_t i;
+
+  for (i = 0U; i < live.size; i++) {
+    HEAP_CHECK(live.ptr[i] == live.fill);
+  }
+  Live[n] = Live[--LiveNum];
+
+  HEAP_CHECK(osRtxMemoryFree(Pool, live.ptr + 4) == 0U);
+  HEAP_CHECK(osRtxMemoryFree(Pool, live.ptr) == 1U);
+  HEAP_CHECK(osRtxMemoryFree(Pool, live.ptr) == 0U);
+  return HeapCheck();
+}
+
+// Release all blocks and check that the pool is coalesced into one free block.
+static uint32_t HeapFreeAll (void) {
+  while (LiveNum != 0U) {
+    if (HeapFree(LiveNum - 1U) == 0U) {
+      return 0U;
+    }
+  }
+  HEAP_CHECK(Heap.free_num == 1U);
+  HEAP_CHECK(Heap.free_size == (POOL_SIZE - Heap.overhead));
+  return 1U;
+}
+
+// Random allocation size: mostly small, some medium and few large blocks.
+static uint32_t RandSize (uint32_t *rand) {
+  uint32_t r = HostRand(rand);
+
+  switch (r % 20U) {
+    case 0U:
+      return 1025U + ((r >> 8) % 32768U);
+    case 1U: case 2U: case 3U: case 4U:
+      return 65U + ((r >> 8) % 960U);
+    default:
+      return 1U + ((r >> 8) % 64U);
+  }
+}
+
+
+//  ==== Tests ====
+
+// Parameter checks and a full pool allocation.
+static void TestInit (void) {
+  uint32_t size;
+
+  HOST_CHECK(osRtxMemoryInit(Pool, 64U) == 0U);
+  HOST_CHECK(osRtxMemoryInit((uint8_t *)Pool + 4, POOL_SIZE - 8U) == 0U);
+  if (HeapInit() == 0U) {
+    return;
+  }
+  HOST_CHECK(Heap.free_num == 1U);
+
+  HOST_CHECK(osRtxMemoryAlloc(Pool, 0U, 0U) == NULL);
+  HOST_CHECK(osRtxMemoryAlloc(Pool, 16U, 2U) == NULL);   // Type not supported by TLSF
+  HOST_CHECK(osRtxMemoryAlloc(Pool, POOL_SIZE, 0U) == NULL);
+  HOST_CHECK(osRtxMemoryFree(Pool, (uint8_t *)Pool + 64) == 0U);
+
+  // The whole free block can be allocated (exact size class fallback)
+  size = Heap.free_max - sizeof(mem_block_t);
+  HOST_CHECK(HeapAlloc(size + 1U, 0x11U) == 1U);
+  HOST_CHECK(LiveNum == 0U);
+  HOST_CHECK(HeapAlloc(size, 0x22U) == 1U);
+  HOST_CHECK((LiveNum == 1U) && (Heap.free_num == 0U));
+  HOST_CHECK(HeapFreeAll() == 1U);
+}
+
+// Random allocations and releases.
+static void TestFuzz (uint32_t seed, uint32_t ops) {
+  uint32_t rand = seed;
+  uint32_t fails = 0U;
+  uint32_t free_max = 0U;
+  uint32_t num;
+  uint32_t r;
+
+  if (HeapInit() == 0U) {
+    return;
+  }
+  for (; ops != 0U; ops--) {
+    r = HostRand(&rand);
+    if ((LiveNum != 0U) && ((LiveNum == FUZZ_LIVE_MAX) || ((r % 100U) < 45U))) {
+      if (HeapFree((r >> 8) % LiveNum) == 0U) {
+        return;
+      }
+    } else {
+      num = LiveNum;
+      if (HeapAlloc(RandSize(&rand), (uint8_t)(r >> 24)) == 0U) {
+        return;
+      }
+      if (LiveNum == num) {
+        fails++;
+      }
+    }
+    if (Heap.free_num > free_max) {
+      free_max = Heap.free_num;
+    }
+  }
+  printf("fuzz: %u live blocks, %u failed allocations, max %u free blocks\n",
+         LiveNum, fails, free_max);
+  HOST_CHECK(HeapFreeAll() == 1U);
+}
+
+// Fragment the pool with alternating small and large blocks and release the
+// small ones: larger allocations must then use the large holes only.
+static void TestFragmentation (void) {
+  uint32_t n, num;
+
+  if (HeapInit() == 0U) {
+    return;
+  }
+  for (n = 0U; LiveNum < LIVE_MAX; n++) {
+    num = LiveNum;
+    if (HeapAlloc(((n & 1U) == 0U) ? 32U : 900U, (uint8_t)n) == 0U) {
+      return;
+    }
+    if (LiveNum == num) {
+      break;
+    }
+  }
+  // Release the small blocks (even entries, kept in place by releasing from the end)
+  for (n = LiveNum; n != 0U; n--) {
+    if ((Live[n - 1U].size == 32U) && (HeapFree(n - 1U) == 0U)) {
+      return;
+    }
+  }
+  printf("fragmentation: %u free blocks, largest %u of %u bytes free (%.1f%%)\n",
+         Heap.free_num, Heap.free_max, Heap.free_size,
+         100.0 * (1.0 - ((double)Heap.free_max / (double)Heap.free_size)));
+
+  // A small allocation reuses a hole, the largest free block is too small for itself
+  num = Heap.free_num;
+  HOST_CHECK(HeapAlloc(8U, 0x33U) == 1U);
+  HOST_CHECK(Heap.free_num <= num);
+  HOST_CHECK(HeapAlloc(Heap.free_max, 0x44U) == 1U);
+  HOST_CHECK(HeapFreeAll() == 1U);
+}
+
+// Worst-case time of allocation and release in a fragmented pool.
+static void TestLatency (uint32_t seed) {
+  uint32_t rand = seed;
+  uint64_t time, alloc_max, free_max, alloc_sum, free_sum;
+  uint32_t alloc_num, free_num;
+  uint32_t n, r;
+  uint8_t *ptr;
+
+  // Touch the pool and the allocated block table first (no page faults in the measurement)
+  (void)memset(Pool, 0, sizeof(Pool));
+  (void)memset(Live, 0, sizeof(Live));
+  if (HeapInit() == 0U) {
+    return;
+  }
+  alloc_max = 0U; alloc_sum = 0U; alloc_num = 0U;
+  free_max  = 0U; free_sum  = 0U; free_num  = 0U;
+  for (n = 0U; n < LATENCY_OPS; n++) {
+    r = HostRand(&rand);
+    if ((LiveNum != 0U) && ((LiveNum == FUZZ_LIVE_MAX) || ((r % 100U) < 45U))) {
+      r = (r >> 8) % LiveNum;
+      ptr = Live[r].ptr;
+      Live[r] = Live[--LiveNum];
+      time = HostTimeNs();
+      (void)osRtxMemoryFree(Pool, ptr);
+      time = HostTimeNs() - time;
+      free_sum += time;
+      free_num++;
+      if (time > free_max) {
+        free_max = time;
+      }
+    } else {
+      r = RandSize(&rand);
+      time = HostTimeNs();
+      ptr = osRtxMemoryAlloc(Pool, r, 0U);
+      time = HostTimeNs() - time;
+      alloc_sum += time;
+      alloc_num++;
+      if (time > alloc_max) {
+        alloc_max = time;
+      }
+      if (ptr != NULL) {
+        Live[LiveNum].ptr  = ptr;
+        Live[LiveNum].size = 0U;
+        LiveNum++;
+      }
+    }
+  }
+  printf("latency: alloc avg %.1f ns max %u ns, free avg %.1f ns max %u ns\n",
+         (double)alloc_sum / (double)alloc_num, (uint32_t)alloc_max,
+         (double)free_sum  / (double)free_num,  (uint32_t)free_max);
+  HOST_CHECK(HeapCheck() == 1U);
+  HOST_CHECK(HeapFreeAll() == 1U);
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t seed = (uint32_t)strtoul(HostTestOption(argc, argv, "seed", "1"),      NULL, 0);
+  uint32_t ops  = (uint32_t)strtoul(HostTestOption(argc, argv, "ops",  "200000"), NULL, 0);
+
+  if (seed == 0U) {
+    printf("Usage: %s [--seed <n>] [--ops <n>]\n", argv[0]);
+    return 2;
+  }
+
+  TestInit();
+  TestFuzz(seed, ops);
+  TestFragmentation();
+  TestLatency(seed);
+  HostTestExit();
+  return 1;
+}
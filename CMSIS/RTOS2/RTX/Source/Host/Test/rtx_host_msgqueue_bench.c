@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host message queue throughput benchmark
+ *
+ * Measures the time per message for message sizes from 4 to 1024 bytes:
+ *  - copy: osMessageQueuePut and osMessageQueueGet in the same thread,
+ *  - zero_copy: osRtxMessageQueueAlloc/Commit and Receive/Release,
+ *  - batch: osRtxMessageQueuePutN and GetN with 16 messages per call,
+ *  - pipeline: copy to a consumer thread of higher priority which waits for
+ *    each message (a thread switch per message).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+#define QUEUE_DEPTH             16U
+#define MSG_SIZE_MAX            1024U
+
+static osMessageQueueId_t Queue;
+static osThreadId_t       Consumer;
+static uint32_t           MsgSize;
+
+static uint64_t Src[(QUEUE_DEPTH * MSG_SIZE_MAX) / 8U];
+static uint64_t Dst[(QUEUE_DEPTH * MSG_SIZE_MAX) / 8U];
+
+
+static int32_t QueueSetup (uint32_t param) {
+  MsgSize = param;
+  (void)memset(Src, 0x5A, sizeof(Src));
+  Queue = osMessageQueueNew(QUEUE_DEPTH, param, NULL);
+  return ((Queue != NULL) ? 0 : -1);
+}
+
+static void QueueTeardown (void) {
+  (void)osMessageQueueDelete(Queue);
+}
+
+static void CopyRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osMessageQueuePut(Queue, Src, 0U, 0U);
+    (void)osMessageQueueGet(Queue, Dst, NULL, 0U);
+  }
+}
+
+// Producer fills the slot and the consumer reads it in place.
+static void ZeroCopyRun (uint32_t count) {
+  uint8_t *slot;
+
+  for (; count != 0U; count--) {
+    slot = osRtxMessageQueueAlloc(Queue, 0U);
+    (void)memcpy(slot, Src, MsgSize);
+    (void)osRtxMessageQueueCommit(Queue, slot, 0U);
+    slot = osRtxMessageQueueReceive(Queue, NULL, 0U);
+    (void)memcpy(Dst, slot, MsgSize);
+    (void)osRtxMessageQueueRelease(Queue, slot);
+  }
+}
+
+// Messages are counted individually, the last batch may be shorter.
+static void BatchRun (uint32_t count) {
+  uint32_t n;
+
+  while (count != 0U) {
+    n = (count < QUEUE_DEPTH) ? count : QUEUE_DEPTH;
+    (void)osRtxMessageQueuePutN(Queue, Src, n, 0U);
+    (void)osRtxMessageQueueGetN(Queue, Dst, NULL, n);
+    count -= n;
+  }
+}
+
+
+//  ==== Pipeline ====
+
+static void ConsumerThread (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osMessageQueueGet(Queue, Dst, NULL, osWaitForever);
+  }
+}
+
+static int32_t PipelineSetup (uint32_t param) {
+  const osThreadAttr_t attr = { .priority = osPriorityAboveNormal };
+
+  if (QueueSetup(param) != 0) {
+    return -1;
+  }
+  Consumer = osThreadNew(ConsumerThread, NULL, &attr);
+  return ((Consumer != NULL) ? 0 : -1);
+}
+
+static void PipelineTeardown (void) {
+  (void)osThreadTerminate(Consumer);
+  QueueTeardown();
+}
+
+// Each message is passed to the waiting consumer, which runs and waits again.
+static void PipelineRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osMessageQueuePut(Queue, Src, 0U, osWaitForever);
+  }
+}
+
+
+static const HostBenchCase_t Cases[] = {
+  { "copy_4",             4U, QueueSetup,    CopyRun,     QueueTeardown    },
+  { "copy_64",           64U, QueueSetup,    CopyRun,     QueueTeardown    },
+  { "copy_256",         256U, QueueSetup,    CopyRun,     QueueTeardown    },
+  { "copy_1024",       1024U, QueueSetup,    CopyRun,     QueueTeardown    },
+  { "zero_copy_4",        4U, QueueSetup,    ZeroCopyRun, QueueTeardown    },
+  { "zero_copy_64",      64U, QueueSetup,    ZeroCopyRun, QueueTeardown    },
+  { "zero_copy_256",    256U, QueueSetup,    ZeroCopyRun, QueueTeardown    },
+  { "zero_copy_1024",  1024U, QueueSetup,    ZeroCopyRun, QueueTeardown    },
+  { "batch_4",            4U, QueueSetup,    BatchRun,    QueueTeardown    },
+  { "batch_64",          64U, QueueSetup,    BatchRun,    QueueTeardown    },
+  { "batch_256",        256U, QueueSetup,    BatchRun,    QueueTeardown    },
+  { "batch_1024",      1024U, QueueSetup,    BatchRun,    QueueTeardown    },
+  { "pipeline_4",         4U, PipelineSetup, PipelineRun, PipelineTeardown },
+  { "pipeline_64",       64U, PipelineSetup, PipelineRun, PipelineTeardown },
+  { "pipeline_256",     256U, PipelineSetup, PipelineRun, PipelineTeardown },
+  { "pipeline_1024",   1024U, PipelineSetup, PipelineRun, PipelineTeardown }
+};
+
+int main (int argc, char *argv[]) {
+  return HostBenchMain(argc, argv, "RTX5 host message queue benchmark", Cases, sizeof(Cases) / sizeof(Cases[0]));
+}
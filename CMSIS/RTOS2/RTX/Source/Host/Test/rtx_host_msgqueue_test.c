@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host message queue interrupt batch test
+ *
+ * The application thread puts messages with random priorities and raises a
+ * device interrupt, which takes and puts messages with random sequences of
+ * osRtxMessageQueueGetN, osMessageQueueGet and osRtxMessageQueuePutN. The
+ * messages are checked against a model of the queue (priority order, FIFO
+ * within a priority): inside the interrupt the taken messages still hold
+ * their memory block and new ones are not yet in the queue, after the post
+ * interrupt processing exactly the taken messages are removed and the new ones
+ * inserted. A higher priority sender blocked on the full queue is woken up by
+ * an interrupt batch.
+ *
+ * Options: --seed <n> (default 1), --rounds <n> (default 100000).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+#define QUEUE_DEPTH             16U
+#define BATCH_MAX               8U
+#define PRIO_MAX                4U
+#define IRQ_OPS_MAX             4U
+#define IRQ_NUM                 Host0_IRQn
+
+//  Message in the model
+typedef struct {
+  uint32_t value;
+  uint8_t  prio;
+} Msg_t;
+
+static osMessageQueueId_t Queue;
+static uint32_t           Seed;
+static uint32_t           Rounds;
+static uint32_t           Rand;
+static uint32_t           Value;                // Next message value
+
+// Model of the queue content and messages put by the interrupt
+static Msg_t              Model[QUEUE_DEPTH];
+static uint32_t           ModelNum;
+static Msg_t              Pending[QUEUE_DEPTH];
+static uint32_t           PendingNum;
+static uint32_t           TakenNum;             // Taken by the interrupt, not yet freed
+
+// Statistics
+static uint32_t           TakenTotal;
+static uint32_t           PutTotal;
+static uint32_t           FullCount;
+
+
+//  ==== Model ====
+
+// Insert behind all messages with the same or a higher priority.
+static void ModelInsert (uint32_t value, uint8_t prio) {
+  uint32_t n;
+
+  for (n = ModelNum; (n != 0U) && (Model[n - 1U].prio < prio); n--) {
+    Model[n] = Model[n - 1U];
+  }
+  Model[n].value = value;
+  Model[n].prio  = prio;
+  ModelNum++;
+}
+
+// Check a received message against the model head and remove it.
+static void ModelTake (uint32_t value, uint8_t prio) {
+  uint32_t n;
+
+  HOST_CHECK(ModelNum != 0U);
+  if (ModelNum == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+  HOST_CHECK(value == Model[0].value);
+  HOST_CHECK(prio  == Model[0].prio);
+  ModelNum--;
+  for (n = 0U; n < ModelNum; n++) {
+    Model[n] = Model[n + 1U];
+  }
+}
+
+static void ModelCheck (void) {
+  HOST_CHECK(osMessageQueueGetCount(Queue) == ModelNum);
+  HOST_CHECK(osMessageQueueGetSpace(Queue) == (QUEUE_DEPTH - ModelNum));
+}
+
+
+//  ==== Interrupt side ====
+
+static void IrqGetN (void) {
+  uint32_t value[BATCH_MAX];
+  uint8_t  prio[BATCH_MAX];
+  uint32_t num, expected, n;
+
+  num = 1U + (HostRand(&Rand) % BATCH_MAX);
+  expected = (num < ModelNum) ? num : ModelNum;
+  n = osRtxMessageQueueGetN(Queue, value, prio, num);
+  HOST_CHECK(n == expected);
+  for (num = 0U; num < n; num++) {
+    ModelTake(value[num], prio[num]);
+  }
+  TakenNum += n;
+}
+
+static void IrqGet (void) {
+  uint32_t   value;
+  uint8_t    prio;
+  osStatus_t status;
+
+  status = osMessageQueueGet(Queue, &value, &prio, 0U);
+  if (ModelNum == 0U) {
+    HOST_CHECK(status == osErrorResource);
+  } else {
+    HOST_CHECK(status == osOK);
+    ModelTake(value, prio);
+    TakenNum++;
+  }
+}
+
+// Messages put by the interrupt are inserted by the post interrupt processing.
+static void IrqPutN (void) {
+  uint32_t value[BATCH_MAX];
+  uint32_t num, expected, n;
+  uint8_t  prio;
+
+  num  = 1U + (HostRand(&Rand) % BATCH_MAX);
+  prio = (uint8_t)(HostRand(&Rand) % PRIO_MAX);
+  expected = QUEUE_DEPTH - ModelNum - TakenNum - PendingNum;
+  if (expected > num) {
+    expected = num;
+  }
+  for (n = 0U; n < num; n++) {
+    value[n] = Value + n;
+  }
+  n = osRtxMessageQueuePutN(Queue, value, num, prio);
+  HOST_CHECK(n == expected);
+  for (num = 0U; num < n; num++) {
+    Pending[PendingNum].value = Value++;
+    Pending[PendingNum].prio  = prio;
+    PendingNum++;
+  }
+  PutTotal += n;
+}
+
+// Device interrupt: random sequence of gets and puts.
+static void IrqHandler (void) {
+  uint32_t ops;
+
+  ops = 1U + (HostRand(&Rand) % IRQ_OPS_MAX);
+  for (; ops != 0U; ops--) {
+    switch (HostRand(&Rand) % 4U) {
+      case 0U:
+      case 1U:
+        IrqGetN();
+        break;
+      case 2U:
+        IrqGet();
+        break;
+      default:
+        IrqPutN();
+        break;
+    }
+  }
+  // Memory of taken messages is still held
+  HOST_CHECK(osMessageQueueGetCount(Queue) == ModelNum);
+}
+
+
+//  ==== Test ====
+
+static void Irq (void) {
+  uint32_t n;
+
+  TakenNum   = 0U;
+  PendingNum = 0U;
+  NVIC_SetPendingIRQ(IRQ_NUM);
+  TakenTotal += TakenNum;
+  for (n = 0U; n < PendingNum; n++) {
+    ModelInsert(Pending[n].value, Pending[n].prio);
+  }
+  ModelCheck();
+}
+
+static void TestRandom (void) {
+  uint32_t round, num;
+  uint8_t  prio;
+
+  for (round = 0U; round < Rounds; round++) {
+    num = HostRand(&Rand) % (QUEUE_DEPTH - ModelNum + 1U);
+    for (; num != 0U; num--) {
+      prio = (uint8_t)(HostRand(&Rand) % PRIO_MAX);
+      HOST_CHECK(osMessageQueuePut(Queue, &Value, prio, 0U) == osOK);
+      ModelInsert(Value++, prio);
+    }
+    if (ModelNum == QUEUE_DEPTH) {
+      FullCount++;
+    }
+    Irq();
+    if (HostTestErrors != 0U) {
+      printf("round %u failed\n", round);
+      //lint -e{904} "Return statement before end of function"
+      return;
+    }
+  }
+}
+
+static void Sender (void *argument) {
+  HOST_CHECK(osMessageQueuePut(Queue, argument, 0U, osWaitForever) == osOK);
+}
+
+// Device interrupt: take three messages in one batch.
+static void IrqBatch (void) {
+  uint32_t value[3];
+  uint8_t  prio[3];
+  uint32_t n;
+
+  HOST_CHECK(osRtxMessageQueueGetN(Queue, value, prio, 3U) == 3U);
+  for (n = 0U; n < 3U; n++) {
+    ModelTake(value[n], prio[n]);
+  }
+}
+
+// Slots freed by an interrupt batch go to the waiting sender.
+static void TestSender (void) {
+  const osThreadAttr_t attr = { .attr_bits = osThreadJoinable, .priority = osPriorityRealtime };
+  osThreadId_t thread;
+  uint32_t     value;
+
+  while (ModelNum < QUEUE_DEPTH) {
+    HOST_CHECK(osMessageQueuePut(Queue, &Value, 1U, 0U) == osOK);
+    ModelInsert(Value++, 1U);
+  }
+  value  = Value++;
+  thread = osThreadNew(Sender, &value, &attr);
+  HOST_CHECK(thread != NULL);
+  HOST_CHECK(osThreadGetState(thread) == osThreadBlocked);
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(IRQ_NUM, (uint32_t)(uintptr_t)IrqBatch);
+  NVIC_SetPendingIRQ(IRQ_NUM);
+  ModelInsert(value, 0U);
+  HOST_CHECK(osThreadJoin(thread) == osOK);
+  ModelCheck();
+}
+
+static void TestDrain (void) {
+  uint32_t value[QUEUE_DEPTH];
+  uint8_t  prio[QUEUE_DEPTH];
+  uint32_t num, n;
+
+  num = osRtxMessageQueueGetN(Queue, value, prio, QUEUE_DEPTH);
+  HOST_CHECK(num == ModelNum);
+  for (n = 0U; n < num; n++) {
+    ModelTake(value[n], prio[n]);
+  }
+  ModelCheck();
+}
+
+static void App (void *argument) {
+  (void)argument;
+
+  Queue = osMessageQueueNew(QUEUE_DEPTH, sizeof(uint32_t), NULL);
+  HOST_CHECK(Queue != NULL);
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(IRQ_NUM, (uint32_t)(uintptr_t)IrqHandler);
+  NVIC_EnableIRQ(IRQ_NUM);
+  Rand = Seed;
+
+  TestRandom();
+  printf("random: %u rounds, %u taken, %u put by interrupt, %u full\n",
+         Rounds, TakenTotal, PutTotal, FullCount);
+  TestSender();
+  TestDrain();
+  HOST_CHECK(osMessageQueueDelete(Queue) == osOK);
+
+  HostTestExit();
+}
+
+int main (int argc, char *argv[]) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityHigh };
+
+  Seed   = (uint32_t)strtoul(HostTestOption(argc, argv, "seed",   "1"),      NULL, 0);
+  Rounds = (uint32_t)strtoul(HostTestOption(argc, argv, "rounds", "100000"), NULL, 0);
+  if (Seed == 0U) {
+    printf("Usage: %s [--seed <n>] [--rounds <n>]\n", argv[0]);
+    return 2;
+  }
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(App, NULL, &attr);
+  (void)osKernelStart();
+  return 1;
+}
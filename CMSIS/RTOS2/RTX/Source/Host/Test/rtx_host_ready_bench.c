@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host ready queue latency benchmark
+ *
+ * Measures making a thread ready (resume) and changing the priority of a
+ * ready thread with a number of other ready threads of higher priorities.
+ * The thread is the one with the lowest priority, which is the worst case for
+ * the sorted ready list and independent of the number of ready threads with
+ * the ready queue priority bitmap (OS_READY_BITMAP). Built once for each.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stddef.h>
+
+#include "cmsis_os2.h"
+#include "rtx_host_test.h"
+
+#define READY_MAX               128U
+#define READY_STACK_SIZE        16384U
+
+static osThreadId_t Ready[READY_MAX];
+static uint32_t     ReadyNum;
+static osThreadId_t Victim;
+
+// Ready threads do not run: the benchmark thread has a higher priority and does not wait.
+static void ReadyThread (void *argument) {
+  (void)argument;
+  for (;;) {}
+}
+
+// Create the victim with the lowest priority and param ready threads with higher
+// priorities (up to Below Normal 7).
+static int32_t ReadySetup (uint32_t param) {
+  osThreadAttr_t attr = { .stack_size = READY_STACK_SIZE };
+
+  attr.priority = osPriorityLow;
+  Victim = osThreadNew(ReadyThread, NULL, &attr);
+  if (Victim == NULL) {
+    return -1;
+  }
+  for (ReadyNum = 0U; ReadyNum < param; ReadyNum++) {
+    attr.priority = (osPriority_t)((uint32_t)osPriorityLow + 1U + (ReadyNum % 15U));
+    Ready[ReadyNum] = osThreadNew(ReadyThread, NULL, &attr);
+    if (Ready[ReadyNum] == NULL) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void ReadyTeardown (void) {
+  uint32_t n;
+
+  (void)osThreadTerminate(Victim);
+  for (n = 0U; n < ReadyNum; n++) {
+    (void)osThreadTerminate(Ready[n]);
+  }
+}
+
+static void ResumeRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osThreadSuspend(Victim);
+    (void)osThreadResume(Victim);
+  }
+}
+
+static void SetPriorityRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osThreadSetPriority(Victim, osPriorityLow1);
+    (void)osThreadSetPriority(Victim, osPriorityLow);
+  }
+}
+
+
+static const HostBenchCase_t Cases[] = {
+  { "suspend_resume_1",       1U, ReadySetup, ResumeRun,      ReadyTeardown },
+  { "suspend_resume_8",       8U, ReadySetup, ResumeRun,      ReadyTeardown },
+  { "suspend_resume_32",     32U, ReadySetup, ResumeRun,      ReadyTeardown },
+  { "suspend_resume_128",   128U, ReadySetup, ResumeRun,      ReadyTeardown },
+  { "set_priority_x2_1",      1U, ReadySetup, SetPriorityRun, ReadyTeardown },
+  { "set_priority_x2_8",      8U, ReadySetup, SetPriorityRun, ReadyTeardown },
+  { "set_priority_x2_32",    32U, ReadySetup, SetPriorityRun, ReadyTeardown },
+  { "set_priority_x2_128",  128U, ReadySetup, SetPriorityRun, ReadyTeardown }
+};
+
+int main (int argc, char *argv[]) {
+#if (OS_READY_BITMAP != 0)
+  const char *title = "RTX5 host ready queue benchmark (priority bitmap)";
+#else
+  const char *title = "RTX5 host ready queue benchmark (sorted list)";
+#endif
+  return HostBenchMain(argc, argv, title, Cases, sizeof(Cases) / sizeof(Cases[0]));
+}
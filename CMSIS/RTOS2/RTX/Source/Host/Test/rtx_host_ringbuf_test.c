@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host ring buffer producer/consumer stress test
+ *
+ * A producer streams a sequence of elements through a ring buffer to a
+ * consumer, with random chunk sizes on both sides, and the consumer checks
+ * that every element arrives once, in order and not torn. The element count
+ * is not a power of two and elements are not word sized, so that the chunks
+ * wrap around the storage at all positions. Runs:
+ *  - polling: producer and consumer threads of the same priority yield when
+ *    the buffer is full or empty (and at random),
+ *  - threshold: the consumer thread has a higher priority and waits for the
+ *    wakeup event flags,
+ *  - irq_producer and irq_consumer: one side is a device interrupt raised by
+ *    a host timer signal, which preempts the other side within its write or
+ *    read at random points. The thread side sleeps at random so that the
+ *    interrupt side also finds the buffer full or empty.
+ *
+ * Options: --seed <n> (default 1), --count <n> (default 1000000).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+#define RB_ELEMENTS             61U
+#define RB_THRESHOLD            16U
+#define CHUNK_MAX               24U
+#define WAKEUP_FLAG             1U
+#define IRQ_PERIOD_NS           20000U
+#define IRQ_NUM                 Host0_IRQn
+
+//  Element (checked for torn copies)
+typedef struct {
+  uint32_t seq;
+  uint32_t inv;
+  uint32_t mix;
+} Elem_t;
+
+//  Run mode
+typedef enum {
+  ModePolling = 0,
+  ModeThreshold,
+  ModeIrqProducer,
+  ModeIrqConsumer
+} Mode_t;
+
+static const char * const ModeName[] = { "polling", "threshold", "irq_producer", "irq_consumer" };
+
+static osRtxRingBufferId_t RingBuffer;
+static osEventFlagsId_t    Wakeup;
+static Mode_t              Mode;
+static uint32_t            Count;       // Elements per run
+static uint32_t            Seed;
+static timer_t             IrqTimer;
+
+// Producer and consumer state
+static uint32_t            ProducerSeq;
+static uint32_t            ProducerRand;
+static uint32_t            ConsumerRand;
+static volatile uint32_t   ConsumerSeq;
+static volatile uint32_t   Failed;      // Consumer found invalid element
+static Elem_t              FailedElem;
+
+// Run statistics
+static volatile uint32_t   ProducerFull;
+static volatile uint32_t   ConsumerEmpty;
+static volatile uint32_t   IrqCount;
+
+
+static void ElemSet (Elem_t *elem, uint32_t seq) {
+  elem->seq = seq;
+  elem->inv = ~seq;
+  elem->mix = seq * 0x9E3779B9U;
+}
+
+static uint32_t ElemValid (const Elem_t *elem, uint32_t seq) {
+  return ((elem->seq == seq) && (elem->inv == ~seq) && (elem->mix == (seq * 0x9E3779B9U))) ? 1U : 0U;
+}
+
+// Write a chunk of random size, return number of elements written.
+static uint32_t ProducerStep (void) {
+  Elem_t   chunk[CHUNK_MAX];
+  uint32_t num, n, i;
+
+  num = 1U + (HostRand(&ProducerRand) % CHUNK_MAX);
+  if (num > (Count - ProducerSeq)) {
+    num = Count - ProducerSeq;
+  }
+  for (i = 0U; i < num; i++) {
+    ElemSet(&chunk[i], ProducerSeq + i);
+  }
+  n = osRtxRingBufferWrite(RingBuffer, chunk, num);
+  if (n < num) {
+    ProducerFull++;
+  }
+  ProducerSeq += n;
+  return n;
+}
+
+// Read and check a chunk of random size, return number of elements read.
+static uint32_t ConsumerStep (void) {
+  Elem_t   chunk[CHUNK_MAX];
+  uint32_t n, i;
+
+  n = osRtxRingBufferRead(RingBuffer, chunk, 1U + (HostRand(&ConsumerRand) % CHUNK_MAX));
+  for (i = 0U; i < n; i++) {
+    if (ElemValid(&chunk[i], ConsumerSeq) == 0U) {
+      FailedElem = chunk[i];
+      Failed = 1U;
+      //lint -e{904} "Return statement before end of function"
+      return 0U;
+    }
+    ConsumerSeq++;
+  }
+  if (n == 0U) {
+    ConsumerEmpty++;
+  }
+  return n;
+}
+
+static uint32_t ConsumerDone (void) {
+  return (((ConsumerSeq == Count) || (Failed != 0U)) ? 1U : 0U);
+}
+
+static void ProducerThread (void *argument) {
+  (void)argument;
+
+  while ((ProducerSeq < Count) && (Failed == 0U)) {
+    if ((ProducerStep() == 0U) ||
+        ((Mode == ModePolling) && ((HostRand(&ProducerRand) % 16U) == 0U))) {
+      osThreadYield();
+    } else if ((Mode == ModeIrqConsumer) && ((HostRand(&ProducerRand) % 256U) == 0U)) {
+      // Interrupt empties the buffer
+      (void)osDelay(1U);
+    }
+  }
+}
+
+static void ConsumerThread (void *argument) {
+  (void)argument;
+
+  while (ConsumerDone() == 0U) {
+    HOST_CHECK(osRtxRingBufferGetCount(RingBuffer) <= RB_ELEMENTS);
+    if (ConsumerStep() != 0U) {
+      if ((Mode == ModeIrqProducer) && ((HostRand(&ConsumerRand) % 256U) == 0U)) {
+        // Interrupt fills the buffer
+        (void)osDelay(1U);
+      }
+      continue;
+    }
+    if (Mode == ModeThreshold) {
+      // Elements below the threshold are read after a tick
+      (void)osEventFlagsWait(Wakeup, WAKEUP_FLAG, osFlagsWaitAny, 1U);
+    } else if ((HostRand(&ConsumerRand) % 4U) != 0U) {
+      osThreadYield();
+    }
+  }
+}
+
+
+//  ==== Interrupt side ====
+
+// Device interrupt: one producer or consumer step.
+static void IrqHandler (void) {
+  IrqCount++;
+  if (Mode == ModeIrqProducer) {
+    if (ProducerSeq < Count) {
+      (void)ProducerStep();
+    }
+  } else {
+    if (ConsumerDone() == 0U) {
+      (void)ConsumerStep();
+    }
+  }
+}
+
+// Host timer signal raises the device interrupt.
+static void IrqSignal (int sig) {
+  (void)sig;
+  NVIC_SetPendingIRQ(IRQ_NUM);
+}
+
+static int32_t IrqSetup (void) {
+  struct sigaction sa;
+  struct sigevent  se;
+
+  (void)memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = IrqSignal;
+  sa.sa_flags   = SA_RESTART;
+  (void)sigemptyset(&sa.sa_mask);
+  (void)memset(&se, 0, sizeof(se));
+  se.sigev_notify = SIGEV_SIGNAL;
+  se.sigev_signo  = SIGUSR1;
+  if ((sigaction(SIGUSR1, &sa, NULL) != 0) || (timer_create(CLOCK_MONOTONIC, &se, &IrqTimer) != 0)) {
+    //lint -e{904} "Return statement before end of function"
+    return -1;
+  }
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(IRQ_NUM, (uint32_t)(uintptr_t)IrqHandler);
+  NVIC_EnableIRQ(IRQ_NUM);
+  return 0;
+}
+
+static void IrqTimerSet (uint32_t period) {
+  struct itimerspec ts;
+
+  ts.it_value.tv_sec     = 0;
+  ts.it_value.tv_nsec    = (long)period;
+  ts.it_interval.tv_sec  = 0;
+  ts.it_interval.tv_nsec = (long)period;
+  (void)timer_settime(IrqTimer, 0, &ts, NULL);
+}
+
+
+//  ==== Test ====
+
+static void Run (Mode_t mode) {
+  const osThreadAttr_t attr = { .attr_bits = osThreadJoinable, .priority = osPriorityNormal };
+  osRtxRingBufferAttr_t rb_attr = { .ef_flags = WAKEUP_FLAG, .threshold = RB_THRESHOLD };
+  osThreadAttr_t consumer_attr = attr;
+  osThreadId_t   thread[2] = { NULL, NULL };
+  uint32_t       start;
+  uint32_t       n;
+
+  Mode          = mode;
+  ProducerSeq   = 0U;
+  ProducerRand  = Seed;
+  ConsumerSeq   = 0U;
+  ConsumerRand  = Seed ^ 0x5A5A5A5AU;
+  Failed        = 0U;
+  ProducerFull  = 0U;
+  ConsumerEmpty = 0U;
+  IrqCount      = 0U;
+
+  if (mode == ModeThreshold) {
+    rb_attr.ef_id = Wakeup;
+    consumer_attr.priority = osPriorityAboveNormal;
+  }
+  RingBuffer = osRtxRingBufferNew(RB_ELEMENTS, sizeof(Elem_t), &rb_attr);
+  HOST_CHECK(RingBuffer != NULL);
+  if (RingBuffer == NULL) {
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+
+  start = osKernelGetTickCount();
+  if (mode != ModeIrqProducer) {
+    thread[0] = osThreadNew(ProducerThread, NULL, &attr);
+    HOST_CHECK(thread[0] != NULL);
+  }
+  if (mode != ModeIrqConsumer) {
+    thread[1] = osThreadNew(ConsumerThread, NULL, &consumer_attr);
+    HOST_CHECK(thread[1] != NULL);
+  }
+  if (mode >= ModeIrqProducer) {
+    IrqTimerSet(IRQ_PERIOD_NS);
+  }
+  for (n = 0U; n < 2U; n++) {
+    if (thread[n] != NULL) {
+      HOST_CHECK(osThreadJoin(thread[n]) == osOK);
+    }
+  }
+  while (ConsumerDone() == 0U) {
+    (void)osDelay(1U);
+  }
+  if (mode >= ModeIrqProducer) {
+    IrqTimerSet(0U);
+  }
+
+  if (Failed != 0U) {
+    printf("element %u: %u %08X %08X\n", ConsumerSeq, FailedElem.seq, FailedElem.inv, FailedElem.mix);
+  }
+  HOST_CHECK(Failed == 0U);
+  HOST_CHECK(ConsumerSeq == Count);
+  HOST_CHECK(osRtxRingBufferGetCount(RingBuffer) == 0U);
+  HOST_CHECK(osRtxRingBufferGetSpace(RingBuffer) == RB_ELEMENTS);
+  printf("%s: %u elements in %u ticks, %u full, %u empty, %u interrupts\n",
+         ModeName[mode], ConsumerSeq, osKernelGetTickCount() - start,
+         ProducerFull, ConsumerEmpty, IrqCount);
+
+  HOST_CHECK(osRtxRingBufferDelete(RingBuffer) == osOK);
+}
+
+static void App (void *argument) {
+  (void)argument;
+
+  Wakeup = osEventFlagsNew(NULL);
+  HOST_CHECK(Wakeup != NULL);
+  HOST_CHECK(IrqSetup() == 0);
+
+  Run(ModePolling);
+  Run(ModeThreshold);
+  Run(ModeIrqProducer);
+  Run(ModeIrqConsumer);
+  HOST_CHECK(osThreadGetCount() == 3U);         // App, Idle, Timer
+
+  HostTestExit();
+}
+
+int main (int argc, char *argv[]) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityHigh };
+
+  Seed  = (uint32_t)strtoul(HostTestOption(argc, argv, "seed",  "1"),       NULL, 0);
+  Count = (uint32_t)strtoul(HostTestOption(argc, argv, "count", "1000000"), NULL, 0);
+  if ((Seed == 0U) || (Count == 0U)) {
+    printf("Usage: %s [--seed <n>] [--count <n>]\n", argv[0]);
+    return 2;
+  }
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(App, NULL, &attr);
+  (void)osKernelStart();
+  return 1;
+}
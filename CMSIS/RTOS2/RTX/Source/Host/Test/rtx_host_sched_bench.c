@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host scheduling benchmark
+ *
+ * Measures the time of the scheduling paths: yield between threads of equal
+ * priority, wake-up of a higher priority thread and return (ping-pong) with
+ * the different synchronization objects, and thread creation and exit.
+ * Ping-pong operations include two thread switches.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stddef.h>
+
+#include "cmsis_os2.h"
+#include "rtx_host_test.h"
+
+static osThreadId_t       Partner;
+static osSemaphoreId_t    SemaphorePing;
+static osSemaphoreId_t    SemaphorePong;
+static osEventFlagsId_t   EventFlags;
+static osMessageQueueId_t QueuePing;
+static osMessageQueueId_t QueuePong;
+static osThreadId_t       Bench;
+
+static int32_t PartnerNew (osThreadFunc_t func, osPriority_t priority) {
+  const osThreadAttr_t attr = { .name = "partner", .priority = priority };
+
+  Bench   = osThreadGetId();
+  Partner = osThreadNew(func, NULL, &attr);
+  return ((Partner != NULL) ? 0 : -1);
+}
+
+static void PartnerTerminate (void) {
+  (void)osThreadTerminate(Partner);
+}
+
+
+//  ==== Yield ====
+
+static void YieldPartner (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osThreadYield();
+  }
+}
+
+static int32_t YieldSetup (uint32_t param) {
+  (void)param;
+  return PartnerNew(YieldPartner, osPriorityNormal);
+}
+
+static void YieldRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osThreadYield();
+  }
+}
+
+
+//  ==== Semaphore ping-pong ====
+
+static void SemaphorePartner (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osSemaphoreAcquire(SemaphorePing, osWaitForever);
+    (void)osSemaphoreRelease(SemaphorePong);
+  }
+}
+
+static int32_t SemaphoreSetup (uint32_t param) {
+  (void)param;
+  SemaphorePing = osSemaphoreNew(1U, 0U, NULL);
+  SemaphorePong = osSemaphoreNew(1U, 0U, NULL);
+  if ((SemaphorePing == NULL) || (SemaphorePong == NULL)) {
+    return -1;
+  }
+  return PartnerNew(SemaphorePartner, osPriorityAboveNormal);
+}
+
+static void SemaphoreRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osSemaphoreRelease(SemaphorePing);
+    (void)osSemaphoreAcquire(SemaphorePong, osWaitForever);
+  }
+}
+
+static void SemaphoreTeardown (void) {
+  PartnerTerminate();
+  (void)osSemaphoreDelete(SemaphorePing);
+  (void)osSemaphoreDelete(SemaphorePong);
+}
+
+
+//  ==== Thread Flags ping-pong ====
+
+static void ThreadFlagsPartner (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osThreadFlagsWait(1U, osFlagsWaitAny, osWaitForever);
+    (void)osThreadFlagsSet(Bench, 1U);
+  }
+}
+
+static int32_t ThreadFlagsSetup (uint32_t param) {
+  (void)param;
+  return PartnerNew(ThreadFlagsPartner, osPriorityAboveNormal);
+}
+
+static void ThreadFlagsRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osThreadFlagsSet(Partner, 1U);
+    (void)osThreadFlagsWait(1U, osFlagsWaitAny, osWaitForever);
+  }
+}
+
+
+//  ==== Event Flags ping-pong ====
+
+static void EventFlagsPartner (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osEventFlagsWait(EventFlags, 1U, osFlagsWaitAny, osWaitForever);
+    (void)osEventFlagsSet(EventFlags, 2U);
+  }
+}
+
+static int32_t EventFlagsSetup (uint32_t param) {
+  (void)param;
+  EventFlags = osEventFlagsNew(NULL);
+  if (EventFlags == NULL) {
+    return -1;
+  }
+  return PartnerNew(EventFlagsPartner, osPriorityAboveNormal);
+}
+
+static void EventFlagsRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osEventFlagsSet(EventFlags, 1U);
+    (void)osEventFlagsWait(EventFlags, 2U, osFlagsWaitAny, osWaitForever);
+  }
+}
+
+static void EventFlagsTeardown (void) {
+  PartnerTerminate();
+  (void)osEventFlagsDelete(EventFlags);
+}
+
+
+//  ==== Message Queue ping-pong ====
+
+static void QueuePartner (void *argument) {
+  uint32_t msg;
+
+  (void)argument;
+  for (;;) {
+    (void)osMessageQueueGet(QueuePing, &msg, NULL, osWaitForever);
+    (void)osMessageQueuePut(QueuePong, &msg, 0U, osWaitForever);
+  }
+}
+
+static int32_t QueueSetup (uint32_t param) {
+  (void)param;
+  QueuePing = osMessageQueueNew(1U, sizeof(uint32_t), NULL);
+  QueuePong = osMessageQueueNew(1U, sizeof(uint32_t), NULL);
+  if ((QueuePing == NULL) || (QueuePong == NULL)) {
+    return -1;
+  }
+  return PartnerNew(QueuePartner, osPriorityAboveNormal);
+}
+
+static void QueueRun (uint32_t count) {
+  uint32_t msg = 0U;
+
+  for (; count != 0U; count--) {
+    (void)osMessageQueuePut(QueuePing, &msg, 0U, osWaitForever);
+    (void)osMessageQueueGet(QueuePong, &msg, NULL, osWaitForever);
+  }
+}
+
+static void QueueTeardown (void) {
+  PartnerTerminate();
+  (void)osMessageQueueDelete(QueuePing);
+  (void)osMessageQueueDelete(QueuePong);
+}
+
+
+//  ==== Thread create and exit ====
+
+static void ExitThread (void *argument) {
+  (void)argument;
+}
+
+static void ThreadNewRun (uint32_t count) {
+  const osThreadAttr_t attr = { .priority = osPriorityAboveNormal };
+
+  for (; count != 0U; count--) {
+    (void)osThreadNew(ExitThread, NULL, &attr);
+  }
+}
+
+
+static const HostBenchCase_t Cases[] = {
+  { "thread_yield",           0U, YieldSetup,       YieldRun,       PartnerTerminate   },
+  { "semaphore_pingpong",     0U, SemaphoreSetup,   SemaphoreRun,   SemaphoreTeardown  },
+  { "thread_flags_pingpong",  0U, ThreadFlagsSetup, ThreadFlagsRun, PartnerTerminate   },
+  { "event_flags_pingpong",   0U, EventFlagsSetup,  EventFlagsRun,  EventFlagsTeardown },
+  { "message_queue_pingpong", 0U, QueueSetup,       QueueRun,       QueueTeardown      },
+  { "thread_new_exit",        0U, NULL,             ThreadNewRun,   NULL               }
+};
+
+int main (int argc, char *argv[]) {
+  return HostBenchMain(argc, argv, "RTX5 host scheduling benchmark",
+                       Cases, sizeof(Cases) / sizeof(Cases[0]));
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host thread runtime statistics test
+ *
+ * Built with RTX_THREAD_STATS and without round robin. Checks the statistics
+ * returned by osRtxThreadGetStats (times in system timer counts, nanoseconds
+ * on the host). Busy-waits and expected times are in kernel time, like the
+ * statistics:
+ *  - run time: the run times of all threads (including idle and timer thread)
+ *    add up to the elapsed kernel time, while workers busy-wait and delay,
+ *  - switch count: each yield of a yield ping-pong between two threads and
+ *    each delay of a delay ping-pong switches back to the thread exactly once,
+ *  - latency: a thread made ready by an interrupt while a higher priority
+ *    thread runs for LATENCY_MS has a worst-case latency of at least that time,
+ *  - a thread preempted by a higher priority thread that runs for LATENCY_MS
+ *    records the time it spent preempted as latency when it runs again.
+ *
+ * Options: --rounds <n> (default 1000, yields of the yield ping-pong).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+#include "os_tick.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+#define WORKER_NUM              3U
+#define WORKER_LOOPS            5U
+#define WORKER_BUSY_MS          4U
+#define DELAY_ROUNDS            50U
+#define LATENCY_MS              20U
+#define PREEMPT_BUSY_MS         40U
+#define THREAD_MAX              16U
+#define DONE_FLAG               1U
+#define START_FLAG              2U
+#define IRQ_NUM                 Host0_IRQn
+
+static uint32_t           Rounds;
+static osThreadId_t       App;
+static osThreadId_t       Waiter;
+static uint32_t           SwitchDelta[2];
+static uint64_t           BusyTime[WORKER_NUM];
+
+
+//  ==== Utilities ====
+
+// Idle thread waits for interrupts (statistics count it as running).
+__NO_RETURN void osRtxIdleThread (void *argument) {
+  (void)argument;
+  for (;;) {
+    __WFI();
+  }
+}
+
+// Kernel errors fail the test instead of halting.
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  printf("kernel error %u (object %p)\n", code, object_id);
+  HostTestErrors++;
+  HostTestExit();
+  return 0U;
+}
+
+// System timer counts per millisecond.
+static uint64_t Ms (uint32_t ms) {
+  return (((uint64_t)OS_Tick_GetClock() / 1000U) * ms);
+}
+
+// Kernel time in system timer counts, as used by the statistics.
+static uint64_t KernelTime (void) {
+  uint32_t tick;
+  uint32_t count;
+
+  __disable_irq();
+  tick  = osKernelGetTickCount();
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  __enable_irq();
+  return (((uint64_t)tick * OS_Tick_GetInterval()) + count);
+}
+
+// Busy-wait in kernel time.
+static void Busy (uint32_t ms) {
+  uint64_t end = KernelTime() + Ms(ms);
+
+  while (KernelTime() < end) {}
+}
+
+static osRtxThreadStats_t Stats (osThreadId_t thread) {
+  osRtxThreadStats_t stats = { 0U, 0U, 0U };
+
+  HOST_CHECK(osRtxThreadGetStats(thread, &stats) == osOK);
+  return stats;
+}
+
+// Run time of all threads.
+static uint64_t RunTimeSum (void) {
+  osThreadId_t thread[THREAD_MAX];
+  uint64_t     sum;
+  uint32_t     num, n;
+
+  num = osThreadEnumerate(thread, THREAD_MAX);
+  HOST_CHECK(num < THREAD_MAX);
+  sum = 0U;
+  for (n = 0U; n < num; n++) {
+    sum += Stats(thread[n]).run_time;
+  }
+  return sum;
+}
+
+static osThreadId_t ThreadNew (osThreadFunc_t func, void *argument, osPriority_t priority) {
+  const osThreadAttr_t attr = { .priority = priority };
+  osThreadId_t thread;
+
+  thread = osThreadNew(func, argument, &attr);
+  HOST_CHECK(thread != NULL);
+  return thread;
+}
+
+// Signal the application thread and stay alive (statistics of terminated threads are lost).
+static __NO_RETURN void Done (void) {
+  (void)osThreadFlagsSet(App, DONE_FLAG);
+  for (;;) {
+    (void)osThreadFlagsWait(DONE_FLAG, osFlagsWaitAny, osWaitForever);
+  }
+}
+
+static void WaitDone (uint32_t num) {
+  for (; num != 0U; num--) {
+    HOST_CHECK(osThreadFlagsWait(DONE_FLAG, osFlagsWaitAny, 5000U) == DONE_FLAG);
+  }
+}
+
+
+//  ==== Run time ====
+
+static void Worker (void *argument) {
+  uint32_t index = (uint32_t)(uintptr_t)argument;
+  uint64_t time;
+  uint32_t n;
+
+  for (n = 0U; n < WORKER_LOOPS; n++) {
+    time = KernelTime();
+    Busy(WORKER_BUSY_MS);
+    BusyTime[index] += KernelTime() - time;
+    HOST_CHECK(osDelay(1U + index) == osOK);
+  }
+  Done();
+}
+
+static void TestRunTime (void) {
+  osThreadId_t worker[WORKER_NUM];
+  uint64_t     time, sum;
+  uint32_t     n;
+
+  time = KernelTime();
+  sum  = RunTimeSum();
+
+  for (n = 0U; n < WORKER_NUM; n++) {
+    worker[n] = ThreadNew(Worker, (void *)(uintptr_t)n, osPriorityNormal);
+  }
+  WaitDone(WORKER_NUM);
+
+  sum  = RunTimeSum() - sum;
+  time = KernelTime() - time;
+  printf("run time: %llu of %llu ns elapsed\n", (unsigned long long)sum, (unsigned long long)time);
+  // Sum and elapsed time are read one after the other
+  HOST_CHECK(sum <= (time + Ms(1U)));
+  HOST_CHECK(time <= (sum + Ms(1U)));
+
+  // Worker run time includes its busy time (kernel time read while a tick is pending may be off by a tick)
+  for (n = 0U; n < WORKER_NUM; n++) {
+    HOST_CHECK((Stats(worker[n]).run_time + Ms(1U)) >= BusyTime[n]);
+    HOST_CHECK(osThreadTerminate(worker[n]) == osOK);
+  }
+}
+
+
+//  ==== Switch count ====
+
+static void Yielder (void *argument) {
+  uint32_t index = (uint32_t)(uintptr_t)argument;
+  uint32_t count;
+  uint32_t n;
+
+  // Each yield switches to the other thread, which yields back
+  count = Stats(osThreadGetId()).switch_count;
+  for (n = 0U; n < Rounds; n++) {
+    HOST_CHECK(osThreadYield() == osOK);
+  }
+  SwitchDelta[index] = Stats(osThreadGetId()).switch_count - count;
+  Done();
+}
+
+static void Delayer (void *argument) {
+  uint32_t index = (uint32_t)(uintptr_t)argument;
+  uint32_t count;
+  uint32_t n;
+
+  count = Stats(osThreadGetId()).switch_count;
+  for (n = 0U; n < DELAY_ROUNDS; n++) {
+    HOST_CHECK(osDelay(1U) == osOK);
+  }
+  SwitchDelta[index] = Stats(osThreadGetId()).switch_count - count;
+  Done();
+}
+
+static void TestSwitchCount (osThreadFunc_t func, uint32_t rounds) {
+  osThreadId_t thread[2];
+  uint32_t     n;
+
+  for (n = 0U; n < 2U; n++) {
+    thread[n] = ThreadNew(func, (void *)(uintptr_t)n, osPriorityNormal);
+  }
+  WaitDone(2U);
+  printf("switch count: %u, %u for %u rounds\n", SwitchDelta[0], SwitchDelta[1], rounds);
+  for (n = 0U; n < 2U; n++) {
+    HOST_CHECK(SwitchDelta[n] == rounds);
+    HOST_CHECK(osThreadTerminate(thread[n]) == osOK);
+  }
+}
+
+
+//  ==== Latency ====
+
+static void WaiterThread (void *argument) {
+  (void)argument;
+
+  HOST_CHECK(osThreadFlagsWait(START_FLAG, osFlagsWaitAny, osWaitForever) == START_FLAG);
+  Done();
+}
+
+// Device interrupt: make the waiter ready.
+static void IrqHandler (void) {
+  (void)osThreadFlagsSet(Waiter, START_FLAG);
+}
+
+// Thread made ready by an interrupt waits until the running higher priority thread blocks.
+static void TestLatency (void) {
+  uint64_t latency;
+
+  Waiter = ThreadNew(WaiterThread, NULL, osPriorityNormal);
+  HOST_CHECK(osDelay(2U) == osOK);
+  HOST_CHECK(Stats(Waiter).latency_max < Ms(LATENCY_MS));
+
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(IRQ_NUM, (uint32_t)(uintptr_t)IrqHandler);
+  NVIC_EnableIRQ(IRQ_NUM);
+  NVIC_SetPendingIRQ(IRQ_NUM);
+  HOST_CHECK(osThreadGetState(Waiter) == osThreadReady);
+  Busy(LATENCY_MS);
+  WaitDone(1U);
+
+  latency = Stats(Waiter).latency_max;
+  printf("latency: %llu ns after %u ms\n", (unsigned long long)latency, LATENCY_MS);
+  HOST_CHECK((latency + Ms(1U)) >= Ms(LATENCY_MS));
+  HOST_CHECK(latency < Ms(2U * LATENCY_MS));
+  HOST_CHECK(osThreadTerminate(Waiter) == osOK);
+}
+
+static void Preempted (void *argument) {
+  (void)argument;
+
+  Busy(PREEMPT_BUSY_MS);
+  Done();
+}
+
+// A preempted thread is time stamped when it is put back to the Ready list: the time it waits
+// for the higher priority thread is latency, as for a thread made ready from a waiting state.
+static void TestPreempted (void) {
+  osThreadId_t thread;
+  uint32_t     latency;
+
+  thread = ThreadNew(Preempted, NULL, osPriorityNormal);
+  // Preempts the thread when the delay expires
+  HOST_CHECK(osDelay(5U) == osOK);
+  HOST_CHECK(osThreadGetState(thread) == osThreadReady);
+  HOST_CHECK(Stats(thread).latency_max < Ms(LATENCY_MS));
+
+  Busy(LATENCY_MS);
+  WaitDone(1U);
+
+  latency = Stats(thread).latency_max;
+  printf("preempted: latency %u ns after %u ms preempted\n", latency, LATENCY_MS);
+  HOST_CHECK((latency + Ms(1U)) >= Ms(LATENCY_MS));
+  HOST_CHECK(latency < Ms(2U * LATENCY_MS));
+  HOST_CHECK(osThreadTerminate(thread) == osOK);
+}
+
+
+static void AppThread (void *argument) {
+  (void)argument;
+
+  App = osThreadGetId();
+
+  TestRunTime();
+  TestSwitchCount(Yielder, Rounds);
+  TestSwitchCount(Delayer, DELAY_ROUNDS);
+  TestLatency();
+  TestPreempted();
+
+  HostTestExit();
+}
+
+int main (int argc, char *argv[]) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityHigh };
+
+  Rounds = (uint32_t)strtoul(HostTestOption(argc, argv, "rounds", "1000"), NULL, 0);
+  if (Rounds == 0U) {
+    printf("Usage: %s [--rounds <n>]\n", argv[0]);
+    return 2;
+  }
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(AppThread, NULL, &attr);
+  (void)osKernelStart();
+  return 1;
+}
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host randomized scheduler stress test
+ *
+ * Worker threads execute random operations (delays, mutexes, semaphores,
+ * message queues, timers, priority changes and transient threads) selected by
+ * a seeded random generator and check the kernel invariants:
+ *  - a mutex has at most one owner and a semaphore at most its token count,
+ *  - delays and timers do not expire early and timers do not get lost,
+ *  - messages are neither lost nor duplicated,
+ *  - a periodic timer fires once per period.
+ *
+ * Options: --seed <n> (default 1), --time <ticks> (default 2000),
+ *          --threads <n> (default 8, max 16).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+#define WORKER_MAX              16U
+#define TRANSIENT_MAX           4U
+#define QUEUE_DEPTH             8U
+#define SEMAPHORE_TOKENS        3U
+#define PERIOD                  10U
+#define TIMER_FLAG              1U
+
+typedef struct {
+  osThreadId_t id;
+  osTimerId_t  timer;
+  uint32_t     rand;
+  uint32_t     ops;
+} Worker_t;
+
+static Worker_t           Worker[WORKER_MAX];
+static uint32_t           WorkerNum;
+static osMutexId_t        Mutex;
+static osSemaphoreId_t    Semaphore;
+static osMessageQueueId_t Queue;
+static osTimerId_t        Periodic;
+
+static volatile uint32_t  Stop;
+static osThreadId_t       MutexOwner;
+static uint32_t           SemaphoreHeld;
+static uint32_t           TransientNum;
+static uint32_t           PeriodicCount;
+static uint32_t           PutCount;
+static uint32_t           GetCount;
+static uint64_t           PutSum;
+static uint64_t           GetSum;
+
+// Kernel errors (stack overflow, queue overflow) fail the test instead of halting.
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  printf("kernel error %u (object %p)\n", code, object_id);
+  HostTestErrors++;
+  HostTestExit();
+  return 0U;
+}
+
+static void Add32 (uint32_t *var, uint32_t val) {
+  (void)__atomic_fetch_add(var, val, __ATOMIC_RELAXED);
+}
+
+static void Add64 (uint64_t *var, uint64_t val) {
+  (void)__atomic_fetch_add(var, val, __ATOMIC_RELAXED);
+}
+
+// Random number in range 0..(n-1).
+static uint32_t Random (uint32_t *rand, uint32_t n) {
+  return (HostRand(rand) % n);
+}
+
+// Random priority between Below Normal and Above Normal.
+static osPriority_t RandomPriority (uint32_t *rand) {
+  return (osPriority_t)((uint32_t)osPriorityBelowNormal + Random(rand, 17U));
+}
+
+static void OpDelay (uint32_t *rand) {
+  uint32_t ticks = Random(rand, 4U);
+  uint32_t tick  = osKernelGetTickCount();
+
+  HOST_CHECK(osDelay(ticks) == osOK);
+  HOST_CHECK((osKernelGetTickCount() - tick) >= ticks);
+}
+
+static void OpMutex (uint32_t *rand) {
+  osThreadId_t self = osThreadGetId();
+  uint32_t     nest = 1U + Random(rand, 3U);
+  uint32_t     n;
+
+  if (osMutexAcquire(Mutex, Random(rand, 3U)) != osOK) {
+    return;
+  }
+  HOST_CHECK(MutexOwner == NULL);
+  HOST_CHECK(osMutexGetOwner(Mutex) == self);
+  MutexOwner = self;
+  for (n = 1U; n < nest; n++) {
+    HOST_CHECK(osMutexAcquire(Mutex, 0U) == osOK);
+  }
+  if (Random(rand, 2U) != 0U) {
+    (void)osDelay(1U + Random(rand, 2U));
+  } else {
+    (void)osThreadYield();
+  }
+  HOST_CHECK(MutexOwner == self);
+  MutexOwner = NULL;
+  for (n = 0U; n < nest; n++) {
+    HOST_CHECK(osMutexRelease(Mutex) == osOK);
+  }
+}
+
+static void OpSemaphore (uint32_t *rand) {
+  if (osSemaphoreAcquire(Semaphore, Random(rand, 3U)) != osOK) {
+    return;
+  }
+  Add32(&SemaphoreHeld, 1U);
+  HOST_CHECK(SemaphoreHeld <= SEMAPHORE_TOKENS);
+  (void)osThreadYield();
+  Add32(&SemaphoreHeld, (uint32_t)-1);
+  HOST_CHECK(osSemaphoreRelease(Semaphore) == osOK);
+}
+
+static void OpPut (uint32_t *rand) {
+  uint32_t msg = HostRand(rand);
+
+  if (osMessageQueuePut(Queue, &msg, 0U, Random(rand, 3U)) == osOK) {
+    Add32(&PutCount, 1U);
+    Add64(&PutSum, msg);
+  }
+}
+
+static void OpGet (uint32_t *rand) {
+  uint32_t msg;
+
+  if (osMessageQueueGet(Queue, &msg, NULL, Random(rand, 3U)) == osOK) {
+    Add32(&GetCount, 1U);
+    Add64(&GetSum, msg);
+  }
+}
+
+static void OpTimer (Worker_t *w) {
+  uint32_t ticks = 1U + Random(&w->rand, 5U);
+  uint32_t tick  = osKernelGetTickCount();
+
+  HOST_CHECK(osTimerStart(w->timer, ticks) == osOK);
+  HOST_CHECK(osThreadFlagsWait(TIMER_FLAG, osFlagsWaitAny, ticks + 1000U) == TIMER_FLAG);
+  HOST_CHECK((osKernelGetTickCount() - tick) >= ticks);
+  HOST_CHECK(osTimerIsRunning(w->timer) == 0U);
+}
+
+static void OpPriority (uint32_t *rand) {
+  HOST_CHECK(osThreadSetPriority(osThreadGetId(), RandomPriority(rand)) == osOK);
+}
+
+// Transient thread: a few operations, then exit.
+static void Transient (void *argument) {
+  uint32_t rand = (uint32_t)(uintptr_t)argument | 1U;
+  uint32_t n;
+
+  for (n = Random(&rand, 8U); n != 0U; n--) {
+    switch (Random(&rand, 3U)) {
+      case 0U: OpDelay(&rand); break;
+      case 1U: OpPut(&rand);   break;
+      default: OpGet(&rand);   break;
+    }
+  }
+  Add32(&TransientNum, (uint32_t)-1);
+}
+
+static void OpTransient (uint32_t *rand) {
+  osThreadAttr_t attr = { .name = "transient", .priority = RandomPriority(rand) };
+
+  if (TransientNum >= TRANSIENT_MAX) {
+    return;
+  }
+  Add32(&TransientNum, 1U);
+  if (osThreadNew(Transient, (void *)(uintptr_t)HostRand(rand), &attr) == NULL) {
+    HOST_CHECK(0);
+    Add32(&TransientNum, (uint32_t)-1);
+  }
+}
+
+static void WorkerThread (void *argument) {
+  Worker_t *w = argument;
+
+  while (Stop == 0U) {
+    switch (Random(&w->rand, 10U)) {
+      case 0U: OpDelay(&w->rand);     break;
+      case 1U: OpMutex(&w->rand);     break;
+      case 2U: OpSemaphore(&w->rand); break;
+      case 3U:
+      case 4U: OpPut(&w->rand);       break;
+      case 5U:
+      case 6U: OpGet(&w->rand);       break;
+      case 7U: OpTimer(w);            break;
+      case 8U: OpPriority(&w->rand);  break;
+      default:
+        if (Random(&w->rand, 2U) != 0U) {
+          OpTransient(&w->rand);
+        } else {
+          (void)osThreadYield();
+        }
+        break;
+    }
+    w->ops++;
+  }
+}
+
+static void TimerCallback (void *argument) {
+  Worker_t *w = argument;
+
+  HOST_CHECK((osThreadFlagsSet(w->id, TIMER_FLAG) & 0x80000000U) == 0U);
+}
+
+static void PeriodicCallback (void *argument) {
+  (void)argument;
+  PeriodicCount++;
+}
+
+static void App (void *argument) {
+  const osMutexAttr_t  mutex_attr  = { .attr_bits = osMutexRecursive | osMutexPrioInherit };
+  const osThreadAttr_t worker_attr = { .attr_bits = osThreadJoinable, .priority = osPriorityNormal };
+  uint32_t duration = (uint32_t)(uintptr_t)argument;
+  uint32_t seed     = Worker[0].rand;
+  uint32_t start;
+  uint32_t ticks;
+  uint32_t ops;
+  uint32_t msg;
+  uint32_t n;
+  void    *slot;
+
+  Mutex     = osMutexNew(&mutex_attr);
+  Semaphore = osSemaphoreNew(SEMAPHORE_TOKENS, SEMAPHORE_TOKENS, NULL);
+  Queue     = osMessageQueueNew(QUEUE_DEPTH, sizeof(uint32_t), NULL);
+  Periodic  = osTimerNew(PeriodicCallback, osTimerPeriodic, NULL, NULL);
+  HOST_CHECK((Mutex != NULL) && (Semaphore != NULL) && (Queue != NULL) && (Periodic != NULL));
+  if (HostTestErrors != 0U) {
+    HostTestExit();
+  }
+
+  for (n = 0U; n < WorkerNum; n++) {
+    Worker[n].rand  = (seed * (n + 1U) * 2654435761U) | 1U;
+    Worker[n].timer = osTimerNew(TimerCallback, osTimerOnce, &Worker[n], NULL);
+    Worker[n].id    = osThreadNew(WorkerThread, &Worker[n], &worker_attr);
+    HOST_CHECK((Worker[n].timer != NULL) && (Worker[n].id != NULL));
+  }
+
+  // Sleep in periods of the periodic timer and check its count at the end
+  HOST_CHECK(osTimerStart(Periodic, PERIOD) == osOK);
+  start = osKernelGetTickCount();
+  ticks = ((duration + PERIOD - 1U) / PERIOD) * PERIOD;
+  (void)osDelayUntil(start + ticks);
+  n     = PeriodicCount;
+  ticks = osKernelGetTickCount() - start;
+  HOST_CHECK(osTimerStop(Periodic) == osOK);
+  HOST_CHECK((n + 1U) >= (ticks / PERIOD));
+  HOST_CHECK(n <= (ticks / PERIOD));
+
+  Stop = 1U;
+  ops  = 0U;
+  for (n = 0U; n < WorkerNum; n++) {
+    HOST_CHECK(osThreadJoin(Worker[n].id) == osOK);
+    ops += Worker[n].ops;
+  }
+  do {
+    (void)osDelay(10U);
+  } while (TransientNum != 0U);
+
+  // Messages put are either received or still in the queue
+  while (osMessageQueueGet(Queue, &msg, NULL, 0U) == osOK) {
+    GetCount++;
+    GetSum += msg;
+  }
+  HOST_CHECK(PutCount == GetCount);
+  HOST_CHECK(PutSum == GetSum);
+  HOST_CHECK(osMessageQueueGetSpace(Queue) == QUEUE_DEPTH);
+  slot = osRtxMessageQueueAlloc(Queue, 0U);     // A held slot is not available
+  HOST_CHECK(slot != NULL);
+  HOST_CHECK(osMessageQueueGetSpace(Queue) == (QUEUE_DEPTH - 1U));
+  HOST_CHECK(osRtxMessageQueueRelease(Queue, slot) == osOK);
+  HOST_CHECK(osSemaphoreGetCount(Semaphore) == SEMAPHORE_TOKENS);
+  HOST_CHECK(osMutexGetOwner(Mutex) == NULL);
+  HOST_CHECK(osThreadGetCount() == 3U);         // App, Idle, Timer
+
+  printf("seed %u: %u ticks, %u operations, %u messages, %u periods\n",
+         seed, ticks, ops, PutCount, PeriodicCount);
+  HostTestExit();
+}
+
+int main (int argc, char *argv[]) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityAboveNormal1 };
+  uint32_t seed     = (uint32_t)strtoul(HostTestOption(argc, argv, "seed", "1"),    NULL, 0);
+  uint32_t duration = (uint32_t)strtoul(HostTestOption(argc, argv, "time", "2000"), NULL, 0);
+
+  WorkerNum = (uint32_t)strtoul(HostTestOption(argc, argv, "threads", "8"), NULL, 0);
+  if ((WorkerNum == 0U) || (WorkerNum > WORKER_MAX) || (seed == 0U)) {
+    printf("Usage: %s [--seed <n>] [--time <ticks>] [--threads <1..%u>]\n", argv[0], WORKER_MAX);
+    return 2;
+  }
+  Worker[0].rand = seed;
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(App, (void *)(uintptr_t)duration, &attr);
+  (void)osKernelStart();
+  return 1;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host tests and benchmarks support
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "rtx_host_test.h"
+
+#define BENCH_MAX_SELECTED      32U
+
+volatile uint32_t HostTestErrors;
+
+static const HostBenchCase_t *BenchCases;
+static uint32_t     BenchNum;
+static double       BenchMinTime;
+static const char  *BenchSelected[BENCH_MAX_SELECTED];
+static uint32_t     BenchSelectedNum;
+
+
+//  ==== Checks ====
+
+/// Count and report a failed check.
+void HostTestFail (const char *file, int line, const char *cond) {
+  uint32_t primask = __get_PRIMASK();
+
+  // printf is not async-signal-safe: no thread switch while printing
+  __disable_irq();
+  HostTestErrors++;
+  printf("%s:%d: check failed: %s\n", file, line, cond);
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
+/// Report the result and terminate the process.
+void HostTestExit (void) {
+  uint32_t errors = HostTestErrors;
+
+  if (errors != 0U) {
+    printf("FAILED (%u errors)\n", errors);
+  } else {
+    printf("OK\n");
+  }
+  // Threads do not return to main: skip the exit handlers
+  (void)fflush(stdout);
+  _Exit((errors != 0U) ? 1 : 0);
+}
+
+/// Get the value of a command line option.
+const char *HostTestOption (int argc, char *argv[], const char *name, const char *value) {
+  int i;
+
+  for (i = 1; i < (argc - 1); i++) {
+    if ((strncmp(argv[i], "--", 2) == 0) && (strcmp(&argv[i][2], name) == 0)) {
+      value = argv[i + 1];
+    }
+  }
+  return value;
+}
+
+
+//  ==== Utilities ====
+
+/// Get host monotonic time in nanoseconds.
+uint64_t HostTimeNs (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+/// Get next pseudo random number (xorshift32).
+uint32_t HostRand (uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+
+//  ==== Benchmarks ====
+
+// Check if a case is selected.
+static int32_t BenchIsSelected (const char *name) {
+  uint32_t i;
+
+  if (BenchSelectedNum == 0U) {
+    return 1;
+  }
+  for (i = 0U; i < BenchSelectedNum; i++) {
+    if (strcmp(BenchSelected[i], name) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Benchmark thread: runs each case until the minimum time is reached and reports ns per operation.
+static void BenchThread (void *argument) {
+  const HostBenchCase_t *bc;
+  uint64_t time;
+  uint32_t count;
+  uint32_t i;
+
+  (void)argument;
+
+  printf("%-40s %12s %12s\n", "case", "ops", "ns/op");
+  for (i = 0U; i < BenchNum; i++) {
+    bc = &BenchCases[i];
+    if (BenchIsSelected(bc->name) == 0) {
+      continue;
+    }
+    if ((bc->setup != NULL) && (bc->setup(bc->param) != 0)) {
+      printf("%-40s failed\n", bc->name);
+      HostTestErrors++;
+      continue;
+    }
+    // Warm up, then double the count until the run takes the minimum time
+    bc->run(1U);
+    count = 1U;
+    for (;;) {
+      time = HostTimeNs();
+      bc->run(count);
+      time = HostTimeNs() - time;
+      if (((double)time >= (BenchMinTime * 1e9)) || (count >= 0x40000000U)) {
+        break;
+      }
+      count *= 2U;
+    }
+    if (bc->teardown != NULL) {
+      bc->teardown();
+    }
+    printf("%-40s %12u %12.1f\n", bc->name, count, (double)time / (double)count);
+  }
+
+  HostTestExit();
+}
+
+/// Run benchmark cases in a kernel thread and terminate the process.
+int HostBenchMain (int argc, char *argv[], const char *title,
+                   const HostBenchCase_t *cases, uint32_t num) {
+  const osThreadAttr_t attr = { .name = "bench", .priority = osPriorityNormal };
+  uint32_t i;
+  int      n;
+
+  BenchCases   = cases;
+  BenchNum     = num;
+  BenchMinTime = 0.5;
+
+  for (n = 1; n < argc; n++) {
+    if ((strcmp(argv[n], "--min-time") == 0) && ((n + 1) < argc)) {
+      BenchMinTime = atof(argv[++n]);
+    } else if (strcmp(argv[n], "--list") == 0) {
+      for (i = 0U; i < num; i++) {
+        printf("%s\n", cases[i].name);
+      }
+      return 0;
+    } else if ((argv[n][0] != '-') && (BenchSelectedNum < BENCH_MAX_SELECTED)) {
+      BenchSelected[BenchSelectedNum++] = argv[n];
+    } else {
+      printf("Usage: %s [--min-time <s>] [--list] [case ...]\n"
+             "  --min-time <s>  Minimum measurement time per case in seconds (default 0.5)\n"
+             "  --list          List the cases\n", argv[0]);
+      return (strcmp(argv[n], "--help") == 0) ? 0 : 2;
+    }
+  }
+
+  printf("%s\n", title);
+  if ((osKernelInitialize() != osOK) || (osThreadNew(BenchThread, NULL, &attr) == NULL)) {
+    printf("Kernel initialization failed\n");
+    return 1;
+  }
+  (void)osKernelStart();
+  return 1;
+}
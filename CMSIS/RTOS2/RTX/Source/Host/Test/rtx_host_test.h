@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host tests and benchmarks support
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef RTX_HOST_TEST_H_
+#define RTX_HOST_TEST_H_
+
+#include <stdint.h>
+#include "cmsis_os2.h"
+
+
+//  ==== Checks ====
+
+/// Number of failed checks.
+extern volatile uint32_t HostTestErrors;
+
+/// Check a condition, count and report a failure.
+#define HOST_CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      HostTestFail(__FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+/// Count and report a failed check.
+extern void HostTestFail (const char *file, int line, const char *cond);
+
+/// Report the result and terminate the process (may be called from any thread),
+/// with exit status 0 when no check failed.
+extern void HostTestExit (void);
+
+/// Get the value of a command line option "--<name> <value>".
+/// \return value or default value when the option is not given.
+extern const char *HostTestOption (int argc, char *argv[], const char *name, const char *value);
+
+
+//  ==== Utilities ====
+
+/// Get host monotonic time in nanoseconds.
+extern uint64_t HostTimeNs (void);
+
+/// Get next pseudo random number (xorshift32).
+/// \param[in,out] state        random generator state (not 0).
+extern uint32_t HostRand (uint32_t *state);
+
+
+//  ==== Benchmarks ====
+
+/// Benchmark case.
+typedef struct {
+  const char *name;                     ///< Case name
+  uint32_t    param;                    ///< Case parameter passed to setup
+  int32_t   (*setup)(uint32_t param);   ///< Prepare the case (optional), returns 0 on success
+  void      (*run)(uint32_t count);     ///< Execute count operations
+  void      (*teardown)(void);          ///< Release the case (optional)
+} HostBenchCase_t;
+
+/// Run benchmark cases in a kernel thread and terminate the process.
+/// Options: --min-time <s> (default 0.5), --list and case names to select.
+/// \return only on invalid options: exit status.
+extern int HostBenchMain (int argc, char *argv[], const char *title,
+                          const HostBenchCase_t *cases, uint32_t num);
+
+#endif  // RTX_HOST_TEST_H_
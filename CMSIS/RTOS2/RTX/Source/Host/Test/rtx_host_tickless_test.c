@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host tick-less idle compensation test
+ *
+ * The idle thread uses tick-less idle with the host tick in real time (not
+ * OS_TICK_HOST_SKIP_IDLE): the tick timer is stopped while sleeping and the
+ * kernel tick count is compensated on wake-up. Checks against the host clock:
+ *  - long sleeps: delays from 2 to 1000 ticks expire in ticks and in time,
+ *    with only a few tick interrupts,
+ *  - early wake-ups: a device interrupt raised by a host timer signal at a
+ *    random time wakes up a thread waiting with a long timeout, or only the
+ *    idle thread during a delay,
+ * and that the tick count does not drift from the host clock after each. Every
+ * tick-less sleep of a wait has to end exactly at the expiry tick of the wait
+ * (also the sleep started again after an early wake-up). The host may deliver
+ * the timer signals late: a wait may end late by HOST_LATENCY ticks, but the
+ * tick count then still follows the host clock, and at least one wait has to
+ * end in time. Tick periods that elapse while interrupts are masked are
+ * counted once they are unmasked, and the system timer count does not go back
+ * meanwhile.
+ *
+ * Options: --seed <n> (default 1), --rounds <n> (default 40).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+#include "os_tick.h"
+#include "rtx_host_test.h"
+
+#define TICK_NS                 (1000000000U / OS_TICK_FREQ)
+#define TICK_TOLERANCE          2U              // Tick count against host clock in ticks
+#define HOST_LATENCY            20U             // Late timer signals in ticks
+#define WAKEUP_FLAG             1U
+#define WAKEUP_TIMEOUT          1000U
+#define EARLY_MAX_NS            (200U * TICK_NS)
+#define IRQ_NUM                 Host0_IRQn
+#define MASKED_TICKS            50U             // Ticks with interrupts masked
+
+static const uint32_t Delays[] = { 2U, 3U, 10U, 100U, 250U, 1000U };
+#define DELAY_NUM               (sizeof(Delays) / sizeof(Delays[0]))
+
+static uint32_t           Seed;
+static uint32_t           Rounds;
+static timer_t            IrqTimer;
+static IRQHandler_t       TickHandler;
+static osThreadId_t       Waiter;
+static volatile uint32_t  WakeThread;           // Interrupt sets the thread flags
+static volatile uint32_t  IrqCount;
+static volatile uint32_t  TickCount;            // Tick interrupts
+static volatile uint32_t  SleepCount;           // Tick-less sleeps
+static volatile uint32_t  SleepTicks;           // Longest tick-less sleep
+static volatile uint32_t  SleepEnd;             // Expiry tick of the tick-less sleeps of a wait
+static volatile uint32_t  SleepEndFailed;       // Sleep with a different expiry tick
+static uint32_t           StartTick;
+static uint64_t           StartTime;
+static uint32_t           DriftMax;
+static uint32_t           LateMin = UINT32_MAX; // Least ticks a wait ended late
+
+
+// Tick-less idle in real time.
+__NO_RETURN void osRtxIdleThread (void *argument) {
+  (void)argument;
+  for (;;) {
+    OS_Tickless_Idle();
+  }
+}
+
+// Low-power state with statistics and expiry tick check (kernel is suspended).
+void OS_Tickless_Sleep (uint32_t ticks) {
+  uint32_t end;
+
+  if ((ticks != 0U) && (ticks != osWaitForever)) {
+    SleepCount++;
+    if (ticks > SleepTicks) {
+      SleepTicks = ticks;
+    }
+    end = osKernelGetTickCount() + ticks;
+    if (SleepEnd == 0U) {
+      SleepEnd = end;
+    } else if (end != SleepEnd) {
+      SleepEndFailed++;
+    }
+  }
+  __DSB();
+  __WFI();
+}
+
+// Kernel errors fail the test instead of halting.
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  printf("kernel error %u (object %p)\n", code, object_id);
+  HostTestErrors++;
+  HostTestExit();
+  return 0U;
+}
+
+// Counts the tick interrupts of the kernel tick handler.
+static void TickCounter (void) {
+  TickCount++;
+  TickHandler();
+}
+
+static uint32_t Diff (uint32_t a, uint32_t b) {
+  return ((a > b) ? (a - b) : (b - a));
+}
+
+// Ticks passed in host time (a tick is counted at the end of its period).
+static uint32_t TimeTicks (uint64_t time) {
+  return ((uint32_t)(time / TICK_NS));
+}
+
+// Tick count against the host clock since the start.
+static void DriftCheck (void) {
+  uint32_t ticks = osKernelGetTickCount() - StartTick;
+  uint32_t time  = TimeTicks(HostTimeNs() - StartTime);
+  uint32_t drift = Diff(ticks, time);
+
+  if (drift > DriftMax) {
+    DriftMax = drift;
+  }
+  if (drift > TICK_TOLERANCE) {
+    printf("drift: %u ticks, %u in host time\n", ticks, time);
+  }
+  HOST_CHECK(drift <= TICK_TOLERANCE);
+}
+
+
+// Start of a wait: its tick-less sleeps have to end at the same tick.
+static void WaitStart (void) {
+  SleepEnd       = 0U;
+  SleepEndFailed = 0U;
+}
+
+// End of a wait: check the expiry tick of its tick-less sleeps (sleep: at least one expected).
+static void WaitEnd (uint32_t sleep) {
+  HOST_CHECK(SleepEndFailed == 0U);
+  if (sleep != 0U) {
+    HOST_CHECK(SleepEnd != 0U);
+  }
+}
+
+// Expiry of a delay in ticks: never early, late only by the host latency.
+static void DelayCheck (uint32_t ticks, uint32_t delay) {
+  HOST_CHECK(ticks >= delay);
+  HOST_CHECK(ticks <= (delay + HOST_LATENCY));
+  if ((ticks >= delay) && ((ticks - delay) < LateMin)) {
+    LateMin = ticks - delay;
+  }
+}
+
+
+//  ==== Interrupt ====
+
+// Device interrupt: early wake-up of the waiting thread or only of the idle thread.
+static void IrqHandler (void) {
+  IrqCount++;
+  if (WakeThread != 0U) {
+    (void)osThreadFlagsSet(Waiter, WAKEUP_FLAG);
+  }
+}
+
+// Host timer signal raises the device interrupt.
+static void IrqSignal (int sig) {
+  (void)sig;
+  NVIC_SetPendingIRQ(IRQ_NUM);
+}
+
+static int32_t IrqSetup (void) {
+  struct sigaction sa;
+  struct sigevent  se;
+
+  (void)memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = IrqSignal;
+  sa.sa_flags   = SA_RESTART;
+  (void)sigemptyset(&sa.sa_mask);
+  (void)memset(&se, 0, sizeof(se));
+  se.sigev_notify = SIGEV_SIGNAL;
+  se.sigev_signo  = SIGUSR1;
+  if ((sigaction(SIGUSR1, &sa, NULL) != 0) || (timer_create(CLOCK_MONOTONIC, &se, &IrqTimer) != 0)) {
+    //lint -e{904} "Return statement before end of function"
+    return -1;
+  }
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(IRQ_NUM, (uint32_t)(uintptr_t)IrqHandler);
+  NVIC_EnableIRQ(IRQ_NUM);
+  return 0;
+}
+
+// Raise the device interrupt once after time ns.
+static void IrqTimerSet (uint32_t time) {
+  struct itimerspec ts;
+
+  (void)memset(&ts, 0, sizeof(ts));
+  ts.it_value.tv_sec  = (time_t)(time / 1000000000U);
+  ts.it_value.tv_nsec = (long)(time % 1000000000U);
+  (void)timer_settime(IrqTimer, 0, &ts, NULL);
+}
+
+
+//  ==== Test ====
+
+// Tick periods elapsed with interrupts masked are counted when unmasked, and the
+// system timer count does not go back meanwhile.
+static void TestMaskedTicks (void) {
+  uint32_t tick, ticks, count, timer, back;
+  uint64_t end;
+
+  count = TickCount;
+  tick  = osKernelGetTickCount();
+  back  = 0U;
+  end   = HostTimeNs() + ((uint64_t)MASKED_TICKS * TICK_NS);
+  __disable_irq();
+  timer = osKernelGetSysTimerCount();
+  while (HostTimeNs() < end) {
+    // Timer signals pend the tick interrupt, possibly merged into one
+    if ((int32_t)(osKernelGetSysTimerCount() - timer) < 0) {
+      back++;
+    }
+    timer = osKernelGetSysTimerCount();
+  }
+  ticks = osKernelGetTickCount() - tick;
+  __enable_irq();
+  HOST_CHECK(back == 0U);
+  HOST_CHECK((int32_t)(osKernelGetSysTimerCount() - timer) >= 0);
+  HOST_CHECK(ticks == 0U);
+  ticks = osKernelGetTickCount() - tick;
+  count = TickCount - count;
+  printf("masked %u ticks: %u ticks, %u tick interrupts\n", MASKED_TICKS, ticks, count);
+  HOST_CHECK(ticks >= (MASKED_TICKS - TICK_TOLERANCE));
+  HOST_CHECK(count == ticks);
+  DriftCheck();
+}
+
+// Delays expire exactly in ticks and in host time with the tick stopped.
+static void TestLongSleep (void) {
+  uint32_t n, tick, ticks, time, count;
+  uint64_t start;
+
+  for (n = 0U; n < DELAY_NUM; n++) {
+    WaitStart();
+    count = TickCount;
+    tick  = osKernelGetTickCount();
+    start = HostTimeNs();
+    HOST_CHECK(osDelay(Delays[n]) == osOK);
+    ticks = osKernelGetTickCount() - tick;
+    time  = TimeTicks(HostTimeNs() - start);
+    count = TickCount - count;
+    printf("delay %u: %u ticks, %u in host time, %u tick interrupts\n", Delays[n], ticks, time, count);
+    WaitEnd((Delays[n] > 2U) ? 1U : 0U);
+    DelayCheck(ticks, Delays[n]);
+    HOST_CHECK(Diff(ticks, time) <= TICK_TOLERANCE);
+    // Tick runs only around the sleep: before the sleep starts and at the end
+    HOST_CHECK(count <= (TICK_TOLERANCE + 2U));
+    DriftCheck();
+  }
+  HOST_CHECK(SleepTicks >= (Delays[DELAY_NUM - 1U] - 1U));
+}
+
+// Early wake-up of a thread waiting with a long timeout: tick count and host time agree.
+static void EarlyThread (uint32_t early) {
+  uint32_t tick, ticks, time, flags;
+  uint64_t start;
+
+  WakeThread = 1U;
+  WaitStart();
+  tick  = osKernelGetTickCount();
+  start = HostTimeNs();
+  IrqTimerSet(early);
+  flags = osThreadFlagsWait(WAKEUP_FLAG, osFlagsWaitAny, WAKEUP_TIMEOUT);
+  ticks = osKernelGetTickCount() - tick;
+  time  = TimeTicks(HostTimeNs() - start);
+  WaitEnd(0U);
+  HOST_CHECK(flags == WAKEUP_FLAG);
+  HOST_CHECK(Diff(ticks, time) <= TICK_TOLERANCE);
+  HOST_CHECK(time >= TimeTicks(early));
+  HOST_CHECK(time <= (TimeTicks(early) + HOST_LATENCY));
+}
+
+// Early wake-up of the idle thread only: the delay continues and expires in time.
+static void EarlyIdle (uint32_t early) {
+  uint32_t tick, ticks, time, delay;
+  uint32_t irq = IrqCount;
+  uint64_t start;
+
+  WakeThread = 0U;
+  WaitStart();
+  delay = TimeTicks(early) + 2U + (TimeTicks(early) / 2U);
+  tick  = osKernelGetTickCount();
+  start = HostTimeNs();
+  IrqTimerSet(early);
+  HOST_CHECK(osDelay(delay) == osOK);
+  ticks = osKernelGetTickCount() - tick;
+  time  = TimeTicks(HostTimeNs() - start);
+  WaitEnd(1U);
+  HOST_CHECK(IrqCount == (irq + 1U));
+  DelayCheck(ticks, delay);
+  HOST_CHECK(Diff(ticks, time) <= TICK_TOLERANCE);
+}
+
+static void TestEarlyWakeup (void) {
+  uint32_t rand = Seed;
+  uint32_t round, early;
+
+  for (round = 0U; round < Rounds; round++) {
+    // Random time, also within the first tick
+    early = HostRand(&rand) % EARLY_MAX_NS;
+    if ((round % 4U) == 0U) {
+      early %= TICK_NS;
+    }
+    if (early == 0U) {
+      early = 1U;
+    }
+    if ((round % 2U) == 0U) {
+      EarlyThread(early);
+    } else {
+      EarlyIdle(early);
+    }
+    DriftCheck();
+    if (HostTestErrors != 0U) {
+      printf("round %u failed: early wake-up after %u ns\n", round, early);
+      //lint -e{904} "Return statement before end of function"
+      return;
+    }
+  }
+}
+
+static void App (void *argument) {
+  (void)argument;
+
+  Waiter = osThreadGetId();
+  HOST_CHECK(IrqSetup() == 0);
+  //lint -e{923} -e{9074} "cast between pointer to function and unsigned int"
+  TickHandler = (IRQHandler_t)(uintptr_t)NVIC_GetVector(SysTick_IRQn);
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(SysTick_IRQn, (uint32_t)(uintptr_t)TickCounter);
+
+  // Start at a tick
+  (void)osDelay(1U);
+  StartTick = osKernelGetTickCount();
+  StartTime = HostTimeNs();
+
+  TestMaskedTicks();
+  TestLongSleep();
+  TestEarlyWakeup();
+  printf("%u tick interrupts in %u ticks, %u tick-less sleeps (longest %u ticks), %u interrupts, drift %u ticks, late %u ticks\n",
+         TickCount, osKernelGetTickCount() - StartTick, SleepCount, SleepTicks, IrqCount, DriftMax, LateMin);
+  HOST_CHECK(LateMin == 0U);
+
+  HostTestExit();
+}
+
+int main (int argc, char *argv[]) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityHigh };
+
+  Seed   = (uint32_t)strtoul(HostTestOption(argc, argv, "seed",   "1"),  NULL, 0);
+  Rounds = (uint32_t)strtoul(HostTestOption(argc, argv, "rounds", "40"), NULL, 0);
+  if (Seed == 0U) {
+    printf("Usage: %s [--seed <n>] [--rounds <n>]\n", argv[0]);
+    return 2;
+  }
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(App, NULL, &attr);
+  (void)osKernelStart();
+  return 1;
+}
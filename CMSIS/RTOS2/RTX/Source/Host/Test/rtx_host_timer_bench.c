@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host timer and delay insertion benchmark
+ *
+ * Measures starting and stopping a timer with a number of other active timers,
+ * and a thread delay started and ended (wake-up by thread flags) with a number
+ * of other delayed threads. The measured timer and delay expire after all
+ * others, which is the worst case for the sorted lists and independent of the
+ * number of active ones with the timer wheel (OS_TIMER_WHEEL). Built once for
+ * each.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stddef.h>
+
+#include "cmsis_os2.h"
+#include "rtx_host_test.h"
+
+#define TIMER_MAX               4096U
+#define DELAYED_MAX             256U
+#define DELAYED_STACK_SIZE      16384U
+#define TICKS_ACTIVE            100000U
+#define TICKS_MEASURED          200000U
+
+static osTimerId_t  Timer[TIMER_MAX];
+static uint32_t     TimerNum;
+static osTimerId_t  Measured;
+static osThreadId_t Delayed[DELAYED_MAX];
+static uint32_t     DelayedNum;
+static osThreadId_t Sleeper;
+
+// Thread stacks are static: the dynamic memory is too small for many threads
+static uint64_t     DelayedStack[DELAYED_MAX][DELAYED_STACK_SIZE / 8U];
+
+
+//  ==== Timer start and stop ====
+
+static void TimerCallback (void *argument) {
+  (void)argument;
+}
+
+// Create the measured timer and param active timers with different expiry times.
+static int32_t TimerSetup (uint32_t param) {
+  Measured = osTimerNew(TimerCallback, osTimerOnce, NULL, NULL);
+  if (Measured == NULL) {
+    return -1;
+  }
+  for (TimerNum = 0U; TimerNum < param; TimerNum++) {
+    Timer[TimerNum] = osTimerNew(TimerCallback, osTimerOnce, NULL, NULL);
+    if ((Timer[TimerNum] == NULL) ||
+        (osTimerStart(Timer[TimerNum], TICKS_ACTIVE + (TimerNum * 13U)) != osOK)) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void TimerTeardown (void) {
+  uint32_t n;
+
+  (void)osTimerDelete(Measured);
+  for (n = 0U; n < TimerNum; n++) {
+    (void)osTimerDelete(Timer[n]);
+  }
+}
+
+static void TimerRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osTimerStart(Measured, TICKS_MEASURED);
+    (void)osTimerStop(Measured);
+  }
+}
+
+
+//  ==== Thread delay ====
+
+static void DelayedThread (void *argument) {
+  uint32_t ticks = TICKS_ACTIVE + (uint32_t)(uintptr_t)argument;
+
+  for (;;) {
+    (void)osDelay(ticks);
+  }
+}
+
+// Sleeper waits with a timeout and is woken up by the benchmark thread.
+static void SleeperThread (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osThreadFlagsWait(1U, osFlagsWaitAny, TICKS_MEASURED);
+  }
+}
+
+// Create the sleeper and param delayed threads with different expiry times.
+static int32_t DelaySetup (uint32_t param) {
+  osThreadAttr_t attr = { .priority = osPriorityAboveNormal, .stack_size = DELAYED_STACK_SIZE };
+
+  for (DelayedNum = 0U; DelayedNum < param; DelayedNum++) {
+    attr.stack_mem = DelayedStack[DelayedNum];
+    Delayed[DelayedNum] = osThreadNew(DelayedThread, (void *)(uintptr_t)(DelayedNum * 13U), &attr);
+    if (Delayed[DelayedNum] == NULL) {
+      return -1;
+    }
+  }
+  attr.stack_mem  = NULL;
+  attr.stack_size = 0U;
+  Sleeper = osThreadNew(SleeperThread, NULL, &attr);
+  return ((Sleeper != NULL) ? 0 : -1);
+}
+
+static void DelayTeardown (void) {
+  uint32_t n;
+
+  (void)osThreadTerminate(Sleeper);
+  for (n = 0U; n < DelayedNum; n++) {
+    (void)osThreadTerminate(Delayed[n]);
+  }
+}
+
+// Wake-up ends the sleeper delay, its next wait starts a new one.
+static void DelayRun (uint32_t count) {
+  for (; count != 0U; count--) {
+    (void)osThreadFlagsSet(Sleeper, 1U);
+  }
+}
+
+
+static const HostBenchCase_t Cases[] = {
+  { "timer_start_stop_1",        1U, TimerSetup, TimerRun, TimerTeardown },
+  { "timer_start_stop_64",      64U, TimerSetup, TimerRun, TimerTeardown },
+  { "timer_start_stop_1024",  1024U, TimerSetup, TimerRun, TimerTeardown },
+  { "timer_start_stop_4096",  4096U, TimerSetup, TimerRun, TimerTeardown },
+  { "thread_delay_wakeup_1",     1U, DelaySetup, DelayRun, DelayTeardown },
+  { "thread_delay_wakeup_16",   16U, DelaySetup, DelayRun, DelayTeardown },
+  { "thread_delay_wakeup_64",   64U, DelaySetup, DelayRun, DelayTeardown },
+  { "thread_delay_wakeup_256", 256U, DelaySetup, DelayRun, DelayTeardown }
+};
+
+int main (int argc, char *argv[]) {
+#if (OS_TIMER_WHEEL != 0)
+  const char *title = "RTX5 host timer and delay benchmark (timer wheel)";
+#else
+  const char *title = "RTX5 host timer and delay benchmark (sorted lists)";
+#endif
+  return HostBenchMain(argc, argv, title, Cases, sizeof(Cases) / sizeof(Cases[0]));
+}
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host binary trace recorder test
+ *
+ * Built with OS_EVR_TRACE and a small trace buffer. RTX events are disabled;
+ * the test records its own events with osRtxTraceRecord2 (one record),
+ * osRtxTraceRecord4 (one data record) and osRtxTraceRecordData (up to three
+ * data records), with random delays of a few ticks between some of them, so
+ * that time extension records are needed. The records read with
+ * osRtxTraceRead are decoded as by rtx_trace2json.py and checked against the
+ * recorded events:
+ *  - stream mode: the buffer is filled several times and drained in between;
+ *    all recorded events are read in order, and each run of events that were
+ *    not recorded is reported by a Lost record with their number,
+ *  - overwrite mode: the buffer is filled several times without reading; the
+ *    records start with the Start record, and the events read are the newest
+ *    recorded events with their complete data (no orphaned data records),
+ *  - in both modes the decoded time of each event lies between the kernel
+ *    times taken before and after recording it.
+ *
+ * Options: --seed <n> (default 1), --output <file> (write the records read in
+ * overwrite mode, for the decoder script).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+#include "os_tick.h"
+#include "rtx_os.h"
+#include "rtx_host_test.h"
+
+#define EVENT_MAX               (8U * OS_EVR_TRACE_SIZE)
+#define DATA_MAX                24U
+#define RECORDS_MAX             4U              // Records of an event (without Time and Lost records)
+#define DELAY_RATE              16U             // One of DELAY_RATE events follows a delay
+
+#define ID_RECORD2              0x10100U        // API level, component 1
+#define ID_RECORD4              0x10101U
+#define ID_DATA                 0x10102U
+
+//  Recorded event
+typedef struct {
+  uint64_t time_min;                    // Kernel time before recording
+  uint64_t time_max;                    // Kernel time after recording
+  uint16_t id;
+  uint8_t  recorded;
+  uint8_t  len;                         // Data length
+  uint32_t val1;
+  uint32_t val2;
+  uint8_t  data[DATA_MAX];
+} Event_t;
+
+//  Decoded event
+typedef struct {
+  uint64_t time;                        // Time since the start of recording
+  uint16_t id;
+  uint32_t val1;
+  uint32_t val2;
+  uint32_t len;
+  uint8_t  data[DATA_MAX];
+} Decoded_t;
+
+static uint32_t           Seed;
+static const char        *Output;
+static uint32_t           Rand;
+static Event_t            Event[EVENT_MAX];
+static uint32_t           EventNum;
+static osRtxTraceRecord_t Rec[EVENT_MAX * RECORDS_MAX];
+static uint32_t           RecNum;
+static Decoded_t          Dec[EVENT_MAX];
+static uint32_t           DecNum;
+static uint32_t           DecTime;              // Time records decoded
+static uint32_t           DecLost;              // Lost records decoded
+static uint64_t           StartMin;             // Kernel time before and after osRtxTraceStart
+static uint64_t           StartMax;
+
+
+// Kernel errors fail the test instead of halting.
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  printf("kernel error %u (object %p)\n", code, object_id);
+  HostTestErrors++;
+  HostTestExit();
+  return 0U;
+}
+
+// Kernel time in system timer counts, as used by the trace recorder.
+static uint64_t KernelTime (void) {
+  uint32_t tick;
+  uint32_t count;
+
+  __disable_irq();
+  tick  = osKernelGetTickCount();
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  __enable_irq();
+  return (((uint64_t)tick * OS_Tick_GetInterval()) + count);
+}
+
+
+//  ==== Recording ====
+
+static void Start (uint32_t mode) {
+  EventNum = 0U;
+  RecNum   = 0U;
+  StartMin = KernelTime();
+  osRtxTraceStart(mode);
+  StartMax = KernelTime();
+}
+
+// Record a random event.
+static void Record (void) {
+  Event_t *e = &Event[EventNum];
+  uint32_t val[2];
+  uint32_t seq = EventNum;
+  uint32_t n;
+
+  if ((HostRand(&Rand) % DELAY_RATE) == 0U) {
+    HOST_CHECK(osDelay(1U + (HostRand(&Rand) % 3U)) == osOK);
+  }
+
+  (void)memset(e, 0, sizeof(Event_t));
+  e->time_min = KernelTime();
+  switch (HostRand(&Rand) % 3U) {
+    case 0U:
+      e->id   = (uint16_t)ID_RECORD2;
+      e->val1 = seq;
+      e->val2 = ~seq;
+      e->recorded = (uint8_t)osRtxTraceRecord2(ID_RECORD2, e->val1, e->val2);
+      break;
+    case 1U:
+      e->id   = (uint16_t)ID_RECORD4;
+      e->val1 = seq;
+      e->val2 = ~seq;
+      val[0]  = seq * 3U;
+      val[1]  = seq ^ 0x5555U;
+      e->len  = 8U;
+      (void)memcpy(e->data, val, 8U);
+      e->recorded = (uint8_t)osRtxTraceRecord4(ID_RECORD4, e->val1, e->val2, val[0], val[1]);
+      break;
+    default:
+      // Sequence number in the first data bytes
+      e->id  = (uint16_t)ID_DATA;
+      e->len = (uint8_t)(4U + (HostRand(&Rand) % (DATA_MAX - 3U)));
+      (void)memcpy(e->data, &seq, 4U);
+      for (n = 4U; n < e->len; n++) {
+        e->data[n] = (uint8_t)HostRand(&Rand);
+      }
+      e->val1 = e->len;
+      e->val2 = 0U;
+      e->recorded = (uint8_t)osRtxTraceRecordData(ID_DATA, e->data, e->len);
+      break;
+  }
+  e->time_max = KernelTime();
+  EventNum++;
+}
+
+// Read all records.
+static void Read (void) {
+  uint32_t count;
+  uint32_t num;
+
+  count = osRtxTraceGetCount();
+  do {
+    num = osRtxTraceRead(&Rec[RecNum], 7U);
+    RecNum += num;
+    HOST_CHECK(RecNum <= (EVENT_MAX * RECORDS_MAX));
+    count -= (num < count) ? num : count;
+  } while (num != 0U);
+  HOST_CHECK(count == 0U);
+  HOST_CHECK(osRtxTraceGetCount() == 0U);
+}
+
+
+//  ==== Decoding ====
+
+// Decode the records read (as rtx_trace2json.py).
+static void Decode (void) {
+  const osRtxTraceRecord_t *rec;
+  Decoded_t *d = NULL;
+  uint64_t   time = 0U;
+  uint32_t   n;
+
+  DecNum  = 0U;
+  DecTime = 0U;
+  DecLost = 0U;
+
+  HOST_CHECK(RecNum != 0U);
+  HOST_CHECK(Rec[0].id == osRtxTraceIdStart);
+  HOST_CHECK(Rec[0].val1 == OS_Tick_GetClock());
+  HOST_CHECK(Rec[0].val2 == ((1UL << 24) | (OS_EVR_TRACE_SIZE - 1U)));
+
+  for (n = 1U; n < RecNum; n++) {
+    rec = &Rec[n];
+    switch (rec->id) {
+      case osRtxTraceIdStart:
+        HOST_CHECK(rec->id != osRtxTraceIdStart);
+        break;
+      case osRtxTraceIdTime:
+        time += ((uint64_t)rec->val2 << 32) | rec->val1;
+        DecTime++;
+        break;
+      case osRtxTraceIdData:
+        // Data records follow their event
+        HOST_CHECK((d != NULL) && ((d->len + 8U) <= DATA_MAX));
+        if ((d != NULL) && ((d->len + 8U) <= DATA_MAX)) {
+          (void)memcpy(&d->data[d->len], &rec->val1, 4U);
+          (void)memcpy(&d->data[d->len + 4U], &rec->val2, 4U);
+          d->len += 8U;
+        }
+        break;
+      default:
+        time += rec->time;
+        if (rec->id == osRtxTraceIdLost) {
+          DecLost++;
+        }
+        d = &Dec[DecNum++];
+        (void)memset(d, 0, sizeof(Decoded_t));
+        d->time = time;
+        d->id   = rec->id;
+        d->val1 = rec->val1;
+        d->val2 = rec->val2;
+        break;
+    }
+  }
+}
+
+// Check a decoded event against a recorded event.
+static void Check (const Decoded_t *d, const Event_t *e) {
+  uint32_t len;
+
+  HOST_CHECK(d->id   == e->id);
+  HOST_CHECK(d->val1 == e->val1);
+  HOST_CHECK(d->val2 == e->val2);
+  len = (e->len + 7U) & ~7U;
+  HOST_CHECK(d->len == len);
+  HOST_CHECK(memcmp(d->data, e->data, len) == 0);
+  // Time relative to the start of recording
+  HOST_CHECK((d->time + StartMax) >= e->time_min);
+  HOST_CHECK((d->time + StartMin) <= e->time_max);
+}
+
+
+//  ==== Tests ====
+
+// Fill the buffer several times and drain it when full: all recorded events are read and the
+// events not recorded are reported by Lost records.
+static void TestStream (void) {
+  uint32_t lost, drop, dropped, drains;
+  uint32_t n, i;
+
+  Start(osRtxTraceStream);
+  drains  = 0U;
+  dropped = 0U;
+  lost    = 0U;
+  drop    = 0U;
+  while (EventNum < (EVENT_MAX - 1U)) {
+    Record();
+    if (Event[EventNum - 1U].recorded == 0U) {
+      // Buffer full: drop a few more, then drain
+      if (lost == 0U) {
+        drop = 1U + (HostRand(&Rand) % 5U);
+      }
+      dropped++;
+      lost++;
+      if (lost == drop) {
+        Read();
+        drains++;
+        lost = 0U;
+      }
+    }
+  }
+  // Last event reports the lost ones
+  Read();
+  Record();
+  HOST_CHECK(Event[EventNum - 1U].recorded != 0U);
+  Read();
+  osRtxTraceStop();
+
+  Decode();
+  printf("stream: %u events, %u dropped, %u drains, %u records, %u time and %u lost records\n",
+         EventNum, dropped, drains, RecNum, DecTime, DecLost);
+  HOST_CHECK(drains != 0U);
+  HOST_CHECK(DecTime != 0U);
+
+  // Recorded events in order, each run of dropped events is reported before the next recorded one
+  i = 0U;
+  lost = 0U;
+  for (n = 0U; n < EventNum; n++) {
+    if (Event[n].recorded == 0U) {
+      lost++;
+      continue;
+    }
+    if (lost != 0U) {
+      HOST_CHECK((i < DecNum) && (Dec[i].id == osRtxTraceIdLost) && (Dec[i].val1 == lost));
+      i++;
+      lost = 0U;
+    }
+    HOST_CHECK(i < DecNum);
+    if (i >= DecNum) {
+      break;
+    }
+    Check(&Dec[i], &Event[n]);
+    i++;
+  }
+  HOST_CHECK(i == DecNum);
+}
+
+// Fill the buffer several times without reading: the newest events are read complete, after
+// the Start record and the time of the discarded events.
+static void TestOverwrite (void) {
+  FILE    *f;
+  uint32_t n, first;
+
+  Start(osRtxTraceOverwrite);
+  while (EventNum < (4U * OS_EVR_TRACE_SIZE)) {
+    Record();
+    HOST_CHECK(Event[EventNum - 1U].recorded != 0U);
+  }
+  osRtxTraceStop();
+  Read();
+
+  Decode();
+  printf("overwrite: %u events, %u read, %u records, %u time records\n", EventNum, DecNum, RecNum, DecTime);
+  HOST_CHECK(DecLost == 0U);
+  HOST_CHECK(DecTime != 0U);
+  // Time of the discarded events follows the Start record
+  HOST_CHECK((RecNum > 1U) && (Rec[1].id == osRtxTraceIdTime));
+  // Buffer is full up to the records of one event
+  HOST_CHECK((RecNum + RECORDS_MAX) >= OS_EVR_TRACE_SIZE);
+
+  // Newest events
+  HOST_CHECK((DecNum != 0U) && (DecNum <= EventNum));
+  first = EventNum - DecNum;
+  for (n = 0U; n < DecNum; n++) {
+    Check(&Dec[n], &Event[first + n]);
+  }
+
+  if (Output != NULL) {
+    f = fopen(Output, "wb");
+    HOST_CHECK(f != NULL);
+    if (f != NULL) {
+      HOST_CHECK(fwrite(Rec, sizeof(osRtxTraceRecord_t), RecNum, f) == RecNum);
+      (void)fclose(f);
+    }
+  }
+}
+
+static void App (void *argument) {
+  (void)argument;
+
+  // Only the events of the test
+  osRtxTraceDisable(0x0FU, 0xF0U, 0xFFU);
+  Rand = Seed;
+
+  TestStream();
+  TestOverwrite();
+
+  HostTestExit();
+}
+
+int main (int argc, char *argv[]) {
+  const osThreadAttr_t attr = { .name = "app", .priority = osPriorityHigh };
+
+  Seed   = (uint32_t)strtoul(HostTestOption(argc, argv, "seed", "1"), NULL, 0);
+  Output = HostTestOption(argc, argv, "output", NULL);
+  if (Seed == 0U) {
+    printf("Usage: %s [--seed <n>] [--output <file>]\n", argv[0]);
+    return 2;
+  }
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(App, NULL, &attr);
+  (void)osKernelStart();
+  return 1;
+}
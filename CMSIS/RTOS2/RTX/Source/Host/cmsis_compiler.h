@@ -0,0 +1,111 @@
+/**************************************************************************//**
+ * @file     cmsis_compiler.h
+ * @brief    CMSIS compiler header file for the RTX5 host (POSIX) port
+ * @version  V1.0.0
+ * @date     17. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Replaces CMSIS/Core/Include/cmsis_compiler.h when building for the host:
+ * the include path of this directory must precede CMSIS/Core/Include.
+ */
+
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#if !defined(__GNUC__)
+  #error "Host port requires GCC or Clang!"
+#endif
+
+/* CMSIS compiler specific defines */
+#ifndef   __ASM
+  #define __ASM                                  __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                               inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE                        static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE                   __attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+  #define __NO_RETURN                            __attribute__((__noreturn__))
+#endif
+#ifndef   __USED
+  #define __USED                                 __attribute__((used))
+#endif
+#ifndef   __WEAK
+  #define __WEAK                                 __attribute__((weak))
+#endif
+#ifndef   __PACKED
+  #define __PACKED                               __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __ALIGNED
+  #define __ALIGNED(x)                           __attribute__((aligned(x)))
+#endif
+#ifndef   __RESTRICT
+  #define __RESTRICT                             __restrict
+#endif
+#ifndef   __COMPILER_BARRIER
+  #define __COMPILER_BARRIER()                   __ASM volatile("":::"memory")
+#endif
+
+
+/* ###########################  Core Function Access  ########################### */
+
+/**
+  \brief   No Operation
+ */
+#define __NOP()                                  __ASM volatile ("nop")
+
+/**
+  \brief   Instruction Synchronization Barrier
+ */
+#define __ISB()                                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/**
+  \brief   Data Synchronization Barrier
+ */
+#define __DSB()                                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/**
+  \brief   Data Memory Barrier
+ */
+#define __DMB()                                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/**
+  \brief   Count leading zeros
+  \param [in]  value  Value to count the leading zeros
+  \return             number of leading zeros in value
+ */
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+  if (value == 0U)
+  {
+    return 32U;
+  }
+  return ((uint8_t)__builtin_clz(value));
+}
+
+#endif /* __CMSIS_COMPILER_H */
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host (POSIX) Exception handlers and context switch
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <signal.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+#include "rtx_lib.h"
+
+
+//  ==== Exception definitions ====
+
+#define EXC_SVCALL              11U     // SVCall exception number
+#define EXC_PENDSV              14U     // PendSV exception number
+#define EXC_SYSTICK             15U     // SysTick exception number
+#define EXC_IRQ0                16U     // Device interrupt 0 exception number
+#define EXC_NUM                 (EXC_IRQ0 + HOST_IRQ_NUM)
+
+#define EXC_SYSTEM_MSK          ((1ULL << EXC_PENDSV) | (1ULL << EXC_SYSTICK))
+#define EXC_IRQ_MSK             (((1ULL << HOST_IRQ_NUM) - 1ULL) << EXC_IRQ0)
+
+/// Stack Frame value of a thread with an initialized host context
+#define STACK_FRAME_HOST_VAL    0xEDU
+
+/// Minimum host stack size available to a thread (bytes)
+#ifndef HOST_STACK_MIN
+#define HOST_STACK_MIN          8192U
+#endif
+
+
+//  ==== Exception state ====
+
+Host_Core_Type Host_Core = { 0U, 0U, 0U, 0U, 0U, EXC_SYSTEM_MSK };
+
+//lint -esym(765,irqRtxLib) "Global scope"
+uint8_t irqRtxLib;                      // Non weak library reference
+
+// Exception vectors (PendSV is served by the kernel, SysTick by OS_Tick_Setup)
+static IRQHandler_t Vector[EXC_NUM] = {
+  [EXC_PENDSV] = osRtxPendSV_Handler
+};
+
+static volatile uint32_t ExcCount;      // Number of executed exceptions
+static uint32_t   MainFrame[16];        // Register frame when no thread is running
+static sigset_t   ThreadSigMask;        // Signal mask of threads
+static bool_t     ThreadSigMaskValid;
+
+
+//  ==== Helper functions ====
+
+/// Get register frame (R0..R3) of running thread.
+/// \return pointer to registers R0..R3.
+static uint32_t *RegPtr (void) {
+  const os_thread_t *thread = osRtxInfo.thread.run.curr;
+
+  if (thread == NULL) {
+    //lint -e{904} "Return statement before end of function"
+    return &MainFrame[8];
+  }
+  return osRtxThreadRegPtr(thread);
+}
+
+/// Get highest priority pending and enabled exception.
+/// \param[in]  mask            exceptions to consider.
+/// \return exception number or 0 when none is pending.
+static uint32_t ExceptionPending (uint64_t mask) {
+  uint64_t pend = Host_Core.ISPR & Host_Core.ISER & mask;
+
+  if (pend == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return 0U;
+  }
+  // Device interrupts before PendSV before SysTick
+  if ((pend & EXC_IRQ_MSK) != 0U) {
+    pend &= EXC_IRQ_MSK;
+  }
+  return ((uint32_t)__builtin_ctzll(pend));
+}
+
+/// Execute exception handler.
+/// \param[in]  n               exception number.
+static void ExceptionExecute (uint32_t n) {
+  uint32_t ipsr = Host_Core.IPSR;
+
+  (void)__atomic_fetch_and(&Host_Core.ISPR, ~(1ULL << n), __ATOMIC_SEQ_CST);
+  Host_Core.IPSR = n;
+  __COMPILER_BARRIER();
+  if (Vector[n] != NULL) {
+    Vector[n]();
+  }
+  __COMPILER_BARRIER();
+  Host_Core.IPSR = ipsr;
+  ExcCount++;
+}
+
+/// Get host context of a thread (created on first use).
+/// \param[in]  thread          thread object.
+/// \return host context.
+static ucontext_t *ThreadContext (os_thread_t *thread);
+
+/// Switch from running thread to next thread.
+static void ContextSwitch (void) {
+  os_thread_t *curr = osRtxInfo.thread.run.curr;
+  os_thread_t *next = osRtxInfo.thread.run.next;
+  ucontext_t  *ctx;
+
+  if (!ThreadSigMaskValid) {
+    // Threads run with the signal mask of the thread starting the kernel
+    (void)sigprocmask(SIG_SETMASK, NULL, &ThreadSigMask);
+    ThreadSigMaskValid = TRUE;
+  }
+
+  ctx = ThreadContext(next);
+  osRtxInfo.thread.run.curr = next;
+
+  if (curr == NULL) {
+    // Running thread deleted or kernel started: current context is abandoned
+    (void)setcontext(ctx);
+  } else {
+    (void)swapcontext(ThreadContext(curr), ctx);
+  }
+}
+
+/// Execute pending exceptions, switch thread when required and return to Thread mode.
+static void ExceptionReturn (void) {
+  uint32_t n;
+
+  if (Host_Core.IPSR == 0U) {
+    Host_Core.IPSR = EXC_PENDSV;
+  }
+
+  for (;;) {
+    // Thread switch is completed by each exception (as SVC_Context on Cortex-M)
+    if (osRtxInfo.thread.run.curr != osRtxInfo.thread.run.next) {
+      ContextSwitch();
+      continue;
+    }
+    n = ExceptionPending(~0ULL);
+    if (n != 0U) {
+      ExceptionExecute(n);
+      continue;
+    }
+    __COMPILER_BARRIER();
+    Host_Core.IPSR = 0U;
+    __COMPILER_BARRIER();
+    // Exception pended before Thread mode has been entered
+    if (ExceptionPending(~0ULL) == 0U) {
+      break;
+    }
+    Host_Core.IPSR = EXC_PENDSV;
+  }
+}
+
+/// Thread startup (entered by the first switch to a thread).
+static void ThreadStart (void) {
+  const os_thread_t *thread = osRtxInfo.thread.run.curr;
+  //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+  const uint32_t *frame = (const uint32_t *)(uintptr_t)thread->sp;
+  osThreadFunc_t  func  = (osThreadFunc_t)(uintptr_t)frame[14];         // PC
+  void           *arg   = (void *)(uintptr_t)frame[8];                  // R0
+  void          (*exit_func)(void) = (void (*)(void))(uintptr_t)frame[13]; // LR
+
+  // Complete exception which switched to this thread
+  ExceptionReturn();
+
+  func(arg);
+  exit_func();
+}
+
+static ucontext_t *ThreadContext (os_thread_t *thread) {
+  uint32_t    addr;
+  ucontext_t *ctx;
+
+  // Host context is located below the register frame
+  addr = (thread->sp - (uint32_t)sizeof(ucontext_t)) & ~63U;
+  //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+  ctx  = (ucontext_t *)(uintptr_t)addr;
+
+  if (thread->stack_frame == STACK_FRAME_INIT_VAL) {
+    //lint -e{923} "cast from pointer to unsigned int"
+    if ((addr < ((uint32_t)(uintptr_t)thread->stack_mem + HOST_STACK_MIN)) ||
+        (getcontext(ctx) != 0)) {
+      // Thread stack too small for the host
+      (void)osRtxErrorNotify(osRtxErrorStackUnderflow, thread);
+      abort();
+    }
+    ctx->uc_link          = NULL;
+    ctx->uc_stack.ss_sp   = thread->stack_mem;
+    ctx->uc_stack.ss_size = addr - (uint32_t)(uintptr_t)thread->stack_mem;
+    ctx->uc_sigmask       = ThreadSigMask;
+    makecontext(ctx, ThreadStart, 0);
+    thread->stack_frame = STACK_FRAME_HOST_VAL;
+  }
+
+  return ctx;
+}
+
+
+//  ==== Service Calls ====
+
+/// Enter Service Call: store arguments in register frame.
+void SVC_Enter (uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4) {
+  uint32_t *reg = RegPtr();
+
+  reg[0] = a1;
+  reg[1] = a2;
+  reg[2] = a3;
+  reg[3] = a4;
+
+  Host_Core.IPSR = EXC_SVCALL;
+  __COMPILER_BARRIER();
+}
+
+/// Exit Service Call: store return value and return to Thread mode.
+/// \return return value (R0) of the Service Call.
+uint32_t SVC_Exit (uint32_t ret) {
+
+  RegPtr()[0] = ret;
+  ExceptionReturn();
+
+  // Thread is running again (return value may have been updated while waiting)
+  return (RegPtr()[0]);
+}
+
+
+//  ==== Core functions ====
+
+/// Execute pending exceptions.
+void Host_Exception (void) {
+  uint32_t ipsr;
+  uint32_t n;
+
+  if (Host_Core.PRIMASK != 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return;
+  }
+
+  ipsr = Host_Core.IPSR;
+  if (ipsr == 0U) {
+    if (ExceptionPending(~0ULL) != 0U) {
+      ExceptionReturn();
+    }
+  } else if (ipsr < EXC_IRQ0) {
+    // Device interrupts preempt system exceptions
+    for (;;) {
+      n = ExceptionPending(EXC_IRQ_MSK);
+      if (n == 0U) {
+        break;
+      }
+      ExceptionExecute(n);
+    }
+  } else {
+    // Device interrupts do not preempt each other
+  }
+}
+
+/// Get Process Stack Pointer (register frame of running thread).
+uint32_t __get_PSP (void) {
+  //lint -e{923} "cast from pointer to unsigned int"
+  return ((uint32_t)(uintptr_t)RegPtr());
+}
+
+/// Wait For Interrupt.
+void __WFI (void) {
+  uint32_t count = ExcCount;
+  sigset_t mask, old;
+
+  // Exceptions are executed within sigsuspend when not masked
+  (void)sigfillset(&mask);
+  (void)sigprocmask(SIG_BLOCK, &mask, &old);
+  while (((Host_Core.ISPR & Host_Core.ISER) == 0U) && (count == ExcCount)) {
+    (void)sigsuspend(&old);
+  }
+  (void)sigprocmask(SIG_SETMASK, &old, NULL);
+
+  Host_Exception();
+}
+
+
+//  ==== NVIC functions ====
+
+/// Set Interrupt Vector.
+void NVIC_SetVector (IRQn_Type IRQn, uint32_t vector) {
+  //lint -e{923} -e{9074} "cast from unsigned int to pointer to function"
+  Vector[(int32_t)IRQn + 16] = (IRQHandler_t)(uintptr_t)vector;
+}
+
+/// Get Interrupt Vector.
+uint32_t NVIC_GetVector (IRQn_Type IRQn) {
+  //lint -e{923} -e{9074} "cast from pointer to function to unsigned int"
+  return ((uint32_t)(uintptr_t)Vector[(int32_t)IRQn + 16]);
+}
@@ -0,0 +1,261 @@
+/**************************************************************************//**
+ * @file     os_tick_host.c
+ * @brief    CMSIS OS Tick implementation for the RTX5 host (POSIX) port
+ * @version  V1.0.0
+ * @date     17. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "os_tick.h"
+#include "cmsis_os2.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+// Skip idle time in tick-less idle (simulated time advances without sleeping)
+#ifndef OS_TICK_HOST_SKIP_IDLE
+#define OS_TICK_HOST_SKIP_IDLE  0
+#endif
+
+#define OS_TICK_HOST_CLOCK      1000000000U     // Timer clock: nanoseconds
+
+static uint64_t Period;                 // Tick period in nanoseconds
+static uint64_t TickNext;               // Time of the next tick
+static uint64_t Skew;                   // Time skipped in tick-less idle
+static volatile uint8_t Running;        // Tick timer running
+static uint8_t  PendST;
+
+// Get current time in nanoseconds.
+static uint64_t TimeNow (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * OS_TICK_HOST_CLOCK) + (uint64_t)ts.tv_nsec + Skew);
+}
+
+// Start host timer.
+static void TimerStart (uint64_t delay, uint64_t interval) {
+  struct itimerval tv;
+
+  if (delay < 1000U) {
+    delay = 1000U;
+  }
+  tv.it_value.tv_sec     = (time_t)(delay / OS_TICK_HOST_CLOCK);
+  tv.it_value.tv_usec    = (suseconds_t)((delay % OS_TICK_HOST_CLOCK) / 1000U);
+  tv.it_interval.tv_sec  = (time_t)(interval / OS_TICK_HOST_CLOCK);
+  tv.it_interval.tv_usec = (suseconds_t)((interval % OS_TICK_HOST_CLOCK) / 1000U);
+  Running = 1U;
+  (void)setitimer(ITIMER_REAL, &tv, NULL);
+}
+
+// Stop host timer.
+static void TimerStop (void) {
+  struct itimerval tv;
+
+  Running = 0U;
+  (void)memset(&tv, 0, sizeof(tv));
+  (void)setitimer(ITIMER_REAL, &tv, NULL);
+}
+
+// Host timer signal handler.
+static void TimerSignal (int sig) {
+  (void)sig;
+
+  if (Running != 0U) {
+    NVIC_SetPendingIRQ(SysTick_IRQn);
+  }
+}
+
+// Setup OS Tick.
+int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
+  struct sigaction sa;
+
+  if ((freq == 0U) || (freq > OS_TICK_HOST_CLOCK)) {
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  TimerStop();
+
+  (void)memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = TimerSignal;
+  sa.sa_flags   = SA_RESTART;
+  (void)sigemptyset(&sa.sa_mask);
+  if (sigaction(SIGALRM, &sa, NULL) != 0) {
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(SysTick_IRQn, (uint32_t)(uintptr_t)handler);
+
+  Period   = OS_TICK_HOST_CLOCK / freq;
+  TickNext = 0U;
+  PendST   = 0U;
+
+  return (0);
+}
+
+/// Enable OS Tick.
+void OS_Tick_Enable (void) {
+  uint64_t now;
+
+  if (PendST != 0U) {
+    PendST = 0U;
+    NVIC_SetPendingIRQ(SysTick_IRQn);
+  }
+
+  now = TimeNow();
+  if (TickNext == 0U) {
+    TickNext = now + Period;
+  } else if (TickNext < now) {
+    // Time with the tick disabled is not counted (as with SysTick): one tick is due now
+    TickNext = now;
+  } else {
+    // Tick timer phase is kept
+  }
+  TimerStart((TickNext > now) ? (TickNext - now) : 0U, Period);
+}
+
+/// Disable OS Tick.
+void OS_Tick_Disable (void) {
+
+  TimerStop();
+
+  if (NVIC_GetPendingIRQ(SysTick_IRQn) != 0U) {
+    NVIC_ClearPendingIRQ(SysTick_IRQn);
+    PendST = 1U;
+  }
+}
+
+// Acknowledge OS Tick IRQ.
+void OS_Tick_AcknowledgeIRQ (void) {
+  uint64_t now = TimeNow();
+
+  TickNext += Period;
+#if (OS_TICK_HOST_SKIP_IDLE != 0)
+  if (now >= (TickNext + Period)) {
+    // Simulated time: host latency is not counted as kernel time
+    TickNext += ((now - TickNext) / Period) * Period;
+  }
+#else
+  if ((Running != 0U) && (now >= TickNext)) {
+    // Periods elapsed while exceptions were masked or the host merged timer signals:
+    // the tick is pended again until the kernel tick count has caught up
+    NVIC_SetPendingIRQ(SysTick_IRQn);
+  }
+#endif
+}
+
+// Get OS Tick IRQ number.
+int32_t  OS_Tick_GetIRQn (void) {
+  return ((int32_t)SysTick_IRQn);
+}
+
+// Get OS Tick clock.
+uint32_t OS_Tick_GetClock (void) {
+  return (OS_TICK_HOST_CLOCK);
+}
+
+// Get OS Tick interval.
+uint32_t OS_Tick_GetInterval (void) {
+  return ((uint32_t)Period);
+}
+
+// Get OS Tick count value.
+uint32_t OS_Tick_GetCount (void) {
+  uint64_t now  = TimeNow();
+  uint64_t last = TickNext - Period;
+
+  if (now < last) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+  if (now >= TickNext) {
+    // Tick overflow: count of the next period, held at its end while more ticks are pending
+    // so that the kernel time does not go back before the tick interrupt has caught up
+    now -= Period;
+    if (now >= TickNext) {
+      now = TickNext - 1U;
+    }
+  }
+  return ((uint32_t)(now - last));
+}
+
+// Get OS Tick overflow status.
+uint32_t OS_Tick_GetOverflow (void) {
+  return ((TimeNow() >= TickNext) ? 1U : 0U);
+}
+
+// Suspend OS Tick for tick-less sleep.
+uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  uint64_t now;
+  uint64_t wake;
+
+  // Pending tick needs to be processed by the kernel first
+  if ((PendST != 0U) || (Period == 0U) || (ticks == 0U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  if (ticks == osWaitForever) {
+    // Sleep until any other interrupt is pending
+    //lint -e{904} "Return statement before end of function"
+    return (ticks);
+  }
+
+  // Expire at the end of tick 'ticks'
+  now  = TimeNow();
+  wake = TickNext + ((uint64_t)(ticks - 1U) * Period);
+
+#if (OS_TICK_HOST_SKIP_IDLE != 0)
+  if (wake > now) {
+    Skew += wake - now;
+  }
+  NVIC_SetPendingIRQ(SysTick_IRQn);
+#else
+  TimerStart((wake > now) ? (wake - now) : 0U, 0U);
+#endif
+
+  return (ticks);
+}
+
+// Resume OS Tick after tick-less sleep.
+uint32_t OS_Tick_Resume (void) {
+  uint64_t now;
+  uint32_t ticks;
+
+  TimerStop();
+  // Sleep period expired (tick interrupt is consumed here)
+  NVIC_ClearPendingIRQ(SysTick_IRQn);
+
+  now   = TimeNow();
+  ticks = 0U;
+  if (now >= TickNext) {
+    ticks     = (uint32_t)((now - TickNext) / Period) + 1U;
+    TickNext += (uint64_t)ticks * Period;
+  }
+
+  return (ticks);
+}
@@ -0,0 +1,279 @@
+/**************************************************************************//**
+ * @file     rtx_host.h
+ * @brief    Device header file for the RTX5 host (POSIX) port
+ * @version  V1.0.0
+ * @date     17. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RTX_HOST_H
+#define RTX_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "cmsis_compiler.h"
+
+/*
+ * The host port emulates a single Cortex-M like core on one host thread:
+ *  - exceptions (SVCall, PendSV, SysTick and device interrupts) are function
+ *    calls executed in handler mode (IPSR != 0);
+ *  - asynchronous interrupt sources are host signals which pend an exception;
+ *  - PRIMASK masks the execution of pending exceptions.
+ *
+ * Device interrupts have a higher priority than the system exceptions and may
+ * preempt SVCall, PendSV and SysTick handlers. Device interrupts do not preempt
+ * each other.
+ */
+
+
+/* =========================================================================================================================== */
+/* ================                                Interrupt Number Definition                                ================ */
+/* =========================================================================================================================== */
+
+typedef enum IRQn
+{
+/* ========================================  Host Processor Exceptions Numbers  ============================================== */
+  SVCall_IRQn               =  -5,              /*!< -5  SV Call Interrupt                                                     */
+  PendSV_IRQn               =  -2,              /*!< -2  Pend SV Interrupt                                                     */
+  SysTick_IRQn              =  -1,              /*!< -1  System Tick Interrupt                                                 */
+
+/* ========================================  Host Device Interrupt Numbers  ================================================== */
+  Host0_IRQn                =   0,              /*!< Device Interrupt 0                                                        */
+  Host31_IRQn               =  31               /*!< Device Interrupt 31                                                       */
+} IRQn_Type;
+
+#define HOST_IRQ_NUM            32U             /*!< Number of device interrupts                                               */
+
+
+/* =========================================================================================================================== */
+/* ================                                   Emulated Core State                                     ================ */
+/* =========================================================================================================================== */
+
+/**
+  \brief  Emulated core registers.
+ */
+typedef struct
+{
+  volatile uint32_t IPSR;                       /*!< Active exception number (0: Thread mode)                                  */
+  volatile uint32_t PRIMASK;                    /*!< Priority mask (1: exceptions masked)                                      */
+  volatile uint32_t CONTROL;                    /*!< Control register                                                          */
+           uint32_t RESERVED0;
+  volatile uint64_t ISPR;                       /*!< Pending exceptions (bit n: exception number n)                            */
+  volatile uint64_t ISER;                       /*!< Enabled exceptions (bit n: exception number n)                            */
+} Host_Core_Type;
+
+extern Host_Core_Type Host_Core;
+
+/**
+  \brief   Execute pending exceptions
+  \details Called when an exception was pended or PRIMASK was cleared. Executes pending and enabled exceptions
+           when the current execution priority permits it.
+ */
+extern void Host_Exception (void);
+
+
+/* ###########################  Core Function Access  ########################### */
+
+/**
+  \brief   Get IPSR Register
+  \return               IPSR Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+  return (Host_Core.IPSR);
+}
+
+/**
+  \brief   Get Control Register
+  \return               Control Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_CONTROL(void)
+{
+  return (Host_Core.CONTROL);
+}
+
+/**
+  \brief   Set Control Register
+  \param [in]    control  Control Register value to set
+ */
+__STATIC_FORCEINLINE void __set_CONTROL(uint32_t control)
+{
+  Host_Core.CONTROL = control;
+}
+
+/**
+  \brief   Get Priority Mask
+  \return               Priority Mask value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+  return (Host_Core.PRIMASK);
+}
+
+/**
+  \brief   Set Priority Mask
+  \param [in]    priMask  Priority Mask
+ */
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+  __COMPILER_BARRIER();
+  Host_Core.PRIMASK = priMask & 1U;
+  __COMPILER_BARRIER();
+  if (((priMask & 1U) == 0U) && ((Host_Core.ISPR & Host_Core.ISER) != 0U))
+  {
+    Host_Exception();
+  }
+}
+
+/**
+  \brief   Disable IRQ Interrupts
+ */
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+  __COMPILER_BARRIER();
+  Host_Core.PRIMASK = 1U;
+  __COMPILER_BARRIER();
+}
+
+/**
+  \brief   Enable IRQ Interrupts
+ */
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+  __set_PRIMASK(0U);
+}
+
+/**
+  \brief   Get Process Stack Pointer
+  \return               Address of the register frame (R0) of the running thread
+ */
+extern uint32_t __get_PSP(void);
+
+/**
+  \brief   Wait For Interrupt
+  \details Suspends the host thread until an exception is pending (also when masked by PRIMASK).
+ */
+extern void __WFI(void);
+
+/**
+  \brief   Wait For Event
+ */
+#define __WFE()                 __WFI()
+
+/**
+  \brief   Send Event
+ */
+#define __SEV()                 __NOP()
+
+
+/* ##########################   NVIC functions  #################################### */
+
+/**
+  \brief   Enable Interrupt
+  \param [in]      IRQn  Device specific interrupt number.
+ */
+__STATIC_FORCEINLINE void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  if ((int32_t)(IRQn) >= 0)
+  {
+    (void)__atomic_fetch_or(&Host_Core.ISER, 1ULL << ((uint32_t)IRQn + 16U), __ATOMIC_SEQ_CST);
+    if ((Host_Core.ISPR & Host_Core.ISER) != 0U)
+    {
+      Host_Exception();
+    }
+  }
+}
+
+/**
+  \brief   Disable Interrupt
+  \param [in]      IRQn  Device specific interrupt number.
+ */
+__STATIC_FORCEINLINE void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  if ((int32_t)(IRQn) >= 0)
+  {
+    (void)__atomic_fetch_and(&Host_Core.ISER, ~(1ULL << ((uint32_t)IRQn + 16U)), __ATOMIC_SEQ_CST);
+  }
+}
+
+/**
+  \brief   Get Interrupt Enable status
+  \param [in]      IRQn  Device specific interrupt number.
+  \return             0  Interrupt is not enabled.
+  \return             1  Interrupt is enabled.
+ */
+__STATIC_FORCEINLINE uint32_t NVIC_GetEnableIRQ(IRQn_Type IRQn)
+{
+  return ((uint32_t)((Host_Core.ISER >> ((uint32_t)((int32_t)IRQn + 16))) & 1U));
+}
+
+/**
+  \brief   Set Pending Interrupt
+  \details Sets the pending bit of an exception. The exception is executed immediately when the current execution
+           priority permits it. May be called from host signal handlers.
+  \param [in]      IRQn  Interrupt number.
+ */
+__STATIC_FORCEINLINE void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+  (void)__atomic_fetch_or(&Host_Core.ISPR, 1ULL << ((uint32_t)((int32_t)IRQn + 16)), __ATOMIC_SEQ_CST);
+  Host_Exception();
+}
+
+/**
+  \brief   Get Pending Interrupt
+  \param [in]      IRQn  Interrupt number.
+  \return             0  Interrupt status is not pending.
+  \return             1  Interrupt status is pending.
+ */
+__STATIC_FORCEINLINE uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+  return ((uint32_t)((Host_Core.ISPR >> ((uint32_t)((int32_t)IRQn + 16))) & 1U));
+}
+
+/**
+  \brief   Clear Pending Interrupt
+  \param [in]      IRQn  Interrupt number.
+ */
+__STATIC_FORCEINLINE void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  (void)__atomic_fetch_and(&Host_Core.ISPR, ~(1ULL << ((uint32_t)((int32_t)IRQn + 16))), __ATOMIC_SEQ_CST);
+}
+
+/**
+  \brief   Set Interrupt Vector
+  \param [in]   IRQn      Interrupt number
+  \param [in]   vector    Address of interrupt handler function
+ */
+extern void NVIC_SetVector(IRQn_Type IRQn, uint32_t vector);
+
+/**
+  \brief   Get Interrupt Vector
+  \param [in]   IRQn      Interrupt number
+  \return                 Address of interrupt handler function
+ */
+extern uint32_t NVIC_GetVector(IRQn_Type IRQn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* RTX_HOST_H */
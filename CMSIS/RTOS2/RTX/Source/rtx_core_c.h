@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2020 Arm Limited. All rights reserved.
+ * Copyright (c) 2013-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -36,11 +36,14 @@
      (!defined(__ARM_ARCH_7EM__))       && \
      (!defined(__ARM_ARCH_8M_BASE__))   && \
      (!defined(__ARM_ARCH_8M_MAIN__))   && \
-     (!defined(__ARM_ARCH_8_1M_MAIN__)))
+     (!defined(__ARM_ARCH_8_1M_MAIN__)) && \
+     (!defined(RTX_HOST)))
 #error "Unknown Arm Architecture!"
 #endif
 
-#if   (defined(__ARM_ARCH_7A__) && (__ARM_ARCH_7A__ != 0))
+#if   (defined(RTX_HOST) && (RTX_HOST != 0))
+#include "rtx_core_host.h"
+#elif (defined(__ARM_ARCH_7A__) && (__ARM_ARCH_7A__ != 0))
 #include "rtx_core_ca.h"
 #else
 #include "rtx_core_cm.h"
@@ -816,6 +816,57 @@ __STATIC_INLINE uint32_t atomic_inc32 (uint32_t *mem) {
 }
 #endif
 
+/// Atomic Access Operation: Add (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  val             Value to add
+/// \return                     Previous value
+#if defined(__CC_ARM)
+static __asm    uint32_t atomic_add32 (uint32_t *mem, uint32_t val) {
+  push  {r4,lr}
+  mov   r2,r0
+1
+  ldrex r0,[r2]
+  adds  r4,r0,r1
+  strex r3,r4,[r2]
+  cbz   r3,%F2
+  b     %B1
+2
+  pop   {r4,pc}
+}
+#else
+__STATIC_INLINE uint32_t atomic_add32 (uint32_t *mem, uint32_t val) {
+#ifdef  __ICCARM__
+#pragma diag_suppress=Pe550
+#endif
+  register uint32_t sum, res;
+#ifdef  __ICCARM__
+#pragma diag_default=Pe550
+#endif
+  register uint32_t ret;
+
+  __ASM volatile (
+#ifndef __ICCARM__
+  ".syntax unified\n\t"
+#endif
+  "1:\n\t"
+    "ldrex %[ret],[%[mem]]\n\t"
+    "adds  %[sum],%[ret],%[val]\n\t"
+    "strex %[res],%[sum],[%[mem]]\n\t"
+    "cbz   %[res],2f\n\t"
+    "b     1b\n"
+  "2:"
+  : [ret] "=&l" (ret),
+    [sum] "=&l" (sum),
+    [res] "=&l" (res)
+  : [mem] "l"   (mem),
+    [val] "l"   (val)
+  : "cc", "memory"
+  );
+
+  return ret;
+}
+#endif
+
 /// Atomic Access Operation: Increment (16-bit) if Less Than
 /// \param[in]  mem             Memory address
 /// \param[in]  max             Maximum value
@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Host (POSIX) Core definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef RTX_CORE_HOST_H_
+#define RTX_CORE_HOST_H_
+
+#ifndef RTX_CORE_C_H_
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+typedef bool bool_t;
+
+#ifndef FALSE
+#define FALSE                   ((bool_t)0)
+#endif
+
+#ifndef TRUE
+#define TRUE                    ((bool_t)1)
+#endif
+
+#define DOMAIN_NS               0
+
+#ifndef EXCLUSIVE_ACCESS
+#define EXCLUSIVE_ACCESS        1
+#endif
+
+#define OS_TICK_HANDLER         osRtxTick_Handler
+
+/// xPSR_Initialization Value
+/// \param[in]  privileged      true=privileged, false=unprivileged
+/// \param[in]  thumb           true=Thumb, false=ARM
+/// \return                     xPSR Init Value
+__STATIC_INLINE uint32_t xPSR_InitVal (bool_t privileged, bool_t thumb) {
+  (void)privileged;
+  (void)thumb;
+  return (0x01000000U);
+}
+
+// Stack Frame:
+//  - Basic: R4-R11, R0-R3, R12, LR, PC, xPSR
+//    (register image used for service call arguments and return values;
+//     the host context is stored in the thread stack below the frame)
+
+/// Stack Frame Initialization Value
+#define STACK_FRAME_INIT_VAL    0xFDU
+
+/// Stack Offset of Register R0
+/// \param[in]  stack_frame     Stack Frame
+/// \return                     R0 Offset
+__STATIC_INLINE uint32_t StackOffsetR0 (uint8_t stack_frame) {
+  (void)stack_frame;
+  return (8U*4U);
+}
+
+
+//  ==== Core functions ====
+
+/// Check if running Privileged
+/// \return     true=privileged, false=unprivileged
+__STATIC_INLINE bool_t IsPrivileged (void) {
+  return ((__get_CONTROL() & 1U) == 0U);
+}
+
+/// Check if in IRQ Mode
+/// \return     true=IRQ, false=thread
+__STATIC_INLINE bool_t IsIrqMode (void) {
+  return (__get_IPSR() != 0U);
+}
+
+/// Check if IRQ is Masked
+/// \return     true=masked, false=not masked
+__STATIC_INLINE bool_t IsIrqMasked (void) {
+  return (__get_PRIMASK() != 0U);
+}
+
+
+//  ==== Core Peripherals functions ====
+
+/// Setup SVC and PendSV System Service Calls
+__STATIC_INLINE void SVC_Setup (void) {
+  // Exception priorities are fixed on the host
+}
+
+/// Get Pending SV (Service Call) Flag
+/// \return     Pending SV Flag
+__STATIC_INLINE uint8_t GetPendSV (void) {
+  return ((uint8_t)NVIC_GetPendingIRQ(PendSV_IRQn));
+}
+
+/// Clear Pending SV (Service Call) Flag
+__STATIC_INLINE void ClrPendSV (void) {
+  NVIC_ClearPendingIRQ(PendSV_IRQn);
+}
+
+/// Set Pending SV (Service Call) Flag
+__STATIC_INLINE void SetPendSV (void) {
+  NVIC_SetPendingIRQ(PendSV_IRQn);
+}
+
+
+//  ==== Service Calls definitions ====
+
+// Service calls are executed as a direct function call in handler mode:
+// SVC_Enter stores the arguments in the register frame of the running thread
+// and SVC_Exit stores the return value, performs a pending thread switch and
+// returns R0 of the register frame once the calling thread runs again.
+
+extern void     SVC_Enter (uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4);
+extern uint32_t SVC_Exit  (uint32_t ret);
+
+#define SVC_Arg(a)  ((uint32_t)(uintptr_t)(a))
+
+#define SVC0_0N(f,t)                                                           \
+__STATIC_INLINE t __svc##f (void) {                                            \
+  SVC_Enter(0U, 0U, 0U, 0U);                                                   \
+  svcRtx##f();                                                                 \
+  (void)SVC_Exit(0U);                                                          \
+}
+
+#define SVC0_0(f,t)                                                            \
+__STATIC_INLINE t __svc##f (void) {                                            \
+  SVC_Enter(0U, 0U, 0U, 0U);                                                   \
+  return (t)(uintptr_t)SVC_Exit(SVC_Arg(svcRtx##f()));                         \
+}
+
+#define SVC0_1N(f,t,t1)                                                        \
+__STATIC_INLINE t __svc##f (t1 a1) {                                           \
+  SVC_Enter(SVC_Arg(a1), 0U, 0U, 0U);                                          \
+  svcRtx##f(a1);                                                               \
+  (void)SVC_Exit(0U);                                                          \
+}
+
+#define SVC0_1(f,t,t1)                                                         \
+__STATIC_INLINE t __svc##f (t1 a1) {                                           \
+  SVC_Enter(SVC_Arg(a1), 0U, 0U, 0U);                                          \
+  return (t)(uintptr_t)SVC_Exit(SVC_Arg(svcRtx##f(a1)));                       \
+}
+
+#define SVC0_2(f,t,t1,t2)                                                      \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2) {                                    \
+  SVC_Enter(SVC_Arg(a1), SVC_Arg(a2), 0U, 0U);                                 \
+  return (t)(uintptr_t)SVC_Exit(SVC_Arg(svcRtx##f(a1,a2)));                    \
+}
+
+#define SVC0_3(f,t,t1,t2,t3)                                                   \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2, t3 a3) {                             \
+  SVC_Enter(SVC_Arg(a1), SVC_Arg(a2), SVC_Arg(a3), 0U);                        \
+  return (t)(uintptr_t)SVC_Exit(SVC_Arg(svcRtx##f(a1,a2,a3)));                 \
+}
+
+#define SVC0_4(f,t,t1,t2,t3,t4)                                                \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2, t3 a3, t4 a4) {                      \
+  SVC_Enter(SVC_Arg(a1), SVC_Arg(a2), SVC_Arg(a3), SVC_Arg(a4));               \
+  return (t)(uintptr_t)SVC_Exit(SVC_Arg(svcRtx##f(a1,a2,a3,a4)));              \
+}
+
+
+//  ==== Exclusive Access Operation ====
+
+#if (EXCLUSIVE_ACCESS == 1)
+
+// Emulated interrupts are delivered as host signals on the same host thread:
+// compiler atomic built-ins provide the required atomicity.
+
+/// Atomic Access Operation: Write (8-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  val             Value to write
+/// \return                     Previous value
+__STATIC_INLINE uint8_t atomic_wr8 (uint8_t *mem, uint8_t val) {
+  return __atomic_exchange_n(mem, val, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Set bits (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     New value
+__STATIC_INLINE uint32_t atomic_set32 (uint32_t *mem, uint32_t bits) {
+  return __atomic_or_fetch(mem, bits, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Clear bits (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_clr32 (uint32_t *mem, uint32_t bits) {
+  return __atomic_fetch_and(mem, ~bits, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Check if all specified bits (32-bit) are active and clear them
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Active bits before clearing or 0 if not active
+__STATIC_INLINE uint32_t atomic_chk32_all (uint32_t *mem, uint32_t bits) {
+  uint32_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if ((ret & bits) != bits) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, ret & ~bits, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Check if any specified bits (32-bit) are active and clear them
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Active bits before clearing or 0 if not active
+__STATIC_INLINE uint32_t atomic_chk32_any (uint32_t *mem, uint32_t bits) {
+  uint32_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if ((ret & bits) == 0U) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, ret & ~bits, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Increment (32-bit)
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_inc32 (uint32_t *mem) {
+  return __atomic_fetch_add(mem, 1U, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Add (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  val             Value to add
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_add32 (uint32_t *mem, uint32_t val) {
+  return __atomic_fetch_add(mem, val, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Increment (16-bit) if Less Than
+/// \param[in]  mem             Memory address
+/// \param[in]  max             Maximum value
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_inc16_lt (uint16_t *mem, uint16_t max) {
+  uint16_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret >= max) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, (uint16_t)(ret + 1U), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Increment (16-bit) and clear on Limit
+/// \param[in]  mem             Memory address
+/// \param[in]  max             Maximum value
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_inc16_lim (uint16_t *mem, uint16_t lim) {
+  uint16_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+  uint16_t val;
+
+  do {
+    val = (uint16_t)(ret + 1U);
+    if (val >= lim) {
+      val = 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Decrement (32-bit)
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_dec32 (uint32_t *mem) {
+  return __atomic_fetch_sub(mem, 1U, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Decrement (32-bit) if Not Zero
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_dec32_nz (uint32_t *mem) {
+  uint32_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == 0U) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, ret - 1U, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Decrement (16-bit) if Not Zero
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_dec16_nz (uint16_t *mem) {
+  uint16_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == 0U) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, (uint16_t)(ret - 1U), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Link Get
+/// \param[in]  root            Root address
+/// \return                     Link
+__STATIC_INLINE void *atomic_link_get (void **root) {
+  void *ret = __atomic_load_n(root, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == NULL) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(root, &ret, *((void **)ret), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Link Put
+/// \param[in]  root            Root address
+/// \param[in]  lnk             Link
+__STATIC_INLINE void atomic_link_put (void **root, void *link) {
+  void *val = __atomic_load_n(root, __ATOMIC_SEQ_CST);
+
+  do {
+    *((void **)link) = val;
+  } while (!__atomic_compare_exchange_n(root, &val, link, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+}
+
+#endif  // (EXCLUSIVE_ACCESS == 1)
+
+
+#endif  // RTX_CORE_HOST_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019 Arm Limited. All rights reserved.
+ * Copyright (c) 2013-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -27,7 +27,7 @@
 #include "cmsis_compiler.h"
 #include "rtx_evr.h"                    // RTX Event Recorder definitions
 
-#ifdef  RTE_Compiler_EventRecorder
+#ifdef  EVR_RTX_RECORD
 
 //lint -e923 -e9074 -e9078 [MISRA Note 13]
 
@@ -227,7 +227,14 @@
 #define EvtRtxMessageQueueDelete            EventID(EventLevelAPI,    EvtRtxMessageQueueNo, 0x17U)
 #define EvtRtxMessageQueueDestroyed         EventID(EventLevelOp,     EvtRtxMessageQueueNo, 0x18U)
 
-#endif  // RTE_Compiler_EventRecorder
+/// Event IDs for "RTX Ring Buffer"
+#define EvtRtxRingBufferError               EventID(EventLevelError,  EvtRtxRingBufferNo, 0x00U)
+#define EvtRtxRingBufferNew                 EventID(EventLevelAPI,    EvtRtxRingBufferNo, 0x01U)
+#define EvtRtxRingBufferCreated             EventID(EventLevelOp,     EvtRtxRingBufferNo, 0x03U)
+#define EvtRtxRingBufferDelete              EventID(EventLevelAPI,    EvtRtxRingBufferNo, 0x04U)
+#define EvtRtxRingBufferDestroyed           EventID(EventLevelOp,     EvtRtxRingBufferNo, 0x05U)
+
+#endif  // EVR_RTX_RECORD
 
 //lint -esym(522, EvrRtx*) "Functions 'EvrRtx*' can be overridden (do not lack side-effects)"
 
@@ -236,7 +243,7 @@
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMORY != 0) && !defined(EVR_RTX_MEMORY_INIT_DISABLE))
 __WEAK void EvrRtxMemoryInit (void *mem, uint32_t size, uint32_t result) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMemoryInit, (uint32_t)mem, size, result, 0U);
 #else
   (void)mem;
@@ -248,7 +255,7 @@ __WEAK void EvrRtxMemoryInit (void *mem, uint32_t size, uint32_t result) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMORY != 0) && !defined(EVR_RTX_MEMORY_ALLOC_DISABLE))
 __WEAK void EvrRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type, void *block) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMemoryAlloc, (uint32_t)mem, size, type, (uint32_t)block);
 #else
   (void)mem;
@@ -261,7 +268,7 @@ __WEAK void EvrRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type, void *bl
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMORY != 0) && !defined(EVR_RTX_MEMORY_FREE_DISABLE))
 __WEAK void EvrRtxMemoryFree (void *mem, void *block, uint32_t result) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMemoryFree, (uint32_t)mem, (uint32_t)block, result, 0U);
 #else
   (void)mem;
@@ -273,7 +280,7 @@ __WEAK void EvrRtxMemoryFree (void *mem, void *block, uint32_t result) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMORY != 0) && !defined(EVR_RTX_MEMORY_BLOCK_INIT_DISABLE))
 __WEAK void EvrRtxMemoryBlockInit (osRtxMpInfo_t *mp_info, uint32_t block_count, uint32_t block_size, void *block_mem) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMemoryBlockInit, (uint32_t)mp_info, block_count, block_size, (uint32_t)block_mem);
 #else
   (void)mp_info;
@@ -286,7 +293,7 @@ __WEAK void EvrRtxMemoryBlockInit (osRtxMpInfo_t *mp_info, uint32_t block_count,
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMORY != 0) && !defined(EVR_RTX_MEMORY_BLOCK_ALLOC_DISABLE))
 __WEAK void EvrRtxMemoryBlockAlloc (osRtxMpInfo_t *mp_info, void *block) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryBlockAlloc, (uint32_t)mp_info, (uint32_t)block);
 #else
   (void)mp_info;
@@ -297,7 +304,7 @@ __WEAK void EvrRtxMemoryBlockAlloc (osRtxMpInfo_t *mp_info, void *block) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMORY != 0) && !defined(EVR_RTX_MEMORY_BLOCK_FREE_DISABLE))
 __WEAK void EvrRtxMemoryBlockFree (osRtxMpInfo_t *mp_info, void *block, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMemoryBlockFree, (uint32_t)mp_info, (uint32_t)block, (uint32_t)status, 0U);
 #else
   (void)mp_info;
@@ -312,7 +319,7 @@ __WEAK void EvrRtxMemoryBlockFree (osRtxMpInfo_t *mp_info, void *block, int32_t
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_ERROR_DISABLE))
 __WEAK void EvrRtxKernelError (int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelError, (uint32_t)status, 0U); 
 #else
   (void)status;
@@ -322,7 +329,7 @@ __WEAK void EvrRtxKernelError (int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_INITIALIZE_DISABLE))
 __WEAK void EvrRtxKernelInitialize (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelInitialize, 0U, 0U);
 #else
 #endif
@@ -331,7 +338,7 @@ __WEAK void EvrRtxKernelInitialize (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_INITIALIZED_DISABLE))
 __WEAK void EvrRtxKernelInitialized (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelInitialized, 0U, 0U);
 #else
 #endif
@@ -340,7 +347,7 @@ __WEAK void EvrRtxKernelInitialized (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_GET_INFO_DISABLE))
 __WEAK void EvrRtxKernelGetInfo (osVersion_t *version, char *id_buf, uint32_t id_size) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxKernelGetInfo, (uint32_t)version, (uint32_t)id_buf, id_size, 0U);
 #else
   (void)version;
@@ -352,7 +359,7 @@ __WEAK void EvrRtxKernelGetInfo (osVersion_t *version, char *id_buf, uint32_t id
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_INFO_RETRIEVED_DISABLE))
 __WEAK void EvrRtxKernelInfoRetrieved (const osVersion_t *version, const char *id_buf, uint32_t id_size) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   if (version != NULL) {
     (void)EventRecord2(EvtRtxKernelInfoRetrieved, version->api, version->kernel);
   }
@@ -369,7 +376,7 @@ __WEAK void EvrRtxKernelInfoRetrieved (const osVersion_t *version, const char *i
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_GET_STATE_DISABLE))
 __WEAK void EvrRtxKernelGetState (osKernelState_t state) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelGetState, (uint32_t)state, 0U);
 #else
   (void)state;
@@ -379,7 +386,7 @@ __WEAK void EvrRtxKernelGetState (osKernelState_t state) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_START_DISABLE))
 __WEAK void EvrRtxKernelStart (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelStart, 0U, 0U);
 #else
 #endif
@@ -388,7 +395,7 @@ __WEAK void EvrRtxKernelStart (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_STARTED_DISABLE))
 __WEAK void EvrRtxKernelStarted (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelStarted, 0U, 0U);
 #else
 #endif
@@ -397,7 +404,7 @@ __WEAK void EvrRtxKernelStarted (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_LOCK_DISABLE))
 __WEAK void EvrRtxKernelLock (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelLock, 0U, 0U);
 #else
 #endif
@@ -406,7 +413,7 @@ __WEAK void EvrRtxKernelLock (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_LOCKED_DISABLE))
 __WEAK void EvrRtxKernelLocked (int32_t lock) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelLocked, (uint32_t)lock, 0U);
 #else
   (void)lock;
@@ -416,7 +423,7 @@ __WEAK void EvrRtxKernelLocked (int32_t lock) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_UNLOCK_DISABLE))
 __WEAK void EvrRtxKernelUnlock (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelUnlock, 0U, 0U);
 #else
 #endif
@@ -425,7 +432,7 @@ __WEAK void EvrRtxKernelUnlock (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_UNLOCKED_DISABLE))
 __WEAK void EvrRtxKernelUnlocked (int32_t lock) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelUnlocked, (uint32_t)lock, 0U);
 #else
   (void)lock;
@@ -435,7 +442,7 @@ __WEAK void EvrRtxKernelUnlocked (int32_t lock) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_RESTORE_LOCK_DISABLE))
 __WEAK void EvrRtxKernelRestoreLock (int32_t lock) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelRestoreLock, (uint32_t)lock, 0U);
 #else
   (void)lock;
@@ -445,7 +452,7 @@ __WEAK void EvrRtxKernelRestoreLock (int32_t lock) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_LOCK_RESTORED_DISABLE))
 __WEAK void EvrRtxKernelLockRestored (int32_t lock) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelLockRestored, (uint32_t)lock, 0U);
 #else
   (void)lock;
@@ -455,7 +462,7 @@ __WEAK void EvrRtxKernelLockRestored (int32_t lock) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_SUSPEND_DISABLE))
 __WEAK void EvrRtxKernelSuspend (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelSuspend, 0U, 0U);
 #else
 #endif
@@ -464,7 +471,7 @@ __WEAK void EvrRtxKernelSuspend (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_SUSPENDED_DISABLE))
 __WEAK void EvrRtxKernelSuspended (uint32_t sleep_ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelSuspended, sleep_ticks, 0U);
 #else
   (void)sleep_ticks;
@@ -474,7 +481,7 @@ __WEAK void EvrRtxKernelSuspended (uint32_t sleep_ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_RESUME_DISABLE))
 __WEAK void EvrRtxKernelResume (uint32_t sleep_ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelResume, sleep_ticks, 0U);
 #else
   (void)sleep_ticks;
@@ -484,7 +491,7 @@ __WEAK void EvrRtxKernelResume (uint32_t sleep_ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_RESUMED_DISABLE))
 __WEAK void EvrRtxKernelResumed (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelResumed, 0U, 0U);
 #else
 #endif
@@ -493,7 +500,7 @@ __WEAK void EvrRtxKernelResumed (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_GET_TICK_COUNT_DISABLE))
 __WEAK void EvrRtxKernelGetTickCount (uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelGetTickCount, count, 0U);
 #else
   (void)count;
@@ -503,7 +510,7 @@ __WEAK void EvrRtxKernelGetTickCount (uint32_t count) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_GET_TICK_FREQ_DISABLE))
 __WEAK void EvrRtxKernelGetTickFreq (uint32_t freq) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelGetTickFreq, freq, 0U);
 #else
   (void)freq;
@@ -513,7 +520,7 @@ __WEAK void EvrRtxKernelGetTickFreq (uint32_t freq) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_GET_SYS_TIMER_COUNT_DISABLE))
 __WEAK void EvrRtxKernelGetSysTimerCount (uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelGetSysTimerCount, count, 0U);
 #else
   (void)count;
@@ -523,7 +530,7 @@ __WEAK void EvrRtxKernelGetSysTimerCount (uint32_t count) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_GET_SYS_TIMER_FREQ_DISABLE))
 __WEAK void EvrRtxKernelGetSysTimerFreq (uint32_t freq) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxKernelGetSysTimerFreq, freq, 0U);
 #else
   (void)freq;
@@ -536,7 +543,7 @@ __WEAK void EvrRtxKernelGetSysTimerFreq (uint32_t freq) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_ERROR_DISABLE))
 __WEAK void EvrRtxThreadError (osThreadId_t thread_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadError, (uint32_t)thread_id, (uint32_t)status);
 #else
   (void)thread_id;
@@ -547,7 +554,7 @@ __WEAK void EvrRtxThreadError (osThreadId_t thread_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_NEW_DISABLE))
 __WEAK void EvrRtxThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxThreadNew, (uint32_t)func, (uint32_t)argument, (uint32_t)attr, 0U);
 #else
   (void)func;
@@ -559,9 +566,14 @@ __WEAK void EvrRtxThreadNew (osThreadFunc_t func, void *argument, const osThread
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_CREATED_DISABLE))
 __WEAK void EvrRtxThreadCreated (osThreadId_t thread_id, uint32_t thread_addr, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   if (name != NULL) {
+#if (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0))
+    // Name is stored in the trace (target memory is not accessible when decoding)
+    (void)osRtxTraceRecordName(EvtRtxThreadCreated_Name, (uint32_t)thread_id, name);
+#else
     (void)EventRecord2(EvtRtxThreadCreated_Name, (uint32_t)thread_id, (uint32_t)name);
+#endif
   } else {
     (void)EventRecord2(EvtRtxThreadCreated_Addr, (uint32_t)thread_id, thread_addr);
   }
@@ -575,7 +587,7 @@ __WEAK void EvrRtxThreadCreated (osThreadId_t thread_id, uint32_t thread_addr, c
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_NAME_DISABLE))
 __WEAK void EvrRtxThreadGetName (osThreadId_t thread_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetName, (uint32_t)thread_id, (uint32_t)name);
 #else
   (void)thread_id;
@@ -586,7 +598,7 @@ __WEAK void EvrRtxThreadGetName (osThreadId_t thread_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_ID_DISABLE))
 __WEAK void EvrRtxThreadGetId (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetId, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -596,7 +608,7 @@ __WEAK void EvrRtxThreadGetId (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_STATE_DISABLE))
 __WEAK void EvrRtxThreadGetState (osThreadId_t thread_id, osThreadState_t state) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetState, (uint32_t)thread_id, (uint32_t)state);
 #else
   (void)thread_id;
@@ -607,7 +619,7 @@ __WEAK void EvrRtxThreadGetState (osThreadId_t thread_id, osThreadState_t state)
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_STACK_SIZE_DISABLE))
 __WEAK void EvrRtxThreadGetStackSize (osThreadId_t thread_id, uint32_t stack_size) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetStackSize, (uint32_t)thread_id, stack_size);
 #else
   (void)thread_id;
@@ -618,7 +630,7 @@ __WEAK void EvrRtxThreadGetStackSize (osThreadId_t thread_id, uint32_t stack_siz
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_STACK_SPACE_DISABLE))
 __WEAK void EvrRtxThreadGetStackSpace (osThreadId_t thread_id, uint32_t stack_space) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetStackSpace, (uint32_t)thread_id, stack_space);
 #else
   (void)thread_id;
@@ -629,7 +641,7 @@ __WEAK void EvrRtxThreadGetStackSpace (osThreadId_t thread_id, uint32_t stack_sp
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_SET_PRIORITY_DISABLE))
 __WEAK void EvrRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadSetPriority, (uint32_t)thread_id, (uint32_t)priority);
 #else
   (void)thread_id;
@@ -640,7 +652,7 @@ __WEAK void EvrRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t priori
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_PRIORITY_UPDATED_DISABLE))
 __WEAK void EvrRtxThreadPriorityUpdated (osThreadId_t thread_id, osPriority_t priority) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadPriorityUpdated, (uint32_t)thread_id, (uint32_t)priority);
 #else
   (void)thread_id;
@@ -651,7 +663,7 @@ __WEAK void EvrRtxThreadPriorityUpdated (osThreadId_t thread_id, osPriority_t pr
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_PRIORITY_DISABLE))
 __WEAK void EvrRtxThreadGetPriority (osThreadId_t thread_id, osPriority_t priority) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetPriority, (uint32_t)thread_id, (uint32_t)priority);
 #else
   (void)thread_id;
@@ -662,7 +674,7 @@ __WEAK void EvrRtxThreadGetPriority (osThreadId_t thread_id, osPriority_t priori
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_YIELD_DISABLE))
 __WEAK void EvrRtxThreadYield (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadYield, 0U, 0U);
 #else
 #endif
@@ -671,7 +683,7 @@ __WEAK void EvrRtxThreadYield (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_SUSPEND_DISABLE))
 __WEAK void EvrRtxThreadSuspend (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadSuspend, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -681,7 +693,7 @@ __WEAK void EvrRtxThreadSuspend (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_SUSPENDED_DISABLE))
 __WEAK void EvrRtxThreadSuspended (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadSuspended, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -691,7 +703,7 @@ __WEAK void EvrRtxThreadSuspended (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_RESUME_DISABLE))
 __WEAK void EvrRtxThreadResume (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadResume, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -701,7 +713,7 @@ __WEAK void EvrRtxThreadResume (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_RESUMED_DISABLE))
 __WEAK void EvrRtxThreadResumed (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadResumed, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -711,7 +723,7 @@ __WEAK void EvrRtxThreadResumed (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_DETACH_DISABLE))
 __WEAK void EvrRtxThreadDetach (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadDetach, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -721,7 +733,7 @@ __WEAK void EvrRtxThreadDetach (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_DETACHED_DISABLE))
 __WEAK void EvrRtxThreadDetached (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadDetached, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -731,7 +743,7 @@ __WEAK void EvrRtxThreadDetached (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_JOIN_DISABLE))
 __WEAK void EvrRtxThreadJoin (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadJoin, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -741,7 +753,7 @@ __WEAK void EvrRtxThreadJoin (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_JOIN_PENDING_DISABLE))
 __WEAK void EvrRtxThreadJoinPending (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadJoinPending, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -751,7 +763,7 @@ __WEAK void EvrRtxThreadJoinPending (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_JOINED_DISABLE))
 __WEAK void EvrRtxThreadJoined (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadJoined, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -761,7 +773,7 @@ __WEAK void EvrRtxThreadJoined (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_BLOCKED_DISABLE))
 __WEAK void EvrRtxThreadBlocked (osThreadId_t thread_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadBlocked, (uint32_t)thread_id, timeout);
 #else
   (void)thread_id;
@@ -772,7 +784,7 @@ __WEAK void EvrRtxThreadBlocked (osThreadId_t thread_id, uint32_t timeout) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_UNBLOCKED_DISABLE))
 __WEAK void EvrRtxThreadUnblocked (osThreadId_t thread_id, uint32_t ret_val) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadUnblocked, (uint32_t)thread_id, ret_val);
 #else
   (void)thread_id;
@@ -783,7 +795,7 @@ __WEAK void EvrRtxThreadUnblocked (osThreadId_t thread_id, uint32_t ret_val) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_PREEMPTED_DISABLE))
 __WEAK void EvrRtxThreadPreempted (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadPreempted, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -793,7 +805,7 @@ __WEAK void EvrRtxThreadPreempted (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_SWITCHED_DISABLE))
 __WEAK void EvrRtxThreadSwitched (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadSwitched, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -803,7 +815,7 @@ __WEAK void EvrRtxThreadSwitched (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_EXIT_DISABLE))
 __WEAK void EvrRtxThreadExit (void) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadExit, 0U, 0U);
 #else
 #endif
@@ -812,7 +824,7 @@ __WEAK void EvrRtxThreadExit (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_TERMINATE_DISABLE))
 __WEAK void EvrRtxThreadTerminate (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadTerminate, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -822,7 +834,7 @@ __WEAK void EvrRtxThreadTerminate (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_DESTROYED_DISABLE))
 __WEAK void EvrRtxThreadDestroyed (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadDestroyed, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -832,7 +844,7 @@ __WEAK void EvrRtxThreadDestroyed (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_GET_COUNT_DISABLE))
 __WEAK void EvrRtxThreadGetCount (uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadGetCount, count, 0U);
 #else
   (void)count;
@@ -842,7 +854,7 @@ __WEAK void EvrRtxThreadGetCount (uint32_t count) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THREAD != 0) && !defined(EVR_RTX_THREAD_ENUMERATE_DISABLE))
 __WEAK void EvrRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items, uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxThreadEnumerate, (uint32_t)thread_array, array_items, count, 0U);
 #else
   (void)thread_array;
@@ -857,7 +869,7 @@ __WEAK void EvrRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t array_it
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_ERROR_DISABLE))
 __WEAK void EvrRtxThreadFlagsError (osThreadId_t thread_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsError, (uint32_t)thread_id, (uint32_t)status);
 #else
   (void)thread_id;
@@ -868,7 +880,7 @@ __WEAK void EvrRtxThreadFlagsError (osThreadId_t thread_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_SET_DISABLE))
 __WEAK void EvrRtxThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsSet, (uint32_t)thread_id, flags);
 #else
   (void)thread_id;
@@ -879,7 +891,7 @@ __WEAK void EvrRtxThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_SET_DONE_DISABLE))
 __WEAK void EvrRtxThreadFlagsSetDone (osThreadId_t thread_id, uint32_t thread_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsSetDone, (uint32_t)thread_id, thread_flags);
 #else
   (void)thread_id;
@@ -890,7 +902,7 @@ __WEAK void EvrRtxThreadFlagsSetDone (osThreadId_t thread_id, uint32_t thread_fl
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_CLEAR_DISABLE))
 __WEAK void EvrRtxThreadFlagsClear (uint32_t flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsClear, flags, 0U);
 #else
   (void)flags;
@@ -900,7 +912,7 @@ __WEAK void EvrRtxThreadFlagsClear (uint32_t flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_CLEAR_DONE_DISABLE))
 __WEAK void EvrRtxThreadFlagsClearDone (uint32_t thread_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsClearDone, thread_flags, 0U);
 #else
   (void)thread_flags;
@@ -910,7 +922,7 @@ __WEAK void EvrRtxThreadFlagsClearDone (uint32_t thread_flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_GET_DISABLE))
 __WEAK void EvrRtxThreadFlagsGet (uint32_t thread_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsGet, thread_flags, 0U);
 #else
   (void)thread_flags;
@@ -920,7 +932,7 @@ __WEAK void EvrRtxThreadFlagsGet (uint32_t thread_flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_WAIT_DISABLE))
 __WEAK void EvrRtxThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxThreadFlagsWait, flags, options, timeout, 0U);
 #else
   (void)flags;
@@ -932,7 +944,7 @@ __WEAK void EvrRtxThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t ti
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_WAIT_PENDING_DISABLE))
 __WEAK void EvrRtxThreadFlagsWaitPending (uint32_t flags, uint32_t options, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxThreadFlagsWaitPending, flags, options, timeout, 0U);
 #else
   (void)flags;
@@ -944,7 +956,7 @@ __WEAK void EvrRtxThreadFlagsWaitPending (uint32_t flags, uint32_t options, uint
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_WAIT_TIMEOUT_DISABLE))
 __WEAK void EvrRtxThreadFlagsWaitTimeout (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsWaitTimeout, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -954,7 +966,7 @@ __WEAK void EvrRtxThreadFlagsWaitTimeout (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_WAIT_COMPLETED_DISABLE))
 __WEAK void EvrRtxThreadFlagsWaitCompleted (uint32_t flags, uint32_t options, uint32_t thread_flags, osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxThreadFlagsWaitCompleted, flags, options, thread_flags, (uint32_t)thread_id);
 #else
   (void)flags;
@@ -967,7 +979,7 @@ __WEAK void EvrRtxThreadFlagsWaitCompleted (uint32_t flags, uint32_t options, ui
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_THFLAGS != 0) && !defined(EVR_RTX_THREAD_FLAGS_WAIT_NOT_COMPLETED_DISABLE))
 __WEAK void EvrRtxThreadFlagsWaitNotCompleted (uint32_t flags, uint32_t options) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxThreadFlagsWaitNotCompleted, flags, options);
 #else
   (void)flags;
@@ -981,7 +993,7 @@ __WEAK void EvrRtxThreadFlagsWaitNotCompleted (uint32_t flags, uint32_t options)
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_WAIT != 0) && !defined(EVR_RTX_DELAY_ERROR_DISABLE))
 __WEAK void EvrRtxDelayError (int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxDelayError, (uint32_t)status, 0U);
 #else
   (void)status;
@@ -992,7 +1004,7 @@ __WEAK void EvrRtxDelayError (int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_WAIT != 0) && !defined(EVR_RTX_DELAY_DISABLE))
 __WEAK void EvrRtxDelay (uint32_t ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxDelay, ticks, 0U);
 #else
   (void)ticks;
@@ -1002,7 +1014,7 @@ __WEAK void EvrRtxDelay (uint32_t ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_WAIT != 0) && !defined(EVR_RTX_DELAY_UNTIL_DISABLE))
 __WEAK void EvrRtxDelayUntil (uint32_t ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxDelayUntil, ticks, 0U);
 #else
   (void)ticks;
@@ -1012,7 +1024,7 @@ __WEAK void EvrRtxDelayUntil (uint32_t ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_WAIT != 0) && !defined(EVR_RTX_DELAY_STARTED_DISABLE))
 __WEAK void EvrRtxDelayStarted (uint32_t ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxDelayStarted, ticks, 0U);
 #else
   (void)ticks;
@@ -1022,7 +1034,7 @@ __WEAK void EvrRtxDelayStarted (uint32_t ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_WAIT != 0) && !defined(EVR_RTX_DELAY_UNTIL_STARTED_DISABLE))
 __WEAK void EvrRtxDelayUntilStarted (uint32_t ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxDelayUntilStarted, ticks, 0U);
 #else
   (void)ticks;
@@ -1032,7 +1044,7 @@ __WEAK void EvrRtxDelayUntilStarted (uint32_t ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_WAIT != 0) && !defined(EVR_RTX_DELAY_COMPLETED_DISABLE))
 __WEAK void EvrRtxDelayCompleted (osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxDelayCompleted, (uint32_t)thread_id, 0U);
 #else
   (void)thread_id;
@@ -1045,7 +1057,7 @@ __WEAK void EvrRtxDelayCompleted (osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_ERROR_DISABLE))
 __WEAK void EvrRtxTimerError (osTimerId_t timer_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerError, (uint32_t)timer_id, (uint32_t)status);
 #else
   (void)timer_id;
@@ -1056,7 +1068,7 @@ __WEAK void EvrRtxTimerError (osTimerId_t timer_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_CALLBACK_DISABLE))
 __WEAK void EvrRtxTimerCallback (osTimerFunc_t func, void *argument) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerCallback, (uint32_t)func, (uint32_t)argument);
 #else
   (void)func;
@@ -1067,7 +1079,7 @@ __WEAK void EvrRtxTimerCallback (osTimerFunc_t func, void *argument) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_NEW_DISABLE))
 __WEAK void EvrRtxTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument, const osTimerAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxTimerNew, (uint32_t)func, (uint32_t)type, (uint32_t)argument, (uint32_t)attr);
 #else
   (void)func;
@@ -1080,7 +1092,7 @@ __WEAK void EvrRtxTimerNew (osTimerFunc_t func, osTimerType_t type, void *argume
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_CREATED_DISABLE))
 __WEAK void EvrRtxTimerCreated (osTimerId_t timer_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerCreated, (uint32_t)timer_id, (uint32_t)name);
 #else
   (void)timer_id;
@@ -1091,7 +1103,7 @@ __WEAK void EvrRtxTimerCreated (osTimerId_t timer_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_GET_NAME_DISABLE))
 __WEAK void EvrRtxTimerGetName (osTimerId_t timer_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerGetName, (uint32_t)timer_id, (uint32_t)name);
 #else
   (void)timer_id;
@@ -1102,7 +1114,7 @@ __WEAK void EvrRtxTimerGetName (osTimerId_t timer_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_START_DISABLE))
 __WEAK void EvrRtxTimerStart (osTimerId_t timer_id, uint32_t ticks) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerStart, (uint32_t)timer_id, ticks);
 #else
   (void)timer_id;
@@ -1113,7 +1125,7 @@ __WEAK void EvrRtxTimerStart (osTimerId_t timer_id, uint32_t ticks) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_STARTED_DISABLE))
 __WEAK void EvrRtxTimerStarted (osTimerId_t timer_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerStarted, (uint32_t)timer_id, 0U);
 #else
   (void)timer_id;
@@ -1123,7 +1135,7 @@ __WEAK void EvrRtxTimerStarted (osTimerId_t timer_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_STOP_DISABLE))
 __WEAK void EvrRtxTimerStop (osTimerId_t timer_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerStop, (uint32_t)timer_id, 0U);
 #else
   (void)timer_id;
@@ -1133,7 +1145,7 @@ __WEAK void EvrRtxTimerStop (osTimerId_t timer_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_STOPPED_DISABLE))
 __WEAK void EvrRtxTimerStopped (osTimerId_t timer_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerStopped, (uint32_t)timer_id, 0U);
 #else
   (void)timer_id;
@@ -1143,7 +1155,7 @@ __WEAK void EvrRtxTimerStopped (osTimerId_t timer_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_IS_RUNNING_DISABLE))
 __WEAK void EvrRtxTimerIsRunning (osTimerId_t timer_id, uint32_t running) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerIsRunning, (uint32_t)timer_id, running);
 #else
   (void)timer_id;
@@ -1154,7 +1166,7 @@ __WEAK void EvrRtxTimerIsRunning (osTimerId_t timer_id, uint32_t running) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_DELETE_DISABLE))
 __WEAK void EvrRtxTimerDelete (osTimerId_t timer_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerDelete, (uint32_t)timer_id, 0U);
 #else
   (void)timer_id;
@@ -1164,7 +1176,7 @@ __WEAK void EvrRtxTimerDelete (osTimerId_t timer_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_TIMER != 0) && !defined(EVR_RTX_TIMER_DESTROYED_DISABLE))
 __WEAK void EvrRtxTimerDestroyed (osTimerId_t timer_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxTimerDestroyed, (uint32_t)timer_id, 0U);
 #else
   (void)timer_id;
@@ -1177,7 +1189,7 @@ __WEAK void EvrRtxTimerDestroyed (osTimerId_t timer_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_ERROR_DISABLE))
 __WEAK void EvrRtxEventFlagsError (osEventFlagsId_t ef_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsError, (uint32_t)ef_id, (uint32_t)status);
 #else
   (void)ef_id;
@@ -1188,7 +1200,7 @@ __WEAK void EvrRtxEventFlagsError (osEventFlagsId_t ef_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_NEW_DISABLE))
 __WEAK void EvrRtxEventFlagsNew (const osEventFlagsAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsNew, (uint32_t)attr, 0U);
 #else
   (void)attr;
@@ -1198,7 +1210,7 @@ __WEAK void EvrRtxEventFlagsNew (const osEventFlagsAttr_t *attr) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_CREATED_DISABLE))
 __WEAK void EvrRtxEventFlagsCreated (osEventFlagsId_t ef_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsCreated, (uint32_t)ef_id, (uint32_t)name);
 #else
   (void)ef_id;
@@ -1209,7 +1221,7 @@ __WEAK void EvrRtxEventFlagsCreated (osEventFlagsId_t ef_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_GET_NAME_DISABLE))
 __WEAK void EvrRtxEventFlagsGetName (osEventFlagsId_t ef_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsGetName, (uint32_t)ef_id, (uint32_t)name);
 #else
   (void)ef_id;
@@ -1220,7 +1232,7 @@ __WEAK void EvrRtxEventFlagsGetName (osEventFlagsId_t ef_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_SET_DISABLE))
 __WEAK void EvrRtxEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsSet, (uint32_t)ef_id, flags);
 #else
   (void)ef_id;
@@ -1231,7 +1243,7 @@ __WEAK void EvrRtxEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_SET_DONE_DISABLE))
 __WEAK void EvrRtxEventFlagsSetDone (osEventFlagsId_t ef_id, uint32_t event_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsSetDone, (uint32_t)ef_id, event_flags);
 #else
   (void)ef_id;
@@ -1242,7 +1254,7 @@ __WEAK void EvrRtxEventFlagsSetDone (osEventFlagsId_t ef_id, uint32_t event_flag
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_CLEAR_DISABLE))
 __WEAK void EvrRtxEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsClear, (uint32_t)ef_id, flags);
 #else
   (void)ef_id;
@@ -1253,7 +1265,7 @@ __WEAK void EvrRtxEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_CLEAR_DONE_DISABLE))
 __WEAK void EvrRtxEventFlagsClearDone (osEventFlagsId_t ef_id, uint32_t event_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsClearDone, (uint32_t)ef_id, event_flags);
 #else
   (void)ef_id;
@@ -1264,7 +1276,7 @@ __WEAK void EvrRtxEventFlagsClearDone (osEventFlagsId_t ef_id, uint32_t event_fl
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_GET_DISABLE))
 __WEAK void EvrRtxEventFlagsGet (osEventFlagsId_t ef_id, uint32_t event_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsGet, (uint32_t)ef_id, event_flags);
 #else
   (void)ef_id;
@@ -1275,7 +1287,7 @@ __WEAK void EvrRtxEventFlagsGet (osEventFlagsId_t ef_id, uint32_t event_flags) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_WAIT_DISABLE))
 __WEAK void EvrRtxEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxEventFlagsWait, (uint32_t)ef_id, flags, options, timeout);
 #else
   (void)ef_id;
@@ -1288,7 +1300,7 @@ __WEAK void EvrRtxEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_WAIT_PENDING_DISABLE))
 __WEAK void EvrRtxEventFlagsWaitPending (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxEventFlagsWaitPending, (uint32_t)ef_id, flags, options, timeout);
 #else
   (void)ef_id;
@@ -1301,7 +1313,7 @@ __WEAK void EvrRtxEventFlagsWaitPending (osEventFlagsId_t ef_id, uint32_t flags,
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_WAIT_TIMEOUT_DISABLE))
 __WEAK void EvrRtxEventFlagsWaitTimeout (osEventFlagsId_t ef_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsWaitTimeout, (uint32_t)ef_id, 0U);
 #else
   (void)ef_id;
@@ -1311,7 +1323,7 @@ __WEAK void EvrRtxEventFlagsWaitTimeout (osEventFlagsId_t ef_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_WAIT_COMPLETED_DISABLE))
 __WEAK void EvrRtxEventFlagsWaitCompleted (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t event_flags) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxEventFlagsWaitCompleted, (uint32_t)ef_id, flags, options, event_flags);
 #else
   (void)ef_id;
@@ -1324,7 +1336,7 @@ __WEAK void EvrRtxEventFlagsWaitCompleted (osEventFlagsId_t ef_id, uint32_t flag
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_WAIT_NOT_COMPLETED_DISABLE))
 __WEAK void EvrRtxEventFlagsWaitNotCompleted (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxEventFlagsWaitNotCompleted, (uint32_t)ef_id, flags, options, 0U);
 #else
   (void)ef_id;
@@ -1336,7 +1348,7 @@ __WEAK void EvrRtxEventFlagsWaitNotCompleted (osEventFlagsId_t ef_id, uint32_t f
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_DELETE_DISABLE))
 __WEAK void EvrRtxEventFlagsDelete (osEventFlagsId_t ef_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsDelete, (uint32_t)ef_id, 0U);
 #else
   (void)ef_id;
@@ -1346,7 +1358,7 @@ __WEAK void EvrRtxEventFlagsDelete (osEventFlagsId_t ef_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_EVFLAGS != 0) && !defined(EVR_RTX_EVENT_FLAGS_DESTROYED_DISABLE))
 __WEAK void EvrRtxEventFlagsDestroyed (osEventFlagsId_t ef_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxEventFlagsDestroyed, (uint32_t)ef_id, 0U);
 #else
   (void)ef_id;
@@ -1359,7 +1371,7 @@ __WEAK void EvrRtxEventFlagsDestroyed (osEventFlagsId_t ef_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_ERROR_DISABLE))
 __WEAK void EvrRtxMutexError (osMutexId_t mutex_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexError, (uint32_t)mutex_id, (uint32_t)status);
 #else
   (void)mutex_id;
@@ -1370,7 +1382,7 @@ __WEAK void EvrRtxMutexError (osMutexId_t mutex_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_NEW_DISABLE))
 __WEAK void EvrRtxMutexNew (const osMutexAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexNew, (uint32_t)attr, 0U);
 #else
   (void)attr;
@@ -1380,7 +1392,7 @@ __WEAK void EvrRtxMutexNew (const osMutexAttr_t *attr) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_CREATED_DISABLE))
 __WEAK void EvrRtxMutexCreated (osMutexId_t mutex_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexCreated, (uint32_t)mutex_id, (uint32_t)name);
 #else
   (void)mutex_id;
@@ -1391,7 +1403,7 @@ __WEAK void EvrRtxMutexCreated (osMutexId_t mutex_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_GET_NAME_DISABLE))
 __WEAK void EvrRtxMutexGetName (osMutexId_t mutex_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexGetName, (uint32_t)mutex_id, (uint32_t)name);
 #else
   (void)mutex_id;
@@ -1402,7 +1414,7 @@ __WEAK void EvrRtxMutexGetName (osMutexId_t mutex_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_ACQUIRE_DISABLE))
 __WEAK void EvrRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexAcquire, (uint32_t)mutex_id, timeout);
 #else
   (void)mutex_id;
@@ -1413,7 +1425,7 @@ __WEAK void EvrRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_ACQUIRE_PENDING_DISABLE))
 __WEAK void EvrRtxMutexAcquirePending (osMutexId_t mutex_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexAcquirePending, (uint32_t)mutex_id, timeout);
 #else
   (void)mutex_id;
@@ -1424,7 +1436,7 @@ __WEAK void EvrRtxMutexAcquirePending (osMutexId_t mutex_id, uint32_t timeout) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_ACQUIRE_TIMEOUT_DISABLE))
 __WEAK void EvrRtxMutexAcquireTimeout (osMutexId_t mutex_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexAcquireTimeout, (uint32_t)mutex_id, 0U);
 #else
   (void)mutex_id;
@@ -1434,7 +1446,7 @@ __WEAK void EvrRtxMutexAcquireTimeout (osMutexId_t mutex_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_ACQUIRED_DISABLE))
 __WEAK void EvrRtxMutexAcquired (osMutexId_t mutex_id, uint32_t lock) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexAcquired, (uint32_t)mutex_id, lock);
 #else
   (void)mutex_id;
@@ -1445,7 +1457,7 @@ __WEAK void EvrRtxMutexAcquired (osMutexId_t mutex_id, uint32_t lock) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_NOT_ACQUIRED_DISABLE))
 __WEAK void EvrRtxMutexNotAcquired (osMutexId_t mutex_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexNotAcquired, (uint32_t)mutex_id, 0U);
 #else
   (void)mutex_id;
@@ -1455,7 +1467,7 @@ __WEAK void EvrRtxMutexNotAcquired (osMutexId_t mutex_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_RELEASE_DISABLE))
 __WEAK void EvrRtxMutexRelease (osMutexId_t mutex_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexRelease, (uint32_t)mutex_id, 0U);
 #else
   (void)mutex_id;
@@ -1465,7 +1477,7 @@ __WEAK void EvrRtxMutexRelease (osMutexId_t mutex_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_RELEASED_DISABLE))
 __WEAK void EvrRtxMutexReleased (osMutexId_t mutex_id, uint32_t lock) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexReleased, (uint32_t)mutex_id, lock);
 #else
   (void)mutex_id;
@@ -1476,7 +1488,7 @@ __WEAK void EvrRtxMutexReleased (osMutexId_t mutex_id, uint32_t lock) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_GET_OWNER_DISABLE))
 __WEAK void EvrRtxMutexGetOwner (osMutexId_t mutex_id, osThreadId_t thread_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexGetOwner, (uint32_t)mutex_id, (uint32_t)thread_id);
 #else
   (void)mutex_id;
@@ -1487,7 +1499,7 @@ __WEAK void EvrRtxMutexGetOwner (osMutexId_t mutex_id, osThreadId_t thread_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_DELETE_DISABLE))
 __WEAK void EvrRtxMutexDelete (osMutexId_t mutex_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexDelete, (uint32_t)mutex_id, 0U);
 #else
   (void)mutex_id;
@@ -1497,7 +1509,7 @@ __WEAK void EvrRtxMutexDelete (osMutexId_t mutex_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MUTEX != 0) && !defined(EVR_RTX_MUTEX_DESTROYED_DISABLE))
 __WEAK void EvrRtxMutexDestroyed (osMutexId_t mutex_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMutexDestroyed, (uint32_t)mutex_id, 0U);
 #else
   (void)mutex_id;
@@ -1510,7 +1522,7 @@ __WEAK void EvrRtxMutexDestroyed (osMutexId_t mutex_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_ERROR_DISABLE))
 __WEAK void EvrRtxSemaphoreError (osSemaphoreId_t semaphore_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreError, (uint32_t)semaphore_id, (uint32_t)status);
 #else
   (void)semaphore_id;
@@ -1521,7 +1533,7 @@ __WEAK void EvrRtxSemaphoreError (osSemaphoreId_t semaphore_id, int32_t status)
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_NEW_DISABLE))
 __WEAK void EvrRtxSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxSemaphoreNew, max_count, initial_count, (uint32_t)attr, 0U);
 #else
   (void)max_count;
@@ -1533,7 +1545,7 @@ __WEAK void EvrRtxSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_CREATED_DISABLE))
 __WEAK void EvrRtxSemaphoreCreated (osSemaphoreId_t semaphore_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreCreated, (uint32_t)semaphore_id, (uint32_t)name);
 #else
   (void)semaphore_id;
@@ -1544,7 +1556,7 @@ __WEAK void EvrRtxSemaphoreCreated (osSemaphoreId_t semaphore_id, const char *na
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_GET_NAME_DISABLE))
 __WEAK void EvrRtxSemaphoreGetName (osSemaphoreId_t semaphore_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreGetName, (uint32_t)semaphore_id, (uint32_t)name);
 #else
 #endif
@@ -1555,7 +1567,7 @@ __WEAK void EvrRtxSemaphoreGetName (osSemaphoreId_t semaphore_id, const char *na
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_ACQUIRE_DISABLE))
 __WEAK void EvrRtxSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreAcquire, (uint32_t)semaphore_id, timeout);
 #else
   (void)semaphore_id;
@@ -1566,7 +1578,7 @@ __WEAK void EvrRtxSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeo
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_ACQUIRE_PENDING_DISABLE))
 __WEAK void EvrRtxSemaphoreAcquirePending (osSemaphoreId_t semaphore_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreAcquirePending, (uint32_t)semaphore_id, (uint32_t)timeout);
 #else
   (void)semaphore_id;
@@ -1577,7 +1589,7 @@ __WEAK void EvrRtxSemaphoreAcquirePending (osSemaphoreId_t semaphore_id, uint32_
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_ACQUIRE_TIMEOUT_DISABLE))
 __WEAK void EvrRtxSemaphoreAcquireTimeout (osSemaphoreId_t semaphore_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreAcquireTimeout, (uint32_t)semaphore_id, 0U);
 #else
   (void)semaphore_id;
@@ -1587,7 +1599,7 @@ __WEAK void EvrRtxSemaphoreAcquireTimeout (osSemaphoreId_t semaphore_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_ACQUIRED_DISABLE))
 __WEAK void EvrRtxSemaphoreAcquired (osSemaphoreId_t semaphore_id, uint32_t tokens) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreAcquired, (uint32_t)semaphore_id, tokens);
 #else
   (void)semaphore_id;
@@ -1598,7 +1610,7 @@ __WEAK void EvrRtxSemaphoreAcquired (osSemaphoreId_t semaphore_id, uint32_t toke
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_NOT_ACQUIRED_DISABLE))
 __WEAK void EvrRtxSemaphoreNotAcquired (osSemaphoreId_t semaphore_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreNotAcquired, (uint32_t)semaphore_id, 0U);
 #else
   (void)semaphore_id;
@@ -1608,7 +1620,7 @@ __WEAK void EvrRtxSemaphoreNotAcquired (osSemaphoreId_t semaphore_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_RELEASE_DISABLE))
 __WEAK void EvrRtxSemaphoreRelease (osSemaphoreId_t semaphore_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreRelease, (uint32_t)semaphore_id, 0U);
 #else
   (void)semaphore_id;
@@ -1618,7 +1630,7 @@ __WEAK void EvrRtxSemaphoreRelease (osSemaphoreId_t semaphore_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_RELEASED_DISABLE))
 __WEAK void EvrRtxSemaphoreReleased (osSemaphoreId_t semaphore_id, uint32_t tokens) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreReleased, (uint32_t)semaphore_id, tokens);
 #else
   (void)semaphore_id;
@@ -1629,7 +1641,7 @@ __WEAK void EvrRtxSemaphoreReleased (osSemaphoreId_t semaphore_id, uint32_t toke
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_GET_COUNT_DISABLE))
 __WEAK void EvrRtxSemaphoreGetCount (osSemaphoreId_t semaphore_id, uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreGetCount, (uint32_t)semaphore_id, count);
 #else
   (void)semaphore_id;
@@ -1640,7 +1652,7 @@ __WEAK void EvrRtxSemaphoreGetCount (osSemaphoreId_t semaphore_id, uint32_t coun
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_DELETE_DISABLE))
 __WEAK void EvrRtxSemaphoreDelete (osSemaphoreId_t semaphore_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreDelete, (uint32_t)semaphore_id, 0U);
 #else
   (void)semaphore_id;
@@ -1650,7 +1662,7 @@ __WEAK void EvrRtxSemaphoreDelete (osSemaphoreId_t semaphore_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_DESTROYED_DISABLE))
 __WEAK void EvrRtxSemaphoreDestroyed (osSemaphoreId_t semaphore_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxSemaphoreDestroyed, (uint32_t)semaphore_id, 0U);
 #else
   (void)semaphore_id;
@@ -1663,7 +1675,7 @@ __WEAK void EvrRtxSemaphoreDestroyed (osSemaphoreId_t semaphore_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_ERROR_DISABLE))
 __WEAK void EvrRtxMemoryPoolError (osMemoryPoolId_t mp_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolError, (uint32_t)mp_id, (uint32_t)status);
 #else
   (void)mp_id;
@@ -1674,7 +1686,7 @@ __WEAK void EvrRtxMemoryPoolError (osMemoryPoolId_t mp_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_NEW_DISABLE))
 __WEAK void EvrRtxMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMemoryPoolNew, block_count, block_size, (uint32_t)attr, 0U);
 #else
   (void)block_count;
@@ -1686,7 +1698,7 @@ __WEAK void EvrRtxMemoryPoolNew (uint32_t block_count, uint32_t block_size, cons
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_CREATED_DISABLE))
 __WEAK void EvrRtxMemoryPoolCreated (osMemoryPoolId_t mp_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolCreated, (uint32_t)mp_id, (uint32_t)name);
 #else
   (void)mp_id;
@@ -1697,7 +1709,7 @@ __WEAK void EvrRtxMemoryPoolCreated (osMemoryPoolId_t mp_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_GET_NAME_DISABLE))
 __WEAK void EvrRtxMemoryPoolGetName (osMemoryPoolId_t mp_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolGetName, (uint32_t)mp_id, (uint32_t)name);
 #else
   (void)mp_id;
@@ -1708,7 +1720,7 @@ __WEAK void EvrRtxMemoryPoolGetName (osMemoryPoolId_t mp_id, const char *name) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_ALLOC_DISABLE))
 __WEAK void EvrRtxMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolAlloc, (uint32_t)mp_id, timeout);
 #else
   (void)mp_id;
@@ -1719,7 +1731,7 @@ __WEAK void EvrRtxMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_ALLOC_PENDING_DISABLE))
 __WEAK void EvrRtxMemoryPoolAllocPending (osMemoryPoolId_t mp_id, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolAllocPending, (uint32_t)mp_id, timeout);
 #else
   (void)mp_id;
@@ -1730,7 +1742,7 @@ __WEAK void EvrRtxMemoryPoolAllocPending (osMemoryPoolId_t mp_id, uint32_t timeo
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_ALLOC_TIMEOUT_DISABLE))
 __WEAK void EvrRtxMemoryPoolAllocTimeout (osMemoryPoolId_t mp_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolAllocTimeout, (uint32_t)mp_id, 0U);
 #else
   (void)mp_id;
@@ -1740,7 +1752,7 @@ __WEAK void EvrRtxMemoryPoolAllocTimeout (osMemoryPoolId_t mp_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_ALLOCATED_DISABLE))
 __WEAK void EvrRtxMemoryPoolAllocated (osMemoryPoolId_t mp_id, void *block) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolAllocated, (uint32_t)mp_id, (uint32_t)block);
 #else
   (void)mp_id;
@@ -1751,7 +1763,7 @@ __WEAK void EvrRtxMemoryPoolAllocated (osMemoryPoolId_t mp_id, void *block) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_ALLOC_FAILED_DISABLE))
 __WEAK void EvrRtxMemoryPoolAllocFailed (osMemoryPoolId_t mp_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolAllocFailed, (uint32_t)mp_id, 0U);
 #else
   (void)mp_id;
@@ -1761,7 +1773,7 @@ __WEAK void EvrRtxMemoryPoolAllocFailed (osMemoryPoolId_t mp_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_FREE_DISABLE))
 __WEAK void EvrRtxMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolFree, (uint32_t)mp_id, (uint32_t)block);
 #else
   (void)mp_id;
@@ -1772,7 +1784,7 @@ __WEAK void EvrRtxMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_DEALLOCATED_DISABLE))
 __WEAK void EvrRtxMemoryPoolDeallocated (osMemoryPoolId_t mp_id, void *block) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolDeallocated, (uint32_t)mp_id, (uint32_t)block);
 #else
   (void)mp_id;
@@ -1783,7 +1795,7 @@ __WEAK void EvrRtxMemoryPoolDeallocated (osMemoryPoolId_t mp_id, void *block) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_FREE_FAILED_DISABLE))
 __WEAK void EvrRtxMemoryPoolFreeFailed (osMemoryPoolId_t mp_id, void *block) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolFreeFailed, (uint32_t)mp_id, (uint32_t)block);
 #else
   (void)mp_id;
@@ -1794,7 +1806,7 @@ __WEAK void EvrRtxMemoryPoolFreeFailed (osMemoryPoolId_t mp_id, void *block) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_GET_CAPACITY_DISABLE))
 __WEAK void EvrRtxMemoryPoolGetCapacity (osMemoryPoolId_t mp_id, uint32_t capacity) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolGetCapacity, (uint32_t)mp_id, capacity);
 #else
   (void)mp_id;
@@ -1805,7 +1817,7 @@ __WEAK void EvrRtxMemoryPoolGetCapacity (osMemoryPoolId_t mp_id, uint32_t capaci
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_GET_BLOCK_SZIE_DISABLE))
 __WEAK void EvrRtxMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id, uint32_t block_size) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolGetBlockSize, (uint32_t)mp_id, block_size);
 #else
   (void)mp_id;
@@ -1816,7 +1828,7 @@ __WEAK void EvrRtxMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id, uint32_t block
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_GET_COUNT_DISABLE))
 __WEAK void EvrRtxMemoryPoolGetCount (osMemoryPoolId_t mp_id, uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolGetCount, (uint32_t)mp_id, count);
 #else
   (void)mp_id;
@@ -1827,7 +1839,7 @@ __WEAK void EvrRtxMemoryPoolGetCount (osMemoryPoolId_t mp_id, uint32_t count) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_GET_SPACE_DISABLE))
 __WEAK void EvrRtxMemoryPoolGetSpace (osMemoryPoolId_t mp_id, uint32_t space) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolGetSpace, (uint32_t)mp_id, space);
 #else
   (void)mp_id;
@@ -1838,7 +1850,7 @@ __WEAK void EvrRtxMemoryPoolGetSpace (osMemoryPoolId_t mp_id, uint32_t space) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_DELETE_DISABLE))
 __WEAK void EvrRtxMemoryPoolDelete (osMemoryPoolId_t mp_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolDelete, (uint32_t)mp_id, 0U);
 #else
   (void)mp_id;
@@ -1848,7 +1860,7 @@ __WEAK void EvrRtxMemoryPoolDelete (osMemoryPoolId_t mp_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MEMPOOL != 0) && !defined(EVR_RTX_MEMORY_POOL_DESTROYED_DISABLE))
 __WEAK void EvrRtxMemoryPoolDestroyed (osMemoryPoolId_t mp_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMemoryPoolDestroyed, (uint32_t)mp_id, 0U);
 #else
   (void)mp_id;
@@ -1861,7 +1873,7 @@ __WEAK void EvrRtxMemoryPoolDestroyed (osMemoryPoolId_t mp_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_ERROR_DISABLE))
 __WEAK void EvrRtxMessageQueueError (osMessageQueueId_t mq_id, int32_t status) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2 (EvtRtxMessageQueueError, (uint32_t)mq_id, (uint32_t)status);
 #else
   (void)mq_id;
@@ -1872,7 +1884,7 @@ __WEAK void EvrRtxMessageQueueError (osMessageQueueId_t mq_id, int32_t status) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_NEW_DISABLE))
 __WEAK void EvrRtxMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMessageQueueNew, msg_count, msg_size, (uint32_t)attr, 0U);
 #else
   (void)msg_count;
@@ -1884,7 +1896,7 @@ __WEAK void EvrRtxMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_CREATED_DISABLE))
 __WEAK void EvrRtxMessageQueueCreated (osMessageQueueId_t mq_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueCreated, (uint32_t)mq_id, (uint32_t)name);
 #else
   (void)mq_id;
@@ -1895,7 +1907,7 @@ __WEAK void EvrRtxMessageQueueCreated (osMessageQueueId_t mq_id, const char *nam
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_NAME_DISABLE))
 __WEAK void EvrRtxMessageQueueGetName (osMessageQueueId_t mq_id, const char *name) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueGetName, (uint32_t)mq_id, (uint32_t)name);
 #else
   (void)mq_id;
@@ -1906,7 +1918,7 @@ __WEAK void EvrRtxMessageQueueGetName (osMessageQueueId_t mq_id, const char *nam
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_PUT_DISABLE))
 __WEAK void EvrRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMessageQueuePut, (uint32_t)mq_id, (uint32_t)msg_ptr, (uint32_t)msg_prio, timeout);
 #else
   (void)mq_id;
@@ -1919,7 +1931,7 @@ __WEAK void EvrRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_PUT_PENDING_DISABLE))
 __WEAK void EvrRtxMessageQueuePutPending (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMessageQueuePutPending, (uint32_t)mq_id, (uint32_t)msg_ptr, timeout, 0U);
 #else
   (void)mq_id;
@@ -1931,7 +1943,7 @@ __WEAK void EvrRtxMessageQueuePutPending (osMessageQueueId_t mq_id, const void *
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_PUT_TIMEOUT_DISABLE))
 __WEAK void EvrRtxMessageQueuePutTimeout (osMessageQueueId_t mq_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueuePutTimeout, (uint32_t)mq_id, 0U);
 #else
   (void)mq_id;
@@ -1941,7 +1953,7 @@ __WEAK void EvrRtxMessageQueuePutTimeout (osMessageQueueId_t mq_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_INSERT_PENDING_DISABLE))
 __WEAK void EvrRtxMessageQueueInsertPending (osMessageQueueId_t mq_id, const void *msg_ptr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueInsertPending, (uint32_t)mq_id, (uint32_t)msg_ptr);
 #else
   (void)mq_id;
@@ -1952,7 +1964,7 @@ __WEAK void EvrRtxMessageQueueInsertPending (osMessageQueueId_t mq_id, const voi
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_INSERTED_DISABLE))
 __WEAK void EvrRtxMessageQueueInserted (osMessageQueueId_t mq_id, const void *msg_ptr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueInserted, (uint32_t)mq_id, (uint32_t)msg_ptr);
 #else
   (void)mq_id;
@@ -1963,7 +1975,7 @@ __WEAK void EvrRtxMessageQueueInserted (osMessageQueueId_t mq_id, const void *ms
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_NOT_INSERTED_DISABLE))
 __WEAK void EvrRtxMessageQueueNotInserted (osMessageQueueId_t mq_id, const void *msg_ptr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueNotInserted, (uint32_t)mq_id, (uint32_t)msg_ptr);
 #else
   (void)mq_id;
@@ -1974,7 +1986,7 @@ __WEAK void EvrRtxMessageQueueNotInserted (osMessageQueueId_t mq_id, const void
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_DISABLE))
 __WEAK void EvrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMessageQueueGet, (uint32_t)mq_id, (uint32_t)msg_ptr, (uint32_t)msg_prio, timeout);
 #else
   (void)mq_id;
@@ -1987,7 +1999,7 @@ __WEAK void EvrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_PENDING_DISABLE))
 __WEAK void EvrRtxMessageQueueGetPending (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t timeout) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord4(EvtRtxMessageQueueGetPending, (uint32_t)mq_id, (uint32_t)msg_ptr, timeout, 0U);
 #else
   (void)mq_id;
@@ -1999,7 +2011,7 @@ __WEAK void EvrRtxMessageQueueGetPending (osMessageQueueId_t mq_id, void *msg_pt
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_TIMEOUT_DISABLE))
 __WEAK void EvrRtxMessageQueueGetTimeout (osMessageQueueId_t mq_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueGetTimeout, (uint32_t)mq_id, 0U);
 #else
   (void)mq_id;
@@ -2009,7 +2021,7 @@ __WEAK void EvrRtxMessageQueueGetTimeout (osMessageQueueId_t mq_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_RETRIEVED_DISABLE))
 __WEAK void EvrRtxMessageQueueRetrieved (osMessageQueueId_t mq_id, void *msg_ptr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueRetrieved, (uint32_t)mq_id, (uint32_t)msg_ptr);
 #else
   (void)mq_id;
@@ -2020,7 +2032,7 @@ __WEAK void EvrRtxMessageQueueRetrieved (osMessageQueueId_t mq_id, void *msg_ptr
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_NOT_RETRIEVED_DISABLE))
 __WEAK void EvrRtxMessageQueueNotRetrieved (osMessageQueueId_t mq_id, void *msg_ptr) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueNotRetrieved, (uint32_t)mq_id, (uint32_t)msg_ptr);
 #else
   (void)mq_id;
@@ -2031,7 +2043,7 @@ __WEAK void EvrRtxMessageQueueNotRetrieved (osMessageQueueId_t mq_id, void *msg_
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_CAPACITY_DISABLE))
 __WEAK void EvrRtxMessageQueueGetCapacity (osMessageQueueId_t mq_id, uint32_t capacity) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueGetCapacity, (uint32_t)mq_id, capacity);
 #else
   (void)mq_id;
@@ -2042,7 +2054,7 @@ __WEAK void EvrRtxMessageQueueGetCapacity (osMessageQueueId_t mq_id, uint32_t ca
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_MSG_SIZE_DISABLE))
 __WEAK void EvrRtxMessageQueueGetMsgSize (osMessageQueueId_t mq_id, uint32_t msg_size) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueGetMsgSize, (uint32_t)mq_id, msg_size);
 #else
   (void)mq_id;
@@ -2053,7 +2065,7 @@ __WEAK void EvrRtxMessageQueueGetMsgSize (osMessageQueueId_t mq_id, uint32_t msg
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_COUNT_DISABLE))
 __WEAK void EvrRtxMessageQueueGetCount (osMessageQueueId_t mq_id, uint32_t count) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueGetCount, (uint32_t)mq_id, count);
 #else
   (void)mq_id;
@@ -2064,7 +2076,7 @@ __WEAK void EvrRtxMessageQueueGetCount (osMessageQueueId_t mq_id, uint32_t count
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_SPACE_DISABLE))
 __WEAK void EvrRtxMessageQueueGetSpace (osMessageQueueId_t mq_id, uint32_t space) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueGetSpace, (uint32_t)mq_id, space);
 #else
   (void)mq_id;
@@ -2075,7 +2087,7 @@ __WEAK void EvrRtxMessageQueueGetSpace (osMessageQueueId_t mq_id, uint32_t space
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_RESET_DISABLE))
 __WEAK void EvrRtxMessageQueueReset (osMessageQueueId_t mq_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueReset, (uint32_t)mq_id, 0U);
 #else
   (void)mq_id;
@@ -2085,7 +2097,7 @@ __WEAK void EvrRtxMessageQueueReset (osMessageQueueId_t mq_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_RESET_DONE_DISABLE))
 __WEAK void EvrRtxMessageQueueResetDone (osMessageQueueId_t mq_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueResetDone, (uint32_t)mq_id, 0U);
 #else
   (void)mq_id;
@@ -2095,7 +2107,7 @@ __WEAK void EvrRtxMessageQueueResetDone (osMessageQueueId_t mq_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_DELETE_DISABLE))
 __WEAK void EvrRtxMessageQueueDelete (osMessageQueueId_t mq_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueDelete, (uint32_t)mq_id, 0U);
 #else
   (void)mq_id;
@@ -2105,10 +2117,67 @@ __WEAK void EvrRtxMessageQueueDelete (osMessageQueueId_t mq_id) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_MSGQUEUE != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_DESTROYED_DISABLE))
 __WEAK void EvrRtxMessageQueueDestroyed (osMessageQueueId_t mq_id) {
-#if defined(RTE_Compiler_EventRecorder)
+#if defined(EVR_RTX_RECORD)
   (void)EventRecord2(EvtRtxMessageQueueDestroyed, (uint32_t)mq_id, 0U);
 #else
   (void)mq_id;
 #endif
 }
 #endif
+
+
+//  ==== Ring Buffer Events ====
+
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_ERROR_DISABLE))
+__WEAK void EvrRtxRingBufferError (osRtxRingBufferId_t rb_id, int32_t status) {
+#if defined(EVR_RTX_RECORD)
+  (void)EventRecord2(EvtRtxRingBufferError, (uint32_t)rb_id, (uint32_t)status);
+#else
+  (void)rb_id;
+  (void)status;
+#endif
+}
+#endif
+
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_NEW_DISABLE))
+__WEAK void EvrRtxRingBufferNew (uint32_t elem_count, uint32_t elem_size, const osRtxRingBufferAttr_t *attr) {
+#if defined(EVR_RTX_RECORD)
+  (void)EventRecord4(EvtRtxRingBufferNew, elem_count, elem_size, (uint32_t)attr, 0U);
+#else
+  (void)elem_count;
+  (void)elem_size;
+  (void)attr;
+#endif
+}
+#endif
+
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_CREATED_DISABLE))
+__WEAK void EvrRtxRingBufferCreated (osRtxRingBufferId_t rb_id, const char *name) {
+#if defined(EVR_RTX_RECORD)
+  (void)EventRecord2(EvtRtxRingBufferCreated, (uint32_t)rb_id, (uint32_t)name);
+#else
+  (void)rb_id;
+  (void)name;
+#endif
+}
+#endif
+
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_DELETE_DISABLE))
+__WEAK void EvrRtxRingBufferDelete (osRtxRingBufferId_t rb_id) {
+#if defined(EVR_RTX_RECORD)
+  (void)EventRecord2(EvtRtxRingBufferDelete, (uint32_t)rb_id, 0U);
+#else
+  (void)rb_id;
+#endif
+}
+#endif
+
+#if (!defined(EVR_RTX_DISABLE) && (OS_EVR_RINGBUF != 0) && !defined(EVR_RTX_RING_BUFFER_DESTROYED_DISABLE))
+__WEAK void EvrRtxRingBufferDestroyed (osRtxRingBufferId_t rb_id) {
+#if defined(EVR_RTX_RECORD)
+  (void)EventRecord2(EvtRtxRingBufferDestroyed, (uint32_t)rb_id, 0U);
+#else
+  (void)rb_id;
+#endif
+}
+#endif
@@ -97,6 +97,16 @@ static osStatus_t svcRtxKernelInitialize (void) {
 
   osRtxInfo.thread.robin.timeout = osRtxConfig.robin_timeout;
 
+  // Initialize Ready Queue Priority Bitmap
+  if (osRtxConfig.ready_queue != NULL) {
+    memset(osRtxConfig.ready_queue, 0, sizeof(osRtxReadyQueue_t));
+  }
+
+  // Initialize Timer Wheel
+  if (osRtxConfig.timer_wheel != NULL) {
+    memset(osRtxConfig.timer_wheel, 0, sizeof(osRtxTimerWheel_t));
+  }
+
   // Initialize Memory Pools (Variable Block Size)
   if (osRtxMemoryInit(osRtxConfig.mem.common_addr, osRtxConfig.mem.common_size) != 0U) {
     osRtxInfo.mem.common = osRtxConfig.mem.common_addr;
@@ -347,9 +357,8 @@ static int32_t svcRtxKernelRestoreLock (int32_t lock) {
 /// Suspend the RTOS Kernel scheduler.
 /// \note API identical to osKernelSuspend
 static uint32_t svcRtxKernelSuspend (void) {
-  const os_thread_t *thread;
-  const os_timer_t  *timer;
-  uint32_t           delay;
+  uint32_t delay;
+  uint32_t ticks;
 
   if (osRtxInfo.kernel.state != osRtxKernelRunning) {
     EvrRtxKernelError(osRtxErrorKernelNotRunning);
@@ -359,20 +368,13 @@ static uint32_t svcRtxKernelSuspend (void) {
 
   KernelBlock();
 
-  delay = osWaitForever;
-
   // Check Thread Delay list
-  thread = osRtxInfo.thread.delay_list;
-  if (thread != NULL) {
-    delay = thread->delay;
-  }
+  delay = osRtxThreadDelayNext();
 
   // Check Active Timer list
-  timer = osRtxInfo.timer.list;
-  if (timer != NULL) {
-    if (timer->tick < delay) {
-      delay = timer->tick;
-    }
+  ticks = osRtxTimerNext();
+  if (ticks < delay) {
+    delay = ticks;
   }
 
   osRtxInfo.kernel.state = osRtxKernelSuspended;
@@ -385,10 +387,8 @@ static uint32_t svcRtxKernelSuspend (void) {
 /// Resume the RTOS Kernel scheduler.
 /// \note API identical to osKernelResume
 static void svcRtxKernelResume (uint32_t sleep_ticks) {
-  os_thread_t *thread;
-  os_timer_t  *timer;
-  uint32_t     delay;
-  uint32_t     ticks;
+  uint32_t delay;
+  uint32_t ticks;
 
   if (osRtxInfo.kernel.state != osRtxKernelSuspended) {
     EvrRtxKernelResumed();
@@ -399,37 +399,31 @@ static void svcRtxKernelResume (uint32_t sleep_ticks) {
   osRtxInfo.kernel.tick += sleep_ticks;
 
   // Process Thread Delay list
-  thread = osRtxInfo.thread.delay_list;
-  if (thread != NULL) {
-    delay = sleep_ticks;
-    do {
-      if (delay >= thread->delay) {
-        delay -= thread->delay;
-        thread->delay = 1U;
-        osRtxThreadDelayTick();
-        thread = osRtxInfo.thread.delay_list;
-      } else {
-        thread->delay -= delay;
-        delay = 0U;
-      }
-    } while ((thread != NULL) && (delay != 0U));
+  delay = sleep_ticks;
+  while (delay != 0U) {
+    ticks = osRtxThreadDelayNext();
+    if ((ticks == osWaitForever) || (ticks > delay)) {
+      osRtxThreadDelaySkip(delay);
+      delay = 0U;
+    } else {
+      osRtxThreadDelaySkip(ticks - 1U);
+      osRtxThreadDelayTick();
+      delay -= ticks;
+    }
   }
 
   // Process Active Timer list
-  timer = osRtxInfo.timer.list;
-  if (timer != NULL) {
-    ticks = sleep_ticks;
-    do {
-      if (ticks >= timer->tick) {
-        ticks -= timer->tick;
-        timer->tick = 1U;
-        osRtxInfo.timer.tick();
-        timer = osRtxInfo.timer.list;
-      } else {
-        timer->tick -= ticks;
-        ticks = 0U;
-      }
-    } while ((timer != NULL) && (ticks != 0U));
+  delay = sleep_ticks;
+  while (delay != 0U) {
+    ticks = osRtxTimerNext();
+    if ((ticks == osWaitForever) || (ticks > delay)) {
+      osRtxTimerSkip(delay);
+      delay = 0U;
+    } else {
+      osRtxTimerSkip(ticks - 1U);
+      osRtxInfo.timer.tick();
+      delay -= ticks;
+    }
   }
 
   osRtxInfo.kernel.state = osRtxKernelRunning;
@@ -58,6 +58,18 @@ __attribute__((section(".bss.os")));
 static void *os_isr_queue[OS_ISR_FIFO_QUEUE] \
 __attribute__((section(".bss.os")));
 
+// Ready Queue Priority Bitmap
+#if (OS_READY_BITMAP != 0)
+static osRtxReadyQueue_t os_ready_queue \
+__attribute__((section(".bss.os")));
+#endif
+
+// Timer Wheel
+#if (OS_TIMER_WHEEL != 0)
+static osRtxTimerWheel_t os_timer_wheel \
+__attribute__((section(".bss.os")));
+#endif
+
 
 // Thread Configuration
 // ====================
@@ -212,7 +224,7 @@ static osRtxMessageQueue_t os_timer_mq_cb \
 __attribute__((section(".bss.os.msgqueue.cb")));
 
 // Timer Message Queue Data
-static uint32_t os_timer_mq_data[osRtxMessageQueueMemSize(OS_TIMER_CB_QUEUE,8)/4] \
+static uint32_t os_timer_mq_data[osRtxMessageQueueMemSize(OS_TIMER_CB_QUEUE,sizeof(osRtxTimerFinfo_t))/4] \
 __attribute__((section(".bss.os.msgqueue.mem")));
 
 // Timer Message Queue Attributes
@@ -406,7 +418,38 @@ __attribute__((section(".bss.os.msgqueue.mem")));
 #define OS_EVR_MSGQUEUE_LEVEL   (((OS_EVR_MSGQUEUE_FILTER  & 0x80U) != 0U) ? (OS_EVR_MSGQUEUE_FILTER  & 0x0FU) : 0U)
 #endif
 
-#if  defined(RTE_Compiler_EventRecorder)
+// Ring Buffer follows Message Queue recording level in older configurations
+#if !defined(OS_EVR_RINGBUF_LEVEL)
+#define OS_EVR_RINGBUF_LEVEL    OS_EVR_MSGQUEUE_LEVEL
+#endif
+
+#if (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0))
+
+// Trace Recorder Initialize
+__STATIC_INLINE void evr_initialize (void) {
+
+  osRtxTraceDisable(0x0FU, 0x00U, 0xFFU);
+  osRtxTraceEnable(OS_EVR_LEVEL,              0x00U,                0xFFU);
+
+  osRtxTraceEnable(OS_EVR_MEMORY_LEVEL,    EvtRtxMemoryNo,       EvtRtxMemoryNo);
+  osRtxTraceEnable(OS_EVR_KERNEL_LEVEL,    EvtRtxKernelNo,       EvtRtxKernelNo);
+  osRtxTraceEnable(OS_EVR_THREAD_LEVEL,    EvtRtxThreadNo,       EvtRtxThreadNo);
+  osRtxTraceEnable(OS_EVR_WAIT_LEVEL,      EvtRtxWaitNo,         EvtRtxWaitNo);
+  osRtxTraceEnable(OS_EVR_THFLAGS_LEVEL,   EvtRtxThreadFlagsNo,  EvtRtxThreadFlagsNo);
+  osRtxTraceEnable(OS_EVR_EVFLAGS_LEVEL,   EvtRtxEventFlagsNo,   EvtRtxEventFlagsNo);
+  osRtxTraceEnable(OS_EVR_TIMER_LEVEL,     EvtRtxTimerNo,        EvtRtxTimerNo);
+  osRtxTraceEnable(OS_EVR_MUTEX_LEVEL,     EvtRtxMutexNo,        EvtRtxMutexNo);
+  osRtxTraceEnable(OS_EVR_SEMAPHORE_LEVEL, EvtRtxSemaphoreNo,    EvtRtxSemaphoreNo);
+  osRtxTraceEnable(OS_EVR_MEMPOOL_LEVEL,   EvtRtxMemoryPoolNo,   EvtRtxMemoryPoolNo);
+  osRtxTraceEnable(OS_EVR_MSGQUEUE_LEVEL,  EvtRtxMessageQueueNo, EvtRtxMessageQueueNo);
+  osRtxTraceEnable(OS_EVR_RINGBUF_LEVEL,   EvtRtxRingBufferNo,   EvtRtxRingBufferNo);
+
+#if (OS_EVR_START != 0)
+  osRtxTraceStart(osRtxTraceStream);
+#endif
+}
+
+#elif defined(RTE_Compiler_EventRecorder)
 
 // Event Recorder Initialize
 __STATIC_INLINE void evr_initialize (void) {
@@ -424,6 +467,7 @@ __STATIC_INLINE void evr_initialize (void) {
   (void)EventRecorderEnable(OS_EVR_SEMAPHORE_LEVEL, EvtRtxSemaphoreNo,    EvtRtxSemaphoreNo);
   (void)EventRecorderEnable(OS_EVR_MEMPOOL_LEVEL,   EvtRtxMemoryPoolNo,   EvtRtxMemoryPoolNo);
   (void)EventRecorderEnable(OS_EVR_MSGQUEUE_LEVEL,  EvtRtxMessageQueueNo, EvtRtxMessageQueueNo);
+  (void)EventRecorderEnable(OS_EVR_RINGBUF_LEVEL,   EvtRtxRingBufferNo,   EvtRtxRingBufferNo);
 }
 
 #else
@@ -452,6 +496,9 @@ __attribute__((section(".rodata"))) =
 #endif
 #if (OS_STACK_WATERMARK != 0)
   | osRtxConfigStackWatermark
+#endif
+#if (OS_MEM_TLSF != 0)
+  | osRtxConfigMemoryTlsf
 #endif
   ,
   (uint32_t)OS_TICK_FREQ,
@@ -533,11 +580,21 @@ __attribute__((section(".rodata"))) =
 #if ((OS_TIMER_THREAD_STACK_SIZE != 0) && (OS_TIMER_CB_QUEUE != 0))
   &os_timer_thread_attr,
   &os_timer_mq_attr,
-  (uint32_t)OS_TIMER_CB_QUEUE
+  (uint32_t)OS_TIMER_CB_QUEUE,
 #else
   NULL,
   NULL,
-  0U
+  0U,
+#endif
+#if (OS_READY_BITMAP != 0)
+  &os_ready_queue,
+#else
+  NULL,
+#endif
+#if (OS_TIMER_WHEEL != 0)
+  &os_timer_wheel
+#else
+  NULL
 #endif
 };
 
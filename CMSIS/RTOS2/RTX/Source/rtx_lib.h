@@ -52,6 +52,7 @@
 #define os_memory_pool_t    osRtxMemoryPool_t
 #define os_message_t        osRtxMessage_t
 #define os_message_queue_t  osRtxMessageQueue_t
+#define os_ring_buffer_t    osRtxRingBuffer_t
 #define os_object_t         osRtxObject_t
 
 //  ==== Inline functions ====
@@ -91,6 +92,11 @@ __STATIC_INLINE os_message_queue_t *osRtxMessageQueueId (osMessageQueueId_t mq_i
   //lint -e{9079} -e{9087} "cast from pointer to void to pointer to object type" [MISRA Note 2]
   return ((os_message_queue_t *)mq_id);
 }
+// Ring Buffer ID
+__STATIC_INLINE os_ring_buffer_t *osRtxRingBufferId (osRtxRingBufferId_t rb_id) {
+  //lint -e{9079} -e{9087} "cast from pointer to void to pointer to object type" [MISRA Note 2]
+  return ((os_ring_buffer_t *)rb_id);
+}
 
 // Generic Object
 __STATIC_INLINE os_object_t *osRtxObject (void *object) {
@@ -171,6 +177,18 @@ __STATIC_INLINE void osRtxThreadSetRunning (os_thread_t *thread) {
   osRtxInfo.thread.run.curr = thread;
 }
 
+// Timer Wheel Slot of an expiry time (lowest level covering the ticks after the wheel tick)
+__STATIC_INLINE uint32_t osRtxTimerWheelSlot (uint32_t tick, uint32_t time) {
+  uint32_t ticks = time - (tick + 1U);
+  uint32_t level = 0U;
+  while ((level < (osRtxTimerWheelLevels - 1U)) &&
+         ((ticks >> ((level + 1U) * osRtxTimerWheelBits)) != 0U)) {
+    level++;
+  }
+  return ((level * osRtxTimerWheelSize) +
+          ((time >> (level * osRtxTimerWheelBits)) & (osRtxTimerWheelSize - 1U)));
+}
+
 
 //  ==== Library functions ====
 
@@ -180,10 +198,12 @@ extern void         osRtxKernelPreInit (void);
 // Thread Library functions
 extern void         osRtxThreadListPut    (os_object_t *object, os_thread_t *thread);
 extern os_thread_t *osRtxThreadListGet    (os_object_t *object);
-extern void         osRtxThreadListSort   (os_thread_t *thread);
+extern void         osRtxThreadListSort   (os_thread_t *thread, int8_t priority);
 extern void         osRtxThreadListRemove (os_thread_t *thread);
 extern void         osRtxThreadReadyPut   (os_thread_t *thread);
 extern void         osRtxThreadDelayTick  (void);
+extern uint32_t     osRtxThreadDelayNext  (void);
+extern void         osRtxThreadDelaySkip  (uint32_t ticks);
 extern uint32_t    *osRtxThreadRegPtr     (const os_thread_t *thread);
 extern void         osRtxThreadSwitch     (os_thread_t *thread);
 extern void         osRtxThreadDispatch   (os_thread_t *thread);
@@ -193,7 +213,9 @@ extern void         osRtxThreadStackCheck (void);
 extern bool_t       osRtxThreadStartup    (void);
 
 // Timer Library functions
-extern void osRtxTimerThread (void *argument);
+extern uint32_t osRtxTimerNext   (void);
+extern void     osRtxTimerSkip   (uint32_t ticks);
+extern void     osRtxTimerThread (void *argument);
 
 // Mutex Library functions
 extern void osRtxMutexOwnerRelease (os_mutex_t *mutex_list);
@@ -61,6 +61,370 @@ __STATIC_INLINE mem_block_t *MemBlockPtr (void *mem, uint32_t offset) {
 }
 
 
+//  ==== TLSF (Two-Level Segregated Fit) ====
+//
+//  Selected by osRtxConfigMemoryTlsf. Blocks keep the list layout (header with
+//  pointer to the next physical block, first block after the pool header and
+//  a sentinel holding max used Memory at the end) but free blocks are kept in
+//  segregated free lists indexed by a two-level bitmap. The control structure
+//  occupies the last block before the sentinel.
+
+//  Memory Block Info (TLSF): Length = <31:3>:'000', Free = <2>, Previous Free = <1>, Type = <0>
+#define MB_INFO_TLSF_LEN_MASK   0xFFFFFFF8U     // Length mask
+#define MB_INFO_TLSF_FREE       0x00000004U     // Block is free
+#define MB_INFO_TLSF_PREV_FREE  0x00000002U     // Previous physical block is free
+#define MB_INFO_TLSF_TYPE_MASK  0x00000001U     // Type mask
+
+#define TLSF_SL_LOG2            3U              // Second level subdivisions (log2)
+#define TLSF_SL_COUNT           (1UL << TLSF_SL_LOG2)
+#define TLSF_FL_SHIFT           (TLSF_SL_LOG2 + 3U) // Blocks below 64 bytes map to first level 0
+
+//  TLSF Free Block structure
+typedef struct tlsf_free_s {
+  mem_block_t         head;     // Memory Block Header
+  struct tlsf_free_s *next;     // Next free block in list
+  struct tlsf_free_s *prev;     // Previous free block in list
+} tlsf_free_t;
+
+//  TLSF minimum block size (header, free list links and footer)
+#define TLSF_BLOCK_MIN          ((sizeof(tlsf_free_t) + sizeof(mem_block_t *) + 7U) & ~((uint32_t)7U))
+
+//  TLSF Size Class structure
+typedef struct {
+  uint32_t     sl_bitmap;               // Second level bitmap
+  tlsf_free_t *free[TLSF_SL_COUNT];     // Free block lists
+} tlsf_class_t;
+
+//  TLSF Control structure (followed by first level size classes)
+typedef struct {
+  uint32_t     fl_count;        // Number of first level size classes
+  uint32_t     fl_bitmap;       // First level bitmap
+} tlsf_control_t;
+
+//  TLSF Free Block Pointer
+__STATIC_INLINE tlsf_free_t *TlsfFreePtr (mem_block_t *block) {
+  //lint -e{740} -e{826} "Unusual pointer cast" [MISRA Note 8]
+  return ((tlsf_free_t *)block);
+}
+
+//  TLSF Block Length
+__STATIC_INLINE uint32_t TlsfBlockLen (const mem_block_t *block) {
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int" [MISRA Note 8]
+  return ((uint32_t)block->next - (uint32_t)block);
+}
+
+//  TLSF number of first level size classes for a Memory Pool size
+static uint32_t TlsfFlCount (uint32_t size) {
+  uint32_t fl_count;
+
+  // Blocks are always smaller than the Memory Pool
+  if (size <= (1UL << TLSF_FL_SHIFT)) {
+    fl_count = 1U;
+  } else {
+    fl_count = (31U - (uint32_t)__CLZ(size - 1U)) - (TLSF_FL_SHIFT - 2U);
+  }
+
+  return fl_count;
+}
+
+//  TLSF Control block size (including block header) for a Memory Pool size
+static uint32_t TlsfControlSize (uint32_t size) {
+  uint32_t ctrl_size;
+
+  ctrl_size  = sizeof(mem_block_t) + sizeof(tlsf_control_t);
+  ctrl_size += TlsfFlCount(size) * sizeof(tlsf_class_t);
+
+  return ((ctrl_size + 7U) & ~((uint32_t)7U));
+}
+
+//  TLSF Control structure of a Memory Pool
+static tlsf_control_t *TlsfControl (void *mem) {
+  uint32_t     size;
+  mem_block_t *ptr;
+
+  size = (MemHeadPtr(mem))->size;
+  ptr  = MemBlockPtr(mem, (size - sizeof(mem_block_t)) - TlsfControlSize(size));
+  ptr++;
+
+  //lint -e{740} -e{826} "Unusual pointer cast" [MISRA Note 8]
+  return ((tlsf_control_t *)ptr);
+}
+
+//  TLSF Size Class
+__STATIC_INLINE tlsf_class_t *TlsfClass (tlsf_control_t *ctrl, uint32_t fl) {
+  //lint -e{740} -e{826} "Unusual pointer cast" [MISRA Note 8]
+  return (&((tlsf_class_t *)(&ctrl[1]))[fl]);
+}
+
+//  TLSF map block size to first and second level index
+static void TlsfMapping (uint32_t size, uint32_t *fl, uint32_t *sl) {
+  uint32_t n;
+
+  if (size < (1UL << TLSF_FL_SHIFT)) {
+    *fl = 0U;
+    *sl = size >> 3;
+  } else {
+    n   = 31U - (uint32_t)__CLZ(size);
+    *fl = n - (TLSF_FL_SHIFT - 1U);
+    *sl = (size >> (n - TLSF_SL_LOG2)) - TLSF_SL_COUNT;
+  }
+}
+
+//  TLSF insert free block into its size class and mark it free.
+static void TlsfInsert (tlsf_control_t *ctrl, mem_block_t *block) {
+  tlsf_class_t *cls;
+  tlsf_free_t  *ptr;
+  mem_block_t **footer;
+  uint32_t      len, fl, sl;
+
+  len = TlsfBlockLen(block);
+  TlsfMapping(len, &fl, &sl);
+  cls = TlsfClass(ctrl, fl);
+
+  ptr = TlsfFreePtr(block);
+  ptr->head.info = len | MB_INFO_TLSF_FREE;
+  ptr->next = cls->free[sl];
+  ptr->prev = NULL;
+  if (ptr->next != NULL) {
+    ptr->next->prev = ptr;
+  }
+  cls->free[sl]   = ptr;
+  cls->sl_bitmap |= 1UL << sl;
+  ctrl->fl_bitmap |= 1UL << fl;
+
+  // Footer points back to block header (used to merge with next block)
+  //lint -e{740} -e{826} "Unusual pointer cast" [MISRA Note 8]
+  footer = (mem_block_t **)block->next;
+  footer[-1] = block;
+  block->next->info |= MB_INFO_TLSF_PREV_FREE;
+}
+
+//  TLSF remove free block from its size class.
+static void TlsfRemove (tlsf_control_t *ctrl, mem_block_t *block) {
+  tlsf_class_t *cls;
+  tlsf_free_t  *ptr;
+  uint32_t      fl, sl;
+
+  TlsfMapping(TlsfBlockLen(block), &fl, &sl);
+  cls = TlsfClass(ctrl, fl);
+
+  ptr = TlsfFreePtr(block);
+  if (ptr->next != NULL) {
+    ptr->next->prev = ptr->prev;
+  }
+  if (ptr->prev != NULL) {
+    ptr->prev->next = ptr->next;
+  } else {
+    cls->free[sl] = ptr->next;
+    if (ptr->next == NULL) {
+      cls->sl_bitmap &= ~(1UL << sl);
+      if (cls->sl_bitmap == 0U) {
+        ctrl->fl_bitmap &= ~(1UL << fl);
+      }
+    }
+  }
+  block->next->info &= ~MB_INFO_TLSF_PREV_FREE;
+}
+
+//  TLSF find free block of at least specified size.
+static mem_block_t *TlsfFind (tlsf_control_t *ctrl, uint32_t size) {
+  tlsf_class_t *cls;
+  tlsf_free_t  *ptr;
+  uint32_t      search, fl, sl;
+  uint32_t      fl_map, sl_map;
+
+  // Round up to next size class so that any block of the found class fits
+  search = size;
+  if (search >= (1UL << TLSF_FL_SHIFT)) {
+    search += (1UL << ((31U - (uint32_t)__CLZ(search)) - TLSF_SL_LOG2)) - 1U;
+  }
+  TlsfMapping(search, &fl, &sl);
+
+  sl_map = 0U;
+  if (fl < ctrl->fl_count) {
+    sl_map = TlsfClass(ctrl, fl)->sl_bitmap & (0xFFFFFFFFU << sl);
+    if (sl_map == 0U) {
+      fl_map = ctrl->fl_bitmap & (0xFFFFFFFEU << fl);
+      if (fl_map != 0U) {
+        fl = 31U - (uint32_t)__CLZ(fl_map & (0U - fl_map));
+        sl_map = TlsfClass(ctrl, fl)->sl_bitmap;
+      }
+    }
+  }
+
+  if (sl_map != 0U) {
+    sl  = 31U - (uint32_t)__CLZ(sl_map & (0U - sl_map));
+    ptr = TlsfClass(ctrl, fl)->free[sl];
+  } else {
+    // No good fit: check first block of the exact size class
+    ptr = NULL;
+    TlsfMapping(size, &fl, &sl);
+    if (fl < ctrl->fl_count) {
+      cls = TlsfClass(ctrl, fl);
+      if ((cls->free[sl] != NULL) && (TlsfBlockLen(&cls->free[sl]->head) >= size)) {
+        ptr = cls->free[sl];
+      }
+    }
+  }
+
+  return ((ptr != NULL) ? &ptr->head : NULL);
+}
+
+//  TLSF Memory Pool initialization.
+static uint32_t TlsfInit (void *mem, uint32_t size) {
+  tlsf_control_t *ctrl;
+  mem_block_t    *ptr, *ptr_ctrl;
+  uint32_t        ctrl_size, fl;
+
+  ctrl_size = TlsfControlSize(size);
+  if (size < (sizeof(mem_head_t) + TLSF_BLOCK_MIN + ctrl_size + sizeof(mem_block_t))) {
+    EvrRtxMemoryInit(mem, size, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Initialize memory pool header
+  (MemHeadPtr(mem))->size = size;
+  (MemHeadPtr(mem))->used = sizeof(mem_head_t) + ctrl_size + sizeof(mem_block_t);
+
+  // Initialize last block (max used Memory) and control block
+  ptr = MemBlockPtr(mem, size - sizeof(mem_block_t));
+  ptr->next = NULL;
+  ptr->info = (MemHeadPtr(mem))->used;
+  ptr_ctrl = MemBlockPtr(mem, (size - sizeof(mem_block_t)) - ctrl_size);
+  ptr_ctrl->next = ptr;
+  ptr_ctrl->info = ctrl_size;
+
+  ctrl = TlsfControl(mem);
+  ctrl->fl_count  = TlsfFlCount(size);
+  ctrl->fl_bitmap = 0U;
+  for (fl = 0U; fl < ctrl->fl_count; fl++) {
+    (void)memset(TlsfClass(ctrl, fl), 0, sizeof(tlsf_class_t));
+  }
+
+  // Initialize first block (all free Memory)
+  ptr = MemBlockPtr(mem, sizeof(mem_head_t));
+  ptr->next = ptr_ctrl;
+  TlsfInsert(ctrl, ptr);
+
+  EvrRtxMemoryInit(mem, size, 1U);
+
+  return 1U;
+}
+
+//  TLSF Memory Block allocation.
+static void *TlsfAlloc (void *mem, uint32_t size, uint32_t type) {
+  tlsf_control_t *ctrl;
+  mem_block_t    *p, *p_new;
+  uint32_t        block_size;
+
+  if ((type & ~MB_INFO_TLSF_TYPE_MASK) != 0U) {
+    EvrRtxMemoryAlloc(mem, size, type, NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  ctrl = TlsfControl(mem);
+  p    = NULL;
+  if (size < (MemHeadPtr(mem))->size) {
+    // Add block header to size and make sure that block is 8-byte aligned
+    block_size = ((size + sizeof(mem_block_t)) + 7U) & ~((uint32_t)7U);
+    if (block_size < TLSF_BLOCK_MIN) {
+      block_size = TLSF_BLOCK_MIN;
+    }
+    p = TlsfFind(ctrl, block_size);
+  }
+  if (p == NULL) {
+    EvrRtxMemoryAlloc(mem, size, type, NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+  TlsfRemove(ctrl, p);
+
+  // Split off the remainder when large enough for a free block
+  if ((TlsfBlockLen(p) - block_size) >= TLSF_BLOCK_MIN) {
+    p_new = MemBlockPtr(p, block_size);
+    p_new->next = p->next;
+    p->next = p_new;
+    TlsfInsert(ctrl, p_new);
+  } else {
+    block_size = TlsfBlockLen(p);
+  }
+  p->info = block_size | type;
+
+  // Update used memory
+  (MemHeadPtr(mem))->used += block_size;
+
+  // Update max used memory
+  p_new = MemBlockPtr(mem, (MemHeadPtr(mem))->size - sizeof(mem_block_t));
+  if (p_new->info < (MemHeadPtr(mem))->used) {
+    p_new->info = (MemHeadPtr(mem))->used;
+  }
+
+  p_new = MemBlockPtr(p, sizeof(mem_block_t));
+
+  EvrRtxMemoryAlloc(mem, size, type, p_new);
+
+  return p_new;
+}
+
+//  TLSF Memory Block release.
+static uint32_t TlsfFree (void *mem, void *block) {
+  tlsf_control_t *ctrl;
+  mem_block_t    *p, *p_next, *p_ctrl;
+  uint32_t        len;
+
+  ctrl   = TlsfControl(mem);
+  p_ctrl = &((mem_block_t *)(void *)ctrl)[-1];
+
+  // Memory block header
+  p = MemBlockPtr(block, 0U);
+  p--;
+
+  // Check that block header is consistent with an allocated block
+  // (also rejects a repeated release of a block merged into a free block)
+  //lint -e{923} -e{946} -e{9078} "cast from pointer to unsigned int, relational operator applied to pointers" [MISRA Note 8]
+  if ((((uint32_t)block & 7U) != 0U) ||
+      (p < MemBlockPtr(mem, sizeof(mem_head_t))) || (p >= p_ctrl) ||
+      ((p->info & MB_INFO_TLSF_FREE) != 0U) ||
+      (p->next <= p) || (p->next > p_ctrl) ||
+      ((p->info & MB_INFO_TLSF_LEN_MASK) != TlsfBlockLen(p)) ||
+      ((p->next->info & MB_INFO_TLSF_PREV_FREE) != 0U) ||
+      (((p->next->info & MB_INFO_TLSF_FREE) != 0U) &&
+       (((mem_block_t **)p->next->next)[-1] != p->next))) {
+    EvrRtxMemoryFree(mem, block, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Update used memory
+  len = TlsfBlockLen(p);
+  (MemHeadPtr(mem))->used -= len;
+
+  // Merge with previous free block
+  if ((p->info & MB_INFO_TLSF_PREV_FREE) != 0U) {
+    //lint -e{740} -e{826} "Unusual pointer cast" [MISRA Note 8]
+    p_next = ((mem_block_t **)p)[-1];
+    TlsfRemove(ctrl, p_next);
+    p_next->next = p->next;
+    p = p_next;
+  }
+
+  // Merge with next free block
+  p_next = p->next;
+  if ((p_next->info & MB_INFO_TLSF_FREE) != 0U) {
+    TlsfRemove(ctrl, p_next);
+    p->next = p_next->next;
+  }
+
+  TlsfInsert(ctrl, p);
+
+  EvrRtxMemoryFree(mem, block, 1U);
+
+  return 1U;
+}
+
+
 //  ==== Library functions ====
 
 /// Initialize Memory Pool with variable block size.
@@ -80,6 +444,11 @@ __WEAK uint32_t osRtxMemoryInit (void *mem, uint32_t size) {
     return 0U;
   }
 
+  if ((osRtxConfig.flags & osRtxConfigMemoryTlsf) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TlsfInit(mem, size);
+  }
+
   // Initialize memory pool header
   head = MemHeadPtr(mem);
   head->size = size;
@@ -101,6 +470,7 @@ __WEAK uint32_t osRtxMemoryInit (void *mem, uint32_t size) {
 /// \param[in]  mem             pointer to memory pool.
 /// \param[in]  size            size of a memory block in bytes.
 /// \param[in]  type            memory block type: 0 - generic, 1 - control block
+///                             (TLSF allocator accepts only these two types)
 /// \return allocated memory block or NULL in case of no memory is available.
 __WEAK void *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type) {
   mem_block_t *ptr;
@@ -115,6 +485,11 @@ __WEAK void *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type) {
     return NULL;
   }
 
+  if ((osRtxConfig.flags & osRtxConfigMemoryTlsf) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TlsfAlloc(mem, size, type);
+  }
+
   // Add block header to size
   block_size = size + sizeof(mem_block_t);
   // Make sure that block is 8-byte aligned
@@ -182,6 +557,11 @@ __WEAK uint32_t osRtxMemoryFree (void *mem, void *block) {
     return 0U;
   }
 
+  if ((osRtxConfig.flags & osRtxConfigMemoryTlsf) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TlsfFree(mem, block);
+  }
+
   // Memory block header
   ptr = MemBlockPtr(block, 0U);
   ptr--;
@@ -197,7 +197,12 @@ static osMemoryPoolId_t svcRtxMemoryPoolNew (uint32_t block_count, uint32_t bloc
     return NULL;
   }
   b_count =  block_count;
+#if (defined(RTX_HOST) && (RTX_HOST != 0))
+  // Free blocks hold a host pointer
+  b_size  = (block_size + 7U) & ~7UL;
+#else
   b_size  = (block_size + 3U) & ~3UL;
+#endif
   if ((__CLZ(b_count) + __CLZ(b_size)) < 32U) {
     EvrRtxMemoryPoolError(NULL, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
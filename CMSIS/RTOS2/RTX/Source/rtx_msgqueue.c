@@ -33,6 +33,15 @@ __attribute__((section(".data.os.msgqueue.obj"))) =
 { 0U, 0U, 0U };
 #endif
 
+//  Batched ISR calls register a single post ISR processing entry:
+//  - new Messages are chained and the first one is marked with flags = MSG_FLAGS_BATCH_NEW
+//  - taken Messages keep flags = 1 (set again by every MessageQueueGet walk) and are
+//    chained through their (already copied) data, marked in reserved_state; the last
+//    one holds the Message Queue like a single taken Message
+#define MSG_FLAGS_BATCH_NEW     2U      // New Messages chained for post ISR processing
+#define MSG_STATE_SINGLE        0U      // Message taken by an ISR, data holds Message Queue
+#define MSG_STATE_BATCH_NEXT    1U      // Message taken by a batch, data holds next taken Message
+
 
 //  ==== Helper functions ====
 
@@ -155,6 +164,199 @@ static void MessageQueueRemove (os_message_queue_t *mq, const os_message_t *msg)
   }
 }
 
+/// Find the Thread with highest Priority waiting for specified Message Queue operation.
+/// \param[in]  mq              message queue object.
+/// \param[in]  state           thread state (osRtxThreadWaitingMessagePut or osRtxThreadWaitingMessageGet).
+/// \return thread object or NULL.
+static os_thread_t *MessageQueueThreadFind (const os_message_queue_t *mq, uint8_t state) {
+  os_thread_t *thread;
+
+  // Senders and receivers can wait together only while zero-copy Message slots are held
+  thread = mq->thread_list;
+  while ((thread != NULL) && (thread->state != state)) {
+    thread = thread->thread_next;
+  }
+
+  return thread;
+}
+
+/// Get Message object of a zero-copy Message slot.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to Message slot data.
+/// \return message object or NULL when msg_ptr is not a held Message slot.
+static os_message_t *MessageQueueSlot (const os_message_queue_t *mq, const void *msg_ptr) {
+  os_message_t *msg;
+  uint32_t      addr;
+
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  addr = (uint32_t)msg_ptr - sizeof(os_message_t);
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  if ((msg_ptr == NULL) ||
+      (addr <  (uint32_t)mq->mp_info.block_base) ||
+      (addr >= (uint32_t)mq->mp_info.block_lim)  ||
+      (((addr - (uint32_t)mq->mp_info.block_base) % mq->mp_info.block_size) != 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+  msg = (os_message_t *)addr;
+  if ((msg->id != osRtxIdMessage) || (msg->flags != 1U)) {
+    msg = NULL;
+  }
+
+  return msg;
+}
+
+/// Serve waiting Threads: pass a Message to receivers and free Message blocks to senders.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             message object to be sent or NULL.
+/// \param[in]  dispatch        re-dispatch flag.
+static void MessageQueueDispatch (os_message_queue_t *mq, os_message_t *msg, bool_t dispatch) {
+  os_message_t   *msg0;
+  os_thread_t    *thread;
+  const uint32_t *reg;
+  const void     *ptr_src;
+        void     *ptr_dst;
+
+  msg0 = msg;
+  for (;;) {
+    if (msg0 == NULL) {
+      // Check if Thread is waiting to send a Message
+      thread = MessageQueueThreadFind(mq, osRtxThreadWaitingMessagePut);
+      if (thread == NULL) {
+        break;
+      }
+      // Try to allocate memory
+      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+      msg0 = osRtxMemoryPoolAlloc(&mq->mp_info);
+      if (msg0 == NULL) {
+        break;
+      }
+      // Wakeup waiting Thread with highest Priority
+      osRtxThreadListRemove(thread);
+      reg = osRtxThreadRegPtr(thread);
+      msg0->id = osRtxIdMessage;
+      if (reg[2] == 0U) {
+        // Pass Message slot (R2: NULL)
+        msg0->flags    = 1U;
+        msg0->priority = 0U;
+        //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+        osRtxThreadWaitExit(thread, (uint32_t)&msg0[1], dispatch);
+        msg0 = NULL;
+        continue;
+      }
+      osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+      // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
+      //lint -e{923} "cast from unsigned int to pointer"
+      ptr_src = (const void *)reg[2];
+      memcpy(&msg0[1], ptr_src, mq->msg_size);
+      msg0->flags    = 0U;
+      msg0->priority = (uint8_t)reg[3];
+      EvrRtxMessageQueueInserted(mq, ptr_src);
+    }
+
+    // Check if Thread is waiting to receive a Message
+    thread = MessageQueueThreadFind(mq, osRtxThreadWaitingMessageGet);
+    if (thread == NULL) {
+      // Put Message into Queue
+      MessageQueuePut(mq, msg0);
+      msg0 = NULL;
+      continue;
+    }
+    // Wakeup waiting Thread with highest Priority
+    osRtxThreadListRemove(thread);
+    reg = osRtxThreadRegPtr(thread);
+    if (reg[3] != 0U) {
+      //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+      *((uint8_t *)reg[3]) = msg0->priority;
+    }
+    if (reg[2] == 0U) {
+      // Pass Message slot (R2: NULL, R3: uint8_t *msg_prio)
+      msg0->flags = 1U;
+      //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+      osRtxThreadWaitExit(thread, (uint32_t)&msg0[1], dispatch);
+      EvrRtxMessageQueueRetrieved(mq, &msg0[1]);
+    } else {
+      // Copy Message (R2: void *msg_ptr, R3: uint8_t *msg_prio)
+      //lint -e{923} "cast from unsigned int to pointer"
+      ptr_dst = (void *)reg[2];
+      memcpy(ptr_dst, &msg0[1], mq->msg_size);
+      osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+      EvrRtxMessageQueueRetrieved(mq, ptr_dst);
+      // Free memory
+      msg0->id = osRtxIdInvalid;
+      (void)osRtxMemoryPoolFree(&mq->mp_info, msg0);
+    }
+    msg0 = NULL;
+  }
+}
+
+
+/// Put a chain of Messages with the same Priority into Queue (or pass them to waiting Threads).
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             first message object (chained by next).
+/// \param[in]  dispatch        re-dispatch flag.
+static void MessageQueuePutList (os_message_queue_t *mq, os_message_t *msg, bool_t dispatch) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t      primask = __get_PRIMASK();
+#endif
+  os_message_t *last, *prev, *next;
+  uint32_t      count;
+
+  // Pass leading Messages to waiting Threads
+  while ((msg != NULL) && (MessageQueueThreadFind(mq, osRtxThreadWaitingMessageGet) != NULL)) {
+    next = msg->next;
+    MessageQueueDispatch(mq, msg, dispatch);
+    msg = next;
+  }
+  if (msg == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+  // Link chain backwards
+  count = 1U;
+  last  = msg;
+  while (last->next != NULL) {
+    last->next->prev = last;
+    last = last->next;
+    count++;
+  }
+
+  // Insert chain with a single walk (behind Messages with same or higher Priority)
+  prev = mq->msg_last;
+  next = NULL;
+  while ((prev != NULL) && (prev->priority < msg->priority)) {
+    next = prev;
+    prev = prev->prev;
+  }
+  msg->prev  = prev;
+  last->next = next;
+  if (prev != NULL) {
+    prev->next = msg;
+  } else {
+    mq->msg_first = msg;
+  }
+  if (next != NULL) {
+    next->prev = last;
+  } else {
+    mq->msg_last = last;
+  }
+
+#if (EXCLUSIVE_ACCESS == 0)
+  __disable_irq();
+
+  mq->msg_count += count;
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+#else
+  (void)atomic_add32(&mq->msg_count, count);
+#endif
+}
+
 
 //  ==== Post ISR processing ====
 
@@ -163,70 +365,51 @@ static void MessageQueueRemove (os_message_queue_t *mq, const os_message_t *msg)
 static void osRtxMessageQueuePostProcess (os_message_t *msg) {
   os_message_queue_t *mq;
   os_message_t       *msg0;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
+  os_message_t       *next;
   const void         *ptr_src;
-        void         *ptr_dst;
 
-  if (msg->flags != 0U) {
-    // Remove Message
+  if (msg->flags == MSG_FLAGS_BATCH_NEW) {
+    // New Messages (batch)
     //lint -e{9079} -e{9087} "cast between pointers to different object types"
-    mq = *((os_message_queue_t **)(void *)&msg[1]);
-    MessageQueueRemove(mq, msg);
-    // Free memory
-    msg->id = osRtxIdInvalid;
-    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
-    // Check if Thread is waiting to send a Message
-    if (mq->thread_list != NULL) {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg0 = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg0 != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-        // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr_src = (const void *)reg[2];
-        memcpy(&msg0[1], ptr_src, mq->msg_size);
-        // Store Message into Queue
-        msg0->id       = osRtxIdMessage;
-        msg0->flags    = 0U;
-        msg0->priority = (uint8_t)reg[3];
-        MessageQueuePut(mq, msg0);
-        EvrRtxMessageQueueInserted(mq, ptr_src);
-      }
+    mq = (void *)msg->prev;
+    msg->flags = 0U;
+    for (msg0 = msg; msg0 != NULL; msg0 = msg0->next) {
+      EvrRtxMessageQueueInserted(mq, &msg0[1]);
     }
+    // Pass Messages to waiting Threads or put them into Queue
+    MessageQueuePutList(mq, msg, FALSE);
+  } else if (msg->flags != 0U) {
+    // Message Queue is held by the last Message taken (single or batch)
+    msg0 = msg;
+    while (msg0->reserved_state == MSG_STATE_BATCH_NEXT) {
+      //lint -e{9079} -e{9087} "cast between pointers to different object types"
+      msg0 = *((os_message_t **)(void *)&msg0[1]);
+    }
+    //lint -e{9079} -e{9087} "cast between pointers to different object types"
+    mq = *((os_message_queue_t **)(void *)&msg0[1]);
+    // Remove Messages and free memory
+    do {
+      next = NULL;
+      if (msg->reserved_state == MSG_STATE_BATCH_NEXT) {
+        //lint -e{9079} -e{9087} "cast between pointers to different object types"
+        next = *((os_message_t **)(void *)&msg[1]);
+      }
+      MessageQueueRemove(mq, msg);
+      msg->id = osRtxIdInvalid;
+      (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+      msg = next;
+    } while (msg != NULL);
+    // Check if Thread is waiting to send a Message
+    MessageQueueDispatch(mq, NULL, FALSE);
   } else {
     // New Message
     //lint -e{9079} -e{9087} "cast between pointers to different object types"
     mq = (void *)msg->next;
     //lint -e{9087} "cast between pointers to different object types"
     ptr_src = (const void *)msg->prev;
-    // Check if Thread is waiting to receive a Message
-    if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessageGet)) {
-      EvrRtxMessageQueueInserted(mq, ptr_src);
-      // Wakeup waiting Thread with highest Priority
-      thread = osRtxThreadListGet(osRtxObject(mq));
-      osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-      // Copy Message (R2: void *msg_ptr, R3: uint8_t *msg_prio)
-      reg = osRtxThreadRegPtr(thread);
-      //lint -e{923} "cast from unsigned int to pointer"
-      ptr_dst = (void *)reg[2];
-      memcpy(ptr_dst, &msg[1], mq->msg_size);
-      if (reg[3] != 0U) {
-        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
-        *((uint8_t *)reg[3]) = msg->priority;
-      }
-      EvrRtxMessageQueueRetrieved(mq, ptr_dst);
-      // Free memory
-      msg->id = osRtxIdInvalid;
-      (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
-    } else {
-      EvrRtxMessageQueueInserted(mq, ptr_src);
-      MessageQueuePut(mq, msg);
-    }
+    EvrRtxMessageQueueInserted(mq, ptr_src);
+    // Pass Message to waiting Thread or put it into Queue
+    MessageQueueDispatch(mq, msg, FALSE);
   }
 }
 
@@ -250,7 +433,12 @@ static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t ms
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return NULL;
   }
+#if (defined(RTX_HOST) && (RTX_HOST != 0))
+  // Message header holds host pointers
+  block_size = ((msg_size + 7U) & ~7UL) + sizeof(os_message_t);
+#else
   block_size = ((msg_size + 3U) & ~3UL) + sizeof(os_message_t);
+#endif
   if ((__CLZ(msg_count) + __CLZ(block_size)) < 32U) {
     EvrRtxMessageQueueError(NULL, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
@@ -404,11 +592,12 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
     return osErrorParameter;
   }
 
-  // Check if Thread is waiting to receive a Message
-  if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessageGet)) {
+  // Check if Thread is waiting to receive a Message (into its buffer)
+  thread = MessageQueueThreadFind(mq, osRtxThreadWaitingMessageGet);
+  if ((thread != NULL) && ((osRtxThreadRegPtr(thread))[2] != 0U)) {
     EvrRtxMessageQueueInserted(mq, msg_ptr);
     // Wakeup waiting Thread with highest Priority
-    thread = osRtxThreadListGet(osRtxObject(mq));
+    osRtxThreadListRemove(thread);
     osRtxThreadWaitExit(thread, (uint32_t)osOK, TRUE);
     // Copy Message (R2: void *msg_ptr, R3: uint8_t *msg_prio)
     reg = osRtxThreadRegPtr(thread);
@@ -428,12 +617,12 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
     if (msg != NULL) {
       // Copy Message
       memcpy(&msg[1], msg_ptr, mq->msg_size);
-      // Put Message into Queue
+      // Put Message into Queue (or pass it to Thread waiting for a Message slot)
       msg->id       = osRtxIdMessage;
       msg->flags    = 0U;
       msg->priority = msg_prio;
-      MessageQueuePut(mq, msg);
       EvrRtxMessageQueueInserted(mq, msg_ptr);
+      MessageQueueDispatch(mq, msg, TRUE);
       status = osOK;
     } else {
       // No memory available
@@ -468,9 +657,7 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
 static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
   os_message_t       *msg;
-  os_thread_t        *thread;
   uint32_t           *reg;
-  const void         *ptr;
   osStatus_t          status;
 
   // Check parameters
@@ -494,27 +681,7 @@ static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr
     msg->id = osRtxIdInvalid;
     (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
     // Check if Thread is waiting to send a Message
-    if (mq->thread_list != NULL) {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, TRUE);
-        // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr = (const void *)reg[2];
-        memcpy(&msg[1], ptr, mq->msg_size);
-        // Store Message into Queue
-        msg->id       = osRtxIdMessage;
-        msg->flags    = 0U;
-        msg->priority = (uint8_t)reg[3];
-        MessageQueuePut(mq, msg);
-        EvrRtxMessageQueueInserted(mq, ptr);
-      }
-    }
+    MessageQueueDispatch(mq, NULL, TRUE);
     status = osOK;
   } else {
     // No Message available
@@ -543,6 +710,257 @@ static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr
   return status;
 }
 
+/// Allocate a Message slot in a Queue or timeout if no slot is available.
+/// \note API identical to osRtxMessageQueueAlloc
+static void *svcRtxMessageQueueAlloc (osMessageQueueId_t mq_id, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  uint32_t           *reg;
+  void               *ptr;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg != NULL) {
+    // Hold Message slot
+    msg->id       = osRtxIdMessage;
+    msg->flags    = 1U;
+    msg->priority = 0U;
+    ptr = &msg[1];
+  } else {
+    // No memory available
+    if (timeout != 0U) {
+      EvrRtxMessageQueuePutPending(mq, NULL, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessagePut, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+        // Save arguments (R2: NULL - Message slot requested)
+        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+        reg = (uint32_t *)(__get_PSP());
+        reg[2] = 0U;
+        reg[3] = 0U;
+      } else {
+        EvrRtxMessageQueuePutTimeout(mq);
+      }
+    } else {
+      EvrRtxMessageQueueNotInserted(mq, NULL);
+    }
+    ptr = NULL;
+  }
+
+  return ptr;
+}
+
+/// Put a filled Message slot into a Queue.
+/// \note API identical to osRtxMessageQueueCommit
+static osStatus_t svcRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  msg = MessageQueueSlot(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Put Message into Queue or pass it to waiting Thread
+  msg->flags    = 0U;
+  msg->priority = msg_prio;
+  EvrRtxMessageQueueInserted(mq, msg_ptr);
+  MessageQueueDispatch(mq, msg, TRUE);
+
+  return osOK;
+}
+
+/// Get a Message slot from a Queue or timeout if Queue is empty.
+/// \note API identical to osRtxMessageQueueReceive
+static void *svcRtxMessageQueueReceive (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  uint32_t           *reg;
+  void               *ptr;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  // Get Message from Queue (Message slot stays held)
+  msg = MessageQueueGet(mq);
+  if (msg != NULL) {
+    MessageQueueRemove(mq, msg);
+    if (msg_prio != NULL) {
+      *msg_prio = msg->priority;
+    }
+    ptr = &msg[1];
+    EvrRtxMessageQueueRetrieved(mq, ptr);
+  } else {
+    // No Message available
+    if (timeout != 0U) {
+      EvrRtxMessageQueueGetPending(mq, NULL, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageGet, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+        // Save arguments (R2: NULL - Message slot requested, R3: uint8_t *msg_prio)
+        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+        reg = (uint32_t *)(__get_PSP());
+        reg[2] = 0U;
+        //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+        reg[3] = (uint32_t)msg_prio;
+      } else {
+        EvrRtxMessageQueueGetTimeout(mq);
+      }
+    } else {
+      EvrRtxMessageQueueNotRetrieved(mq, NULL);
+    }
+    ptr = NULL;
+  }
+
+  return ptr;
+}
+
+/// Release a received (or unused) Message slot back to a Queue.
+/// \note API identical to osRtxMessageQueueRelease
+static osStatus_t svcRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  msg = MessageQueueSlot(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Free memory
+  msg->id = osRtxIdInvalid;
+  (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+
+  // Check if Thread is waiting to send a Message
+  MessageQueueDispatch(mq, NULL, TRUE);
+
+  return osOK;
+}
+
+/// Put multiple Messages with the same Priority into a Queue (without waiting).
+/// \note API identical to osRtxMessageQueuePutN
+static uint32_t svcRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  os_message_t       *msg_first;
+  os_message_t       *msg_last;
+  const uint8_t      *ptr_src;
+  uint32_t            count;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Allocate and fill Messages
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+  ptr_src   = msg_ptr;
+  msg_first = NULL;
+  msg_last  = NULL;
+  for (count = 0U; count < msg_count; count++) {
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+    msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+    if (msg == NULL) {
+      EvrRtxMessageQueueNotInserted(mq, ptr_src);
+      break;
+    }
+    memcpy(&msg[1], ptr_src, mq->msg_size);
+    msg->id       = osRtxIdMessage;
+    msg->flags    = 0U;
+    msg->priority = msg_prio;
+    msg->next     = NULL;
+    if (msg_last != NULL) {
+      msg_last->next = msg;
+    } else {
+      msg_first = msg;
+    }
+    msg_last = msg;
+    EvrRtxMessageQueueInserted(mq, ptr_src);
+    ptr_src = &ptr_src[mq->msg_size];
+  }
+
+  // Pass Messages to waiting Threads or put them into Queue
+  if (msg_first != NULL) {
+    MessageQueuePutList(mq, msg_first, TRUE);
+  }
+
+  return count;
+}
+
+/// Get multiple Messages from a Queue (without waiting).
+/// \note API identical to osRtxMessageQueueGetN
+static uint32_t svcRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t msg_count) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  uint8_t            *ptr_dst;
+  uint32_t            count;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Get Messages from Queue
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+  ptr_dst = msg_ptr;
+  for (count = 0U; count < msg_count; count++) {
+    msg = MessageQueueGet(mq);
+    if (msg == NULL) {
+      EvrRtxMessageQueueNotRetrieved(mq, ptr_dst);
+      break;
+    }
+    MessageQueueRemove(mq, msg);
+    // Copy Message
+    memcpy(ptr_dst, &msg[1], mq->msg_size);
+    if (msg_prio != NULL) {
+      msg_prio[count] = msg->priority;
+    }
+    EvrRtxMessageQueueRetrieved(mq, ptr_dst);
+    // Free memory
+    msg->id = osRtxIdInvalid;
+    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+    ptr_dst = &ptr_dst[mq->msg_size];
+  }
+
+  // Check if Threads are waiting to send Messages
+  if (count != 0U) {
+    MessageQueueDispatch(mq, NULL, TRUE);
+  }
+
+  return count;
+}
+
 /// Get maximum number of messages in a Message Queue.
 /// \note API identical to osMessageQueueGetCapacity
 static uint32_t svcRtxMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
@@ -606,9 +1024,10 @@ static uint32_t svcRtxMessageQueueGetSpace (osMessageQueueId_t mq_id) {
     return 0U;
   }
 
-  EvrRtxMessageQueueGetSpace(mq, mq->mp_info.max_blocks - mq->msg_count);
+  // Free Message blocks (slots held by Alloc/Receive or pending ISR processing are not available)
+  EvrRtxMessageQueueGetSpace(mq, mq->mp_info.max_blocks - mq->mp_info.used_blocks);
 
-  return (mq->mp_info.max_blocks - mq->msg_count);
+  return (mq->mp_info.max_blocks - mq->mp_info.used_blocks);
 }
 
 /// Reset a Message Queue to initial empty state.
@@ -616,9 +1035,6 @@ static uint32_t svcRtxMessageQueueGetSpace (osMessageQueueId_t mq_id) {
 static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
   os_message_t       *msg;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
-  const void         *ptr;
 
   // Check parameters
   if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
@@ -642,28 +1058,8 @@ static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
   }
 
   // Check if Threads are waiting to send Messages
-  if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessagePut)) {
-    do {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-        // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr = (const void *)reg[2];
-        memcpy(&msg[1], ptr, mq->msg_size);
-        // Store Message into Queue
-        msg->id       = osRtxIdMessage;
-        msg->flags    = 0U;
-        msg->priority = (uint8_t)reg[3];
-        MessageQueuePut(mq, msg);
-        EvrRtxMessageQueueInserted(mq, ptr);
-      }
-    } while ((msg != NULL) && (mq->thread_list != NULL));
+  if (MessageQueueThreadFind(mq, osRtxThreadWaitingMessagePut) != NULL) {
+    MessageQueueDispatch(mq, NULL, FALSE);
     osRtxThreadDispatch(NULL);
   }
 
@@ -689,7 +1085,12 @@ static osStatus_t svcRtxMessageQueueDelete (osMessageQueueId_t mq_id) {
   if (mq->thread_list != NULL) {
     do {
       thread = osRtxThreadListGet(osRtxObject(mq));
-      osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
+      if ((osRtxThreadRegPtr(thread))[2] == 0U) {
+        // Thread waiting for a Message slot (R2: NULL)
+        osRtxThreadWaitExit(thread, 0U, FALSE);
+      } else {
+        osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
+      }
     } while (mq->thread_list != NULL);
     osRtxThreadDispatch(NULL);
   }
@@ -725,6 +1126,12 @@ SVC0_3(MessageQueueNew,         osMessageQueueId_t, uint32_t, uint32_t, const os
 SVC0_1(MessageQueueGetName,     const char *,       osMessageQueueId_t)
 SVC0_4(MessageQueuePut,         osStatus_t,         osMessageQueueId_t, const void *, uint8_t,   uint32_t)
 SVC0_4(MessageQueueGet,         osStatus_t,         osMessageQueueId_t,       void *, uint8_t *, uint32_t)
+SVC0_2(MessageQueueAlloc,       void *,             osMessageQueueId_t, uint32_t)
+SVC0_3(MessageQueueCommit,      osStatus_t,         osMessageQueueId_t, void *, uint8_t)
+SVC0_3(MessageQueueReceive,     void *,             osMessageQueueId_t, uint8_t *, uint32_t)
+SVC0_2(MessageQueueRelease,     osStatus_t,         osMessageQueueId_t, void *)
+SVC0_4(MessageQueuePutN,        uint32_t,           osMessageQueueId_t, const void *, uint32_t,  uint8_t)
+SVC0_4(MessageQueueGetN,        uint32_t,           osMessageQueueId_t,       void *, uint8_t *, uint32_t)
 SVC0_1(MessageQueueGetCapacity, uint32_t,           osMessageQueueId_t)
 SVC0_1(MessageQueueGetMsgSize,  uint32_t,           osMessageQueueId_t)
 SVC0_1(MessageQueueGetCount,    uint32_t,           osMessageQueueId_t)
@@ -801,6 +1208,7 @@ osStatus_t isrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8
       *msg_prio = msg->priority;
     }
     // Register post ISR processing
+    msg->reserved_state = MSG_STATE_SINGLE;
     //lint -e{9079} -e{9087} "cast between pointers to different object types"
     *((os_message_queue_t **)(void *)&msg[1]) = mq;
     osRtxPostProcess(osRtxObject(msg));
@@ -815,6 +1223,187 @@ osStatus_t isrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8
   return status;
 }
 
+/// Allocate a Message slot in a Queue or timeout if no slot is available.
+/// \note API identical to osRtxMessageQueueAlloc
+__STATIC_INLINE
+void *isrRtxMessageQueueAlloc (osMessageQueueId_t mq_id, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  void               *ptr;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (timeout != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg != NULL) {
+    // Hold Message slot
+    msg->id       = osRtxIdMessage;
+    msg->flags    = 1U;
+    msg->priority = 0U;
+    ptr = &msg[1];
+  } else {
+    // No memory available
+    EvrRtxMessageQueueNotInserted(mq, NULL);
+    ptr = NULL;
+  }
+
+  return ptr;
+}
+
+/// Put a filled Message slot into a Queue.
+/// \note API identical to osRtxMessageQueueCommit
+__STATIC_INLINE
+osStatus_t isrRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  msg = MessageQueueSlot(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  msg->flags    = 0U;
+  msg->priority = msg_prio;
+  // Register post ISR processing
+  //lint -e{9079} -e{9087} "cast between pointers to different object types"
+  *((const void **)(void *)&msg->prev) = msg_ptr;
+  //lint -e{9079} -e{9087} "cast between pointers to different object types"
+  *(      (void **)        &msg->next) = mq;
+  osRtxPostProcess(osRtxObject(msg));
+  EvrRtxMessageQueueInsertPending(mq, msg_ptr);
+
+  return osOK;
+}
+
+
+/// Put multiple Messages with the same Priority into a Queue (without waiting).
+/// \note API identical to osRtxMessageQueuePutN
+__STATIC_INLINE
+uint32_t isrRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  os_message_t       *msg_first;
+  os_message_t       *msg_last;
+  const uint8_t      *ptr_src;
+  uint32_t            count;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Allocate and fill Messages
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+  ptr_src   = msg_ptr;
+  msg_first = NULL;
+  msg_last  = NULL;
+  for (count = 0U; count < msg_count; count++) {
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+    msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+    if (msg == NULL) {
+      EvrRtxMessageQueueNotInserted(mq, ptr_src);
+      break;
+    }
+    memcpy(&msg[1], ptr_src, mq->msg_size);
+    msg->id       = osRtxIdMessage;
+    msg->flags    = 0U;
+    msg->priority = msg_prio;
+    msg->next     = NULL;
+    if (msg_last != NULL) {
+      msg_last->next = msg;
+    } else {
+      msg_first = msg;
+    }
+    msg_last = msg;
+    EvrRtxMessageQueueInsertPending(mq, ptr_src);
+    ptr_src = &ptr_src[mq->msg_size];
+  }
+
+  // Register post ISR processing (single entry for the whole chain)
+  if (msg_first != NULL) {
+    msg_first->flags = MSG_FLAGS_BATCH_NEW;
+    //lint -e{9079} -e{9087} "cast between pointers to different object types"
+    *((void **)(void *)&msg_first->prev) = mq;
+    osRtxPostProcess(osRtxObject(msg_first));
+  }
+
+  return count;
+}
+
+/// Get multiple Messages from a Queue (without waiting).
+/// \note API identical to osRtxMessageQueueGetN
+__STATIC_INLINE
+uint32_t isrRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t msg_count) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  os_message_t       *msg_first;
+  os_message_t       *msg_last;
+  uint8_t            *ptr_dst;
+  uint32_t            count;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Get Messages from Queue
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+  ptr_dst   = msg_ptr;
+  msg_first = NULL;
+  msg_last  = NULL;
+  for (count = 0U; count < msg_count; count++) {
+    msg = MessageQueueGet(mq);
+    if (msg == NULL) {
+      EvrRtxMessageQueueNotRetrieved(mq, ptr_dst);
+      break;
+    }
+    // Copy Message
+    memcpy(ptr_dst, &msg[1], mq->msg_size);
+    if (msg_prio != NULL) {
+      msg_prio[count] = msg->priority;
+    }
+    EvrRtxMessageQueueRetrieved(mq, ptr_dst);
+    // Chain Message behind the previous one taken (removed together with the first one)
+    msg->reserved_state = MSG_STATE_SINGLE;
+    if (msg_last != NULL) {
+      msg_last->reserved_state = MSG_STATE_BATCH_NEXT;
+      //lint -e{9079} -e{9087} "cast between pointers to different object types"
+      *((os_message_t **)(void *)&msg_last[1]) = msg;
+    } else {
+      msg_first = msg;
+    }
+    msg_last = msg;
+    ptr_dst = &ptr_dst[mq->msg_size];
+  }
+
+  // Register post ISR processing (single entry for the whole batch)
+  if (msg_first != NULL) {
+    //lint -e{9079} -e{9087} "cast between pointers to different object types"
+    *((os_message_queue_t **)(void *)&msg_last[1]) = mq;
+    osRtxPostProcess(osRtxObject(msg_first));
+  }
+
+  return count;
+}
+
 
 //  ==== Public API ====
 
@@ -946,3 +1535,82 @@ osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
   }
   return status;
 }
+
+/// Allocate a Message slot in a Queue or timeout if no slot is available.
+void *osRtxMessageQueueAlloc (osMessageQueueId_t mq_id, uint32_t timeout) {
+  void *msg_ptr;
+
+  EvrRtxMessageQueuePut(mq_id, NULL, 0U, timeout);
+  if (IsIrqMode() || IsIrqMasked()) {
+    msg_ptr = isrRtxMessageQueueAlloc(mq_id, timeout);
+  } else {
+    msg_ptr =  __svcMessageQueueAlloc(mq_id, timeout);
+  }
+  return msg_ptr;
+}
+
+/// Put a filled Message slot into a Queue.
+osStatus_t osRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  osStatus_t status;
+
+  EvrRtxMessageQueuePut(mq_id, msg_ptr, msg_prio, 0U);
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrRtxMessageQueueCommit(mq_id, msg_ptr, msg_prio);
+  } else {
+    status =  __svcMessageQueueCommit(mq_id, msg_ptr, msg_prio);
+  }
+  return status;
+}
+
+/// Get a Message slot from a Queue or timeout if Queue is empty.
+void *osRtxMessageQueueReceive (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout) {
+  void *msg_ptr;
+
+  EvrRtxMessageQueueGet(mq_id, NULL, msg_prio, timeout);
+  if (IsIrqMode() || IsIrqMasked()) {
+    EvrRtxMessageQueueError(mq_id, (int32_t)osErrorISR);
+    msg_ptr = NULL;
+  } else {
+    msg_ptr = __svcMessageQueueReceive(mq_id, msg_prio, timeout);
+  }
+  return msg_ptr;
+}
+
+/// Release a received (or unused) Message slot back to a Queue.
+osStatus_t osRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    EvrRtxMessageQueueError(mq_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcMessageQueueRelease(mq_id, msg_ptr);
+  }
+  return status;
+}
+
+/// Put multiple Messages with the same Priority into a Queue (without waiting).
+uint32_t osRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio) {
+  uint32_t count;
+
+  EvrRtxMessageQueuePut(mq_id, msg_ptr, msg_prio, 0U);
+  if (IsIrqMode() || IsIrqMasked()) {
+    count = isrRtxMessageQueuePutN(mq_id, msg_ptr, msg_count, msg_prio);
+  } else {
+    count =  __svcMessageQueuePutN(mq_id, msg_ptr, msg_count, msg_prio);
+  }
+  return count;
+}
+
+/// Get multiple Messages from a Queue (without waiting).
+uint32_t osRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t msg_count) {
+  uint32_t count;
+
+  EvrRtxMessageQueueGet(mq_id, msg_ptr, msg_prio, 0U);
+  if (IsIrqMode() || IsIrqMasked()) {
+    count = isrRtxMessageQueueGetN(mq_id, msg_ptr, msg_prio, msg_count);
+  } else {
+    count =  __svcMessageQueueGetN(mq_id, msg_ptr, msg_prio, msg_count);
+  }
+  return count;
+}
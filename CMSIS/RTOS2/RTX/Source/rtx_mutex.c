@@ -101,8 +101,7 @@ void osRtxMutexOwnerRestore (const os_mutex_t *mutex, const os_thread_t *thread_
       mutex0 = mutex0->owner_next;
     } while (mutex0 != NULL);
     if (thread->priority != priority) {
-      thread->priority = priority;
-      osRtxThreadListSort(thread);
+      osRtxThreadListSort(thread, priority);
     }
   }
 }
@@ -259,8 +258,7 @@ static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
         if ((mutex->attr & osMutexPrioInherit) != 0U) {
           // Raise priority of owner Thread if lower than priority of running Thread
           if (mutex->owner_thread->priority < thread->priority) {
-            mutex->owner_thread->priority = thread->priority;
-            osRtxThreadListSort(mutex->owner_thread);
+            osRtxThreadListSort(mutex->owner_thread, thread->priority);
           }
         }
         EvrRtxMutexAcquirePending(mutex, timeout);
@@ -440,8 +438,7 @@ static osStatus_t svcRtxMutexDelete (osMutexId_t mutex_id) {
         mutex0 = mutex0->owner_next;
       }
       if (thread->priority != priority) {
-        thread->priority = priority;
-        osRtxThreadListSort(thread);
+        osRtxThreadListSort(thread, priority);
       }
     }
 
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Ring Buffer functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtx_lib.h"
+
+
+//  ==== Helper functions ====
+
+// Ring Buffer indices run over [0..2*elem_count-1] so that a full buffer
+// (head - tail == elem_count) can be told apart from an empty one without
+// a separate counter. Head is written only by the producer and tail only by
+// the consumer, therefore no exclusive access or kernel lock is required.
+
+/// Verify that Ring Buffer object pointer is valid.
+/// \param[in]  rb              ring buffer object.
+/// \return true - valid, false - invalid.
+static bool_t RingBufferValid (const os_ring_buffer_t *rb) {
+  return ((rb != NULL) && (rb->id == osRtxIdRingBuffer));
+}
+
+/// Get number of Elements between two Ring Buffer indices.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  head            write index.
+/// \param[in]  tail            read index.
+/// \return number of elements.
+static uint32_t RingBufferUsed (const os_ring_buffer_t *rb, uint32_t head, uint32_t tail) {
+  uint32_t used;
+
+  if (head >= tail) {
+    used = head - tail;
+  } else {
+    used = (head + (2U * rb->elem_count)) - tail;
+  }
+  return used;
+}
+
+/// Advance a Ring Buffer index.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  index           current index.
+/// \param[in]  count           number of elements.
+/// \return new index.
+static uint32_t RingBufferAdvance (const os_ring_buffer_t *rb, uint32_t index, uint32_t count) {
+
+  index += count;
+  if (index >= (2U * rb->elem_count)) {
+    index -= 2U * rb->elem_count;
+  }
+  return index;
+}
+
+/// Get Element offset in storage for a Ring Buffer index.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  index           ring buffer index.
+/// \return element position [0..elem_count-1].
+static uint32_t RingBufferPos (const os_ring_buffer_t *rb, uint32_t index) {
+
+  if (index >= rb->elem_count) {
+    index -= rb->elem_count;
+  }
+  return index;
+}
+
+
+//  ==== Service Calls ====
+
+/// Create and Initialize a Ring Buffer object.
+/// \note API identical to osRtxRingBufferNew
+static osRtxRingBufferId_t svcRtxRingBufferNew (uint32_t elem_count, uint32_t elem_size, const osRtxRingBufferAttr_t *attr) {
+  os_ring_buffer_t *rb;
+  void             *rb_mem;
+  uint32_t          rb_size;
+  uint32_t          size;
+  uint8_t           flags;
+  const char       *name;
+  osEventFlagsId_t  ef_id;
+  uint32_t          ef_flags;
+  uint32_t          threshold;
+
+  // Check parameters
+  if ((elem_count == 0U) || (elem_size == 0U) || (elem_count > 0x7FFFFFFFU)) {
+    EvrRtxRingBufferError(NULL, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+  if ((__CLZ(elem_count) + __CLZ(elem_size)) < 32U) {
+    EvrRtxRingBufferError(NULL, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  size = elem_count * elem_size;
+
+  // Process attributes
+  if (attr != NULL) {
+    name      = attr->name;
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+    rb        = attr->cb_mem;
+    rb_mem    = attr->rb_mem;
+    rb_size   = attr->rb_size;
+    ef_id     = attr->ef_id;
+    ef_flags  = attr->ef_flags;
+    threshold = attr->threshold;
+    if (rb != NULL) {
+      //lint -e(923) -e(9078) "cast from pointer to unsigned int" [MISRA Note 7]
+      if ((((uint32_t)rb & 3U) != 0U) || (attr->cb_size < sizeof(os_ring_buffer_t))) {
+        EvrRtxRingBufferError(NULL, osRtxErrorInvalidControlBlock);
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return NULL;
+      }
+    } else {
+      if (attr->cb_size != 0U) {
+        EvrRtxRingBufferError(NULL, osRtxErrorInvalidControlBlock);
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return NULL;
+      }
+    }
+    if (rb_mem != NULL) {
+      if (rb_size < size) {
+        EvrRtxRingBufferError(NULL, osRtxErrorInvalidDataMemory);
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return NULL;
+      }
+    } else {
+      if (rb_size != 0U) {
+        EvrRtxRingBufferError(NULL, osRtxErrorInvalidDataMemory);
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return NULL;
+      }
+    }
+    if (ef_id != NULL) {
+      if ((osRtxEventFlagsId(ef_id)->id != osRtxIdEventFlags) ||
+          (ef_flags == 0U) || ((ef_flags & ~(((uint32_t)1U << osRtxEventFlagsLimit) - 1U)) != 0U) ||
+          (threshold > elem_count)) {
+        EvrRtxRingBufferError(NULL, (int32_t)osErrorParameter);
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return NULL;
+      }
+      if (threshold == 0U) {
+        threshold = 1U;
+      }
+    }
+  } else {
+    name      = NULL;
+    rb        = NULL;
+    rb_mem    = NULL;
+    ef_id     = NULL;
+    ef_flags  = 0U;
+    threshold = 0U;
+  }
+
+  // Allocate object memory if not provided
+  if (rb == NULL) {
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+    rb = osRtxMemoryAlloc(osRtxInfo.mem.common, sizeof(os_ring_buffer_t), 1U);
+    flags = osRtxFlagSystemObject;
+  } else {
+    flags = 0U;
+  }
+
+  // Allocate data memory if not provided
+  if ((rb != NULL) && (rb_mem == NULL)) {
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+    rb_mem = osRtxMemoryAlloc(osRtxInfo.mem.common, size, 0U);
+    if (rb_mem == NULL) {
+      if ((flags & osRtxFlagSystemObject) != 0U) {
+        (void)osRtxMemoryFree(osRtxInfo.mem.common, rb);
+      }
+      rb = NULL;
+    }
+    flags |= osRtxFlagSystemMemory;
+  }
+
+  if (rb != NULL) {
+    // Initialize control block
+    rb->id         = osRtxIdRingBuffer;
+    rb->flags      = flags;
+    rb->name       = name;
+    rb->elem_count = elem_count;
+    rb->elem_size  = elem_size;
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+    rb->data       = rb_mem;
+    rb->head       = 0U;
+    rb->tail       = 0U;
+    rb->ef_id      = ef_id;
+    rb->ef_flags   = ef_flags;
+    rb->threshold  = threshold;
+
+    EvrRtxRingBufferCreated(rb, rb->name);
+  } else {
+    EvrRtxRingBufferError(NULL, (int32_t)osErrorNoMemory);
+  }
+
+  return rb;
+}
+
+/// Delete a Ring Buffer object.
+/// \note API identical to osRtxRingBufferDelete
+static osStatus_t svcRtxRingBufferDelete (osRtxRingBufferId_t rb_id) {
+  os_ring_buffer_t *rb = osRtxRingBufferId(rb_id);
+
+  // Check parameters
+  if (!RingBufferValid(rb)) {
+    EvrRtxRingBufferError(rb, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Mark object as invalid
+  rb->id = osRtxIdInvalid;
+
+  // Free data memory
+  if ((rb->flags & osRtxFlagSystemMemory) != 0U) {
+    (void)osRtxMemoryFree(osRtxInfo.mem.common, rb->data);
+  }
+
+  // Free object memory
+  if ((rb->flags & osRtxFlagSystemObject) != 0U) {
+    (void)osRtxMemoryFree(osRtxInfo.mem.common, rb);
+  }
+
+  EvrRtxRingBufferDestroyed(rb);
+
+  return osOK;
+}
+
+//  Service Calls definitions
+//lint ++flb "Library Begin" [MISRA Note 11]
+SVC0_3(RingBufferNew,    osRtxRingBufferId_t, uint32_t, uint32_t, const osRtxRingBufferAttr_t *)
+SVC0_1(RingBufferDelete, osStatus_t,          osRtxRingBufferId_t)
+//lint --flb "Library End"
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Ring Buffer object.
+osRtxRingBufferId_t osRtxRingBufferNew (uint32_t elem_count, uint32_t elem_size, const osRtxRingBufferAttr_t *attr) {
+  osRtxRingBufferId_t rb_id;
+
+  EvrRtxRingBufferNew(elem_count, elem_size, attr);
+  if (IsIrqMode() || IsIrqMasked()) {
+    EvrRtxRingBufferError(NULL, (int32_t)osErrorISR);
+    rb_id = NULL;
+  } else {
+    rb_id = __svcRingBufferNew(elem_count, elem_size, attr);
+  }
+  return rb_id;
+}
+
+/// Delete a Ring Buffer object.
+osStatus_t osRtxRingBufferDelete (osRtxRingBufferId_t rb_id) {
+  osStatus_t status;
+
+  EvrRtxRingBufferDelete(rb_id);
+  if (IsIrqMode() || IsIrqMasked()) {
+    EvrRtxRingBufferError(rb_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcRingBufferDelete(rb_id);
+  }
+  return status;
+}
+
+/// Write Elements into a Ring Buffer (producer side, Thread or ISR).
+uint32_t osRtxRingBufferWrite (osRtxRingBufferId_t rb_id, const void *data, uint32_t count) {
+  os_ring_buffer_t *rb = osRtxRingBufferId(rb_id);
+  const uint8_t    *src;
+  uint32_t          head;
+  uint32_t          used;
+  uint32_t          pos;
+  uint32_t          n;
+
+  // Check parameters
+  if (!RingBufferValid(rb) || (data == NULL) || (count == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  head = rb->head;
+  used = RingBufferUsed(rb, head, rb->tail);
+  if (count > (rb->elem_count - used)) {
+    count = rb->elem_count - used;
+  }
+  if (count == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Copy Elements (wrap-around splits the copy in two)
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+  src = data;
+  pos = RingBufferPos(rb, head);
+  n   = rb->elem_count - pos;
+  if (n > count) {
+    n = count;
+  }
+  memcpy(&rb->data[pos * rb->elem_size], src, n * rb->elem_size);
+  if (n < count) {
+    memcpy(&rb->data[0], &src[n * rb->elem_size], (count - n) * rb->elem_size);
+  }
+
+  // Publish Elements to consumer
+  __DMB();
+  rb->head = RingBufferAdvance(rb, head, count);
+
+  // Wakeup consumer when fill level reaches threshold
+  if ((rb->ef_id != NULL) && (used < rb->threshold) && ((used + count) >= rb->threshold)) {
+    (void)osEventFlagsSet(rb->ef_id, rb->ef_flags);
+  }
+
+  return count;
+}
+
+/// Read Elements from a Ring Buffer (consumer side, Thread or ISR).
+uint32_t osRtxRingBufferRead (osRtxRingBufferId_t rb_id, void *data, uint32_t count) {
+  os_ring_buffer_t *rb = osRtxRingBufferId(rb_id);
+  uint8_t          *dst;
+  uint32_t          tail;
+  uint32_t          used;
+  uint32_t          pos;
+  uint32_t          n;
+
+  // Check parameters
+  if (!RingBufferValid(rb) || (data == NULL) || (count == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  tail = rb->tail;
+  used = RingBufferUsed(rb, rb->head, tail);
+  if (count > used) {
+    count = used;
+  }
+  if (count == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Elements must not be read before the head index that published them
+  __DMB();
+
+  // Copy Elements (wrap-around splits the copy in two)
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
+  dst = data;
+  pos = RingBufferPos(rb, tail);
+  n   = rb->elem_count - pos;
+  if (n > count) {
+    n = count;
+  }
+  memcpy(dst, &rb->data[pos * rb->elem_size], n * rb->elem_size);
+  if (n < count) {
+    memcpy(&dst[n * rb->elem_size], &rb->data[0], (count - n) * rb->elem_size);
+  }
+
+  // Release storage to producer
+  __DMB();
+  rb->tail = RingBufferAdvance(rb, tail, count);
+
+  return count;
+}
+
+/// Get number of Elements stored in a Ring Buffer.
+uint32_t osRtxRingBufferGetCount (osRtxRingBufferId_t rb_id) {
+  const os_ring_buffer_t *rb = osRtxRingBufferId(rb_id);
+  uint32_t                count;
+
+  if (RingBufferValid(rb)) {
+    count = RingBufferUsed(rb, rb->head, rb->tail);
+  } else {
+    count = 0U;
+  }
+  return count;
+}
+
+/// Get number of free Element slots in a Ring Buffer.
+uint32_t osRtxRingBufferGetSpace (osRtxRingBufferId_t rb_id) {
+  const os_ring_buffer_t *rb = osRtxRingBufferId(rb_id);
+  uint32_t                space;
+
+  if (RingBufferValid(rb)) {
+    space = rb->elem_count - RingBufferUsed(rb, rb->head, rb->tail);
+  } else {
+    space = 0U;
+  }
+  return space;
+}
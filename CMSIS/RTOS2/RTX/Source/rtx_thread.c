@@ -133,30 +133,183 @@ static uint32_t ThreadFlagsCheck (os_thread_t *thread, uint32_t flags, uint32_t
   return thread_flags;
 }
 
+/// Get last Ready Thread with a higher priority than specified (Ready Queue Priority Bitmap).
+/// \param[in]  queue           ready queue.
+/// \param[in]  priority        thread priority.
+/// \return thread object or ready list object (when no higher priority thread is ready).
+static os_thread_t *ThreadReadyPrev (const osRtxReadyQueue_t *queue, uint32_t priority) {
+  os_thread_t *prev;
+  uint32_t     map, base, n;
+
+  // Mask out priorities up to and including the specified one
+  n = priority + 1U;
+  if (n < 32U) {
+    map  = queue->map[0] & (0xFFFFFFFFU << n);
+    base = 0U;
+    if (map == 0U) {
+      map  = queue->map[1];
+      base = 32U;
+    }
+  } else {
+    map  = queue->map[1] & (0xFFFFFFFFU << (n - 32U));
+    base = 32U;
+  }
 
-//  ==== Library functions ====
+  if (map != 0U) {
+    // Lowest non-empty priority above the specified one
+    map &= 0U - map;
+    prev = queue->tail[base + (31U - (uint32_t)__CLZ(map))];
+  } else {
+    prev = osRtxThreadObject(&osRtxInfo.thread.ready);
+  }
 
-/// Put a Thread into specified Object list sorted by Priority (Highest at Head).
-/// \param[in]  object          generic object.
+  return prev;
+}
+
+/// Insert a Thread into the Ready list (Ready Queue Priority Bitmap).
+/// \param[in]  queue           ready queue.
 /// \param[in]  thread          thread object.
-void osRtxThreadListPut (os_object_t *object, os_thread_t *thread) {
+/// \param[in]  preempted       insert ahead of (true) or behind (false) threads with the same priority.
+static void ThreadReadyInsert (osRtxReadyQueue_t *queue, os_thread_t *thread, bool_t preempted) {
   os_thread_t *prev, *next;
-  int32_t      priority;
+  uint32_t     priority;
 
-  priority = thread->priority;
+  priority = (uint32_t)thread->priority;
 
-  prev = osRtxThreadObject(object);
-  next = prev->thread_next;
-  while ((next != NULL) && (next->priority >= priority)) {
-    prev = next;
-    next = next->thread_next;
+  if (preempted || (queue->tail[priority] == NULL)) {
+    prev = ThreadReadyPrev(queue, priority);
+  } else {
+    prev = queue->tail[priority];
   }
+  next = prev->thread_next;
   thread->thread_prev = prev;
   thread->thread_next = next;
   prev->thread_next = thread;
   if (next != NULL) {
     next->thread_prev = thread;
   }
+
+  if (queue->tail[priority] == NULL) {
+    queue->tail[priority] = thread;
+    queue->map[priority >> 5] |= 1UL << (priority & 31U);
+  } else if (!preempted) {
+    queue->tail[priority] = thread;
+  } else {
+    // Tail remains unchanged
+  }
+}
+
+/// Update Ready Queue Priority Bitmap before a Thread is removed from the Ready list.
+/// \param[in]  queue           ready queue.
+/// \param[in]  thread          thread object.
+static void ThreadReadyUnlink (osRtxReadyQueue_t *queue, const os_thread_t *thread) {
+  os_thread_t *prev;
+  uint32_t     priority;
+
+  priority = (uint32_t)thread->priority;
+
+  if (queue->tail[priority] == thread) {
+    prev = thread->thread_prev;
+    if ((prev->id == osRtxIdThread) && (prev->priority == thread->priority)) {
+      queue->tail[priority] = prev;
+    } else {
+      queue->tail[priority] = NULL;
+      queue->map[priority >> 5] &= ~(1UL << (priority & 31U));
+    }
+  }
+}
+
+#ifdef RTX_THREAD_STATS
+/// Get time for Thread Runtime Statistics.
+/// \return system timer count (extended to 64-bit).
+static uint64_t ThreadStatsTime (void) {
+  uint32_t tick;
+  uint32_t count;
+
+  tick  = osRtxInfo.kernel.tick;
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  return (((uint64_t)tick * OS_Tick_GetInterval()) + count);
+}
+
+/// Update Thread Runtime Statistics when a Thread becomes Ready.
+/// \param[in]  thread          thread object (running thread when preempted or yielding).
+static void ThreadStatsReady (os_thread_t *thread) {
+  uint64_t time;
+
+  if (osRtxInfo.kernel.state >= osRtxKernelRunning) {
+    time = ThreadStatsTime();
+    // Execution time of the Thread put back ends here
+    if ((thread->state == osRtxThreadRunning) && (thread->stats_time != 0U)) {
+      thread->stats.run_time += time - thread->stats_time;
+    }
+    thread->stats_time = (time != 0U) ? time : 1U;
+  }
+}
+
+/// Update Thread Runtime Statistics on Thread switch.
+/// \param[in]  thread          thread object switched to.
+static void ThreadStatsSwitch (os_thread_t *thread) {
+  os_thread_t *thread_prev;
+  uint64_t     time;
+  uint64_t     latency;
+
+  time = ThreadStatsTime();
+
+  // Execution time of the Thread switched from (already added when it was put back to Ready)
+  thread_prev = osRtxInfo.thread.run.next;
+  if ((thread_prev != NULL) && (thread_prev->state != osRtxThreadReady) && (thread_prev->stats_time != 0U)) {
+    thread_prev->stats.run_time += time - thread_prev->stats_time;
+    thread_prev->stats_time = 0U;
+  }
+
+  // Latency since the Thread switched to has become Ready
+  if (thread->stats_time != 0U) {
+    latency = time - thread->stats_time;
+    if (latency > 0xFFFFFFFFU) {
+      latency = 0xFFFFFFFFU;
+    }
+    if ((uint32_t)latency > thread->stats.latency_max) {
+      thread->stats.latency_max = (uint32_t)latency;
+    }
+  }
+
+  thread->stats.switch_count++;
+  thread->stats_time = (time != 0U) ? time : 1U;
+}
+#endif
+
+
+//  ==== Library functions ====
+
+/// Put a Thread into specified Object list sorted by Priority (Highest at Head).
+/// \param[in]  object          generic object.
+/// \param[in]  thread          thread object.
+void osRtxThreadListPut (os_object_t *object, os_thread_t *thread) {
+  os_thread_t *prev, *next;
+  int32_t      priority;
+
+  if ((object == &osRtxInfo.thread.ready) && (osRtxConfig.ready_queue != NULL)) {
+    ThreadReadyInsert(osRtxConfig.ready_queue, thread, FALSE);
+  } else {
+    priority = thread->priority;
+
+    prev = osRtxThreadObject(object);
+    next = prev->thread_next;
+    while ((next != NULL) && (next->priority >= priority)) {
+      prev = next;
+      next = next->thread_next;
+    }
+    thread->thread_prev = prev;
+    thread->thread_next = next;
+    prev->thread_next = thread;
+    if (next != NULL) {
+      next->thread_prev = thread;
+    }
+  }
 }
 
 /// Get a Thread with Highest Priority from specified Object list and remove it.
@@ -166,6 +319,9 @@ os_thread_t *osRtxThreadListGet (os_object_t *object) {
   os_thread_t *thread;
 
   thread = object->thread_list;
+  if ((object == &osRtxInfo.thread.ready) && (osRtxConfig.ready_queue != NULL)) {
+    ThreadReadyUnlink(osRtxConfig.ready_queue, thread);
+  }
   object->thread_list = thread->thread_next;
   if (thread->thread_next != NULL) {
     thread->thread_next->thread_prev = osRtxThreadObject(object);
@@ -188,22 +344,31 @@ static void *osRtxThreadListRoot (os_thread_t *thread) {
   return thread0;
 }
 
-/// Re-sort a Thread in linked Object list by Priority (Highest at Head).
+/// Set Thread priority and re-sort it in linked Object list by Priority (Highest at Head).
 /// \param[in]  thread          thread object.
-void osRtxThreadListSort (os_thread_t *thread) {
+/// \param[in]  priority        new thread priority.
+void osRtxThreadListSort (os_thread_t *thread, int8_t priority) {
   os_object_t *object;
   os_thread_t *thread0;
 
-  // Search for object
-  thread0 = thread;
-  while ((thread0 != NULL) && (thread0->id == osRtxIdThread)) {
-    thread0 = thread0->thread_prev;
+  if ((thread->state == osRtxThreadReady) && (osRtxConfig.ready_queue != NULL)) {
+    // Ready Thread is in the Ready list (no search)
+    object = &osRtxInfo.thread.ready;
+  } else {
+    // Search for object
+    thread0 = thread;
+    while ((thread0 != NULL) && (thread0->id == osRtxIdThread)) {
+      thread0 = thread0->thread_prev;
+    }
+    object = osRtxObject(thread0);
   }
-  object = osRtxObject(thread0);
 
   if (object != NULL) {
     osRtxThreadListRemove(thread);
+    thread->priority = priority;
     osRtxThreadListPut(object, thread);
+  } else {
+    thread->priority = priority;
   }
 }
 
@@ -212,6 +377,9 @@ void osRtxThreadListSort (os_thread_t *thread) {
 void osRtxThreadListRemove (os_thread_t *thread) {
 
   if (thread->thread_prev != NULL) {
+    if ((thread->state == osRtxThreadReady) && (osRtxConfig.ready_queue != NULL)) {
+      ThreadReadyUnlink(osRtxConfig.ready_queue, thread);
+    }
     thread->thread_prev->thread_next = thread->thread_next;
     if (thread->thread_next != NULL) {
       thread->thread_next->thread_prev = thread->thread_prev;
@@ -239,10 +407,115 @@ static void osRtxThreadListUnlink (os_thread_t **thread_list, os_thread_t *threa
 /// \param[in]  thread          thread object.
 void osRtxThreadReadyPut (os_thread_t *thread) {
 
+#ifdef RTX_THREAD_STATS
+  ThreadStatsReady(thread);
+#endif
+
   thread->state = osRtxThreadReady;
   osRtxThreadListPut(&osRtxInfo.thread.ready, thread);
 }
 
+/// Append a Thread to a Delay wheel slot (Oldest at Head, Head links the Tail).
+/// \param[in]  slot            slot list head.
+/// \param[in]  thread          thread object.
+static void ThreadWheelAppend (os_thread_t **slot, os_thread_t *thread) {
+  os_thread_t *head;
+
+  head = *slot;
+  thread->delay_next = NULL;
+  if (head != NULL) {
+    thread->delay_prev = head->delay_prev;
+    head->delay_prev->delay_next = thread;
+    head->delay_prev = thread;
+  } else {
+    thread->delay_prev = thread;
+    *slot = thread;
+  }
+}
+
+/// Prepend a Thread to a Delay wheel slot.
+/// \param[in]  slot            slot list head.
+/// \param[in]  thread          thread object.
+static void ThreadWheelPrepend (os_thread_t **slot, os_thread_t *thread) {
+  os_thread_t *head;
+
+  head = *slot;
+  if (head != NULL) {
+    thread->delay_prev = head->delay_prev;
+    head->delay_prev = thread;
+  } else {
+    thread->delay_prev = thread;
+  }
+  thread->delay_next = head;
+  *slot = thread;
+}
+
+/// Insert a Thread into the Delay wheel.
+/// \param[in]  wheel           timer wheel.
+/// \param[in]  thread          thread object.
+/// \param[in]  delay           delay value.
+static void ThreadWheelInsert (osRtxTimerWheel_t *wheel, os_thread_t *thread, uint32_t delay) {
+
+  // Absolute expiry time
+  thread->delay  = wheel->thread.tick + delay;
+  thread->flags |= osRtxThreadFlagDelayWheel;
+  ThreadWheelAppend(&wheel->thread.slot[osRtxTimerWheelSlot(wheel->thread.tick, thread->delay)], thread);
+  wheel->thread.count++;
+}
+
+/// Remove a Thread from the Delay wheel.
+/// \param[in]  wheel           timer wheel.
+/// \param[in]  thread          thread object.
+static void ThreadWheelRemove (osRtxTimerWheel_t *wheel, os_thread_t *thread) {
+  os_thread_t **slot;
+  os_thread_t  *prev, *next;
+  uint32_t      level;
+
+  prev = thread->delay_prev;
+  next = thread->delay_next;
+  if ((prev->delay_next == thread) && (next != NULL)) {
+    prev->delay_next = next;
+    next->delay_prev = prev;
+  } else {
+    // Head or Tail: search the slot of the expiry time on each level
+    level = 0U;
+    do {
+      slot = &wheel->thread.slot[(level * osRtxTimerWheelSize) +
+                                 ((thread->delay >> (level * osRtxTimerWheelBits)) & (osRtxTimerWheelSize - 1U))];
+      level++;
+    } while ((*slot == NULL) || ((*slot != thread) && ((*slot)->delay_prev != thread)));
+    if (*slot == thread) {
+      *slot = next;
+      if (next != NULL) {
+        next->delay_prev = prev;
+      }
+    } else {
+      prev->delay_next = NULL;
+      (*slot)->delay_prev = prev;
+    }
+  }
+  thread->flags &= (uint8_t)~osRtxThreadFlagDelayWheel;
+  wheel->thread.count--;
+}
+
+/// Move the Threads of a Delay wheel slot to the slots of their remaining time.
+/// \param[in]  wheel           timer wheel.
+/// \param[in]  slot            slot index.
+static void ThreadWheelCascade (osRtxTimerWheel_t *wheel, uint32_t slot) {
+  os_thread_t *head, *thread, *prev;
+
+  head = wheel->thread.slot[slot];
+  wheel->thread.slot[slot] = NULL;
+
+  // From Tail to Head: cascaded threads precede threads with the same expiry time
+  thread = (head != NULL) ? head->delay_prev : NULL;
+  while (thread != NULL) {
+    prev = (thread != head) ? thread->delay_prev : NULL;
+    ThreadWheelPrepend(&wheel->thread.slot[osRtxTimerWheelSlot(wheel->thread.tick, thread->delay)], thread);
+    thread = prev;
+  }
+}
+
 /// Insert a Thread into the Delay list sorted by Delay (Lowest at Head).
 /// \param[in]  thread          thread object.
 /// \param[in]  delay           delay value.
@@ -264,6 +537,8 @@ static void osRtxThreadDelayInsert (os_thread_t *thread, uint32_t delay) {
     } else {
       osRtxInfo.thread.wait_list = thread;
     }
+  } else if (osRtxConfig.timer_wheel != NULL) {
+    ThreadWheelInsert(osRtxConfig.timer_wheel, thread, delay);
   } else {
     prev = NULL;
     next = osRtxInfo.thread.delay_list;
@@ -291,7 +566,9 @@ static void osRtxThreadDelayInsert (os_thread_t *thread, uint32_t delay) {
 /// \param[in]  thread          thread object.
 static void osRtxThreadDelayRemove (os_thread_t *thread) {
 
-  if (thread->delay == osWaitForever) {
+  if ((thread->flags & osRtxThreadFlagDelayWheel) != 0U) {
+    ThreadWheelRemove(osRtxConfig.timer_wheel, thread);
+  } else if (thread->delay == osWaitForever) {
     if (thread->delay_next != NULL) {
       thread->delay_next->delay_prev = thread->delay_prev;
     }
@@ -315,10 +592,93 @@ static void osRtxThreadDelayRemove (os_thread_t *thread) {
   }
 }
 
+/// Wake-up a Thread whose delay has expired.
+/// \param[in]  thread          thread object.
+static void osRtxThreadDelayTimeout (os_thread_t *thread) {
+  os_object_t *object;
+
+  switch (thread->state) {
+    case osRtxThreadWaitingDelay:
+      EvrRtxDelayCompleted(thread);
+      break;
+    case osRtxThreadWaitingThreadFlags:
+      EvrRtxThreadFlagsWaitTimeout(thread);
+      break;
+    case osRtxThreadWaitingEventFlags:
+      object = osRtxObject(osRtxThreadListRoot(thread));
+      EvrRtxEventFlagsWaitTimeout(osRtxEventFlagsObject(object));
+      break;
+    case osRtxThreadWaitingMutex:
+      object = osRtxObject(osRtxThreadListRoot(thread));
+      osRtxMutexOwnerRestore(osRtxMutexObject(object), thread);
+      EvrRtxMutexAcquireTimeout(osRtxMutexObject(object));
+      break;
+    case osRtxThreadWaitingSemaphore:
+      object = osRtxObject(osRtxThreadListRoot(thread));
+      EvrRtxSemaphoreAcquireTimeout(osRtxSemaphoreObject(object));
+      break;
+    case osRtxThreadWaitingMemoryPool:
+      object = osRtxObject(osRtxThreadListRoot(thread));
+      EvrRtxMemoryPoolAllocTimeout(osRtxMemoryPoolObject(object));
+      break;
+    case osRtxThreadWaitingMessageGet:
+      object = osRtxObject(osRtxThreadListRoot(thread));
+      EvrRtxMessageQueueGetTimeout(osRtxMessageQueueObject(object));
+      break;
+    case osRtxThreadWaitingMessagePut:
+      object = osRtxObject(osRtxThreadListRoot(thread));
+      EvrRtxMessageQueuePutTimeout(osRtxMessageQueueObject(object));
+      break;
+    default:
+      // Invalid
+      break;
+  }
+  EvrRtxThreadUnblocked(thread, (osRtxThreadRegPtr(thread))[0]);
+  osRtxThreadListRemove(thread);
+  osRtxThreadReadyPut(thread);
+}
+
+/// Process Thread Delay wheel slot of the current tick.
+/// \param[in]  wheel           timer wheel.
+static void ThreadWheelTick (osRtxTimerWheel_t *wheel) {
+  os_thread_t *thread, *next;
+  uint32_t     tick, level, slot;
+
+  tick = wheel->thread.tick + 1U;
+  slot = tick & (osRtxTimerWheelSize - 1U);
+
+  // Cascade the slot of each higher level whose time range starts
+  for (level = 1U; (slot == 0U) && (level < osRtxTimerWheelLevels); level++) {
+    slot = (tick >> (level * osRtxTimerWheelBits)) & (osRtxTimerWheelSize - 1U);
+    ThreadWheelCascade(wheel, (level * osRtxTimerWheelSize) + slot);
+  }
+
+  wheel->thread.tick = tick;
+
+  // Threads in the lowest level slot of the current tick expire
+  slot   = tick & (osRtxTimerWheelSize - 1U);
+  thread = wheel->thread.slot[slot];
+  wheel->thread.slot[slot] = NULL;
+
+  // Wake-up expired threads (from oldest to newest)
+  while (thread != NULL) {
+    next = thread->delay_next;
+    thread->flags &= (uint8_t)~osRtxThreadFlagDelayWheel;
+    wheel->thread.count--;
+    osRtxThreadDelayTimeout(thread);
+    thread = next;
+  }
+}
+
 /// Process Thread Delay Tick (executed each System Tick).
 void osRtxThreadDelayTick (void) {
   os_thread_t *thread;
-  os_object_t *object;
+
+  if (osRtxConfig.timer_wheel != NULL) {
+    ThreadWheelTick(osRtxConfig.timer_wheel);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
 
   thread = osRtxInfo.thread.delay_list;
   if (thread == NULL) {
@@ -330,45 +690,7 @@ void osRtxThreadDelayTick (void) {
 
   if (thread->delay == 0U) {
     do {
-      switch (thread->state) {
-        case osRtxThreadWaitingDelay:
-          EvrRtxDelayCompleted(thread);
-          break;
-        case osRtxThreadWaitingThreadFlags:
-          EvrRtxThreadFlagsWaitTimeout(thread);
-          break;
-        case osRtxThreadWaitingEventFlags:
-          object = osRtxObject(osRtxThreadListRoot(thread));
-          EvrRtxEventFlagsWaitTimeout(osRtxEventFlagsObject(object));
-          break;
-        case osRtxThreadWaitingMutex:
-          object = osRtxObject(osRtxThreadListRoot(thread));
-          osRtxMutexOwnerRestore(osRtxMutexObject(object), thread);
-          EvrRtxMutexAcquireTimeout(osRtxMutexObject(object));
-          break;
-        case osRtxThreadWaitingSemaphore:
-          object = osRtxObject(osRtxThreadListRoot(thread));
-          EvrRtxSemaphoreAcquireTimeout(osRtxSemaphoreObject(object));
-          break;
-        case osRtxThreadWaitingMemoryPool:
-          object = osRtxObject(osRtxThreadListRoot(thread));
-          EvrRtxMemoryPoolAllocTimeout(osRtxMemoryPoolObject(object));
-          break;
-        case osRtxThreadWaitingMessageGet:
-          object = osRtxObject(osRtxThreadListRoot(thread));
-          EvrRtxMessageQueueGetTimeout(osRtxMessageQueueObject(object));
-          break;
-        case osRtxThreadWaitingMessagePut:
-          object = osRtxObject(osRtxThreadListRoot(thread));
-          EvrRtxMessageQueuePutTimeout(osRtxMessageQueueObject(object));
-          break;
-        default:
-          // Invalid
-          break;
-      }
-      EvrRtxThreadUnblocked(thread, (osRtxThreadRegPtr(thread))[0]);
-      osRtxThreadListRemove(thread);
-      osRtxThreadReadyPut(thread);
+      osRtxThreadDelayTimeout(thread);
       thread = thread->delay_next;
     } while ((thread != NULL) && (thread->delay == 0U));
     if (thread != NULL) {
@@ -378,6 +700,93 @@ void osRtxThreadDelayTick (void) {
   }
 }
 
+/// Get number of ticks until the next Thread Delay expires.
+/// \return number of ticks or osWaitForever when no thread is delayed.
+uint32_t osRtxThreadDelayNext (void) {
+  const osRtxTimerWheel_t *wheel;
+  const os_thread_t       *thread;
+  uint32_t                 delay, ticks, level, shift, n;
+
+  delay = osWaitForever;
+
+  wheel = osRtxConfig.timer_wheel;
+  if (wheel != NULL) {
+    if (wheel->thread.count != 0U) {
+      for (level = 0U; level < osRtxTimerWheelLevels; level++) {
+        shift = level * osRtxTimerWheelBits;
+        for (n = 1U; n <= osRtxTimerWheelSize; n++) {
+          // Slots are reached in order: stop at the first one starting after the earliest expiry
+          ticks = (((wheel->thread.tick >> shift) + n) << shift) - wheel->thread.tick;
+          if (ticks >= delay) {
+            break;
+          }
+          thread = wheel->thread.slot[(level * osRtxTimerWheelSize) +
+                                      (((wheel->thread.tick >> shift) + n) & (osRtxTimerWheelSize - 1U))];
+          while (thread != NULL) {
+            ticks = thread->delay - wheel->thread.tick;
+            if (ticks < delay) {
+              delay = ticks;
+            }
+            thread = thread->delay_next;
+          }
+        }
+      }
+    }
+  } else {
+    thread = osRtxInfo.thread.delay_list;
+    if (thread != NULL) {
+      delay = thread->delay;
+    }
+  }
+
+  return delay;
+}
+
+/// Advance Thread Delays without expiring any thread.
+/// \param[in]  ticks           number of ticks (less than returned by osRtxThreadDelayNext).
+void osRtxThreadDelaySkip (uint32_t ticks) {
+  osRtxTimerWheel_t *wheel;
+  os_thread_t       *thread, *next, *tail;
+  uint32_t           slot;
+
+  wheel = osRtxConfig.timer_wheel;
+  if (wheel != NULL) {
+    if (ticks < (osRtxTimerWheelSize - (wheel->thread.tick & (osRtxTimerWheelSize - 1U)))) {
+      // No higher level slot is reached
+      wheel->thread.tick += ticks;
+    } else {
+      // Unlink all threads (higher levels first: older threads with the same expiry time)
+      next = NULL;
+      tail = NULL;
+      for (slot = osRtxTimerWheelLevels * osRtxTimerWheelSize; slot != 0U; ) {
+        slot--;
+        thread = wheel->thread.slot[slot];
+        if (thread != NULL) {
+          if (tail != NULL) {
+            tail->delay_next = thread;
+          } else {
+            next = thread;
+          }
+          tail = thread->delay_prev;
+          wheel->thread.slot[slot] = NULL;
+        }
+      }
+      // Insert threads into the slots of their remaining time
+      wheel->thread.tick += ticks;
+      while (next != NULL) {
+        thread = next;
+        next   = thread->delay_next;
+        ThreadWheelAppend(&wheel->thread.slot[osRtxTimerWheelSlot(wheel->thread.tick, thread->delay)], thread);
+      }
+    }
+  } else {
+    thread = osRtxInfo.thread.delay_list;
+    if (thread != NULL) {
+      thread->delay -= ticks;
+    }
+  }
+}
+
 /// Get pointer to Thread registers (R0..R3)
 /// \param[in]  thread          thread object.
 /// \return pointer to registers R0-R3.
@@ -393,22 +802,30 @@ static void osRtxThreadBlock (os_thread_t *thread) {
   os_thread_t *prev, *next;
   int32_t      priority;
 
+#ifdef RTX_THREAD_STATS
+  ThreadStatsReady(thread);
+#endif
+
   thread->state = osRtxThreadReady;
 
-  priority = thread->priority;
+  if (osRtxConfig.ready_queue != NULL) {
+    ThreadReadyInsert(osRtxConfig.ready_queue, thread, TRUE);
+  } else {
+    priority = thread->priority;
 
-  prev = osRtxThreadObject(&osRtxInfo.thread.ready);
-  next = prev->thread_next;
+    prev = osRtxThreadObject(&osRtxInfo.thread.ready);
+    next = prev->thread_next;
 
-  while ((next != NULL) && (next->priority > priority)) {
-    prev = next;
-    next = next->thread_next;
-  }
-  thread->thread_prev = prev;
-  thread->thread_next = next;
-  prev->thread_next = thread;
-  if (next != NULL) {
-    next->thread_prev = thread;
+    while ((next != NULL) && (next->priority > priority)) {
+      prev = next;
+      next = next->thread_next;
+    }
+    thread->thread_prev = prev;
+    thread->thread_next = next;
+    prev->thread_next = thread;
+    if (next != NULL) {
+      next->thread_prev = thread;
+    }
   }
 
   EvrRtxThreadPreempted(thread);
@@ -418,6 +835,10 @@ static void osRtxThreadBlock (os_thread_t *thread) {
 /// \param[in]  thread          thread object.
 void osRtxThreadSwitch (os_thread_t *thread) {
 
+#ifdef RTX_THREAD_STATS
+  ThreadStatsSwitch(thread);
+#endif
+
   thread->state = osRtxThreadRunning;
   osRtxInfo.thread.run.next = thread;
   osRtxThreadStackCheck();
@@ -772,6 +1193,12 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
   #ifdef RTX_TF_M_EXTENSION
     thread->tz_module     = tz_module;
   #endif
+  #endif
+  #ifdef RTX_THREAD_STATS
+    thread->stats.run_time     = 0U;
+    thread->stats.switch_count = 0U;
+    thread->stats.latency_max  = 0U;
+    thread->stats_time         = 0U;
   #endif
 
     // Initialize stack
@@ -934,10 +1361,9 @@ static osStatus_t svcRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t
   }
 
   if (thread->priority   != (int8_t)priority) {
-    thread->priority      = (int8_t)priority;
     thread->priority_base = (int8_t)priority;
+    osRtxThreadListSort(thread, (int8_t)priority);
     EvrRtxThreadPriorityUpdated(thread, priority);
-    osRtxThreadListSort(thread);
     osRtxThreadDispatch(NULL);
   }
 
@@ -1339,6 +1765,11 @@ static uint32_t svcRtxThreadGetCount (void) {
     count++;
   }
 
+  // Timer Wheel (Delay List not used)
+  if (osRtxConfig.timer_wheel != NULL) {
+    count += osRtxConfig.timer_wheel->thread.count;
+  }
+
   // Wait List
   for (thread = osRtxInfo.thread.wait_list;
        thread != NULL; thread = thread->delay_next) {
@@ -1355,6 +1786,7 @@ static uint32_t svcRtxThreadGetCount (void) {
 static uint32_t svcRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
   os_thread_t *thread;
   uint32_t     count;
+  uint32_t     n;
 
   // Check parameters
   if ((thread_array == NULL) || (array_items == 0U)) {
@@ -1384,6 +1816,18 @@ static uint32_t svcRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t arra
      count++;
   }
 
+  // Timer Wheel Slots (Delay List not used)
+  if (osRtxConfig.timer_wheel != NULL) {
+    for (n = 0U; n < (osRtxTimerWheelLevels * osRtxTimerWheelSize); n++) {
+      for (thread = osRtxConfig.timer_wheel->thread.slot[n];
+           (thread != NULL) && (count < array_items); thread = thread->delay_next) {
+        *thread_array = thread;
+         thread_array++;
+         count++;
+      }
+    }
+  }
+
   // Wait List
   for (thread = osRtxInfo.thread.wait_list;
        (thread != NULL) && (count < array_items); thread = thread->delay_next) {
@@ -1533,6 +1977,30 @@ static uint32_t svcRtxThreadFlagsWait (uint32_t flags, uint32_t options, uint32_
   return thread_flags;
 }
 
+#ifdef RTX_THREAD_STATS
+/// Get Runtime Statistics of a thread.
+/// \note API identical to osRtxThreadGetStats
+static osStatus_t svcRtxThreadGetStats (osThreadId_t thread_id, osRtxThreadStats_t *stats) {
+  os_thread_t *thread = osRtxThreadId(thread_id);
+
+  // Check parameters
+  if ((thread == NULL) || (thread->id != osRtxIdThread) || (stats == NULL)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  *stats = thread->stats;
+
+  // Add execution time of the running Thread
+  if ((thread->state == osRtxThreadRunning) && (thread->stats_time != 0U)) {
+    stats->run_time += ThreadStatsTime() - thread->stats_time;
+  }
+
+  return osOK;
+}
+#endif
+
 //  Service Calls definitions
 //lint ++flb "Library Begin" [MISRA Note 11]
 SVC0_3 (ThreadNew,           osThreadId_t,    osThreadFunc_t, void *, const osThreadAttr_t *)
@@ -1541,6 +2009,9 @@ SVC0_0 (ThreadGetId,         osThreadId_t)
 SVC0_1 (ThreadGetState,      osThreadState_t, osThreadId_t)
 SVC0_1 (ThreadGetStackSize,  uint32_t, osThreadId_t)
 SVC0_1 (ThreadGetStackSpace, uint32_t, osThreadId_t)
+#ifdef RTX_THREAD_STATS
+SVC0_2 (ThreadGetStats,      osStatus_t,      osThreadId_t, osRtxThreadStats_t *)
+#endif
 SVC0_2 (ThreadSetPriority,   osStatus_t,      osThreadId_t, osPriority_t)
 SVC0_1 (ThreadGetPriority,   osPriority_t,    osThreadId_t)
 SVC0_0 (ThreadYield,         osStatus_t)
@@ -1899,3 +2370,18 @@ uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout)
   }
   return thread_flags;
 }
+
+#ifdef RTX_THREAD_STATS
+/// Get Runtime Statistics of a thread.
+osStatus_t osRtxThreadGetStats (osThreadId_t thread_id, osRtxThreadStats_t *stats) {
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    EvrRtxThreadError(thread_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcThreadGetStats(thread_id, stats);
+  }
+  return status;
+}
+#endif
@@ -36,30 +36,133 @@ __attribute__((section(".data.os.timer.obj"))) =
 
 //  ==== Helper functions ====
 
+/// Append Timer to a Timer Wheel slot (Oldest at Head, Head links the Tail).
+/// \param[in]  slot            slot list head.
+/// \param[in]  timer           timer object.
+static void TimerWheelAppend (os_timer_t **slot, os_timer_t *timer) {
+  os_timer_t *head;
+
+  head = *slot;
+  timer->next = NULL;
+  if (head != NULL) {
+    timer->prev = head->prev;
+    head->prev->next = timer;
+    head->prev = timer;
+  } else {
+    timer->prev = timer;
+    *slot = timer;
+  }
+}
+
+/// Prepend Timer to a Timer Wheel slot.
+/// \param[in]  slot            slot list head.
+/// \param[in]  timer           timer object.
+static void TimerWheelPrepend (os_timer_t **slot, os_timer_t *timer) {
+  os_timer_t *head;
+
+  head = *slot;
+  if (head != NULL) {
+    timer->prev = head->prev;
+    head->prev = timer;
+  } else {
+    timer->prev = timer;
+  }
+  timer->next = head;
+  *slot = timer;
+}
+
+/// Insert Timer into the Timer Wheel.
+/// \param[in]  wheel           timer wheel.
+/// \param[in]  timer           timer object.
+/// \param[in]  tick            timer tick.
+static void TimerWheelInsert (osRtxTimerWheel_t *wheel, os_timer_t *timer, uint32_t tick) {
+
+  // Absolute expiry time
+  timer->tick = wheel->timer.tick + tick;
+  TimerWheelAppend(&wheel->timer.slot[osRtxTimerWheelSlot(wheel->timer.tick, timer->tick)], timer);
+  wheel->timer.count++;
+}
+
+/// Remove Timer from the Timer Wheel.
+/// \param[in]  wheel           timer wheel.
+/// \param[in]  timer           timer object.
+static void TimerWheelRemove (osRtxTimerWheel_t *wheel, const os_timer_t *timer) {
+  os_timer_t **slot;
+  os_timer_t  *prev, *next;
+  uint32_t     level;
+
+  prev = timer->prev;
+  next = timer->next;
+  if ((prev->next == timer) && (next != NULL)) {
+    prev->next = next;
+    next->prev = prev;
+  } else {
+    // Head or Tail: search the slot of the expiry time on each level
+    level = 0U;
+    do {
+      slot = &wheel->timer.slot[(level * osRtxTimerWheelSize) +
+                                ((timer->tick >> (level * osRtxTimerWheelBits)) & (osRtxTimerWheelSize - 1U))];
+      level++;
+    } while ((*slot == NULL) || ((*slot != timer) && ((*slot)->prev != timer)));
+    if (*slot == timer) {
+      *slot = next;
+      if (next != NULL) {
+        next->prev = prev;
+      }
+    } else {
+      prev->next = NULL;
+      (*slot)->prev = prev;
+    }
+  }
+  wheel->timer.count--;
+}
+
+/// Move the Timers of a Timer Wheel slot to the slots of their remaining time.
+/// \param[in]  wheel           timer wheel.
+/// \param[in]  slot            slot index.
+static void TimerWheelCascade (osRtxTimerWheel_t *wheel, uint32_t slot) {
+  os_timer_t *head, *timer, *prev;
+
+  head = wheel->timer.slot[slot];
+  wheel->timer.slot[slot] = NULL;
+
+  // From Tail to Head: cascaded timers precede timers with the same expiry time
+  timer = (head != NULL) ? head->prev : NULL;
+  while (timer != NULL) {
+    prev = (timer != head) ? timer->prev : NULL;
+    TimerWheelPrepend(&wheel->timer.slot[osRtxTimerWheelSlot(wheel->timer.tick, timer->tick)], timer);
+    timer = prev;
+  }
+}
+
 /// Insert Timer into the Timer List sorted by Time.
 /// \param[in]  timer           timer object.
 /// \param[in]  tick            timer tick.
 static void TimerInsert (os_timer_t *timer, uint32_t tick) {
   os_timer_t *prev, *next;
 
-  prev = NULL;
-  next = osRtxInfo.timer.list;
-  while ((next != NULL) && (next->tick <= tick)) {
-    tick -= next->tick;
-    prev  = next;
-    next  = next->next;
-  }
-  timer->tick = tick;
-  timer->prev = prev;
-  timer->next = next;
-  if (next != NULL) {
-    next->tick -= timer->tick;
-    next->prev  = timer;
-  }
-  if (prev != NULL) {
-    prev->next = timer;
+  if (osRtxConfig.timer_wheel != NULL) {
+    TimerWheelInsert(osRtxConfig.timer_wheel, timer, tick);
   } else {
-    osRtxInfo.timer.list = timer;
+    prev = NULL;
+    next = osRtxInfo.timer.list;
+    while ((next != NULL) && (next->tick <= tick)) {
+      tick -= next->tick;
+      prev  = next;
+      next  = next->next;
+    }
+    timer->tick = tick;
+    timer->prev = prev;
+    timer->next = next;
+    if (next != NULL) {
+      next->tick -= timer->tick;
+      next->prev  = timer;
+    }
+    if (prev != NULL) {
+      prev->next = timer;
+    } else {
+      osRtxInfo.timer.list = timer;
+    }
   }
 }
 
@@ -67,14 +170,18 @@ static void TimerInsert (os_timer_t *timer, uint32_t tick) {
 /// \param[in]  timer           timer object.
 static void TimerRemove (const os_timer_t *timer) {
 
-  if (timer->next != NULL) {
-    timer->next->tick += timer->tick;
-    timer->next->prev  = timer->prev;
-  }
-  if (timer->prev != NULL) {
-    timer->prev->next  = timer->next;
+  if (osRtxConfig.timer_wheel != NULL) {
+    TimerWheelRemove(osRtxConfig.timer_wheel, timer);
   } else {
-    osRtxInfo.timer.list = timer->next;
+    if (timer->next != NULL) {
+      timer->next->tick += timer->tick;
+      timer->next->prev  = timer->prev;
+    }
+    if (timer->prev != NULL) {
+      timer->prev->next  = timer->next;
+    } else {
+      osRtxInfo.timer.list = timer->next;
+    }
   }
 }
 
@@ -88,13 +195,65 @@ static void TimerUnlink (const os_timer_t *timer) {
   osRtxInfo.timer.list = timer->next;
 }
 
+/// Post expired Timer callback and restart periodic Timer.
+/// \param[in]  timer           timer object.
+static void TimerExpire (os_timer_t *timer) {
+  osStatus_t status;
+
+  status = osMessageQueuePut(osRtxInfo.timer.mq, &timer->finfo, 0U, 0U);
+  if (status != osOK) {
+    (void)osRtxErrorNotify(osRtxErrorTimerQueueOverflow, timer);
+  }
+  if (timer->type == osRtxTimerPeriodic) {
+    TimerInsert(timer, timer->load);
+  } else {
+    timer->state = osRtxTimerStopped;
+  }
+}
+
+/// Process Timer Wheel slot of the current tick.
+/// \param[in]  wheel           timer wheel.
+static void TimerWheelTick (osRtxTimerWheel_t *wheel) {
+  os_timer_t *timer, *next;
+  uint32_t    tick, level, slot;
+
+  tick = wheel->timer.tick + 1U;
+  slot = tick & (osRtxTimerWheelSize - 1U);
+
+  // Cascade the slot of each higher level whose time range starts
+  for (level = 1U; (slot == 0U) && (level < osRtxTimerWheelLevels); level++) {
+    slot = (tick >> (level * osRtxTimerWheelBits)) & (osRtxTimerWheelSize - 1U);
+    TimerWheelCascade(wheel, (level * osRtxTimerWheelSize) + slot);
+  }
+
+  wheel->timer.tick = tick;
+
+  // Timers in the lowest level slot of the current tick expire
+  slot  = tick & (osRtxTimerWheelSize - 1U);
+  timer = wheel->timer.slot[slot];
+  wheel->timer.slot[slot] = NULL;
+
+  // Expire timers (from oldest to newest)
+  while (timer != NULL) {
+    next = timer->next;
+    wheel->timer.count--;
+    TimerExpire(timer);
+    timer = next;
+  }
+}
+
 
 //  ==== Library functions ====
 
 /// Timer Tick (called each SysTick).
 static void osRtxTimerTick (void) {
   os_timer_t *timer;
-  osStatus_t  status;
+
+  if (osRtxConfig.timer_wheel != NULL) {
+    TimerWheelTick(osRtxConfig.timer_wheel);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
 
   timer = osRtxInfo.timer.list;
   if (timer == NULL) {
@@ -105,16 +264,95 @@ static void osRtxTimerTick (void) {
   timer->tick--;
   while ((timer != NULL) && (timer->tick == 0U)) {
     TimerUnlink(timer);
-    status = osMessageQueuePut(osRtxInfo.timer.mq, &timer->finfo, 0U, 0U);
-    if (status != osOK) {
-      (void)osRtxErrorNotify(osRtxErrorTimerQueueOverflow, timer);
+    TimerExpire(timer);
+    timer = osRtxInfo.timer.list;
+  }
+}
+
+/// Get number of ticks until the next active Timer expires.
+/// \return number of ticks or osWaitForever when no timer is active.
+uint32_t osRtxTimerNext (void) {
+  const osRtxTimerWheel_t *wheel;
+  const os_timer_t        *timer;
+  uint32_t                 delay, ticks, level, shift, n;
+
+  delay = osWaitForever;
+
+  wheel = osRtxConfig.timer_wheel;
+  if (wheel != NULL) {
+    if (wheel->timer.count != 0U) {
+      for (level = 0U; level < osRtxTimerWheelLevels; level++) {
+        shift = level * osRtxTimerWheelBits;
+        for (n = 1U; n <= osRtxTimerWheelSize; n++) {
+          // Slots are reached in order: stop at the first one starting after the earliest expiry
+          ticks = (((wheel->timer.tick >> shift) + n) << shift) - wheel->timer.tick;
+          if (ticks >= delay) {
+            break;
+          }
+          timer = wheel->timer.slot[(level * osRtxTimerWheelSize) +
+                                    (((wheel->timer.tick >> shift) + n) & (osRtxTimerWheelSize - 1U))];
+          while (timer != NULL) {
+            ticks = timer->tick - wheel->timer.tick;
+            if (ticks < delay) {
+              delay = ticks;
+            }
+            timer = timer->next;
+          }
+        }
+      }
+    }
+  } else {
+    timer = osRtxInfo.timer.list;
+    if (timer != NULL) {
+      delay = timer->tick;
     }
-    if (timer->type == osRtxTimerPeriodic) {
-      TimerInsert(timer, timer->load);
+  }
+
+  return delay;
+}
+
+/// Advance active Timers without expiring any timer.
+/// \param[in]  ticks           number of ticks (less than returned by osRtxTimerNext).
+void osRtxTimerSkip (uint32_t ticks) {
+  osRtxTimerWheel_t *wheel;
+  os_timer_t        *timer, *next, *tail;
+  uint32_t           slot;
+
+  wheel = osRtxConfig.timer_wheel;
+  if (wheel != NULL) {
+    if (ticks < (osRtxTimerWheelSize - (wheel->timer.tick & (osRtxTimerWheelSize - 1U)))) {
+      // No higher level slot is reached
+      wheel->timer.tick += ticks;
     } else {
-      timer->state = osRtxTimerStopped;
+      // Unlink all timers (higher levels first: older timers with the same expiry time)
+      next = NULL;
+      tail = NULL;
+      for (slot = osRtxTimerWheelLevels * osRtxTimerWheelSize; slot != 0U; ) {
+        slot--;
+        timer = wheel->timer.slot[slot];
+        if (timer != NULL) {
+          if (tail != NULL) {
+            tail->next = timer;
+          } else {
+            next = timer;
+          }
+          tail = timer->prev;
+          wheel->timer.slot[slot] = NULL;
+        }
+      }
+      // Append timers to the slots of their remaining time
+      wheel->timer.tick += ticks;
+      while (next != NULL) {
+        timer = next;
+        next  = timer->next;
+        TimerWheelAppend(&wheel->timer.slot[osRtxTimerWheelSlot(wheel->timer.tick, timer->tick)], timer);
+      }
     }
+  } else {
     timer = osRtxInfo.timer.list;
+    if (timer != NULL) {
+      timer->tick -= ticks;
+    }
   }
 }
 
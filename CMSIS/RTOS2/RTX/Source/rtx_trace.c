@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Binary Trace Recorder
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "rtx_lib.h"
+
+#if (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0))
+
+#if ((OS_EVR_TRACE_SIZE < 16) || (OS_EVR_TRACE_SIZE > 65536))
+#error "Invalid Trace Buffer size (OS_EVR_TRACE_SIZE)!"
+#endif
+
+//  ==== Trace definitions ====
+
+// Trace Records are stored with interrupts masked for a few instructions:
+// the write index and the time of the previous Record must be updated together
+// so that the time deltas stay exact when an ISR preempts a recording thread.
+// Recording does not use the kernel and may be called from any context.
+//
+// The Start Record is not stored in the Trace Buffer: it is returned first by
+// osRtxTraceRead, so that it is not discarded in Overwrite mode. Discarded
+// Records are removed together with the Data Records of their event and their
+// time is returned in a Time Record before the oldest remaining Record.
+
+#define TRACE_FORMAT            1U      // Trace format version (Start Record)
+
+#define TRACE_TIME_MAX          0xFFFFU // Maximum time delta stored in a Record
+#define TRACE_DATA_MAX          24U     // Maximum data bytes of a Record (osRtxTraceRecordData)
+#define TRACE_NAME_MAX          16U     // Maximum characters of an object name
+
+#define TRACE_COMP_RTX          0xF0U   // First RTX component number (per event mask)
+#define TRACE_MSG_NUM           64U     // Number of messages per component (per event mask)
+
+/// Trace Recorder state
+static struct {
+  uint8_t             active;           ///< Recording active
+  uint8_t               mode;           ///< Trace Mode
+  uint8_t              start;           ///< Start Record not yet read
+  uint8_t           reserved;
+  uint32_t              head;           ///< Write Index
+  uint32_t              tail;           ///< Read Index
+  uint32_t             count;           ///< Number of Records
+  uint32_t              lost;           ///< Number of lost events (not yet reported)
+  uint32_t             clock;           ///< System timer frequency (Start Record)
+  uint64_t              time;           ///< Time of last Record
+  uint64_t              skip;           ///< Time of discarded Records (not yet reported)
+  uint32_t     level_off[4][8];         ///< Disabled components of each level (bit per component)
+  uint32_t     event_off[16][2];        ///< Disabled RTX events (bit per message)
+} Trace;
+
+/// Trace Buffer
+static osRtxTraceRecord_t TraceBuf[OS_EVR_TRACE_SIZE];
+
+
+//  ==== Helper functions ====
+
+/// Mask interrupts.
+/// \return previous interrupt mask.
+__STATIC_INLINE uint32_t TraceLock (void) {
+  uint32_t mask;
+
+#if (defined(__ARM_ARCH_7A__) && (__ARM_ARCH_7A__ != 0))
+  mask = __get_CPSR() & CPSR_I_BIT;
+#else
+  mask = __get_PRIMASK();
+#endif
+  __disable_irq();
+
+  return mask;
+}
+
+/// Restore interrupt mask.
+/// \param[in]  mask            interrupt mask returned by TraceLock.
+__STATIC_INLINE void TraceUnlock (uint32_t mask) {
+  if (mask == 0U) {
+    __enable_irq();
+  }
+}
+
+/// Get current time (interrupts masked).
+/// \return time in system timer counts.
+static uint64_t TraceTime (void) {
+  uint32_t tick;
+  uint32_t count;
+  uint64_t time;
+
+  // System timer is valid only while the kernel is running
+  if ((osRtxInfo.kernel.state != osRtxKernelRunning) &&
+      (osRtxInfo.kernel.state != osRtxKernelLocked)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return Trace.time;
+  }
+
+  tick  = osRtxInfo.kernel.tick;
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  time = ((uint64_t)tick * OS_Tick_GetInterval()) + count;
+
+  // Time does not go backwards (kernel suspended)
+  if (time < Trace.time) {
+    time = Trace.time;
+  }
+
+  return time;
+}
+
+/// Check if event is enabled.
+/// \param[in]  id              event ID.
+/// \return true - enabled, false - disabled.
+static bool_t TraceEnabled (uint32_t id) {
+  uint32_t level = (id >> 16) & 0x03U;
+  uint32_t comp  = (id >>  8) & 0xFFU;
+  uint32_t msg   =  id        & 0xFFU;
+
+  if ((Trace.level_off[level][comp >> 5] & (1UL << (comp & 0x1FU))) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  if ((comp >= TRACE_COMP_RTX) && (msg < TRACE_MSG_NUM)) {
+    comp -= TRACE_COMP_RTX;
+    if ((Trace.event_off[comp][msg >> 5] & (1UL << (msg & 0x1FU))) != 0U) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/// Put a Record into the Trace Buffer (interrupts masked, space available).
+/// \param[in]  id              record ID.
+/// \param[in]  time            time since previous record.
+/// \param[in]  val1            value 1.
+/// \param[in]  val2            value 2.
+static void TracePut (uint32_t id, uint32_t time, uint32_t val1, uint32_t val2) {
+  osRtxTraceRecord_t *rec = &TraceBuf[Trace.head];
+
+  rec->id   = (uint16_t)id;
+  rec->time = (uint16_t)time;
+  rec->val1 = val1;
+  rec->val2 = val2;
+
+  Trace.head++;
+  if (Trace.head == OS_EVR_TRACE_SIZE) {
+    Trace.head = 0U;
+  }
+  Trace.count++;
+}
+
+/// Discard oldest Records and the Data Records following them (interrupts masked).
+/// \param[in]  num             minimum number of Records to discard (not 0).
+static void TraceDiscard (uint32_t num) {
+  const osRtxTraceRecord_t *rec;
+
+  do {
+    rec = &TraceBuf[Trace.tail];
+    if (rec->id == osRtxTraceIdTime) {
+      Trace.skip += ((uint64_t)rec->val2 << 32) | rec->val1;
+    } else {
+      Trace.skip += rec->time;
+    }
+    Trace.tail++;
+    if (Trace.tail == OS_EVR_TRACE_SIZE) {
+      Trace.tail = 0U;
+    }
+    Trace.count--;
+    if (num != 0U) {
+      num--;
+    }
+  } while ((Trace.count != 0U) && ((num != 0U) || (TraceBuf[Trace.tail].id == osRtxTraceIdData)));
+}
+
+/// Record an event followed by its data.
+/// \param[in]  id              event ID.
+/// \param[in]  val1            value 1.
+/// \param[in]  val2            value 2.
+/// \param[in]  data            data stored in Data Records.
+/// \param[in]  len             data length in bytes.
+/// \return 1 - recorded, 0 - not recorded.
+static uint32_t TraceWrite (uint32_t id, uint32_t val1, uint32_t val2, const void *data, uint32_t len) {
+  const uint8_t *ptr = data;
+  uint32_t       val[2];
+  uint32_t       mask;
+  uint32_t       num;
+  uint32_t       n;
+  uint64_t       time;
+  uint64_t       delta;
+  uint32_t       ret = 0U;
+
+  if (!TraceEnabled(id)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  mask = TraceLock();
+
+  if (Trace.active != 0U) {
+    time  = TraceTime();
+    delta = time - Trace.time;
+
+    // Number of Records required
+    num = 1U + ((len + 7U) / 8U);
+    if (delta > TRACE_TIME_MAX) {
+      num++;
+    }
+    if (Trace.lost != 0U) {
+      num++;
+    }
+
+    if ((Trace.count + num) > OS_EVR_TRACE_SIZE) {
+      if (Trace.mode == osRtxTraceOverwrite) {
+        // Discard oldest events
+        TraceDiscard((Trace.count + num) - OS_EVR_TRACE_SIZE);
+      } else {
+        Trace.lost++;
+        num = 0U;
+      }
+    }
+
+    if (num != 0U) {
+      if (delta > TRACE_TIME_MAX) {
+        TracePut(osRtxTraceIdTime, 0U, (uint32_t)delta, (uint32_t)(delta >> 32));
+        delta = 0U;
+      }
+      if (Trace.lost != 0U) {
+        TracePut(osRtxTraceIdLost, (uint32_t)delta, Trace.lost, 0U);
+        Trace.lost = 0U;
+        delta = 0U;
+      }
+      TracePut(id, (uint32_t)delta, val1, val2);
+      while (len != 0U) {
+        n = (len < 8U) ? len : 8U;
+        val[0] = 0U;
+        val[1] = 0U;
+        (void)memcpy(val, ptr, n);
+        TracePut(osRtxTraceIdData, 0U, val[0], val[1]);
+        ptr += n;
+        len -= n;
+      }
+      Trace.time = time;
+      ret = 1U;
+    }
+  }
+
+  TraceUnlock(mask);
+
+  return ret;
+}
+
+
+//  ==== Library functions ====
+
+/// Record an event with an object name (stored as Data Records).
+/// \param[in]  id              event ID.
+/// \param[in]  val1            value 1.
+/// \param[in]  name            object name.
+/// \return 1 - recorded, 0 - not recorded.
+uint32_t osRtxTraceRecordName (uint32_t id, uint32_t val1, const char *name) {
+  uint32_t len = 0U;
+
+  if (name != NULL) {
+    while ((len < TRACE_NAME_MAX) && (name[len] != '\0')) {
+      len++;
+    }
+  }
+  //lint -e{923} "cast from pointer to unsigned int"
+  return TraceWrite(id, val1, (uint32_t)name, name, len);
+}
+
+
+//  ==== Public API ====
+
+/// Start recording (Trace Buffer is cleared).
+void osRtxTraceStart (uint32_t mode) {
+  uint32_t mask;
+
+  mask = TraceLock();
+
+  Trace.mode   = (uint8_t)mode;
+  Trace.head   = 0U;
+  Trace.tail   = 0U;
+  Trace.count  = 0U;
+  Trace.lost   = 0U;
+  Trace.clock  = OS_Tick_GetClock();
+  Trace.time   = TraceTime();
+  Trace.skip   = 0U;
+  Trace.start  = 1U;
+  Trace.active = 1U;
+
+  TraceUnlock(mask);
+}
+
+/// Stop recording.
+void osRtxTraceStop (void) {
+  Trace.active = 0U;
+}
+
+/// Enable recording of event levels for a range of components.
+void osRtxTraceEnable (uint32_t level, uint32_t comp_start, uint32_t comp_stop) {
+  uint32_t comp, n;
+
+  for (n = 0U; n < 4U; n++) {
+    if ((level & (1UL << n)) != 0U) {
+      for (comp = comp_start; (comp <= comp_stop) && (comp <= 0xFFU); comp++) {
+        Trace.level_off[n][comp >> 5] &= ~(1UL << (comp & 0x1FU));
+      }
+    }
+  }
+}
+
+/// Disable recording of event levels for a range of components.
+void osRtxTraceDisable (uint32_t level, uint32_t comp_start, uint32_t comp_stop) {
+  uint32_t comp, n;
+
+  for (n = 0U; n < 4U; n++) {
+    if ((level & (1UL << n)) != 0U) {
+      for (comp = comp_start; (comp <= comp_stop) && (comp <= 0xFFU); comp++) {
+        Trace.level_off[n][comp >> 5] |=  (1UL << (comp & 0x1FU));
+      }
+    }
+  }
+}
+
+/// Enable recording of a single RTX event.
+void osRtxTraceEventEnable (uint32_t id) {
+  uint32_t comp = ((id >> 8) & 0xFFU) - TRACE_COMP_RTX;
+  uint32_t msg  =   id       & 0xFFU;
+
+  if ((comp < 16U) && (msg < TRACE_MSG_NUM)) {
+    Trace.event_off[comp][msg >> 5] &= ~(1UL << (msg & 0x1FU));
+  }
+}
+
+/// Disable recording of a single RTX event.
+void osRtxTraceEventDisable (uint32_t id) {
+  uint32_t comp = ((id >> 8) & 0xFFU) - TRACE_COMP_RTX;
+  uint32_t msg  =   id       & 0xFFU;
+
+  if ((comp < 16U) && (msg < TRACE_MSG_NUM)) {
+    Trace.event_off[comp][msg >> 5] |=  (1UL << (msg & 0x1FU));
+  }
+}
+
+/// Read Records from the Trace Buffer.
+uint32_t osRtxTraceRead (osRtxTraceRecord_t *rec, uint32_t count) {
+  uint32_t mask;
+  uint32_t num;
+
+  if (rec == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  for (num = 0U; num < count; num++) {
+    mask = TraceLock();
+    if (Trace.start != 0U) {
+      rec[num].id   = (uint16_t)osRtxTraceIdStart;
+      rec[num].time = 0U;
+      rec[num].val1 = Trace.clock;
+      rec[num].val2 = (TRACE_FORMAT << 24) | (OS_EVR_TRACE_SIZE - 1U);
+      Trace.start = 0U;
+    } else if (Trace.skip != 0U) {
+      rec[num].id   = (uint16_t)osRtxTraceIdTime;
+      rec[num].time = 0U;
+      rec[num].val1 = (uint32_t)Trace.skip;
+      rec[num].val2 = (uint32_t)(Trace.skip >> 32);
+      Trace.skip = 0U;
+    } else if (Trace.count != 0U) {
+      rec[num] = TraceBuf[Trace.tail];
+      Trace.tail++;
+      if (Trace.tail == OS_EVR_TRACE_SIZE) {
+        Trace.tail = 0U;
+      }
+      Trace.count--;
+    } else {
+      TraceUnlock(mask);
+      break;
+    }
+    TraceUnlock(mask);
+  }
+
+  return num;
+}
+
+/// Get number of Records in the Trace Buffer.
+uint32_t osRtxTraceGetCount (void) {
+  uint32_t mask;
+  uint32_t count;
+
+  mask  = TraceLock();
+  count = Trace.count + Trace.start;
+  if (Trace.skip != 0U) {
+    count++;
+  }
+  TraceUnlock(mask);
+
+  return count;
+}
+
+/// Record an event with two 32-bit values.
+uint32_t osRtxTraceRecord2 (uint32_t id, uint32_t val1, uint32_t val2) {
+  return TraceWrite(id, val1, val2, NULL, 0U);
+}
+
+/// Record an event with four 32-bit values.
+uint32_t osRtxTraceRecord4 (uint32_t id, uint32_t val1, uint32_t val2, uint32_t val3, uint32_t val4) {
+  uint32_t val[2];
+
+  val[0] = val3;
+  val[1] = val4;
+  return TraceWrite(id, val1, val2, val, 8U);
+}
+
+/// Record an event with data (up to 24 bytes are stored).
+uint32_t osRtxTraceRecordData (uint32_t id, const void *data, uint32_t len) {
+
+  if (data == NULL) {
+    len = 0U;
+  }
+  if (len > TRACE_DATA_MAX) {
+    len = TRACE_DATA_MAX;
+  }
+  return TraceWrite(id, len, 0U, data, len);
+}
+
+#endif  // (OS_EVR_TRACE != 0)
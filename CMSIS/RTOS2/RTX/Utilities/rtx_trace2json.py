@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2026 Arm Limited or its affiliates. All rights reserved.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Converts a binary RTX5 trace (records read with osRtxTraceRead and dumped as they are)
+# into the Chrome Trace Event JSON format, which can be opened in Perfetto or chrome://tracing.
+# Thread switches are shown as running slices per thread and all other events as instant
+# events on the running thread. Event names are taken from the RTX sources (rtx_evr.c).
+#
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+RECORD = struct.Struct('<HHII')         # osRtxTraceRecord_t
+
+ID_START = 0xEF00
+ID_TIME = 0xEF01
+ID_DATA = 0xEF02
+ID_LOST = 0xEF03
+
+ID_THREAD_CREATED_NAME = 0xF22C
+ID_THREAD_SWITCHED = 0xF219
+
+RTX_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+
+def read_event_names(rtx_dir):
+    """ Returns a dictionary of event names indexed by record ID (component and message number). """
+    with open(os.path.join(rtx_dir, 'Include', 'rtx_evr.h')) as f:
+        comps = dict(re.findall(r'#define\s+(EvtRtx\w+No)\s+\((0x[0-9A-Fa-f]+)U\)', f.read()))
+    with open(os.path.join(rtx_dir, 'Source', 'rtx_evr.c')) as f:
+        events = re.findall(r'#define\s+EvtRtx(\w+)\s+EventID\(\s*EventLevel\w+\s*,\s*(EvtRtx\w+No)\s*,\s*(0x[0-9A-Fa-f]+)U\)',
+                            f.read())
+    names = {}
+    for name, comp, msg in events:
+        names[(int(comps[comp], 16) << 8) | int(msg, 16)] = name
+    return names
+
+
+def read_records(data):
+    """ Returns a list of events (time, id, val1, val2, data) with absolute times in timer counts. """
+    events = []
+    freq = None
+    time = 0
+    for offset in range(0, len(data) - RECORD.size + 1, RECORD.size):
+        rec_id, delta, val1, val2 = RECORD.unpack_from(data, offset)
+        if rec_id == ID_TIME:
+            time += val1 | (val2 << 32)
+            continue
+        if rec_id == ID_DATA:
+            if events:
+                events[-1][4].extend(struct.pack('<II', val1, val2))
+            continue
+        time += delta
+        if rec_id == ID_START:
+            freq = val1
+            continue
+        events.append((time, rec_id, val1, val2, bytearray()))
+    return events, freq
+
+
+def convert(events, freq, names):
+    """ Returns the Chrome Trace Event list. """
+    trace = []
+    threads = {}
+    curr = 0
+    start = 0
+
+    def us(time):
+        return time * 1e6 / freq
+
+    def thread_name(thread_id, name):
+        if thread_id not in threads:
+            threads[thread_id] = name
+            trace.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': thread_id,
+                          'args': {'name': name}})
+
+    for time, rec_id, val1, val2, data in events:
+        if rec_id == ID_LOST:
+            trace.append({'name': 'Lost', 'ph': 'i', 's': 'g', 'pid': 1, 'tid': curr, 'ts': us(time),
+                          'args': {'events': val1}})
+            continue
+        if rec_id == ID_THREAD_CREATED_NAME:
+            name = bytes(data).split(b'\0')[0].decode('ascii', 'replace')
+            thread_name(val1, name or '0x%08X' % val1)
+        if rec_id == ID_THREAD_SWITCHED:
+            if curr != 0:
+                trace.append({'name': 'Running', 'ph': 'X', 'pid': 1, 'tid': curr, 'ts': us(start),
+                              'dur': us(time - start)})
+            thread_name(val1, '0x%08X' % val1)
+            curr = val1
+            start = time
+        args = {'val1': '0x%08X' % val1, 'val2': '0x%08X' % val2}
+        if data:
+            args['data'] = data.hex()
+        trace.append({'name': names.get(rec_id, 'Event 0x%04X' % rec_id), 'ph': 'i', 's': 't', 'pid': 1,
+                      'tid': curr, 'ts': us(time), 'args': args})
+
+    if curr != 0 and events:
+        trace.append({'name': 'Running', 'ph': 'X', 'pid': 1, 'tid': curr, 'ts': us(start),
+                      'dur': us(events[-1][0] - start)})
+    thread_name(0, 'Kernel')
+    return trace
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a binary RTX5 trace into Chrome Trace Event JSON.')
+    parser.add_argument('input', help='binary trace file')
+    parser.add_argument('-o', '--output', help='JSON output file (default: standard output)')
+    parser.add_argument('--freq', type=int, help='system timer frequency in Hz (when the trace has no Start record)')
+    parser.add_argument('--rtx', default=RTX_DIR, help='RTX directory with the sources defining the events')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    events, freq = read_records(data)
+    if args.freq is not None:
+        freq = args.freq
+    if not freq:
+        sys.exit('error: system timer frequency unknown (use --freq)')
+
+    trace = convert(events, freq, read_event_names(args.rtx))
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    json.dump({'traceEvents': trace, 'displayTimeUnit': 'ns'}, out, indent=1)
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
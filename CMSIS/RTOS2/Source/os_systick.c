@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_systick.c
  * @brief    CMSIS OS Tick SysTick implementation
- * @version  V1.0.2
- * @date     6. March 2020
+ * @version  V1.0.3
+ * @date     17. October 2026
  ******************************************************************************/
 /*
- * Copyright (c) 2017-2020 ARM Limited. All rights reserved.
+ * Copyright (c) 2017-2026 ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -34,7 +34,11 @@
 #define SYSTICK_IRQ_PRIORITY    0xFFU
 #endif
 
-static uint8_t PendST;
+static uint8_t  PendST;
+static uint8_t  PendLoad;               // Tick period to be restored after a partial tick
+static uint32_t TickLoad;               // Tick period in timer cycles
+static uint32_t SleepLoad;              // Tick-less sleep period in timer cycles
+static uint32_t SleepOffs;              // Timer cycles of the current tick elapsed before sleep
 
 // Setup OS Tick.
 __WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
@@ -72,7 +76,9 @@ __WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
   SysTick->LOAD =  load;
   SysTick->VAL  =  0U;
 
-  PendST = 0U;
+  PendST   = 0U;
+  PendLoad = 0U;
+  TickLoad = load + 1U;
 
   return (0);
 }
@@ -86,6 +92,14 @@ __WEAK void OS_Tick_Enable (void) {
   }
 
   SysTick->CTRL |=  SysTick_CTRL_ENABLE_Msk;
+
+  if (PendLoad != 0U) {
+    // Wait until the counter has loaded the rest of the partial tick
+    PendLoad = 0U;
+    while (SysTick->VAL == 0U) {}
+    // Continue with the tick period
+    SysTick->LOAD = TickLoad - 1U;
+  }
 }
 
 /// Disable OS Tick.
@@ -130,4 +144,82 @@ __WEAK uint32_t OS_Tick_GetOverflow (void) {
   return ((SysTick->CTRL >> 16) & 1U);
 }
 
+// Suspend OS Tick for tick-less sleep.
+__WEAK uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  uint32_t max;
+
+  // Pending tick needs to be processed by the kernel first
+  if ((PendST != 0U) || (TickLoad == 0U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  max = (SysTick_LOAD_RELOAD_Msk + 1U) / TickLoad;
+  if (ticks > max) {
+    ticks = max;
+  }
+  if (ticks == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  // Timer is stopped by OS_Tick_Disable: expire at the end of tick 'ticks'
+  // (counter value is the number of cycles left until the next tick)
+  if (SysTick->VAL != 0U) {
+    SleepOffs = TickLoad - SysTick->VAL;
+  } else {
+    SleepOffs = 0U;
+  }
+  SleepLoad = (ticks * TickLoad) - SleepOffs;
+  if (SleepLoad < 2U) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  SysTick->LOAD  = SleepLoad - 1U;
+  SysTick->VAL   = 0U;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+  return (ticks);
+}
+
+// Resume OS Tick after tick-less sleep.
+__WEAK uint32_t OS_Tick_Resume (void) {
+  uint32_t ctrl;
+  uint32_t cycles;
+  uint32_t ticks;
+  uint32_t rest;
+
+  // Stop timer (reading CTRL clears COUNTFLAG)
+  ctrl = SysTick->CTRL;
+  SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+  // Cycles elapsed since the last tick before sleep
+  if (SysTick->VAL != 0U) {
+    cycles = (SleepLoad - SysTick->VAL) + SleepOffs;
+  } else {
+    cycles = SleepOffs;
+  }
+  if (((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U) ||
+      ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)) {
+    // Sleep period expired (tick interrupt is consumed here)
+    SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+    cycles += SleepLoad;
+  }
+
+  // Continue with the rest of the current tick
+  ticks = cycles / TickLoad;
+  rest  = TickLoad - (cycles - (ticks * TickLoad));
+  if (rest < 2U) {
+    // Reload value 0 would not generate a tick
+    ticks++;
+    rest = TickLoad;
+  }
+  SysTick->LOAD = rest - 1U;
+  SysTick->VAL  = 0U;
+  PendLoad = 1U;
+
+  return (ticks);
+}
+
 #endif  // SysTick
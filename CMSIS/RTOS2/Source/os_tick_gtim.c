@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_tick_gtim.c
  * @brief    CMSIS OS Tick implementation for Generic Timer
- * @version  V1.0.1
- * @date     24. November 2017
+ * @version  V1.0.2
+ * @date     17. October 2026
  ******************************************************************************/
 /*
- * Copyright (c) 2017 ARM Limited. All rights reserved.
+ * Copyright (c) 2017-2026 ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -45,6 +45,12 @@ static uint32_t GTIM_Clock;
 // Timer load value
 static uint32_t GTIM_Load;
 
+// Counter value of the last tick before a tick-less sleep
+static uint64_t GTIM_SleepBase;
+
+// Compare value ending a tick-less sleep
+static uint64_t GTIM_SleepCval;
+
 // Setup OS Tick.
 int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
   uint32_t prio, bits;
@@ -185,3 +191,59 @@ uint32_t OS_Tick_GetOverflow (void) {
   cntp_ctl.w = PL1_GetControl();
   return (cntp_ctl.b.ISTATUS);
 }
+
+// Suspend OS Tick for tick-less sleep.
+uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  uint64_t interval;
+  uint64_t cval;
+  uint32_t ctrl;
+
+  // Pending tick needs to be processed by the kernel first
+  if ((GTIM_PendIRQ != 0U) || (ticks == 0U)) {
+    return (0U);
+  }
+
+  // Timer is stopped by OS_Tick_Disable: compare value still holds the next tick
+  interval = (uint64_t)GTIM_Load + 1U;
+  cval     = PL1_GetPhysicalCompareValue();
+  if (cval <= PL1_GetCurrentPhysicalValue()) {
+    return (0U);
+  }
+
+  // Expire at the end of tick 'ticks'
+  GTIM_SleepBase = cval - interval;
+  GTIM_SleepCval = cval + ((uint64_t)(ticks - 1U) * interval);
+  PL1_SetPhysicalCompareValue(GTIM_SleepCval);
+
+  ctrl  = PL1_GetControl();
+  ctrl |= 1U;
+  PL1_SetControl(ctrl);
+
+  return (ticks);
+}
+
+// Resume OS Tick after tick-less sleep.
+uint32_t OS_Tick_Resume (void) {
+  uint64_t interval;
+  uint64_t count;
+  uint64_t ticks;
+  uint32_t ctrl;
+
+  // Stop timer
+  ctrl  = PL1_GetControl();
+  ctrl &= ~1U;
+  PL1_SetControl(ctrl);
+
+  count = PL1_GetCurrentPhysicalValue();
+  if (count >= GTIM_SleepCval) {
+    // Sleep period expired (tick interrupt is consumed here)
+    IRQ_ClearPending(GTIM_IRQ_NUM);
+  }
+
+  // Continue with the rest of the current tick
+  interval = (uint64_t)GTIM_Load + 1U;
+  ticks    = (count - GTIM_SleepBase) / interval;
+  PL1_SetPhysicalCompareValue(GTIM_SleepBase + ((ticks + 1U) * interval));
+
+  return ((uint32_t)ticks);
+}
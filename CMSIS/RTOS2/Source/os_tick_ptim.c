@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_tick_ptim.c
  * @brief    CMSIS OS Tick implementation for Private Timer
- * @version  V1.0.2
- * @date     02. March 2018
+ * @version  V1.0.3
+ * @date     17. October 2026
  ******************************************************************************/
 /*
- * Copyright (c) 2017-2018 Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -34,7 +34,10 @@
 #define PTIM_IRQ_PRIORITY           0xFFU
 #endif
 
-static uint8_t PTIM_PendIRQ;        // Timer interrupt pending flag
+static uint8_t  PTIM_PendIRQ;       // Timer interrupt pending flag
+static uint32_t PTIM_TickLoad;      // Tick period in timer cycles
+static uint32_t PTIM_SleepLoad;     // Tick-less sleep period in timer cycles
+static uint32_t PTIM_SleepOffs;     // Timer cycles of the current tick elapsed before sleep
 
 // Setup OS Tick.
 int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
@@ -162,4 +165,81 @@ uint32_t OS_Tick_GetOverflow (void) {
   return (PTIM->ISR & 1);
 }
 
+// Suspend OS Tick for tick-less sleep.
+uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  uint32_t max;
+  uint32_t ctrl;
+
+  // Pending tick needs to be processed by the kernel first
+  if ((PTIM_PendIRQ != 0U) || (PTIM_GetEventFlag() != 0U)) {
+    return (0U);
+  }
+
+  PTIM_TickLoad = PTIM_GetLoadValue() + 1U;
+  max = 0xFFFFFFFFU / PTIM_TickLoad;
+  if (ticks > max) {
+    ticks = max;
+  }
+  if (ticks == 0U) {
+    return (0U);
+  }
+
+  // Timer is stopped by OS_Tick_Disable: expire at the end of tick 'ticks'
+  // (counter value is the number of cycles left until the next tick)
+  PTIM_SleepOffs  = PTIM_TickLoad - (PTIM_GetCurrentValue() + 1U);
+  PTIM_SleepLoad  = (ticks * PTIM_TickLoad) - PTIM_SleepOffs;
+  if (PTIM_SleepLoad < 2U) {
+    return (0U);
+  }
+
+  // Single shot: counter stops at zero when the sleep period expires
+  PTIM_SetLoadValue (PTIM_SleepLoad - 1U);
+  ctrl  = PTIM_GetControl();
+  ctrl &= ~2U;
+  ctrl |=  1U;
+  PTIM_SetControl (ctrl);
+
+  return (ticks);
+}
+
+// Resume OS Tick after tick-less sleep.
+uint32_t OS_Tick_Resume (void) {
+  uint32_t ctrl;
+  uint32_t cycles;
+  uint32_t ticks;
+  uint32_t rest;
+
+  // Stop timer
+  ctrl  = PTIM_GetControl();
+  ctrl &= ~1U;
+  PTIM_SetControl (ctrl);
+
+  // Cycles elapsed since the last tick before sleep
+  if (PTIM_GetEventFlag() != 0U) {
+    // Sleep period expired (tick interrupt is consumed here)
+    PTIM_ClearEventFlag();
+    IRQ_ClearPending (PrivTimer_IRQn);
+    cycles = PTIM_SleepOffs + PTIM_SleepLoad;
+  } else {
+    cycles = PTIM_SleepOffs + ((PTIM_SleepLoad - 1U) - PTIM_GetCurrentValue());
+  }
+
+  // Continue with the rest of the current tick
+  ticks = cycles / PTIM_TickLoad;
+  rest  = PTIM_TickLoad - (cycles - (ticks * PTIM_TickLoad));
+  if (rest < 2U) {
+    // Counter value 0 would not generate a tick
+    ticks++;
+    rest = PTIM_TickLoad;
+  }
+  PTIM_SetLoadValue    (PTIM_TickLoad - 1U);
+  PTIM_SetCurrentValue (rest - 1U);
+
+  // Restore auto reload
+  ctrl |= 2U;
+  PTIM_SetControl (ctrl);
+
+  return (ticks);
+}
+
 #endif  // PTIM
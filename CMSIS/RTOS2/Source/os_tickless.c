@@ -0,0 +1,75 @@
+/**************************************************************************//**
+ * @file     os_tickless.c
+ * @brief    CMSIS OS Tick-less Idle implementation
+ * @version  V1.0.0
+ * @date     17. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2026 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os_tick.h"
+#include "cmsis_os2.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+// Minimum number of ticks worth stopping the periodic tick for
+#ifndef OS_TICKLESS_MIN_TICKS
+#define OS_TICKLESS_MIN_TICKS   2U
+#endif
+
+// Enter low-power state.
+__WEAK void OS_Tickless_Sleep (uint32_t ticks) {
+  (void)ticks;
+
+  __DSB();
+  __WFI();
+}
+
+// Tick-less idle.
+void OS_Tickless_Idle (void) {
+  uint32_t ticks;
+  uint32_t slept;
+
+  // Stop scheduler: next wake-up time from thread delay and timer lists
+  ticks = osKernelSuspend();
+
+  slept = 0U;
+  if (ticks >= OS_TICKLESS_MIN_TICKS) {
+    __disable_irq();
+    ticks = OS_Tick_Suspend(ticks);
+    if (ticks != 0U) {
+      // Sleep until the tick timer expires or any other interrupt is pending
+      OS_Tickless_Sleep(ticks);
+      slept = OS_Tick_Resume();
+    }
+    __enable_irq();
+  } else {
+    ticks = 0U;
+  }
+
+  // Compensate elapsed ticks and restart scheduler
+  osKernelResume(slept);
+
+  if (ticks == 0U) {
+    // Short idle period: sleep with periodic tick
+    __disable_irq();
+    OS_Tickless_Sleep(0U);
+    __enable_irq();
+  }
+}